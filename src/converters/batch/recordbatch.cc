@@ -0,0 +1,286 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <iterator>
+#include <stdexcept>
+
+#include "consts.h"
+#include "intl.h"
+#include "jsonreader.hh"
+#include "logger.hh"
+#include "parallel.hh"
+#include "recordbatch.hh"
+#include "recordlookup.hh"
+
+using namespace yapet;
+
+namespace {
+using Token = JSONReader::Token;
+using Members = std::vector<std::pair<std::string, std::string>>;
+
+constexpr RecordField ALL_FIELDS[]{RecordField::NAME,     RecordField::HOST,
+                                   RecordField::USERNAME, RecordField::PASSWORD,
+                                   RecordField::COMMENT,  RecordField::TAGS};
+
+void wipe(std::string& str) {
+    std::fill(str.begin(), str.end(), '\0');
+    str.clear();
+}
+
+/**
+ * The members of a command object. The values are wiped when the command
+ * has been applied, since they may hold passwords.
+ */
+struct Command {
+    JSONReader::line_number_type lineNumber;
+    Members members;
+
+    ~Command() {
+        for (auto& member : members) wipe(member.second);
+    }
+
+    [[noreturn]] void error(const char* message) const {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Line %u: %s"), lineNumber, message);
+        throw std::runtime_error(msg);
+    }
+
+    const std::string& member(const char* key) const {
+        for (const auto& member : members) {
+            if (member.first == key) return member.second;
+        }
+
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Member '%s' missing"), key);
+        throw std::runtime_error(msg);
+    }
+};
+
+/**
+ * Reads the object following the start of a document. \c null is read as
+ * empty string, numbers and booleans are read as their text.
+ */
+void readCommand(JSONReader& reader, Command& command) {
+    if (reader.next() != Token::START_OBJECT) {
+        command.error(_("command object expected"));
+    }
+
+    while (reader.next() == Token::KEY) {
+        std::string key{reader.string()};
+        Token token{reader.next()};
+        if (token == Token::START_OBJECT || token == Token::START_ARRAY) {
+            reader.skip();
+            command.error(_("string expected"));
+        }
+        command.members.emplace_back(std::move(key), reader.string());
+    }
+}
+
+void applyCommand(RecordBatch& batch, const Command& command) {
+    const auto& name{command.member("command")};
+    if (name == "add") {
+        std::vector<std::pair<RecordField, std::string>> record;
+        for (const auto& member : command.members) {
+            if (member.first == "command") continue;
+            record.emplace_back(parseRecordField(member.first), member.second);
+        }
+        try {
+            batch.add(record);
+        } catch (...) {
+            for (auto& field : record) wipe(field.second);
+            throw;
+        }
+        for (auto& field : record) wipe(field.second);
+    } else if (name == "update-field") {
+        batch.updateField(command.member("name"),
+                          parseRecordField(command.member("field")),
+                          command.member("value"));
+    } else if (name == "delete") {
+        batch.remove(command.member("name"));
+    } else if (name == "rename") {
+        batch.rename(command.member("name"), command.member("new-name"));
+    } else {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Unknown command '%s'"), name.c_str());
+        throw std::runtime_error(msg);
+    }
+}
+}  // namespace
+
+RecordBatch::RecordBatch(std::shared_ptr<AbstractCryptoFactory> cryptoFactory,
+                         std::vector<SecureArray> encryptedRecords)
+    : _cryptoFactory{cryptoFactory},
+      _crypto{cryptoFactory->crypto()},
+      _entries{},
+      _index{},
+      _modified{false} {
+    auto names{RecordLookup{_cryptoFactory}.names(encryptedRecords)};
+
+    _entries.reserve(encryptedRecords.size());
+    _index.reserve(encryptedRecords.size());
+    for (size_type i = 0; i < encryptedRecords.size(); i++) {
+        _entries.push_back(Entry{std::move(encryptedRecords[i]),
+                                 std::unique_ptr<PasswordRecord>{}, false});
+        _index.emplace(reinterpret_cast<const char*>(*names[i]), i);
+    }
+}
+
+RecordBatch::size_type RecordBatch::find(const std::string& name) const {
+    auto range{_index.equal_range(name)};
+    if (range.first != range.second && std::next(range.first) == range.second) {
+        return range.first->second;
+    }
+
+    char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+    std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                  range.first == range.second
+                      ? _("No record named '%s'")
+                      : _("More than one record named '%s'"),
+                  name.c_str());
+    throw std::runtime_error(msg);
+}
+
+/**
+ * The password record at \c index, decrypted if it has not been changed
+ * before.
+ */
+PasswordRecord& RecordBatch::change(size_type index) {
+    auto& entry{_entries[index]};
+    if (!entry.passwordRecord) {
+        entry.passwordRecord.reset(
+            new PasswordRecord{_crypto->decrypt(entry.encryptedRecord)});
+    }
+    return *entry.passwordRecord;
+}
+
+void RecordBatch::unindex(const std::string& name, size_type index) {
+    auto range{_index.equal_range(name)};
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == index) {
+            _index.erase(it);
+            return;
+        }
+    }
+}
+
+void RecordBatch::add(
+    const std::vector<std::pair<RecordField, std::string>>& record) {
+    std::unique_ptr<PasswordRecord> passwordRecord{new PasswordRecord{}};
+    for (auto field : ALL_FIELDS) {
+        setRecordFieldValue(*passwordRecord, field, "");
+    }
+    for (const auto& field : record) {
+        setRecordFieldValue(*passwordRecord, field.first, field.second);
+    }
+
+    std::size_t size;
+    const char* name{
+        recordFieldValue(*passwordRecord, RecordField::NAME, size)};
+    _index.emplace(std::string{name, size}, _entries.size());
+    _entries.push_back(Entry{SecureArray{}, std::move(passwordRecord), false});
+    _modified = true;
+}
+
+void RecordBatch::updateField(const std::string& name, RecordField field,
+                              const std::string& value) {
+    auto index{find(name)};
+    setRecordFieldValue(change(index), field, value);
+    if (field == RecordField::NAME) {
+        unindex(name, index);
+        _index.emplace(value, index);
+    }
+    _modified = true;
+}
+
+void RecordBatch::remove(const std::string& name) {
+    auto index{find(name)};
+    unindex(name, index);
+
+    auto& entry{_entries[index]};
+    entry.encryptedRecord = SecureArray{};
+    entry.passwordRecord.reset();
+    entry.deleted = true;
+    _modified = true;
+}
+
+RecordBatch::size_type RecordBatch::apply(const std::string& fileName) {
+    JSONReader reader{fileName};
+    size_type commands{0};
+
+    while (reader.nextDocument()) {
+        Command command;
+        command.lineNumber = reader.lineNumber();
+        readCommand(reader, command);
+        try {
+            applyCommand(*this, command);
+        } catch (std::exception& ex) {
+            command.error(ex.what());
+        }
+        commands++;
+    }
+
+    LOG_MESSAGE(std::string{__func__} + ": " + std::to_string(commands) +
+                " commands applied");
+    return commands;
+}
+
+std::vector<SecureArray> RecordBatch::encryptedRecords() {
+    std::vector<size_type> changed;
+    for (size_type i = 0; i < _entries.size(); i++) {
+        if (_entries[i].passwordRecord) changed.push_back(i);
+    }
+
+    parallelFor(changed.size(), [this, &changed](unsigned int,
+                                                 std::size_t begin,
+                                                 std::size_t end) {
+        auto crypto{_cryptoFactory->crypto()};
+        for (auto i = begin; i < end; i++) {
+            auto& entry{_entries[changed[i]]};
+            entry.encryptedRecord =
+                crypto->encrypt(entry.passwordRecord->serialize());
+            entry.passwordRecord.reset();
+        }
+    });
+
+    std::vector<SecureArray> result;
+    result.reserve(size());
+    for (const auto& entry : _entries) {
+        if (!entry.deleted) result.push_back(entry.encryptedRecord);
+    }
+    return result;
+}
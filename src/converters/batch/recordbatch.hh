@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _RECORDBATCH_HH
+#define _RECORDBATCH_HH
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "abstractcryptofactory.hh"
+#include "crypto.hh"
+#include "passwordrecord.hh"
+#include "recordfield.hh"
+#include "securearray.hh"
+
+namespace yapet {
+/**
+ * Many changes to the records of a file, applied in memory.
+ *
+ * The records are kept encrypted. Only the names are decrypted when the
+ * batch is created, in order to find records by name. A record is
+ * decrypted when it is changed for the first time, and all changed records
+ * are encrypted again at once, in parallel, by \c encryptedRecords().
+ * Thus, the cost of a batch does not depend on the number of changes to a
+ * record, and the file needs to be read and written only once.
+ *
+ * Records are addressed by name. Changing a record whose name is not
+ * unique fails.
+ */
+class RecordBatch {
+   public:
+    using size_type = std::size_t;
+
+   private:
+    struct Entry {
+        SecureArray encryptedRecord;
+        //! Set if the record has been changed since it was encrypted.
+        std::unique_ptr<PasswordRecord> passwordRecord;
+        bool deleted;
+    };
+
+    std::shared_ptr<AbstractCryptoFactory> _cryptoFactory;
+    std::unique_ptr<Crypto> _crypto;
+    std::vector<Entry> _entries;
+    std::unordered_multimap<std::string, size_type> _index;
+    bool _modified;
+
+    size_type find(const std::string& name) const;
+    PasswordRecord& change(size_type index);
+    void unindex(const std::string& name, size_type index);
+
+   public:
+    RecordBatch(std::shared_ptr<AbstractCryptoFactory> cryptoFactory,
+                std::vector<SecureArray> encryptedRecords);
+    RecordBatch(const RecordBatch&) = delete;
+    RecordBatch& operator=(const RecordBatch&) = delete;
+
+    /**
+     * Add a record. Fields not set in \c record are left empty.
+     *
+     * @throw std::invalid_argument if a value does not fit into its field.
+     */
+    void add(const std::vector<std::pair<RecordField, std::string>>& record);
+
+    /**
+     * Set \c field of the record named \c name to \c value.
+     *
+     * @throw std::runtime_error if there is no such record, or the name is
+     * not unique.
+     *
+     * @throw std::invalid_argument if \c value does not fit into the field.
+     */
+    void updateField(const std::string& name, RecordField field,
+                     const std::string& value);
+
+    /**
+     * Delete the record named \c name.
+     *
+     * @throw std::runtime_error if there is no such record, or the name is
+     * not unique.
+     */
+    void remove(const std::string& name);
+
+    /**
+     * Rename the record named \c name to \c newName.
+     *
+     * Same as \c updateField() for the name field.
+     */
+    void rename(const std::string& name, const std::string& newName) {
+        updateField(name, RecordField::NAME, newName);
+    }
+
+    /**
+     * Apply the commands read from \c fileName. The file holds one JSON
+     * object per line, whose \c command member is one of
+     *
+     * - \c add, with the fields of the new record as further members,
+     * - \c update-field, with the members \c name, \c field, and \c value,
+     * - \c delete, with the member \c name,
+     * - \c rename, with the members \c name and \c new-name.
+     *
+     * @return the number of commands applied.
+     *
+     * @throw std::runtime_error if a command cannot be read or applied.
+     * Commands preceding it have been applied.
+     */
+    size_type apply(const std::string& fileName);
+
+    //! Whether any record has been added, changed, or deleted.
+    bool modified() const { return _modified; }
+
+    //! The number of records, not counting deleted ones.
+    size_type size() const { return _index.size(); }
+
+    /**
+     * The encrypted records, in file order followed by the records added.
+     * Changed records are encrypted in parallel, each worker thread using
+     * its own \c Crypto instance.
+     */
+    std::vector<SecureArray> encryptedRecords();
+};
+}  // namespace yapet
+
+#endif
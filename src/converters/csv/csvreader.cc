@@ -0,0 +1,297 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include "consts.h"
+#include "csvreader.hh"
+#include "intl.h"
+
+using namespace yapet;
+
+namespace {
+constexpr char NEW_LINE_CHARACTER{'\n'};
+constexpr char DOUBLE_QUOTE{'"'};
+
+inline const char* find(const char* begin, const char* end, char c) {
+    return static_cast<const char*>(std::memchr(begin, c, end - begin));
+}
+
+inline CSVReader::line_number_type countNewLines(const char* begin,
+                                                 const char* end) {
+    CSVReader::line_number_type newLines{0};
+    while ((begin = find(begin, end, NEW_LINE_CHARACTER)) != nullptr) {
+        newLines++;
+        begin++;
+    }
+    return newLines;
+}
+}  // namespace
+
+constexpr CSVReader::size_type CSVReader::DEFAULT_BUFFER_SIZE;
+
+/**
+ * Make room in the buffer and read the next block of the file.
+ *
+ * @return \c false if the end of the file has been reached.
+ */
+bool CSVReader::fill() {
+    if (_begin > 0) {
+        std::memmove(_buffer.data(), _buffer.data() + _begin, _end - _begin);
+        _end -= _begin;
+        _begin = 0;
+    }
+
+    // The last byte of the buffer is kept free for terminating the last
+    // field of a file not ending with a new line.
+    if (_end == _buffer.size() - 1) {
+        _buffer.resize(2 * _buffer.size());
+    }
+
+    ssize_t n;
+    do {
+        n = ::read(_fd, _buffer.data() + _end, _buffer.size() - 1 - _end);
+    } while (n == -1 && errno == EINTR);
+
+    if (n == -1) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Error reading CSV file: %s"), std::strerror(errno));
+        throw std::runtime_error(msg);
+    }
+
+    if (n == 0) {
+        _eof = true;
+        return false;
+    }
+
+    _end += n;
+    return true;
+}
+
+/**
+ * Find the end and the fields of the record starting at \c _begin.
+ *
+ * @return \c false if the buffer does not hold the entire record.
+ */
+bool CSVReader::scanRecord(size_type& consumed, size_type& newLines) {
+    const char* data{_buffer.data()};
+    const char* end{data + _end};
+    const char* p{data + _begin};
+    // The next new line at or after p, or end if there is none in the
+    // buffer
+    const char* lineEnd{nullptr};
+
+    _fields.clear();
+    newLines = 0;
+
+    for (;;) {
+        if (p < end && *p == DOUBLE_QUOTE) {
+            const char* fieldBegin{p};
+            const char* q{p + 1};
+            for (;;) {
+                const char* quote{find(q, end, DOUBLE_QUOTE)};
+                if (quote == nullptr || quote + 1 == end) {
+                    if (!_eof) return false;
+
+                    newLines += countNewLines(fieldBegin, end);
+                    _fields.push_back(Field{
+                        static_cast<size_type>(fieldBegin - data),
+                        static_cast<size_type>(end - data), true});
+                    if (quote == nullptr) {
+                        _error = _("'\"' mismatch");
+                    }
+                    _recordSize = consumed = end - (data + _begin);
+                    return true;
+                }
+
+                char lookAhead{quote[1]};
+                if (lookAhead == DOUBLE_QUOTE) {
+                    q = quote + 2;
+                    continue;
+                }
+
+                if (lookAhead == _separator ||
+                    lookAhead == NEW_LINE_CHARACTER) {
+                    newLines += countNewLines(fieldBegin, quote);
+                    _fields.push_back(Field{
+                        static_cast<size_type>(fieldBegin - data),
+                        static_cast<size_type>(quote + 1 - data), true});
+
+                    if (lookAhead == NEW_LINE_CHARACTER) {
+                        newLines++;
+                        _recordSize = quote + 1 - (data + _begin);
+                        consumed = _recordSize + 1;
+                        return true;
+                    }
+
+                    p = quote + 2;
+                    break;
+                }
+
+                // A lone double quote, reported when unescaping
+                q = quote + 1;
+            }
+            continue;
+        }
+
+        if (lineEnd == nullptr || lineEnd < p) {
+            lineEnd = find(p, end, NEW_LINE_CHARACTER);
+            if (lineEnd == nullptr) lineEnd = end;
+        }
+
+        const char* separator{find(p, lineEnd, _separator)};
+        if (separator != nullptr) {
+            _fields.push_back(Field{static_cast<size_type>(p - data),
+                                    static_cast<size_type>(separator - data),
+                                    false});
+            p = separator + 1;
+            continue;
+        }
+
+        if (lineEnd == end && !_eof) return false;
+
+        _fields.push_back(Field{static_cast<size_type>(p - data),
+                                static_cast<size_type>(lineEnd - data),
+                                false});
+        _recordSize = lineEnd - (data + _begin);
+        if (lineEnd == end) {
+            consumed = _recordSize;
+        } else {
+            newLines++;
+            consumed = _recordSize + 1;
+        }
+        return true;
+    }
+}
+
+/**
+ * Unescape the quoted fields of the current record in place, and null
+ * terminate all fields.
+ */
+void CSVReader::unescapeFields() {
+    char* data{_buffer.data()};
+
+    for (auto& field : _fields) {
+        if (!field.quoted || !_error.empty()) {
+            data[field.end] = '\0';
+            continue;
+        }
+
+        char* write{data + field.begin};
+        const char* read{write + 1};
+        const char* innerEnd{data + field.end - 1};
+        for (;;) {
+            const char* quote{find(read, innerEnd, DOUBLE_QUOTE)};
+            if (quote == nullptr) quote = innerEnd;
+
+            auto length{quote - read};
+            std::memmove(write, read, length);
+            write += length;
+            if (quote == innerEnd) break;
+
+            if (quote + 1 == innerEnd || quote[1] != DOUBLE_QUOTE) {
+                char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+                std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                              _("Expected '%c' but got %c"), DOUBLE_QUOTE,
+                              quote[1]);
+                _error = msg;
+                break;
+            }
+
+            *write++ = DOUBLE_QUOTE;
+            read = quote + 2;
+        }
+
+        field.end = write - data;
+        *write = '\0';
+    }
+}
+
+CSVReader::CSVReader(const std::string& fileName, char separator,
+                     size_type bufferSize)
+    : _fd{-1},
+      _separator{separator},
+      _buffer(std::max(bufferSize, static_cast<size_type>(1)) + 1),
+      _begin{0},
+      _end{0},
+      _eof{false},
+      _lines{0},
+      _lineNumber{0},
+      _recordSize{0},
+      _fields{},
+      _error{} {
+    _fd = ::open(fileName.c_str(), O_RDONLY);
+    if (_fd == -1) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Cannot open '%s'"), fileName.c_str());
+        throw std::runtime_error(msg);
+    }
+}
+
+CSVReader::~CSVReader() {
+    if (_fd != -1) ::close(_fd);
+}
+
+bool CSVReader::next() {
+    _error.clear();
+
+    size_type consumed;
+    size_type newLines;
+    for (;;) {
+        if (_begin == _end) {
+            if (_eof || !fill()) return false;
+        }
+
+        if (scanRecord(consumed, newLines)) break;
+
+        fill();
+    }
+
+    _lines += newLines;
+    // A last line not terminated by a new line is a line nevertheless
+    _lineNumber = consumed > _recordSize ? _lines : _lines + 1;
+
+    unescapeFields();
+    _begin += consumed;
+
+    return true;
+}
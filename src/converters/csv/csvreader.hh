@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _CSVREADER_HH
+#define _CSVREADER_HH
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace yapet {
+/**
+ * Buffered reader splitting a CSV file into records and fields.
+ *
+ * The file is read in large blocks. Separators, quotes and line ends are
+ * located using \c memchr, and fields are unescaped in place, so reading a
+ * record does not allocate memory once the buffer has grown to hold the
+ * longest record.
+ *
+ * Fields and records are recognized the same way as by \c CSVLine and
+ * https://www.ietf.org/rfc/rfc4180.txt: a field starting with a double
+ * quote extends to the next double quote followed by a separator or a new
+ * line, and may thus contain separators and new lines. Two consecutive
+ * double quotes in such a field stand for one double quote. Double quotes
+ * in fields not starting with a double quote are taken literally.
+ */
+class CSVReader {
+   public:
+    using line_number_type = unsigned int;
+    using size_type = std::size_t;
+
+    static constexpr size_type DEFAULT_BUFFER_SIZE{1024 * 1024};
+
+   private:
+    struct Field {
+        size_type begin;
+        size_type end;
+        bool quoted;
+    };
+
+    int _fd;
+    char _separator;
+    std::vector<char> _buffer;
+    // Unconsumed data in the buffer
+    size_type _begin;
+    size_type _end;
+    bool _eof;
+    line_number_type _lines;
+    line_number_type _lineNumber;
+    size_type _recordSize;
+    std::vector<Field> _fields;
+    std::string _error;
+
+    bool fill();
+    bool scanRecord(size_type& consumed, size_type& newLines);
+    void unescapeFields();
+
+   public:
+    /**
+     * Open \c fileName for reading.
+     *
+     * @throw std::runtime_error if the file cannot be opened.
+     */
+    CSVReader(const std::string& fileName, char separator = ',',
+              size_type bufferSize = DEFAULT_BUFFER_SIZE);
+    ~CSVReader();
+
+    CSVReader(const CSVReader&) = delete;
+    CSVReader(CSVReader&&) = delete;
+    CSVReader& operator=(const CSVReader&) = delete;
+    CSVReader& operator=(CSVReader&&) = delete;
+
+    /**
+     * Read the next record.
+     *
+     * A malformed record is consumed nevertheless, and \c error() tells
+     * what is wrong about it.
+     *
+     * @return \c false if there are no more records.
+     *
+     * @throw std::runtime_error on read errors.
+     */
+    bool next();
+
+    /**
+     * The line the current record ends on, starting at 1.
+     */
+    line_number_type lineNumber() const { return _lineNumber; }
+
+    /**
+     * The size of the current record as found in the file, without the
+     * terminating new line.
+     */
+    size_type recordSize() const { return _recordSize; }
+
+    /**
+     * The error found in the current record, or an empty string if the
+     * record is well-formed.
+     */
+    const std::string& error() const { return _error; }
+
+    size_type numberOfFields() const { return _fields.size(); }
+
+    /**
+     * The unescaped field \c index of the current record as null terminated
+     * string. The pointer is valid until \c next() is called.
+     */
+    const char* field(size_type index) const {
+        return _buffer.data() + _fields[index].begin;
+    }
+
+    size_type fieldSize(size_type index) const {
+        return _fields[index].end - _fields[index].begin;
+    }
+};
+}  // namespace yapet
+
+#endif
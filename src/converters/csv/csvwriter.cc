@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <stdexcept>
+
+#include "consts.h"
+#include "csvwriter.hh"
+#include "intl.h"
+
+using namespace yapet;
+
+namespace {
+constexpr char NEW_LINE_CHARACTER{'\n'};
+constexpr char DOUBLE_QUOTE{'"'};
+constexpr RecordBuffer::size_type INITIAL_BUFFER_SIZE{64 * 1024};
+
+inline bool contains(const char* data, CSVBuffer::size_type size, char c) {
+    return std::memchr(data, c, size) != nullptr;
+}
+}  // namespace
+
+constexpr char CSVWriter::STANDARD_OUTPUT[];
+
+RecordBuffer::RecordBuffer() : _buffer(INITIAL_BUFFER_SIZE), _size{0} {}
+
+RecordBuffer::~RecordBuffer() { wipe(); }
+
+void RecordBuffer::wipe() { std::memset(_buffer.data(), 0, _size); }
+
+void RecordBuffer::append(const char* data, size_type size) {
+    if (_size + size > _buffer.size()) {
+        // Grow manually, so that no copy of the records is left behind
+        std::vector<char> grown(std::max(2 * _buffer.size(), _size + size));
+        std::memcpy(grown.data(), _buffer.data(), _size);
+        wipe();
+        _buffer.swap(grown);
+    }
+
+    std::memcpy(_buffer.data() + _size, data, size);
+    _size += size;
+}
+
+void RecordBuffer::append(char c) { append(&c, 1); }
+
+void RecordBuffer::clear() {
+    wipe();
+    _size = 0;
+}
+
+CSVBuffer::CSVBuffer(char separator)
+    : RecordBuffer{}, _separator{separator}, _firstField{true} {}
+
+/**
+ * Escape the field like \c CSVStringField::escape(): a field already
+ * enclosed in double quotes is taken as is. Otherwise, a field containing
+ * the separator or a new line is enclosed in double quotes, and the double
+ * quotes it contains are doubled.
+ */
+void CSVBuffer::addField(const char* field, size_type size) {
+    if (!_firstField) {
+        append(_separator);
+    }
+    _firstField = false;
+
+    if (size == 0) return;
+
+    bool escaped{field[0] == DOUBLE_QUOTE && field[size - 1] == DOUBLE_QUOTE};
+    if (escaped || (!contains(field, size, _separator) &&
+                    !contains(field, size, NEW_LINE_CHARACTER))) {
+        append(field, size);
+        return;
+    }
+
+    append(DOUBLE_QUOTE);
+    const char* end{field + size};
+    const char* quote;
+    while ((quote = static_cast<const char*>(
+                std::memchr(field, DOUBLE_QUOTE, end - field))) != nullptr) {
+        // Including the double quote, which is then repeated
+        append(field, quote - field + 1);
+        append(DOUBLE_QUOTE);
+        field = quote + 1;
+    }
+    append(field, end - field);
+    append(DOUBLE_QUOTE);
+}
+
+void CSVBuffer::endRecord() {
+    append(NEW_LINE_CHARACTER);
+    _firstField = true;
+}
+
+void CSVBuffer::clear() {
+    RecordBuffer::clear();
+    _firstField = true;
+}
+
+CSVWriter::CSVWriter(const std::string& fileName)
+    : _fd{-1}, _fileName{fileName} {
+    if (_fileName == STANDARD_OUTPUT) {
+        _fd = STDOUT_FILENO;
+        return;
+    }
+
+    _fd = ::open(_fileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC,
+                 S_IRUSR | S_IWUSR);
+    if (_fd == -1) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Cannot open '%s'"), _fileName.c_str());
+        throw std::runtime_error(msg);
+    }
+}
+
+CSVWriter::~CSVWriter() {
+    if (_fd != -1 && _fd != STDOUT_FILENO) {
+        ::close(_fd);
+    }
+}
+
+void CSVWriter::write(const RecordBuffer& buffer) {
+    const char* data{buffer.data()};
+    RecordBuffer::size_type remaining{buffer.size()};
+
+    while (remaining > 0) {
+        ssize_t n = ::write(_fd, data, remaining);
+        if (n == -1) {
+            if (errno == EINTR) continue;
+
+            char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+            std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                          _("Error writing '%s': %s"), _fileName.c_str(),
+                          std::strerror(errno));
+            throw std::runtime_error(msg);
+        }
+
+        data += n;
+        remaining -= n;
+    }
+}
+
+void CSVWriter::close() {
+    if (_fd == -1 || _fd == STDOUT_FILENO) {
+        _fd = -1;
+        return;
+    }
+
+    int error = ::close(_fd);
+    _fd = -1;
+    if (error) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Error writing '%s': %s"), _fileName.c_str(),
+                      std::strerror(errno));
+        throw std::runtime_error(msg);
+    }
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _CSVWRITER_HH
+#define _CSVWRITER_HH
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace yapet {
+/**
+ * Memory buffer records are formatted into.
+ *
+ * The buffer is reused for subsequent records, and thus only allocates
+ * memory until it has grown to hold the largest block of records written
+ * at once. Since records usually contain passwords, the buffer is wiped
+ * when cleared, grown and destroyed.
+ */
+class RecordBuffer {
+   public:
+    using size_type = std::size_t;
+
+   private:
+    std::vector<char> _buffer;
+    size_type _size;
+
+    void wipe();
+
+   protected:
+    void append(const char* data, size_type size);
+    void append(char c);
+
+   public:
+    RecordBuffer();
+    ~RecordBuffer();
+
+    RecordBuffer(const RecordBuffer&) = delete;
+    RecordBuffer(RecordBuffer&&) = delete;
+    RecordBuffer& operator=(const RecordBuffer&) = delete;
+    RecordBuffer& operator=(RecordBuffer&&) = delete;
+
+    /**
+     * Wipe and empty the buffer.
+     */
+    void clear();
+
+    const char* data() const { return _buffer.data(); }
+    size_type size() const { return _size; }
+    bool empty() const { return _size == 0; }
+};
+
+/**
+ * Memory buffer CSV records are formatted into.
+ *
+ * Fields are escaped the same way as by \c CSVLine.
+ */
+class CSVBuffer : public RecordBuffer {
+   private:
+    char _separator;
+    bool _firstField;
+
+   public:
+    CSVBuffer(char separator = ',');
+
+    /**
+     * Append the unescaped field \c field of \c size bytes to the current
+     * record.
+     */
+    void addField(const char* field, size_type size);
+    void addField(const char* field) { addField(field, std::strlen(field)); }
+
+    /**
+     * Terminate the current record.
+     */
+    void endRecord();
+
+    /**
+     * Wipe and empty the buffer.
+     */
+    void clear();
+};
+
+/**
+ * Unbuffered writer of \c RecordBuffer blocks to a file or the standard output.
+ *
+ * Each block is written using as few \c write calls as possible, so the
+ * number of system calls depends on the block size chosen by the caller,
+ * and not on the number of records.
+ */
+class CSVWriter {
+   private:
+    int _fd;
+    std::string _fileName;
+
+   public:
+    /**
+     * The file name standing for the standard output.
+     */
+    static constexpr char STANDARD_OUTPUT[]{"-"};
+
+    /**
+     * Create or truncate \c fileName for writing. The file is only
+     * accessible by the owner.
+     *
+     * @throw std::runtime_error if the file cannot be opened.
+     */
+    CSVWriter(const std::string& fileName);
+    ~CSVWriter();
+
+    CSVWriter(const CSVWriter&) = delete;
+    CSVWriter(CSVWriter&&) = delete;
+    CSVWriter& operator=(const CSVWriter&) = delete;
+    CSVWriter& operator=(CSVWriter&&) = delete;
+
+    /**
+     * Write the records held by \c buffer.
+     *
+     * @throw std::runtime_error on write errors.
+     */
+    void write(const RecordBuffer& buffer);
+
+    /**
+     * Close the file.
+     *
+     * @throw std::runtime_error if closing fails, i.e. pending data could
+     * not be written.
+     */
+    void close();
+};
+}  // namespace yapet
+
+#endif
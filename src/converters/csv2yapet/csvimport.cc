@@ -35,19 +35,12 @@
 
 #include <cstdio>
 #include <cstring>
-#include <fstream>
-#include <iostream>
 
-#include "aes256factory.hh"
 #include "consts.h"
 #include "csvimport.h"
-#include "csvline.hh"
-#include "file.hh"
+#include "csvreader.hh"
 #include "intl.h"
 
-constexpr char NEW_LINE_CHARACTER{'\n'};
-constexpr char DOUBLE_QUOTE{'"'};
-
 constexpr auto NUMBER_OF_FIELDS{5};
 // the max line length. Computed from the field sizes of a YAPET password
 // record.
@@ -61,36 +54,53 @@ constexpr int MAX_LINE_LENGTH{
     // null terminators, one for each field
     - 5};
 
-void CSVImport::logError(unsigned long lno, const std::string& errmsg) {
-    if (verbose) {
-        std::cout << 'e';
-        std::cout.flush();
-    }
+namespace {
+/**
+ * Feeds the records of a csv file into the import pipeline.
+ */
+class CSVRecordSource : public yapet::RecordSource {
+   private:
+    yapet::CSVReader _csvReader;
 
-    LogEntry tmp;
-    tmp.lineNumber = lno;
-    tmp.message = errmsg;
+   public:
+    CSVRecordSource(const std::string& fileName, char separator)
+        : _csvReader{fileName, separator} {}
 
-    logs.push_back(tmp);
-    had_errors = true;
-    num_errors++;
-}
+    virtual bool next(yapet::ImportRecord& record);
+};
 
-yapet::PasswordListItem CSVImport::csvLineToPasswordRecord(
-    yapet::CSVLine& csvLine, std::unique_ptr<yapet::Crypto>& crypto) {
-    yapet::PasswordRecord passwordRecord;
+bool CSVRecordSource::next(yapet::ImportRecord& record) {
+    if (!_csvReader.next()) return false;
 
-    passwordRecord.name(csvLine[0].c_str());
-    passwordRecord.host(csvLine[1].c_str());
-    passwordRecord.username(csvLine[2].c_str());
-    passwordRecord.password(csvLine[3].c_str());
-    passwordRecord.comment(csvLine[4].c_str());
+    record.lineNumber = _csvReader.lineNumber();
+    if (_csvReader.recordSize() > MAX_LINE_LENGTH) {
+        record.error = _("Line too long");
+        return true;
+    }
 
-    auto serializedRecord{passwordRecord.serialize()};
-    auto encryptedRecord{crypto->encrypt(serializedRecord)};
+    if (!_csvReader.error().empty()) {
+        record.error = _csvReader.error();
+        return true;
+    }
 
-    return yapet::PasswordListItem{csvLine[0].c_str(), encryptedRecord};
+    if (_csvReader.numberOfFields() != NUMBER_OF_FIELDS) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Expected %d fields in line, read %d"),
+                      NUMBER_OF_FIELDS,
+                      static_cast<int>(_csvReader.numberOfFields()));
+        record.error = msg;
+        return true;
+    }
+
+    record.passwordRecord.name(_csvReader.field(0));
+    record.passwordRecord.host(_csvReader.field(1));
+    record.passwordRecord.username(_csvReader.field(2));
+    record.passwordRecord.password(_csvReader.field(3));
+    record.passwordRecord.comment(_csvReader.field(4));
+    return true;
 }
+}  // namespace
 
 /**
  * The constructor tests whether the given source file exists and can be
@@ -106,12 +116,7 @@ yapet::PasswordListItem CSVImport::csvLineToPasswordRecord(
  */
 
 CSVImport::CSVImport(std::string src, std::string dst, char sep, bool verb)
-    : srcfile(src),
-      dstfile(dst),
-      separator(sep),
-      verbose(verb),
-      had_errors(false),
-      num_errors(0) {
+    : RecordImport(dst, verb), srcfile(src), separator(sep) {
     if (access(srcfile.c_str(), R_OK | F_OK) == -1) {
         char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
         std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
@@ -120,159 +125,7 @@ CSVImport::CSVImport(std::string src, std::string dst, char sep, bool verb)
     }
 }
 
-namespace {
-inline std::ifstream openCsvFile(const std::string& fileName) {
-    std::ifstream file{fileName};
-
-    if (!file) {
-        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
-        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
-                      _("Cannot open '%s'"), fileName.c_str());
-        throw std::runtime_error(msg);
-    }
-
-    return file;
-}
-
-inline char read(std::ifstream& csvFile, char& lookAhead) {
-    char tmp = lookAhead;
-    csvFile.get(lookAhead);
-    return tmp;
-}
-
-/**
- * Read a line and honor escaped newline character.
- */
-inline std::string readLine(std::ifstream& csvFile, char separator,
-                            CSVImport::line_number_type& lineNumber) {
-    std::string line;
-
-    bool inEscapedField = false;
-    bool startOfLine = true;
-
-    char currentCharacter;
-    char lookAhead;
-
-    csvFile.get(lookAhead);
-    while (!csvFile.eof()) {
-        currentCharacter = read(csvFile, lookAhead);
-
-        if (currentCharacter == NEW_LINE_CHARACTER) {
-            lineNumber++;
-        }
-
-        if (currentCharacter == NEW_LINE_CHARACTER && !inEscapedField) {
-            csvFile.putback(lookAhead);
-            csvFile.clear();
-            break;
-        }
-
-        if (startOfLine && currentCharacter == DOUBLE_QUOTE) {
-            startOfLine = false;
-            inEscapedField = true;
-            line += DOUBLE_QUOTE;
-            continue;
-        }
-
-        if (currentCharacter == DOUBLE_QUOTE && lookAhead == DOUBLE_QUOTE &&
-            inEscapedField) {
-            line += currentCharacter;
-            line += read(csvFile, lookAhead);
-            continue;
-        }
-
-        if (currentCharacter == DOUBLE_QUOTE &&
-            (lookAhead == separator || lookAhead == NEW_LINE_CHARACTER)) {
-            inEscapedField = false;
-            line += currentCharacter;
-            continue;
-        }
-
-        if (currentCharacter == separator && !inEscapedField) {
-            line += currentCharacter;
-
-            if (lookAhead == DOUBLE_QUOTE) {
-                inEscapedField = true;
-                line += read(csvFile, lookAhead);
-            }
-            continue;
-        }
-
-        line += currentCharacter;
-        startOfLine = false;
-    }
-
-    if (inEscapedField) {
-        throw std::invalid_argument(_("'\"' mismatch"));
-    }
-
-    return line;
-}
-
-}  // namespace
-
-/**
- * Does the import.
- *
- * @param pw the password set on the destination file.
- */
-void CSVImport::import(const char* pw) {
-    auto csvFile{::openCsvFile(srcfile)};
-
-    auto password{yapet::toSecureArray(pw)};
-    auto keyingParameters{yapet::Key256::newDefaultKeyingParameters()};
-    std::shared_ptr<yapet::AbstractCryptoFactory> cryptoFactory{
-        new yapet::Aes256Factory{password, keyingParameters}};
-    auto crypto{cryptoFactory->crypto()};
-    std::unique_ptr<YAPET::File> yapetFile{
-        new YAPET::File{cryptoFactory, dstfile, true}};
-
-    std::list<yapet::PasswordListItem> list;
-
-    line_number_type lineNumber = 0;
-
-    yapet::CSVLine csvLine{NUMBER_OF_FIELDS, separator};
-
-    for (std::string line;
-         line = ::readLine(csvFile, separator, lineNumber), !csvFile.eof();) {
-        if (line.size() > MAX_LINE_LENGTH) {
-            logError(lineNumber, _("Line too long"));
-            continue;
-        }
-
-        try {
-            csvLine.parseLine(line);
-        } catch (std::exception& e) {
-            logError(lineNumber, e.what());
-            continue;
-        }
-
-        auto passwordListItem{csvLineToPasswordRecord(csvLine, crypto)};
-        list.push_back(passwordListItem);
-
-        if (verbose) {
-            std::cout << ".";
-            std::cout.flush();
-        }
-    }
-
-    if (verbose) std::cout << std::endl;
-
-    yapetFile->save(list);
-    csvFile.close();
-}
-
-/**
- * Prints the log entries to stdout.
- */
-void CSVImport::printLog() const {
-    if (logs.size() == 0) return;
-
-    std::list<LogEntry>::const_iterator it = logs.begin();
-
-    while (it != logs.end()) {
-        std::cout << _("Line ") << (*it).lineNumber << ": " << (*it).message
-                  << std::endl;
-        it++;
-    }
+std::unique_ptr<yapet::RecordSource> CSVImport::openSource() {
+    return std::unique_ptr<yapet::RecordSource>{
+        new CSVRecordSource{srcfile, separator}};
 }
@@ -34,71 +34,27 @@
 #include "config.h"
 #endif
 
-#include <list>
 #include <memory>
 #include <string>
 
-#include "crypto.hh"
-#include "csvline.hh"
-#include "passwordlistitem.hh"
+#include "recordimport.h"
 
 /**
  * The class taking care of converting a csv file.
  */
-class CSVImport {
-   public:
-    using line_number_type = unsigned int;
-    /**
-     * Log entry.
-     */
-    struct LogEntry {
-        line_number_type lineNumber;
-        std::string message;
-    };
-
+class CSVImport : public RecordImport {
    private:
     /**
      * The file path of the source (csv) file.
      */
     std::string srcfile;
-    /**
-     * The file path of the destination (pet) file.
-     */
-    std::string dstfile;
     /**
      * The separator character.
      */
     char separator;
 
-    /**
-     * Verbosity enabled/disabled.
-     */
-    bool verbose;
-    /**
-     * Indicates the occurrence of errors.
-     */
-    bool had_errors;
-    /**
-     * The number of errors occurred.
-     */
-    unsigned int num_errors;
-
-    /**
-     * Holds the log entries in case of errors.
-     */
-    std::list<LogEntry> logs;
-
-    /**
-     * Logs the given error.
-     *
-     * @param lno the line number the error occurred.
-     *
-     * @param errmsg the error message.
-     */
-    void logError(unsigned long lno, const std::string& errmsg);
-
-    yapet::PasswordListItem csvLineToPasswordRecord(
-        yapet::CSVLine& csvLine, std::unique_ptr<yapet::Crypto>& crypto);
+   protected:
+    virtual std::unique_ptr<yapet::RecordSource> openSource();
 
    public:
     CSVImport(std::string src, std::string dst, char sep, bool verb = true);
@@ -107,21 +63,6 @@ class CSVImport {
     CSVImport& operator=(const CSVImport&) = delete;
     CSVImport& operator=(CSVImport&&) = delete;
     ~CSVImport(){};
-
-    //! Do the import.
-    void import(const char* pw);
-    //! Set the verbosity.
-    inline void setVerbose(bool v) { verbose = v; }
-    //! Get the verbosity.
-    inline bool getVerbose() const { return verbose; }
-    //! Return whether or not errors occurred.
-    inline bool hadErrors() const { return had_errors; }
-    //! Return the number of errors occurred.
-    inline unsigned int numErrors() const { return num_errors; }
-    //! Return the log entries.
-    inline std::list<LogEntry> getLog() const { return logs; }
-    //! Print the log to stdout
-    void printLog() const;
 };
 
 #endif  // _CSVIMPORT_H
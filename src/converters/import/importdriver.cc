@@ -0,0 +1,350 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef HAVE_GETOPT_H
+#include <getopt.h>
+#endif
+
+#include <libgen.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+#include "agentclient.hh"
+#include "consts.h"
+#include "importdriver.h"
+#include "intl.h"
+#include "openssl.hh"
+#include "readpassword.hh"
+
+namespace {
+enum {
+    /**
+     * Error on command line, i.e. missing parameter.
+     */
+    ERR_CMDLINE = 1,
+    /**
+     * The passwords supplied by the user do not match.
+     */
+    ERR_PASSWDMISMATCH = 2,
+    /**
+     * The destination file already exists.
+     */
+    ERR_FILEEXISTS = 3,
+    /**
+     * A fatal error. Does not indicate convert errors which are handled/logged
+     * by \c RecordImport.
+     */
+    ERR_FATAL = 4,
+    /**
+     * The destination file to append to does not exist.
+     */
+    ERR_FILEMISSING = 5
+};
+
+const char COPYRIGHT[] =
+    "\nCopyright (C) 2009-2011, 2013, 2014  Rafael Ostertag\n"
+    "\n"
+    "%s is part of YAPET.\n"
+    "\n"
+    "This program is free software: you can redistribute it and/or modify\n"
+    "it under the terms of the GNU General Public License as published by\n"
+    "the Free Software Foundation, either version 3 of the License, or\n"
+    "(at your option) any later version.\n"
+    "\n"
+    "This program is distributed in the hope that it will be useful,\n"
+    "but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+    "MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+    "GNU General Public License for more details.\n"
+    "\n"
+    "You should have received a copy of the GNU General Public License\n"
+    "along with this program.  If not, see <http://www.gnu.org/licenses/>.\n";
+
+/**
+ * Reads the password for \c dstfile. The password of a new file is asked
+ * twice.
+ *
+ * @return an empty \c SecureArray if the passwords do not match.
+ */
+yapet::SecureArray readPassword(const std::string& dstfile, bool confirm) {
+    auto password{yapet::readPassword(_("Please enter the password for ") +
+                                      dstfile + ": ")};
+    if (!confirm) return password;
+
+    auto retyped{yapet::readPassword(_("Please re-type the password: "))};
+    std::cout << std::endl;
+
+    if (password != retyped) return yapet::SecureArray{};
+    return password;
+}
+}  // namespace
+
+ImportDriver::ImportDriver(std::string name, std::string source,
+                           std::string description)
+    : _name{std::move(name)},
+      _source{std::move(source)},
+      _description{std::move(description)},
+      _options{} {}
+
+void ImportDriver::addOption(char name, const std::string& argument,
+                             const std::string& help, OptionHandler handler) {
+    _options.push_back(Option{name, argument, help, std::move(handler)});
+}
+
+void ImportDriver::showVersion() const {
+    std::cout << _name << _(" is part of ");
+    std::cout << PACKAGE_STRING << std::endl;
+}
+
+void ImportDriver::showCopyright() const {
+    char copyright[sizeof(COPYRIGHT) + 64];
+    std::snprintf(copyright, sizeof(copyright), COPYRIGHT, _name.c_str());
+    std::cout << copyright << std::endl;
+}
+
+void ImportDriver::showHelp(char* prgname) const {
+    std::cout << std::endl;
+    std::cout << basename(prgname)
+              << " [-h] [-a [-d <policy>] [-k <key>]] [-p <password>] [-q]";
+    for (const auto& option : _options) {
+        std::cout << " [-" << option.name << " " << option.argument << "]";
+    }
+    std::cout << " [-V] <src> <dst>" << std::endl << std::endl;
+    std::cout << "-a\t" << _("append to the existing file <dst>") << std::endl
+              << std::endl;
+    std::cout << "-c\t" << _("show copyright information") << std::endl
+              << std::endl;
+    std::cout << "-d\t"
+              << _("what to do with records already in <dst>, one of")
+              << std::endl
+              << "\t" << _("insert, replace, or skip. Default: insert")
+              << std::endl
+              << std::endl;
+    std::cout << "-h\t" << _("show this help text") << std::endl << std::endl;
+    std::cout << "-k\t" << _("how to find records already in <dst>, either by")
+              << std::endl
+              << "\t" << _("name, or by host and username (login).")
+              << std::endl
+              << "\t" << _("Default: name") << std::endl
+              << std::endl;
+    std::cout << "-p\t"
+              << _("use <password> as the master password for the YAPET file.")
+              << std::endl
+              << "\t" << _("The use of this option is discouraged.")
+              << std::endl
+              << std::endl;
+    std::cout << "-q\t" << _("operate quietly") << std::endl << std::endl;
+    for (const auto& option : _options) {
+        std::cout << "-" << option.name << "\t" << option.help << std::endl
+                  << std::endl;
+    }
+    std::cout << "-V\t" << _("show the version of ") << _name << std::endl
+              << std::endl;
+    std::cout << "<src>\t" << _source << std::endl << std::endl;
+    std::cout << "<dst>\t" << _("the output file") << std::endl << std::endl;
+    std::cout << _name << " " << _description << std::endl << std::endl;
+}
+
+int ImportDriver::run(int argc, char** argv,
+                      const ImportFactory& importFactory) const {
+    bool quiet = false;
+    bool append = false;
+    RecordImport::DuplicatePolicy policy =
+        RecordImport::DuplicatePolicy::INSERT;
+    RecordImport::MatchKey matchKey = RecordImport::MatchKey::NAME;
+    yapet::SecureArray password;
+    bool cmdline_pw = false;
+    std::string srcfile;
+    std::string dstfile;
+
+    std::string optstring{":acd:hk:p:qV"};
+    for (const auto& option : _options) {
+        optstring += option.name;
+        optstring += ':';
+    }
+
+    int c;
+    extern char* optarg;
+    extern int optopt, optind;
+
+    while ((c = getopt(argc, argv, optstring.c_str())) != -1) {
+        switch (c) {
+            case 'a':
+                append = true;
+                break;
+            case 'd':
+                if (std::strcmp(optarg, "insert") == 0) {
+                    policy = RecordImport::DuplicatePolicy::INSERT;
+                } else if (std::strcmp(optarg, "replace") == 0) {
+                    policy = RecordImport::DuplicatePolicy::REPLACE;
+                } else if (std::strcmp(optarg, "skip") == 0) {
+                    policy = RecordImport::DuplicatePolicy::SKIP;
+                } else {
+                    std::cerr << _("invalid policy") << " '" << optarg << "'"
+                              << std::endl;
+                    return ERR_CMDLINE;
+                }
+                break;
+            case 'k':
+                if (std::strcmp(optarg, "name") == 0) {
+                    matchKey = RecordImport::MatchKey::NAME;
+                } else if (std::strcmp(optarg, "login") == 0) {
+                    matchKey = RecordImport::MatchKey::HOST_USERNAME;
+                } else {
+                    std::cerr << _("invalid key") << " '" << optarg << "'"
+                              << std::endl;
+                    return ERR_CMDLINE;
+                }
+                break;
+            case 'c':
+                showCopyright();
+                return 0;
+            case 'h':
+                showHelp(argv[0]);
+                return 0;
+            case 'p':
+                password = yapet::toSecureArray(optarg);
+                cmdline_pw = true;
+                break;
+            case 'q':
+                quiet = true;
+                break;
+            case 'V':
+                showVersion();
+                return 0;
+            case ':':
+                std::cerr << "-" << (char)optopt << _(" without argument")
+                          << std::endl;
+                return ERR_CMDLINE;
+            case '?':
+                std::cerr << _("unknown argument") << " '" << (char)optopt
+                          << "'" << std::endl;
+                return ERR_CMDLINE;
+            default:
+                for (const auto& option : _options) {
+                    if (option.name == c) option.handler(optarg);
+                }
+                break;
+        }
+    }
+
+    if (optind < argc && (argc - optind) == 2) {
+        srcfile = argv[optind];
+        dstfile = argv[++optind];
+    } else {
+        std::cerr << _("Missing argument.") << std::endl;
+
+        if (!quiet) showHelp(argv[0]);
+
+        return ERR_CMDLINE;
+    }
+
+    if (dstfile.find(
+            YAPET::Consts::DEFAULT_FILE_SUFFIX,
+            dstfile.length() - YAPET::Consts::DEFAULT_FILE_SUFFIX.length()) ==
+        std::string::npos)
+        dstfile += YAPET::Consts::DEFAULT_FILE_SUFFIX;
+
+    if (append) {
+        if (access(dstfile.c_str(), F_OK) != 0) {
+            std::cerr << dstfile << _(" does not exist. Aborting.")
+                      << std::endl;
+            return ERR_FILEMISSING;
+        }
+    } else if (access(dstfile.c_str(), F_OK) == 0) {
+        std::cerr << dstfile << _(" already exists. Aborting.") << std::endl;
+        return ERR_FILEEXISTS;
+    }
+
+    yapet::OpenSSL::init();
+
+    try {
+        // The agent, if it holds the key of the file appended to, saves
+        // asking for the password.
+        std::shared_ptr<yapet::AbstractCryptoFactory> cryptoFactory;
+        if (append && !cmdline_pw) {
+            cryptoFactory = yapet::agent::agentCryptoFactoryForFile(dstfile);
+        }
+
+        // We read the password from stdin only if the user did not provide the
+        // -p switch. The password of an existing file is not confirmed.
+        if (!cmdline_pw && !cryptoFactory) {
+            password = readPassword(dstfile, !append);
+            if (password.size() == 0) {
+                std::cerr << _("Passwords do not match.") << std::endl;
+                return ERR_PASSWDMISMATCH;
+            }
+        }
+
+        auto imp{importFactory(srcfile, dstfile, !quiet)};
+        auto pw{reinterpret_cast<const char*>(*password)};
+        if (cryptoFactory) {
+            imp->append(cryptoFactory, policy, matchKey);
+        } else if (append) {
+            imp->append(pw, policy, matchKey);
+        } else {
+            imp->import(pw);
+        }
+
+        if (append && !quiet) {
+            std::cout << imp->numInserted() << _(" records added, ")
+                      << imp->numReplaced() << _(" replaced, ")
+                      << imp->numSkipped() << _(" skipped.") << std::endl;
+        }
+
+        if (imp->hadErrors() && !quiet) {
+            std::cout << _("Had ") << imp->numErrors() << _(" errors:")
+                      << std::endl;
+            imp->printLog();
+            std::cout << std::endl;
+            std::cout << dstfile
+                      << (append ? _(" updated with errors.")
+                                 : _(" created with errors."))
+                      << std::endl;
+        } else {
+            if (!quiet) {
+                std::cout << dstfile
+                          << (append ? _(" successfully updated.")
+                                     : _(" successfully created."))
+                          << std::endl;
+            }
+        }
+    } catch (std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        return ERR_FATAL;
+    }
+
+    return 0;
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _IMPORTDRIVER_H
+#define _IMPORTDRIVER_H 1
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "recordimport.h"
+
+/**
+ * The command line driver of the converters importing records into YAPET
+ * files.
+ *
+ * Handles the options common to all converters, checks the destination
+ * file, and reads the password. Converters add the options of their source
+ * format, and create the \c RecordImport reading it.
+ */
+class ImportDriver {
+   public:
+    /**
+     * Creates the import of \c src into \c dst.
+     */
+    using ImportFactory = std::function<std::unique_ptr<RecordImport>(
+        const std::string& src, const std::string& dst, bool verbose)>;
+    /**
+     * Handles the argument of an option added by the converter.
+     */
+    using OptionHandler = std::function<void(const char* argument)>;
+
+   private:
+    struct Option {
+        char name;
+        std::string argument;
+        std::string help;
+        OptionHandler handler;
+    };
+
+    /**
+     * The name of the converter.
+     */
+    std::string _name;
+    /**
+     * Describes the source file in the help text.
+     */
+    std::string _source;
+    /**
+     * Describes the converter in the help text.
+     */
+    std::string _description;
+    std::vector<Option> _options;
+
+    void showVersion() const;
+    void showCopyright() const;
+    void showHelp(char* prgname) const;
+
+   public:
+    ImportDriver(std::string name, std::string source,
+                 std::string description);
+    ImportDriver(const ImportDriver&) = delete;
+    ImportDriver(ImportDriver&&) = delete;
+    ImportDriver& operator=(const ImportDriver&) = delete;
+    ImportDriver& operator=(ImportDriver&&) = delete;
+    ~ImportDriver(){};
+
+    /**
+     * Add the option \c -name taking an argument.
+     *
+     * @param argument the name of the argument in the help text.
+     *
+     * @param help the help text, which may span several lines.
+     */
+    void addOption(char name, const std::string& argument,
+                   const std::string& help, OptionHandler handler);
+
+    /**
+     * Parse the command line, and import the source file.
+     *
+     * @return the exit status of the converter.
+     */
+    int run(int argc, char** argv, const ImportFactory& importFactory) const;
+};
+
+#endif  // _IMPORTDRIVER_H
@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <exception>
+#include <future>
+#include <thread>
+
+#include "boundedqueue.hh"
+#include "consts.h"
+#include "importpipeline.hh"
+#include "intl.h"
+
+using namespace yapet;
+
+namespace {
+void wipe(std::string& str) {
+    std::fill(str.begin(), str.end(), '\0');
+    str.clear();
+}
+
+/**
+ * Whether \c field fits into a field of \c size bytes, including the
+ * terminating zero. Otherwise, \c error is set.
+ */
+bool fits(const std::string& field, std::size_t size, const char* fieldName,
+          std::string& error) {
+    if (field.size() < size) return true;
+
+    char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+    std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                  _("%s too long, at most %d characters allowed"), fieldName,
+                  static_cast<int>(size) - 1);
+    error = msg;
+    return false;
+}
+
+/**
+ * Consecutive records. \c encrypted becomes ready once all records of the
+ * batch have been encrypted, or holds the exception that prevented it.
+ */
+struct ImportBatch {
+    std::vector<ImportRecord> records;
+    std::promise<void> encryptedPromise;
+    std::future<void> encrypted;
+
+    ImportBatch()
+        : records{},
+          encryptedPromise{},
+          encrypted{encryptedPromise.get_future()} {
+        records.reserve(ImportPipeline::BATCH_SIZE);
+    }
+};
+
+using BatchPointer = std::shared_ptr<ImportBatch>;
+using BatchQueue = BoundedQueue<BatchPointer>;
+
+/**
+ * First stage: split the source file into batches.
+ *
+ * Each batch is queued on \c pending, which preserves the order of the
+ * source file for the consumer, and on \c work for the encryption workers.
+ */
+void readBatches(RecordSource& source, BatchQueue& pending, BatchQueue& work) {
+    bool more{true};
+    while (more) {
+        BatchPointer batch{new ImportBatch{}};
+        try {
+            while (batch->records.size() < ImportPipeline::BATCH_SIZE) {
+                batch->records.emplace_back();
+                if (!source.next(batch->records.back())) {
+                    batch->records.pop_back();
+                    more = false;
+                    break;
+                }
+            }
+        } catch (...) {
+            // Hand the error to the consumer, which will rethrow it
+            batch->encryptedPromise.set_exception(std::current_exception());
+            pending.push(batch);
+            break;
+        }
+
+        if (batch->records.empty()) break;
+        if (!pending.push(batch) || !work.push(batch)) break;
+    }
+
+    pending.close();
+    work.close();
+}
+
+/**
+ * Second stage: encrypt batches using the worker's own \c Crypto instance.
+ */
+void encryptBatches(BatchQueue& work, Crypto& crypto) {
+    BatchPointer batch;
+    while (work.pop(batch)) {
+        try {
+            for (auto& record : batch->records) {
+                if (!record.error.empty()) continue;
+
+                record.encryptedRecord =
+                    crypto.encrypt(record.passwordRecord.serialize());
+            }
+            batch->encryptedPromise.set_value();
+        } catch (...) {
+            batch->encryptedPromise.set_exception(std::current_exception());
+        }
+        batch.reset();
+    }
+}
+}  // namespace
+
+void RecordFields::clear() {
+    wipe(name);
+    wipe(host);
+    wipe(username);
+    wipe(password);
+    wipe(comment);
+    wipe(tags);
+}
+
+void ImportRecord::assign(const RecordFields& fields) {
+    if (!fits(fields.name, PasswordRecord::NAME_SIZE, _("Name"), error) ||
+        !fits(fields.host, PasswordRecord::HOST_SIZE, _("Host"), error) ||
+        !fits(fields.username, PasswordRecord::USERNAME_SIZE, _("Username"),
+              error) ||
+        !fits(fields.password, PasswordRecord::PASSWORD_SIZE, _("Password"),
+              error) ||
+        !fits(fields.comment, PasswordRecord::COMMENT_SIZE, _("Comment"),
+              error) ||
+        !fits(fields.tags, PasswordRecord::TAGS_SIZE, _("Tags"), error)) {
+        return;
+    }
+
+    passwordRecord.name(fields.name.c_str());
+    passwordRecord.host(fields.host.c_str());
+    passwordRecord.username(fields.username.c_str());
+    passwordRecord.password(fields.password.c_str());
+    passwordRecord.comment(fields.comment.c_str());
+    passwordRecord.tags(fields.tags.c_str());
+}
+
+constexpr std::size_t ImportPipeline::BATCH_SIZE;
+constexpr std::size_t ImportPipeline::BATCHES_PER_WORKER;
+
+ImportPipeline::ImportPipeline(AbstractCryptoFactory& cryptoFactory)
+    : _cryptos{} {
+    unsigned int workers{std::thread::hardware_concurrency()};
+    if (workers == 0) workers = 1;
+
+    for (unsigned int i = 0; i < workers; i++) {
+        _cryptos.push_back(cryptoFactory.crypto());
+    }
+}
+
+void ImportPipeline::run(RecordSource& source, const Consumer& consume,
+                         const BatchDone& batchDone) {
+    auto workers{_cryptos.size()};
+    BatchQueue pending{workers * BATCHES_PER_WORKER};
+    BatchQueue work{workers * BATCHES_PER_WORKER};
+
+    std::thread reader{readBatches, std::ref(source), std::ref(pending),
+                       std::ref(work)};
+    std::vector<std::thread> encrypters;
+    for (auto& crypto : _cryptos) {
+        encrypters.emplace_back(encryptBatches, std::ref(work),
+                                std::ref(*crypto));
+    }
+
+    std::exception_ptr error{};
+    try {
+        BatchPointer batch;
+        while (pending.pop(batch)) {
+            batch->encrypted.get();
+
+            for (auto& record : batch->records) {
+                consume(record);
+            }
+
+            if (batchDone) batchDone();
+        }
+    } catch (...) {
+        error = std::current_exception();
+        // Unblock the reader and the workers
+        pending.close();
+        work.close();
+    }
+
+    reader.join();
+    for (auto& encrypter : encrypters) {
+        encrypter.join();
+    }
+
+    if (error) std::rethrow_exception(error);
+}
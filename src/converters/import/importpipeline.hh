@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _IMPORTPIPELINE_HH
+#define _IMPORTPIPELINE_HH
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstractcryptofactory.hh"
+#include "crypto.hh"
+#include "passwordrecord.hh"
+#include "securearray.hh"
+
+namespace yapet {
+/**
+ * The fields of a password record as read by a \c RecordSource, before
+ * their sizes have been checked.
+ */
+struct RecordFields {
+    std::string name;
+    std::string host;
+    std::string username;
+    std::string password;
+    std::string comment;
+    std::string tags;
+
+    //! Wipe and empty all fields.
+    void clear();
+};
+
+/**
+ * A record on its way through the import pipeline.
+ *
+ * Either \c error is set by the \c RecordSource, or \c encryptedRecord is
+ * set by the encryption worker.
+ */
+struct ImportRecord {
+    using line_number_type = unsigned int;
+
+    //! The line of the source file the record is found on.
+    line_number_type lineNumber;
+    std::string error;
+    PasswordRecord passwordRecord;
+    SecureArray encryptedRecord;
+
+    /**
+     * Copy \c fields into \c passwordRecord, or set \c error if one of
+     * them does not fit.
+     */
+    void assign(const RecordFields& fields);
+};
+
+/**
+ * Parser of a source file, providing the records to import.
+ */
+class RecordSource {
+   public:
+    virtual ~RecordSource() {}
+
+    /**
+     * Read the next record of the source file into \c record, which is
+     * default constructed. All fields of the password record have to be
+     * set. If the record cannot be imported, \c record.error is set
+     * instead.
+     *
+     * Called on the parser thread of the pipeline.
+     *
+     * @return \c false if there are no more records.
+     *
+     * @throw std::runtime_error if the source file cannot be read any
+     * further.
+     */
+    virtual bool next(ImportRecord& record) = 0;
+};
+
+/**
+ * Parallel encryption of imported records.
+ *
+ * The pipeline consists of three stages connected by bounded queues: a
+ * thread reading records from a \c RecordSource in batches, one encryption
+ * worker per hardware thread, each using its own \c Crypto instance, and
+ * the calling thread handing the encrypted records to a consumer in the
+ * order of the source file. Memory usage thus does not depend on the size
+ * of the source file.
+ */
+class ImportPipeline {
+   public:
+    using Consumer = std::function<void(ImportRecord&)>;
+    using BatchDone = std::function<void()>;
+
+    //! Number of records handed to an encryption worker at once.
+    static constexpr std::size_t BATCH_SIZE{256};
+    //! Number of batches per worker in flight between parser and consumer.
+    static constexpr std::size_t BATCHES_PER_WORKER{4};
+
+   private:
+    std::vector<std::unique_ptr<Crypto>> _cryptos;
+
+   public:
+    ImportPipeline(AbstractCryptoFactory& cryptoFactory);
+
+    ImportPipeline(const ImportPipeline&) = delete;
+    ImportPipeline(ImportPipeline&&) = delete;
+    ImportPipeline& operator=(const ImportPipeline&) = delete;
+    ImportPipeline& operator=(ImportPipeline&&) = delete;
+
+    /**
+     * Import all records of \c source.
+     *
+     * \c consume is called for each record, including the ones having an
+     * error, and \c batchDone, if set, after each batch. Both are called on
+     * the calling thread. Exceptions thrown by any stage are rethrown after
+     * all threads have been stopped.
+     */
+    void run(RecordSource& source, const Consumer& consume,
+             const BatchDone& batchDone = BatchDone{});
+
+    /**
+     * The \c Crypto instances of the workers. May be used by the caller
+     * while the pipeline is not running.
+     */
+    std::vector<std::unique_ptr<Crypto>>& cryptos() { return _cryptos; }
+};
+}  // namespace yapet
+
+#endif
@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include "consts.h"
+#include "inputfile.hh"
+#include "intl.h"
+
+using namespace yapet;
+
+constexpr int InputFile::END_OF_FILE;
+constexpr InputFile::size_type InputFile::DEFAULT_BUFFER_SIZE;
+
+namespace {
+// Largest prefix startsWith() and skipPast() have to look ahead
+constexpr InputFile::size_type MAX_LOOKAHEAD{16};
+}  // namespace
+
+InputFile::InputFile(const std::string& fileName, size_type bufferSize)
+    : _fd{-1},
+      _fileName{fileName},
+      _buffer(bufferSize < 2 * MAX_LOOKAHEAD ? 2 * MAX_LOOKAHEAD : bufferSize),
+      _begin{0},
+      _end{0},
+      _eof{false},
+      _line{1} {
+    _fd = ::open(fileName.c_str(), O_RDONLY);
+    if (_fd == -1) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Cannot open '%s'"), fileName.c_str());
+        throw std::runtime_error(msg);
+    }
+}
+
+InputFile::~InputFile() {
+    if (_fd != -1) ::close(_fd);
+}
+
+/**
+ * Move the unconsumed data to the front of the buffer and read the next
+ * block of the file behind it.
+ *
+ * @return \c false if no data has been added.
+ */
+bool InputFile::fill() {
+    if (_eof) return false;
+
+    if (_begin > 0) {
+        std::memmove(_buffer.data(), _buffer.data() + _begin, _end - _begin);
+        _end -= _begin;
+        _begin = 0;
+    }
+
+    ssize_t n;
+    do {
+        n = ::read(_fd, _buffer.data() + _end, _buffer.size() - _end);
+    } while (n == -1 && errno == EINTR);
+
+    if (n == -1) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Error reading '%s': %s"), _fileName.c_str(),
+                      std::strerror(errno));
+        throw std::runtime_error(msg);
+    }
+
+    if (n == 0) {
+        _eof = true;
+        return false;
+    }
+
+    _end += n;
+    return true;
+}
+
+bool InputFile::startsWith(const char* prefix) {
+    size_type length{std::strlen(prefix)};
+    while (_end - _begin < length) {
+        if (!fill()) return false;
+    }
+
+    return std::memcmp(_buffer.data() + _begin, prefix, length) == 0;
+}
+
+bool InputFile::appendUntil(std::string& str, const char* stopCharacters,
+                            size_type maxSize) {
+    bool stop[256] = {false};
+    for (const char* c = stopCharacters; *c != '\0'; c++) {
+        stop[static_cast<unsigned char>(*c)] = true;
+    }
+
+    bool complete{true};
+    for (;;) {
+        if (_begin == _end && !fill()) return complete;
+
+        const char* begin{_buffer.data() + _begin};
+        const char* end{_buffer.data() + _end};
+        const char* p{begin};
+        while (p < end && !stop[static_cast<unsigned char>(*p)]) {
+            if (*p == '\n') _line++;
+            p++;
+        }
+
+        size_type length = p - begin;
+        if (str.size() + length > maxSize) {
+            complete = false;
+            str.append(begin, maxSize - std::min(maxSize, str.size()));
+        } else {
+            str.append(begin, length);
+        }
+        _begin += length;
+
+        if (p < end) return complete;
+    }
+}
+
+bool InputFile::skipPast(const char* terminator) {
+    size_type length{std::strlen(terminator)};
+    for (;;) {
+        if (startsWith(terminator)) {
+            _begin += length;
+            return true;
+        }
+
+        if (get() == END_OF_FILE) return false;
+    }
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _INPUTFILE_HH
+#define _INPUTFILE_HH
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace yapet {
+/**
+ * Buffered, character oriented reading of a file for the streaming parsers.
+ *
+ * The file is read in large blocks, so memory usage does not depend on the
+ * size of the file. Lines are counted while reading.
+ */
+class InputFile {
+   public:
+    using line_number_type = unsigned int;
+    using size_type = std::size_t;
+
+    static constexpr int END_OF_FILE{-1};
+    static constexpr size_type DEFAULT_BUFFER_SIZE{1024 * 1024};
+
+   private:
+    int _fd;
+    std::string _fileName;
+    std::vector<char> _buffer;
+    size_type _begin;
+    size_type _end;
+    bool _eof;
+    line_number_type _line;
+
+    bool fill();
+
+   public:
+    /**
+     * Open \c fileName for reading.
+     *
+     * @throw std::runtime_error if the file cannot be opened.
+     */
+    InputFile(const std::string& fileName,
+              size_type bufferSize = DEFAULT_BUFFER_SIZE);
+    ~InputFile();
+
+    InputFile(const InputFile&) = delete;
+    InputFile(InputFile&&) = delete;
+    InputFile& operator=(const InputFile&) = delete;
+    InputFile& operator=(InputFile&&) = delete;
+
+    /**
+     * The next character, without consuming it, or \c END_OF_FILE.
+     *
+     * @throw std::runtime_error on read errors.
+     */
+    int peek() {
+        if (_begin == _end && !fill()) return END_OF_FILE;
+        return static_cast<unsigned char>(_buffer[_begin]);
+    }
+
+    /**
+     * Consume the next character.
+     *
+     * @return the character, or \c END_OF_FILE.
+     */
+    int get() {
+        int c = peek();
+        if (c == END_OF_FILE) return c;
+
+        _begin++;
+        if (c == '\n') _line++;
+        return c;
+    }
+
+    /**
+     * Whether the input continues with \c prefix. Nothing is consumed.
+     */
+    bool startsWith(const char* prefix);
+
+    /**
+     * Consume characters up to, but excluding, the first character contained
+     * in \c stopCharacters, or up to the end of the file.
+     *
+     * The characters consumed are appended to \c str, as long as \c str does
+     * not exceed \c maxSize. Excess characters are dropped.
+     *
+     * @return \c false if characters have been dropped.
+     */
+    bool appendUntil(std::string& str, const char* stopCharacters,
+                     size_type maxSize);
+
+    /**
+     * Consume characters up to and including \c terminator.
+     *
+     * @return \c false if the end of the file has been reached before.
+     */
+    bool skipPast(const char* terminator);
+
+    /**
+     * The line of the next character, starting at 1.
+     */
+    line_number_type line() const { return _line; }
+
+    const std::string& fileName() const { return _fileName; }
+};
+}  // namespace yapet
+
+#endif
@@ -0,0 +1,346 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cstdio>
+#include <stdexcept>
+
+#include "consts.h"
+#include "intl.h"
+#include "jsonreader.hh"
+
+using namespace yapet;
+
+constexpr JSONReader::size_type JSONReader::DEFAULT_MAX_STRING_SIZE;
+
+namespace {
+// Numbers are short, anything longer is rejected
+constexpr JSONReader::size_type MAX_NUMBER_SIZE{256};
+
+inline bool isWhitespace(int c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+inline bool isNumberCharacter(int c) {
+    return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' ||
+           c == 'e' || c == 'E';
+}
+
+void appendUtf8(std::string& str, unsigned long codePoint) {
+    if (codePoint < 0x80) {
+        str += static_cast<char>(codePoint);
+    } else if (codePoint < 0x800) {
+        str += static_cast<char>(0xC0 | (codePoint >> 6));
+        str += static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else if (codePoint < 0x10000) {
+        str += static_cast<char>(0xE0 | (codePoint >> 12));
+        str += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        str += static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else {
+        str += static_cast<char>(0xF0 | (codePoint >> 18));
+        str += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        str += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        str += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+}
+}  // namespace
+
+JSONReader::JSONReader(const std::string& fileName, size_type maxStringSize)
+    : _input{fileName},
+      _maxStringSize{maxStringSize},
+      _lineNumber{1},
+      _string{},
+      _truncated{false},
+      _containers{},
+      _state{State::VALUE} {}
+
+void JSONReader::error(const char* message) const {
+    char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+    std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                  _("JSON error in '%s', line %u: %s"),
+                  _input.fileName().c_str(), _input.line(), message);
+    throw std::runtime_error(msg);
+}
+
+void JSONReader::skipWhitespace() {
+    while (isWhitespace(_input.peek())) _input.get();
+}
+
+void JSONReader::expect(const char* literal) {
+    for (const char* c = literal; *c != '\0'; c++) {
+        if (_input.get() != static_cast<unsigned char>(*c)) {
+            error(_("invalid literal"));
+        }
+    }
+}
+
+unsigned long JSONReader::readHex4() {
+    unsigned long value{0};
+    for (int i = 0; i < 4; i++) {
+        int c = _input.get();
+        value <<= 4;
+        if (c >= '0' && c <= '9') {
+            value |= c - '0';
+        } else if (c >= 'a' && c <= 'f') {
+            value |= c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            value |= c - 'A' + 10;
+        } else {
+            error(_("invalid unicode escape"));
+        }
+    }
+    return value;
+}
+
+/**
+ * Read a string following the opening quote into \c _string.
+ */
+void JSONReader::readString() {
+    for (;;) {
+        _truncated |= !_input.appendUntil(_string, "\"\\", _maxStringSize);
+
+        int c = _input.get();
+        if (c == '"') break;
+        if (c == InputFile::END_OF_FILE) error(_("unterminated string"));
+
+        // Escape sequence
+        c = _input.get();
+        switch (c) {
+            case '"':
+            case '\\':
+            case '/':
+                _string += static_cast<char>(c);
+                break;
+            case 'b':
+                _string += '\b';
+                break;
+            case 'f':
+                _string += '\f';
+                break;
+            case 'n':
+                _string += '\n';
+                break;
+            case 'r':
+                _string += '\r';
+                break;
+            case 't':
+                _string += '\t';
+                break;
+            case 'u': {
+                unsigned long codePoint{readHex4()};
+                if (codePoint >= 0xD800 && codePoint < 0xDC00) {
+                    // High surrogate, has to be followed by a low surrogate
+                    expect("\\u");
+                    unsigned long low{readHex4()};
+                    if (low < 0xDC00 || low >= 0xE000) {
+                        error(_("invalid surrogate pair"));
+                    }
+                    codePoint =
+                        0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                } else if (codePoint >= 0xDC00 && codePoint < 0xE000) {
+                    error(_("invalid surrogate pair"));
+                }
+                appendUtf8(_string, codePoint);
+                break;
+            }
+            default:
+                error(_("invalid escape sequence"));
+        }
+
+        if (_string.size() > _maxStringSize) {
+            _string.resize(_maxStringSize);
+            _truncated = true;
+        }
+    }
+}
+
+void JSONReader::readNumber() {
+    while (isNumberCharacter(_input.peek())) {
+        if (_string.size() == MAX_NUMBER_SIZE) error(_("number too long"));
+        _string += static_cast<char>(_input.get());
+    }
+}
+
+/**
+ * Advance the state after a complete value.
+ */
+void JSONReader::valueDone() {
+    if (_containers.empty()) {
+        _state = State::DONE;
+    } else if (_containers.back() == '{') {
+        _state = State::OBJECT_KEY;
+    } else {
+        _state = State::ARRAY_VALUE;
+    }
+}
+
+JSONReader::Token JSONReader::endContainer(char c) {
+    if (_containers.empty() || _containers.back() != c) {
+        error(_("unexpected end of object or array"));
+    }
+    _containers.pop_back();
+    valueDone();
+    return c == '{' ? Token::END_OBJECT : Token::END_ARRAY;
+}
+
+JSONReader::Token JSONReader::readValue() {
+    int c = _input.get();
+    switch (c) {
+        case '{':
+            _containers.push_back('{');
+            _state = State::OBJECT_FIRST_KEY;
+            return Token::START_OBJECT;
+        case '[':
+            _containers.push_back('[');
+            _state = State::ARRAY_FIRST_VALUE;
+            return Token::START_ARRAY;
+        case '"':
+            readString();
+            valueDone();
+            return Token::STRING;
+        case 't':
+            expect("rue");
+            _string = "true";
+            valueDone();
+            return Token::BOOLEAN;
+        case 'f':
+            expect("alse");
+            _string = "false";
+            valueDone();
+            return Token::BOOLEAN;
+        case 'n':
+            expect("ull");
+            valueDone();
+            return Token::NULL_VALUE;
+        case InputFile::END_OF_FILE:
+            error(_("unexpected end of file"));
+        default:
+            if (c != '-' && (c < '0' || c > '9')) error(_("value expected"));
+            _string += static_cast<char>(c);
+            readNumber();
+            valueDone();
+            return Token::NUMBER;
+    }
+}
+
+JSONReader::Token JSONReader::next() {
+    _string.clear();
+    _truncated = false;
+
+    skipWhitespace();
+    _lineNumber = _input.line();
+    int c = _input.peek();
+
+    switch (_state) {
+        case State::VALUE:
+            return readValue();
+        case State::OBJECT_KEY:
+            if (c == '}') {
+                _input.get();
+                return endContainer('{');
+            }
+            if (c != ',') error(_("',' or '}' expected"));
+            _input.get();
+            skipWhitespace();
+            _lineNumber = _input.line();
+            c = _input.peek();
+            // fall through
+        case State::OBJECT_FIRST_KEY:
+            if (c == '}' && _state == State::OBJECT_FIRST_KEY) {
+                _input.get();
+                return endContainer('{');
+            }
+            if (c != '"') error(_("key expected"));
+            _input.get();
+            readString();
+            skipWhitespace();
+            if (_input.get() != ':') error(_("':' expected"));
+            _state = State::VALUE;
+            return Token::KEY;
+        case State::ARRAY_VALUE:
+            if (c == ']') {
+                _input.get();
+                return endContainer('[');
+            }
+            if (c != ',') error(_("',' or ']' expected"));
+            _input.get();
+            skipWhitespace();
+            _lineNumber = _input.line();
+            return readValue();
+        case State::ARRAY_FIRST_VALUE:
+            if (c == ']') {
+                _input.get();
+                return endContainer('[');
+            }
+            return readValue();
+        case State::DONE:
+            if (c != InputFile::END_OF_FILE) {
+                error(_("trailing data after document"));
+            }
+            return Token::END_DOCUMENT;
+    }
+    error(_("invalid state"));
+}
+
+bool JSONReader::nextDocument() {
+    skipWhitespace();
+    _lineNumber = _input.line();
+    if (_state != State::VALUE && _state != State::DONE) {
+        error(_("incomplete document"));
+    }
+    if (_input.peek() == InputFile::END_OF_FILE) {
+        _state = State::DONE;
+        return false;
+    }
+
+    _state = State::VALUE;
+    return true;
+}
+
+void JSONReader::skip() {
+    size_type depth{_containers.size()};
+    if (_state == State::VALUE) {
+        // After a key: skip one value
+        Token token{next()};
+        if (token != Token::START_OBJECT && token != Token::START_ARRAY) {
+            return;
+        }
+    } else if (depth == 0) {
+        return;
+    } else {
+        depth--;
+    }
+
+    while (_containers.size() > depth) {
+        next();
+    }
+}
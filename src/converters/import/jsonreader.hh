@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _JSONREADER_HH
+#define _JSONREADER_HH
+
+#include <string>
+#include <vector>
+
+#include "inputfile.hh"
+
+namespace yapet {
+/**
+ * Streaming JSON parser.
+ *
+ * The document is reported as a sequence of tokens, one per call to
+ * \c next(). Only the current token and the nesting of the open objects and
+ * arrays are held in memory, so documents of any size are parsed in
+ * constant memory.
+ */
+class JSONReader {
+   public:
+    using line_number_type = InputFile::line_number_type;
+    using size_type = InputFile::size_type;
+
+    enum class Token {
+        START_OBJECT,
+        END_OBJECT,
+        START_ARRAY,
+        END_ARRAY,
+        KEY,
+        STRING,
+        NUMBER,
+        BOOLEAN,
+        NULL_VALUE,
+        END_DOCUMENT
+    };
+
+    //! Strings are truncated to this size by default.
+    static constexpr size_type DEFAULT_MAX_STRING_SIZE{64 * 1024};
+
+   private:
+    enum class State {
+        VALUE,
+        OBJECT_FIRST_KEY,
+        OBJECT_KEY,
+        ARRAY_FIRST_VALUE,
+        ARRAY_VALUE,
+        DONE
+    };
+
+    InputFile _input;
+    size_type _maxStringSize;
+    line_number_type _lineNumber;
+    std::string _string;
+    bool _truncated;
+    std::vector<char> _containers;
+    State _state;
+
+    [[noreturn]] void error(const char* message) const;
+    void skipWhitespace();
+    void expect(const char* literal);
+    void readString();
+    unsigned long readHex4();
+    void readNumber();
+    Token readValue();
+    Token endContainer(char c);
+    void valueDone();
+
+   public:
+    /**
+     * Open \c fileName for parsing.
+     *
+     * @throw std::runtime_error if the file cannot be opened.
+     */
+    JSONReader(const std::string& fileName,
+               size_type maxStringSize = DEFAULT_MAX_STRING_SIZE);
+
+    /**
+     * Parse up to the next token.
+     *
+     * @throw std::runtime_error if the document is not valid JSON or cannot
+     * be read.
+     */
+    Token next();
+
+    /**
+     * Start the next document of a sequence of documents, such as JSON
+     * Lines. Has to be called before the first document is read, and after
+     * the last token of each document. \c END_DOCUMENT is never reported
+     * when reading a sequence.
+     *
+     * @return \c false if there are no more documents.
+     *
+     * @throw std::runtime_error if the current document is not complete.
+     */
+    bool nextDocument();
+
+    /**
+     * Skip the value following a \c KEY token, or the rest of the object or
+     * array whose \c START_OBJECT or \c START_ARRAY token has just been
+     * read.
+     */
+    void skip();
+
+    /**
+     * The text of a \c KEY, \c STRING or \c NUMBER token, and "true" or
+     * "false" for a \c BOOLEAN token.
+     */
+    const std::string& string() const { return _string; }
+
+    /**
+     * Whether the text of the current token has been truncated.
+     */
+    bool truncated() const { return _truncated; }
+
+    /**
+     * The number of open objects and arrays.
+     */
+    size_type depth() const { return _containers.size(); }
+
+    /**
+     * The line the current token starts on.
+     */
+    line_number_type lineNumber() const { return _lineNumber; }
+};
+}  // namespace yapet
+
+#endif
@@ -0,0 +1,275 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+#include "aes256factory.hh"
+#include "cryptofactoryhelper.hh"
+#include "file.hh"
+#include "intl.h"
+#include "parallel.hh"
+#include "recordimport.h"
+
+namespace {
+/**
+ * The key identifying a record when looking for duplicates.
+ */
+std::string recordKey(const yapet::PasswordRecord& passwordRecord,
+                      RecordImport::MatchKey matchKey) {
+    auto field = [](const std::uint8_t* value, std::size_t maxSize) {
+        auto str{reinterpret_cast<const char*>(value)};
+        return std::string(str, ::strnlen(str, maxSize));
+    };
+
+    if (matchKey == RecordImport::MatchKey::NAME) {
+        return field(passwordRecord.name(), yapet::PasswordRecord::NAME_SIZE);
+    }
+
+    // Fields cannot contain '\0', so the key is unambiguous
+    return field(passwordRecord.host(), yapet::PasswordRecord::HOST_SIZE) +
+           '\0' +
+           field(passwordRecord.username(),
+                 yapet::PasswordRecord::USERNAME_SIZE);
+}
+
+/**
+ * Map the keys of \c records to their index. If several records have the
+ * same key, the first one is indexed.
+ */
+std::unordered_map<std::string, std::size_t> indexRecords(
+    const std::vector<yapet::SecureArray>& records,
+    std::vector<std::unique_ptr<yapet::Crypto>>& cryptos,
+    RecordImport::MatchKey matchKey) {
+    std::vector<std::string> keys(records.size());
+    auto workers{std::min<unsigned int>(yapet::numberOfWorkers(records.size()),
+                                        cryptos.size())};
+    yapet::parallelFor(
+        records.size(), workers,
+        [&](unsigned int worker, std::size_t begin, std::size_t end) {
+            for (auto i = begin; i < end; i++) {
+                yapet::PasswordRecord passwordRecord{
+                    cryptos[worker]->decrypt(records[i])};
+                keys[i] = recordKey(passwordRecord, matchKey);
+            }
+        });
+
+    std::unordered_map<std::string, std::size_t> index;
+    index.reserve(keys.size());
+    for (std::size_t i = 0; i < keys.size(); i++) {
+        index.emplace(std::move(keys[i]), i);
+    }
+    return index;
+}
+}  // namespace
+
+void RecordImport::logError(unsigned long lno, const std::string& errmsg) {
+    if (verbose) {
+        std::cout << 'e';
+        std::cout.flush();
+    }
+
+    LogEntry tmp;
+    tmp.lineNumber = lno;
+    tmp.message = errmsg;
+
+    logs.push_back(tmp);
+    had_errors = true;
+    num_errors++;
+}
+
+void RecordImport::progress(const yapet::ImportRecord& record) {
+    if (!record.error.empty()) {
+        logError(record.lineNumber, record.error);
+        return;
+    }
+
+    if (verbose) std::cout << '.';
+}
+
+/**
+ * @param dst the file path of the destination file.
+ *
+ * @param verb enable/disable verbosity. Default \c true.
+ */
+RecordImport::RecordImport(std::string dst, bool verb)
+    : dstfile(dst),
+      verbose(verb),
+      had_errors(false),
+      num_errors(0),
+      num_inserted(0),
+      num_replaced(0),
+      num_skipped(0) {}
+
+/**
+ * Does the import.
+ *
+ * Records are written to the destination file as soon as they have been
+ * encrypted, in the order of the source file. Errors are logged in the same
+ * order.
+ *
+ * @param pw the password set on the destination file.
+ */
+void RecordImport::import(const char* pw) {
+    auto source{openSource()};
+
+    auto password{yapet::toSecureArray(pw)};
+    auto keyingParameters{yapet::Key256::newDefaultKeyingParameters()};
+    std::shared_ptr<yapet::AbstractCryptoFactory> cryptoFactory{
+        new yapet::Aes256Factory{password, keyingParameters}};
+    std::unique_ptr<YAPET::File> yapetFile{
+        new YAPET::File{cryptoFactory, dstfile, true}};
+
+    yapet::ImportPipeline pipeline{*cryptoFactory};
+
+    yapetFile->beginSave();
+    pipeline.run(
+        *source,
+        [this, &yapetFile](yapet::ImportRecord& record) {
+            progress(record);
+            if (!record.error.empty()) return;
+
+            yapetFile->saveRecord(record.encryptedRecord);
+            num_inserted++;
+        },
+        [this]() {
+            if (verbose) std::cout.flush();
+        });
+    yapetFile->endSave();
+
+    if (verbose) std::cout << std::endl;
+}
+
+/**
+ * Imports into an existing destination file.
+ *
+ * The records of the destination file are indexed by \c matchKey, unless
+ * \c policy is \c DuplicatePolicy::INSERT. Each source record is then
+ * looked up in the index, so the import takes time proportional to the
+ * number of existing plus imported records. Records imported earlier are in
+ * the index as well.
+ *
+ * The existing records are kept encrypted, and all records are written in
+ * one save once the source file has been processed.
+ *
+ * @param pw the password of the destination file.
+ *
+ * @param policy what to do with source records matching an existing record.
+ *
+ * @param matchKey the fields identifying a record.
+ */
+void RecordImport::append(const char* pw, DuplicatePolicy policy,
+                          MatchKey matchKey) {
+    auto password{yapet::toSecureArray(pw)};
+    append(yapet::getCryptoFactoryForFile(dstfile, password), policy,
+           matchKey);
+}
+
+/**
+ * Import into the existing destination file, like \c append(const char*,
+ * DuplicatePolicy, MatchKey), using \c cryptoFactory to open the file and
+ * encrypt the records, e.g. one using the agent.
+ */
+void RecordImport::append(
+    const std::shared_ptr<yapet::AbstractCryptoFactory>& cryptoFactory,
+    DuplicatePolicy policy, MatchKey matchKey) {
+    auto source{openSource()};
+
+    std::unique_ptr<YAPET::File> yapetFile{
+        new YAPET::File{cryptoFactory, dstfile, false}};
+
+    yapet::ImportPipeline pipeline{*cryptoFactory};
+    auto records{yapetFile->readEncryptedRecords()};
+
+    std::unordered_map<std::string, std::size_t> index;
+    if (policy != DuplicatePolicy::INSERT) {
+        index = indexRecords(records, pipeline.cryptos(), matchKey);
+    }
+
+    pipeline.run(
+        *source,
+        [this, &records, &index, policy,
+         matchKey](yapet::ImportRecord& record) {
+            progress(record);
+            if (!record.error.empty()) return;
+
+            if (policy != DuplicatePolicy::INSERT) {
+                auto result{
+                    index.emplace(recordKey(record.passwordRecord, matchKey),
+                                  records.size())};
+                if (!result.second) {
+                    if (policy == DuplicatePolicy::SKIP) {
+                        num_skipped++;
+                        return;
+                    }
+
+                    records[result.first->second] =
+                        std::move(record.encryptedRecord);
+                    num_replaced++;
+                    return;
+                }
+            }
+
+            records.push_back(std::move(record.encryptedRecord));
+            num_inserted++;
+        },
+        [this]() {
+            if (verbose) std::cout.flush();
+        });
+
+    yapetFile->beginSave();
+    for (const auto& record : records) {
+        yapetFile->saveRecord(record);
+    }
+    yapetFile->endSave();
+
+    if (verbose) std::cout << std::endl;
+}
+
+/**
+ * Prints the log entries to stdout.
+ */
+void RecordImport::printLog() const {
+    if (logs.size() == 0) return;
+
+    std::list<LogEntry>::const_iterator it = logs.begin();
+
+    while (it != logs.end()) {
+        std::cout << _("Line ") << (*it).lineNumber << ": " << (*it).message
+                  << std::endl;
+        it++;
+    }
+}
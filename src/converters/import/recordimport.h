@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _RECORDIMPORT_H
+#define _RECORDIMPORT_H 1
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <list>
+#include <memory>
+#include <string>
+
+#include "importpipeline.hh"
+
+/**
+ * Base class of the converters importing records into YAPET files.
+ *
+ * Subclasses provide the parser of their source format by implementing
+ * \c openSource(). Records are encrypted in parallel by the
+ * \c yapet::ImportPipeline.
+ */
+class RecordImport {
+   public:
+    using line_number_type = yapet::ImportRecord::line_number_type;
+
+    /**
+     * What to do with a source record matching a record of the destination
+     * file.
+     */
+    enum class DuplicatePolicy {
+        //! Add the record nevertheless.
+        INSERT,
+        //! Replace the matching record.
+        REPLACE,
+        //! Keep the matching record and drop the source record.
+        SKIP
+    };
+
+    /**
+     * The fields identifying a record when looking for duplicates.
+     */
+    enum class MatchKey {
+        //! The record name.
+        NAME,
+        //! Host and username.
+        HOST_USERNAME
+    };
+    /**
+     * Log entry.
+     */
+    struct LogEntry {
+        line_number_type lineNumber;
+        std::string message;
+    };
+
+   private:
+    /**
+     * The file path of the destination (pet) file.
+     */
+    std::string dstfile;
+
+    /**
+     * Verbosity enabled/disabled.
+     */
+    bool verbose;
+    /**
+     * Indicates the occurrence of errors.
+     */
+    bool had_errors;
+    /**
+     * The number of errors occurred.
+     */
+    unsigned int num_errors;
+    /**
+     * The number of records added, replaced and skipped.
+     */
+    unsigned int num_inserted;
+    unsigned int num_replaced;
+    unsigned int num_skipped;
+
+    /**
+     * Holds the log entries in case of errors.
+     */
+    std::list<LogEntry> logs;
+
+    /**
+     * Logs the given error.
+     *
+     * @param lno the line number the error occurred.
+     *
+     * @param errmsg the error message.
+     */
+    void logError(unsigned long lno, const std::string& errmsg);
+
+    void progress(const yapet::ImportRecord& record);
+
+   protected:
+    /**
+     * Open the source file for parsing.
+     */
+    virtual std::unique_ptr<yapet::RecordSource> openSource() = 0;
+
+   public:
+    RecordImport(std::string dst, bool verb = true);
+    RecordImport(const RecordImport&) = delete;
+    RecordImport(RecordImport&&) = delete;
+    RecordImport& operator=(const RecordImport&) = delete;
+    RecordImport& operator=(RecordImport&&) = delete;
+    virtual ~RecordImport(){};
+
+    //! Do the import.
+    void import(const char* pw);
+    //! Import into an existing file.
+    void append(const char* pw,
+                DuplicatePolicy policy = DuplicatePolicy::INSERT,
+                MatchKey matchKey = MatchKey::NAME);
+    //! Import into an existing file opened using \c cryptoFactory.
+    void append(
+        const std::shared_ptr<yapet::AbstractCryptoFactory>& cryptoFactory,
+        DuplicatePolicy policy = DuplicatePolicy::INSERT,
+        MatchKey matchKey = MatchKey::NAME);
+    //! Set the verbosity.
+    inline void setVerbose(bool v) { verbose = v; }
+    //! Get the verbosity.
+    inline bool getVerbose() const { return verbose; }
+    //! Return whether or not errors occurred.
+    inline bool hadErrors() const { return had_errors; }
+    //! Return the number of errors occurred.
+    inline unsigned int numErrors() const { return num_errors; }
+    //! Return the number of records added to the file.
+    inline unsigned int numInserted() const { return num_inserted; }
+    //! Return the number of records replaced in the file.
+    inline unsigned int numReplaced() const { return num_replaced; }
+    //! Return the number of source records skipped as duplicates.
+    inline unsigned int numSkipped() const { return num_skipped; }
+    //! Return the log entries.
+    inline std::list<LogEntry> getLog() const { return logs; }
+    //! Print the log to stdout
+    void printLog() const;
+};
+
+#endif  // _RECORDIMPORT_H
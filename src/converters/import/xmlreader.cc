@@ -0,0 +1,366 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include "consts.h"
+#include "intl.h"
+#include "xmlreader.hh"
+
+using namespace yapet;
+
+constexpr XMLReader::size_type XMLReader::DEFAULT_MAX_TEXT_SIZE;
+
+namespace {
+// Longest name and reference accepted
+constexpr XMLReader::size_type MAX_NAME_SIZE{1024};
+
+inline bool isWhitespace(int c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+inline bool isNameCharacter(int c) {
+    return c != InputFile::END_OF_FILE && !isWhitespace(c) && c != '/' &&
+           c != '>' && c != '=' && c != '<' && c != '"' && c != '\'';
+}
+
+void appendUtf8(std::string& str, unsigned long codePoint) {
+    if (codePoint < 0x80) {
+        str += static_cast<char>(codePoint);
+    } else if (codePoint < 0x800) {
+        str += static_cast<char>(0xC0 | (codePoint >> 6));
+        str += static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else if (codePoint < 0x10000) {
+        str += static_cast<char>(0xE0 | (codePoint >> 12));
+        str += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        str += static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else {
+        str += static_cast<char>(0xF0 | (codePoint >> 18));
+        str += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        str += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        str += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+}
+
+bool isWhitespaceOnly(const std::string& str) {
+    for (char c : str) {
+        if (!isWhitespace(c)) return false;
+    }
+    return true;
+}
+}  // namespace
+
+XMLReader::XMLReader(const std::string& fileName, size_type maxTextSize)
+    : _input{fileName},
+      _maxTextSize{maxTextSize},
+      _lineNumber{1},
+      _name{},
+      _text{},
+      _truncated{false},
+      _attributes{},
+      _openElements{},
+      _pendingEnd{false},
+      _rootSeen{false} {}
+
+void XMLReader::error(const char* message) const {
+    char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+    std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                  _("XML error in '%s', line %u: %s"),
+                  _input.fileName().c_str(), _input.line(), message);
+    throw std::runtime_error(msg);
+}
+
+void XMLReader::expect(char c) {
+    if (_input.get() != static_cast<unsigned char>(c)) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("expected '%c'"), c);
+        error(msg);
+    }
+}
+
+void XMLReader::skipWhitespace() {
+    while (isWhitespace(_input.peek())) _input.get();
+}
+
+void XMLReader::readName(std::string& name) {
+    name.clear();
+    while (isNameCharacter(_input.peek())) {
+        if (name.size() == MAX_NAME_SIZE) error(_("name too long"));
+        name += static_cast<char>(_input.get());
+    }
+
+    if (name.empty()) error(_("name expected"));
+}
+
+/**
+ * Append characters to \c str up to one of \c stopCharacters, replacing
+ * references and new line sequences.
+ *
+ * @return \c false if characters have been dropped, since \c str would
+ * exceed the maximum text size.
+ */
+bool XMLReader::readCharacterData(std::string& str,
+                                  const char* stopCharacters) {
+    bool complete{true};
+    for (;;) {
+        complete &= _input.appendUntil(str, stopCharacters, _maxTextSize);
+
+        int c = _input.peek();
+        if (c == '&') {
+            _input.get();
+            readReference(str);
+        } else if (c == '\r') {
+            // Normalize "\r\n" and "\r" to "\n"
+            _input.get();
+            if (_input.peek() == '\n') {
+                _input.get();
+            }
+            str += '\n';
+        } else {
+            break;
+        }
+
+        if (str.size() > _maxTextSize) {
+            str.resize(_maxTextSize);
+            complete = false;
+        }
+    }
+    return complete;
+}
+
+/**
+ * Replace the reference following '&' by the character it stands for.
+ */
+void XMLReader::readReference(std::string& str) {
+    std::string reference;
+    int c;
+    while ((c = _input.get()) != ';') {
+        if (c == InputFile::END_OF_FILE || reference.size() == MAX_NAME_SIZE) {
+            error(_("unterminated reference"));
+        }
+        reference += static_cast<char>(c);
+    }
+
+    if (reference == "lt") {
+        str += '<';
+    } else if (reference == "gt") {
+        str += '>';
+    } else if (reference == "amp") {
+        str += '&';
+    } else if (reference == "quot") {
+        str += '"';
+    } else if (reference == "apos") {
+        str += '\'';
+    } else if (reference.size() > 1 && reference[0] == '#') {
+        bool hex{reference[1] == 'x'};
+        const char* digits{reference.c_str() + (hex ? 2 : 1)};
+        char* end;
+        unsigned long codePoint{std::strtoul(digits, &end, hex ? 16 : 10)};
+        if (*digits == '\0' || *end != '\0' || codePoint == 0 ||
+            codePoint > 0x10FFFF) {
+            error(_("invalid character reference"));
+        }
+        appendUtf8(str, codePoint);
+    } else {
+        error(_("unknown entity"));
+    }
+}
+
+XMLReader::Event XMLReader::readStartElement() {
+    readName(_name);
+    _attributes.clear();
+
+    for (;;) {
+        skipWhitespace();
+        int c = _input.peek();
+        if (c == '/') {
+            _input.get();
+            expect('>');
+            _pendingEnd = true;
+            break;
+        }
+        if (c == '>') {
+            _input.get();
+            break;
+        }
+
+        std::pair<std::string, std::string> attribute;
+        readName(attribute.first);
+        skipWhitespace();
+        expect('=');
+        skipWhitespace();
+        int quote = _input.get();
+        if (quote != '"' && quote != '\'') error(_("attribute value expected"));
+
+        const char* stopCharacters{quote == '"' ? "\"&<\r" : "'&<\r"};
+        _truncated |= !readCharacterData(attribute.second, stopCharacters);
+        if (_input.get() != quote) error(_("unterminated attribute value"));
+
+        _attributes.push_back(std::move(attribute));
+    }
+
+    if (_openElements.empty()) {
+        if (_rootSeen) error(_("more than one root element"));
+        _rootSeen = true;
+    }
+    _openElements.push_back(_name);
+    return Event::START_ELEMENT;
+}
+
+XMLReader::Event XMLReader::readEndElement() {
+    readName(_name);
+    skipWhitespace();
+    expect('>');
+
+    if (_openElements.empty() || _openElements.back() != _name) {
+        error(_("end tag does not match start tag"));
+    }
+    _openElements.pop_back();
+    return Event::END_ELEMENT;
+}
+
+/**
+ * Skip the document type declaration, including an internal subset.
+ */
+void XMLReader::skipDoctype() {
+    int brackets{0};
+    int quote{0};
+    for (;;) {
+        int c = _input.get();
+        if (c == InputFile::END_OF_FILE) error(_("unterminated DOCTYPE"));
+
+        if (quote != 0) {
+            if (c == quote) quote = 0;
+        } else if (c == '"' || c == '\'') {
+            quote = c;
+        } else if (c == '[') {
+            brackets++;
+        } else if (c == ']') {
+            brackets--;
+        } else if (c == '>' && brackets == 0) {
+            return;
+        }
+    }
+}
+
+XMLReader::Event XMLReader::next() {
+    if (_pendingEnd) {
+        _pendingEnd = false;
+        _openElements.pop_back();
+        return Event::END_ELEMENT;
+    }
+
+    _text.clear();
+    _truncated = false;
+    line_number_type textLineNumber{_input.line()};
+
+    for (;;) {
+        int c = _input.peek();
+        if (c == InputFile::END_OF_FILE) {
+            if (!_openElements.empty()) error(_("unexpected end of file"));
+            if (!_rootSeen) error(_("no root element"));
+            _lineNumber = _input.line();
+            return Event::END_DOCUMENT;
+        }
+
+        if (c != '<') {
+            _truncated |= !readCharacterData(_text, "<&\r");
+            continue;
+        }
+
+        // Comments, processing instructions and CDATA sections may appear
+        // within text
+        if (_input.startsWith("<!--")) {
+            if (!_input.skipPast("-->")) error(_("unterminated comment"));
+            continue;
+        }
+        if (_input.startsWith("<?")) {
+            if (!_input.skipPast("?>")) {
+                error(_("unterminated processing instruction"));
+            }
+            continue;
+        }
+        if (_input.startsWith("<![CDATA[")) {
+            _input.skipPast("<![CDATA[");
+            for (;;) {
+                _truncated |= !_input.appendUntil(_text, "]", _maxTextSize);
+                if (_input.startsWith("]]>")) {
+                    _input.skipPast("]]>");
+                    break;
+                }
+                if (_input.get() == InputFile::END_OF_FILE) {
+                    error(_("unterminated CDATA section"));
+                }
+                if (_text.size() < _maxTextSize) _text += ']';
+            }
+            continue;
+        }
+
+        // Markup ends the text
+        if (!_text.empty()) {
+            if (!_openElements.empty()) {
+                _lineNumber = textLineNumber;
+                return Event::TEXT;
+            }
+            if (!isWhitespaceOnly(_text)) {
+                error(_("text outside of root element"));
+            }
+            _text.clear();
+        }
+
+        _lineNumber = _input.line();
+        if (_input.startsWith("<!DOCTYPE")) {
+            if (_rootSeen) error(_("misplaced DOCTYPE"));
+            skipDoctype();
+            textLineNumber = _input.line();
+            continue;
+        }
+
+        _input.get();
+        if (_input.peek() == '/') {
+            _input.get();
+            return readEndElement();
+        }
+        return readStartElement();
+    }
+}
+
+const std::string* XMLReader::attribute(const std::string& name) const {
+    for (const auto& attribute : _attributes) {
+        if (attribute.first == name) return &attribute.second;
+    }
+    return nullptr;
+}
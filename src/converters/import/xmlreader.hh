@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _XMLREADER_HH
+#define _XMLREADER_HH
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "inputfile.hh"
+
+namespace yapet {
+/**
+ * Streaming XML parser.
+ *
+ * The document is reported as a sequence of events, one per call to
+ * \c next(), similar to SAX but pulled by the caller. Only the current
+ * event and the names of the open elements are held in memory, so
+ * documents of any size are parsed in constant memory.
+ *
+ * The parser covers what password managers export: elements, attributes,
+ * text, CDATA sections, character references and the predefined entities.
+ * Comments, processing instructions and the document type declaration are
+ * skipped. Namespaces are not interpreted, and the encoding is assumed to
+ * be UTF-8.
+ */
+class XMLReader {
+   public:
+    using line_number_type = InputFile::line_number_type;
+    using size_type = InputFile::size_type;
+
+    enum class Event { START_ELEMENT, END_ELEMENT, TEXT, END_DOCUMENT };
+
+    //! Text and attribute values are truncated to this size by default.
+    static constexpr size_type DEFAULT_MAX_TEXT_SIZE{64 * 1024};
+
+   private:
+    InputFile _input;
+    size_type _maxTextSize;
+    line_number_type _lineNumber;
+    std::string _name;
+    std::string _text;
+    bool _truncated;
+    std::vector<std::pair<std::string, std::string>> _attributes;
+    std::vector<std::string> _openElements;
+    bool _pendingEnd;
+    bool _rootSeen;
+
+    [[noreturn]] void error(const char* message) const;
+    void expect(char c);
+    void skipWhitespace();
+    void readName(std::string& name);
+    bool readCharacterData(std::string& str, const char* stopCharacters);
+    void readReference(std::string& str);
+    Event readStartElement();
+    Event readEndElement();
+    void skipDoctype();
+
+   public:
+    /**
+     * Open \c fileName for parsing.
+     *
+     * @throw std::runtime_error if the file cannot be opened.
+     */
+    XMLReader(const std::string& fileName,
+              size_type maxTextSize = DEFAULT_MAX_TEXT_SIZE);
+
+    /**
+     * Parse up to the next event.
+     *
+     * Adjacent text and CDATA sections are reported as one \c TEXT event.
+     * An empty element is reported as \c START_ELEMENT followed by
+     * \c END_ELEMENT.
+     *
+     * @throw std::runtime_error if the document is not well-formed or
+     * cannot be read.
+     */
+    Event next();
+
+    /**
+     * The name of the element of a \c START_ELEMENT or \c END_ELEMENT
+     * event.
+     */
+    const std::string& name() const { return _name; }
+
+    /**
+     * The text of a \c TEXT event, with references replaced.
+     */
+    const std::string& text() const { return _text; }
+
+    /**
+     * Whether the text of the current event or an attribute value has
+     * been truncated.
+     */
+    bool truncated() const { return _truncated; }
+
+    /**
+     * The value of the attribute \c name of a \c START_ELEMENT event, or
+     * \c nullptr if the element has no such attribute.
+     */
+    const std::string* attribute(const std::string& name) const;
+
+    /**
+     * The number of open elements, including the element of a
+     * \c START_ELEMENT event.
+     */
+    size_type depth() const { return _openElements.size(); }
+
+    /**
+     * The line the current event starts on.
+     */
+    line_number_type lineNumber() const { return _lineNumber; }
+};
+}  // namespace yapet
+
+#endif
@@ -0,0 +1,303 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "consts.h"
+#include "intl.h"
+#include "jsonimport.h"
+#include "jsonreader.hh"
+
+namespace {
+/**
+ * Feeds the items of a Bitwarden JSON file into the import pipeline.
+ *
+ * Only the folders and the fields of the current item are kept in memory,
+ * the file is never read into memory as a whole. Bitwarden writes the
+ * folders before the items. Folders following the items are not used as
+ * tags.
+ */
+class JSONRecordSource : public yapet::RecordSource {
+   private:
+    using Token = yapet::JSONReader::Token;
+
+    yapet::JSONReader _jsonReader;
+    bool _started;
+    bool _inItems;
+    bool _done;
+    std::unordered_map<std::string, std::string> _folders;
+
+    yapet::RecordFields _fields;
+    std::string _folderId;
+    bool _truncated;
+
+    [[noreturn]] void error(const char* message) const;
+    void readString(std::string& str);
+    void readFolders();
+    void readUris();
+    void readLogin();
+    void readItem(yapet::ImportRecord& record);
+    bool findItems();
+
+   public:
+    JSONRecordSource(const std::string& fileName)
+        : _jsonReader{fileName},
+          _started{false},
+          _inItems{false},
+          _done{false},
+          _folders{},
+          _fields{},
+          _folderId{},
+          _truncated{false} {}
+    ~JSONRecordSource() { _fields.clear(); }
+
+    virtual bool next(yapet::ImportRecord& record);
+};
+
+void JSONRecordSource::error(const char* message) const {
+    char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+    std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                  _("Line %u: %s"), _jsonReader.lineNumber(), message);
+    throw std::runtime_error(msg);
+}
+
+/**
+ * Reads the value following a key into \c str. \c null is read as empty
+ * string, other values are read as their text.
+ */
+void JSONRecordSource::readString(std::string& str) {
+    Token token{_jsonReader.next()};
+    if (token == Token::START_OBJECT || token == Token::START_ARRAY) {
+        _jsonReader.skip();
+        error(_("string expected"));
+    }
+
+    str = _jsonReader.string();
+    _truncated |= _jsonReader.truncated();
+}
+
+void JSONRecordSource::readFolders() {
+    Token token{_jsonReader.next()};
+    if (token == Token::NULL_VALUE) return;
+    if (token != Token::START_ARRAY) error(_("array of folders expected"));
+
+    while ((token = _jsonReader.next()) == Token::START_OBJECT) {
+        std::string id;
+        std::string name;
+        while (_jsonReader.next() == Token::KEY) {
+            if (_jsonReader.string() == "id") {
+                readString(id);
+            } else if (_jsonReader.string() == "name") {
+                readString(name);
+            } else {
+                _jsonReader.skip();
+            }
+        }
+        _folders[id] = name;
+    }
+
+    if (token != Token::END_ARRAY) error(_("folder expected"));
+}
+
+/**
+ * Reads the URIs of a login, keeping the first URI as host.
+ */
+void JSONRecordSource::readUris() {
+    Token token{_jsonReader.next()};
+    if (token == Token::NULL_VALUE) return;
+    if (token != Token::START_ARRAY) error(_("array of URIs expected"));
+
+    bool first{true};
+    while ((token = _jsonReader.next()) == Token::START_OBJECT) {
+        if (!first) {
+            _jsonReader.skip();
+            continue;
+        }
+
+        while (_jsonReader.next() == Token::KEY) {
+            if (_jsonReader.string() == "uri") {
+                readString(_fields.host);
+            } else {
+                _jsonReader.skip();
+            }
+        }
+        first = false;
+    }
+
+    if (token != Token::END_ARRAY) error(_("URI expected"));
+}
+
+void JSONRecordSource::readLogin() {
+    Token token{_jsonReader.next()};
+    if (token == Token::NULL_VALUE) return;
+    if (token != Token::START_OBJECT) error(_("login expected"));
+
+    while (_jsonReader.next() == Token::KEY) {
+        const auto& key{_jsonReader.string()};
+        if (key == "username") {
+            readString(_fields.username);
+        } else if (key == "password") {
+            readString(_fields.password);
+        } else if (key == "uris") {
+            readUris();
+        } else {
+            _jsonReader.skip();
+        }
+    }
+}
+
+/**
+ * Reads the item whose start has just been read.
+ */
+void JSONRecordSource::readItem(yapet::ImportRecord& record) {
+    record.lineNumber = _jsonReader.lineNumber();
+    _fields.clear();
+    _folderId.clear();
+    _truncated = false;
+
+    while (_jsonReader.next() == Token::KEY) {
+        const auto& key{_jsonReader.string()};
+        if (key == "name") {
+            readString(_fields.name);
+        } else if (key == "notes") {
+            readString(_fields.comment);
+        } else if (key == "folderId") {
+            readString(_folderId);
+        } else if (key == "login") {
+            readLogin();
+        } else {
+            // Cards, identities, custom fields, and the like are not
+            // supported by YAPET
+            _jsonReader.skip();
+        }
+    }
+
+    auto folder{_folders.find(_folderId)};
+    if (folder != _folders.end()) _fields.tags = folder->second;
+
+    if (_truncated) {
+        record.error = _("Item too long");
+        return;
+    }
+    record.assign(_fields);
+}
+
+/**
+ * Reads the top level object up to the array of items.
+ *
+ * @return \c false if the document has no further items.
+ */
+bool JSONRecordSource::findItems() {
+    if (!_started) {
+        if (_jsonReader.next() != Token::START_OBJECT) {
+            throw std::runtime_error(_("Not a Bitwarden JSON file"));
+        }
+        _started = true;
+    }
+
+    while (_jsonReader.next() == Token::KEY) {
+        const std::string key{_jsonReader.string()};
+        if (key == "encrypted") {
+            Token token{_jsonReader.next()};
+            if (token == Token::BOOLEAN && _jsonReader.string() == "true") {
+                throw std::runtime_error(
+                    _("Encrypted Bitwarden exports cannot be imported"));
+            }
+            if (token == Token::START_OBJECT || token == Token::START_ARRAY) {
+                _jsonReader.skip();
+            }
+        } else if (key == "folders") {
+            readFolders();
+        } else if (key == "items") {
+            Token token{_jsonReader.next()};
+            if (token == Token::START_ARRAY) return true;
+            if (token != Token::NULL_VALUE) error(_("array of items expected"));
+        } else {
+            _jsonReader.skip();
+        }
+    }
+
+    if (_jsonReader.next() != Token::END_DOCUMENT) {
+        error(_("end of document expected"));
+    }
+    return false;
+}
+
+bool JSONRecordSource::next(yapet::ImportRecord& record) {
+    while (!_done) {
+        if (!_inItems) {
+            _inItems = findItems();
+            _done = !_inItems;
+            continue;
+        }
+
+        Token token{_jsonReader.next()};
+        if (token == Token::START_OBJECT) {
+            readItem(record);
+            return true;
+        }
+        if (token != Token::END_ARRAY) error(_("item expected"));
+        _inItems = false;
+    }
+    return false;
+}
+}  // namespace
+
+/**
+ * The constructor tests whether the given source file exists and can be
+ * read. May return a \c std::runtime_error if this is not the case
+ *
+ * @param src the file path of the source file.
+ *
+ * @param dst the file path of the destination file.
+ *
+ * @param verb enable/disable verbosity. Default \c true.
+ */
+JSONImport::JSONImport(std::string src, std::string dst, bool verb)
+    : RecordImport(dst, verb), srcfile(src) {
+    if (access(srcfile.c_str(), R_OK | F_OK) == -1) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Cannot access '%s'"), srcfile.c_str());
+        throw std::runtime_error(msg);
+    }
+}
+
+std::unique_ptr<yapet::RecordSource> JSONImport::openSource() {
+    return std::unique_ptr<yapet::RecordSource>{
+        new JSONRecordSource{srcfile}};
+}
@@ -0,0 +1,229 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+
+#include "consts.h"
+#include "intl.h"
+#include "keepassimport.h"
+#include "xmlreader.hh"
+
+namespace {
+/**
+ * Feeds the entries of a KeePass XML file into the import pipeline.
+ *
+ * The parser only keeps the fields of the current entry, the file is never
+ * read into memory as a whole.
+ */
+class KeePassRecordSource : public yapet::RecordSource {
+   private:
+    using Event = yapet::XMLReader::Event;
+
+    yapet::XMLReader _xmlReader;
+    bool _started;
+    //! Number of open History elements.
+    int _historyDepth;
+
+    yapet::RecordFields _fields;
+    std::string _key;
+    std::string _value;
+    std::string* _text;
+    bool _truncated;
+    bool _protected;
+
+    void readEntry(yapet::ImportRecord& record);
+    void addString(yapet::ImportRecord& record);
+
+   public:
+    KeePassRecordSource(const std::string& fileName)
+        : _xmlReader{fileName},
+          _started{false},
+          _historyDepth{0},
+          _fields{},
+          _key{},
+          _value{},
+          _text{nullptr},
+          _truncated{false},
+          _protected{false} {}
+    ~KeePassRecordSource() {
+        _fields.clear();
+        std::fill(_value.begin(), _value.end(), '\0');
+    }
+
+    virtual bool next(yapet::ImportRecord& record);
+};
+
+/**
+ * Assigns the String element just read to a field of the current entry.
+ */
+void KeePassRecordSource::addString(yapet::ImportRecord& record) {
+    if (_key == "Title") {
+        _fields.name.swap(_value);
+    } else if (_key == "URL") {
+        _fields.host.swap(_value);
+    } else if (_key == "UserName") {
+        _fields.username.swap(_value);
+    } else if (_key == "Password") {
+        if (_protected && record.error.empty()) {
+            record.error = _("Encrypted password cannot be imported");
+        }
+        _fields.password.swap(_value);
+    } else if (_key == "Notes") {
+        _fields.comment.swap(_value);
+    }
+    // Custom fields are not supported by YAPET
+}
+
+/**
+ * Reads the entry whose start element has just been read.
+ */
+void KeePassRecordSource::readEntry(yapet::ImportRecord& record) {
+    auto entryDepth{_xmlReader.depth()};
+    record.lineNumber = _xmlReader.lineNumber();
+    _fields.clear();
+    _truncated = false;
+
+    for (;;) {
+        Event event{_xmlReader.next()};
+        auto depth{_xmlReader.depth()};
+
+        if (event == Event::TEXT) {
+            if (_text != nullptr) {
+                _text->append(_xmlReader.text());
+                _truncated |= _xmlReader.truncated();
+            }
+            continue;
+        }
+
+        _text = nullptr;
+        if (event == Event::START_ELEMENT) {
+            const auto& name{_xmlReader.name()};
+            if (depth == entryDepth + 1 && name == "String") {
+                _key.clear();
+                _value.clear();
+                _protected = false;
+            } else if (depth == entryDepth + 1 && name == "Tags") {
+                _text = &_fields.tags;
+            } else if (depth == entryDepth + 2 && name == "Key") {
+                _text = &_key;
+            } else if (depth == entryDepth + 2 && name == "Value") {
+                const std::string* value{_xmlReader.attribute("Protected")};
+                _protected = value != nullptr && *value == "True";
+                _text = &_value;
+            }
+        } else if (event == Event::END_ELEMENT) {
+            if (depth == entryDepth && _xmlReader.name() == "String") {
+                addString(record);
+            } else if (depth < entryDepth) {
+                break;
+            }
+        }
+    }
+
+    // KeePass separates tags by ';', YAPET by ','
+    for (auto& c : _fields.tags) {
+        if (c == ';') c = ',';
+    }
+
+    if (!record.error.empty()) return;
+
+    if (_truncated) {
+        record.error = _("Entry too long");
+        return;
+    }
+    record.assign(_fields);
+}
+
+bool KeePassRecordSource::next(yapet::ImportRecord& record) {
+    for (;;) {
+        Event event{_xmlReader.next()};
+
+        if (!_started) {
+            if (event != Event::START_ELEMENT ||
+                _xmlReader.name() != "KeePassFile") {
+                throw std::runtime_error(_("Not a KeePass XML file"));
+            }
+            _started = true;
+            continue;
+        }
+
+        switch (event) {
+            case Event::START_ELEMENT:
+                if (_xmlReader.name() == "History") {
+                    _historyDepth++;
+                } else if (_xmlReader.name() == "Entry" &&
+                           _historyDepth == 0) {
+                    readEntry(record);
+                    return true;
+                }
+                break;
+            case Event::END_ELEMENT:
+                if (_xmlReader.name() == "History") _historyDepth--;
+                break;
+            case Event::TEXT:
+                break;
+            case Event::END_DOCUMENT:
+                return false;
+        }
+    }
+}
+}  // namespace
+
+/**
+ * The constructor tests whether the given source file exists and can be
+ * read. May return a \c std::runtime_error if this is not the case
+ *
+ * @param src the file path of the source file.
+ *
+ * @param dst the file path of the destination file.
+ *
+ * @param verb enable/disable verbosity. Default \c true.
+ */
+KeePassImport::KeePassImport(std::string src, std::string dst, bool verb)
+    : RecordImport(dst, verb), srcfile(src) {
+    if (access(srcfile.c_str(), R_OK | F_OK) == -1) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Cannot access '%s'"), srcfile.c_str());
+        throw std::runtime_error(msg);
+    }
+}
+
+std::unique_ptr<yapet::RecordSource> KeePassImport::openSource() {
+    return std::unique_ptr<yapet::RecordSource>{
+        new KeePassRecordSource{srcfile}};
+}
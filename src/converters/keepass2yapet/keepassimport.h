@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _KEEPASSIMPORT_H
+#define _KEEPASSIMPORT_H 1
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <memory>
+#include <string>
+
+#include "recordimport.h"
+
+/**
+ * Converts the XML export of KeePass 2.x.
+ *
+ * Each entry, except the entries in the history of an entry, becomes a
+ * record. The standard fields Title, URL, UserName, Password, and Notes
+ * become name, host, username, password and comment. The tags of the entry
+ * become the tags of the record.
+ */
+class KeePassImport : public RecordImport {
+   private:
+    /**
+     * The file path of the source (XML) file.
+     */
+    std::string srcfile;
+
+   protected:
+    virtual std::unique_ptr<yapet::RecordSource> openSource();
+
+   public:
+    KeePassImport(std::string src, std::string dst, bool verb = true);
+    KeePassImport(const KeePassImport&) = delete;
+    KeePassImport(KeePassImport&&) = delete;
+    KeePassImport& operator=(const KeePassImport&) = delete;
+    KeePassImport& operator=(KeePassImport&&) = delete;
+    ~KeePassImport(){};
+};
+
+#endif  // _KEEPASSIMPORT_H
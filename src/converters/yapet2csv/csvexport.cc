@@ -33,25 +33,78 @@
 
 #include <unistd.h>
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
-#include <fstream>
 #include <iostream>
+#include <memory>
+#include <vector>
 
 #include "consts.h"
 #include "cryptofactoryhelper.hh"
 #include "csvexport.h"
-#include "csvline.hh"
+#include "csvwriter.hh"
 #include "file.hh"
+#include "jsonlinesbuffer.hh"
+#include "parallel.hh"
 #include "passwordrecord.hh"
 
+// Number of records each worker decrypts before the block is written. Bounds
+// the amount of decrypted data held in memory.
+constexpr std::size_t RECORDS_PER_WORKER{1024};
+
+namespace {
+// The fields exported by default, as expected by csv2yapet
+const std::vector<yapet::RecordField> DEFAULT_FIELDS{
+    yapet::RecordField::NAME, yapet::RecordField::HOST,
+    yapet::RecordField::USERNAME, yapet::RecordField::PASSWORD,
+    yapet::RecordField::COMMENT};
+
+void addHeader(yapet::CSVBuffer& csvBuffer,
+               const std::vector<yapet::RecordField>& fields) {
+    for (auto field : fields) {
+        csvBuffer.addField(yapet::recordFieldName(field));
+    }
+    csvBuffer.endRecord();
+}
+
+// JSON Lines name each field in each record
+void addHeader(yapet::JSONLinesBuffer&,
+               const std::vector<yapet::RecordField>&) {}
+
+void addRecord(yapet::CSVBuffer& csvBuffer,
+               const yapet::PasswordRecord& passwordRecord,
+               const std::vector<yapet::RecordField>& fields) {
+    for (auto field : fields) {
+        std::size_t size;
+        const char* value{
+            yapet::recordFieldValue(passwordRecord, field, size)};
+        csvBuffer.addField(value, size);
+    }
+    csvBuffer.endRecord();
+}
+
+void addRecord(yapet::JSONLinesBuffer& jsonLinesBuffer,
+               const yapet::PasswordRecord& passwordRecord,
+               const std::vector<yapet::RecordField>& fields) {
+    for (auto field : fields) {
+        std::size_t size;
+        const char* value{
+            yapet::recordFieldValue(passwordRecord, field, size)};
+        jsonLinesBuffer.addField(yapet::recordFieldName(field), value, size);
+    }
+    jsonLinesBuffer.endRecord();
+}
+}  // namespace
+
 /**
  * The constructor tests whether the given source file exists and can be
  * read. May return a \c std::runtime_error if this is not the case
  *
  * @param src the file path of the source file.
  *
- * @param dst the file path of the destination file.
+ * @param dst the file path of the destination file, or \c "-" for the
+ * standard output.
  *
  * @param sep the separator used for fields.
  *
@@ -64,7 +117,11 @@ CSVExport::CSVExport(std::string src, std::string dst, char sep, bool verb,
       dstfile(dst),
       separator(sep),
       _verbose(verb),
-      _print_header(print_header) {
+      _print_header(print_header),
+      _fields(DEFAULT_FIELDS),
+      _filter(),
+      _json_lines(false),
+      _num_exported(0) {
     if (access(srcfile.c_str(), R_OK | F_OK) == -1) {
         char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
         std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
@@ -73,78 +130,114 @@ CSVExport::CSVExport(std::string src, std::string dst, char sep, bool verb,
     }
 }
 
-namespace {
-inline std::ofstream openCsvFile(const std::string& fileName) {
-    std::ofstream csvFile(fileName);
-
-    if (!csvFile) {
-        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
-        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
-                      _("Cannot open '%s'"), fileName.c_str());
-        throw std::runtime_error(msg);
-    }
-
-    return csvFile;
-}
-}  // namespace
-
 /**
- * Does the export.
+ * Exports the records matching the filter.
  *
- * @param pw the password set on the destination file.
+ * Records are decrypted exactly once, in blocks processed in parallel by
+ * one worker per hardware thread. Each worker checks the records against
+ * the filter right after decrypting them, and formats the matching ones
+ * into its own buffer, created by \c newBuffer. The buffers are written in
+ * order with a single \c write each. Memory used for decrypted records
+ * thus does not depend on the number of records.
  */
-void CSVExport::doexport(const char* pw) {
-    auto csvFile{::openCsvFile(dstfile)};
-
-    auto password{yapet::toSecureArray(pw)};
-    std::shared_ptr<yapet::AbstractCryptoFactory> cryptoFactory{
-        yapet::getCryptoFactoryForFile(srcfile, password)};
+template <class Buffer, class NewBuffer>
+void CSVExport::exportRecords(
+    NewBuffer newBuffer,
+    const std::shared_ptr<yapet::AbstractCryptoFactory>& cryptoFactory) {
+    yapet::CSVWriter csvWriter{dstfile};
 
-    auto crypto{cryptoFactory->crypto()};
     std::unique_ptr<YAPET::File> yapetFile{
         new YAPET::File{cryptoFactory, srcfile, false, false}};
 
-    std::list<yapet::PasswordListItem> list = yapetFile->read();
+    auto encryptedRecords{yapetFile->readEncryptedRecords()};
+    auto numberOfRecords{encryptedRecords.size()};
 
-    std::list<yapet::PasswordListItem>::iterator it = list.begin();
+    unsigned int workers{yapet::numberOfWorkers(numberOfRecords)};
+    std::vector<std::unique_ptr<yapet::Crypto>> cryptos;
+    std::vector<std::unique_ptr<Buffer>> buffers;
+    std::vector<unsigned int> matches(workers, 0);
+    for (unsigned int i = 0; i < workers; i++) {
+        cryptos.push_back(cryptoFactory->crypto());
+        buffers.push_back(newBuffer());
+    }
 
-    yapet::CSVLine csvLine{5, separator};
-    if (!list.empty() && _print_header) {
-        csvLine.addField(0, std::string{"name"});
-        csvLine.addField(1, std::string{"host"});
-        csvLine.addField(2, std::string{"username"});
-        csvLine.addField(3, std::string{"password"});
-        csvLine.addField(4, std::string{"comment"});
-        csvFile << csvLine.getLine() << std::endl;
+    if (numberOfRecords > 0 && _print_header) {
+        auto& buffer{*buffers[0]};
+        addHeader(buffer, _fields);
+        csvWriter.write(buffer);
+        buffer.clear();
     }
 
-    while (it != list.end()) {
-        auto decryptedPasswordRecord{crypto->decrypt(it->encryptedRecord())};
-        yapet::PasswordRecord passwordRecord{decryptedPasswordRecord};
-
-        csvLine.addField(
-            0,
-            std::string(reinterpret_cast<const char*>(passwordRecord.name())));
-        csvLine.addField(
-            1,
-            std::string(reinterpret_cast<const char*>(passwordRecord.host())));
-        csvLine.addField(2, std::string(reinterpret_cast<const char*>(
-                                passwordRecord.username())));
-        csvLine.addField(3, std::string(reinterpret_cast<const char*>(
-                                passwordRecord.password())));
-        csvLine.addField(4, std::string(reinterpret_cast<const char*>(
-                                passwordRecord.comment())));
-
-        csvFile << csvLine.getLine() << std::endl;
+    const std::size_t blockSize{workers * RECORDS_PER_WORKER};
+    for (std::size_t block = 0; block < numberOfRecords; block += blockSize) {
+        auto recordsInBlock{std::min(blockSize, numberOfRecords - block)};
+
+        yapet::parallelFor(
+            recordsInBlock, workers,
+            [&](unsigned int worker, std::size_t begin, std::size_t end) {
+                auto& crypto{*cryptos[worker]};
+                auto& buffer{*buffers[worker]};
+                for (auto i = block + begin; i < block + end; i++) {
+                    yapet::PasswordRecord passwordRecord{
+                        crypto.decrypt(encryptedRecords[i])};
+                    if (!_filter.matches(passwordRecord)) continue;
+
+                    addRecord(buffer, passwordRecord, _fields);
+                    matches[worker]++;
+                }
+            });
+
+        // parallelFor() hands out consecutive ranges in worker order
+        for (auto& buffer : buffers) {
+            csvWriter.write(*buffer);
+            buffer->clear();
+        }
 
         if (_verbose) {
-            std::cout << ".";
+            std::cout << std::string(recordsInBlock, '.');
             std::cout.flush();
         }
-        it++;
     }
 
     if (_verbose) std::cout << std::endl;
 
-    csvFile.close();
+    csvWriter.close();
+
+    _num_exported = 0;
+    for (auto m : matches) _num_exported += m;
+}
+
+/**
+ * Does the export.
+ *
+ * @param pw the password set on the destination file.
+ */
+void CSVExport::doexport(const char* pw) {
+    auto password{yapet::toSecureArray(pw)};
+    doexport(yapet::getCryptoFactoryForFile(srcfile, password));
+}
+
+/**
+ * Does the export.
+ *
+ * @param cryptoFactory the crypto factory for the source file.
+ */
+void CSVExport::doexport(
+    const std::shared_ptr<yapet::AbstractCryptoFactory>& cryptoFactory) {
+    if (_json_lines) {
+        exportRecords<yapet::JSONLinesBuffer>(
+            []() {
+                return std::unique_ptr<yapet::JSONLinesBuffer>{
+                    new yapet::JSONLinesBuffer{}};
+            },
+            cryptoFactory);
+    } else {
+        char separator{this->separator};
+        exportRecords<yapet::CSVBuffer>(
+            [separator]() {
+                return std::unique_ptr<yapet::CSVBuffer>{
+                    new yapet::CSVBuffer{separator}};
+            },
+            cryptoFactory);
+    }
 }
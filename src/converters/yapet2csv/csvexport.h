@@ -34,12 +34,13 @@
 #include "config.h"
 #endif
 
-#include <list>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
-#include "crypto.hh"
-#include "csvline.hh"
+#include "abstractcryptofactory.hh"
+#include "recordfilter.hh"
 
 /**
  * The class taking care of converting a pet file to a csv file.
@@ -68,16 +69,53 @@ class CSVExport {
      */
     bool _print_header;
 
+    /**
+     * The fields exported, in order.
+     */
+    std::vector<yapet::RecordField> _fields;
+
+    /**
+     * The conditions records have to meet in order to be exported.
+     */
+    yapet::RecordFilter _filter;
+
+    /**
+     * Write JSON Lines instead of CSV.
+     */
+    bool _json_lines;
+
+    /**
+     * The number of records exported.
+     */
+    unsigned int _num_exported;
+
+    template <class Buffer, class NewBuffer>
+    void exportRecords(
+        NewBuffer newBuffer,
+        const std::shared_ptr<yapet::AbstractCryptoFactory>& cryptoFactory);
+
    public:
     CSVExport(std::string src, std::string dst, char sep, bool verb = true,
               bool print_header = false);
     ~CSVExport(){};
     /// Do the import.
     void doexport(const char* pw);
+    void doexport(
+        const std::shared_ptr<yapet::AbstractCryptoFactory>& cryptoFactory);
     /// Set the verbosity.
     inline void verbose(bool v) { _verbose = v; }
     /// Get the verbosity.
     inline bool verbose() const { return _verbose; }
+    /// Set the fields exported, in order.
+    inline void fields(const std::vector<yapet::RecordField>& f) {
+        _fields = f;
+    }
+    /// Set the conditions records have to meet in order to be exported.
+    inline void filter(const yapet::RecordFilter& f) { _filter = f; }
+    /// Write JSON Lines instead of CSV.
+    inline void jsonLines(bool j) { _json_lines = j; }
+    /// Return the number of records exported.
+    inline unsigned int numExported() const { return _num_exported; }
 };
 
 #endif  // _CSVEXPORT_H
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "jsonlinesbuffer.hh"
+
+using namespace yapet;
+
+namespace {
+constexpr char HEX_DIGITS[]{"0123456789abcdef"};
+
+inline bool needsEscape(unsigned char c) {
+    return c < 0x20 || c == '"' || c == '\\';
+}
+}  // namespace
+
+JSONLinesBuffer::JSONLinesBuffer() : RecordBuffer{}, _firstField{true} {}
+
+void JSONLinesBuffer::addString(const char* str, size_type size) {
+    append('"');
+
+    const char* end{str + size};
+    while (str < end) {
+        // Copy characters not needing escapes in one go
+        const char* run{str};
+        while (run < end && !needsEscape(static_cast<unsigned char>(*run))) {
+            run++;
+        }
+        append(str, run - str);
+        if (run == end) break;
+
+        unsigned char c{static_cast<unsigned char>(*run)};
+        switch (c) {
+            case '"':
+                append("\\\"", 2);
+                break;
+            case '\\':
+                append("\\\\", 2);
+                break;
+            case '\n':
+                append("\\n", 2);
+                break;
+            case '\r':
+                append("\\r", 2);
+                break;
+            case '\t':
+                append("\\t", 2);
+                break;
+            default: {
+                char escape[]{'\\', 'u', '0', '0', HEX_DIGITS[c >> 4],
+                              HEX_DIGITS[c & 0xF]};
+                append(escape, sizeof(escape));
+            }
+        }
+        str = run + 1;
+    }
+
+    append('"');
+}
+
+void JSONLinesBuffer::addField(const char* name, const char* field,
+                               size_type size) {
+    append(_firstField ? '{' : ',');
+    _firstField = false;
+
+    addString(name, std::strlen(name));
+    append(':');
+    addString(field, size);
+}
+
+void JSONLinesBuffer::endRecord() {
+    if (_firstField) append('{');
+    append("}\n", 2);
+    _firstField = true;
+}
+
+void JSONLinesBuffer::clear() {
+    RecordBuffer::clear();
+    _firstField = true;
+}
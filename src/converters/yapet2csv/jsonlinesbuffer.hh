@@ -27,44 +27,49 @@
  * well as that of the covered work.
  */
 
-#ifndef _RNGENGINE_HH
-#define _RNGENGINE_HH
+#ifndef _JSONLINESBUFFER_HH
+#define _JSONLINESBUFFER_HH
 
-#include <array>
-#include <cstdint>
-#include <limits>
+#include <cstring>
+
+#include "csvwriter.hh"
 
 namespace yapet {
-namespace pwgen {
-class RngEngine {
-   public:
-    using result_type = std::uint8_t;
-    static constexpr std::uint8_t max() {
-        return std::numeric_limits<std::uint8_t>::max();
-    }
-    static constexpr std::uint8_t min() {
-        return std::numeric_limits<std::uint8_t>::min();
-    }
+/**
+ * Memory buffer records are formatted into as JSON Lines, i.e. one JSON
+ * object per line.
+ *
+ * Field values are expected to be UTF-8 and are written as JSON strings,
+ * escaping quotes, backslashes and control characters.
+ */
+class JSONLinesBuffer : public RecordBuffer {
+   private:
+    bool _firstField;
 
-    RngEngine();
-    ~RngEngine();
-    RngEngine(const RngEngine& other);
-    RngEngine(RngEngine&& other);
-    RngEngine& operator=(const RngEngine& other);
-    RngEngine& operator=(RngEngine&& other);
+    void addString(const char* str, size_type size);
 
-    std::uint8_t operator()();
+   public:
+    JSONLinesBuffer();
 
-   private:
-    static constexpr int BYTE_CACHE_SIZE{8};
-    static constexpr int EMPTY_CACHE{-1};
-    int fd;
-    std::array<std::uint8_t, BYTE_CACHE_SIZE> byteCache;
-    int positionInCache;
+    /**
+     * Append the member \c name with the value \c field of \c size bytes
+     * to the current record.
+     */
+    void addField(const char* name, const char* field, size_type size);
+    void addField(const char* name, const char* field) {
+        addField(name, field, std::strlen(field));
+    }
+
+    /**
+     * Terminate the current record.
+     */
+    void endRecord();
 
-    void fillCache();
-    std::uint8_t readRandomByte();
+    /**
+     * Wipe and empty the buffer.
+     */
+    void clear();
 };
-}  // namespace pwgen
 }  // namespace yapet
-#endif
\ No newline at end of file
+
+#endif
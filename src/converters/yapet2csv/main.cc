@@ -47,13 +47,18 @@
 #include <cstdio>
 #include <cstring>
 #include <iostream>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
+#include "agentclient.hh"
 #include "consts.h"
 #include "csvexport.h"
+#include "csvwriter.hh"
 #include "intl.h"
 #include "openssl.hh"
+#include "recordfilter.hh"
 
 #if defined(HAVE_TERMIOS_H) && defined(HAVE_TCSETATTR) && \
     defined(HAVE_TCGETATTR)
@@ -147,15 +152,31 @@ void show_copyright() { std::cout << COPYRIGHT << std::endl; }
 
 void show_help(char* prgname) {
     std::cout << std::endl;
-    std::cout
-        << basename(prgname)
-        << " [-c] [-h] [-V] [-H] [-p <password>] [-q] [-s <char>] <src> <dst>"
-        << std::endl
-        << std::endl;
+    std::cout << basename(prgname)
+              << " [-c] [-h] [-V] [-H] [-f <expr>]... [-F <fields>] [-j]"
+                 " [-p <password>] [-q] [-s <char>] <src> <dst>"
+              << std::endl
+              << std::endl;
     std::cout << "-c\t" << _("show copyright information") << std::endl
               << std::endl;
+    std::cout << "-f\t" << _("only export records matching <expr>, one of")
+              << std::endl
+              << "\t" << _("field=value, field~text, field=~regex, or")
+              << std::endl
+              << "\t" << _("tag=tag. May be given more than once.")
+              << std::endl
+              << std::endl;
+    std::cout << "-F\t" << _("export the comma separated <fields>, out of")
+              << std::endl
+              << "\t" << _("name, host, username, password, comment, tags.")
+              << std::endl
+              << "\t" << _("Default: name,host,username,password,comment")
+              << std::endl
+              << std::endl;
     std::cout << "-h\t" << _("show this help text") << std::endl << std::endl;
     std::cout << "-H\t" << _("add header to file") << std::endl << std::endl;
+    std::cout << "-j\t" << _("write JSON Lines instead of CSV") << std::endl
+              << std::endl;
     std::cout << "-p\t" << _("use <password> to open yapet file.") << std::endl
               << "\t" << _("The use of this option is discouraged.")
               << std::endl
@@ -168,7 +189,8 @@ void show_help(char* prgname) {
               << std::endl;
     std::cout << "<src>\t" << _("the source YAPET file") << std::endl
               << std::endl;
-    std::cout << "<dst>\t" << _("the CSV output file") << std::endl
+    std::cout << "<dst>\t" << _("the CSV output file, or - for stdout")
+              << std::endl
               << std::endl;
     std::cout << _("yapet2csv converts YAPET files to CSV text files.")
               << std::endl
@@ -179,6 +201,9 @@ int main(int argc, char** argv) {
     bool quiet = false;
     bool cmdline_pw = false;
     bool print_header = false;
+    bool json_lines = false;
+    yapet::RecordFilter filter;
+    std::vector<yapet::RecordField> fields;
     char passwd[MAX_PASSWD];
     char separator = ',';
     std::string srcfile;
@@ -188,14 +213,33 @@ int main(int argc, char** argv) {
     extern char* optarg;
     extern int optopt, optind;
 
-    while ((c = getopt(argc, argv, ":chp:qs:HV")) != -1) {
+    while ((c = getopt(argc, argv, ":cf:F:hjp:qs:HV")) != -1) {
         switch (c) {
             case 'c':
                 show_copyright();
                 return 0;
+            case 'f':
+                try {
+                    filter.add(optarg);
+                } catch (std::invalid_argument& ex) {
+                    std::cerr << ex.what() << std::endl;
+                    return ERR_CMDLINE;
+                }
+                break;
+            case 'F':
+                try {
+                    fields = yapet::parseRecordFields(optarg);
+                } catch (std::invalid_argument& ex) {
+                    std::cerr << ex.what() << std::endl;
+                    return ERR_CMDLINE;
+                }
+                break;
             case 'h':
                 show_help(argv[0]);
                 return 0;
+            case 'j':
+                json_lines = true;
+                break;
             case 'p':
                 strncpy(passwd, optarg, MAX_PASSWD - 1);
                 passwd[MAX_PASSWD - 1] = 0;
@@ -241,7 +285,11 @@ int main(int argc, char** argv) {
         std::string::npos)
         srcfile += YAPET::Consts::DEFAULT_FILE_SUFFIX;
 
-    if (access(dstfile.c_str(), F_OK) == 0) {
+    // Records written to stdout must not be mixed with progress output
+    bool toStdout = dstfile == yapet::CSVWriter::STANDARD_OUTPUT;
+    if (toStdout) {
+        quiet = true;
+    } else if (access(dstfile.c_str(), F_OK) == 0) {
         std::cerr << dstfile << _(" already exists. Aborting.") << std::endl;
         return ERR_FILEEXISTS;
     }
@@ -249,15 +297,23 @@ int main(int argc, char** argv) {
     yapet::OpenSSL::init();
 
     try {
+        // The agent, if it holds the key of the file, saves asking for the
+        // password.
+        std::shared_ptr<yapet::AbstractCryptoFactory> cryptoFactory;
+        if (!cmdline_pw) {
+            cryptoFactory = yapet::agent::agentCryptoFactoryForFile(srcfile);
+        }
+
         // We read the password from stdin only if the user did not provide the
         // -p switch.
-        if (!cmdline_pw) {
-            std::cout << _("Please enter the password for ") << srcfile << ": ";
-            std::cout.flush();
+        if (!cmdline_pw && !cryptoFactory) {
+            std::ostream& prompt = toStdout ? std::cerr : std::cout;
+            prompt << _("Please enter the password for ") << srcfile << ": ";
+            prompt.flush();
             std::string pw1;
             disable_echo();
             std::getline(std::cin, pw1);
-            std::cout << std::endl;
+            prompt << std::endl;
             enable_echo();
 
             strncpy(passwd, pw1.c_str(), MAX_PASSWD - 1);
@@ -265,9 +321,18 @@ int main(int argc, char** argv) {
         }
 
         CSVExport exp(srcfile, dstfile, separator, !quiet, print_header);
-        exp.doexport(passwd);
+        if (!fields.empty()) exp.fields(fields);
+        exp.filter(filter);
+        exp.jsonLines(json_lines);
+        if (cryptoFactory) {
+            exp.doexport(cryptoFactory);
+        } else {
+            exp.doexport(passwd);
+        }
 
         if (!quiet) {
+            std::cout << exp.numExported() << _(" records exported.")
+                      << std::endl;
             std::cout << dstfile << _(" successfully created.") << std::endl;
         }
     } catch (std::exception& ex) {
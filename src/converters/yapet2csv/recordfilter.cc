@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include "consts.h"
+#include "intl.h"
+#include "recordfilter.hh"
+#include "tagindex.hh"
+
+using namespace yapet;
+
+namespace {
+// The pseudo field of tag membership conditions
+constexpr char TAG_FIELD[]{"tag"};
+
+[[noreturn]] void invalidArgument(const char* format, const std::string& arg) {
+    char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+    std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE, format,
+                  arg.c_str());
+    throw std::invalid_argument(msg);
+}
+}  // namespace
+
+void RecordFilter::add(const std::string& expression) {
+    // The field name is followed by the operator
+    auto position{std::find_if_not(
+        expression.begin(), expression.end(),
+        [](char c) { return std::isalpha(static_cast<unsigned char>(c)); })};
+    std::string name{expression.begin(), position};
+    std::string rest{position, expression.end()};
+
+    Condition condition{Operator::EQUALS, RecordField::TAGS, "", nullptr};
+    if (rest.compare(0, 2, "=~") == 0) {
+        condition.op = Operator::MATCHES;
+        condition.value = rest.substr(2);
+    } else if (rest.compare(0, 1, "=") == 0) {
+        condition.op = name == TAG_FIELD ? Operator::HAS_TAG : Operator::EQUALS;
+        condition.value = rest.substr(1);
+    } else if (rest.compare(0, 1, "~") == 0) {
+        condition.op = Operator::CONTAINS;
+        condition.value = rest.substr(1);
+    } else {
+        invalidArgument(_("Invalid filter expression '%s'"), expression);
+    }
+
+    if (condition.op != Operator::HAS_TAG) {
+        condition.field = parseRecordField(name);
+    }
+
+    if (condition.op == Operator::MATCHES) {
+        try {
+            condition.regex = std::make_shared<std::regex>(
+                condition.value, std::regex::extended | std::regex::nosubs);
+        } catch (std::regex_error&) {
+            invalidArgument(_("Invalid regular expression '%s'"),
+                            condition.value);
+        }
+    }
+
+    _conditions.push_back(std::move(condition));
+}
+
+bool RecordFilter::matches(const Condition& condition,
+                           const PasswordRecord& passwordRecord) {
+    std::size_t size;
+    const char* value{
+        recordFieldValue(passwordRecord, condition.field, size)};
+
+    switch (condition.op) {
+        case Operator::EQUALS:
+            return condition.value.size() == size &&
+                   std::memcmp(condition.value.data(), value, size) == 0;
+        case Operator::CONTAINS:
+            return condition.value.empty() ||
+                   std::search(value, value + size, condition.value.begin(),
+                               condition.value.end()) != value + size;
+        case Operator::MATCHES:
+            return std::regex_search(value, value + size, *condition.regex);
+        case Operator::HAS_TAG: {
+            std::string tags{value, size};
+            auto parsedTags{TagIndex::parseTags(tags.c_str())};
+            return std::find(parsedTags.begin(), parsedTags.end(),
+                             condition.value) != parsedTags.end();
+        }
+    }
+    return false;
+}
+
+bool RecordFilter::matches(const PasswordRecord& passwordRecord) const {
+    for (const auto& condition : _conditions) {
+        if (!matches(condition, passwordRecord)) return false;
+    }
+    return true;
+}
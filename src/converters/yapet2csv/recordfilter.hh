@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _RECORDFILTER_HH
+#define _RECORDFILTER_HH
+
+#include <memory>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "passwordrecord.hh"
+#include "recordfield.hh"
+
+namespace yapet {
+/**
+ * Conditions password records have to meet in order to be exported.
+ *
+ * A record matches the filter if it meets all conditions. Conditions are
+ * given as expressions, where \c field is one of the names returned by \c
+ * recordFieldName():
+ *
+ * - <tt>field=value</tt>: the field equals \c value.
+ * - <tt>field~text</tt>: the field contains \c text.
+ * - <tt>field=~regex</tt>: the field matches the POSIX extended regular
+ *   expression \c regex.
+ * - <tt>tag=tag</tt>: the record has the tag \c tag.
+ *
+ * All comparisons are case sensitive. \c matches() does not modify the
+ * filter, and may thus be called on several threads at once.
+ */
+class RecordFilter {
+   private:
+    enum class Operator { EQUALS, CONTAINS, MATCHES, HAS_TAG };
+
+    struct Condition {
+        Operator op;
+        RecordField field;
+        std::string value;
+        std::shared_ptr<std::regex> regex;
+    };
+
+    std::vector<Condition> _conditions;
+
+    static bool matches(const Condition& condition,
+                        const PasswordRecord& passwordRecord);
+
+   public:
+    RecordFilter() : _conditions{} {}
+
+    /**
+     * Add the condition \c expression.
+     *
+     * @throw std::invalid_argument if \c expression is malformed.
+     */
+    void add(const std::string& expression);
+
+    /**
+     * Whether \c passwordRecord meets all conditions.
+     */
+    bool matches(const PasswordRecord& passwordRecord) const;
+
+    bool empty() const { return _conditions.empty(); }
+};
+}  // namespace yapet
+
+#endif
@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <typeinfo>
+
+#include "aes256factory.hh"
+#include "agentclient.hh"
+#include "consts.h"
+#include "filehelper.hh"
+#include "intl.h"
+#include "logger.hh"
+#include "yapet20file.hh"
+
+using namespace yapet;
+using namespace yapet::agent;
+
+namespace {
+/**
+ * The agent does not share the working directory of the client, so it has
+ * to be given absolute file names.
+ */
+std::string absolutePath(const std::string& filename) {
+    char* resolved = ::realpath(filename.c_str(), nullptr);
+    if (resolved == nullptr) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      "%s: %s", filename.c_str(), std::strerror(errno));
+        throw AgentError{msg};
+    }
+
+    std::string result{resolved};
+    std::free(resolved);
+    return result;
+}
+}  // namespace
+
+AgentClient::AgentClient(const std::string& socketPath) : _socket{-1} {
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (socketPath.size() >= sizeof(address.sun_path)) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Socket path '%s' too long"), socketPath.c_str());
+        throw AgentError{msg};
+    }
+    std::strncpy(address.sun_path, socketPath.c_str(),
+                 sizeof(address.sun_path) - 1);
+
+    _socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (_socket < 0 ||
+        ::connect(_socket, reinterpret_cast<sockaddr*>(&address),
+                  sizeof(address)) != 0) {
+        auto error = errno;
+        if (_socket > -1) ::close(_socket);
+
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Cannot connect to agent '%s': %s"),
+                      socketPath.c_str(), std::strerror(error));
+        throw AgentError{msg};
+    }
+}
+
+AgentClient::~AgentClient() { ::close(_socket); }
+
+Fields AgentClient::request(Message type, const Fields& fields) {
+    sendMessage(_socket, type, fields);
+
+    Message replyType;
+    Fields reply;
+    if (!receiveMessage(_socket, replyType, reply)) {
+        throw AgentError{_("Agent closed the connection")};
+    }
+
+    if (replyType != Message::SUCCESS) {
+        if (reply.size() == 1) {
+            throw AgentError{toString(reply[0])};
+        }
+        throw AgentError{_("Agent request failed")};
+    }
+    return reply;
+}
+
+std::string AgentClient::socketPathFromEnvironment() {
+    const char* socketPath = std::getenv(SOCKET_ENVIRONMENT_VARIABLE);
+    if (socketPath == nullptr) return std::string{};
+    return socketPath;
+}
+
+void AgentClient::addKey(const std::string& filename,
+                         const SecureArray& password) {
+    request(Message::ADD_KEY,
+            Fields{toField(absolutePath(filename)), password});
+}
+
+bool AgentClient::hasKey(const std::string& id) {
+    try {
+        request(Message::HAS_KEY, Fields{toField(id)});
+        return true;
+    } catch (AgentError&) {
+        return false;
+    }
+}
+
+SecureArray AgentClient::encrypt(const std::string& id,
+                                 const SecureArray& plainText) {
+    auto reply{request(Message::ENCRYPT, Fields{toField(id), plainText})};
+    if (reply.size() != 1) {
+        throw AgentError{_("Invalid agent reply")};
+    }
+    return reply[0];
+}
+
+SecureArray AgentClient::decrypt(const std::string& id,
+                                 const SecureArray& cipherText) {
+    auto reply{request(Message::DECRYPT, Fields{toField(id), cipherText})};
+    if (reply.size() != 1) {
+        throw AgentError{_("Invalid agent reply")};
+    }
+    return reply[0];
+}
+
+std::vector<PasswordRecord> AgentClient::lookup(const std::string& filename,
+                                                const std::string& pattern) {
+    auto reply{
+        request(Message::LOOKUP, Fields{toField(absolutePath(filename)),
+                                        toField(pattern)})};
+
+    std::vector<PasswordRecord> records;
+    records.reserve(reply.size());
+    for (const auto& serializedRecord : reply) {
+        records.emplace_back(serializedRecord);
+    }
+    return records;
+}
+
+void AgentClient::removeAll() { request(Message::REMOVE_ALL); }
+
+void AgentClient::stop() { request(Message::STOP); }
+
+void AgentKey::keyingParameters(const MetaData&) {
+    throw AgentError{_("Keys held by the agent cannot be changed")};
+}
+
+void AgentKey::password(const SecureArray&) {
+    throw AgentError{_("Keys held by the agent cannot be changed")};
+}
+
+SecureArray AgentKey::key() const {
+    throw AgentError{_("The key is held by the agent")};
+}
+
+bool AgentKey::operator==(const Key& k) const {
+    if (typeid(k) != typeid(*this)) {
+        return false;
+    }
+
+    return _id == dynamic_cast<const AgentKey&>(k)._id;
+}
+
+AgentCrypto::AgentCrypto(const std::shared_ptr<AgentKey>& key,
+                         const std::string& socketPath)
+    : Crypto{key}, _client{new AgentClient{socketPath}}, _id{key->id()} {}
+
+const EVP_CIPHER* AgentCrypto::getCipher() const { return EVP_aes_256_cbc(); }
+
+SecureArray AgentCrypto::encrypt(const SecureArray& plainText) {
+    return _client->encrypt(_id, plainText);
+}
+
+SecureArray AgentCrypto::decrypt(const SecureArray& cipherText) {
+    return _client->decrypt(_id, cipherText);
+}
+
+AgentCryptoFactory::AgentCryptoFactory(const std::string& socketPath,
+                                       const std::string& id,
+                                       const MetaData& keyingParameters)
+    : _socketPath{socketPath}, _key{new AgentKey{id, keyingParameters}} {}
+
+std::shared_ptr<AbstractCryptoFactory> AgentCryptoFactory::newFactory(
+    const SecureArray& password, const MetaData& keyingParameters) const {
+    return std::shared_ptr<AbstractCryptoFactory>{
+        new Aes256Factory{password, keyingParameters}};
+}
+
+std::unique_ptr<Crypto> AgentCryptoFactory::crypto() const {
+    return std::unique_ptr<Crypto>{new AgentCrypto{_key, _socketPath}};
+}
+
+std::unique_ptr<YapetFile> AgentCryptoFactory::file(const std::string& filename,
+                                                    bool create,
+                                                    bool secure) const {
+    return std::unique_ptr<YapetFile>{
+        new Yapet20File{filename, create, secure}};
+}
+
+std::shared_ptr<AbstractCryptoFactory> yapet::agent::agentCryptoFactoryForFile(
+    const std::string& filename) {
+    auto socketPath{AgentClient::socketPathFromEnvironment()};
+    if (socketPath.empty()) return std::shared_ptr<AbstractCryptoFactory>{};
+
+    try {
+        auto id{keyId(filename)};
+        if (!AgentClient{socketPath}.hasKey(id)) {
+            return std::shared_ptr<AbstractCryptoFactory>{};
+        }
+        return std::shared_ptr<AbstractCryptoFactory>{new AgentCryptoFactory{
+            socketPath, id, readMetaData(filename, false)}};
+    } catch (std::exception& ex) {
+        LOG_MESSAGE(std::string{__func__} + ": " + ex.what());
+        return std::shared_ptr<AbstractCryptoFactory>{};
+    }
+}
@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _AGENTCLIENT_HH
+#define _AGENTCLIENT_HH
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstractcryptofactory.hh"
+#include "agentprotocol.hh"
+#include "crypto.hh"
+#include "key.hh"
+#include "passwordrecord.hh"
+
+namespace yapet {
+namespace agent {
+/**
+ * Connection to the agent.
+ */
+class AgentClient {
+   private:
+    int _socket;
+
+    Fields request(Message type, const Fields& fields = Fields{});
+
+   public:
+    /**
+     * @throw AgentError if the agent cannot be connected to.
+     */
+    AgentClient(const std::string& socketPath);
+    ~AgentClient();
+
+    AgentClient(const AgentClient&) = delete;
+    AgentClient& operator=(const AgentClient&) = delete;
+
+    /**
+     * The socket path in the environment variable \c
+     * SOCKET_ENVIRONMENT_VARIABLE, or an empty string if it is not set.
+     */
+    static std::string socketPathFromEnvironment();
+
+    /**
+     * Make the agent derive and keep the key of \c filename.
+     * Relative file names are resolved before being passed to the agent.
+     *
+     * @throw AgentError if the agent failed, e.g. the password is invalid.
+     */
+    void addKey(const std::string& filename, const SecureArray& password);
+    bool hasKey(const std::string& id);
+
+    SecureArray encrypt(const std::string& id, const SecureArray& plainText);
+    SecureArray decrypt(const std::string& id, const SecureArray& cipherText);
+
+    /**
+     * The records of \c filename whose name matches the shell wildcard
+     * pattern \c pattern, in file order.
+     */
+    std::vector<PasswordRecord> lookup(const std::string& filename,
+                                       const std::string& pattern);
+
+    void removeAll();
+    void stop();
+};
+
+/**
+ * Stands in for a key held by the agent.
+ *
+ * The key itself never leaves the agent, this merely refers to it by its
+ * id.
+ */
+class AgentKey : public Key {
+   private:
+    std::string _id;
+    MetaData _keyingParameters;
+
+   public:
+    AgentKey(const std::string& id, const MetaData& keyingParameters)
+        : _id{id}, _keyingParameters{keyingParameters} {}
+
+    const std::string& id() const { return _id; }
+
+    /**
+     * @throw AgentError always.
+     */
+    void keyingParameters(const MetaData& parameters);
+    const MetaData& keyingParameters() const { return _keyingParameters; }
+    /**
+     * @throw AgentError always.
+     */
+    void password(const SecureArray& password);
+
+    /**
+     * @throw AgentError always, the key is held by the agent.
+     */
+    SecureArray key() const;
+    SecureArray::size_type keySize() const { return 0; }
+
+    SecureArray ivec() const { return SecureArray{}; }
+    SecureArray::size_type ivecSize() const { return 0; }
+
+    bool operator==(const Key& k) const;
+    bool operator!=(const Key& k) const { return !operator==(k); }
+};
+
+/**
+ * Encrypts and decrypts using the agent.
+ *
+ * Each instance uses a connection of its own, so instances may be used by
+ * different threads concurrently.
+ */
+class AgentCrypto : public Crypto {
+   private:
+    std::unique_ptr<AgentClient> _client;
+    std::string _id;
+
+   protected:
+    const EVP_CIPHER* getCipher() const;
+
+   public:
+    AgentCrypto(const std::shared_ptr<AgentKey>& key,
+                const std::string& socketPath);
+
+    SecureArray encrypt(const SecureArray& plainText);
+    SecureArray decrypt(const SecureArray& cipherText);
+};
+
+/**
+ * Crypto factory for files whose key is held by the agent.
+ */
+class AgentCryptoFactory : public AbstractCryptoFactory {
+   private:
+    std::string _socketPath;
+    std::shared_ptr<AgentKey> _key;
+
+   public:
+    AgentCryptoFactory(const std::string& socketPath, const std::string& id,
+                       const MetaData& keyingParameters);
+
+    std::shared_ptr<AbstractCryptoFactory> newFactory(
+        const SecureArray& password, const MetaData& keyingParameters) const;
+    std::unique_ptr<Crypto> crypto() const;
+    std::shared_ptr<Key> key() const { return _key; }
+    std::unique_ptr<YapetFile> file(const std::string& filename, bool create,
+                                    bool secure) const;
+};
+
+/**
+ * Get a crypto factory using the agent for \c filename.
+ *
+ * @return a null pointer if the environment variable \c
+ * SOCKET_ENVIRONMENT_VARIABLE is not set, the agent cannot be connected to,
+ * or does not hold the key of \c filename. The caller is expected to fall
+ * back to asking for the password then.
+ */
+std::shared_ptr<AbstractCryptoFactory> agentCryptoFactoryForFile(
+    const std::string& filename);
+}  // namespace agent
+}  // namespace yapet
+
+#endif
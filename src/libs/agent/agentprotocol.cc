@@ -0,0 +1,234 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <openssl/evp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "agentprotocol.hh"
+#include "consts.h"
+#include "filehelper.hh"
+#include "intl.h"
+#include "ods.hh"
+#include "yapet20file.hh"
+
+using namespace yapet;
+using namespace yapet::agent;
+
+namespace {
+#ifdef MSG_NOSIGNAL
+// A vanished peer must not kill the process by SIGPIPE
+constexpr int SEND_FLAGS{MSG_NOSIGNAL};
+#else
+constexpr int SEND_FLAGS{0};
+#endif
+
+constexpr std::uint32_t INTEGER_SIZE{sizeof(std::uint32_t)};
+
+void throwSystemError(const char* what) {
+    char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+    std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                  "%s: %s", what, std::strerror(errno));
+    throw AgentError{msg};
+}
+
+void sendFully(int fd, const std::uint8_t* data, std::size_t size) {
+    while (size > 0) {
+        auto sent = ::send(fd, data, size, SEND_FLAGS);
+        if (sent < 0) {
+            if (errno == EINTR) continue;
+            throwSystemError(_("Cannot send message to agent peer"));
+        }
+        data += sent;
+        size -= sent;
+    }
+}
+
+/**
+ * @return the number of bytes read, which is less than \c size only if the
+ * peer closed the connection.
+ */
+std::size_t receiveFully(int fd, std::uint8_t* data, std::size_t size) {
+    std::size_t total = 0;
+    while (total < size) {
+        auto received = ::recv(fd, data + total, size - total, 0);
+        if (received < 0) {
+            if (errno == EINTR) continue;
+            throwSystemError(_("Cannot receive message from agent peer"));
+        }
+        if (received == 0) break;
+        total += received;
+    }
+    return total;
+}
+
+void putInteger(std::uint8_t*& position, std::uint32_t integer) {
+    auto odsInteger = toODS(integer);
+    std::memcpy(position, &odsInteger, INTEGER_SIZE);
+    position += INTEGER_SIZE;
+}
+
+std::uint32_t getInteger(const std::uint8_t*& position,
+                         const std::uint8_t* end) {
+    if (static_cast<std::size_t>(end - position) < INTEGER_SIZE) {
+        throw AgentError{_("Truncated agent message")};
+    }
+    std::uint32_t odsInteger;
+    std::memcpy(&odsInteger, position, INTEGER_SIZE);
+    position += INTEGER_SIZE;
+    return toHost(odsInteger);
+}
+}  // namespace
+
+void yapet::agent::sendMessage(int fd, Message type, const Fields& fields) {
+    std::size_t size = 1 + INTEGER_SIZE;
+    for (const auto& field : fields) {
+        size += INTEGER_SIZE + field.size();
+    }
+    if (size > MAX_MESSAGE_SIZE) {
+        throw AgentError{_("Agent message too large")};
+    }
+
+    SecureArray message{
+        static_cast<SecureArray::size_type>(INTEGER_SIZE + size)};
+    auto position = *message;
+    putInteger(position, static_cast<std::uint32_t>(size));
+    *position++ = static_cast<std::uint8_t>(type);
+    putInteger(position, static_cast<std::uint32_t>(fields.size()));
+    for (const auto& field : fields) {
+        putInteger(position, static_cast<std::uint32_t>(field.size()));
+        if (field.size() > 0) {
+            std::memcpy(position, *field, field.size());
+            position += field.size();
+        }
+    }
+
+    sendFully(fd, *message, message.size());
+}
+
+bool yapet::agent::receiveMessage(int fd, Message& type, Fields& fields) {
+    std::uint8_t sizeBytes[INTEGER_SIZE];
+    auto received = receiveFully(fd, sizeBytes, INTEGER_SIZE);
+    if (received == 0) return false;
+    if (received < INTEGER_SIZE) {
+        throw AgentError{_("Truncated agent message")};
+    }
+
+    const std::uint8_t* sizePosition = sizeBytes;
+    auto size = getInteger(sizePosition, sizeBytes + INTEGER_SIZE);
+    if (size < 1 + INTEGER_SIZE || size > MAX_MESSAGE_SIZE) {
+        throw AgentError{_("Invalid agent message size")};
+    }
+
+    SecureArray message{static_cast<SecureArray::size_type>(size)};
+    if (receiveFully(fd, *message, size) < size) {
+        throw AgentError{_("Truncated agent message")};
+    }
+
+    const std::uint8_t* position = *message;
+    const std::uint8_t* end = position + size;
+    type = static_cast<Message>(*position++);
+    auto numberOfFields = getInteger(position, end);
+
+    fields.clear();
+    for (std::uint32_t i = 0; i < numberOfFields; i++) {
+        auto fieldSize = getInteger(position, end);
+        if (static_cast<std::size_t>(end - position) < fieldSize) {
+            throw AgentError{_("Truncated agent message")};
+        }
+        SecureArray field{static_cast<SecureArray::size_type>(fieldSize)};
+        if (fieldSize > 0) {
+            std::memcpy(*field, position, fieldSize);
+            position += fieldSize;
+        }
+        fields.push_back(std::move(field));
+    }
+
+    if (position != end) {
+        throw AgentError{_("Trailing data in agent message")};
+    }
+    return true;
+}
+
+SecureArray yapet::agent::toField(const std::string& str) {
+    return toSecureArray(reinterpret_cast<const std::uint8_t*>(str.data()),
+                         static_cast<SecureArray::size_type>(str.size()));
+}
+
+std::string yapet::agent::toString(const SecureArray& field) {
+    if (field.size() == 0) return std::string{};
+    return std::string{reinterpret_cast<const char*>(*field),
+                       static_cast<std::size_t>(field.size())};
+}
+
+std::string yapet::agent::keyId(const std::string& filename) {
+    auto file{getFile(filename, false)};
+    file->open();
+    auto identifier{file->readIdentifier()};
+
+    SecureArray expectedIdentifier{toSecureArray(
+        Yapet20File::RECOGNITION_STRING, Yapet20File::RECOGNITION_STRING_SIZE)};
+    if (identifier != expectedIdentifier) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("File '%s' is not supported by the agent"),
+                      filename.c_str());
+        throw AgentError{msg};
+    }
+
+    auto keyingParameters{identifier + file->readUnencryptedMetaData()};
+    unsigned char digest[EVP_MAX_MD_SIZE];
+    unsigned int digestLength;
+    auto result = EVP_Digest(*keyingParameters, keyingParameters.size(),
+                             digest, &digestLength, EVP_sha256(), nullptr);
+    if (result != 1) {
+        throw AgentError{_("Cannot compute key id")};
+    }
+
+    return std::string{reinterpret_cast<const char*>(digest), digestLength};
+}
+
+std::string yapet::agent::defaultSocketPath() {
+    const char* runtimeDirectory = std::getenv("XDG_RUNTIME_DIR");
+    if (runtimeDirectory != nullptr && *runtimeDirectory != '\0') {
+        return std::string{runtimeDirectory} + "/yapet-agent.socket";
+    }
+
+    return "/tmp/yapet-agent-" + std::to_string(::getuid()) +
+           "/yapet-agent.socket";
+}
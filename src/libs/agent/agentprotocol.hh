@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _AGENTPROTOCOL_HH
+#define _AGENTPROTOCOL_HH
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "securearray.hh"
+
+namespace yapet {
+namespace agent {
+/**
+ * The environment variable holding the path of the agent socket. Tools use
+ * the agent only if it is set.
+ */
+constexpr char SOCKET_ENVIRONMENT_VARIABLE[]{"YAPET_AGENT_SOCK"};
+
+/**
+ * Messages larger than this are refused, so a misbehaving peer cannot make
+ * the other side allocate arbitrary amounts of memory.
+ */
+constexpr std::uint32_t MAX_MESSAGE_SIZE{64 * 1024 * 1024};
+
+/**
+ * Message types.
+ *
+ * A request is answered by either \c SUCCESS, carrying the result, or \c
+ * FAILURE, carrying an error message.
+ */
+enum class Message : std::uint8_t {
+    SUCCESS = 0,
+    FAILURE = 1,
+    /**
+     * Fields: file name, password. Derive the key of the file, verify it
+     * against the file header and keep it.
+     */
+    ADD_KEY = 10,
+    /**
+     * Fields: key id.
+     */
+    HAS_KEY = 11,
+    /**
+     * Fields: key id, plain text. Result: cipher text.
+     */
+    ENCRYPT = 12,
+    /**
+     * Fields: key id, cipher text. Result: plain text.
+     */
+    DECRYPT = 13,
+    /**
+     * Fields: file name, pattern. Result: the serialized records of the
+     * file whose name matches the shell wildcard pattern.
+     */
+    LOOKUP = 14,
+    /**
+     * Forget all keys.
+     */
+    REMOVE_ALL = 15,
+    /**
+     * Forget all keys and terminate the agent.
+     */
+    STOP = 16
+};
+
+using Fields = std::vector<SecureArray>;
+
+/**
+ * Send a message.
+ *
+ * On the wire, a message is the size of the remainder of the message, the
+ * message type, the number of fields, and each field preceded by its size.
+ * All sizes are 32 bit integers in ODS byte order.
+ *
+ * @throw AgentError if writing to \c fd fails.
+ */
+void sendMessage(int fd, Message type, const Fields& fields = Fields{});
+
+/**
+ * Receive a message.
+ *
+ * @return \c false if the peer closed the connection before sending a
+ * message, \c true otherwise.
+ *
+ * @throw AgentError if reading from \c fd fails or the message is
+ * malformed.
+ */
+bool receiveMessage(int fd, Message& type, Fields& fields);
+
+SecureArray toField(const std::string& str);
+std::string toString(const SecureArray& field);
+
+/**
+ * The id of the key of a YAPET file.
+ *
+ * The id is the SHA-256 digest of the file identifier and the unencrypted
+ * meta data, i.e. the keying parameters including the salt. It identifies
+ * the key without revealing anything about it.
+ *
+ * @throw AgentError if \c filename is not a file the agent supports.
+ */
+std::string keyId(const std::string& filename);
+
+/**
+ * The socket path used if none has been given explicitly: \c
+ * yapet-agent.socket in \c $XDG_RUNTIME_DIR, or in a directory private to
+ * the user below \c /tmp if \c XDG_RUNTIME_DIR is not set.
+ */
+std::string defaultSocketPath();
+
+class AgentError : public std::runtime_error {
+   public:
+    AgentError(const char* msg) : runtime_error{msg} {}
+    AgentError(const std::string& msg) : runtime_error{msg} {}
+};
+}  // namespace agent
+}  // namespace yapet
+
+#endif
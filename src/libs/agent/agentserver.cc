@@ -0,0 +1,524 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <fnmatch.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+
+#include "aes256.hh"
+#include "aes256factory.hh"
+#include "agentserver.hh"
+#include "consts.h"
+#include "file.hh"
+#include "filehelper.hh"
+#include "intl.h"
+#include "logger.hh"
+#include "passwordrecord.hh"
+#include "recordlookup.hh"
+#include "yapet20file.hh"
+
+using namespace yapet;
+using namespace yapet::agent;
+
+namespace {
+/**
+ * Granularity of checking for idle keys and being stopped.
+ */
+constexpr int POLL_TIMEOUT_MS{1000};
+
+/**
+ * Crypto factory using a key held by a \c KeyStore.
+ */
+class LockedKeyFactory : public AbstractCryptoFactory {
+   private:
+    std::shared_ptr<Key> _key;
+
+   public:
+    LockedKeyFactory(KeyStore& keyStore, const std::string& id)
+        : _key{new LockedKey{keyStore, id}} {}
+
+    std::shared_ptr<AbstractCryptoFactory> newFactory(
+        const SecureArray& password, const MetaData& keyingParameters) const {
+        return std::shared_ptr<AbstractCryptoFactory>{
+            new Aes256Factory{password, keyingParameters}};
+    }
+
+    std::unique_ptr<Crypto> crypto() const {
+        return std::unique_ptr<Crypto>{new Aes256{_key}};
+    }
+
+    std::shared_ptr<Key> key() const { return _key; }
+
+    std::unique_ptr<YapetFile> file(const std::string& filename, bool create,
+                                    bool secure) const {
+        return std::unique_ptr<YapetFile>{
+            new Yapet20File{filename, create, secure}};
+    }
+};
+
+/**
+ * The size of a slot holding a zero terminated record name.
+ */
+constexpr std::size_t NAME_SLOT_SIZE{PasswordRecord::NAME_SIZE + 1};
+
+inline const char* nameOf(const LockedSlab& names, std::size_t index) {
+    return reinterpret_cast<const char*>(names.slot(index));
+}
+
+void throwSystemError(const char* what, const std::string& path) {
+    char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+    std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                  "%s '%s': %s", what, path.c_str(), std::strerror(errno));
+    throw AgentError{msg};
+}
+
+bool peerIsOwner(int fd) {
+#if defined(SO_PEERCRED)
+    struct ucred credentials;
+    socklen_t length = sizeof(credentials);
+    if (::getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &credentials, &length) !=
+        0) {
+        return false;
+    }
+    return credentials.uid == ::geteuid();
+#elif defined(HAVE_GETPEEREID)
+    uid_t uid;
+    gid_t gid;
+    if (::getpeereid(fd, &uid, &gid) != 0) {
+        return false;
+    }
+    return uid == ::geteuid();
+#else
+    // Only the permissions of the socket protect the agent
+    (void)fd;
+    return true;
+#endif
+}
+
+sockaddr_un socketAddress(const std::string& path) {
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path)) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Socket path '%s' too long"), path.c_str());
+        throw AgentError{msg};
+    }
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    return address;
+}
+
+/**
+ * Create the directory of the default socket path below /tmp, or make sure
+ * it is private to the user.
+ */
+void makePrivateDirectory(const std::string& socketPath) {
+    auto slash = socketPath.rfind('/');
+    if (slash == std::string::npos || slash == 0) return;
+    auto directory{socketPath.substr(0, slash)};
+
+    if (::mkdir(directory.c_str(), 0700) != 0 && errno != EEXIST) {
+        throwSystemError(_("Cannot create directory"), directory);
+    }
+
+    struct stat status;
+    if (::lstat(directory.c_str(), &status) != 0) {
+        throwSystemError(_("Cannot stat directory"), directory);
+    }
+    if (!S_ISDIR(status.st_mode) || status.st_uid != ::geteuid() ||
+        (status.st_mode & (S_IRWXG | S_IRWXO)) != 0) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Directory '%s' is not private to the user"),
+                      directory.c_str());
+        throw AgentError{msg};
+    }
+}
+}  // namespace
+
+constexpr std::size_t AgentServer::DEFAULT_CAPACITY;
+
+AgentServer::AgentServer(const std::string& socketPath,
+                         std::chrono::seconds idleTimeout,
+                         std::size_t capacity)
+    : _socketPath{socketPath},
+      _socket{-1},
+      _socketLinked{false},
+      _wakeup{-1, -1},
+      _keyStore{capacity, idleTimeout},
+      _fileCaches{},
+      _fileCachesMutex{},
+      _connections{},
+      _stop{false} {
+    if (_socketPath == defaultSocketPath()) {
+        makePrivateDirectory(_socketPath);
+    }
+    if (::pipe(_wakeup) != 0) {
+        throwSystemError(_("Cannot create pipe for"), _socketPath);
+    }
+    createSocket();
+}
+
+AgentServer::~AgentServer() {
+    reapConnections(true);
+    removeAll();
+
+    unlinkSocket();
+    if (_socket > -1) ::close(_socket);
+    if (_wakeup[0] > -1) ::close(_wakeup[0]);
+    if (_wakeup[1] > -1) ::close(_wakeup[1]);
+}
+
+void AgentServer::unlinkSocket() {
+    if (!_socketLinked) return;
+
+    ::unlink(_socketPath.c_str());
+    _socketLinked = false;
+}
+
+void AgentServer::stop() {
+    _stop = true;
+    // Only async-signal-safe functions may be used here
+    char wakeup = 0;
+    auto written = ::write(_wakeup[1], &wakeup, 1);
+    (void)written;
+}
+
+void AgentServer::createSocket() {
+    auto address{socketAddress(_socketPath)};
+
+    struct stat status;
+    if (::lstat(_socketPath.c_str(), &status) == 0) {
+        if (!S_ISSOCK(status.st_mode)) {
+            char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+            std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                          _("'%s' exists and is not a socket"),
+                          _socketPath.c_str());
+            throw AgentError{msg};
+        }
+
+        // Nobody answering on the socket means it has been left behind by
+        // an agent not terminated properly.
+        int probe = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        bool running =
+            probe > -1 &&
+            ::connect(probe, reinterpret_cast<sockaddr*>(&address),
+                      sizeof(address)) == 0;
+        if (probe > -1) ::close(probe);
+        if (running) {
+            char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+            std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                          _("An agent is already listening on '%s'"),
+                          _socketPath.c_str());
+            throw AgentError{msg};
+        }
+        ::unlink(_socketPath.c_str());
+    }
+
+    _socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (_socket < 0) {
+        throwSystemError(_("Cannot create socket"), _socketPath);
+    }
+
+    // The socket must not be accessible by anybody else, not even for an
+    // instant.
+    auto oldMask = ::umask(0177);
+    auto bound = ::bind(_socket, reinterpret_cast<sockaddr*>(&address),
+                        sizeof(address));
+    ::umask(oldMask);
+    if (bound != 0 || ::listen(_socket, SOMAXCONN) != 0) {
+        auto error = errno;
+        ::close(_socket);
+        _socket = -1;
+        errno = error;
+        throwSystemError(_("Cannot listen on socket"), _socketPath);
+    }
+    _socketLinked = true;
+}
+
+void AgentServer::run() {
+    LOG_MESSAGE(std::string{__func__} + ": listening on " + _socketPath);
+
+    while (!_stop) {
+        pollfd fds[2]{{_socket, POLLIN, 0}, {_wakeup[0], POLLIN, 0}};
+        auto ready = ::poll(fds, 2, POLL_TIMEOUT_MS);
+        expire();
+        reapConnections(false);
+
+        if (ready < 0 && errno != EINTR) {
+            throwSystemError(_("Cannot poll socket"), _socketPath);
+        }
+        if (ready <= 0 || _stop || !(fds[0].revents & POLLIN)) continue;
+
+        int fd = ::accept(_socket, nullptr, nullptr);
+        if (fd < 0) continue;
+
+        if (!peerIsOwner(fd)) {
+            LOG_MESSAGE(std::string{__func__} +
+                        ": refused connection of other user");
+            ::close(fd);
+            continue;
+        }
+
+        _connections.emplace_back();
+        auto& connection = _connections.back();
+        connection.fd = fd;
+        connection.done = false;
+        connection.thread =
+            std::thread{&AgentServer::serve, this, std::ref(connection)};
+    }
+
+    reapConnections(true);
+}
+
+void AgentServer::serve(Connection& connection) {
+    try {
+        Message type;
+        Fields fields;
+        while (!_stop && receiveMessage(connection.fd, type, fields)) {
+            handle(connection.fd, type, fields);
+        }
+    } catch (std::exception& ex) {
+        LOG_MESSAGE(std::string{__func__} + ": " + ex.what());
+    }
+    connection.done = true;
+}
+
+void AgentServer::reapConnections(bool all) {
+    for (auto connection = _connections.begin();
+         connection != _connections.end();) {
+        if (all) {
+            // Wakes up threads waiting for requests, while replies being
+            // sent, like the one to a request to stop, still make it.
+            ::shutdown(connection->fd, SHUT_RD);
+        } else if (!connection->done) {
+            ++connection;
+            continue;
+        }
+
+        connection->thread.join();
+        ::close(connection->fd);
+        connection = _connections.erase(connection);
+    }
+}
+
+void AgentServer::handle(int fd, Message type, const Fields& fields) {
+    Fields result;
+    try {
+        switch (type) {
+            case Message::ADD_KEY:
+                if (fields.size() != 2) break;
+                addKey(toString(fields[0]), fields[1]);
+                sendMessage(fd, Message::SUCCESS);
+                return;
+            case Message::HAS_KEY:
+                if (fields.size() != 1) break;
+                sendMessage(fd, _keyStore.has(toString(fields[0]))
+                                    ? Message::SUCCESS
+                                    : Message::FAILURE);
+                return;
+            case Message::ENCRYPT: {
+                if (fields.size() != 2) break;
+                LockedKeyFactory cryptoFactory{_keyStore, toString(fields[0])};
+                result.push_back(cryptoFactory.crypto()->encrypt(fields[1]));
+                sendMessage(fd, Message::SUCCESS, result);
+                return;
+            }
+            case Message::DECRYPT: {
+                if (fields.size() != 2) break;
+                LockedKeyFactory cryptoFactory{_keyStore, toString(fields[0])};
+                result.push_back(cryptoFactory.crypto()->decrypt(fields[1]));
+                sendMessage(fd, Message::SUCCESS, result);
+                return;
+            }
+            case Message::LOOKUP:
+                if (fields.size() != 2) break;
+                sendMessage(fd, Message::SUCCESS,
+                            lookup(toString(fields[0]), toString(fields[1])));
+                return;
+            case Message::REMOVE_ALL:
+                removeAll();
+                sendMessage(fd, Message::SUCCESS);
+                return;
+            case Message::STOP:
+                removeAll();
+                // A new agent may be started as soon as the client got the
+                // reply.
+                unlinkSocket();
+                stop();
+                sendMessage(fd, Message::SUCCESS);
+                return;
+            default:
+                break;
+        }
+        result.push_back(toField(_("Invalid agent request")));
+    } catch (std::exception& ex) {
+        result.clear();
+        result.push_back(toField(ex.what()));
+    }
+    sendMessage(fd, Message::FAILURE, result);
+}
+
+void AgentServer::expire() {
+    _keyStore.expire();
+
+    std::lock_guard<std::mutex> lock{_fileCachesMutex};
+    for (auto cache = _fileCaches.begin(); cache != _fileCaches.end();) {
+        if (_keyStore.has(cache->second->keyId)) {
+            ++cache;
+        } else {
+            cache = _fileCaches.erase(cache);
+        }
+    }
+}
+
+void AgentServer::addKey(const std::string& filename,
+                         const SecureArray& password) {
+    auto id{keyId(filename)};
+    auto keyingParameters{readMetaData(filename, false)};
+    std::shared_ptr<AbstractCryptoFactory> cryptoFactory{
+        new Aes256Factory{password, keyingParameters}};
+
+    // Opening the file verifies the password
+    YAPET::File yapetFile{cryptoFactory, filename, false, false};
+    _keyStore.add(id, cryptoFactory->key()->key(), keyingParameters);
+
+    LOG_MESSAGE(std::string{__func__} + ": added key of " + filename);
+}
+
+std::shared_ptr<const AgentServer::FileCache> AgentServer::fileCache(
+    const std::string& filename) {
+    struct stat status;
+    if (::stat(filename.c_str(), &status) != 0) {
+        throwSystemError(_("Cannot stat file"), filename);
+    }
+
+    std::lock_guard<std::mutex> lock{_fileCachesMutex};
+    auto found = _fileCaches.find(filename);
+    if (found != _fileCaches.end()) {
+        const auto& cache = *found->second;
+        if (cache.device == status.st_dev && cache.inode == status.st_ino &&
+            cache.size == status.st_size &&
+            cache.modificationSeconds == status.st_mtim.tv_sec &&
+            cache.modificationNanoseconds == status.st_mtim.tv_nsec &&
+            _keyStore.has(cache.keyId)) {
+            return found->second;
+        }
+        _fileCaches.erase(found);
+    }
+
+    std::shared_ptr<FileCache> cache{new FileCache{}};
+    cache->device = status.st_dev;
+    cache->inode = status.st_ino;
+    cache->size = status.st_size;
+    cache->modificationSeconds = status.st_mtim.tv_sec;
+    cache->modificationNanoseconds = status.st_mtim.tv_nsec;
+    cache->keyId = keyId(filename);
+
+    std::shared_ptr<AbstractCryptoFactory> cryptoFactory{
+        new LockedKeyFactory{_keyStore, cache->keyId}};
+    YAPET::File yapetFile{cryptoFactory, filename, false, false};
+    cache->records = yapetFile.readEncryptedRecords();
+    {
+        auto names{RecordLookup{cryptoFactory}.names(cache->records)};
+        cache->names.reset(new LockedSlab{names.size(), NAME_SLOT_SIZE});
+        for (std::size_t i = 0; i < names.size(); i++) {
+            std::memcpy(cache->names->slot(i), *names[i], names[i].size());
+        }
+    }
+
+    const auto& names = *cache->names;
+    cache->byName.resize(cache->records.size());
+    std::iota(cache->byName.begin(), cache->byName.end(), 0);
+    std::sort(cache->byName.begin(), cache->byName.end(),
+              [&names](std::size_t a, std::size_t b) {
+                  return std::strcmp(nameOf(names, a), nameOf(names, b)) < 0;
+              });
+
+    _fileCaches[filename] = cache;
+    LOG_MESSAGE(std::string{__func__} + ": cached " +
+                std::to_string(cache->records.size()) + " records of " +
+                filename);
+    return cache;
+}
+
+Fields AgentServer::lookup(const std::string& filename,
+                           const std::string& pattern) {
+    auto cache{fileCache(filename)};
+
+    LockedKeyFactory cryptoFactory{_keyStore, cache->keyId};
+    auto crypto{cryptoFactory.crypto()};
+
+    // Only names starting with the part of the pattern before the first
+    // special character can match.
+    auto prefix{pattern.substr(0, pattern.find_first_of("*?[\\"))};
+    const auto& names = *cache->names;
+    auto first = std::lower_bound(
+        cache->byName.begin(), cache->byName.end(), prefix,
+        [&names](std::size_t index, const std::string& p) {
+            return std::strcmp(nameOf(names, index), p.c_str()) < 0;
+        });
+
+    std::vector<std::size_t> found;
+    for (auto index = first; index != cache->byName.end(); ++index) {
+        auto name = nameOf(names, *index);
+        if (std::strncmp(name, prefix.c_str(), prefix.size()) != 0) break;
+        if (::fnmatch(pattern.c_str(), name, 0) == 0) {
+            found.push_back(*index);
+        }
+    }
+    std::sort(found.begin(), found.end());
+
+    Fields result;
+    for (auto index : found) {
+        result.push_back(crypto->decrypt(cache->records[index]));
+    }
+    return result;
+}
+
+void AgentServer::removeAll() {
+    _keyStore.clear();
+
+    std::lock_guard<std::mutex> lock{_fileCachesMutex};
+    _fileCaches.clear();
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _AGENTSERVER_HH
+#define _AGENTSERVER_HH
+
+#include <sys/types.h>
+
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "agentprotocol.hh"
+#include "keystore.hh"
+#include "lockedslab.hh"
+#include "securearray.hh"
+
+namespace yapet {
+namespace agent {
+/**
+ * The agent caching keys of YAPET files.
+ *
+ * It listens on a UNIX domain socket accessible by the user only, and
+ * accepts connections of processes of the same user only. Each connection
+ * is served by a thread of its own.
+ *
+ * Besides the keys, the agent keeps the encrypted records and the decrypted
+ * record names of the files looked up, so looking up records in a file not
+ * modified in the meantime decrypts the records found only. The names are
+ * kept in a \c LockedSlab, which is zeroed when they are dropped along with
+ * the key. They are kept in order, so only the names starting with the
+ * literal prefix of a pattern are matched against it.
+ */
+class AgentServer {
+   public:
+    static constexpr std::size_t DEFAULT_CAPACITY{16};
+
+   private:
+    struct FileCache {
+        dev_t device;
+        ino_t inode;
+        off_t size;
+        time_t modificationSeconds;
+        long modificationNanoseconds;
+        std::string keyId;
+        std::vector<SecureArray> records;
+        // Slot i holds the zero terminated name of record i
+        std::unique_ptr<LockedSlab> names;
+        // Indices of the records ordered by name
+        std::vector<std::size_t> byName;
+    };
+
+    struct Connection {
+        int fd;
+        std::thread thread;
+        std::atomic<bool> done;
+    };
+
+    std::string _socketPath;
+    int _socket;
+    bool _socketLinked;
+    // Self pipe waking up run() when stopped
+    int _wakeup[2];
+    KeyStore _keyStore;
+    std::map<std::string, std::shared_ptr<const FileCache>> _fileCaches;
+    std::mutex _fileCachesMutex;
+    std::list<Connection> _connections;
+    std::atomic<bool> _stop;
+
+    void createSocket();
+    void unlinkSocket();
+    void serve(Connection& connection);
+    void handle(int fd, Message type, const Fields& fields);
+    void expire();
+    void reapConnections(bool all);
+
+    void addKey(const std::string& filename, const SecureArray& password);
+    std::shared_ptr<const FileCache> fileCache(const std::string& filename);
+    Fields lookup(const std::string& filename, const std::string& pattern);
+    void removeAll();
+
+   public:
+    /**
+     * Create the socket of the agent.
+     *
+     * @param socketPath the path of the socket. A stale socket at that path
+     * is removed.
+     *
+     * @param idleTimeout the time keys not used are kept. Zero keeps keys
+     * until they are removed explicitly.
+     *
+     * @throw AgentError if the socket cannot be created, or another agent
+     * listens on it already.
+     */
+    AgentServer(const std::string& socketPath,
+                std::chrono::seconds idleTimeout,
+                std::size_t capacity = DEFAULT_CAPACITY);
+    ~AgentServer();
+
+    AgentServer(const AgentServer&) = delete;
+    AgentServer(AgentServer&&) = delete;
+    AgentServer& operator=(const AgentServer&) = delete;
+    AgentServer& operator=(AgentServer&&) = delete;
+
+    /**
+     * Serve connections until a client asks the agent to stop, or \c stop()
+     * has been called.
+     */
+    void run();
+
+    /**
+     * Make \c run() return. May be called from a signal handler.
+     */
+    void stop();
+
+    const std::string& socketPath() const { return _socketPath; }
+    bool keysLocked() const { return _keyStore.locked(); }
+};
+}  // namespace agent
+}  // namespace yapet
+
+#endif
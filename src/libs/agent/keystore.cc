@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdexcept>
+#include <typeinfo>
+
+#include "agentprotocol.hh"
+#include "intl.h"
+#include "keystore.hh"
+
+using namespace yapet;
+using namespace yapet::agent;
+
+constexpr std::size_t KeyStore::SLOT_SIZE;
+
+KeyStore::KeyStore(std::size_t capacity, std::chrono::seconds idleTimeout)
+    : _idleTimeout{idleTimeout}, _keys{capacity, SLOT_SIZE}, _mutex{} {
+    if (capacity == 0) {
+        throw std::invalid_argument{_("Key store capacity must not be zero")};
+    }
+}
+
+KeyStore::~KeyStore() {}
+
+LockedLru<MetaData>::iterator KeyStore::findOrThrow(const std::string& id,
+                                                    Clock::time_point now) {
+    auto entry = _keys.find(id);
+    if (entry == _keys.end()) {
+        throw AgentError{_("The agent does not hold the key")};
+    }
+
+    if (_idleTimeout != Clock::duration::zero() &&
+        now - entry->lastUsed > _idleTimeout) {
+        _keys.erase(entry);
+        throw AgentError{_("The agent does not hold the key")};
+    }
+    return entry;
+}
+
+void KeyStore::add(const std::string& id, const SecureArray& key,
+                   const MetaData& keyingParameters) {
+    add(id, key, keyingParameters, Clock::now());
+}
+
+void KeyStore::add(const std::string& id, const SecureArray& key,
+                   const MetaData& keyingParameters, Clock::time_point now) {
+    if (key.size() != static_cast<SecureArray::size_type>(SLOT_SIZE)) {
+        throw AgentError{_("Key size not supported by the agent")};
+    }
+
+    std::lock_guard<std::mutex> lock{_mutex};
+    _keys.store(id, *key, SLOT_SIZE, now, keyingParameters);
+}
+
+bool KeyStore::has(const std::string& id) { return has(id, Clock::now()); }
+
+bool KeyStore::has(const std::string& id, Clock::time_point now) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    try {
+        findOrThrow(id, now);
+        return true;
+    } catch (AgentError&) {
+        return false;
+    }
+}
+
+SecureArray KeyStore::key(const std::string& id) {
+    return key(id, Clock::now());
+}
+
+SecureArray KeyStore::key(const std::string& id, Clock::time_point now) {
+    SecureArray copy;
+    useKey(
+        id,
+        [&copy](const std::uint8_t* key) {
+            copy = toSecureArray(key, SLOT_SIZE);
+        },
+        now);
+    return copy;
+}
+
+void KeyStore::useKey(
+    const std::string& id,
+    const std::function<void(const std::uint8_t* key)>& use) {
+    useKey(id, use, Clock::now());
+}
+
+void KeyStore::useKey(const std::string& id,
+                      const std::function<void(const std::uint8_t* key)>& use,
+                      Clock::time_point now) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto entry = findOrThrow(id, now);
+    _keys.touch(entry, now);
+
+    use(_keys.data(entry));
+}
+
+MetaData KeyStore::keyingParameters(const std::string& id) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return findOrThrow(id, Clock::now())->value;
+}
+
+std::vector<std::string> KeyStore::expire() { return expire(Clock::now()); }
+
+std::vector<std::string> KeyStore::expire(Clock::time_point now) {
+    std::vector<std::string> dropped;
+    if (_idleTimeout == Clock::duration::zero()) return dropped;
+
+    std::lock_guard<std::mutex> lock{_mutex};
+    while (!_keys.empty() &&
+           now - _keys.leastRecentlyUsed()->lastUsed > _idleTimeout) {
+        dropped.push_back(_keys.leastRecentlyUsed()->key);
+        _keys.erase(_keys.leastRecentlyUsed());
+    }
+    return dropped;
+}
+
+void KeyStore::clear() {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _keys.clear();
+}
+
+std::size_t KeyStore::size() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _keys.size();
+}
+
+LockedKey::LockedKey(KeyStore& keyStore, const std::string& id)
+    : _keyStore{keyStore},
+      _id{id},
+      _keyingParameters{keyStore.keyingParameters(id)} {}
+
+void LockedKey::keyingParameters(const MetaData&) {
+    throw AgentError{_("Keys held by the agent cannot be changed")};
+}
+
+void LockedKey::password(const SecureArray&) {
+    throw AgentError{_("Keys held by the agent cannot be changed")};
+}
+
+bool LockedKey::operator==(const Key& k) const {
+    if (typeid(k) != typeid(*this)) {
+        return false;
+    }
+
+    auto& other = dynamic_cast<const LockedKey&>(k);
+    return &_keyStore == &other._keyStore && _id == other._id;
+}
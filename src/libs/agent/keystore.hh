@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _KEYSTORE_HH
+#define _KEYSTORE_HH
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "key.hh"
+#include "lockedlru.hh"
+#include "metadata.hh"
+#include "securearray.hh"
+
+namespace yapet {
+namespace agent {
+/**
+ * The keys held by the agent.
+ *
+ * Keys are kept in a \c LockedLru, so they are locked into memory if
+ * possible, excluded from core dumps and zeroed whenever a key is dropped. Keys are identified by the id
+ * computed by \c keyId().
+ *
+ * Keys not used for longer than the idle timeout are dropped. If the store
+ * is full, adding a key drops the least recently used key.
+ *
+ * The store is safe to be used by several threads.
+ */
+class KeyStore {
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * The size of a slot holding a key.
+     */
+    static constexpr std::size_t SLOT_SIZE{32};
+
+   private:
+    Clock::duration _idleTimeout;
+    // Keyed by the id, holding the keying parameters along with the key
+    LockedLru<MetaData> _keys;
+    mutable std::mutex _mutex;
+
+    LockedLru<MetaData>::iterator findOrThrow(const std::string& id,
+                                              Clock::time_point now);
+
+   public:
+    /**
+     * @param capacity the number of keys held. Must not be zero.
+     *
+     * @param idleTimeout the time keys not used are kept. Zero keeps keys
+     * until they are removed explicitly.
+     */
+    KeyStore(std::size_t capacity, std::chrono::seconds idleTimeout);
+    ~KeyStore();
+
+    KeyStore(const KeyStore&) = delete;
+    KeyStore(KeyStore&&) = delete;
+    KeyStore& operator=(const KeyStore&) = delete;
+    KeyStore& operator=(KeyStore&&) = delete;
+
+    /**
+     * Add the key \c key with the id \c id, replacing a key with the same
+     * id.
+     *
+     * @throw AgentError if \c key does not fit into a slot.
+     */
+    void add(const std::string& id, const SecureArray& key,
+             const MetaData& keyingParameters);
+    void add(const std::string& id, const SecureArray& key,
+             const MetaData& keyingParameters, Clock::time_point now);
+
+    bool has(const std::string& id);
+    bool has(const std::string& id, Clock::time_point now);
+
+    /**
+     * Get a copy of the key with the id \c id. Counts as use of the key.
+     *
+     * @throw AgentError if the store does not hold the key.
+     */
+    SecureArray key(const std::string& id);
+    SecureArray key(const std::string& id, Clock::time_point now);
+
+    /**
+     * Call \c use with a pointer to the key with the id \c id, in the
+     * locked memory of the store. The store is locked during the call, so
+     * the key cannot be dropped meanwhile. Counts as use of the key.
+     *
+     * @throw AgentError if the store does not hold the key.
+     */
+    void useKey(const std::string& id,
+                const std::function<void(const std::uint8_t* key)>& use);
+    void useKey(const std::string& id,
+                const std::function<void(const std::uint8_t* key)>& use,
+                Clock::time_point now);
+
+    /**
+     * @throw AgentError if the store does not hold the key.
+     */
+    MetaData keyingParameters(const std::string& id);
+
+    /**
+     * Drop the keys idle for longer than the idle timeout.
+     *
+     * @return the ids of the keys dropped.
+     */
+    std::vector<std::string> expire();
+    std::vector<std::string> expire(Clock::time_point now);
+
+    /**
+     * Drop all keys.
+     */
+    void clear();
+
+    std::size_t size() const;
+    std::size_t capacity() const { return _keys.capacity(); }
+
+    /**
+     * Whether or not the memory holding keys could be locked into memory.
+     */
+    bool locked() const { return _keys.locked(); }
+};
+
+/**
+ * A key held by a \c KeyStore.
+ *
+ * It does not hold the key itself, but uses the key in the memory of the
+ * store whenever the key is used, so a key dropped from the store cannot be
+ * used anymore. Ciphers use \c useKey(), which does not copy the key.
+ */
+class LockedKey : public Key {
+   private:
+    KeyStore& _keyStore;
+    std::string _id;
+    MetaData _keyingParameters;
+
+   public:
+    /**
+     * @throw AgentError if \c keyStore does not hold the key \c id.
+     */
+    LockedKey(KeyStore& keyStore, const std::string& id);
+
+    /**
+     * Keys held by the store cannot be changed.
+     *
+     * @throw AgentError always.
+     */
+    void keyingParameters(const MetaData& parameters);
+    const MetaData& keyingParameters() const { return _keyingParameters; }
+    /**
+     * Keys held by the store cannot be changed.
+     *
+     * @throw AgentError always.
+     */
+    void password(const SecureArray& password);
+
+    SecureArray key() const { return _keyStore.key(_id); }
+    SecureArray::size_type keySize() const { return KeyStore::SLOT_SIZE; }
+    virtual void useKey(
+        const std::function<void(const std::uint8_t* key)>& use) const {
+        _keyStore.useKey(_id, use);
+    }
+
+    SecureArray ivec() const { return SecureArray{}; }
+    SecureArray::size_type ivecSize() const { return 0; }
+
+    bool operator==(const Key& k) const;
+    bool operator!=(const Key& k) const { return !operator==(k); }
+};
+}  // namespace agent
+}  // namespace yapet
+
+#endif
@@ -0,0 +1,353 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <openssl/evp.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#include "breachcorpus.hh"
+#include "consts.h"
+#include "cryptoerror.hh"
+#include "fileerror.hh"
+#include "fileutils.hh"
+#include "intl.h"
+#include "logger.hh"
+
+using namespace yapet::audit;
+
+namespace {
+constexpr char INDEX_MAGIC[]{"YAPETBX1"};
+constexpr std::size_t INDEX_MAGIC_SIZE{sizeof(INDEX_MAGIC) - 1};
+constexpr std::size_t INDEX_HEADER_SIZE{INDEX_MAGIC_SIZE +
+                                        sizeof(std::uint64_t)};
+constexpr std::size_t INDEX_SIZE{
+    INDEX_HEADER_SIZE +
+    (BreachCorpus::NUMBER_OF_PREFIXES + 1) * sizeof(std::uint64_t)};
+
+constexpr std::size_t HEX_DIGEST_LENGTH{BreachCorpus::DIGEST_SIZE * 2};
+constexpr std::size_t CONVERT_BUFFER_SIZE{1 << 20};
+
+inline std::uint32_t prefixOf(const std::uint8_t* digest) {
+    return (static_cast<std::uint32_t>(digest[0]) << 12) |
+           (static_cast<std::uint32_t>(digest[1]) << 4) | (digest[2] >> 4);
+}
+
+inline int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+bool parseHexDigest(const std::string& line, BreachCorpus::Sha1Digest& digest) {
+    if (line.size() < HEX_DIGEST_LENGTH) return false;
+    if (line.size() > HEX_DIGEST_LENGTH && line[HEX_DIGEST_LENGTH] != ':' &&
+        line[HEX_DIGEST_LENGTH] != '\r') {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < BreachCorpus::DIGEST_SIZE; i++) {
+        auto high = hexValue(line[2 * i]);
+        auto low = hexValue(line[2 * i + 1]);
+        if (high < 0 || low < 0) return false;
+        digest[i] = static_cast<std::uint8_t>((high << 4) | low);
+    }
+    return true;
+}
+
+[[noreturn]] void throwConversionError(const char* format,
+                                       std::uint64_t lineNumber) {
+    char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+    std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE, format,
+                  static_cast<unsigned long long>(lineNumber));
+    throw yapet::FileFormatError{msg};
+}
+}  // namespace
+
+BreachCorpus::BreachCorpus(const std::string& filename)
+    : _corpus{filename, MappedFile::Access::RANDOM},
+      _numberOfDigests{_corpus.size() / DIGEST_SIZE},
+      _storedIndex{},
+      _builtIndex{},
+      _index{nullptr} {
+    if (_corpus.size() % DIGEST_SIZE != 0) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("'%s' is not a breached password corpus"),
+                      filename.c_str());
+        throw FileFormatError{msg};
+    }
+
+    auto indexFile{indexFilename(filename)};
+    if (!loadIndex(indexFile)) {
+        buildIndex();
+        storeIndex(indexFile);
+    }
+}
+
+std::uint32_t BreachCorpus::prefixAt(std::uint64_t position) const {
+    return prefixOf(_corpus.data() + position * DIGEST_SIZE);
+}
+
+/**
+ * Return the position of the first digest having a prefix not less than \c
+ * prefix. All digests before \c first are known to have a smaller prefix.
+ *
+ * SHA-1 digests are uniformly distributed, so the position is estimated by
+ * interpolation and then narrowed down by galloping from the estimate. This
+ * touches only a few pages of the corpus per prefix.
+ */
+std::uint64_t BreachCorpus::lowerBound(std::uint32_t prefix,
+                                       std::uint64_t first) const {
+    std::uint64_t estimate = (_numberOfDigests * prefix) >> PREFIX_BITS;
+    if (estimate < first) estimate = first;
+
+    // Invariant: digests in [first, low) have a smaller prefix, digests in
+    // [high, _numberOfDigests) do not.
+    std::uint64_t low = first;
+    std::uint64_t high = _numberOfDigests;
+    std::uint64_t step = 1;
+    if (estimate < _numberOfDigests && prefixAt(estimate) >= prefix) {
+        high = estimate;
+        while (high - first > step) {
+            auto probe = high - step;
+            if (prefixAt(probe) < prefix) {
+                low = probe + 1;
+                break;
+            }
+            high = probe;
+            step *= 2;
+        }
+    } else {
+        low = estimate < _numberOfDigests ? estimate + 1 : _numberOfDigests;
+        while (low + step < _numberOfDigests) {
+            auto probe = low + step;
+            if (prefixAt(probe) >= prefix) {
+                high = probe;
+                break;
+            }
+            low = probe + 1;
+            step *= 2;
+        }
+    }
+
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (prefixAt(middle) < prefix) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+bool BreachCorpus::loadIndex(const std::string& indexFilename) {
+    try {
+        if (yapet::getModificationTime(indexFilename) <
+            yapet::getModificationTime(_corpus.filename())) {
+            LOG_MESSAGE(std::string{__func__} + ": stale index " +
+                        indexFilename);
+            return false;
+        }
+
+        std::unique_ptr<MappedFile> index{new MappedFile{indexFilename}};
+        if (index->size() != INDEX_SIZE ||
+            std::memcmp(index->data(), INDEX_MAGIC, INDEX_MAGIC_SIZE) != 0) {
+            LOG_MESSAGE(std::string{__func__} + ": invalid index " +
+                        indexFilename);
+            return false;
+        }
+
+        std::uint64_t numberOfDigests;
+        std::memcpy(&numberOfDigests, index->data() + INDEX_MAGIC_SIZE,
+                    sizeof(numberOfDigests));
+        auto offsets = reinterpret_cast<const std::uint64_t*>(
+            index->data() + INDEX_HEADER_SIZE);
+        if (numberOfDigests != _numberOfDigests ||
+            offsets[NUMBER_OF_PREFIXES] != _numberOfDigests) {
+            LOG_MESSAGE(std::string{__func__} + ": index does not match " +
+                        _corpus.filename());
+            return false;
+        }
+
+        _storedIndex = std::move(index);
+        _index = offsets;
+        return true;
+    } catch (FileError&) {
+        return false;
+    }
+}
+
+void BreachCorpus::buildIndex() {
+    LOG_MESSAGE(std::string{__func__} + ": build index for " +
+                _corpus.filename());
+    _builtIndex.resize(NUMBER_OF_PREFIXES + 1);
+
+    std::uint64_t position = 0;
+    for (std::uint32_t prefix = 0; prefix < NUMBER_OF_PREFIXES; prefix++) {
+        position = lowerBound(prefix, position);
+        _builtIndex[prefix] = position;
+    }
+    _builtIndex[NUMBER_OF_PREFIXES] = _numberOfDigests;
+
+    _index = _builtIndex.data();
+}
+
+/**
+ * Store the index, so that the next instance can map it instead of building
+ * it. Failing to do so, e.g. because the corpus is in a read-only location,
+ * is not an error.
+ *
+ * The index is a cache local to the machine, and uses the host byte order.
+ */
+void BreachCorpus::storeIndex(const std::string& indexFilename) const {
+    std::string temporaryFilename{indexFilename + ".tmp"};
+    std::FILE* file = std::fopen(temporaryFilename.c_str(), "wb");
+    if (file == nullptr) {
+        LOG_MESSAGE(std::string{__func__} + ": cannot create " +
+                    temporaryFilename);
+        return;
+    }
+
+    bool success =
+        std::fwrite(INDEX_MAGIC, INDEX_MAGIC_SIZE, 1, file) == 1 &&
+        std::fwrite(&_numberOfDigests, sizeof(_numberOfDigests), 1, file) ==
+            1 &&
+        std::fwrite(_index, sizeof(std::uint64_t), NUMBER_OF_PREFIXES + 1,
+                    file) == NUMBER_OF_PREFIXES + 1;
+    success = std::fclose(file) == 0 && success;
+
+    if (!success ||
+        std::rename(temporaryFilename.c_str(), indexFilename.c_str()) != 0) {
+        LOG_MESSAGE(std::string{__func__} + ": cannot write " +
+                    indexFilename);
+        std::remove(temporaryFilename.c_str());
+    }
+}
+
+bool BreachCorpus::contains(const Sha1Digest& digest) const {
+    auto prefix = prefixOf(digest.data());
+    auto low = _index[prefix];
+    auto high = _index[prefix + 1];
+
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        auto result = std::memcmp(_corpus.data() + middle * DIGEST_SIZE,
+                                  digest.data(), DIGEST_SIZE);
+        if (result == 0) return true;
+        if (result < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return false;
+}
+
+bool BreachCorpus::containsPassword(const std::uint8_t* password,
+                                    std::size_t length) const {
+    return contains(sha1(password, length));
+}
+
+BreachCorpus::Sha1Digest BreachCorpus::sha1(const std::uint8_t* data,
+                                            std::size_t length) {
+    Sha1Digest digest;
+    unsigned int digestLength = digest.size();
+
+    auto result = EVP_Digest(data, length, digest.data(), &digestLength,
+                             EVP_sha1(), nullptr);
+    if (result != 1 || digestLength != digest.size()) {
+        LOG_MESSAGE(std::string{__func__} + ": SHA-1 failure");
+        throw HashError{_("Cannot compute digest")};
+    }
+
+    return digest;
+}
+
+std::uint64_t BreachCorpus::convert(std::istream& hibpText,
+                                    const std::string& corpusFilename) {
+    std::FILE* corpus = std::fopen(corpusFilename.c_str(), "wb");
+    if (corpus == nullptr) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Cannot open '%s'"), corpusFilename.c_str());
+        throw FileError{msg, errno};
+    }
+    std::unique_ptr<std::FILE, int (*)(std::FILE*)> corpusCloser{corpus,
+                                                                  std::fclose};
+    std::setvbuf(corpus, nullptr, _IOFBF, CONVERT_BUFFER_SIZE);
+
+    std::uint64_t lineNumber = 0;
+    std::uint64_t numberOfDigests = 0;
+    Sha1Digest previous;
+    Sha1Digest current;
+    std::string line;
+    while (std::getline(hibpText, line)) {
+        lineNumber++;
+        if (line.empty() || line == "\r") continue;
+
+        if (!parseHexDigest(line, current)) {
+            throwConversionError(_("Line %llu does not start with a SHA-1 digest"),
+                                 lineNumber);
+        }
+        if (numberOfDigests > 0 &&
+            std::memcmp(previous.data(), current.data(), DIGEST_SIZE) >= 0) {
+            throwConversionError(_("Line %llu is not sorted in ascending order"),
+                                 lineNumber);
+        }
+
+        if (std::fwrite(current.data(), DIGEST_SIZE, 1, corpus) != 1) {
+            char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+            std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                          _("Error writing to '%s'"), corpusFilename.c_str());
+            throw FileError{msg, errno};
+        }
+        previous = current;
+        numberOfDigests++;
+    }
+
+    if (std::fclose(corpusCloser.release()) != 0) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Error writing to '%s'"), corpusFilename.c_str());
+        throw FileError{msg, errno};
+    }
+
+    // An index of a previous corpus is stale now
+    std::remove(indexFilename(corpusFilename).c_str());
+
+    return numberOfDigests;
+}
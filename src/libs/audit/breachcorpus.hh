@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _BREACHCORPUS_HH
+#define _BREACHCORPUS_HH
+
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mappedfile.hh"
+
+namespace yapet {
+namespace audit {
+/**
+ * Offline corpus of breached passwords.
+ *
+ * The corpus is a file of binary SHA-1 digests, 20 bytes each, sorted in
+ * ascending order, as produced by \c convert() from the plain text SHA-1
+ * list of Have I Been Pwned. It is memory mapped, never read into memory.
+ *
+ * Lookups use a prefix index mapping the first \c PREFIX_BITS bits of a
+ * digest to the first digest in the corpus having that prefix, so a lookup
+ * is a binary search within one small bucket. The index is built on first
+ * use and stored next to the corpus in a file with suffix \c .idx, if
+ * possible.
+ *
+ * Lookups are thread safe.
+ */
+class BreachCorpus {
+   public:
+    static constexpr int DIGEST_SIZE = 20;
+    static constexpr int PREFIX_BITS = 20;
+    static constexpr std::uint64_t NUMBER_OF_PREFIXES = 1 << PREFIX_BITS;
+
+    using Sha1Digest = std::array<std::uint8_t, DIGEST_SIZE>;
+
+   private:
+    MappedFile _corpus;
+    std::uint64_t _numberOfDigests;
+    std::unique_ptr<MappedFile> _storedIndex;
+    std::vector<std::uint64_t> _builtIndex;
+    const std::uint64_t* _index;
+
+    std::uint32_t prefixAt(std::uint64_t position) const;
+    std::uint64_t lowerBound(std::uint32_t prefix, std::uint64_t first) const;
+
+    bool loadIndex(const std::string& indexFilename);
+    void buildIndex();
+    void storeIndex(const std::string& indexFilename) const;
+
+   public:
+    BreachCorpus(const std::string& filename);
+    BreachCorpus(const BreachCorpus&) = delete;
+    BreachCorpus& operator=(const BreachCorpus&) = delete;
+    ~BreachCorpus() {}
+
+    std::uint64_t size() const { return _numberOfDigests; }
+
+    bool contains(const Sha1Digest& digest) const;
+    bool containsPassword(const std::uint8_t* password,
+                          std::size_t length) const;
+
+    static Sha1Digest sha1(const std::uint8_t* data, std::size_t length);
+
+    static std::string indexFilename(const std::string& corpusFilename) {
+        return corpusFilename + ".idx";
+    }
+
+    /**
+     * Convert the Have I Been Pwned SHA-1 list to a corpus file.
+     *
+     * Each line of \c hibpText holds a hexadecimal SHA-1 digest, optionally
+     * followed by a colon and the breach count, which is ignored. The lines
+     * have to be sorted by digest, which is the order the list is published
+     * in.
+     *
+     * @return the number of digests written.
+     */
+    static std::uint64_t convert(std::istream& hibpText,
+                                 const std::string& corpusFilename);
+};
+}  // namespace audit
+}  // namespace yapet
+
+#endif
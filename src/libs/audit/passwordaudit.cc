@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/rand.h>
+
+#include <cstring>
+#include <unordered_map>
+
+#include "cryptoerror.hh"
+#include "intl.h"
+#include "logger.hh"
+#include "parallel.hh"
+#include "passwordaudit.hh"
+#include "passwordrecord.hh"
+
+using namespace yapet::audit;
+
+namespace {
+constexpr int SSL_SUCCESS{1};
+constexpr int DIGEST_KEY_SIZE{32};
+
+struct DigestHash {
+    std::size_t operator()(const Digest& digest) const {
+        // The digest is uniformly distributed, any part of it makes a good
+        // hash value.
+        std::size_t hash;
+        std::memcpy(&hash, digest.data(), sizeof(hash));
+        return hash;
+    }
+};
+
+/**
+ * Digests of one record, computed by the worker threads.
+ */
+struct RecordDigests {
+    Digest name;
+    Digest password;
+    Digest account;
+    bool emptyPassword;
+    bool emptyAccount;
+    bool breached;
+};
+
+inline std::size_t fieldLength(const std::uint8_t* field, std::size_t size) {
+    return ::strnlen(reinterpret_cast<const char*>(field), size);
+}
+
+/**
+ * Collect the indices sharing the same digest into groups. Only groups with
+ * more than one member are returned, in the order of their first member.
+ */
+class Grouper {
+   private:
+    std::unordered_map<Digest, std::size_t, DigestHash> _groupByDigest;
+    std::vector<RecordGroup> _groups;
+
+   public:
+    Grouper(std::size_t expectedSize) { _groupByDigest.reserve(expectedSize); }
+
+    void add(const Digest& digest, std::size_t index) {
+        auto inserted = _groupByDigest.emplace(digest, _groups.size());
+        if (inserted.second) {
+            _groups.emplace_back();
+        }
+        _groups[inserted.first->second].push_back(index);
+    }
+
+    std::vector<RecordGroup> groups() {
+        std::vector<RecordGroup> result;
+        for (auto& group : _groups) {
+            if (group.size() > 1) {
+                result.push_back(std::move(group));
+            }
+        }
+        return result;
+    }
+};
+}  // namespace
+
+PasswordAudit::PasswordAudit(
+    std::shared_ptr<AbstractCryptoFactory> cryptoFactory)
+    : _cryptoFactory{cryptoFactory},
+      _digestKey{DIGEST_KEY_SIZE},
+      _breachCorpus{},
+      _strengthEstimator{},
+      _minimumScore{0} {
+    auto result = RAND_bytes(*_digestKey, _digestKey.size());
+    if (result != SSL_SUCCESS) {
+        LOG_MESSAGE(std::string{__func__} + ": Cannot generate digest key");
+        throw HashError{_("Cannot generate random digest key")};
+    }
+}
+
+Digest PasswordAudit::digest(const std::uint8_t* data,
+                             std::size_t length) const {
+    Digest digest;
+    unsigned int digestLength = digest.size();
+
+    auto result = HMAC(EVP_sha256(), *_digestKey, _digestKey.size(), data,
+                       length, digest.data(), &digestLength);
+    if (result == nullptr || digestLength != digest.size()) {
+        LOG_MESSAGE(std::string{__func__} + ": HMAC failure");
+        throw HashError{_("Cannot compute digest")};
+    }
+
+    return digest;
+}
+
+AuditReport PasswordAudit::audit(
+    const std::vector<SecureArray>& encryptedRecords) const {
+    auto numberOfRecords = encryptedRecords.size();
+
+    AuditReport report;
+    report.names.resize(numberOfRecords);
+    std::vector<RecordDigests> digests(numberOfRecords);
+    if (_strengthEstimator) {
+        report.strengths.resize(numberOfRecords);
+    }
+
+    parallelFor(numberOfRecords, [this, &encryptedRecords, &report, &digests](
+                                     unsigned int, std::size_t begin,
+                                     std::size_t end) {
+        auto crypto{_cryptoFactory->crypto()};
+
+        for (auto i = begin; i < end; i++) {
+            PasswordRecord record{crypto->decrypt(encryptedRecords[i])};
+            RecordDigests& recordDigests = digests[i];
+
+            auto nameLength =
+                fieldLength(record.name(), PasswordRecord::NAME_SIZE);
+            report.names[i].assign(reinterpret_cast<const char*>(record.name()),
+                                   nameLength);
+            recordDigests.name = digest(record.name(), nameLength);
+
+            auto passwordLength =
+                fieldLength(record.password(), PasswordRecord::PASSWORD_SIZE);
+            recordDigests.emptyPassword = passwordLength == 0;
+            recordDigests.password = digest(record.password(), passwordLength);
+            recordDigests.breached =
+                _breachCorpus && passwordLength > 0 &&
+                _breachCorpus->containsPassword(record.password(),
+                                                passwordLength);
+            if (_strengthEstimator) {
+                report.strengths[i] = _strengthEstimator->estimate(
+                    record.password(), static_cast<int>(passwordLength));
+            }
+
+            auto hostLength =
+                fieldLength(record.host(), PasswordRecord::HOST_SIZE);
+            auto usernameLength =
+                fieldLength(record.username(), PasswordRecord::USERNAME_SIZE);
+            recordDigests.emptyAccount = hostLength == 0 || usernameLength == 0;
+
+            // Host and user name are separated by a zero byte, which cannot
+            // be part of either of them.
+            SecureArray account{static_cast<SecureArray::size_type>(
+                hostLength + 1 + usernameLength)};
+            std::memcpy(*account, record.host(), hostLength);
+            (*account)[hostLength] = '\0';
+            std::memcpy(*account + hostLength + 1, record.username(),
+                        usernameLength);
+            recordDigests.account = digest(*account, account.size());
+        }
+    });
+
+    Grouper passwords{numberOfRecords};
+    Grouper names{numberOfRecords};
+    Grouper accounts{numberOfRecords};
+    for (std::size_t i = 0; i < numberOfRecords; i++) {
+        const RecordDigests& recordDigests = digests[i];
+
+        names.add(recordDigests.name, i);
+
+        if (recordDigests.emptyPassword) {
+            report.emptyPasswords.push_back(i);
+        } else {
+            passwords.add(recordDigests.password, i);
+        }
+
+        if (!recordDigests.emptyAccount) {
+            accounts.add(recordDigests.account, i);
+        }
+
+        if (recordDigests.breached) {
+            report.breachedPasswords.push_back(i);
+        }
+
+        if (_strengthEstimator && !recordDigests.emptyPassword &&
+            report.strengths[i].score < _minimumScore) {
+            report.weakPasswords.push_back(i);
+        }
+    }
+
+    report.reusedPasswords = passwords.groups();
+    report.duplicateNames = names.groups();
+    report.duplicateAccounts = accounts.groups();
+
+    LOG_MESSAGE(std::string{__func__} + ": audited " +
+                std::to_string(numberOfRecords) + " records");
+    return report;
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _PASSWORDAUDIT_HH
+#define _PASSWORDAUDIT_HH
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstractcryptofactory.hh"
+#include "breachcorpus.hh"
+#include "securearray.hh"
+#include "strengthestimator.hh"
+
+namespace yapet {
+namespace audit {
+/**
+ * Keyed digest of a record field.
+ */
+using Digest = std::array<std::uint8_t, 32>;
+
+/**
+ * Indices of records, in the order they are stored in the file, sharing the
+ * same property.
+ */
+using RecordGroup = std::vector<std::size_t>;
+
+/**
+ * The findings of an audit.
+ *
+ * Only record names are kept. Passwords, hosts and user names are compared
+ * by their keyed digests and never leave the worker threads in plain text.
+ */
+struct AuditReport {
+    /**
+     * The names of all audited records. Indices in the groups below refer to
+     * this vector.
+     */
+    std::vector<std::string> names;
+    /**
+     * Groups of records sharing the same, non-empty password.
+     */
+    std::vector<RecordGroup> reusedPasswords;
+    /**
+     * Groups of records having the same name.
+     */
+    std::vector<RecordGroup> duplicateNames;
+    /**
+     * Groups of records having the same, non-empty host and user name.
+     */
+    std::vector<RecordGroup> duplicateAccounts;
+    /**
+     * Records having an empty password.
+     */
+    RecordGroup emptyPasswords;
+    /**
+     * Records having a password found in the breached password corpus. Only
+     * filled if a corpus has been set on the audit.
+     */
+    RecordGroup breachedPasswords;
+    /**
+     * Records having a non-empty password scoring below the minimum score.
+     * Only filled if a strength estimator has been set on the audit.
+     */
+    RecordGroup weakPasswords;
+    /**
+     * The estimated strength of each password. Only filled if a strength
+     * estimator has been set on the audit.
+     */
+    std::vector<strength::Strength> strengths;
+
+    bool hasFindings() const {
+        return !reusedPasswords.empty() || !duplicateNames.empty() ||
+               !duplicateAccounts.empty() || !emptyPasswords.empty() ||
+               !breachedPasswords.empty() || !weakPasswords.empty();
+    }
+};
+
+/**
+ * Audit all records of a file for reused passwords, duplicate names and
+ * accounts, and empty passwords.
+ *
+ * Records are decrypted in parallel, each worker thread using its own \c
+ * Crypto instance obtained from the crypto factory. Fields are compared using
+ * HMAC-SHA256 digests keyed with a random key generated per \c PasswordAudit
+ * instance, so digests cannot be correlated across runs.
+ */
+class PasswordAudit {
+   private:
+    std::shared_ptr<AbstractCryptoFactory> _cryptoFactory;
+    SecureArray _digestKey;
+    std::shared_ptr<const BreachCorpus> _breachCorpus;
+    std::shared_ptr<const strength::StrengthEstimator> _strengthEstimator;
+    int _minimumScore;
+
+   public:
+    PasswordAudit(std::shared_ptr<AbstractCryptoFactory> cryptoFactory);
+    PasswordAudit(const PasswordAudit&) = delete;
+    PasswordAudit& operator=(const PasswordAudit&) = delete;
+    ~PasswordAudit() {}
+
+    /**
+     * Look up the passwords in \c breachCorpus while auditing. Pass an empty
+     * pointer to disable the lookup.
+     */
+    void breachCorpus(std::shared_ptr<const BreachCorpus> breachCorpus) {
+        _breachCorpus = breachCorpus;
+    }
+
+    /**
+     * Estimate the strength of the passwords while auditing, and report
+     * passwords scoring below \c minimumScore as weak. Pass an empty pointer
+     * to disable the estimation.
+     */
+    void strengthEstimator(
+        std::shared_ptr<const strength::StrengthEstimator> strengthEstimator,
+        int minimumScore) {
+        _strengthEstimator = strengthEstimator;
+        _minimumScore = minimumScore;
+    }
+
+    /**
+     * Audit the encrypted records as returned by \c
+     * YAPET::File::readEncryptedRecords().
+     */
+    AuditReport audit(const std::vector<SecureArray>& encryptedRecords) const;
+
+    /**
+     * Keyed digest of the first \c length bytes of \c data.
+     */
+    Digest digest(const std::uint8_t* data, std::size_t length) const;
+};
+}  // namespace audit
+}  // namespace yapet
+
+#endif
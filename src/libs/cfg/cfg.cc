@@ -172,6 +172,45 @@ void CfgValBool::set_str(const std::string& s) {
     throw std::invalid_argument(msg);
 }
 
+//
+// Class CfgValCapitalization
+//
+void CfgValCapitalization::set_str(const std::string& s) {
+    std::string sanitized(tolower(trim(s)));
+
+    if (sanitized == "none" || sanitized == "first" || sanitized == "random") {
+        set(sanitized);
+        return;
+    }
+
+    char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+    std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                  _("'%s' is not a valid capitalization"), sanitized.c_str());
+    throw std::invalid_argument(msg);
+}
+
+//
+// Class CfgValRules
+//
+void CfgValRules::set_str(const std::string& s) {
+    std::string::size_type colon = s.find(':');
+    std::string name(trim(s.substr(0, colon)));
+
+    if (colon == std::string::npos || name.empty() ||
+        name.find_first_of(" \t") != std::string::npos) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("'%s' is not a valid rule profile, expected "
+                        "'name: rules'"),
+                      s.c_str());
+        throw std::invalid_argument(msg);
+    }
+
+    std::map<std::string, std::string> profiles(get());
+    profiles[name] = trim(s.substr(colon + 1));
+    set(profiles);
+}
+
 //
 // Class CfgValInt
 //
@@ -185,12 +224,22 @@ void Config::setup_map() {
     _options["checkfsecurity"] = &filesecurity;
     _options["allowlockquit"] = &allow_lock_quit;
     _options["pwinputtimeout"] = &pw_input_timeout;
+    _options["recordcachesize"] = &record_cache_size;
+    _options["recordcachettl"] = &record_cache_ttl;
     _options["pwgen_pwlen"] = &pwgenpwlen;
     _options["pwgen_letters"] = &pwgen_letters;
     _options["pwgen_digits"] = &pwgen_digits;
     _options["pwgen_punct"] = &pwgen_punct;
     _options["pwgen_special"] = &pwgen_special;
     _options["pwgen_other"] = &pwgen_other;
+    _options["pwgen_passphrase"] = &pwgen_passphrase;
+    _options["pwgen_pronounceable"] = &pwgen_pronounceable;
+    _options["pwgen_words"] = &pwgen_words;
+    _options["pwgen_separator"] = &pwgen_separator;
+    _options["pwgen_capitalization"] = &pwgen_capitalization;
+    _options["pwgen_wordlist"] = &pwgen_wordlist;
+    _options["pwgen_rules"] = &pwgen_rules;
+    _options["pwgen_profile"] = &pwgen_profile;
     _options["argon2_memory"] = &argon2_memory;
     _options["argon2_parallelism"] = &argon2_parallelism;
     _options["argon2_iterations"] = &argon2_iterations;
@@ -212,9 +261,24 @@ Config::Config()
       pwgen_punct{yapet::pwgen::isPunct(Consts::DEFAULT_CHARACTER_POOLS)},
       pwgen_special{yapet::pwgen::isSpecial(Consts::DEFAULT_CHARACTER_POOLS)},
       pwgen_other{yapet::pwgen::isOther(Consts::DEFAULT_CHARACTER_POOLS)},
+      pwgen_passphrase{false},
+      pwgen_pronounceable{false},
+      pwgen_words{Consts::DEFAULT_PASSPHRASE_WORDS,
+                  Consts::DEFAULT_PASSPHRASE_WORDS,
+                  Consts::MIN_PASSPHRASE_WORDS, Consts::MAX_PASSPHRASE_WORDS},
+      pwgen_separator{Consts::DEFAULT_PASSPHRASE_SEPARATOR},
+      pwgen_capitalization{Consts::DEFAULT_PASSPHRASE_CAPITALIZATION},
+      pwgen_wordlist{},
+      pwgen_rules{},
+      pwgen_profile{},
       allow_lock_quit{Consts::DEFAULT_ALLOW_LOCK_QUIT},
       pw_input_timeout{Consts::DEFAULT_PASSWORD_INPUT_TIMEOUT,
                        Consts::MIN_LOCK_TIMEOUT, Consts::MIN_LOCK_TIMEOUT},
+      record_cache_size{Consts::DEFAULT_RECORD_CACHE_SIZE,
+                        Consts::DEFAULT_RECORD_CACHE_SIZE, 0,
+                        Consts::MAX_RECORD_CACHE_SIZE},
+      record_cache_ttl{Consts::DEFAULT_RECORD_CACHE_TTL,
+                       Consts::DEFAULT_RECORD_CACHE_TTL, 0},
       argon2_memory{Consts::DEFAULT_ARGON2_MEMORY,
                     Consts::DEFAULT_ARGON2_MEMORY, Consts::MIN_ARGON2_MEMORY},
       argon2_parallelism{Consts::DEFAULT_ARGON2_PARALLELISM,
@@ -239,8 +303,18 @@ Config::Config(const Config& c)
       pwgen_punct{c.pwgen_punct},
       pwgen_special{c.pwgen_special},
       pwgen_other{c.pwgen_other},
+      pwgen_passphrase{c.pwgen_passphrase},
+      pwgen_pronounceable{c.pwgen_pronounceable},
+      pwgen_words{c.pwgen_words},
+      pwgen_separator{c.pwgen_separator},
+      pwgen_capitalization{c.pwgen_capitalization},
+      pwgen_wordlist{c.pwgen_wordlist},
+      pwgen_rules{c.pwgen_rules},
+      pwgen_profile{c.pwgen_profile},
       allow_lock_quit{c.allow_lock_quit},
       pw_input_timeout{c.pw_input_timeout},
+      record_cache_size{c.record_cache_size},
+      record_cache_ttl{c.record_cache_ttl},
       argon2_memory{c.argon2_memory},
       argon2_parallelism{c.argon2_parallelism},
       argon2_iterations{c.argon2_iterations},
@@ -263,8 +337,18 @@ Config& Config::operator=(const Config& c) {
     pwgen_punct = c.pwgen_punct;
     pwgen_special = c.pwgen_special;
     pwgen_other = c.pwgen_other;
+    pwgen_passphrase = c.pwgen_passphrase;
+    pwgen_pronounceable = c.pwgen_pronounceable;
+    pwgen_words = c.pwgen_words;
+    pwgen_separator = c.pwgen_separator;
+    pwgen_capitalization = c.pwgen_capitalization;
+    pwgen_wordlist = c.pwgen_wordlist;
+    pwgen_rules = c.pwgen_rules;
+    pwgen_profile = c.pwgen_profile;
     allow_lock_quit = c.allow_lock_quit;
     pw_input_timeout = c.pw_input_timeout;
+    record_cache_size = c.record_cache_size;
+    record_cache_ttl = c.record_cache_ttl;
     argon2_memory = c.argon2_memory;
     argon2_parallelism = c.argon2_parallelism;
     argon2_iterations = c.argon2_iterations;
@@ -302,8 +386,18 @@ void Config::lock() {
     pwgen_punct.lock();
     pwgen_special.lock();
     pwgen_other.lock();
+    pwgen_passphrase.lock();
+    pwgen_pronounceable.lock();
+    pwgen_words.lock();
+    pwgen_separator.lock();
+    pwgen_capitalization.lock();
+    pwgen_wordlist.lock();
+    pwgen_rules.lock();
+    pwgen_profile.lock();
     allow_lock_quit.lock();
     pw_input_timeout.lock();
+    record_cache_size.lock();
+    record_cache_ttl.lock();
     argon2_iterations.lock();
     argon2_memory.lock();
     argon2_parallelism.lock();
@@ -321,8 +415,18 @@ void Config::unlock() {
     pwgen_punct.unlock();
     pwgen_special.unlock();
     pwgen_other.unlock();
+    pwgen_passphrase.unlock();
+    pwgen_pronounceable.unlock();
+    pwgen_words.unlock();
+    pwgen_separator.unlock();
+    pwgen_capitalization.unlock();
+    pwgen_wordlist.unlock();
+    pwgen_rules.unlock();
+    pwgen_profile.unlock();
     allow_lock_quit.unlock();
     pw_input_timeout.unlock();
+    record_cache_size.unlock();
+    record_cache_ttl.unlock();
     argon2_iterations.unlock();
     argon2_memory.unlock();
     argon2_parallelism.unlock();
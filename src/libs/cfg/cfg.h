@@ -46,7 +46,6 @@
 
 #include "cfgfile.h"
 #include "consts.h"
-#include "rng.hh"
 
 namespace YAPET {
 namespace CONFIG {
@@ -218,6 +217,33 @@ class CfgValColor : public CfgValStr {
     void set_str(const std::string& s) { set(s); }
 };
 
+/**
+ * String value taken as it is, including white space.
+ */
+class CfgValString : public CfgValStr {
+   public:
+    CfgValString(const std::string& v = std::string()) : CfgValStr(v) {}
+    void set_str(const std::string& s) { set(s); }
+};
+
+/**
+ * Capitalization of passphrase words: \c none, \c first, or \c random.
+ */
+class CfgValCapitalization : public CfgValStr {
+   public:
+    CfgValCapitalization(const std::string& v) : CfgValStr(v) {}
+    void set_str(const std::string& s);
+};
+
+/**
+ * Named password rules, each given as <tt>name: rules</tt>. Each value set
+ * adds a profile, replacing the profile of the same name, if any.
+ */
+class CfgValRules : public CfgVal<std::map<std::string, std::string> > {
+   public:
+    void set_str(const std::string& s);
+};
+
 /**
  * @brief Handle the command line and config file options.
  *
@@ -243,8 +269,19 @@ class Config {
     CfgValBool pwgen_punct;
     CfgValBool pwgen_special;
     CfgValBool pwgen_other;
+    CfgValBool pwgen_passphrase;
+    CfgValBool pwgen_pronounceable;
+    CfgValInt pwgen_words;
+    CfgValString pwgen_separator;
+    CfgValCapitalization pwgen_capitalization;
+    CfgValString pwgen_wordlist;
+    CfgValRules pwgen_rules;
+    CfgValString pwgen_profile;
     CfgValBool allow_lock_quit;
     CfgValInt pw_input_timeout;
+    CfgValInt record_cache_size;
+    // in seconds
+    CfgValInt record_cache_ttl;
     // in kibi
     CfgValInt argon2_memory;
     CfgValInt argon2_parallelism;
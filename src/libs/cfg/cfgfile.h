@@ -38,9 +38,6 @@
 
 #include <string>
 
-// Used for the YAPET::PWGEN::RNGENGINE type
-#include "rng.hh"
-
 #include "cfg.h"
 
 /**
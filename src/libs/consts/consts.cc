@@ -37,5 +37,10 @@ const std::string Consts::ARGON2_SALT1_KEY{"A2_S1"};
 const std::string Consts::ARGON2_SALT2_KEY{"A2_S2"};
 const std::string Consts::ARGON2_SALT3_KEY{"A2_S3"};
 const std::string Consts::ARGON2_SALT4_KEY{"A2_S4"};
+const std::string Consts::DATA_KEY_VERSION_KEY{"DK_V"};
+const std::string Consts::WRAPPED_DATA_KEY_KEY_PREFIX{"DK_W"};
+const std::string Consts::KEY_SLOT_KEY_PREFIX{"KS"};
 const std::string Consts::DEFAULT_FILE_SUFFIX{".pet"};
 const std::string Consts::DEFAULT_RC_FILENAME{".yapet"};
+const std::string Consts::DEFAULT_PASSPHRASE_SEPARATOR{"-"};
+const std::string Consts::DEFAULT_PASSPHRASE_CAPITALIZATION{"first"};
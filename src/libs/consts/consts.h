@@ -39,7 +39,6 @@
 #include <string>
 // Used for the character pools
 #include "characterpool.hh"
-#include "rng.hh"
 
 namespace YAPET {
 class Consts {
@@ -51,6 +50,13 @@ class Consts {
     static const std::string ARGON2_SALT2_KEY;
     static const std::string ARGON2_SALT3_KEY;
     static const std::string ARGON2_SALT4_KEY;
+    //! Set if records are encrypted with a random data key
+    static const std::string DATA_KEY_VERSION_KEY;
+    //! Keys holding the wrapped data key are made of the prefix and an index
+    static const std::string WRAPPED_DATA_KEY_KEY_PREFIX;
+    //! Keys of key slots other than the first are prefixed with this, the
+    //! slot number and an underscore
+    static const std::string KEY_SLOT_KEY_PREFIX;
     //! Holds the default suffix for yapet files
     static const std::string DEFAULT_FILE_SUFFIX;
     //! The default file name of the config file
@@ -71,9 +77,20 @@ class Consts {
     //! Default password length for Password Generator
     static constexpr auto DEFAULT_PASSWORD_LENGTH{15};
     static constexpr auto DEFAULT_PASSWORD_INPUT_TIMEOUT{60};
+    //! Default number of decrypted records cached
+    static constexpr auto DEFAULT_RECORD_CACHE_SIZE{64};
+    static constexpr auto MAX_RECORD_CACHE_SIZE{4096};
+    //! Default time in seconds decrypted records not used are cached
+    static constexpr auto DEFAULT_RECORD_CACHE_TTL{300};
     static constexpr auto DEFAULT_CHARACTER_POOLS{
         yapet::pwgen::LETTERS | yapet::pwgen::DIGITS | yapet::pwgen::PUNCT |
         yapet::pwgen::SPECIAL};
+    //! Default number of words of passphrases
+    static constexpr auto DEFAULT_PASSPHRASE_WORDS{7};
+    static constexpr auto MIN_PASSPHRASE_WORDS{2};
+    static constexpr auto MAX_PASSPHRASE_WORDS{20};
+    static const std::string DEFAULT_PASSPHRASE_SEPARATOR;
+    static const std::string DEFAULT_PASSPHRASE_CAPITALIZATION;
 
     // Argon2 options
 
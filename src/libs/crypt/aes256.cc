@@ -27,11 +27,12 @@
  * well as that of the covered work.
  */
 
-#include <openssl/rand.h>
 #include <cstdio>
 #include <cstring>
+#include <stdexcept>
 
 #include "aes256.hh"
+#include "chacha20drbg.hh"
 #include "consts.h"
 #include "cryptoerror.hh"
 #include "intl.h"
@@ -42,8 +43,9 @@ using namespace yapet;
 SecureArray Aes256::randomIV() const {
     SecureArray ivec{cipherIvecSize()};
 
-    auto result = RAND_bytes((*ivec), ivec.size());
-    if (result != SSL_SUCCESS) {
+    try {
+        randomBytes(*ivec, ivec.size());
+    } catch (std::runtime_error& ex) {
         LOG_MESSAGE(std::string{__func__} +
                     ": Cannot generate random initialization vector");
         throw CipherError{_("Cannot generate random initialization vector")};
@@ -105,8 +107,11 @@ void Aes256::validateCipherOrThrow(const SecureArray& ivec) {
 EVP_CIPHER_CTX* Aes256::initializeOrThrow(const SecureArray& ivec, MODE mode) {
     EVP_CIPHER_CTX* context = createContext();
 
-    auto success = EVP_CipherInit_ex(context, getCipher(), nullptr,
-                                     *getKey()->key(), *ivec, mode);
+    int success;
+    getKey()->useKey([&](const std::uint8_t* key) {
+        success =
+            EVP_CipherInit_ex(context, getCipher(), nullptr, key, *ivec, mode);
+    });
     if (success != SSL_SUCCESS) {
         LOG_MESSAGE(std::string{__func__} + ": Error initializing cipher");
         destroyContext(context);
@@ -251,4 +256,38 @@ SecureArray Aes256::decrypt(const SecureArray& cipherText) {
     destroyContext(context);
 
     return (decryptedData << temporaryDecryptedData);
-}
\ No newline at end of file
+}
+
+SecureArray Aes256::decryptPrefix(const SecureArray& cipherText,
+                                  SecureArray::size_type length) {
+    auto ivecSize = cipherIvecSize();
+    auto blockSize = cipherBlockSize();
+    auto prefixSize = (length + blockSize - 1) / blockSize * blockSize;
+
+    // The last block holds the padding, which is only removed by decrypting
+    // the entire cipher text.
+    if (length <= 0 || cipherText.size() < ivecSize + prefixSize + blockSize) {
+        return decrypt(cipherText);
+    }
+
+    SecureArray ivec{extractIVFromRecord(cipherText)};
+
+    validateCipherOrThrow(ivec);
+
+    EVP_CIPHER_CTX* context = initializeOrThrow(ivec, DECRYPTION);
+    EVP_CIPHER_CTX_set_padding(context, 0);
+
+    SecureArray decryptedData{prefixSize};
+    int writtenDataLength;
+
+    auto success = EVP_CipherUpdate(context, *decryptedData,
+                                    &writtenDataLength, *cipherText + ivecSize,
+                                    prefixSize);
+    destroyContext(context);
+    if (success != SSL_SUCCESS || writtenDataLength != prefixSize) {
+        LOG_MESSAGE(std::string{__func__} + ": EVP_CipherUpdate failure");
+        throw EncryptionError{_("Error decrypting data")};
+    }
+
+    return decryptedData;
+}
@@ -83,6 +83,14 @@ class Aes256 : public Crypto {
      * The cipher text must have the 16 byte IV prepended.
      */
     virtual SecureArray decrypt(const SecureArray& cipherText);
+
+    /**
+     * Decrypt the blocks of the cipher text holding the first \c length
+     * bytes of the plain text. In CBC mode, a block is decrypted using the
+     * preceding block only, so the remaining blocks are not touched.
+     */
+    virtual SecureArray decryptPrefix(const SecureArray& cipherText,
+                                      SecureArray::size_type length);
 };
 }  // namespace yapet
 
@@ -38,8 +38,24 @@ Aes256Factory::Aes256Factory(const SecureArray& password,
     _key256->password(password);
 }
 
+Aes256Factory::Aes256Factory(const std::shared_ptr<Key256>& key256)
+    : _key256{key256} {}
+
 std::shared_ptr<AbstractCryptoFactory> Aes256Factory::newFactory(
     const SecureArray& password, const MetaData& keyingParameters) const {
+    auto key256{std::dynamic_pointer_cast<Key256>(_key256)};
+    if (key256->isDataKey() && !Key256::hasWrappedDataKey(keyingParameters)) {
+        std::shared_ptr<Key256> newKey256{new Key256{*key256}};
+        if (newKey256->keySlot() < 0) {
+            newKey256->addKeySlot(password, keyingParameters);
+        } else {
+            newKey256->keySlot(newKey256->keySlot(), password,
+                               keyingParameters);
+        }
+        return std::shared_ptr<AbstractCryptoFactory>{
+            new Aes256Factory(newKey256)};
+    }
+
     return std::shared_ptr<AbstractCryptoFactory>{
         new Aes256Factory(password, keyingParameters)};
 }
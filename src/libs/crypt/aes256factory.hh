@@ -43,12 +43,25 @@ class Aes256Factory : public AbstractCryptoFactory {
    public:
     Aes256Factory(const SecureArray& password,
                   const MetaData& keyingParameters);
+    /**
+     * Create a factory using \c key256, e.g. after adding or removing key
+     * slots.
+     */
+    explicit Aes256Factory(const std::shared_ptr<Key256>& key256);
     Aes256Factory(const Aes256Factory&) = delete;
     Aes256Factory(Aes256Factory&&) = delete;
     Aes256Factory& operator=(const Aes256Factory&) = delete;
     Aes256Factory& operator=(Aes256Factory&&) = delete;
     ~Aes256Factory(){};
 
+    /**
+     * If this factory uses a data key, and \c keyingParameters hold no
+     * wrapped data key, the new factory uses the same data key. Records
+     * encrypted by this factory can then be decrypted by the new factory.
+     *
+     * Only the key slot the data key was unwrapped from is replaced, the
+     * other key slots are kept.
+     */
     virtual std::shared_ptr<AbstractCryptoFactory> newFactory(
         const SecureArray& password, const MetaData& keyingParameters) const;
 
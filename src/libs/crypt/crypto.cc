@@ -91,8 +91,12 @@ void Crypto::validateCipherOrThrow() {
 EVP_CIPHER_CTX* Crypto::initializeOrThrow(MODE mode) {
     EVP_CIPHER_CTX* context = createContext();
 
-    auto success = EVP_CipherInit_ex(context, getCipher(), nullptr,
-                                     *_key->key(), *_key->ivec(), mode);
+    auto ivec{_key->ivec()};
+    int success;
+    _key->useKey([&](const std::uint8_t* key) {
+        success =
+            EVP_CipherInit_ex(context, getCipher(), nullptr, key, *ivec, mode);
+    });
     if (success != SSL_SUCCESS) {
         destroyContext(context);
         throw CipherError{_("Error initializing cipher")};
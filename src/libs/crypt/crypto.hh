@@ -98,6 +98,20 @@ class Crypto {
      * @throw YAPETEncryptionException in case of cipher errors.
      */
     virtual SecureArray decrypt(const SecureArray& cipherText);
+    /**
+     * Decrypt at least the first \c length bytes of the plain text, or all
+     * of it if it is shorter. Ciphers allowing to decrypt a prefix of the
+     * cipher text return less than the entire plain text.
+     *
+     * Unlike \c decrypt(), a wrong key is not detected.
+     *
+     * @throw YAPETEncryptionException in case of cipher errors.
+     */
+    virtual SecureArray decryptPrefix(const SecureArray& cipherText,
+                                      SecureArray::size_type length) {
+        (void)length;
+        return decrypt(cipherText);
+    }
 
     std::shared_ptr<Key> getKey() const { return _key; }
 };
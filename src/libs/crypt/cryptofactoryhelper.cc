@@ -30,10 +30,14 @@
 #include "cryptofactoryhelper.hh"
 #include "aes256factory.hh"
 #include "blowfishfactory.hh"
+#include "consts.h"
+#include "file.hh"
 #include "fileerror.hh"
 #include "filehelper.hh"
 #include "intl.h"
 
+#include <cstdio>
+
 using namespace yapet;
 
 namespace {
@@ -74,4 +78,32 @@ std::shared_ptr<AbstractCryptoFactory> yapet::getCryptoFactoryForFile(
     }
 
     return std::shared_ptr<AbstractCryptoFactory>{};
-}
\ No newline at end of file
+}
+std::shared_ptr<AbstractCryptoFactory> yapet::getVerifiedCryptoFactoryForFile(
+    const std::string& filename, const SecureArray& password, bool secure) {
+    auto cryptoFactory{getCryptoFactoryForFile(filename, password)};
+    if (!cryptoFactory) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("File '%s' not recognized"), filename.c_str());
+        throw FileFormatError{msg};
+    }
+
+    // This will raise an exception if password is wrong
+    YAPET::File{cryptoFactory, filename, false, secure};
+    return cryptoFactory;
+}
+
+std::shared_ptr<AbstractCryptoFactory> yapet::getCryptoFactoryForNewPassword(
+    const std::shared_ptr<AbstractCryptoFactory>& cryptoFactory,
+    const SecureArray& password, const MetaData& keyingParameters) {
+    if (cryptoFactory) {
+        auto key256{std::dynamic_pointer_cast<Key256>(cryptoFactory->key())};
+        if (key256 && key256->isDataKey()) {
+            return cryptoFactory->newFactory(password, keyingParameters);
+        }
+    }
+
+    return std::shared_ptr<AbstractCryptoFactory>{
+        new Aes256Factory{password, keyingParameters}};
+}
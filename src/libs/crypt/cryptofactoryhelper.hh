@@ -35,6 +35,29 @@
 namespace yapet {
 std::shared_ptr<AbstractCryptoFactory> getCryptoFactoryForFile(
     const std::string& filename, const SecureArray& password);
-}
+
+/**
+ * Get the crypto factory for the file, and verify the password by opening
+ * the file.
+ *
+ * @throw FileFormatError if the file is not recognized.
+ *
+ * @throw InvalidPasswordError if the password does not match.
+ */
+std::shared_ptr<AbstractCryptoFactory> getVerifiedCryptoFactoryForFile(
+    const std::string& filename, const SecureArray& password, bool secure);
+
+/**
+ * Get the crypto factory for the new password of a file opened using \c
+ * cryptoFactory.
+ *
+ * A file using a data key keeps it, wrapped using \c password. Any other
+ * file, including pre YAPET 2.0 files, gets a new AES-256 key, so it is
+ * converted when the new key is set.
+ */
+std::shared_ptr<AbstractCryptoFactory> getCryptoFactoryForNewPassword(
+    const std::shared_ptr<AbstractCryptoFactory>& cryptoFactory,
+    const SecureArray& password, const MetaData& keyingParameters);
+}  // namespace yapet
 
 #endif
\ No newline at end of file
@@ -32,17 +32,106 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <exception>
+#include <future>
+#include <thread>
 
 #include "cryptoerror.hh"
 #include "file.hh"
+#include "filehelper.hh"
 #include "fileutils.hh"
 #include "intl.h"
 #include "logger.hh"
+#include "parallel.hh"
 #include "yapeterror.hh"
 
 using namespace YAPET;
 using namespace yapet;
 
+namespace {
+constexpr std::size_t REENCRYPTION_BATCH_SIZE{64};
+
+/**
+ * Re-encrypt \c records, encrypted by \c oldCryptoFactory, using \c
+ * newCryptoFactory, and write them to \c file in their original order.
+ *
+ * Worker threads re-encrypt batches of records, each using \c Crypto
+ * instances of its own, while the calling thread writes the batches already
+ * re-encrypted.
+ */
+void reencryptRecords(std::vector<SecureArray>& records,
+                      const AbstractCryptoFactory& oldCryptoFactory,
+                      const AbstractCryptoFactory& newCryptoFactory,
+                      YapetFile& file) {
+    auto batches{(records.size() + REENCRYPTION_BATCH_SIZE - 1) /
+                 REENCRYPTION_BATCH_SIZE};
+    std::vector<std::promise<void>> reencryptedPromises(batches);
+    std::vector<std::future<void>> reencrypted;
+    for (auto& promise : reencryptedPromises) {
+        reencrypted.push_back(promise.get_future());
+    }
+
+    std::vector<std::pair<std::unique_ptr<Crypto>, std::unique_ptr<Crypto>>>
+        cryptos;
+    for (unsigned int i = 0; i < numberOfWorkers(records.size()); i++) {
+        cryptos.emplace_back(oldCryptoFactory.crypto(),
+                             newCryptoFactory.crypto());
+    }
+
+    std::atomic<std::size_t> nextBatch{0};
+    std::atomic<bool> stop{false};
+    auto reencryptBatches = [&records, &reencryptedPromises, &nextBatch,
+                             &stop, batches](Crypto& oldCrypto,
+                                             Crypto& newCrypto) {
+        std::size_t batch;
+        while (!stop && (batch = nextBatch++) < batches) {
+            try {
+                auto end{std::min(records.size(),
+                                  (batch + 1) * REENCRYPTION_BATCH_SIZE)};
+                for (auto i{batch * REENCRYPTION_BATCH_SIZE}; i < end; i++) {
+                    records[i] =
+                        newCrypto.encrypt(oldCrypto.decrypt(records[i]));
+                }
+                reencryptedPromises[batch].set_value();
+            } catch (...) {
+                reencryptedPromises[batch].set_exception(
+                    std::current_exception());
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (auto& crypto : cryptos) {
+        workers.emplace_back(reencryptBatches, std::ref(*crypto.first),
+                             std::ref(*crypto.second));
+    }
+
+    std::exception_ptr error{};
+    try {
+        for (std::size_t batch = 0; batch < batches; batch++) {
+            reencrypted[batch].get();
+
+            auto end{std::min(records.size(),
+                              (batch + 1) * REENCRYPTION_BATCH_SIZE)};
+            for (auto i{batch * REENCRYPTION_BATCH_SIZE}; i < end; i++) {
+                file.writePasswordRecord(records[i]);
+            }
+        }
+    } catch (...) {
+        error = std::current_exception();
+        stop = true;
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    if (error) std::rethrow_exception(error);
+}
+}  // namespace
+
 Header10 File::readHeader() {
     auto encryptedSerializedHeader{_yapetFile->readHeader()};
     auto serializedHeader{_crypto->decrypt(encryptedSerializedHeader)};
@@ -126,6 +215,92 @@ void File::save(const std::list<PasswordListItem>& records, bool forcewrite) {
     LOG_MESSAGE("Save yapet file");
 }
 
+/**
+ * Save records without holding all of them in memory.
+ *
+ * Discards the records stored in the file. The caller appends encrypted
+ * records using \c saveRecord(), in the order they should be stored, and
+ * calls \c endSave() afterwards. This allows writing records as soon as they
+ * have been encrypted, e.g. when importing large files.
+ */
+void File::beginSave(bool forcewrite) {
+    if (!forcewrite) {
+        notModifiedOrThrow();
+    }
+
+    _yapetFile->beginPasswordRecords();
+}
+
+void File::saveRecord(const SecureArray& encryptedRecord) {
+    _yapetFile->writePasswordRecord(encryptedRecord);
+}
+
+void File::endSave() {
+    _yapetFile->endPasswordRecords();
+    _fileModificationTime = yapet::getModificationTime(_yapetFile->filename());
+    LOG_MESSAGE("Save yapet file");
+}
+
+/**
+ * Write a file made of \c metaData, \c header, and the records written by \c
+ * writeRecords to a temporary file next to the file, which then replaces the
+ * file. The temporary file and, after renaming it, the directory are flushed
+ * to disk. If writing fails, the file is left as it was.
+ */
+void File::replaceFile(
+    const AbstractCryptoFactory& cryptoFactory, const SecureArray& metaData,
+    const SecureArray& header,
+    const std::function<void(YapetFile&)>& writeRecords) {
+    auto filename{_yapetFile->filename()};
+    auto secure{_yapetFile->isSecure()};
+    std::string temporaryFilename{filename + ".tmp"};
+
+    try {
+        auto temporaryFile{cryptoFactory.file(temporaryFilename, true, secure)};
+        temporaryFile->open();
+        temporaryFile->writeIdentifier();
+        temporaryFile->writeUnencryptedMetaData(metaData);
+        temporaryFile->writeHeader(header);
+
+        temporaryFile->beginPasswordRecords();
+        writeRecords(*temporaryFile);
+        temporaryFile->endPasswordRecords();
+        temporaryFile.reset();
+
+        syncFile(temporaryFilename);
+        renameFile(temporaryFilename, filename);
+    } catch (...) {
+        std::remove(temporaryFilename.c_str());
+        throw;
+    }
+    syncDirectory(filename);
+
+    _yapetFile = cryptoFactory.file(filename, false, secure);
+    _yapetFile->open();
+    _fileModificationTime = yapet::getModificationTime(filename);
+}
+
+/**
+ * Save encrypted records to a temporary file next to the file, which then
+ * replaces the file. The identifier, meta data, and header are copied
+ * unchanged. If saving fails, the file is left as it was.
+ */
+void File::saveAtomically(const std::vector<SecureArray>& encryptedRecords,
+                          bool forcewrite) {
+    if (!forcewrite) {
+        notModifiedOrThrow();
+    }
+
+    replaceFile(*_abstractCryptoFactory, _yapetFile->readUnencryptedMetaData(),
+                _yapetFile->readHeader(),
+                [&encryptedRecords](YapetFile& file) {
+                    for (const auto& encryptedRecord : encryptedRecords) {
+                        file.writePasswordRecord(encryptedRecord);
+                    }
+                });
+    LOG_MESSAGE("Save yapet file atomically");
+}
+
 std::list<PasswordListItem> File::read() {
     auto encryptedPasswordRecords{_yapetFile->readPasswordRecords()};
 
@@ -144,52 +319,104 @@ std::list<PasswordListItem> File::read() {
     return result;
 }
 
-void File::setNewKey(
-    const std::shared_ptr<yapet::AbstractCryptoFactory>& newCryptoFactory,
-    bool forcewrite) {
-    if (!forcewrite) {
-        notModifiedOrThrow();
-    }
-
-    bool isSecure = _yapetFile->isSecure();
-    std::string filename{_yapetFile->filename()};
+/**
+ * Read the encrypted password records in the order they are stored in the
+ * file.
+ *
+ * Other than \c read(), no record is decrypted. Callers may decrypt the
+ * records using their own \c Crypto instances, e.g. one per thread.
+ */
+std::vector<SecureArray> File::readEncryptedRecords() {
+    auto encryptedPasswordRecords{_yapetFile->readPasswordRecords()};
 
-    // close and destroy old file
-    LOG_MESSAGE("File::setNewKey(): close currently open file");
-    _yapetFile.reset();
+    std::vector<SecureArray> result;
+    result.reserve(encryptedPasswordRecords.size());
+    for (auto& encryptedPasswordRecord : encryptedPasswordRecords) {
+        result.push_back(std::move(encryptedPasswordRecord));
+    }
 
-    LOG_MESSAGE("File::setNewKey(): rename file");
-    std::string backupfilename(filename + ".bak");
-    yapet::renameFile(filename, backupfilename);
+    LOG_MESSAGE("Read encrypted records from yapet file");
+    return result;
+}
 
-    LOG_MESSAGE("File::setNewKey(): open renamed file");
-    std::unique_ptr<yapet::YapetFile> oldFile{
-        _abstractCryptoFactory->file(backupfilename, false, false)};
-    oldFile->open();
+/**
+ * Replace the meta data and the header, leaving the records as they are.
+ *
+ * Used if the new key is the same data key, wrapped using another password.
+ * The meta data and header are rewritten in place by \c
+ * rewriteHeaderInPlace(), so only a few hundred bytes are written. If their
+ * size changed, the records are copied unchanged to a file replacing the
+ * file atomically instead.
+ */
+void File::rewriteHeader(
+    const std::shared_ptr<AbstractCryptoFactory>& newCryptoFactory) {
+    auto newCrypto{newCryptoFactory->crypto()};
+    auto metaData{newCryptoFactory->key()->keyingParameters().serialize()};
+    Header10 header{time(0)};
+    auto encryptedHeader{newCrypto->encrypt(header.serialize())};
+
+    auto filename{_yapetFile->filename()};
+    if (rewriteHeaderInPlace(filename, metaData, encryptedHeader)) {
+        LOG_MESSAGE("File::setNewKey(): rewrite meta data and header");
+        _yapetFile = newCryptoFactory->file(filename, false,
+                                            _yapetFile->isSecure());
+        _yapetFile->open();
+        _fileModificationTime = yapet::getModificationTime(filename);
+    } else {
+        LOG_MESSAGE("File::setNewKey(): replace meta data and header");
+        auto encryptedRecords{readEncryptedRecords()};
+        replaceFile(*newCryptoFactory, metaData, encryptedHeader,
+                    [&encryptedRecords](YapetFile& file) {
+                        for (const auto& encryptedRecord : encryptedRecords) {
+                            file.writePasswordRecord(encryptedRecord);
+                        }
+                    });
+    }
 
-    LOG_MESSAGE("File::setNewKey(): swap crypto factories");
-    auto cryptoFactory{newCryptoFactory};
-    auto otherCrypto{cryptoFactory->crypto()};
-    _abstractCryptoFactory.swap(cryptoFactory);
+    _abstractCryptoFactory = newCryptoFactory;
+    _crypto = std::move(newCrypto);
+}
 
-    _crypto.swap(otherCrypto);
+/**
+ * Re-encrypt all records using the new key, replacing the file atomically.
+ */
+void File::reencrypt(
+    const std::shared_ptr<AbstractCryptoFactory>& newCryptoFactory) {
+    auto newCrypto{newCryptoFactory->crypto()};
+    auto metaData{newCryptoFactory->key()->keyingParameters().serialize()};
+    Header10 header{time(0)};
+    auto encryptedHeader{newCrypto->encrypt(header.serialize())};
+
+    LOG_MESSAGE("File::setNewKey(): re-encrypt password records");
+    auto records{readEncryptedRecords()};
+    replaceFile(*newCryptoFactory, metaData, encryptedHeader,
+                [this, &records, &newCryptoFactory](YapetFile& file) {
+                    reencryptRecords(records, *_abstractCryptoFactory,
+                                     *newCryptoFactory, file);
+                });
+
+    _abstractCryptoFactory = newCryptoFactory;
+    _crypto = std::move(newCrypto);
+}
 
-    LOG_MESSAGE("File::setNewKey(): create new file");
-    _yapetFile = _abstractCryptoFactory->file(filename, true, isSecure);
-    _yapetFile->open();
+/**
+ * If the new key equals the current key, which is the case when the data
+ * key is wrapped using a new password, only the meta data and header are
+ * rewritten. Otherwise, e.g. when rotating the data key or converting a file
+ * without data key, all records are re-encrypted.
+ */
+void File::setNewKey(
+    const std::shared_ptr<yapet::AbstractCryptoFactory>& newCryptoFactory,
+    bool forcewrite) {
+    if (!forcewrite) {
+        notModifiedOrThrow();
+    }
 
-    LOG_MESSAGE("File::setNewKey(): initialize new file");
-    initializeEmptyFile();
-    std::list<yapet::SecureArray> newlyEncryptedRecords{};
-    LOG_MESSAGE("File::setNewKey(): read password records from renamed file");
-    for (auto encryptedSerializedRecord : oldFile->readPasswordRecords()) {
-        auto serializedRecord{otherCrypto->decrypt(encryptedSerializedRecord)};
-        auto newlyEncryptedSerializedRecord{_crypto->encrypt(serializedRecord)};
-        newlyEncryptedRecords.push_back(newlyEncryptedSerializedRecord);
-    }
-    LOG_MESSAGE("File::setNewKey(): write password records to new file");
-    _yapetFile->writePasswordRecords(newlyEncryptedRecords);
-    _fileModificationTime = yapet::getModificationTime(_yapetFile->filename());
+    if (*newCryptoFactory->key() == *_abstractCryptoFactory->key()) {
+        rewriteHeader(newCryptoFactory);
+    } else {
+        reencrypt(newCryptoFactory);
+    }
 }
 
 int64_t File::getMasterPWSet() {
@@ -34,9 +34,11 @@
 #include "config.h"
 #endif
 
+#include <functional>
 #include <list>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "abstractcryptofactory.hh"
 #include "crypto.hh"
@@ -61,6 +63,14 @@ class File {
     void initializeEmptyFile();
     void validateExistingFile();
     void notModifiedOrThrow();
+    void replaceFile(
+        const yapet::AbstractCryptoFactory& cryptoFactory,
+        const yapet::SecureArray& metaData, const yapet::SecureArray& header,
+        const std::function<void(yapet::YapetFile&)>& writeRecords);
+    void rewriteHeader(
+        const std::shared_ptr<yapet::AbstractCryptoFactory>& newCryptoFactory);
+    void reencrypt(
+        const std::shared_ptr<yapet::AbstractCryptoFactory>& newCryptoFactory);
 
    public:
     //! Constructor
@@ -77,8 +87,19 @@ class File {
     //! Saves a password record list.
     void save(const std::list<yapet::PasswordListItem>& records,
               bool forcewrite = false);
+    //! Starts saving encrypted records one at a time.
+    void beginSave(bool forcewrite = false);
+    //! Appends an encrypted record to the file.
+    void saveRecord(const yapet::SecureArray& encryptedRecord);
+    //! Completes saving records started by \c beginSave().
+    void endSave();
+    //! Replaces the stored records, never leaving a partially written file.
+    void saveAtomically(const std::vector<yapet::SecureArray>& encryptedRecords,
+                        bool forcewrite = false);
     //! Reads the stored password records from the file.
     std::list<yapet::PasswordListItem> read();
+    //! Reads the stored password records without decrypting them.
+    std::vector<yapet::SecureArray> readEncryptedRecords();
 
     //! Sets a new encryption key for the current file.
     void setNewKey(
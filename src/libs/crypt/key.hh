@@ -30,6 +30,9 @@
 #ifndef _KEY_HH
 #define _KEY_HH
 
+#include <cstdint>
+#include <functional>
+
 #include "metadata.hh"
 #include "securearray.hh"
 
@@ -65,6 +68,19 @@ class Key {
     virtual SecureArray key() const = 0;
     virtual SecureArray::size_type keySize() const = 0;
 
+    /**
+     * Call \c use with a pointer to the \c keySize() bytes of the key.
+     *
+     * The pointer is only valid during the call. Keys held in memory other
+     * than their own override this to pass that memory, so that ciphers do
+     * not copy the key.
+     */
+    virtual void useKey(
+        const std::function<void(const std::uint8_t* key)>& use) const {
+        auto copy{key()};
+        use(*copy);
+    }
+
     virtual SecureArray ivec() const = 0;
     virtual SecureArray::size_type ivecSize() const = 0;
 
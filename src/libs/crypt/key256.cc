@@ -32,20 +32,22 @@
 #endif
 
 #include <argon2.h>
-#include <openssl/rand.h>
 #include <cstdio>
 #include <cstring>
+#include <stdexcept>
 #include <typeinfo>
 #ifdef DEBUG_LOG
 #include <iomanip>
 #include <sstream>
 #endif
 
+#include "chacha20drbg.hh"
 #include "consts.h"
 #include "cryptoerror.hh"
 #include "globals.h"
 #include "intl.h"
 #include "key256.hh"
+#include "keywrap.hh"
 #include "logger.hh"
 #include "ods.hh"
 
@@ -59,7 +61,6 @@ constexpr char hexPrefix[]{"0x"};
  * The max length of key in bytes (256 bits)
  */
 constexpr int KEY_LENGTH{32};
-constexpr int SSL_SUCCESS{1};
 
 // in bytes
 constexpr int SALT_NIBBLE_SIZE{sizeof(int)};
@@ -67,6 +68,10 @@ constexpr int NUMBER_OF_SALT_NIBBLES{4};
 // In bytes
 constexpr int SALT_LENGTH = SALT_NIBBLE_SIZE * NUMBER_OF_SALT_NIBBLES;
 
+// Version stored under YAPET::Consts::DATA_KEY_VERSION_KEY
+constexpr int DATA_KEY_VERSION{1};
+constexpr int WRAPPED_DATA_KEY_NIBBLES = WRAPPED_KEY_SIZE / sizeof(int);
+
 union architecture_agnostic_salt_type {
     int nibbles[NUMBER_OF_SALT_NIBBLES];
     uint8_t bytes[SALT_LENGTH];
@@ -161,10 +166,126 @@ inline SecureArray hash(const SecureArray& password,
     return hash;
 }
 
+/**
+ * Compute the key from the password, which is expected to be terminated by
+ * \c \0.
+ */
+SecureArray keyFromPassword(const SecureArray& password,
+                            const MetaData& parameters) {
+    SecureArray passwordWithoutZeroTerminator{password.size() - 1};
+    passwordWithoutZeroTerminator << password;
+
+    auto key{hash(passwordWithoutZeroTerminator, parameters)};
+
+    if (key.size() != KEY_LENGTH) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(
+            msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+            _("Effective key length of %d does not match expected key "
+              "length %d"),
+            key.size(), KEY_LENGTH);
+        throw HashError{msg};
+    }
+    return key;
+}
+
+inline std::string wrappedDataKeyKey(int nibble) {
+    return YAPET::Consts::WRAPPED_DATA_KEY_KEY_PREFIX + std::to_string(nibble);
+}
+
+/**
+ * The meta data key of \c key in \c slot. The keys of slot 0 have no prefix,
+ * so that files with a single slot keep the keys of files without data key.
+ */
+std::string slotKey(int slot, const std::string& key) {
+    if (slot == 0) return key;
+    return YAPET::Consts::KEY_SLOT_KEY_PREFIX + std::to_string(slot) + "_" +
+           key;
+}
+
+const std::vector<std::string>& slotParameterKeys() {
+    static const std::vector<std::string> keys{
+        YAPET::Consts::ARGON2_TIME_COST_KEY,
+        YAPET::Consts::ARGON2_MEMORY_COST_KEY,
+        YAPET::Consts::ARGON2_PARALLELISM_KEY,
+        YAPET::Consts::ARGON2_SALT1_KEY,
+        YAPET::Consts::ARGON2_SALT2_KEY,
+        YAPET::Consts::ARGON2_SALT3_KEY,
+        YAPET::Consts::ARGON2_SALT4_KEY};
+    return keys;
+}
+
+/**
+ * Unused slots have a time cost of zero, which Argon2 does not accept.
+ */
+bool isSlotUsed(const MetaData& parameters, int slot) {
+    for (int i = 0; i < WRAPPED_DATA_KEY_NIBBLES; i++) {
+        if (!parameters.hasValue(slotKey(slot, wrappedDataKeyKey(i)))) {
+            return false;
+        }
+    }
+
+    auto timeCostKey{slotKey(slot, YAPET::Consts::ARGON2_TIME_COST_KEY)};
+    return parameters.hasValue(timeCostKey) &&
+           parameters.getValue(timeCostKey) != 0;
+}
+
+MetaData slotParameters(const MetaData& parameters, int slot) {
+    MetaData result{};
+    for (const auto& key : slotParameterKeys()) {
+        result.setValue(key, parameters.getValue(slotKey(slot, key)));
+    }
+    return result;
+}
+
+/**
+ * Mark \c slot unused. The keys of the slot are kept, so that the size of
+ * the serialized meta data does not change.
+ */
+void clearSlot(MetaData& parameters, int slot) {
+    for (const auto& key : slotParameterKeys()) {
+        parameters.setValue(slotKey(slot, key), 0);
+    }
+    for (int i = 0; i < WRAPPED_DATA_KEY_NIBBLES; i++) {
+        parameters.setValue(slotKey(slot, wrappedDataKeyKey(i)), 0);
+    }
+}
+
+SecureArray readWrappedDataKey(const MetaData& parameters, int slot) {
+    SecureArray wrappedDataKey{WRAPPED_KEY_SIZE};
+    for (int i = 0; i < WRAPPED_DATA_KEY_NIBBLES; i++) {
+        int nibble =
+            toODS(parameters.getValue(slotKey(slot, wrappedDataKeyKey(i))));
+        std::memcpy(*wrappedDataKey + i * sizeof(int), &nibble, sizeof(int));
+    }
+    return wrappedDataKey;
+}
+
+void writeWrappedDataKey(MetaData& parameters, int slot,
+                         const SecureArray& wrappedDataKey) {
+    for (int i = 0; i < WRAPPED_DATA_KEY_NIBBLES; i++) {
+        int nibble;
+        std::memcpy(&nibble, *wrappedDataKey + i * sizeof(int), sizeof(int));
+        parameters.setValue(slotKey(slot, wrappedDataKeyKey(i)),
+                            toHost(nibble));
+    }
+}
+
+SecureArray randomDataKey() {
+    SecureArray dataKey{KEY_LENGTH};
+    try {
+        randomBytes(*dataKey, dataKey.size());
+    } catch (std::runtime_error& ex) {
+        throw HashError{_("Cannot generate random data key")};
+    }
+    return dataKey;
+}
+
 int randomInt() {
     int i;
-    auto result = RAND_bytes(reinterpret_cast<unsigned char*>(&i), sizeof(int));
-    if (result != SSL_SUCCESS) {
+    try {
+        randomBytes(reinterpret_cast<std::uint8_t*>(&i), sizeof(int));
+    } catch (std::runtime_error& ex) {
         throw HashError{_("Cannot generate random salt")};
     }
     return i;
@@ -184,12 +305,20 @@ MetaData Key256::newDefaultKeyingParameters() {
     metaData.setValue(YAPET::Consts::ARGON2_SALT2_KEY, randomInt());
     metaData.setValue(YAPET::Consts::ARGON2_SALT3_KEY, randomInt());
     metaData.setValue(YAPET::Consts::ARGON2_SALT4_KEY, randomInt());
+    metaData.setValue(YAPET::Consts::DATA_KEY_VERSION_KEY, DATA_KEY_VERSION);
 
     LOG_MESSAGE(std::string{__func__} + ": Created random salt " +
                 metaDataSaltToHexString(metaData));
     return metaData;
 }
 
+bool Key256::hasWrappedDataKey(const MetaData& parameters) {
+    for (int slot = 0; slot < MAX_KEY_SLOTS; slot++) {
+        if (isSlotUsed(parameters, slot)) return true;
+    }
+    return false;
+}
+
 /**
  * Initializes the key and the initialization vector. Make sure you
  * securely destroy the password provided to this method.
@@ -197,7 +326,8 @@ MetaData Key256::newDefaultKeyingParameters() {
  * @param password a pointer to the location the password is
  * stored. The password has to be zero-terminated.
  */
-Key256::Key256() : _key{0}, _keyingParameters{} {}
+Key256::Key256()
+    : _key{0}, _keyingParameters{}, _dataKey{false}, _keySlot{-1} {}
 
 void Key256::keyingParameters(const MetaData& parameters) {
     _keyingParameters = parameters;
@@ -205,35 +335,198 @@ void Key256::keyingParameters(const MetaData& parameters) {
 
 const MetaData& Key256::keyingParameters() const { return _keyingParameters; }
 
+/**
+ * Wrap \c dataKey into \c slot. All key slots are allocated when the first
+ * one is used, so that adding and removing key slots later on does not
+ * change the size of the serialized keying parameters. \c File::setNewKey()
+ * then rewrites the header of the file in place instead of copying the
+ * file.
+ */
+void Key256::wrapDataKey(int slot, const SecureArray& password,
+                         const MetaData& slotParameters,
+                         const SecureArray& dataKey) {
+    auto keyEncryptionKey{keyFromPassword(password, slotParameters)};
+    auto wrappedDataKey{wrapKey(keyEncryptionKey, dataKey)};
+
+    for (int i = 0; i < MAX_KEY_SLOTS; i++) {
+        if (!isSlotUsed(_keyingParameters, i)) clearSlot(_keyingParameters, i);
+    }
+
+    for (const auto& key : slotParameterKeys()) {
+        _keyingParameters.setValue(slotKey(slot, key),
+                                   slotParameters.getValue(key));
+    }
+    writeWrappedDataKey(_keyingParameters, slot, wrappedDataKey);
+    _keyingParameters.setValue(YAPET::Consts::DATA_KEY_VERSION_KEY,
+                               DATA_KEY_VERSION);
+
+    _key = dataKey;
+    _dataKey = true;
+    _keySlot = slot;
+}
+
+/**
+ * If the keying parameters have a data key version, but no wrapped data key,
+ * a random data key is created and wrapped into slot 0.
+ *
+ * Otherwise, the data key is unwrapped from the first slot accepting the
+ * password, trying the slots in ascending order. Nothing stored in the
+ * keying parameters but the wrapped data key tells whether a slot accepts
+ * the password, so a key is computed for each slot tried. If no slot
+ * accepts the password, a random key is
+ * used, so that decrypting the file header fails just as it does with an
+ * invalid password for files without data key.
+ */
 void Key256::password(const SecureArray& password) {
-    SecureArray passwordWithoutZeroTerminator{password.size() - 1};
-    passwordWithoutZeroTerminator << password;
+    _dataKey = false;
+    _keySlot = -1;
+
+    if (!_keyingParameters.hasValue(YAPET::Consts::DATA_KEY_VERSION_KEY)) {
+        _key = keyFromPassword(password, _keyingParameters);
+        return;
+    }
 
-    _key = hash(passwordWithoutZeroTerminator, _keyingParameters);
+    auto slots{keySlots()};
+    if (slots.empty()) {
+        LOG_MESSAGE(std::string{__func__} + ": Create random data key");
+        wrapDataKey(0, password, slotParameters(_keyingParameters, 0),
+                    randomDataKey());
+        return;
+    }
 
-    if (_key.size() != KEY_LENGTH) {
-        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
-        std::snprintf(
-            msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
-            _("Effective key length of %d does not match expected key "
-              "length %d"),
-            _key.size(), KEY_LENGTH);
-        throw HashError{msg};
+    for (auto slot : slots) {
+        auto parameters{slotParameters(_keyingParameters, slot)};
+        try {
+            _key = unwrapKey(keyFromPassword(password, parameters),
+                             readWrappedDataKey(_keyingParameters, slot));
+            _dataKey = true;
+            _keySlot = slot;
+            return;
+        } catch (EncryptionError& e) {
+            LOG_MESSAGE(std::string{__func__} + ": Cannot unwrap data key " +
+                        "from slot " + std::to_string(slot));
+        }
+    }
+
+    _key = randomDataKey();
+}
+
+void Key256::keySlot(int slot, const SecureArray& password,
+                     const MetaData& parameters) {
+    if (!_dataKey) {
+        throw std::logic_error{_("Key is not a data key")};
+    }
+    if (slot < 0 || slot >= MAX_KEY_SLOTS) {
+        throw std::invalid_argument{_("Invalid key slot")};
+    }
+
+    wrapDataKey(slot, password, parameters, _key);
+}
+
+std::vector<int> Key256::keySlots() const {
+    std::vector<int> slots;
+    for (int slot = 0; slot < MAX_KEY_SLOTS; slot++) {
+        if (isSlotUsed(_keyingParameters, slot)) slots.push_back(slot);
+    }
+    return slots;
+}
+
+MetaData Key256::keySlotParameters(int slot) const {
+    if (slot < 0 || slot >= MAX_KEY_SLOTS ||
+        !isSlotUsed(_keyingParameters, slot)) {
+        throw std::invalid_argument{_("Invalid key slot")};
+    }
+
+    return slotParameters(_keyingParameters, slot);
+}
+
+int Key256::addKeySlot(const SecureArray& password,
+                       const MetaData& parameters) {
+    for (int slot = 0; slot < MAX_KEY_SLOTS; slot++) {
+        if (isSlotUsed(_keyingParameters, slot)) continue;
+
+        auto keySlot{_keySlot};
+        this->keySlot(slot, password, parameters);
+        // The key is still unwrapped from the same slot
+        _keySlot = keySlot;
+        return slot;
+    }
+
+    throw std::runtime_error{_("No unused key slot left")};
+}
+
+void Key256::removeKeySlot(int slot) {
+    if (slot < 0 || slot >= MAX_KEY_SLOTS ||
+        !isSlotUsed(_keyingParameters, slot)) {
+        throw std::invalid_argument{_("Invalid key slot")};
+    }
+    if (keySlots().size() == 1) {
+        throw std::logic_error{_("Cannot remove the last key slot")};
+    }
+
+    clearSlot(_keyingParameters, slot);
+    if (_keySlot == slot) _keySlot = -1;
+}
+
+void Key256::rotateDataKey(const std::map<int, SecureArray>& passwords) {
+    if (!_dataKey) {
+        throw std::logic_error{_("Key is not a data key")};
+    }
+
+    auto slots{keySlots()};
+    for (auto slot : slots) {
+        auto password{passwords.find(slot)};
+        bool accepted{false};
+        if (password != passwords.end()) {
+            auto parameters{slotParameters(_keyingParameters, slot)};
+            try {
+                accepted = unwrapKey(keyFromPassword(password->second,
+                                                     parameters),
+                                     readWrappedDataKey(_keyingParameters,
+                                                        slot)) == _key;
+            } catch (EncryptionError& e) {
+                accepted = false;
+            }
+        }
+
+        if (!accepted) {
+            char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+            std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                          _("Invalid password for key slot %d"), slot);
+            throw std::invalid_argument{msg};
+        }
+    }
+
+    // Wrap into a copy, so that the key is left unchanged if wrapping fails
+    Key256 rotated{*this};
+    auto dataKey{randomDataKey()};
+    for (auto slot : slots) {
+        rotated.wrapDataKey(slot, passwords.at(slot),
+                            newDefaultKeyingParameters(), dataKey);
     }
+    rotated._keySlot = _keySlot;
+    *this = std::move(rotated);
 }
 
 Key256::Key256(Key256&& k)
     : _key{std::move(k._key)},
-      _keyingParameters{std::move(k._keyingParameters)} {}
+      _keyingParameters{std::move(k._keyingParameters)},
+      _dataKey{k._dataKey},
+      _keySlot{k._keySlot} {}
 
 Key256::Key256(const Key256& k)
-    : _key{k._key}, _keyingParameters{k._keyingParameters} {}
+    : _key{k._key},
+      _keyingParameters{k._keyingParameters},
+      _dataKey{k._dataKey},
+      _keySlot{k._keySlot} {}
 
 Key256& Key256::operator=(const Key256& k) {
     if (this == &k) return *this;
 
     _key = k._key;
-    _keyingParameters = k._key;
+    _keyingParameters = k._keyingParameters;
+    _dataKey = k._dataKey;
+    _keySlot = k._keySlot;
 
     return *this;
 }
@@ -243,6 +536,8 @@ Key256& Key256::operator=(Key256&& k) {
 
     _key = std::move(k._key);
     _keyingParameters = std::move(k._keyingParameters);
+    _dataKey = k._dataKey;
+    _keySlot = k._keySlot;
 
     return *this;
 }
@@ -30,6 +30,9 @@
 #ifndef _KEY256_HH
 #define _KEY256_HH 1
 
+#include <map>
+#include <vector>
+
 #include "key.hh"
 #include "securearray.hh"
 
@@ -49,7 +52,16 @@ namespace yapet {
  * The key uses the maximum length of 256bits (32bytes) allowed
  * for AES 256.
  *
- * The key is computed hashing the password using SHA-256
+ * The key is computed hashing the password using Argon2.
+ *
+ * If the keying parameters have \c YAPET::Consts::DATA_KEY_VERSION_KEY set,
+ * the key computed from the password is only used to wrap a random data key,
+ * which is stored in the keying parameters and used as key. Changing the
+ * password then only requires wrapping the same data key again.
+ *
+ * The data key may be wrapped several times, each time using another
+ * password, salt and cost parameters. A password is tried against these key
+ * slots in ascending order.
  *
  * This class does not support initialization vector by deriving it from the
  * password. When using this class, the initialization vector must be obtained
@@ -66,8 +78,23 @@ class Key256 : public Key {
 
     MetaData _keyingParameters;
 
+    //! Whether \c _key is the data key, rather than computed from the password
+    bool _dataKey;
+
+    //! The slot the data key has been unwrapped from, or -1
+    int _keySlot;
+
+    void wrapDataKey(int slot, const SecureArray& password,
+                     const MetaData& slotParameters,
+                     const SecureArray& dataKey);
+
    public:
+    //! Maximum number of key slots
+    static constexpr int MAX_KEY_SLOTS{8};
+
     static MetaData newDefaultKeyingParameters();
+    //! Whether \c parameters hold a wrapped data key
+    static bool hasWrappedDataKey(const MetaData& parameters);
 
     Key256();
 
@@ -84,6 +111,42 @@ class Key256 : public Key {
 
     void password(const SecureArray& password);
 
+    //! Whether the key is a data key wrapped by the keying parameters
+    bool isDataKey() const { return _dataKey; }
+
+    //! The slot the data key has been unwrapped from, or -1
+    int keySlot() const { return _keySlot; }
+    /**
+     * Wrap the data key using the key computed from \c password and \c
+     * parameters, replacing the password of \c slot.
+     */
+    void keySlot(int slot, const SecureArray& password,
+                 const MetaData& parameters);
+    //! The slots holding the wrapped data key, in ascending order
+    std::vector<int> keySlots() const;
+    //! The salt and cost parameters of \c slot
+    MetaData keySlotParameters(int slot) const;
+    /**
+     * Wrap the data key using the key computed from \c password and \c
+     * parameters in an unused slot.
+     *
+     * @return the slot used.
+     */
+    int addKeySlot(const SecureArray& password, const MetaData& parameters);
+    //! Remove the wrapped data key from \c slot, unless it is the last one
+    void removeKeySlot(int slot);
+    /**
+     * Replace the data key by a random one, wrapped into each used slot
+     * using the password of the slot and new default keying parameters.
+     *
+     * @param passwords the password of each used slot, by slot.
+     *
+     * @throw std::invalid_argument if a used slot has no password, or its
+     * password does not unwrap the current data key. The key is left
+     * unchanged then.
+     */
+    void rotateDataKey(const std::map<int, SecureArray>& passwords);
+
     SecureArray key() const { return _key; }
 
     SecureArray::size_type keySize() const { return _key.size(); }
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include "blockedthread.hh"
+#include "intl.h"
+#include "keyderivation.hh"
+
+using namespace yapet;
+
+struct KeyDerivation::State {
+    std::mutex mutex;
+    std::condition_variable done;
+    std::vector<std::shared_ptr<AbstractCryptoFactory>> results;
+    std::vector<std::exception_ptr> errors;
+    std::size_t pending{0};
+    bool started{false};
+    bool cancelled{false};
+};
+
+KeyDerivation::KeyDerivation(Notifier notifier, std::chrono::milliseconds tick)
+    : _state{new State}, _jobs{}, _notifier{notifier}, _tick{tick} {}
+
+KeyDerivation::~KeyDerivation() { cancel(); }
+
+std::size_t KeyDerivation::add(Job job) {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    if (_state->started) {
+        throw std::logic_error{_("Key derivation already started")};
+    }
+    _jobs.push_back(job);
+    return _jobs.size() - 1;
+}
+
+void KeyDerivation::start() {
+    {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        if (_state->started) {
+            throw std::logic_error{_("Key derivation already started")};
+        }
+        _state->started = true;
+        _state->pending = _jobs.size();
+        _state->results.resize(_jobs.size());
+        _state->errors.resize(_jobs.size());
+    }
+
+    // Threads only share the state, which outlives this object if jobs are
+    // still running when it is destroyed
+    auto state = _state;
+    for (std::size_t index = 0; index < _jobs.size(); index++) {
+        auto job = _jobs[index];
+        blockedThread([state, job, index]() {
+            std::shared_ptr<AbstractCryptoFactory> result;
+            std::exception_ptr error;
+            try {
+                result = job();
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock{state->mutex};
+            if (!state->cancelled) {
+                state->results[index] = result;
+                state->errors[index] = error;
+            }
+            state->pending--;
+            state->done.notify_all();
+        }).detach();
+    }
+    _jobs.clear();
+
+    if (!_notifier) return;
+    auto notifier = _notifier;
+    auto tick = _tick;
+    blockedThread([state, notifier, tick]() {
+        std::unique_lock<std::mutex> lock{state->mutex};
+        while (!state->cancelled) {
+            bool finished = state->done.wait_for(lock, tick, [&state]() {
+                return state->pending == 0 || state->cancelled;
+            });
+            if (state->cancelled) return;
+
+            lock.unlock();
+            notifier();
+            if (finished) return;
+            lock.lock();
+        }
+    }).detach();
+}
+
+bool KeyDerivation::finished() const {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    return _state->started && !_state->cancelled && _state->pending == 0;
+}
+
+void KeyDerivation::wait() const {
+    std::unique_lock<std::mutex> lock{_state->mutex};
+    _state->done.wait(lock, [this]() {
+        return _state->pending == 0 || _state->cancelled;
+    });
+}
+
+void KeyDerivation::cancel() {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    _state->cancelled = true;
+    _state->results.clear();
+    _state->errors.clear();
+    _state->done.notify_all();
+}
+
+bool KeyDerivation::cancelled() const {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    return _state->cancelled;
+}
+
+std::shared_ptr<AbstractCryptoFactory> KeyDerivation::result(
+    std::size_t index) const {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    if (!_state->started || _state->cancelled || _state->pending > 0) {
+        throw std::logic_error{_("Key derivation not finished")};
+    }
+    if (_state->errors.at(index)) {
+        std::rethrow_exception(_state->errors[index]);
+    }
+    return _state->results.at(index);
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _KEYDERIVATION_HH
+#define _KEYDERIVATION_HH
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "abstractcryptofactory.hh"
+
+namespace yapet {
+/**
+ * @brief Derives keys on worker threads
+ *
+ * Each job added runs on a thread of its own once \c start() is called, so
+ * several keys, e.g. the old and the new key when changing the password,
+ * are derived concurrently, and the calling thread is free to keep
+ * handling events.
+ *
+ * While jobs are running, the notifier is called from a worker thread
+ * every tick, and once more when all jobs are done. Worker threads block
+ * all signals, so a signal raised by the notifier is handled by one of the
+ * other threads, e.g. to wake up an event loop.
+ *
+ * Argon2 cannot be interrupted. Cancelling or destroying a derivation does
+ * not wait for the jobs still running: their results are discarded when
+ * they are done.
+ */
+class KeyDerivation {
+   public:
+    using Job = std::function<std::shared_ptr<AbstractCryptoFactory>()>;
+    using Notifier = std::function<void()>;
+
+   private:
+    struct State;
+    std::shared_ptr<State> _state;
+    std::vector<Job> _jobs;
+    Notifier _notifier;
+    std::chrono::milliseconds _tick;
+
+   public:
+    KeyDerivation(Notifier notifier = Notifier{},
+                  std::chrono::milliseconds tick =
+                      std::chrono::milliseconds{200});
+    ~KeyDerivation();
+
+    KeyDerivation(const KeyDerivation&) = delete;
+    KeyDerivation(KeyDerivation&&) = delete;
+    KeyDerivation& operator=(const KeyDerivation&) = delete;
+    KeyDerivation& operator=(KeyDerivation&&) = delete;
+
+    /**
+     * Add a job, which must not be called before \c start().
+     *
+     * @return the index of the job's result.
+     */
+    std::size_t add(Job job);
+
+    /**
+     * Start a thread for each job added.
+     */
+    void start();
+
+    /**
+     * Whether all jobs are done. Always \c false once cancelled.
+     */
+    bool finished() const;
+
+    /**
+     * Wait until all jobs are done or the derivation is cancelled.
+     */
+    void wait() const;
+
+    /**
+     * Abandon the jobs still running and discard all results.
+     */
+    void cancel();
+    bool cancelled() const;
+
+    /**
+     * The crypto factory returned by the job \c index.
+     *
+     * @throw the exception thrown by the job, if any.
+     *
+     * @throw std::logic_error if the derivation has not finished.
+     */
+    std::shared_ptr<AbstractCryptoFactory> result(std::size_t index) const;
+};
+}  // namespace yapet
+
+#endif
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <openssl/evp.h>
+
+#include "cryptoerror.hh"
+#include "intl.h"
+#include "keywrap.hh"
+#include "logger.hh"
+
+using namespace yapet;
+
+namespace {
+constexpr int KEY_SIZE{32};
+constexpr int SSL_SUCCESS{1};
+enum MODE { UNWRAP = 0, WRAP = 1 };
+
+/**
+ * Run AES key wrap on \c input. Returns an empty \c SecureArray if
+ * OpenSSL fails, which, when unwrapping, includes the integrity check.
+ */
+SecureArray keyWrap(const SecureArray& keyEncryptionKey,
+                    const SecureArray& input, MODE mode) {
+    if (keyEncryptionKey.size() != KEY_SIZE) {
+        throw CipherError{_("Invalid key encryption key size")};
+    }
+
+    EVP_CIPHER_CTX* context = EVP_CIPHER_CTX_new();
+    if (context == nullptr) {
+        throw CipherError{_("Error initializing cipher")};
+    }
+#ifdef EVP_CIPHER_CTX_FLAG_WRAP_ALLOW
+    EVP_CIPHER_CTX_set_flags(context, EVP_CIPHER_CTX_FLAG_WRAP_ALLOW);
+#endif
+
+    if (EVP_CipherInit_ex(context, EVP_aes_256_wrap(), nullptr,
+                          *keyEncryptionKey, nullptr, mode) != SSL_SUCCESS) {
+        EVP_CIPHER_CTX_free(context);
+        throw CipherError{_("Error initializing cipher")};
+    }
+
+    // Wrapping adds one block of eight bytes, unwrapping removes it.
+    SecureArray output{input.size() + 8};
+    int outputLength{0};
+    int finalLength{0};
+    auto success =
+        EVP_CipherUpdate(context, *output, &outputLength, *input,
+                         input.size()) == SSL_SUCCESS &&
+        EVP_CipherFinal_ex(context, *output + outputLength, &finalLength) ==
+            SSL_SUCCESS;
+    EVP_CIPHER_CTX_free(context);
+
+    if (!success || outputLength <= 0) return SecureArray{};
+
+    SecureArray result{outputLength + finalLength};
+    return result << output;
+}
+}  // namespace
+
+SecureArray yapet::wrapKey(const SecureArray& keyEncryptionKey,
+                           const SecureArray& key) {
+    if (key.size() != KEY_SIZE) {
+        throw CipherError{_("Invalid key size")};
+    }
+
+    auto wrappedKey{keyWrap(keyEncryptionKey, key, WRAP)};
+    if (wrappedKey.size() != WRAPPED_KEY_SIZE) {
+        LOG_MESSAGE(std::string{__func__} + ": Error wrapping key");
+        throw CipherError{_("Error wrapping key")};
+    }
+    return wrappedKey;
+}
+
+SecureArray yapet::unwrapKey(const SecureArray& keyEncryptionKey,
+                             const SecureArray& wrappedKey) {
+    if (wrappedKey.size() != WRAPPED_KEY_SIZE) {
+        throw EncryptionError{_("Invalid wrapped key size")};
+    }
+
+    auto key{keyWrap(keyEncryptionKey, wrappedKey, UNWRAP)};
+    if (key.size() != KEY_SIZE) {
+        LOG_MESSAGE(std::string{__func__} + ": Error unwrapping key");
+        throw EncryptionError{_("Error unwrapping key")};
+    }
+    return key;
+}
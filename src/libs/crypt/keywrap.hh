@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _KEYWRAP_HH
+#define _KEYWRAP_HH
+
+#include "securearray.hh"
+
+namespace yapet {
+/**
+ * Size of a key wrapped by \c wrapKey() in bytes. AES key wrap adds eight
+ * bytes of integrity check value to the key.
+ */
+constexpr int WRAPPED_KEY_SIZE{40};
+
+/**
+ * Wrap the 256 bits \c key using the 256 bits \c keyEncryptionKey, as
+ * specified by RFC 3394 (AES key wrap).
+ *
+ * @throw CipherError if the key cannot be wrapped.
+ */
+SecureArray wrapKey(const SecureArray& keyEncryptionKey,
+                    const SecureArray& key);
+
+/**
+ * Unwrap a key wrapped by \c wrapKey().
+ *
+ * @throw EncryptionError if \c wrappedKey has not been wrapped using \c
+ * keyEncryptionKey, or has been tampered with.
+ */
+SecureArray unwrapKey(const SecureArray& keyEncryptionKey,
+                      const SecureArray& wrappedKey);
+}  // namespace yapet
+
+#endif
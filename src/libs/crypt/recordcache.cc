@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cstring>
+
+#include "blockedthread.hh"
+#include "recordcache.hh"
+
+using namespace yapet;
+
+constexpr std::size_t RecordCache::SLOT_SIZE;
+
+RecordCache::RecordCache(std::size_t capacity, std::chrono::seconds ttl)
+    : _ttl{ttl},
+      _entries{capacity, SLOT_SIZE},
+      _hits{0},
+      _misses{0},
+      _mutex{},
+      _sweep{},
+      _stopping{false},
+      _sweeper{} {
+    if (capacity == 0) return;
+
+    _sweeper = blockedThread(&RecordCache::sweep, this);
+}
+
+RecordCache::~RecordCache() {
+    if (!_sweeper.joinable()) return;
+
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _stopping = true;
+    }
+    _sweep.notify_one();
+    _sweeper.join();
+}
+
+void RecordCache::sweep() {
+    std::unique_lock<std::mutex> lock{_mutex};
+    while (!_stopping) {
+        if (_entries.empty()) {
+            _sweep.wait(lock);
+        } else {
+            // Entries expire once idle for longer than the time-to-live, so
+            // wake up just past the deadline of the least recently used one.
+            _sweep.wait_until(lock,
+                              _entries.leastRecentlyUsed()->lastUsed + _ttl +
+                                  std::chrono::milliseconds{1});
+        }
+        _entries.expire(Clock::now(), _ttl);
+    }
+}
+
+PasswordRecord RecordCache::get(
+    const PasswordListItem& item,
+    const std::shared_ptr<AbstractCryptoFactory>& cryptoFactory) {
+    return get(item, cryptoFactory, Clock::now());
+}
+
+PasswordRecord RecordCache::get(
+    const PasswordListItem& item,
+    const std::shared_ptr<AbstractCryptoFactory>& cryptoFactory,
+    Clock::time_point now) {
+    const auto& encryptedRecord{item.encryptedRecord()};
+    std::string cipherText{reinterpret_cast<const char*>(*encryptedRecord),
+                           static_cast<std::size_t>(encryptedRecord.size())};
+
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _entries.expire(now, _ttl);
+
+        auto entry{_entries.find(cipherText)};
+        if (entry != _entries.end()) {
+            _entries.touch(entry, now);
+            _hits++;
+
+            SecureArray plainText{
+                static_cast<SecureArray::size_type>(entry->size)};
+            std::memcpy(*plainText, _entries.data(entry), entry->size);
+            return PasswordRecord{plainText};
+        }
+        _misses++;
+    }
+
+    // Decrypt without holding the lock, other threads may look up records
+    // meanwhile.
+    auto crypto{cryptoFactory->crypto()};
+    auto plainText{crypto->decrypt(encryptedRecord)};
+    // Throws on invalid records, which are thus never cached
+    PasswordRecord passwordRecord{plainText};
+
+    if (_entries.capacity() > 0 &&
+        plainText.size() <= static_cast<SecureArray::size_type>(SLOT_SIZE)) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        // Another thread may have cached the record meanwhile
+        if (_entries.find(cipherText) == _entries.end()) {
+            _entries.store(cipherText, *plainText,
+                           static_cast<std::size_t>(plainText.size()), now);
+            _sweep.notify_one();
+        }
+    }
+
+    return passwordRecord;
+}
+
+void RecordCache::expire() { expire(Clock::now()); }
+
+void RecordCache::expire(Clock::time_point now) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _entries.expire(now, _ttl);
+}
+
+void RecordCache::flush() {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _entries.clear();
+}
+
+std::size_t RecordCache::size() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _entries.size();
+}
+
+std::uint64_t RecordCache::hits() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _hits;
+}
+
+std::uint64_t RecordCache::misses() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _misses;
+}
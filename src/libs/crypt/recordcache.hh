@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _RECORDCACHE_HH
+#define _RECORDCACHE_HH
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "abstractcryptofactory.hh"
+#include "lockedlru.hh"
+#include "passwordlistitem.hh"
+#include "passwordrecord.hh"
+
+namespace yapet {
+/**
+ * Least recently used cache of decrypted password records.
+ *
+ * Records are looked up by their encrypted form, so an altered record
+ * never hits the stale entry of its previous version. Decrypted records are
+ * kept in a \c LockedLru, so they are locked into memory if possible,
+ * excluded from core dumps and zeroed whenever an entry is dropped.
+ *
+ * Entries not used for longer than the time-to-live are dropped by a
+ * background thread, whether or not the cache is used meanwhile. The cache
+ * does not know about the key used to decrypt the records, so it has to be
+ * flushed when the key changes.
+ *
+ * The cache is safe to be used by several threads.
+ */
+class RecordCache {
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * The size of a slot holding a decrypted record.
+     */
+    static constexpr std::size_t SLOT_SIZE{PasswordRecord::TAGGED_TOTAL_SIZE};
+
+   private:
+    Clock::duration _ttl;
+    // Keyed by the encrypted record
+    LockedLru<> _entries;
+    std::uint64_t _hits;
+    std::uint64_t _misses;
+    mutable std::mutex _mutex;
+    // Wakes the sweeper when an entry is stored or the cache is destroyed
+    std::condition_variable _sweep;
+    bool _stopping;
+    std::thread _sweeper;
+
+    void sweep();
+
+   public:
+    /**
+     * @param capacity the number of records cached. A capacity of zero
+     * disables the cache.
+     *
+     * @param ttl the time entries not used are kept.
+     */
+    RecordCache(std::size_t capacity, std::chrono::seconds ttl);
+    ~RecordCache();
+
+    RecordCache(const RecordCache&) = delete;
+    RecordCache(RecordCache&&) = delete;
+    RecordCache& operator=(const RecordCache&) = delete;
+    RecordCache& operator=(RecordCache&&) = delete;
+
+    /**
+     * Get the decrypted record of \c item, decrypting it using a \c Crypto
+     * of \c cryptoFactory if it is not cached.
+     *
+     * @throw DeserializationError if the decrypted record is invalid.
+     */
+    PasswordRecord get(
+        const PasswordListItem& item,
+        const std::shared_ptr<AbstractCryptoFactory>& cryptoFactory);
+    PasswordRecord get(
+        const PasswordListItem& item,
+        const std::shared_ptr<AbstractCryptoFactory>& cryptoFactory,
+        Clock::time_point now);
+
+    /**
+     * Drop the entries not used for longer than the time-to-live.
+     *
+     * The cache expires entries on its own, this merely does it right away.
+     */
+    void expire();
+    void expire(Clock::time_point now);
+
+    /**
+     * Drop all entries. Hit and miss counters are kept.
+     */
+    void flush();
+
+    std::size_t size() const;
+    std::size_t capacity() const { return _entries.capacity(); }
+    std::uint64_t hits() const;
+    std::uint64_t misses() const;
+
+    /**
+     * Whether or not the memory holding decrypted records could be locked
+     * into memory.
+     */
+    bool locked() const { return _entries.locked(); }
+};
+}  // namespace yapet
+
+#endif
@@ -27,11 +27,14 @@
  * well as that of the covered work.
  */
 
+#include <unistd.h>
 #include <cstdio>
 
 #include "consts.h"
 #include "fileerror.hh"
 #include "filehelper.hh"
+#include "fileutils.hh"
+#include "logger.hh"
 #include "yapet10file.hh"
 #include "yapet20file.hh"
 
@@ -88,8 +91,122 @@ std::shared_ptr<YapetFile> yapet::getFile(const std::string& filename,
     throw FileFormatError(msg);
 }
 
+namespace {
+constexpr char HEADER_FILE_SUFFIX[]{".hdr"};
+
+std::string headerFilename(const std::string& filename) {
+    return filename + HEADER_FILE_SUFFIX;
+}
+
+bool fileExists(const std::string& filename) {
+    return ::access(filename.c_str(), F_OK) == 0;
+}
+
+/**
+ * Overwrite the meta data and header of \c filename, which must have the
+ * sizes of the meta data and header already stored, and flush the file to
+ * disk.
+ */
+void writeHeader(const std::string& filename, const SecureArray& metaData,
+                 const SecureArray& header) {
+    {
+        Yapet20File file{filename, false, false};
+        file.open();
+        file.writeUnencryptedMetaData(metaData);
+        file.writeHeader(header);
+    }
+    syncFile(filename);
+}
+}  // namespace
+
 MetaData yapet::readMetaData(const std::string& filename, bool secure) {
+    recoverHeader(filename);
+
     auto yapetFile{getFile(filename, secure)};
     yapetFile->open();
     return yapetFile->readUnencryptedMetaData();
-}
\ No newline at end of file
+}
+/**
+ * Replace the meta data and header of the YAPET 2.0 file \c filename,
+ * leaving the records in place.
+ *
+ * The new meta data and header are first written to a side file, which is
+ * flushed to disk and renamed to \c filename followed by \c .hdr. Then the
+ * file is overwritten in place and flushed, and the side file is removed. A
+ * header left partially written by a crash is completed by \c
+ * recoverHeader().
+ *
+ * @return \c false, leaving the file as it is, if it is not a YAPET 2.0 file
+ * or the size of \c metaData or \c header differs from the size stored.
+ */
+bool yapet::rewriteHeaderInPlace(const std::string& filename,
+                                 const SecureArray& metaData,
+                                 const SecureArray& header) {
+    {
+        Yapet20File file{filename, false, false};
+        try {
+            file.open();
+        } catch (FileFormatError&) {
+            return false;
+        }
+
+        if (file.readUnencryptedMetaData().size() != metaData.size() ||
+            file.readHeader().size() != header.size()) {
+            return false;
+        }
+    }
+
+    auto sideFilename{headerFilename(filename)};
+    std::string temporaryFilename{sideFilename + ".tmp"};
+    try {
+        {
+            Yapet20File sideFile{temporaryFilename, true, true};
+            sideFile.open();
+            sideFile.writeIdentifier();
+            sideFile.writeUnencryptedMetaData(metaData);
+            sideFile.writeHeader(header);
+        }
+        syncFile(temporaryFilename);
+        renameFile(temporaryFilename, sideFilename);
+    } catch (...) {
+        std::remove(temporaryFilename.c_str());
+        throw;
+    }
+    syncDirectory(sideFilename);
+
+    writeHeader(filename, metaData, header);
+
+    std::remove(sideFilename.c_str());
+    syncDirectory(filename);
+    return true;
+}
+
+/**
+ * Complete a header rewrite of \c filename interrupted by a crash.
+ *
+ * A side file left by \c rewriteHeaderInPlace() was flushed to disk before
+ * the file was touched, so its meta data and header are written to the file
+ * again. A temporary side file was never used and is removed.
+ */
+void yapet::recoverHeader(const std::string& filename) {
+    auto sideFilename{headerFilename(filename)};
+    std::remove((sideFilename + ".tmp").c_str());
+    if (!fileExists(sideFilename)) {
+        return;
+    }
+
+    SecureArray metaData;
+    SecureArray header;
+    {
+        Yapet20File sideFile{sideFilename, false, false};
+        sideFile.open();
+        metaData = sideFile.readUnencryptedMetaData();
+        header = sideFile.readHeader();
+    }
+
+    LOG_MESSAGE(std::string{__func__} + ": " + filename);
+    writeHeader(filename, metaData, header);
+
+    std::remove(sideFilename.c_str());
+    syncDirectory(filename);
+}
@@ -41,6 +41,10 @@ SecureArray readFileIdentifier(const std::string& filename);
 bool isFileType(const SecureArray& expected, const std::string& filename);
 std::shared_ptr<YapetFile> getFile(const std::string& filename, bool secure);
 MetaData readMetaData(const std::string& filename, bool secure);
+bool rewriteHeaderInPlace(const std::string& filename,
+                          const SecureArray& metaData,
+                          const SecureArray& header);
+void recoverHeader(const std::string& filename);
 }  // namespace yapet
 
 #endif
\ No newline at end of file
@@ -27,6 +27,7 @@
  * well as that of the covered work.
  */
 
+#include <fcntl.h>
 #include <stdio.h>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -124,4 +125,49 @@ void yapet::renameFile(const std::string& oldName, const std::string& newName) {
                       _("Cannot rename file '%s'"), oldName.c_str());
         throw FileError{msg, errno};
     }
-}
\ No newline at end of file
+}
+
+namespace {
+void syncPath(const std::string& path, int flags) {
+    int fd = ::open(path.c_str(), flags);
+    if (fd < 0 || ::fsync(fd) != 0) {
+        int savedErrno = errno;
+        if (fd >= 0) ::close(fd);
+
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Unable to flush data to file '%s'"), path.c_str());
+        throw FileError{msg, savedErrno};
+    }
+    ::close(fd);
+}
+}  // namespace
+
+/**
+ * Flush the content of \c filename to disk.
+ */
+void yapet::syncFile(const std::string& filename) {
+    syncPath(filename, O_RDONLY);
+}
+
+/**
+ * Flush the directory containing \c filename to disk, so that a file
+ * created or renamed in it survives a crash.
+ */
+void yapet::syncDirectory(const std::string& filename) {
+    auto separator{filename.rfind('/')};
+    std::string directory;
+    if (separator == std::string::npos) {
+        directory = ".";
+    } else if (separator == 0) {
+        directory = "/";
+    } else {
+        directory = filename.substr(0, separator);
+    }
+
+#ifdef O_DIRECTORY
+    syncPath(directory, O_RDONLY | O_DIRECTORY);
+#else
+    syncPath(directory, O_RDONLY);
+#endif
+}
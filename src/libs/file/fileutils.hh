@@ -39,6 +39,8 @@ std::int64_t getModificationTime(const std::string& filename);
 std::uint32_t getFileSize(const std::string& filename);
 bool hasSecurePermissions(const std::string& filename);
 void renameFile(const std::string& oldName, const std::string& newName);
+void syncFile(const std::string& filename);
+void syncDirectory(const std::string& filename);
 }  // namespace yapet
 
 #endif
\ No newline at end of file
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+
+#include "consts.h"
+#include "fileerror.hh"
+#include "intl.h"
+#include "logger.hh"
+#include "mappedfile.hh"
+
+using namespace yapet;
+
+namespace {
+[[noreturn]] void throwFileError(const char* format,
+                                 const std::string& filename,
+                                 int errorNumber) {
+    char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+    std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE, format,
+                  filename.c_str());
+    throw FileError{msg, errorNumber};
+}
+}  // namespace
+
+MappedFile::MappedFile(const std::string& filename, Access access)
+    : _filename{filename}, _data{nullptr}, _size{0} {
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throwFileError(_("Cannot open '%s'"), filename, errno);
+    }
+
+    struct stat fileStat;
+    if (::fstat(fd, &fileStat) != 0) {
+        auto error = errno;
+        ::close(fd);
+        throwFileError(_("Unable to get stat for file '%s'"), filename, error);
+    }
+
+    _size = static_cast<std::size_t>(fileStat.st_size);
+    if (_size == 0) {
+        ::close(fd);
+        return;
+    }
+
+    void* mapping = ::mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0);
+    auto error = errno;
+    // The mapping stays valid after closing the file descriptor
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        _size = 0;
+        throwFileError(_("Cannot map '%s' into memory"), filename, error);
+    }
+
+#ifdef HAVE_MADVISE
+    ::madvise(mapping, _size,
+              access == Access::RANDOM ? MADV_RANDOM : MADV_SEQUENTIAL);
+#else
+    (void)access;
+#endif
+
+    _data = static_cast<const std::uint8_t*>(mapping);
+    LOG_MESSAGE(std::string{__func__} + ": mapped " + filename);
+}
+
+MappedFile::~MappedFile() { unmap(); }
+
+MappedFile::MappedFile(MappedFile&& other)
+    : _filename{std::move(other._filename)},
+      _data{other._data},
+      _size{other._size} {
+    other._data = nullptr;
+    other._size = 0;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) {
+    if (this == &other) {
+        return *this;
+    }
+
+    unmap();
+
+    _filename = std::move(other._filename);
+    _data = other._data;
+    _size = other._size;
+    other._data = nullptr;
+    other._size = 0;
+
+    return *this;
+}
+
+void MappedFile::unmap() noexcept {
+    if (_data == nullptr) return;
+
+    ::munmap(const_cast<std::uint8_t*>(_data), _size);
+    _data = nullptr;
+    _size = 0;
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _MAPPEDFILE_HH
+#define _MAPPEDFILE_HH
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace yapet {
+/**
+ * Read-only memory mapping of an entire file.
+ *
+ * Used for large, read-mostly data files like dictionaries or hash corpora,
+ * which are looked up without reading them into memory.
+ */
+class MappedFile {
+   public:
+    /**
+     * Expected access pattern, passed on to the kernel as advice.
+     */
+    enum class Access { RANDOM, SEQUENTIAL };
+
+   private:
+    std::string _filename;
+    const std::uint8_t* _data;
+    std::size_t _size;
+
+    void unmap() noexcept;
+
+   public:
+    MappedFile(const std::string& filename, Access access = Access::RANDOM);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other);
+    MappedFile& operator=(MappedFile&& other);
+
+    /**
+     * Start of the mapping. \c nullptr if the file is empty.
+     */
+    const std::uint8_t* data() const { return _data; }
+    std::size_t size() const { return _size; }
+    const std::string& filename() const { return _filename; }
+};
+}  // namespace yapet
+
+#endif
@@ -195,6 +195,16 @@ void Yapet10File::writeHeader(const SecureArray& header) {
 
 void Yapet10File::writePasswordRecords(
     const std::list<SecureArray>& passwords) {
+    beginPasswordRecords();
+
+    for (const auto& password : passwords) {
+        writePasswordRecord(password);
+    }
+
+    endPasswordRecords();
+}
+
+void Yapet10File::beginPasswordRecords() {
     // This will position the file pointer on to the size indicator of the first
     // password record
     readHeader();
@@ -214,12 +224,14 @@ void Yapet10File::writePasswordRecords(
 
     rawFile.openExisting();
     rawFile.seekAbsolute(trimSize);
+}
 
-    for (auto password : passwords) {
-        rawFile.write(password);
-    }
+void Yapet10File::writePasswordRecord(const SecureArray& password) {
+    getRawFile().write(password);
+}
 
-    rawFile.flush();
+void Yapet10File::endPasswordRecords() {
+    getRawFile().flush();
     LOG_MESSAGE(std::string{__func__} + ": " + getRawFile().filename());
 }
 
@@ -86,6 +86,10 @@ class Yapet10File : public YapetFile {
 
     virtual void writePasswordRecords(const std::list<SecureArray>& passwords);
 
+    virtual void beginPasswordRecords();
+    virtual void writePasswordRecord(const SecureArray& password);
+    virtual void endPasswordRecords();
+
     virtual int recognitionStringSize() const;
     virtual const uint8_t* recognitionString() const;
 };
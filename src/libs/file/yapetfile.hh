@@ -110,6 +110,25 @@ class YapetFile {
     virtual void writePasswordRecords(
         const std::list<SecureArray>& passwords) = 0;
 
+    /**
+     * Start writing password records one at a time.
+     *
+     * Discards all password records stored in the file. Records are then
+     * appended using \c writePasswordRecord() and the write is completed by
+     * \c endPasswordRecords().
+     */
+    virtual void beginPasswordRecords() = 0;
+
+    /**
+     * Append a single password record
+     */
+    virtual void writePasswordRecord(const SecureArray& password) = 0;
+
+    /**
+     * Complete writing password records
+     */
+    virtual void endPasswordRecords() = 0;
+
     bool isSecure() const { return _secure; }
 
     bool isCreate() const { return _create; }
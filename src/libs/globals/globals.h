@@ -54,6 +54,17 @@ class Globals {
  * @see PromptPassword
  */
 const YACURS::EventType EVT_APOPTOSIS("EVT_APOPTOSIS");
+
+/**
+ * Submitted by a KeyDerivationDialog once all keys are derived.
+ *
+ * Keys are derived on worker threads, which cannot submit events
+ * themselves. They raise SIGUSR1 instead, and the dialog submits this
+ * event from the event loop.
+ *
+ * @see KeyDerivationDialog
+ */
+const YACURS::EventType EVT_KEYS_DERIVED("EVT_KEYS_DERIVED");
 }  // namespace YAPET
 
 #endif  // _MAINWINDOW_H
@@ -28,16 +28,13 @@
  */
 
 #include <cassert>
-#include <cstdio>
 #include <memory>
 #include <typeinfo>
+#include <vector>
 
-#include "aes256factory.hh"
 #include "cfg.h"
 #include "changepassword.h"
 #include "cryptofactoryhelper.hh"
-#include "fileerror.hh"
-#include "filehelper.hh"
 #include "globals.h"
 #include "intl.h"
 #include "logger.hh"
@@ -56,60 +53,18 @@ void ChangePassword::window_close_handler(YACURS::Event& e) {
 
     if (evt.data() == promptoldpassword) {
         if (promptoldpassword->dialog_state() == YACURS::DIALOG_OK) {
-            try {
-                assert(!_oldCryptoFactory);
-
-                auto oldPassword{
-                    yapet::toSecureArray(promptoldpassword->password())};
-
-                _oldCryptoFactory = yapet::getCryptoFactoryForFile(
-                    _currentFilename, oldPassword);
-                if (!_oldCryptoFactory) {
-                    char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
-                    std::snprintf(msg,
-                                  YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
-                                  _("File '%s' not recognized"),
-                                  _currentFilename.c_str());
-                    throw yapet::FileFormatError{msg};
-                }
-
-                try {
-                    LOG_MESSAGE(std::string{__func__} + ": test old password");
-                    // Test if we can read the file with the old password
-                    YAPET::File{_oldCryptoFactory, _currentFilename, false,
-                                YAPET::Globals::config.filesecurity};
-
-                    assert(promptpassword == nullptr);
-                    promptpassword = new NewPasswordDialog(_currentFilename);
-                    promptpassword->show();
-                } catch (yapet::InvalidPasswordError& e) {
-                    LOG_MESSAGE(std::string{__func__} +
-                                ": old password does not match");
-                    assert(nonmatch == nullptr);
-                    nonmatch = new YACURS::MessageBox2(
-                        _("Error"), _("Password does not match old password"),
-                        _("Retry?"), YACURS::YESNO);
-                    nonmatch->show();
-                    _oldCryptoFactory.reset();
-                }
-            } catch (std::exception& ex) {
-                assert(generror == nullptr);
-                generror = new YACURS::MessageBox2(_("Error"),
-                                                   _("Got following error"),
-                                                   ex.what(), YACURS::OK_ONLY);
-                generror->show();
-            }
+            _oldPassword = yapet::toSecureArray(promptoldpassword->password());
+
+            assert(promptpassword == nullptr);
+            promptpassword = new NewPasswordDialog(_currentFilename);
+            promptpassword->show();
         } else {
             YACURS::EventQueue::submit(
                 YACURS::EventEx<ChangePassword*>(YAPET::EVT_APOPTOSIS, this));
         }
 
-        // Do not put aptoptosis here, since here we can't decide
-        // whether we had an exception or not. And if we had an
-        // exception, generror is active and we have to wait for the
-        // user to close it.
-
         yapet::deleteAndZero(&promptoldpassword);
+        return;
     }
 
     if (evt.data() == nonmatch) {
@@ -121,6 +76,7 @@ void ChangePassword::window_close_handler(YACURS::Event& e) {
         }
 
         yapet::deleteAndZero(&nonmatch);
+        return;
     }
 
     if (evt.data() == promptpassword) {
@@ -128,55 +84,45 @@ void ChangePassword::window_close_handler(YACURS::Event& e) {
             assert(promptpassword->match());
             assert(!_currentFilename.empty());
 
-            try {
-                assert(_oldCryptoFactory);
-                auto newPassword{
-                    yapet::toSecureArray(promptpassword->password())};
-
-                auto newKeyingParameters{
-                    yapet::Key256::newDefaultKeyingParameters()};
-                std::shared_ptr<yapet::AbstractCryptoFactory> newCryptoFactory{
-                    new yapet::Aes256Factory{newPassword, newKeyingParameters}};
-
-                // Try to open the current file with new password, if that
-                // succeeds, the new and old password are the same and we do
-                // nothing
-                try {
-                    LOG_MESSAGE(std::string{__func__} +
-                                ": test if new password is same as old");
-                    auto _existingKeyingParameters{yapet::readMetaData(
-                        _currentFilename, YAPET::Globals::config.filesecurity)};
-                    auto _oldCryptoFactoryWithNewPassword{
-                        _oldCryptoFactory->newFactory(
-                            newPassword, _existingKeyingParameters)};
-                    YAPET::File{_oldCryptoFactoryWithNewPassword,
-                                _currentFilename, false,
-                                YAPET::Globals::config.filesecurity};
-                    YACURS::Curses::statusbar()->set(
-                        _("Password not changed. Old and new password "
-                          "identical."));
-                } catch (yapet::InvalidPasswordError& e) {
-                    mainwindow.change_password(newCryptoFactory);
-                }
+            auto oldPassword{_oldPassword};
+            auto newPassword{yapet::toSecureArray(promptpassword->password())};
+            std::string filename{_currentFilename};
+            bool filesecurity{YAPET::Globals::config.filesecurity};
 
-                YACURS::EventQueue::submit(YACURS::EventEx<ChangePassword*>(
-                    YAPET::EVT_APOPTOSIS, this));
-            } catch (std::exception& ex) {
-                assert(generror == nullptr);
-                generror = new YACURS::MessageBox2(_("Error"),
-                                                   _("Got following error"),
-                                                   ex.what(), YACURS::OK_ONLY);
-                generror->show();
+            // The old key is only derived to test the old password. If the
+            // new password is the same, there is nothing else to derive.
+            std::vector<yapet::KeyDerivation::Job> jobs{
+                [oldPassword, filename, filesecurity]() {
+                    LOG_MESSAGE("ChangePassword: test old password");
+                    return yapet::getVerifiedCryptoFactoryForFile(
+                        filename, oldPassword, filesecurity);
+                }};
+            _samePassword = newPassword == oldPassword;
+            if (!_samePassword) {
+                jobs.push_back(
+                    mainwindow.newPasswordKeyDerivation(newPassword));
             }
-        }
 
-        // Do not put aptoptosis here, since here we can't decide
-        // whether we had an exception or not. And if we had an
-        // exception, generror is active and we have to wait for the
-        // user to close it.
+            assert(derivationdialog == nullptr);
+            derivationdialog = new KeyDerivationDialog{
+                _("Changing password, please wait"), jobs};
+            derivationdialog->show();
+        } else {
+            YACURS::EventQueue::submit(
+                YACURS::EventEx<ChangePassword*>(YAPET::EVT_APOPTOSIS, this));
+        }
 
         yapet::deleteAndZero(&promptpassword);
+        return;
+    }
 
+    if (derivationdialog != nullptr && evt.data() == derivationdialog) {
+        // Closing with OK only hides the dialog, the keys are still derived
+        if (derivationdialog->cancelled()) {
+            yapet::deleteAndZero(&derivationdialog);
+            YACURS::EventQueue::submit(
+                YACURS::EventEx<ChangePassword*>(YAPET::EVT_APOPTOSIS, this));
+        }
         return;
     }
 
@@ -207,6 +153,56 @@ void ChangePassword::window_close_handler(YACURS::Event& e) {
     }
 }
 
+void ChangePassword::keys_derived_handler(YACURS::Event& e) {
+    assert(e == YAPET::EVT_KEYS_DERIVED);
+
+    YACURS::EventEx<KeyDerivationDialog*>& evt =
+        dynamic_cast<YACURS::EventEx<KeyDerivationDialog*>&>(e);
+
+    if (derivationdialog == nullptr || evt.data() != derivationdialog) return;
+
+    try {
+        try {
+            // Throws if the old password does not match
+            derivationdialog->result(0);
+        } catch (yapet::InvalidPasswordError&) {
+            LOG_MESSAGE(std::string{__func__} +
+                        ": old password does not match");
+            assert(nonmatch == nullptr);
+            nonmatch = new YACURS::MessageBox2(
+                _("Error"), _("Password does not match old password"),
+                _("Retry?"), YACURS::YESNO);
+            nonmatch->show();
+            yapet::deleteAndZero(&derivationdialog);
+            return;
+        }
+
+        if (_samePassword) {
+            YACURS::Curses::statusbar()->set(
+                _("Password not changed. Old and new password identical."));
+        } else {
+            auto newCryptoFactory{derivationdialog->result(1)};
+            mainwindow.change_password(newCryptoFactory);
+        }
+
+        YACURS::EventQueue::submit(
+            YACURS::EventEx<ChangePassword*>(YAPET::EVT_APOPTOSIS, this));
+    } catch (std::exception& ex) {
+        assert(generror == nullptr);
+        generror =
+            new YACURS::MessageBox2(_("Error"), _("Got following error"),
+                                    ex.what(), YACURS::OK_ONLY);
+        generror->show();
+    }
+
+    // Do not put aptoptosis here, since here we can't decide
+    // whether we had an exception or not. And if we had an
+    // exception, generror is active and we have to wait for the
+    // user to close it.
+
+    yapet::deleteAndZero(&derivationdialog);
+}
+
 //
 // Public
 //
@@ -215,20 +211,27 @@ ChangePassword::ChangePassword(MainWindow& mw)
     : mainwindow{mw},
       promptoldpassword{nullptr},
       promptpassword{nullptr},
+      derivationdialog{nullptr},
       nonmatch{nullptr},
       confirmsave{nullptr},
       generror{nullptr},
       _currentFilename{mw.currentFilename()},
-      _oldCryptoFactory{nullptr} {
+      _oldPassword{},
+      _samePassword{false} {
     YACURS::EventQueue::connect_event(
         YACURS::EventConnectorMethod1<ChangePassword>(
             YACURS::EVT_WINDOW_CLOSE, this,
             &ChangePassword::window_close_handler));
+    YACURS::EventQueue::connect_event(
+        YACURS::EventConnectorMethod1<ChangePassword>(
+            YAPET::EVT_KEYS_DERIVED, this,
+            &ChangePassword::keys_derived_handler));
 }
 
 ChangePassword::~ChangePassword() {
     if (promptoldpassword) delete promptoldpassword;
     if (promptpassword) delete promptpassword;
+    if (derivationdialog) delete derivationdialog;
     if (nonmatch) delete nonmatch;
     if (confirmsave) delete confirmsave;
     if (generror) delete generror;
@@ -237,6 +240,10 @@ ChangePassword::~ChangePassword() {
         YACURS::EventConnectorMethod1<ChangePassword>(
             YACURS::EVT_WINDOW_CLOSE, this,
             &ChangePassword::window_close_handler));
+    YACURS::EventQueue::disconnect_event(
+        YACURS::EventConnectorMethod1<ChangePassword>(
+            YAPET::EVT_KEYS_DERIVED, this,
+            &ChangePassword::keys_derived_handler));
 }
 
 void ChangePassword::run() {
@@ -32,6 +32,7 @@
 
 #include <memory>
 
+#include "keyderivationdialog.h"
 #include "mainwindow.h"
 #include "newpassworddialog.h"
 #include "passworddialog.h"
@@ -45,24 +46,29 @@
  * 1. if the currently open file has pending changes, it asks whether
  *    the changes should be saved, or the users wishes to cancel.
  *
- * 2. prompt for the old password, if it doesn't match show error
+ * 2. prompt for the old password and the new password.
  *
- * 2. If old password matches, show new password prompt.
+ * 3. derive the old and the new key concurrently, while showing a
+ *    KeyDerivationDialog. If the old password doesn't match, show error.
  */
 class ChangePassword {
    private:
     MainWindow& mainwindow;
     PasswordDialog* promptoldpassword;
     NewPasswordDialog* promptpassword;
+    KeyDerivationDialog* derivationdialog;
     YACURS::MessageBox2* nonmatch;
     YACURS::MessageBox3* confirmsave;
     YACURS::MessageBox2* generror;
 
     std::string _currentFilename;
-    std::shared_ptr<yapet::AbstractCryptoFactory> _oldCryptoFactory;
+    yapet::SecureArray _oldPassword;
+    bool _samePassword;
 
     void window_close_handler(YACURS::Event& e);
 
+    void keys_derived_handler(YACURS::Event& e);
+
    public:
     ChangePassword(MainWindow& mw);
     ChangePassword(const ChangePassword&) = delete;
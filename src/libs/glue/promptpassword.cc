@@ -30,11 +30,8 @@
 #include "promptpassword.h"
 
 #include <cassert>
-#include <cstdio>
 
 #include "cryptofactoryhelper.hh"
-#include "file.hh"
-#include "fileerror.hh"
 #include "globals.h"
 #include "intl.h"
 #include "utils.hh"
@@ -52,44 +49,19 @@ void PromptPassword::window_close_handler(YACURS::Event& e) {
 
     if (pwdialog != nullptr && evt.data() == pwdialog) {
         if (pwdialog->dialog_state() == YACURS::DIALOG_OK) {
-            try {
-                yapet::SecureArray password{
-                    yapet::toSecureArray(pwdialog->password().c_str())};
-
-                std::shared_ptr<yapet::AbstractCryptoFactory> cryptoFactory{
-                    yapet::getCryptoFactoryForFile(_filename, password)};
-
-                if (!cryptoFactory) {
-                    char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
-                    std::snprintf(
-                        msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
-                        _("File '%s' not recognized"), _filename.c_str());
-                    throw yapet::FileFormatError{msg};
-                }
-
-                // This will raise an exception if password is wrong
-                YAPET::File{cryptoFactory, _filename, false,
-                            YAPET::Globals::config.filesecurity};
-
-                // We were able to open the file with the given password,
-                // remember that cryptFactory
-                _cryptoFactory = cryptoFactory;
-                YACURS::EventQueue::submit(YACURS::EventEx<PromptPassword*>(
-                    YAPET::EVT_APOPTOSIS, this));
-            } catch (yapet::InvalidPasswordError& ex) {
-                assert(pwerror == nullptr);
-                pwerror = new YACURS::MessageBox3(
-                    _("Invalid Password"), _("Password for file"), _filename,
-                    _("is not correct. Do you want to try again?"),
-                    YACURS::YESNO);
-                pwerror->show();
-            } catch (std::exception& ex) {
-                assert(generror == nullptr);
-                generror = new YACURS::MessageBox2(_("Error"),
-                                                   _("Got following error"),
-                                                   ex.what(), YACURS::OK_ONLY);
-                generror->show();
-            }
+            yapet::SecureArray password{
+                yapet::toSecureArray(pwdialog->password().c_str())};
+            std::string filename{_filename};
+            bool filesecurity{YAPET::Globals::config.filesecurity};
+
+            assert(derivationdialog == nullptr);
+            derivationdialog = new KeyDerivationDialog{
+                _("Opening file, please wait"),
+                {[password, filename, filesecurity]() {
+                    return yapet::getVerifiedCryptoFactoryForFile(
+                        filename, password, filesecurity);
+                }}};
+            derivationdialog->show();
         } else {
             // User pressed Cancel
 
@@ -101,6 +73,16 @@ void PromptPassword::window_close_handler(YACURS::Event& e) {
         return;
     }
 
+    if (derivationdialog != nullptr && evt.data() == derivationdialog) {
+        // Closing with OK only hides the dialog, the key is still derived
+        if (derivationdialog->cancelled()) {
+            yapet::deleteAndZero(&derivationdialog);
+            YACURS::EventQueue::submit(
+                YACURS::EventEx<PromptPassword*>(YAPET::EVT_APOPTOSIS, this));
+        }
+        return;
+    }
+
     if (pwerror && evt.data() == pwerror) {
         if (pwerror->dialog_state() == YACURS::DIALOG_YES) {
             run();
@@ -119,12 +101,44 @@ void PromptPassword::window_close_handler(YACURS::Event& e) {
     }
 }
 
+void PromptPassword::keys_derived_handler(YACURS::Event& e) {
+    assert(e == YAPET::EVT_KEYS_DERIVED);
+
+    YACURS::EventEx<KeyDerivationDialog*>& evt =
+        dynamic_cast<YACURS::EventEx<KeyDerivationDialog*>&>(e);
+
+    if (derivationdialog == nullptr || evt.data() != derivationdialog) return;
+
+    try {
+        // We were able to open the file with the given password,
+        // remember that cryptFactory
+        _cryptoFactory = derivationdialog->result(0);
+        YACURS::EventQueue::submit(
+            YACURS::EventEx<PromptPassword*>(YAPET::EVT_APOPTOSIS, this));
+    } catch (yapet::InvalidPasswordError& ex) {
+        assert(pwerror == nullptr);
+        pwerror = new YACURS::MessageBox3(
+            _("Invalid Password"), _("Password for file"), _filename,
+            _("is not correct. Do you want to try again?"), YACURS::YESNO);
+        pwerror->show();
+    } catch (std::exception& ex) {
+        assert(generror == nullptr);
+        generror =
+            new YACURS::MessageBox2(_("Error"), _("Got following error"),
+                                    ex.what(), YACURS::OK_ONLY);
+        generror->show();
+    }
+
+    yapet::deleteAndZero(&derivationdialog);
+}
+
 //
 // Public
 //
 
 PromptPassword::PromptPassword(const std::string& filename)
     : pwdialog{nullptr},
+      derivationdialog{nullptr},
       pwerror{nullptr},
       generror{nullptr},
       _filename(filename),
@@ -133,10 +147,15 @@ PromptPassword::PromptPassword(const std::string& filename)
         YACURS::EventConnectorMethod1<PromptPassword>(
             YACURS::EVT_WINDOW_CLOSE, this,
             &PromptPassword::window_close_handler));
+    YACURS::EventQueue::connect_event(
+        YACURS::EventConnectorMethod1<PromptPassword>(
+            YAPET::EVT_KEYS_DERIVED, this,
+            &PromptPassword::keys_derived_handler));
 }
 
 PromptPassword::~PromptPassword() {
     if (pwdialog) delete pwdialog;
+    if (derivationdialog) delete derivationdialog;
     if (pwerror) delete pwerror;
     if (generror) delete generror;
 
@@ -144,6 +163,10 @@ PromptPassword::~PromptPassword() {
         YACURS::EventConnectorMethod1<PromptPassword>(
             YACURS::EVT_WINDOW_CLOSE, this,
             &PromptPassword::window_close_handler));
+    YACURS::EventQueue::disconnect_event(
+        YACURS::EventConnectorMethod1<PromptPassword>(
+            YAPET::EVT_KEYS_DERIVED, this,
+            &PromptPassword::keys_derived_handler));
 }
 
 void PromptPassword::run() {
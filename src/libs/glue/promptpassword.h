@@ -33,6 +33,7 @@
 #include <memory>
 
 #include "abstractcryptofactory.hh"
+#include "keyderivationdialog.h"
 #include "passworddialog.h"
 #include "yacurs.h"
 
@@ -42,6 +43,8 @@
  * Prompt for a password to open a given file. If the password does
  * not match on the file, ask the user whether to try again or cancel.
  *
+ * The key is derived and the file opened on a worker thread, while a
+ * KeyDerivationDialog is shown.
  *
  * Once the object has done it's job, it submits a EVT_APOPTOSIS
  * event.
@@ -49,6 +52,7 @@
 class PromptPassword {
    private:
     PasswordDialog* pwdialog;
+    KeyDerivationDialog* derivationdialog;
     YACURS::MessageBox3* pwerror;
     YACURS::MessageBox2* generror;
     std::string _filename;
@@ -57,6 +61,8 @@ class PromptPassword {
 
     void window_close_handler(YACURS::Event& e);
 
+    void keys_derived_handler(YACURS::Event& e);
+
    public:
     /**
      * @param fn the filename to prompt password for.
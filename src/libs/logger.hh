@@ -35,6 +35,7 @@
 #include <ctime>
 #include <fstream>
 #include <iomanip>
+#include <mutex>
 #include <string>
 
 #include "securearray.hh"
@@ -49,6 +50,8 @@ class Logger {
     Logger(Logger&&) = delete;
 
     void log(const std::string& message) {
+        // Keys are derived concurrently on worker threads
+        std::lock_guard<std::mutex> lock{_mutex};
         auto t{std::chrono::system_clock::to_time_t(
             std::chrono::system_clock::now())};
 
@@ -58,6 +61,7 @@ class Logger {
 
    private:
     std::fstream _file;
+    std::mutex _mutex;
 };
 
 inline std::string secureArrayToString(const SecureArray& secureArray) {
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <fnmatch.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "logger.hh"
+#include "parallel.hh"
+#include "recordlookup.hh"
+
+using namespace yapet;
+
+RecordLookup::RecordLookup(
+    std::shared_ptr<AbstractCryptoFactory> cryptoFactory)
+    : _cryptoFactory{cryptoFactory} {}
+
+std::vector<std::size_t> RecordLookup::find(
+    const std::vector<SecureArray>& encryptedRecords,
+    const std::string& pattern) const {
+    auto numberOfRecords = encryptedRecords.size();
+    auto workers = numberOfWorkers(numberOfRecords);
+    std::vector<std::vector<std::size_t>> found(workers);
+
+    parallelFor(
+        numberOfRecords, workers,
+        [this, &encryptedRecords, &pattern, &found](
+            unsigned int worker, std::size_t begin, std::size_t end) {
+            auto crypto{_cryptoFactory->crypto()};
+            // Names fill the entire field if they are not zero terminated
+            char name[PasswordRecord::NAME_SIZE + 1];
+
+            for (auto i = begin; i < end; i++) {
+                auto prefix{crypto->decryptPrefix(encryptedRecords[i],
+                                                  PasswordRecord::NAME_SIZE)};
+                auto length = std::min<std::size_t>(
+                    prefix.size(), PasswordRecord::NAME_SIZE);
+                std::memcpy(name, *prefix, length);
+                name[length] = '\0';
+
+                if (::fnmatch(pattern.c_str(), name, 0) == 0) {
+                    found[worker].push_back(i);
+                }
+            }
+            std::memset(name, 0, sizeof(name));
+        });
+
+    std::vector<std::size_t> result;
+    for (const auto& indices : found) {
+        result.insert(result.end(), indices.begin(), indices.end());
+    }
+
+    LOG_MESSAGE(std::string{__func__} + ": " + std::to_string(result.size()) +
+                " of " + std::to_string(numberOfRecords) + " records found");
+    return result;
+}
+
+std::vector<SecureArray> RecordLookup::names(
+    const std::vector<SecureArray>& encryptedRecords) const {
+    auto numberOfRecords = encryptedRecords.size();
+    std::vector<SecureArray> result(numberOfRecords);
+
+    parallelFor(numberOfRecords, [this, &encryptedRecords, &result](
+                                     unsigned int, std::size_t begin,
+                                     std::size_t end) {
+        auto crypto{_cryptoFactory->crypto()};
+
+        for (auto i = begin; i < end; i++) {
+            auto prefix{crypto->decryptPrefix(encryptedRecords[i],
+                                              PasswordRecord::NAME_SIZE)};
+            auto length = std::min<std::size_t>(prefix.size(),
+                                                PasswordRecord::NAME_SIZE);
+            length = ::strnlen(reinterpret_cast<const char*>(*prefix), length);
+
+            SecureArray name{static_cast<SecureArray::size_type>(length + 1)};
+            std::memcpy(*name, *prefix, length);
+            (*name)[length] = '\0';
+            result[i] = std::move(name);
+        }
+    });
+
+    return result;
+}
+
+PasswordRecord RecordLookup::decrypt(
+    const SecureArray& encryptedRecord) const {
+    return PasswordRecord{_cryptoFactory->crypto()->decrypt(encryptedRecord)};
+}
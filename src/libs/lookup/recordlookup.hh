@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _RECORDLOOKUP_HH
+#define _RECORDLOOKUP_HH
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstractcryptofactory.hh"
+#include "passwordrecord.hh"
+#include "securearray.hh"
+
+namespace yapet {
+/**
+ * Look up password records by name.
+ *
+ * The name is the first field of a serialized record. Finding records only
+ * decrypts the part of each record holding the name, see \c
+ * Crypto::decryptPrefix(), in parallel, each worker thread using its own \c
+ * Crypto instance. Only the records found are decrypted entirely.
+ */
+class RecordLookup {
+   private:
+    std::shared_ptr<AbstractCryptoFactory> _cryptoFactory;
+
+   public:
+    RecordLookup(std::shared_ptr<AbstractCryptoFactory> cryptoFactory);
+    RecordLookup(const RecordLookup&) = delete;
+    RecordLookup& operator=(const RecordLookup&) = delete;
+    ~RecordLookup() {}
+
+    /**
+     * The indices of the records whose name matches \c pattern, in file
+     * order. \c pattern is a shell wildcard pattern as understood by \c
+     * fnmatch(3), thus a name without wildcards matches itself only.
+     */
+    std::vector<std::size_t> find(
+        const std::vector<SecureArray>& encryptedRecords,
+        const std::string& pattern) const;
+
+    /**
+     * The names of the records, zero terminated, in file order.
+     */
+    std::vector<SecureArray> names(
+        const std::vector<SecureArray>& encryptedRecords) const;
+
+    /**
+     * Decrypt the record \c encryptedRecord.
+     */
+    PasswordRecord decrypt(const SecureArray& encryptedRecord) const;
+};
+}  // namespace yapet
+
+#endif
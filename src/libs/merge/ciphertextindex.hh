@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _CIPHERTEXTINDEX_HH
+#define _CIPHERTEXTINDEX_HH
+
+#include <algorithm>
+#include <cstddef>
+#include <unordered_map>
+
+#include "securearray.hh"
+
+namespace yapet {
+namespace merge {
+struct CipherTextHash {
+    std::size_t operator()(const SecureArray* cipherText) const {
+        constexpr std::size_t hashedBytes = 32;
+        // Records encrypted with a random IV start with it, so a prefix of
+        // the cipher text makes a good hash value.
+        std::size_t hash = 14695981039346656037ULL;
+        auto length =
+            std::min<std::size_t>(cipherText->size(), hashedBytes);
+        for (std::size_t i = 0; i < length; i++) {
+            hash = (hash ^ (**cipherText)[i]) * 1099511628211ULL;
+        }
+        return hash ^ cipherText->size();
+    }
+};
+
+struct CipherTextEqual {
+    bool operator()(const SecureArray* a, const SecureArray* b) const {
+        return *a == *b;
+    }
+};
+
+/**
+ * Map encrypted records to their index. The records are not copied, they
+ * have to outlive the map.
+ */
+using CipherTextIndex = std::unordered_map<const SecureArray*, std::size_t,
+                                           CipherTextHash, CipherTextEqual>;
+}  // namespace merge
+}  // namespace yapet
+
+#endif
@@ -0,0 +1,302 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <openssl/evp.h>
+
+#include <cstdio>
+#include <cstring>
+
+#include "ciphertextindex.hh"
+#include "consts.h"
+#include "cryptoerror.hh"
+#include "filehelper.hh"
+#include "intl.h"
+#include "logger.hh"
+#include "ods.hh"
+#include "parallel.hh"
+#include "recorddelta.hh"
+
+using namespace yapet;
+using namespace yapet::merge;
+
+constexpr const char* RecordDelta::MAGIC;
+constexpr std::uint32_t RecordDelta::FORMAT_VERSION;
+
+namespace {
+constexpr std::size_t MAGIC_SIZE = 8;
+/**
+ * Upper bound for the size of an inserted record read from a delta. Records
+ * are less than 2KiB in size.
+ */
+constexpr std::uint32_t MAX_RECORD_SIZE = 1024 * 1024;
+
+Fingerprint sha256(const std::uint8_t* data, std::size_t length) {
+    Fingerprint digest;
+    unsigned int digestLength = digest.size();
+
+    auto result = EVP_Digest(data, length, digest.data(), &digestLength,
+                             EVP_sha256(), nullptr);
+    if (result != 1 || digestLength != digest.size()) {
+        LOG_MESSAGE(std::string{__func__} + ": SHA-256 failure");
+        throw HashError{_("Cannot compute digest")};
+    }
+
+    return digest;
+}
+
+inline Fingerprint sha256(const SecureArray& data) {
+    return sha256(*data, data.size());
+}
+
+void readBytes(std::istream& in, void* buffer, std::size_t size) {
+    in.read(reinterpret_cast<char*>(buffer), size);
+    if (static_cast<std::size_t>(in.gcount()) != size) {
+        throw DeltaError{_("Delta is truncated")};
+    }
+}
+
+std::uint32_t readInteger(std::istream& in) {
+    std::uint32_t odsInteger;
+    readBytes(in, &odsInteger, sizeof(odsInteger));
+    return toHost(odsInteger);
+}
+
+void writeInteger(std::ostream& out, std::uint32_t integer) {
+    auto odsInteger = toODS(integer);
+    out.write(reinterpret_cast<const char*>(&odsInteger), sizeof(odsInteger));
+}
+
+std::uint32_t toUint32(std::size_t size) {
+    if (size > UINT32_MAX) {
+        throw DeltaError{_("Too many records for a delta")};
+    }
+    return static_cast<std::uint32_t>(size);
+}
+}  // namespace
+
+Fingerprint FileImage::fingerprint() const {
+    std::vector<Fingerprint> digests(3 + records.size());
+    digests[0] = sha256(identifier);
+    digests[1] = sha256(metaData);
+    digests[2] = sha256(header);
+
+    parallelFor(records.size(),
+                [this, &digests](unsigned int, std::size_t begin,
+                                 std::size_t end) {
+                    for (auto i = begin; i < end; i++) {
+                        digests[3 + i] = sha256(records[i]);
+                    }
+                });
+
+    return sha256(digests.front().data(),
+                  digests.size() * sizeof(Fingerprint));
+}
+
+FileImage yapet::merge::readFileImage(const std::string& filename) {
+    auto file{getFile(filename, false)};
+    file->open();
+
+    FileImage image;
+    image.identifier = file->readIdentifier();
+    image.metaData = file->readUnencryptedMetaData();
+    image.header = file->readHeader();
+
+    auto records{file->readPasswordRecords()};
+    image.records.reserve(records.size());
+    for (auto& record : records) {
+        image.records.push_back(std::move(record));
+    }
+
+    return image;
+}
+
+RecordDelta::RecordDelta()
+    : _baseFingerprint{}, _resultFingerprint{}, _baseSize{0}, _operations{} {}
+
+RecordDelta::RecordDelta(const FileImage& oldFile, const FileImage& newFile)
+    : _baseFingerprint{oldFile.fingerprint()},
+      _resultFingerprint{newFile.fingerprint()},
+      _baseSize{toUint32(oldFile.records.size())},
+      _operations{} {
+    if (!oldFile.sameKey(newFile)) {
+        throw DeltaError{
+            _("Files use different keys, a delta would contain all records")};
+    }
+    toUint32(newFile.records.size());
+
+    CipherTextIndex oldIndex{oldFile.records.size()};
+    for (std::size_t i = 0; i < oldFile.records.size(); i++) {
+        oldIndex.emplace(&oldFile.records[i], i);
+    }
+
+    for (const auto& record : newFile.records) {
+        auto found = oldIndex.find(&record);
+        if (found == oldIndex.end()) {
+            _operations.push_back(
+                Operation{OperationType::INSERT, 0, 0, record});
+            continue;
+        }
+
+        auto index = static_cast<std::uint32_t>(found->second);
+        if (!_operations.empty()) {
+            Operation& last = _operations.back();
+            if (last.type == OperationType::COPY &&
+                last.first + last.count == index) {
+                last.count++;
+                continue;
+            }
+        }
+        _operations.push_back(
+            Operation{OperationType::COPY, index, 1, SecureArray{}});
+    }
+
+    LOG_MESSAGE(std::string{__func__} + ": " +
+                std::to_string(_operations.size()) + " operations");
+}
+
+RecordDelta RecordDelta::read(std::istream& in) {
+    char magic[MAGIC_SIZE];
+    readBytes(in, magic, MAGIC_SIZE);
+    if (std::memcmp(magic, MAGIC, MAGIC_SIZE) != 0) {
+        throw DeltaError{_("Not a YAPET delta")};
+    }
+
+    auto version = readInteger(in);
+    if (version != FORMAT_VERSION) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Unsupported delta version %u"), version);
+        throw DeltaError{msg};
+    }
+
+    RecordDelta delta;
+    readBytes(in, delta._baseFingerprint.data(), sizeof(Fingerprint));
+    readBytes(in, delta._resultFingerprint.data(), sizeof(Fingerprint));
+    delta._baseSize = readInteger(in);
+
+    auto numberOfOperations = readInteger(in);
+    for (std::uint32_t i = 0; i < numberOfOperations; i++) {
+        std::uint8_t type;
+        readBytes(in, &type, sizeof(type));
+
+        if (type == static_cast<std::uint8_t>(OperationType::COPY)) {
+            auto first = readInteger(in);
+            auto count = readInteger(in);
+            if (count == 0 || first >= delta._baseSize ||
+                count > delta._baseSize - first) {
+                throw DeltaError{_("Delta copies records out of range")};
+            }
+            delta._operations.push_back(
+                Operation{OperationType::COPY, first, count, SecureArray{}});
+        } else if (type == static_cast<std::uint8_t>(OperationType::INSERT)) {
+            auto size = readInteger(in);
+            if (size == 0 || size > MAX_RECORD_SIZE) {
+                throw DeltaError{_("Delta contains a record of invalid size")};
+            }
+            SecureArray record{static_cast<SecureArray::size_type>(size)};
+            readBytes(in, *record, size);
+            delta._operations.push_back(
+                Operation{OperationType::INSERT, 0, 0, std::move(record)});
+        } else {
+            throw DeltaError{_("Delta contains an unknown operation")};
+        }
+    }
+
+    return delta;
+}
+
+void RecordDelta::write(std::ostream& out) const {
+    out.write(MAGIC, MAGIC_SIZE);
+    writeInteger(out, FORMAT_VERSION);
+    out.write(reinterpret_cast<const char*>(_baseFingerprint.data()),
+              sizeof(Fingerprint));
+    out.write(reinterpret_cast<const char*>(_resultFingerprint.data()),
+              sizeof(Fingerprint));
+    writeInteger(out, _baseSize);
+    writeInteger(out, toUint32(_operations.size()));
+
+    for (const auto& operation : _operations) {
+        out.put(static_cast<char>(operation.type));
+        if (operation.type == OperationType::COPY) {
+            writeInteger(out, operation.first);
+            writeInteger(out, operation.count);
+        } else {
+            writeInteger(out, toUint32(operation.record.size()));
+            out.write(reinterpret_cast<const char*>(*operation.record),
+                      operation.record.size());
+        }
+    }
+}
+
+std::vector<SecureArray> RecordDelta::apply(const FileImage& base) const {
+    if (base.records.size() != _baseSize ||
+        base.fingerprint() != _baseFingerprint) {
+        throw DeltaError{_("Delta has not been created from this file")};
+    }
+
+    std::vector<SecureArray> result;
+    for (const auto& operation : _operations) {
+        if (operation.type == OperationType::COPY) {
+            result.insert(result.end(),
+                          base.records.begin() + operation.first,
+                          base.records.begin() + operation.first +
+                              operation.count);
+        } else {
+            result.push_back(operation.record);
+        }
+    }
+
+    FileImage resultImage{base.identifier, base.metaData, base.header,
+                          std::move(result)};
+    if (resultImage.fingerprint() != _resultFingerprint) {
+        throw DeltaError{_("Result of applying delta does not match")};
+    }
+
+    return std::move(resultImage.records);
+}
+
+std::size_t RecordDelta::inserted() const {
+    std::size_t inserted = 0;
+    for (const auto& operation : _operations) {
+        if (operation.type == OperationType::INSERT) inserted++;
+    }
+    return inserted;
+}
+
+std::size_t RecordDelta::deleted() const {
+    std::size_t copied = 0;
+    for (const auto& operation : _operations) {
+        if (operation.type == OperationType::COPY) copied += operation.count;
+    }
+    return copied < _baseSize ? _baseSize - copied : 0;
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _RECORDDELTA_HH
+#define _RECORDDELTA_HH
+
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "securearray.hh"
+
+namespace yapet {
+namespace merge {
+/**
+ * SHA-256 fingerprint of the encrypted contents of a file.
+ */
+using Fingerprint = std::array<std::uint8_t, 32>;
+
+/**
+ * The contents of a file as stored on disk, without decrypting anything.
+ */
+struct FileImage {
+    SecureArray identifier;
+    SecureArray metaData;
+    /**
+     * The encrypted header. Files having the same meta data and header use
+     * the same key.
+     */
+    SecureArray header;
+    std::vector<SecureArray> records;
+
+    /**
+     * Whether the records of this file and \c other are encrypted with the
+     * same key.
+     */
+    bool sameKey(const FileImage& other) const {
+        return identifier == other.identifier && metaData == other.metaData &&
+               header == other.header;
+    }
+
+    /**
+     * Hash of the digests of the parts and records of the file. Since the
+     * records are digested individually, the digests are computed in
+     * parallel.
+     */
+    Fingerprint fingerprint() const;
+};
+
+/**
+ * Read the file \c filename. No password is needed.
+ */
+FileImage readFileImage(const std::string& filename);
+
+/**
+ * Record-level difference between two versions of a file using the same
+ * key.
+ *
+ * The new version is described as a sequence of operations, each either
+ * copying a run of consecutive records of the old version, or inserting an
+ * encrypted record. Records are compared by their cipher text, so nothing
+ * is decrypted. The size of a delta is therefore proportional to the number
+ * of records added, changed, deleted or moved.
+ *
+ * A delta carries the fingerprint of the old version it has been created
+ * from, and of the new version. It can only be applied to a file matching
+ * the old fingerprint, and the result is verified against the new one.
+ */
+class RecordDelta {
+   public:
+    enum class OperationType : std::uint8_t { COPY = 1, INSERT = 2 };
+
+    struct Operation {
+        OperationType type;
+        /**
+         * \c COPY: the index of the first base record copied.
+         */
+        std::uint32_t first;
+        /**
+         * \c COPY: the number of base records copied.
+         */
+        std::uint32_t count;
+        /**
+         * \c INSERT: the encrypted record inserted.
+         */
+        SecureArray record;
+    };
+
+    /**
+     * Identifies a delta, followed by the version of the format.
+     */
+    static constexpr const char* MAGIC = "YAPETDLT";
+    static constexpr std::uint32_t FORMAT_VERSION = 1;
+
+   private:
+    Fingerprint _baseFingerprint;
+    Fingerprint _resultFingerprint;
+    std::uint32_t _baseSize;
+    std::vector<Operation> _operations;
+
+    RecordDelta();
+
+   public:
+    /**
+     * Compute the delta turning \c oldFile into \c newFile.
+     *
+     * @throw DeltaError if the files do not use the same key.
+     */
+    RecordDelta(const FileImage& oldFile, const FileImage& newFile);
+
+    /**
+     * Read a delta written by \c write().
+     *
+     * @throw DeltaError if \c in does not contain a valid delta.
+     */
+    static RecordDelta read(std::istream& in);
+    void write(std::ostream& out) const;
+
+    /**
+     * Apply the delta to \c base and return the resulting encrypted
+     * records.
+     *
+     * @throw DeltaError if \c base is not the file the delta has been
+     * created from.
+     */
+    std::vector<SecureArray> apply(const FileImage& base) const;
+
+    const std::vector<Operation>& operations() const { return _operations; }
+    /**
+     * Number of records inserted, i.e. added or changed.
+     */
+    std::size_t inserted() const;
+    /**
+     * Number of base records not copied, i.e. deleted or changed.
+     */
+    std::size_t deleted() const;
+};
+
+class DeltaError : public std::runtime_error {
+   public:
+    DeltaError(const char* msg) : runtime_error{msg} {}
+};
+}  // namespace merge
+}  // namespace yapet
+
+#endif
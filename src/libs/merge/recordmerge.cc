@@ -0,0 +1,441 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cstring>
+#include <deque>
+#include <unordered_map>
+
+#include "ciphertextindex.hh"
+#include "logger.hh"
+#include "parallel.hh"
+#include "passwordrecord.hh"
+#include "recordmerge.hh"
+#include "tagindex.hh"
+
+using namespace yapet;
+using namespace yapet::merge;
+
+constexpr const char* RecordMerge::CONFLICT_TAG;
+constexpr const char* RecordMerge::CONFLICT_SUFFIX;
+
+namespace {
+constexpr std::size_t NONE = static_cast<std::size_t>(-1);
+
+inline std::size_t fieldLength(const std::uint8_t* field, std::size_t size) {
+    return ::strnlen(reinterpret_cast<const char*>(field), size);
+}
+
+inline bool sameField(const std::uint8_t* a, const std::uint8_t* b,
+                      std::size_t size) {
+    auto length = fieldLength(a, size);
+    return length == fieldLength(b, size) && std::memcmp(a, b, length) == 0;
+}
+
+/**
+ * Compare records field by field. Bytes following the terminating zero of a
+ * field are ignored.
+ */
+bool sameRecord(const PasswordRecord& a, const PasswordRecord& b) {
+    return sameField(a.name(), b.name(), PasswordRecord::NAME_SIZE) &&
+           sameField(a.host(), b.host(), PasswordRecord::HOST_SIZE) &&
+           sameField(a.username(), b.username(),
+                     PasswordRecord::USERNAME_SIZE) &&
+           sameField(a.password(), b.password(),
+                     PasswordRecord::PASSWORD_SIZE) &&
+           sameField(a.comment(), b.comment(), PasswordRecord::COMMENT_SIZE) &&
+           sameField(a.tags(), b.tags(), PasswordRecord::TAGS_SIZE);
+}
+
+/**
+ * Name and host, separated by a zero byte which cannot be part of either of
+ * them.
+ */
+std::string recordKey(const PasswordRecord& record) {
+    std::string key{
+        reinterpret_cast<const char*>(record.name()),
+        fieldLength(record.name(), PasswordRecord::NAME_SIZE)};
+    key.push_back('\0');
+    key.append(reinterpret_cast<const char*>(record.host()),
+               fieldLength(record.host(), PasswordRecord::HOST_SIZE));
+    return key;
+}
+
+std::string recordName(const PasswordRecord& record) {
+    return std::string{
+        reinterpret_cast<const char*>(record.name()),
+        fieldLength(record.name(), PasswordRecord::NAME_SIZE)};
+}
+
+/**
+ * Add the conflict tag to \c record, unless it has it already or the tags
+ * field is too short to hold it.
+ */
+void tagConflict(PasswordRecord& record) {
+    std::string tags{reinterpret_cast<const char*>(record.tags()),
+                     fieldLength(record.tags(), PasswordRecord::TAGS_SIZE)};
+    for (const auto& tag : TagIndex::parseTags(tags.c_str())) {
+        if (tag == RecordMerge::CONFLICT_TAG) return;
+    }
+
+    if (!tags.empty()) tags.push_back(',');
+    tags.append(RecordMerge::CONFLICT_TAG);
+    if (tags.size() < PasswordRecord::TAGS_SIZE) {
+        record.tags(tags.c_str());
+    }
+}
+
+/**
+ * Append the conflict suffix to the name of \c record, shortening the name
+ * if necessary.
+ */
+void renameConflict(PasswordRecord& record) {
+    std::string name{recordName(record)};
+    std::string suffix{RecordMerge::CONFLICT_SUFFIX};
+    std::size_t maxLength = PasswordRecord::NAME_SIZE - 1 - suffix.size();
+    if (name.size() > maxLength) name.resize(maxLength);
+    name += suffix;
+    record.name(name.c_str());
+}
+
+/**
+ * Decrypt the records at \c indices in parallel.
+ */
+std::vector<PasswordRecord> decryptRecords(
+    const std::vector<SecureArray>& records,
+    const std::vector<std::size_t>& indices,
+    const std::shared_ptr<AbstractCryptoFactory>& cryptoFactory) {
+    std::vector<PasswordRecord> result(indices.size());
+    parallelFor(indices.size(), [&records, &indices, &cryptoFactory, &result](
+                                    unsigned int, std::size_t begin,
+                                    std::size_t end) {
+        auto crypto{cryptoFactory->crypto()};
+        for (auto i = begin; i < end; i++) {
+            result[i] = PasswordRecord{crypto->decrypt(records[indices[i]])};
+        }
+    });
+    return result;
+}
+
+enum class Change { UNCHANGED, MODIFIED, DELETED };
+
+/**
+ * The records of our or their file, related to the base records.
+ */
+struct Side {
+    const std::vector<SecureArray>& records;
+    /**
+     * For each record of this side, the index of the base record it is, or
+     * \c NONE for records added.
+     */
+    std::vector<std::size_t> baseIndex;
+    /**
+     * For each base record, the index of the record of this side it became,
+     * or \c NONE for records deleted.
+     */
+    std::vector<std::size_t> sideIndex;
+    /**
+     * Indices of the records not found in base by cipher text.
+     */
+    std::vector<std::size_t> decryptedIndices;
+    /**
+     * For each record of this side, the index in \c decrypted or \c NONE.
+     */
+    std::vector<std::size_t> decryptedIndex;
+    std::vector<PasswordRecord> decrypted;
+
+    Side(const std::vector<SecureArray>& sideRecords, std::size_t baseSize)
+        : records{sideRecords},
+          baseIndex(sideRecords.size(), NONE),
+          sideIndex(baseSize, NONE),
+          decryptedIndices{},
+          decryptedIndex(sideRecords.size(), NONE),
+          decrypted{} {}
+
+    const PasswordRecord& record(std::size_t index) const {
+        return decrypted[decryptedIndex[index]];
+    }
+
+    bool isDecrypted(std::size_t index) const {
+        return decryptedIndex[index] != NONE;
+    }
+};
+
+/**
+ * Find the records of \c side having the cipher text of a base record.
+ */
+void matchCipherTexts(const CipherTextIndex& baseByCipherText, Side& side) {
+    for (std::size_t i = 0; i < side.records.size(); i++) {
+        auto found = baseByCipherText.find(&side.records[i]);
+        if (found != baseByCipherText.end() &&
+            side.sideIndex[found->second] == NONE) {
+            side.baseIndex[i] = found->second;
+            side.sideIndex[found->second] = i;
+        } else {
+            side.decryptedIndex[i] = side.decryptedIndices.size();
+            side.decryptedIndices.push_back(i);
+        }
+    }
+}
+
+/**
+ * Match the decrypted records of \c side to the base records not found by
+ * cipher text, by name and host, in file order.
+ */
+void matchKeys(const std::vector<PasswordRecord>& baseDecrypted,
+               const std::vector<std::size_t>& baseDecryptedIndex,
+               Side& side) {
+    std::unordered_map<std::string, std::deque<std::size_t>> unmatched;
+    for (std::size_t b = 0; b < side.sideIndex.size(); b++) {
+        if (side.sideIndex[b] == NONE) {
+            unmatched[recordKey(baseDecrypted[baseDecryptedIndex[b]])]
+                .push_back(b);
+        }
+    }
+
+    for (auto i : side.decryptedIndices) {
+        auto found = unmatched.find(recordKey(side.record(i)));
+        if (found == unmatched.end() || found->second.empty()) continue;
+
+        auto b = found->second.front();
+        found->second.pop_front();
+        side.baseIndex[i] = b;
+        side.sideIndex[b] = i;
+    }
+}
+
+/**
+ * The merged records, either copied as cipher text or pending encryption.
+ */
+class Output {
+   private:
+    struct Entry {
+        const SecureArray* cipherText;
+        std::size_t pending;
+    };
+    std::vector<Entry> _entries;
+    std::vector<PasswordRecord> _pending;
+
+   public:
+    void copy(const SecureArray& cipherText) {
+        _entries.push_back(Entry{&cipherText, NONE});
+    }
+
+    void encrypt(PasswordRecord record) {
+        _entries.push_back(Entry{nullptr, _pending.size()});
+        _pending.push_back(std::move(record));
+    }
+
+    std::vector<SecureArray> records(
+        const std::shared_ptr<AbstractCryptoFactory>& cryptoFactory) const {
+        std::vector<SecureArray> result(_entries.size());
+        parallelFor(_entries.size(), [this, &cryptoFactory, &result](
+                                         unsigned int, std::size_t begin,
+                                         std::size_t end) {
+            auto crypto{cryptoFactory->crypto()};
+            for (auto i = begin; i < end; i++) {
+                const Entry& entry = _entries[i];
+                if (entry.cipherText != nullptr) {
+                    result[i] = *entry.cipherText;
+                } else {
+                    result[i] =
+                        crypto->encrypt(_pending[entry.pending].serialize());
+                }
+            }
+        });
+        return result;
+    }
+};
+}  // namespace
+
+RecordMerge::RecordMerge(
+    std::shared_ptr<AbstractCryptoFactory> baseCryptoFactory,
+    std::shared_ptr<AbstractCryptoFactory> ourCryptoFactory,
+    std::shared_ptr<AbstractCryptoFactory> theirCryptoFactory)
+    : _baseCryptoFactory{baseCryptoFactory},
+      _ourCryptoFactory{ourCryptoFactory},
+      _theirCryptoFactory{theirCryptoFactory} {}
+
+MergeReport RecordMerge::merge(const std::vector<SecureArray>& base,
+                               const std::vector<SecureArray>& ours,
+                               const std::vector<SecureArray>& theirs) const {
+    CipherTextIndex baseByCipherText{base.size()};
+    for (std::size_t b = 0; b < base.size(); b++) {
+        baseByCipherText.emplace(&base[b], b);
+    }
+
+    Side ourSide{ours, base.size()};
+    Side theirSide{theirs, base.size()};
+    matchCipherTexts(baseByCipherText, ourSide);
+    matchCipherTexts(baseByCipherText, theirSide);
+
+    // Only base records missing on either side are needed in plain text.
+    std::vector<std::size_t> baseDecryptedIndices;
+    std::vector<std::size_t> baseDecryptedIndex(base.size(), NONE);
+    for (std::size_t b = 0; b < base.size(); b++) {
+        if (ourSide.sideIndex[b] == NONE || theirSide.sideIndex[b] == NONE) {
+            baseDecryptedIndex[b] = baseDecryptedIndices.size();
+            baseDecryptedIndices.push_back(b);
+        }
+    }
+
+    auto baseDecrypted{
+        decryptRecords(base, baseDecryptedIndices, _baseCryptoFactory)};
+    ourSide.decrypted =
+        decryptRecords(ours, ourSide.decryptedIndices, _ourCryptoFactory);
+    theirSide.decrypted = decryptRecords(theirs, theirSide.decryptedIndices,
+                                         _theirCryptoFactory);
+
+    matchKeys(baseDecrypted, baseDecryptedIndex, ourSide);
+    matchKeys(baseDecrypted, baseDecryptedIndex, theirSide);
+
+    auto change = [&baseDecrypted, &baseDecryptedIndex](const Side& side,
+                                                        std::size_t b) {
+        auto i = side.sideIndex[b];
+        if (i == NONE) return Change::DELETED;
+        if (!side.isDecrypted(i)) return Change::UNCHANGED;
+        // Records re-encrypted without being changed, e.g. after changing
+        // the password, are matched by name and host but are equal.
+        return sameRecord(side.record(i),
+                          baseDecrypted[baseDecryptedIndex[b]])
+                   ? Change::UNCHANGED
+                   : Change::MODIFIED;
+    };
+
+    bool sameKey = _ourCryptoFactory == _theirCryptoFactory;
+    MergeReport report{};
+    Output output;
+
+    auto takeTheirs = [&output, &theirSide, sameKey](std::size_t i) {
+        if (sameKey) {
+            output.copy(theirSide.records[i]);
+        } else {
+            output.encrypt(theirSide.record(i));
+        }
+    };
+
+    auto addConflict = [&output, &report](PasswordRecord record,
+                                          bool rename) {
+        if (rename) renameConflict(record);
+        tagConflict(record);
+        report.conflicts.push_back(recordName(record));
+        output.encrypt(std::move(record));
+    };
+
+    // Records added on our side, by name and host, to detect records added
+    // on both sides.
+    std::unordered_map<std::string, std::vector<std::size_t>> ourAdditions;
+
+    for (std::size_t i = 0; i < ours.size(); i++) {
+        auto b = ourSide.baseIndex[i];
+        if (b == NONE) {
+            ourAdditions[recordKey(ourSide.record(i))].push_back(i);
+            output.copy(ours[i]);
+            continue;
+        }
+
+        auto ourChange = change(ourSide, b);
+        auto theirChange = change(theirSide, b);
+        auto t = theirSide.sideIndex[b];
+
+        if (ourChange == Change::UNCHANGED) {
+            switch (theirChange) {
+                case Change::UNCHANGED:
+                    output.copy(ours[i]);
+                    break;
+                case Change::MODIFIED:
+                    takeTheirs(t);
+                    report.changed++;
+                    break;
+                case Change::DELETED:
+                    report.deleted++;
+                    break;
+            }
+            continue;
+        }
+
+        switch (theirChange) {
+            case Change::UNCHANGED:
+                output.copy(ours[i]);
+                break;
+            case Change::MODIFIED:
+                output.copy(ours[i]);
+                if (!sameRecord(ourSide.record(i), theirSide.record(t))) {
+                    addConflict(theirSide.record(t), true);
+                }
+                break;
+            case Change::DELETED:
+                addConflict(ourSide.record(i), false);
+                break;
+        }
+    }
+
+    // Records deleted on our side but changed on theirs.
+    for (std::size_t b = 0; b < base.size(); b++) {
+        if (ourSide.sideIndex[b] == NONE &&
+            change(theirSide, b) == Change::MODIFIED) {
+            addConflict(theirSide.record(theirSide.sideIndex[b]), false);
+        }
+    }
+
+    for (std::size_t t = 0; t < theirs.size(); t++) {
+        if (theirSide.baseIndex[t] != NONE) continue;
+
+        const PasswordRecord& record = theirSide.record(t);
+        auto found = ourAdditions.find(recordKey(record));
+        if (found == ourAdditions.end()) {
+            takeTheirs(t);
+            report.added++;
+            continue;
+        }
+
+        bool addedOnBothSides = false;
+        for (auto i : found->second) {
+            if (sameRecord(ourSide.record(i), record)) {
+                addedOnBothSides = true;
+                break;
+            }
+        }
+        if (!addedOnBothSides) {
+            addConflict(record, true);
+        }
+    }
+
+    report.records = output.records(_ourCryptoFactory);
+    report.decrypted = baseDecrypted.size() + ourSide.decrypted.size() +
+                       theirSide.decrypted.size();
+
+    LOG_MESSAGE(std::string{__func__} + ": merged " +
+                std::to_string(report.records.size()) + " records, " +
+                std::to_string(report.conflicts.size()) + " conflicts");
+    return report;
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _RECORDMERGE_HH
+#define _RECORDMERGE_HH
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstractcryptofactory.hh"
+#include "securearray.hh"
+
+namespace yapet {
+namespace merge {
+/**
+ * The outcome of a three-way merge.
+ */
+struct MergeReport {
+    /**
+     * The merged records, encrypted with the key of our file, in the order
+     * they have to be stored.
+     */
+    std::vector<SecureArray> records;
+    /**
+     * Number of records added by their side.
+     */
+    std::size_t added;
+    /**
+     * Number of records changed by their side and taken over.
+     */
+    std::size_t changed;
+    /**
+     * Number of records deleted by their side and removed.
+     */
+    std::size_t deleted;
+    /**
+     * Number of records decrypted while merging. Records having the same
+     * cipher text on all sides are never decrypted.
+     */
+    std::size_t decrypted;
+    /**
+     * The names of the records in conflict.
+     */
+    std::vector<std::string> conflicts;
+
+    bool hasConflicts() const { return !conflicts.empty(); }
+};
+
+/**
+ * Three-way merge of the records of two files derived from a common base
+ * file.
+ *
+ * Records are identified by their cipher text first: a record having the
+ * same cipher text as a base record is that record, unchanged. Only records
+ * whose cipher text differs are decrypted, and matched to the remaining base
+ * records by name and host, in the order of the files. Each side's records
+ * are decrypted in parallel, each worker thread using its own \c Crypto
+ * instance.
+ *
+ * Changes made on one side only are merged automatically. If both sides
+ * changed a record differently, our version is kept and their version is
+ * added under a new name, suffixed by \c CONFLICT_SUFFIX. If one side
+ * deleted a record the other side changed, the changed version is kept.
+ * Records in conflict are tagged with \c CONFLICT_TAG.
+ */
+class RecordMerge {
+   private:
+    std::shared_ptr<AbstractCryptoFactory> _baseCryptoFactory;
+    std::shared_ptr<AbstractCryptoFactory> _ourCryptoFactory;
+    std::shared_ptr<AbstractCryptoFactory> _theirCryptoFactory;
+
+   public:
+    static constexpr const char* CONFLICT_TAG = "conflict";
+    static constexpr const char* CONFLICT_SUFFIX = " (conflict)";
+
+    /**
+     * Files sharing the same key should share the same crypto factory. This
+     * avoids re-encrypting their records unchanged.
+     */
+    RecordMerge(std::shared_ptr<AbstractCryptoFactory> baseCryptoFactory,
+                std::shared_ptr<AbstractCryptoFactory> ourCryptoFactory,
+                std::shared_ptr<AbstractCryptoFactory> theirCryptoFactory);
+    RecordMerge(const RecordMerge&) = delete;
+    RecordMerge& operator=(const RecordMerge&) = delete;
+    ~RecordMerge() {}
+
+    /**
+     * Merge the encrypted records as returned by \c
+     * YAPET::File::readEncryptedRecords().
+     */
+    MergeReport merge(const std::vector<SecureArray>& base,
+                      const std::vector<SecureArray>& ours,
+                      const std::vector<SecureArray>& theirs) const;
+};
+}  // namespace merge
+}  // namespace yapet
+
+#endif
@@ -135,6 +135,10 @@ void MetaData::setValue(const std::string& key, int value) {
     _dataItems[key] = value;
 }
 
+bool MetaData::hasValue(const std::string& key) const {
+    return _dataItems.find(key) != _dataItems.end();
+}
+
 std::unordered_map<std::string, int>::size_type MetaData::size() const {
     return _dataItems.size();
 }
@@ -49,6 +49,7 @@ class MetaData : public Serializable {
 
     int getValue(const std::string& key) const;
     void setValue(const std::string& key, int value);
+    bool hasValue(const std::string& key) const;
 
     std::unordered_map<std::string, int>::size_type size() const;
 
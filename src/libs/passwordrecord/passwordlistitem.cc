@@ -34,11 +34,16 @@
 
 using namespace yapet;
 
-PasswordListItem::PasswordListItem() : _name{}, _encryptedRecord{} {}
+constexpr std::uint32_t PasswordListItem::NO_ID;
+
+PasswordListItem::PasswordListItem()
+    : _name{}, _encryptedRecord{}, _id{NO_ID} {}
 
 PasswordListItem::PasswordListItem(const char* host,
                                    const SecureArray& encryptedRecord)
-    : _name{PasswordRecord::NAME_SIZE}, _encryptedRecord{encryptedRecord} {
+    : _name{PasswordRecord::NAME_SIZE},
+      _encryptedRecord{encryptedRecord},
+      _id{NO_ID} {
     auto stringLengthIncludingZero = std::strlen(host) + 1;
     auto len = stringLengthIncludingZero > PasswordRecord::NAME_SIZE
                    ? PasswordRecord::NAME_SIZE
@@ -49,7 +54,9 @@ PasswordListItem::PasswordListItem(const char* host,
 }
 
 PasswordListItem::PasswordListItem(const PasswordListItem& item)
-    : _name{item._name}, _encryptedRecord{item._encryptedRecord} {}
+    : _name{item._name},
+      _encryptedRecord{item._encryptedRecord},
+      _id{item._id} {}
 PasswordListItem& PasswordListItem::operator=(const PasswordListItem& item) {
     if (&item == this) {
         return *this;
@@ -57,13 +64,15 @@ PasswordListItem& PasswordListItem::operator=(const PasswordListItem& item) {
 
     _name = item._name;
     _encryptedRecord = item._encryptedRecord;
+    _id = item._id;
 
     return *this;
 }
 
 PasswordListItem::PasswordListItem(PasswordListItem&& item)
     : _name{std::move(item._name)},
-      _encryptedRecord{std::move(item._encryptedRecord)} {}
+      _encryptedRecord{std::move(item._encryptedRecord)},
+      _id{item._id} {}
 PasswordListItem& PasswordListItem::operator=(PasswordListItem&& item) {
     if (&item == this) {
         return *this;
@@ -71,6 +80,7 @@ PasswordListItem& PasswordListItem::operator=(PasswordListItem&& item) {
 
     _name = std::move(item._name);
     _encryptedRecord = std::move(item._encryptedRecord);
+    _id = item._id;
 
     return *this;
 }
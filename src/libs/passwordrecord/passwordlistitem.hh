@@ -30,6 +30,9 @@
 #ifndef _PASSWORDLISTITEM_HH
 #define _PASSWORDLISTITEM_HH
 
+#include <cstdint>
+#include <limits>
+
 #include "passwordrecord.hh"
 
 namespace yapet {
@@ -37,9 +40,16 @@ class PasswordListItem {
    private:
     SecureArray _name;
     SecureArray _encryptedRecord;
+    std::uint32_t _id;
 
    public:
     using size_type = SecureArray::size_type;
+    /**
+     * Id of items not assigned an id.
+     */
+    static constexpr std::uint32_t NO_ID{
+        std::numeric_limits<std::uint32_t>::max()};
+
     PasswordListItem();
     PasswordListItem(const char* name, const SecureArray& encryptedRecord);
 
@@ -58,6 +68,13 @@ class PasswordListItem {
     SecureArray::size_type nameSize() const { return _name.size(); }
     const SecureArray& encryptedRecord() const { return _encryptedRecord; }
 
+    /**
+     * Id identifying the item while the file is open, e.g. in the tag index.
+     * Ids are not stored in the file.
+     */
+    std::uint32_t id() const { return _id; }
+    void id(std::uint32_t id) { _id = id; }
+
     operator std::string() const;
 };
 
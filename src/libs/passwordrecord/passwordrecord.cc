@@ -68,20 +68,26 @@ PasswordRecord::PasswordRecord()
       _host{HOST_SIZE},
       _username{USERNAME_SIZE},
       _password{PASSWORD_SIZE},
-      _comment{COMMENT_SIZE} {}
+      _comment{COMMENT_SIZE},
+      _tags{TAGS_SIZE} {
+    // Serialization depends on whether tags are set
+    std::memset(*_tags, 0, TAGS_SIZE);
+}
 
 PasswordRecord::PasswordRecord(const SecureArray& serialized)
     : _name{NAME_SIZE},
       _host{HOST_SIZE},
       _username{USERNAME_SIZE},
       _password{PASSWORD_SIZE},
-      _comment{COMMENT_SIZE} {
-    if (serialized.size() != TOTAL_SIZE) {
+      _comment{COMMENT_SIZE},
+      _tags{TAGS_SIZE} {
+    if (serialized.size() != TOTAL_SIZE &&
+        serialized.size() != TAGGED_TOTAL_SIZE) {
         char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
         std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
-                      _("Password record is expected to be of size %d bytes "
-                        "but got %d bytes"),
-                      TOTAL_SIZE, serialized.size());
+                      _("Password record is expected to be of size %d or %d "
+                        "bytes but got %d bytes"),
+                      TOTAL_SIZE, TAGGED_TOTAL_SIZE, serialized.size());
 
         throw DeserializationError{msg};
     }
@@ -101,6 +107,13 @@ PasswordRecord::PasswordRecord(const SecureArray& serialized)
     positionInBuffer += PASSWORD_SIZE;
 
     std::memcpy(*_comment, *serialized + positionInBuffer, COMMENT_SIZE);
+    positionInBuffer += COMMENT_SIZE;
+
+    if (serialized.size() == TAGGED_TOTAL_SIZE) {
+        std::memcpy(*_tags, *serialized + positionInBuffer, TAGS_SIZE);
+    } else {
+        std::memset(*_tags, 0, TAGS_SIZE);
+    }
 }
 
 PasswordRecord::PasswordRecord(const PasswordRecord& p)
@@ -108,14 +121,16 @@ PasswordRecord::PasswordRecord(const PasswordRecord& p)
       _host{p._host},
       _username{p._username},
       _password{p._password},
-      _comment{p._comment} {}
+      _comment{p._comment},
+      _tags{p._tags} {}
 
 PasswordRecord::PasswordRecord(PasswordRecord&& p)
     : _name{std::move(p._name)},
       _host{std::move(p._host)},
       _username{std::move(p._username)},
       _password{std::move(p._password)},
-      _comment{std::move(p._comment)} {}
+      _comment{std::move(p._comment)},
+      _tags{std::move(p._tags)} {}
 
 PasswordRecord& PasswordRecord::operator=(const PasswordRecord& p) {
     if (&p == this) {
@@ -127,6 +142,7 @@ PasswordRecord& PasswordRecord::operator=(const PasswordRecord& p) {
     _username = p._username;
     _password = p._password;
     _comment = p._comment;
+    _tags = p._tags;
 
     return *this;
 }
@@ -141,12 +157,14 @@ PasswordRecord& PasswordRecord::operator=(PasswordRecord&& p) {
     _username = std::move(p._username);
     _password = std::move(p._password);
     _comment = std::move(p._comment);
+    _tags = std::move(p._tags);
 
     return *this;
 }
 
 SecureArray PasswordRecord::serialize() const {
-    SecureArray serialized{TOTAL_SIZE};
+    bool tagged = (*_tags)[0] != '\0';
+    SecureArray serialized{tagged ? TAGGED_TOTAL_SIZE : TOTAL_SIZE};
 
     auto positionInBuffer = 0;
 
@@ -165,6 +183,10 @@ SecureArray PasswordRecord::serialize() const {
     std::memcpy(*serialized + positionInBuffer, *_comment, COMMENT_SIZE);
     positionInBuffer += COMMENT_SIZE;
 
+    if (tagged) {
+        std::memcpy(*serialized + positionInBuffer, *_tags, TAGS_SIZE);
+    }
+
     return serialized;
 }
 
@@ -201,4 +223,10 @@ void PasswordRecord::comment(const char* comment) {
 }
 void PasswordRecord::comment(const std::uint8_t* comment, int l) {
     copyUint8(*_comment, comment, l, COMMENT_SIZE);
-}
\ No newline at end of file
+}
+void PasswordRecord::tags(const char* tags) {
+    copyString(*_tags, tags, TAGS_SIZE);
+}
+void PasswordRecord::tags(const std::uint8_t* tags, int l) {
+    copyUint8(*_tags, tags, l, TAGS_SIZE);
+}
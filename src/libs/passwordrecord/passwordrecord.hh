@@ -63,8 +63,23 @@ class PasswordRecord : public Serializable {
      */
     static constexpr auto COMMENT_SIZE = 512;
 
+    /**
+     * The maximum length of the tags string of a password record. Tags are
+     * separated by commas.
+     */
+    static constexpr auto TAGS_SIZE = 256;
+
+    /**
+     * The size of a serialized record without tags. Records without tags are
+     * serialized in this size, so they can be read by versions not knowing
+     * about tags.
+     */
     static constexpr auto TOTAL_SIZE =
         NAME_SIZE + HOST_SIZE + USERNAME_SIZE + PASSWORD_SIZE + COMMENT_SIZE;
+    /**
+     * The size of a serialized record having tags.
+     */
+    static constexpr auto TAGGED_TOTAL_SIZE = TOTAL_SIZE + TAGS_SIZE;
 
    private:
     SecureArray _name;
@@ -72,6 +87,7 @@ class PasswordRecord : public Serializable {
     SecureArray _username;
     SecureArray _password;
     SecureArray _comment;
+    SecureArray _tags;
 
    public:
     PasswordRecord();
@@ -91,6 +107,7 @@ class PasswordRecord : public Serializable {
     const std::uint8_t* username() const { return *_username; }
     const std::uint8_t* password() const { return *_password; }
     const std::uint8_t* comment() const { return *_comment; }
+    const std::uint8_t* tags() const { return *_tags; }
 
     void name(const char* name);
     void name(const std::uint8_t* name, int l);
@@ -106,6 +123,9 @@ class PasswordRecord : public Serializable {
 
     void comment(const char* comment);
     void comment(const std::uint8_t* comment, int l);
+
+    void tags(const char* tags);
+    void tags(const std::uint8_t* tags, int l);
 };
 
 class DeserializationError : public std::runtime_error {
@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include "consts.h"
+#include "intl.h"
+#include "recordfield.hh"
+
+using namespace yapet;
+
+namespace {
+constexpr RecordField ALL_FIELDS[]{RecordField::NAME,     RecordField::HOST,
+                                   RecordField::USERNAME, RecordField::PASSWORD,
+                                   RecordField::COMMENT,  RecordField::TAGS};
+
+std::size_t fieldSize(RecordField field) {
+    switch (field) {
+        case RecordField::NAME:
+            return PasswordRecord::NAME_SIZE;
+        case RecordField::HOST:
+            return PasswordRecord::HOST_SIZE;
+        case RecordField::USERNAME:
+            return PasswordRecord::USERNAME_SIZE;
+        case RecordField::PASSWORD:
+            return PasswordRecord::PASSWORD_SIZE;
+        case RecordField::COMMENT:
+            return PasswordRecord::COMMENT_SIZE;
+        case RecordField::TAGS:
+            return PasswordRecord::TAGS_SIZE;
+    }
+    return 0;
+}
+}  // namespace
+
+const char* yapet::recordFieldName(RecordField field) {
+    switch (field) {
+        case RecordField::NAME:
+            return "name";
+        case RecordField::HOST:
+            return "host";
+        case RecordField::USERNAME:
+            return "username";
+        case RecordField::PASSWORD:
+            return "password";
+        case RecordField::COMMENT:
+            return "comment";
+        case RecordField::TAGS:
+            return "tags";
+    }
+    return "";
+}
+
+RecordField yapet::parseRecordField(const std::string& name) {
+    for (auto field : ALL_FIELDS) {
+        if (name == recordFieldName(field)) return field;
+    }
+    char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+    std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                  _("Unknown field '%s'"), name.c_str());
+    throw std::invalid_argument(msg);
+}
+
+std::vector<RecordField> yapet::parseRecordFields(const std::string& names) {
+    std::vector<RecordField> fields;
+    std::string::size_type begin{0};
+    for (;;) {
+        auto end{names.find(',', begin)};
+        fields.push_back(parseRecordField(names.substr(begin, end - begin)));
+        if (end == std::string::npos) break;
+        begin = end + 1;
+    }
+    return fields;
+}
+
+const char* yapet::recordFieldValue(const PasswordRecord& passwordRecord,
+                                    RecordField field, std::size_t& size) {
+    const std::uint8_t* value{nullptr};
+    switch (field) {
+        case RecordField::NAME:
+            value = passwordRecord.name();
+            break;
+        case RecordField::HOST:
+            value = passwordRecord.host();
+            break;
+        case RecordField::USERNAME:
+            value = passwordRecord.username();
+            break;
+        case RecordField::PASSWORD:
+            value = passwordRecord.password();
+            break;
+        case RecordField::COMMENT:
+            value = passwordRecord.comment();
+            break;
+        case RecordField::TAGS:
+            value = passwordRecord.tags();
+            break;
+    }
+
+    const char* str{reinterpret_cast<const char*>(value)};
+    size = ::strnlen(str, fieldSize(field));
+    return str;
+}
+
+void yapet::setRecordFieldValue(PasswordRecord& passwordRecord,
+                                RecordField field, const std::string& value) {
+    if (value.size() >= fieldSize(field)) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Field '%s' too long, at most %d characters allowed"),
+                      recordFieldName(field),
+                      static_cast<int>(fieldSize(field)) - 1);
+        throw std::invalid_argument(msg);
+    }
+
+    const char* str{value.c_str()};
+    switch (field) {
+        case RecordField::NAME:
+            passwordRecord.name(str);
+            break;
+        case RecordField::HOST:
+            passwordRecord.host(str);
+            break;
+        case RecordField::USERNAME:
+            passwordRecord.username(str);
+            break;
+        case RecordField::PASSWORD:
+            passwordRecord.password(str);
+            break;
+        case RecordField::COMMENT:
+            passwordRecord.comment(str);
+            break;
+        case RecordField::TAGS:
+            passwordRecord.tags(str);
+            break;
+    }
+}
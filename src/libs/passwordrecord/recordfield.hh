@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _RECORDFIELD_HH
+#define _RECORDFIELD_HH
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "passwordrecord.hh"
+
+namespace yapet {
+/**
+ * The fields of a password record.
+ */
+enum class RecordField { NAME, HOST, USERNAME, PASSWORD, COMMENT, TAGS };
+
+/**
+ * The name of \c field, as used in headers, JSON Lines, and expressions.
+ */
+const char* recordFieldName(RecordField field);
+
+/**
+ * The field named \c name.
+ *
+ * @throw std::invalid_argument if there is no such field.
+ */
+RecordField parseRecordField(const std::string& name);
+
+/**
+ * Parse a comma separated list of field names.
+ *
+ * @throw std::invalid_argument if the list is empty, or contains an
+ * unknown field.
+ */
+std::vector<RecordField> parseRecordFields(const std::string& names);
+
+/**
+ * The value of \c field of \c passwordRecord, which does not need to be
+ * zero terminated.
+ */
+const char* recordFieldValue(const PasswordRecord& passwordRecord,
+                             RecordField field, std::size_t& size);
+
+/**
+ * Set \c field of \c passwordRecord to \c value.
+ *
+ * @throw std::invalid_argument if \c value does not fit into the field.
+ */
+void setRecordFieldValue(PasswordRecord& passwordRecord, RecordField field,
+                         const std::string& value);
+}  // namespace yapet
+
+#endif
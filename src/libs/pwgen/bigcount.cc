@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "bigcount.hh"
+
+using namespace yapet::pwgen;
+
+namespace {
+constexpr int LIMB_BITS{32};
+}
+
+BigCount::BigCount(std::uint32_t value) : _limbs{} {
+    if (value != 0) _limbs.push_back(value);
+}
+
+void BigCount::trim() {
+    while (!_limbs.empty() && _limbs.back() == 0) _limbs.pop_back();
+}
+
+int BigCount::bitLength() const {
+    if (_limbs.empty()) return 0;
+
+    int bits = (_limbs.size() - 1) * LIMB_BITS;
+    for (auto top = _limbs.back(); top != 0; top >>= 1) bits++;
+    return bits;
+}
+
+double BigCount::log2() const {
+    assert(!_limbs.empty());
+
+    // The two most significant limbs are precise enough for a double
+    double top = _limbs.back();
+    int shift = (_limbs.size() - 1) * LIMB_BITS;
+    if (_limbs.size() > 1) {
+        top = top * 4294967296.0 + _limbs[_limbs.size() - 2];
+        shift -= LIMB_BITS;
+    }
+    return std::log2(top) + shift;
+}
+
+std::string BigCount::toString() const {
+    if (_limbs.empty()) return "0";
+
+    std::string digits;
+    std::vector<std::uint32_t> value{_limbs};
+    while (!value.empty()) {
+        std::uint64_t remainder = 0;
+        for (auto limb = value.rbegin(); limb != value.rend(); ++limb) {
+            std::uint64_t current = (remainder << LIMB_BITS) | *limb;
+            *limb = static_cast<std::uint32_t>(current / 10);
+            remainder = current % 10;
+        }
+        digits.push_back(static_cast<char>('0' + remainder));
+        while (!value.empty() && value.back() == 0) value.pop_back();
+    }
+    std::reverse(digits.begin(), digits.end());
+    return digits;
+}
+
+BigCount& BigCount::operator+=(const BigCount& other) {
+    if (_limbs.size() < other._limbs.size()) {
+        _limbs.resize(other._limbs.size(), 0);
+    }
+
+    std::uint64_t carry = 0;
+    for (std::size_t i = 0; i < _limbs.size(); i++) {
+        std::uint64_t sum = carry + _limbs[i];
+        if (i < other._limbs.size()) sum += other._limbs[i];
+        _limbs[i] = static_cast<std::uint32_t>(sum);
+        carry = sum >> LIMB_BITS;
+    }
+    if (carry != 0) _limbs.push_back(static_cast<std::uint32_t>(carry));
+    return *this;
+}
+
+BigCount& BigCount::operator-=(const BigCount& other) {
+    assert(!(*this < other));
+
+    std::int64_t borrow = 0;
+    for (std::size_t i = 0; i < _limbs.size(); i++) {
+        std::int64_t difference = static_cast<std::int64_t>(_limbs[i]) - borrow;
+        if (i < other._limbs.size()) difference -= other._limbs[i];
+        borrow = difference < 0 ? 1 : 0;
+        _limbs[i] = static_cast<std::uint32_t>(difference);
+    }
+    trim();
+    return *this;
+}
+
+BigCount& BigCount::operator*=(std::uint32_t factor) {
+    if (factor == 0) {
+        _limbs.clear();
+        return *this;
+    }
+
+    std::uint64_t carry = 0;
+    for (auto& limb : _limbs) {
+        std::uint64_t product =
+            static_cast<std::uint64_t>(limb) * factor + carry;
+        limb = static_cast<std::uint32_t>(product);
+        carry = product >> LIMB_BITS;
+    }
+    if (carry != 0) _limbs.push_back(static_cast<std::uint32_t>(carry));
+    return *this;
+}
+
+BigCount yapet::pwgen::operator*(const BigCount& a, const BigCount& b) {
+    BigCount product;
+    if (a.isZero() || b.isZero()) return product;
+
+    product._limbs.assign(a._limbs.size() + b._limbs.size(), 0);
+    for (std::size_t i = 0; i < a._limbs.size(); i++) {
+        std::uint64_t carry = 0;
+        for (std::size_t j = 0; j < b._limbs.size(); j++) {
+            std::uint64_t current =
+                static_cast<std::uint64_t>(a._limbs[i]) * b._limbs[j] +
+                product._limbs[i + j] + carry;
+            product._limbs[i + j] = static_cast<std::uint32_t>(current);
+            carry = current >> LIMB_BITS;
+        }
+        product._limbs[i + b._limbs.size()] =
+            static_cast<std::uint32_t>(carry);
+    }
+    product.trim();
+    return product;
+}
+
+bool yapet::pwgen::operator<(const BigCount& a, const BigCount& b) {
+    if (a._limbs.size() != b._limbs.size()) {
+        return a._limbs.size() < b._limbs.size();
+    }
+    return std::lexicographical_compare(a._limbs.rbegin(), a._limbs.rend(),
+                                        b._limbs.rbegin(), b._limbs.rend());
+}
+
+BigCount BigCount::uniform(const BigCount& n, RandomSource& randomSource) {
+    assert(!n.isZero());
+
+    if (n._limbs.size() == 1) {
+        return BigCount{randomSource.uniform(n._limbs[0])};
+    }
+
+    // Draw as many bits as n has and reject values not below n, which
+    // happens less than half of the time
+    int topBits = n.bitLength() % LIMB_BITS;
+    std::uint32_t topMask =
+        topBits == 0 ? ~std::uint32_t{0} : (std::uint32_t{1} << topBits) - 1;
+
+    BigCount value;
+    do {
+        value._limbs.resize(n._limbs.size());
+        for (auto& limb : value._limbs) {
+            limb = 0;
+            for (int i = 0; i < 4; i++) {
+                limb = (limb << 8) | randomSource.byte();
+            }
+        }
+        value._limbs.back() &= topMask;
+        value.trim();
+    } while (!(value < n));
+    return value;
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _BIGCOUNT_HH
+#define _BIGCOUNT_HH
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "randomsource.hh"
+
+namespace yapet {
+namespace pwgen {
+/**
+ * Unsigned integers of arbitrary size.
+ *
+ * Counting the passwords satisfying a \c Policy overflows any fixed size
+ * integer, there are 94^256 passwords of 256 characters. Only the operations
+ * needed to count passwords and to pick one uniformly at random are
+ * provided.
+ */
+class BigCount {
+   private:
+    // Least significant limb first, without leading zero limbs
+    std::vector<std::uint32_t> _limbs;
+
+    void trim();
+
+   public:
+    BigCount(std::uint32_t value = 0);
+
+    bool isZero() const { return _limbs.empty(); }
+    int bitLength() const;
+    double log2() const;
+    std::string toString() const;
+
+    BigCount& operator+=(const BigCount& other);
+    /**
+     * \c other must not be greater than this number.
+     */
+    BigCount& operator-=(const BigCount& other);
+    BigCount& operator*=(std::uint32_t factor);
+
+    friend BigCount operator*(const BigCount& a, const BigCount& b);
+    friend bool operator<(const BigCount& a, const BigCount& b);
+    friend bool operator==(const BigCount& a, const BigCount& b) {
+        return a._limbs == b._limbs;
+    }
+
+    /**
+     * A uniformly distributed random number in the range <tt>[0, n)</tt>.
+     *
+     * \c n must not be zero.
+     */
+    static BigCount uniform(const BigCount& n, RandomSource& randomSource);
+};
+
+BigCount operator*(const BigCount& a, const BigCount& b);
+bool operator<(const BigCount& a, const BigCount& b);
+}  // namespace pwgen
+}  // namespace yapet
+
+#endif
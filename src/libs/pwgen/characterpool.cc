@@ -31,9 +31,11 @@
 #include "config.h"
 #endif
 
+#include <cstdio>
 #include <stdexcept>
 
 #include "characterpool.hh"
+#include "consts.h"
 #include "intl.h"
 
 using namespace yapet::pwgen;
@@ -45,6 +47,54 @@ const std::string yapet::pwgen::punctuation{".,;:-!?'"};
 const std::string yapet::pwgen::special{"_+\"*%&/()[]={}<>"};
 const std::string yapet::pwgen::other{"@#\\|$~`^"};
 
+int yapet::pwgen::parsePools(const std::string& names) {
+    int pools = 0;
+    std::string::size_type begin{0};
+    for (;;) {
+        auto end{names.find(',', begin)};
+        auto name{names.substr(begin, end - begin)};
+        if (name == "letters") {
+            pools |= LETTERS;
+        } else if (name == "digits") {
+            pools |= DIGITS;
+        } else if (name == "punct") {
+            pools |= PUNCT;
+        } else if (name == "special") {
+            pools |= SPECIAL;
+        } else if (name == "other") {
+            pools |= OTHER;
+        } else {
+            char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+            std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                          _("Unknown character pool '%s'"), name.c_str());
+            throw std::invalid_argument(msg);
+        }
+        if (end == std::string::npos) break;
+        begin = end + 1;
+    }
+    return pools;
+}
+
+std::vector<std::string> yapet::pwgen::getSelectedPools(int pools) {
+    std::vector<std::string> selectedPools;
+    if (isLetters(pools)) {
+        selectedPools.push_back(letters);
+    }
+    if (isDigits(pools)) {
+        selectedPools.push_back(digits);
+    }
+    if (isPunct(pools)) {
+        selectedPools.push_back(punctuation);
+    }
+    if (isSpecial(pools)) {
+        selectedPools.push_back(special);
+    }
+    if (isOther(pools)) {
+        selectedPools.push_back(other);
+    }
+    return selectedPools;
+}
+
 std::string yapet::pwgen::getPools(int pools) {
     std::string characterPools;
     if (isLetters(pools)) {
@@ -68,4 +118,11 @@ std::string yapet::pwgen::getPools(int pools) {
     }
 
     return characterPools;
-}
\ No newline at end of file
+}
+
+CharacterTable::CharacterTable(const std::string& characters) : _bits{} {
+    for (auto c : characters) {
+        auto index = static_cast<std::uint8_t>(c);
+        _bits[index >> 6] |= std::uint64_t{1} << (index & 63);
+    }
+}
@@ -30,6 +30,7 @@
 #ifndef _CHARACTERPOOL_HH
 #define _CHARACTERPOOL_HH
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -80,6 +81,37 @@ extern const std::string other;
 
 std::string getPools(int pools);
 
+/**
+ * Parse a comma separated list of pool names, i.e. letters, digits, punct,
+ * special and other.
+ *
+ * @throw std::invalid_argument if the list contains an unknown pool.
+ */
+int parsePools(const std::string& names);
+
+/**
+ * The characters of each pool selected by \c pools, one string per pool.
+ */
+std::vector<std::string> getSelectedPools(int pools);
+
+/**
+ * A set of characters.
+ *
+ * Membership is tested by a single lookup in a table of 256 bits, instead
+ * of searching the characters.
+ */
+class CharacterTable {
+   private:
+    std::uint64_t _bits[4];
+
+   public:
+    CharacterTable(const std::string& characters);
+
+    bool contains(std::uint8_t c) const {
+        return (_bits[c >> 6] >> (c & 63)) & 1;
+    }
+};
+
 }  // namespace pwgen
 }  // namespace yapet
 
@@ -0,0 +1,2854 @@
+// Generated by mkmarkov, do not edit.
+//
+// The cumulative weights of the letters a to z following each context of
+// PronounceableGenerator, trained on 3 word lists.
+
+constexpr std::uint16_t MARKOV_TABLE[MARKOV_CONTEXTS][MARKOV_LETTERS]{
+    // ^^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // ^a
+    {333, 1996, 4325, 5822, 5822, 6487, 8483, 8816, 9149, 9149, 9149, 15303,
+     17299, 23785, 23785, 25116, 25116, 28775, 29607, 30439, 31770, 32435,
+     32768, 32768, 32768, 32768},
+    // ^b
+    {5314, 5314, 5314, 5314, 16163, 16163, 16163, 16163, 18820, 18820, 18820,
+     20148, 20148, 20148, 23690, 23690, 23690, 29447, 29447, 29447, 32547,
+     32547, 32547, 32547, 32768, 32768},
+    // ^c
+    {8018, 8018, 8018, 8018, 10110, 10110, 10110, 17605, 17954, 17954, 17954,
+     20394, 20394, 20394, 29630, 29630, 29630, 30676, 30676, 30676, 32419,
+     32419, 32419, 32419, 32768, 32768},
+    // ^d
+    {4033, 4033, 4033, 4033, 14620, 14620, 14620, 14620, 21930, 21930, 21930,
+     21930, 22434, 22434, 27223, 27223, 27223, 30248, 30248, 30248, 32264,
+     32264, 32264, 32264, 32768, 32768},
+    // ^e
+    {3607, 3607, 4809, 6613, 6613, 7815, 7815, 7815, 9017, 9017, 9017, 12023,
+     14428, 19238, 19238, 19238, 19238, 19839, 21342, 21943, 22544, 28259,
+     28259, 32167, 32768, 32768},
+    // ^f
+    {4681, 4681, 4681, 4681, 8322, 8322, 8322, 8322, 17684, 17684, 17684,
+     19244, 19244, 19244, 26006, 26006, 26006, 30687, 30687, 30687, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // ^g
+    {5807, 5807, 5807, 5807, 9125, 9125, 9125, 9955, 14103, 14103, 14103,
+     15762, 15762, 15762, 19910, 19910, 19910, 29450, 29450, 29450, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // ^h
+    {9438, 9438, 9438, 9438, 18613, 18613, 18613, 18613, 22807, 22807, 22807,
+     22807, 22807, 22807, 30147, 30147, 30147, 30147, 30147, 30147, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // ^i
+    {0, 0, 0, 2185, 2185, 2731, 2731, 2731, 2731, 2731, 2731, 2731, 8192,
+     24030, 24030, 24030, 24030, 24030, 28945, 31676, 31676, 32768, 32768,
+     32768, 32768, 32768},
+    // ^j
+    {7686, 7686, 7686, 7686, 13350, 13350, 13350, 13350, 13350, 13350, 13350,
+     13350, 13350, 13350, 25486, 25486, 25486, 25486, 25486, 25486, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // ^k
+    {5869, 5869, 5869, 5869, 12717, 12717, 12717, 12717, 19075, 19075, 19075,
+     21031, 21031, 23965, 26899, 26899, 26899, 30812, 30812, 30812, 31790,
+     31790, 31790, 31790, 32768, 32768},
+    // ^l
+    {8015, 8015, 8015, 8015, 17916, 17916, 17916, 17916, 24281, 24281, 24281,
+     24281, 24281, 24281, 29939, 29939, 29939, 29939, 29939, 29939, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // ^m
+    {12511, 12511, 12511, 12511, 18270, 18270, 18270, 18270, 23831, 23831,
+     23831, 23831, 23831, 23831, 30583, 30583, 30583, 30583, 30583, 30583,
+     32172, 32172, 32172, 32172, 32768, 32768},
+    // ^n
+    {9498, 9498, 9498, 9498, 19945, 19945, 20895, 20895, 25644, 25644, 25644,
+     25644, 25644, 25644, 31818, 31818, 31818, 31818, 31818, 31818, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // ^o
+    {0, 0, 2081, 2081, 2081, 8842, 8842, 9362, 10402, 10402, 10922, 14043,
+     14043, 18724, 18724, 21325, 21325, 24446, 24446, 27567, 30688, 31728,
+     32768, 32768, 32768, 32768},
+    // ^p
+    {6132, 6132, 6132, 6132, 11689, 12072, 12072, 13605, 15521, 15521, 15521,
+     17821, 17821, 17821, 22228, 22228, 22228, 30852, 30852, 30852, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // ^q
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // ^r
+    {5350, 5350, 5350, 5350, 19393, 19393, 19393, 19393, 22960, 22960, 22960,
+     22960, 22960, 22960, 30093, 30093, 30093, 30093, 30093, 30093, 32322,
+     32322, 32322, 32322, 32768, 32768},
+    // ^s
+    {2562, 2562, 6084, 6084, 11634, 11634, 11634, 14196, 17505, 17505, 17718,
+     17718, 18145, 18358, 22094, 23588, 23588, 23588, 23588, 29993, 32128,
+     32128, 32341, 32341, 32768, 32768},
+    // ^t
+    {2934, 2934, 2934, 2934, 7336, 7336, 7336, 19564, 21031, 21031, 21031,
+     21031, 21031, 21031, 25188, 25188, 25188, 30812, 30812, 30812, 31301,
+     31301, 31790, 31790, 32768, 32768},
+    // ^u
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13492, 13492, 19275, 19275, 23130,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // ^v
+    {5958, 5958, 5958, 5958, 5958, 5958, 5958, 5958, 20852, 20852, 20852,
+     20852, 20852, 20852, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // ^w
+    {6847, 6847, 6847, 6847, 12471, 12471, 12471, 18584, 25677, 25677, 25677,
+     25677, 25677, 25677, 30812, 30812, 30812, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // ^x
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // ^y
+    {0, 0, 0, 0, 13797, 13797, 13797, 13797, 13797, 13797, 13797, 13797, 13797,
+     13797, 29319, 29319, 29319, 29319, 29319, 29319, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // ^z
+    {9362, 9362, 9362, 9362, 9362, 9362, 9362, 18724, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // a^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // aa
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16384, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // ab
+    {0, 0, 0, 0, 6144, 6144, 6144, 6144, 12288, 12288, 12288, 24576, 24576,
+     24576, 28672, 28672, 28672, 30720, 30720, 30720, 30720, 30720, 30720,
+     30720, 32768, 32768},
+    // ac
+    {0, 0, 1986, 1986, 7944, 7944, 7944, 15391, 15391, 15391, 20356, 20356,
+     20356, 20356, 21349, 21349, 21845, 22838, 22838, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // ad
+    {4681, 4681, 4681, 7022, 16384, 16384, 16384, 16384, 22235, 22235, 22235,
+     22235, 23405, 23405, 25746, 25746, 25746, 25746, 25746, 25746, 28087,
+     28087, 28087, 28087, 32768, 32768},
+    // ae
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // af
+    {6554, 6554, 6554, 6554, 13108, 26214, 26214, 26214, 26214, 26214, 26214,
+     26214, 26214, 26214, 26214, 26214, 26214, 26214, 26214, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // ag
+    {3361, 3361, 3361, 3361, 21006, 21006, 21006, 21006, 24367, 24367, 24367,
+     26047, 26047, 27727, 31088, 31088, 31088, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // ah
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16384, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // ai
+    {0, 0, 0, 1214, 2428, 2428, 3642, 3642, 3642, 3642, 3642, 7283, 8497,
+     25486, 25486, 25486, 25486, 29127, 31554, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // aj
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // ak
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // al
+    {2006, 3343, 3343, 5349, 8358, 9027, 9027, 9027, 13039, 13039, 15045,
+     25410, 26079, 26079, 26748, 27417, 27417, 28086, 28755, 30761, 31430,
+     31430, 32099, 32099, 32768, 32768},
+    // am
+    {2621, 3932, 3932, 3932, 14418, 14418, 14418, 14418, 18350, 18350, 18350,
+     18350, 19661, 19661, 23593, 27525, 27525, 27525, 30146, 30146, 31457,
+     31457, 31457, 31457, 32768, 32768},
+    // an
+    {2917, 2917, 5834, 14070, 15099, 15099, 19216, 19216, 21103, 21103, 22475,
+     22475, 22475, 26764, 27450, 27450, 27450, 27450, 28136, 30366, 30709,
+     30709, 30709, 30709, 32768, 32768},
+    // ao
+    {434, 1012, 1843, 2746, 2818, 3649, 4263, 4805, 5383, 5455, 5708, 8020,
+     9610, 16764, 17992, 19076, 19076, 23881, 25398, 26843, 29842, 30817,
+     32262, 32334, 32768, 32768},
+    // ap
+    {0, 0, 0, 0, 3641, 3641, 3641, 3641, 3641, 3641, 3641, 3641, 3641, 3641,
+     7282, 29127, 29127, 29127, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768},
+    // aq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // ar
+    {1916, 2299, 3449, 7282, 11115, 11115, 12648, 12648, 15331, 15331, 16864,
+     19738, 20505, 21272, 23572, 23572, 23572, 25105, 25105, 30469, 30469,
+     30469, 30469, 30469, 32385, 32768},
+    // as
+    {0, 0, 0, 0, 6242, 6242, 6242, 9363, 9363, 9363, 10923, 10923, 10923,
+     10923, 15604, 15604, 15604, 15604, 20285, 29648, 31208, 31208, 31208,
+     31208, 32768, 32768},
+    // at
+    {1947, 1947, 3245, 3245, 11679, 11679, 11679, 18817, 26928, 26928, 26928,
+     26928, 27577, 27577, 27577, 27577, 27577, 28875, 28875, 31470, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // au
+    {0, 0, 0, 1560, 4681, 4681, 7802, 7802, 7802, 7802, 7802, 9362, 10922,
+     12482, 12482, 12482, 12482, 17163, 26526, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // av
+    {3277, 3277, 3277, 3277, 16384, 16384, 16384, 16384, 29491, 29491, 29491,
+     29491, 29491, 29491, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // aw
+    {10922, 10922, 10922, 10922, 10922, 10922, 10922, 10922, 10922, 10922,
+     10922, 10922, 10922, 10922, 10922, 10922, 10922, 21845, 21845, 21845,
+     21845, 21845, 21845, 21845, 32768, 32768},
+    // ax
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     32768, 32768},
+    // ay
+    {0, 4096, 4096, 4096, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+     20480, 24576, 28672, 28672, 28672, 28672, 28672, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // az
+    {12287, 12287, 12287, 12287, 23210, 23210, 23210, 25941, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 32768},
+    // b^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // ba
+    {0, 4096, 6144, 8192, 8192, 8192, 8192, 8192, 8192, 8192, 10240, 12288,
+     12288, 18432, 18432, 18432, 18432, 24576, 28672, 28672, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // bb
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     32768, 32768},
+    // bc
+    {4054, 4054, 4720, 4720, 10829, 10829, 10829, 18272, 19883, 19883, 21438,
+     22549, 22549, 22549, 27159, 27159, 27215, 28048, 28159, 30991, 32324,
+     32324, 32324, 32324, 32768, 32768},
+    // bd
+    {3493, 3493, 3493, 4109, 15511, 15511, 15922, 15922, 21572, 21572, 21572,
+     21777, 22085, 22085, 24653, 24653, 24653, 27837, 27837, 28248, 30508,
+     30508, 30919, 30919, 32768, 32768},
+    // be
+    {1638, 1638, 5734, 6553, 7372, 8191, 9010, 10648, 10648, 10648, 10648,
+     13925, 13925, 16383, 16383, 16383, 16383, 27853, 28672, 31130, 31130,
+     31949, 31949, 31949, 32768, 32768},
+    // bf
+    {3081, 3081, 3081, 3081, 8962, 13863, 14143, 14143, 21286, 21286, 21286,
+     22126, 22686, 22686, 27447, 27447, 27447, 30248, 30248, 31088, 32488,
+     32488, 32488, 32488, 32768, 32768},
+    // bg
+    {4067, 4067, 4067, 4067, 13479, 13479, 13711, 17778, 20799, 20799, 20799,
+     22193, 22425, 23936, 26028, 26028, 26028, 29398, 29398, 29863, 32187,
+     32187, 32187, 32187, 32768, 32768},
+    // bh
+    {6963, 6963, 6963, 6963, 15155, 15155, 15155, 15155, 19456, 19456, 19456,
+     20002, 20821, 21708, 26965, 26965, 26965, 28194, 28331, 30242, 32085,
+     32085, 32222, 32222, 32768, 32768},
+    // bi
+    {3277, 3277, 3277, 3277, 3277, 3277, 9831, 9831, 9831, 9831, 9831, 22937,
+     22937, 29491, 29491, 29491, 29491, 29491, 29491, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // bj
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // bk
+    {4640, 4640, 4640, 4640, 17398, 17398, 17398, 17398, 22908, 22908, 22908,
+     25228, 25228, 26968, 28708, 28708, 28708, 31028, 31608, 31608, 32188,
+     32188, 32188, 32188, 32768, 32768},
+    // bl
+    {2521, 2521, 2521, 2521, 17644, 17644, 17644, 17644, 22685, 22685, 22685,
+     22685, 22685, 22685, 27726, 27726, 27726, 27726, 27726, 27726, 30247,
+     30247, 30247, 30247, 32768, 32768},
+    // bm
+    {8920, 9921, 9921, 9921, 17675, 17675, 17675, 17675, 22261, 22261, 22261,
+     22261, 23345, 23512, 28265, 30433, 30433, 30433, 31017, 31017, 32018,
+     32018, 32018, 32018, 32768, 32768},
+    // bn
+    {3358, 3358, 5446, 10257, 14115, 14206, 17973, 17973, 20605, 20877, 21512,
+     21784, 21920, 23599, 25142, 25142, 25142, 25324, 26413, 31315, 31678,
+     31860, 31860, 31860, 32586, 32768},
+    // bo
+    {2521, 5042, 5042, 10079, 10079, 10079, 10079, 12600, 15121, 15121, 15121,
+     15121, 15121, 15121, 17642, 17642, 17642, 20163, 20163, 22684, 25205,
+     27726, 27726, 30247, 32768, 32768},
+    // bp
+    {4478, 4682, 4682, 4682, 11295, 11499, 11499, 13636, 15061, 15061, 15061,
+     18114, 18216, 18216, 22694, 24831, 24831, 30224, 30631, 30835, 32361,
+     32361, 32361, 32361, 32768, 32768},
+    // bq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // br
+    {8192, 8192, 8192, 8192, 14336, 14336, 14336, 14336, 22528, 22528, 22528,
+     22528, 22528, 22528, 26624, 26624, 26624, 26624, 26624, 26624, 30720,
+     30720, 30720, 30720, 32768, 32768},
+    // bs
+    {2178, 2275, 4550, 4550, 11084, 11084, 11084, 12972, 16070, 16070, 16360,
+     16457, 16651, 16748, 20088, 21298, 21298, 21298, 23960, 30735, 32284,
+     32284, 32478, 32478, 32768, 32768},
+    // bt
+    {3075, 3075, 3363, 3363, 9753, 9753, 9753, 17202, 22247, 22247, 22247,
+     22631, 22823, 22823, 25129, 25129, 25129, 27531, 27915, 29453, 31087,
+     31087, 31279, 31279, 32768, 32768},
+    // bu
+    {0, 0, 0, 0, 0, 0, 0, 0, 9363, 9363, 9363, 9363, 9363, 9363, 9363, 9363,
+     9363, 9363, 18725, 28087, 28087, 28087, 28087, 28087, 32768, 32768},
+    // bv
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // bw
+    {7284, 7284, 7284, 7284, 12563, 12563, 12563, 17114, 23121, 23121, 23121,
+     23485, 23485, 24941, 29856, 29856, 29856, 31676, 32040, 32404, 32404,
+     32404, 32404, 32404, 32768, 32768},
+    // bx
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // by
+    {1365, 2730, 3413, 3413, 10922, 10922, 10922, 10922, 10922, 10922, 10922,
+     16383, 17066, 21162, 26282, 26965, 26965, 26965, 31061, 32085, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // bz
+    {12287, 12287, 12287, 12287, 23210, 23210, 23210, 25941, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 32768},
+    // c^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // ca
+    {0, 0, 0, 978, 978, 978, 978, 978, 978, 978, 978, 5869, 8803, 13205, 13205,
+     13205, 13205, 23965, 26899, 30812, 32768, 32768, 32768, 32768, 32768,
+     32768},
+    // cb
+    {4228, 4492, 4492, 4492, 15723, 15723, 15723, 15723, 18366, 18630, 18630,
+     22065, 22065, 22065, 25765, 25765, 25765, 29993, 29993, 29993, 31843,
+     32107, 32107, 32107, 32768, 32768},
+    // cc
+    {5461, 5461, 5461, 5461, 16385, 16385, 16385, 16385, 21846, 21846, 21846,
+     21846, 21846, 21846, 27307, 27307, 27307, 27307, 27307, 27307, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // cd
+    {3493, 3493, 3493, 4109, 15511, 15511, 15922, 15922, 21572, 21572, 21572,
+     21777, 22085, 22085, 24653, 24653, 24653, 27837, 27837, 28248, 30508,
+     30508, 30919, 30919, 32768, 32768},
+    // ce
+    {1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 2978, 2978, 2978, 4467,
+     4467, 14895, 14895, 16384, 16384, 22342, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // cf
+    {3081, 3081, 3081, 3081, 8962, 13863, 14143, 14143, 21286, 21286, 21286,
+     22126, 22686, 22686, 27447, 27447, 27447, 30248, 30248, 31088, 32488,
+     32488, 32488, 32488, 32768, 32768},
+    // cg
+    {4067, 4067, 4067, 4067, 13479, 13479, 13711, 17778, 20799, 20799, 20799,
+     22193, 22425, 23936, 26028, 26028, 26028, 29398, 29398, 29863, 32187,
+     32187, 32187, 32187, 32768, 32768},
+    // ch
+    {7710, 7710, 7710, 7710, 15739, 15739, 15739, 15739, 17667, 17667, 17667,
+     17667, 19595, 20559, 23772, 23772, 23772, 27306, 27949, 29234, 32125,
+     32125, 32768, 32768, 32768, 32768},
+    // ci
+    {18205, 18205, 18205, 20632, 25487, 27914, 27914, 27914, 27914, 27914,
+     27914, 27914, 27914, 27914, 27914, 27914, 27914, 27914, 30341, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // cj
+    {8445, 8445, 8445, 8445, 14526, 14526, 14526, 14526, 15202, 15202, 15202,
+     15202, 15202, 15202, 26687, 26687, 26687, 26687, 26687, 26687, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // ck
+    {0, 0, 0, 0, 16384, 16384, 16384, 16384, 16384, 16384, 16384, 24576, 24576,
+     24576, 24576, 24576, 24576, 24576, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // cl
+    {13107, 13107, 13107, 13107, 22937, 22937, 22937, 22937, 22937, 22937,
+     22937, 22937, 22937, 22937, 26214, 26214, 26214, 26214, 26214, 26214,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // cm
+    {8920, 9921, 9921, 9921, 17675, 17675, 17675, 17675, 22261, 22261, 22261,
+     22261, 23345, 23512, 28265, 30433, 30433, 30433, 31017, 31017, 32018,
+     32018, 32018, 32018, 32768, 32768},
+    // cn
+    {3358, 3358, 5446, 10257, 14115, 14206, 17973, 17973, 20605, 20877, 21512,
+     21784, 21920, 23599, 25142, 25142, 25142, 25324, 26413, 31315, 31678,
+     31860, 31860, 31860, 32586, 32768},
+    // co
+    {0, 851, 851, 851, 851, 1702, 2553, 2553, 2553, 2553, 2553, 7660, 13618,
+     22555, 23406, 23406, 23406, 25108, 25959, 26810, 31066, 32768, 32768,
+     32768, 32768, 32768},
+    // cp
+    {4478, 4682, 4682, 4682, 11295, 11499, 11499, 13636, 15061, 15061, 15061,
+     18114, 18216, 18216, 22694, 24831, 24831, 30224, 30631, 30835, 32361,
+     32361, 32361, 32361, 32768, 32768},
+    // cq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // cr
+    {2185, 2185, 2185, 2185, 15292, 15292, 15292, 15292, 24030, 24030, 24030,
+     24030, 24030, 24030, 28399, 28399, 28399, 28399, 28399, 28399, 28399,
+     28399, 28399, 28399, 32768, 32768},
+    // cs
+    {2178, 2275, 4550, 4550, 11084, 11084, 11084, 12972, 16070, 16070, 16360,
+     16457, 16651, 16748, 20088, 21298, 21298, 21298, 23960, 30735, 32284,
+     32284, 32478, 32478, 32768, 32768},
+    // ct
+    {0, 0, 0, 0, 2114, 2114, 2114, 2114, 15856, 15856, 15856, 17970, 17970,
+     17970, 26426, 26426, 26426, 26426, 26426, 26426, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // cu
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10923, 10923, 10923, 10923, 13654, 13654,
+     21846, 27307, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // cv
+    {2427, 2427, 2427, 2427, 21441, 21441, 21441, 21441, 29936, 29936, 29936,
+     29936, 29936, 29936, 32363, 32363, 32363, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // cw
+    {7284, 7284, 7284, 7284, 12563, 12563, 12563, 17114, 23121, 23121, 23121,
+     23485, 23485, 24941, 29856, 29856, 29856, 31676, 32040, 32404, 32404,
+     32404, 32404, 32404, 32768, 32768},
+    // cx
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // cy
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // cz
+    {12287, 12287, 12287, 12287, 23210, 23210, 23210, 25941, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 32768},
+    // d^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // da
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4681, 11703, 11703, 11703, 11703,
+     16384, 16384, 21065, 23406, 28087, 28087, 28087, 32768, 32768},
+    // db
+    {4228, 4492, 4492, 4492, 15723, 15723, 15723, 15723, 18366, 18630, 18630,
+     22065, 22065, 22065, 25765, 25765, 25765, 29993, 29993, 29993, 31843,
+     32107, 32107, 32107, 32768, 32768},
+    // dc
+    {4054, 4054, 4720, 4720, 10829, 10829, 10829, 18272, 19883, 19883, 21438,
+     22549, 22549, 22549, 27159, 27159, 27215, 28048, 28159, 30991, 32324,
+     32324, 32324, 32324, 32768, 32768},
+    // dd
+    {0, 0, 0, 0, 16384, 16384, 16384, 16384, 16384, 16384, 16384, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // de
+    {2881, 4321, 6482, 6482, 7922, 8642, 9362, 9362, 9362, 9362, 9362, 10802,
+     11162, 17644, 17644, 17644, 17644, 26647, 29528, 30248, 30248, 32048,
+     32048, 32048, 32048, 32768},
+    // df
+    {3081, 3081, 3081, 3081, 8962, 13863, 14143, 14143, 21286, 21286, 21286,
+     22126, 22686, 22686, 27447, 27447, 27447, 30248, 30248, 31088, 32488,
+     32488, 32488, 32488, 32768, 32768},
+    // dg
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // dh
+    {6963, 6963, 6963, 6963, 15155, 15155, 15155, 15155, 19456, 19456, 19456,
+     20002, 20821, 21708, 26965, 26965, 26965, 28194, 28331, 30242, 32085,
+     32085, 32222, 32222, 32768, 32768},
+    // di
+    {5957, 5957, 8340, 10723, 14298, 17277, 17277, 17277, 17277, 17277, 17277,
+     17277, 17277, 20852, 22044, 22044, 22044, 24427, 29193, 32172, 32172,
+     32768, 32768, 32768, 32768, 32768},
+    // dj
+    {8445, 8445, 8445, 8445, 14526, 14526, 14526, 14526, 15202, 15202, 15202,
+     15202, 15202, 15202, 26687, 26687, 26687, 26687, 26687, 26687, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // dk
+    {4640, 4640, 4640, 4640, 17398, 17398, 17398, 17398, 22908, 22908, 22908,
+     25228, 25228, 26968, 28708, 28708, 28708, 31028, 31608, 31608, 32188,
+     32188, 32188, 32188, 32768, 32768},
+    // dl
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // dm
+    {0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768},
+    // dn
+    {3358, 3358, 5446, 10257, 14115, 14206, 17973, 17973, 20605, 20877, 21512,
+     21784, 21920, 23599, 25142, 25142, 25142, 25324, 26413, 31315, 31678,
+     31860, 31860, 31860, 32586, 32768},
+    // do
+    {0, 0, 2731, 2731, 2731, 2731, 5462, 5462, 5462, 5462, 5462, 5462, 5462,
+     13653, 16384, 16384, 16384, 21845, 21845, 21845, 24576, 24576, 32768,
+     32768, 32768, 32768},
+    // dp
+    {4478, 4682, 4682, 4682, 11295, 11499, 11499, 13636, 15061, 15061, 15061,
+     18114, 18216, 18216, 22694, 24831, 24831, 30224, 30631, 30835, 32361,
+     32361, 32361, 32361, 32768, 32768},
+    // dq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // dr
+    {6342, 6342, 6342, 6342, 16913, 16913, 16913, 16913, 23255, 23255, 23255,
+     23255, 23255, 23255, 30654, 30654, 30654, 30654, 30654, 30654, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // ds
+    {2178, 2275, 4550, 4550, 11084, 11084, 11084, 12972, 16070, 16070, 16360,
+     16457, 16651, 16748, 20088, 21298, 21298, 21298, 23960, 30735, 32284,
+     32284, 32478, 32478, 32768, 32768},
+    // dt
+    {3075, 3075, 3363, 3363, 9753, 9753, 9753, 17202, 22247, 22247, 22247,
+     22631, 22823, 22823, 25129, 25129, 25129, 27531, 27915, 29453, 31087,
+     31087, 31279, 31279, 32768, 32768},
+    // du
+    {1489, 4468, 17873, 17873, 17873, 17873, 17873, 17873, 17873, 17873, 17873,
+     20852, 20852, 20852, 20852, 23831, 23831, 29789, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // dv
+    {2427, 2427, 2427, 2427, 21441, 21441, 21441, 21441, 29936, 29936, 29936,
+     29936, 29936, 29936, 32363, 32363, 32363, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // dw
+    {16384, 16384, 16384, 16384, 16384, 16384, 16384, 16384, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // dx
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // dy
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // dz
+    {12287, 12287, 12287, 12287, 23210, 23210, 23210, 25941, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 32768},
+    // e^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // ea
+    {0, 0, 2521, 6554, 6554, 6554, 7058, 7562, 7562, 7562, 8570, 11595, 12603,
+     14619, 14619, 15123, 15123, 22182, 26719, 30752, 31760, 32768, 32768,
+     32768, 32768, 32768},
+    // eb
+    {5461, 5461, 5461, 5461, 16385, 16385, 16385, 16385, 16385, 16385, 16385,
+     16385, 16385, 16385, 21846, 21846, 21846, 27307, 27307, 27307, 27307,
+     32768, 32768, 32768, 32768, 32768},
+    // ec
+    {1771, 1771, 2657, 2657, 7085, 7085, 7085, 8413, 12398, 12398, 15055,
+     15055, 15055, 15055, 21254, 21254, 21254, 22140, 22140, 30997, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // ed
+    {0, 0, 0, 0, 3277, 3277, 9829, 9829, 16383, 16383, 16383, 16383, 16383,
+     16383, 16383, 16383, 16383, 22937, 22937, 22937, 29491, 29491, 32768,
+     32768, 32768, 32768},
+    // ee
+    {0, 0, 0, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 7084, 10626, 12397,
+     20370, 20370, 23912, 23912, 25683, 27454, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // ef
+    {3641, 3641, 3641, 3641, 10923, 21845, 21845, 21845, 25486, 25486, 25486,
+     25486, 25486, 25486, 29127, 29127, 29127, 29127, 29127, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // eg
+    {6552, 6552, 6552, 6552, 9829, 9829, 9829, 9829, 16383, 16383, 16383,
+     19660, 19660, 19660, 26214, 26214, 26214, 29491, 29491, 29491, 29491,
+     29491, 29491, 29491, 32768, 32768},
+    // eh
+    {10922, 10922, 10922, 10922, 10922, 10922, 10922, 10922, 21845, 21845,
+     21845, 21845, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // ei
+    {0, 1928, 1928, 5783, 7711, 9639, 15418, 15418, 15418, 15418, 17346, 17346,
+     17346, 23129, 23129, 23129, 23129, 25057, 26985, 30840, 30840, 32768,
+     32768, 32768, 32768, 32768},
+    // ej
+    {32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // ek
+    {4640, 4640, 4640, 4640, 17398, 17398, 17398, 17398, 22908, 22908, 22908,
+     25228, 25228, 26968, 28708, 28708, 28708, 31028, 31608, 31608, 32188,
+     32188, 32188, 32188, 32768, 32768},
+    // el
+    {2023, 2023, 2023, 3641, 5664, 9709, 9709, 9709, 16586, 16586, 16586,
+     27104, 27104, 27104, 28318, 29127, 29127, 29127, 30745, 30745, 30745,
+     31150, 31150, 31150, 32768, 32768},
+    // em
+    {2114, 6342, 6342, 6342, 13742, 13742, 13742, 13742, 17970, 17970, 17970,
+     17970, 20084, 20084, 27483, 29597, 29597, 29597, 30654, 30654, 30654,
+     30654, 30654, 30654, 32768, 32768},
+    // en
+    {537, 537, 3491, 6177, 8863, 8863, 9937, 9937, 11011, 12623, 12623, 13160,
+     13160, 14772, 15309, 15309, 15309, 15846, 16920, 31694, 31694, 32231,
+     32231, 32231, 32231, 32768},
+    // eo
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13107, 13107, 19661, 19661, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // ep
+    {4096, 4096, 4096, 4096, 4096, 4096, 4096, 16384, 16384, 16384, 16384,
+     16384, 16384, 16384, 20480, 24576, 24576, 28672, 28672, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // eq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // er
+    {3164, 3164, 3164, 3164, 8134, 8812, 11072, 11524, 15366, 15366, 15366,
+     16270, 17400, 19660, 20112, 20112, 20112, 22824, 25762, 29378, 29378,
+     30734, 30734, 30734, 32768, 32768},
+    // es
+    {1598, 1598, 3996, 3996, 8791, 8791, 8791, 8791, 10389, 10389, 10389,
+     10389, 10389, 10389, 11188, 14784, 14784, 14784, 24776, 31969, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // et
+    {0, 0, 0, 0, 4681, 4681, 4681, 14044, 18725, 18725, 18725, 18725, 18725,
+     18725, 18725, 18725, 18725, 21846, 21846, 28088, 29648, 29648, 31208,
+     31208, 32768, 32768},
+    // eu
+    {0, 0, 0, 0, 0, 0, 16384, 16384, 16384, 16384, 16384, 16384, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768},
+    // ev
+    {0, 0, 0, 0, 27888, 27888, 27888, 27888, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // ew
+    {0, 0, 0, 0, 0, 0, 0, 0, 16384, 16384, 16384, 16384, 16384, 16384, 16384,
+     16384, 16384, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768},
+    // ex
+    {10348, 10348, 10348, 10348, 13797, 13797, 13797, 13797, 17246, 17246,
+     17246, 17246, 17246, 17246, 17246, 29319, 29319, 29319, 29319, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // ey
+    {0, 0, 0, 0, 21845, 21845, 21845, 21845, 21845, 21845, 21845, 21845, 21845,
+     21845, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // ez
+    {12287, 12287, 12287, 12287, 23210, 23210, 23210, 25941, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 32768},
+    // f^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // fa
+    {0, 0, 8936, 8936, 11915, 11915, 11915, 11915, 14894, 14894, 14894, 17873,
+     20852, 23831, 23831, 23831, 23831, 26810, 26810, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // fb
+    {4228, 4492, 4492, 4492, 15723, 15723, 15723, 15723, 18366, 18630, 18630,
+     22065, 22065, 22065, 25765, 25765, 25765, 29993, 29993, 29993, 31843,
+     32107, 32107, 32107, 32768, 32768},
+    // fc
+    {4054, 4054, 4720, 4720, 10829, 10829, 10829, 18272, 19883, 19883, 21438,
+     22549, 22549, 22549, 27159, 27159, 27215, 28048, 28159, 30991, 32324,
+     32324, 32324, 32324, 32768, 32768},
+    // fd
+    {3493, 3493, 3493, 4109, 15511, 15511, 15922, 15922, 21572, 21572, 21572,
+     21777, 22085, 22085, 24653, 24653, 24653, 27837, 27837, 28248, 30508,
+     30508, 30919, 30919, 32768, 32768},
+    // fe
+    {1638, 3276, 6553, 8191, 13106, 13106, 13106, 13106, 14744, 14744, 14744,
+     16382, 16382, 18020, 18020, 18020, 18020, 29492, 31130, 31130, 31130,
+     31130, 32768, 32768, 32768, 32768},
+    // ff
+    {0, 0, 0, 0, 15778, 15778, 15778, 15778, 25487, 25487, 25487, 25487, 27914,
+     27914, 30341, 30341, 30341, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // fg
+    {32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // fh
+    {6963, 6963, 6963, 6963, 15155, 15155, 15155, 15155, 19456, 19456, 19456,
+     20002, 20821, 21708, 26965, 26965, 26965, 28194, 28331, 30242, 32085,
+     32085, 32222, 32222, 32768, 32768},
+    // fi
+    {1285, 1285, 8353, 8353, 9638, 9638, 12208, 12208, 12208, 12208, 12208,
+     14778, 14778, 23773, 23773, 23773, 23773, 27628, 30198, 31483, 31483,
+     32768, 32768, 32768, 32768, 32768},
+    // fj
+    {8445, 8445, 8445, 8445, 14526, 14526, 14526, 14526, 15202, 15202, 15202,
+     15202, 15202, 15202, 26687, 26687, 26687, 26687, 26687, 26687, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // fk
+    {4640, 4640, 4640, 4640, 17398, 17398, 17398, 17398, 22908, 22908, 22908,
+     25228, 25228, 26968, 28708, 28708, 28708, 31028, 31608, 31608, 32188,
+     32188, 32188, 32188, 32768, 32768},
+    // fl
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21845, 21845, 21845, 21845,
+     21845, 21845, 21845, 21845, 21845, 21845, 32768, 32768},
+    // fm
+    {32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // fn
+    {3358, 3358, 5446, 10257, 14115, 14206, 17973, 17973, 20605, 20877, 21512,
+     21784, 21920, 23599, 25142, 25142, 25142, 25324, 26413, 31315, 31678,
+     31860, 31860, 31860, 32586, 32768},
+    // fo
+    {0, 0, 1928, 1928, 1928, 1928, 1928, 1928, 1928, 1928, 1928, 3856, 3856,
+     3856, 7711, 7711, 7711, 30840, 30840, 30840, 32768, 32768, 32768, 32768,
+     32768, 32768},
+    // fp
+    {4478, 4682, 4682, 4682, 11295, 11499, 11499, 13636, 15061, 15061, 15061,
+     18114, 18216, 18216, 22694, 24831, 24831, 30224, 30631, 30835, 32361,
+     32361, 32361, 32361, 32768, 32768},
+    // fq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // fr
+    {16383, 16383, 16383, 16383, 22937, 22937, 22937, 22937, 29491, 29491,
+     29491, 29491, 29491, 29491, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // fs
+    {2178, 2275, 4550, 4550, 11084, 11084, 11084, 12972, 16070, 16070, 16360,
+     16457, 16651, 16748, 20088, 21298, 21298, 21298, 23960, 30735, 32284,
+     32284, 32478, 32478, 32768, 32768},
+    // ft
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // fu
+    {0, 0, 6554, 6554, 6554, 6554, 6554, 6554, 6554, 6554, 6554, 19660, 19660,
+     26214, 26214, 26214, 26214, 26214, 26214, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // fv
+    {2427, 2427, 2427, 2427, 21441, 21441, 21441, 21441, 29936, 29936, 29936,
+     29936, 29936, 29936, 32363, 32363, 32363, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // fw
+    {7284, 7284, 7284, 7284, 12563, 12563, 12563, 17114, 23121, 23121, 23121,
+     23485, 23485, 24941, 29856, 29856, 29856, 31676, 32040, 32404, 32404,
+     32404, 32404, 32404, 32768, 32768},
+    // fx
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // fy
+    {1365, 2730, 3413, 3413, 10922, 10922, 10922, 10922, 10922, 10922, 10922,
+     16383, 17066, 21162, 26282, 26965, 26965, 26965, 31061, 32085, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // fz
+    {12287, 12287, 12287, 12287, 23210, 23210, 23210, 25941, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 32768},
+    // g^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // ga
+    {0, 1986, 1986, 1986, 1986, 1986, 1986, 1986, 7944, 7944, 7944, 13902,
+     15888, 22839, 22839, 22839, 22839, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // gb
+    {4228, 4492, 4492, 4492, 15723, 15723, 15723, 15723, 18366, 18630, 18630,
+     22065, 22065, 22065, 25765, 25765, 25765, 29993, 29993, 29993, 31843,
+     32107, 32107, 32107, 32768, 32768},
+    // gc
+    {4054, 4054, 4720, 4720, 10829, 10829, 10829, 18272, 19883, 19883, 21438,
+     22549, 22549, 22549, 27159, 27159, 27215, 28048, 28159, 30991, 32324,
+     32324, 32324, 32324, 32768, 32768},
+    // gd
+    {3493, 3493, 3493, 4109, 15511, 15511, 15922, 15922, 21572, 21572, 21572,
+     21777, 22085, 22085, 24653, 24653, 24653, 27837, 27837, 28248, 30508,
+     30508, 30919, 30919, 32768, 32768},
+    // ge
+    {0, 0, 0, 0, 0, 0, 0, 0, 1524, 1524, 1524, 7620, 8382, 14478, 16002, 16002,
+     16002, 26672, 28196, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // gf
+    {3081, 3081, 3081, 3081, 8962, 13863, 14143, 14143, 21286, 21286, 21286,
+     22126, 22686, 22686, 27447, 27447, 27447, 30248, 30248, 31088, 32488,
+     32488, 32488, 32488, 32768, 32768},
+    // gg
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // gh
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3641, 3641, 3641, 3641, 3641,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // gi
+    {0, 0, 2731, 2731, 2731, 2731, 2731, 2731, 2731, 2731, 2731, 2731, 2731,
+     10923, 21845, 21845, 21845, 24576, 24576, 24576, 30037, 32768, 32768,
+     32768, 32768, 32768},
+    // gj
+    {8445, 8445, 8445, 8445, 14526, 14526, 14526, 14526, 15202, 15202, 15202,
+     15202, 15202, 15202, 26687, 26687, 26687, 26687, 26687, 26687, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // gk
+    {4640, 4640, 4640, 4640, 17398, 17398, 17398, 17398, 22908, 22908, 22908,
+     25228, 25228, 26968, 28708, 28708, 28708, 31028, 31608, 31608, 32188,
+     32188, 32188, 32188, 32768, 32768},
+    // gl
+    {10923, 10923, 10923, 10923, 27307, 27307, 27307, 27307, 27307, 27307,
+     27307, 27307, 27307, 27307, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // gm
+    {32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // gn
+    {0, 0, 0, 0, 13107, 13107, 13107, 13107, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // go
+    {5041, 5041, 5041, 5041, 5041, 5041, 5041, 5041, 5041, 5041, 5041, 10082,
+     10082, 20165, 25206, 25206, 25206, 30247, 30247, 30247, 30247, 32768,
+     32768, 32768, 32768, 32768},
+    // gp
+    {4478, 4682, 4682, 4682, 11295, 11499, 11499, 13636, 15061, 15061, 15061,
+     18114, 18216, 18216, 22694, 24831, 24831, 30224, 30631, 30835, 32361,
+     32361, 32361, 32361, 32768, 32768},
+    // gq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // gr
+    {6780, 6780, 6780, 6780, 21469, 21469, 21469, 21469, 21469, 21469, 21469,
+     21469, 21469, 21469, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // gs
+    {2178, 2275, 4550, 4550, 11084, 11084, 11084, 12972, 16070, 16070, 16360,
+     16457, 16651, 16748, 20088, 21298, 21298, 21298, 23960, 30735, 32284,
+     32284, 32478, 32478, 32768, 32768},
+    // gt
+    {3075, 3075, 3363, 3363, 9753, 9753, 9753, 17202, 22247, 22247, 22247,
+     22631, 22823, 22823, 25129, 25129, 25129, 27531, 27915, 29453, 31087,
+     31087, 31279, 31279, 32768, 32768},
+    // gu
+    {3277, 3277, 3277, 3277, 16383, 16383, 16383, 16383, 16383, 16383, 16383,
+     16383, 16383, 22937, 22937, 22937, 22937, 26214, 26214, 26214, 26214,
+     26214, 26214, 26214, 32768, 32768},
+    // gv
+    {2427, 2427, 2427, 2427, 21441, 21441, 21441, 21441, 29936, 29936, 29936,
+     29936, 29936, 29936, 32363, 32363, 32363, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // gw
+    {7284, 7284, 7284, 7284, 12563, 12563, 12563, 17114, 23121, 23121, 23121,
+     23485, 23485, 24941, 29856, 29856, 29856, 31676, 32040, 32404, 32404,
+     32404, 32404, 32404, 32768, 32768},
+    // gx
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // gy
+    {1365, 2730, 3413, 3413, 10922, 10922, 10922, 10922, 10922, 10922, 10922,
+     16383, 17066, 21162, 26282, 26965, 26965, 26965, 31061, 32085, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // gz
+    {12287, 12287, 12287, 12287, 23210, 23210, 23210, 25941, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 32768},
+    // h^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // ha
+    {683, 683, 683, 2048, 2731, 3414, 3414, 4097, 5462, 5462, 6145, 8876, 9559,
+     18432, 18432, 20480, 20480, 28672, 29355, 31403, 31403, 32768, 32768,
+     32768, 32768, 32768},
+    // hb
+    {4228, 4492, 4492, 4492, 15723, 15723, 15723, 15723, 18366, 18630, 18630,
+     22065, 22065, 22065, 25765, 25765, 25765, 29993, 29993, 29993, 31843,
+     32107, 32107, 32107, 32768, 32768},
+    // hc
+    {4054, 4054, 4720, 4720, 10829, 10829, 10829, 18272, 19883, 19883, 21438,
+     22549, 22549, 22549, 27159, 27159, 27215, 28048, 28159, 30991, 32324,
+     32324, 32324, 32324, 32768, 32768},
+    // hd
+    {3493, 3493, 3493, 4109, 15511, 15511, 15922, 15922, 21572, 21572, 21572,
+     21777, 22085, 22085, 24653, 24653, 24653, 27837, 27837, 28248, 30508,
+     30508, 30919, 30919, 32768, 32768},
+    // he
+    {3419, 3419, 3989, 3989, 4559, 4559, 4559, 4559, 6269, 6269, 6269, 10258,
+     11113, 13962, 14532, 14532, 14532, 29918, 30488, 31058, 31058, 31058,
+     31628, 31628, 32198, 32768},
+    // hf
+    {3081, 3081, 3081, 3081, 8962, 13863, 14143, 14143, 21286, 21286, 21286,
+     22126, 22686, 22686, 27447, 27447, 27447, 30248, 30248, 31088, 32488,
+     32488, 32488, 32488, 32768, 32768},
+    // hg
+    {4067, 4067, 4067, 4067, 13479, 13479, 13711, 17778, 20799, 20799, 20799,
+     22193, 22425, 23936, 26028, 26028, 26028, 29398, 29398, 29863, 32187,
+     32187, 32187, 32187, 32768, 32768},
+    // hh
+    {6963, 6963, 6963, 6963, 15155, 15155, 15155, 15155, 19456, 19456, 19456,
+     20002, 20821, 21708, 26965, 26965, 26965, 28194, 28331, 30242, 32085,
+     32085, 32222, 32222, 32768, 32768},
+    // hi
+    {3223, 3223, 5372, 5372, 7521, 7521, 8595, 8595, 8595, 8595, 8595, 12892,
+     15041, 23099, 23099, 23636, 23636, 26859, 30082, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // hj
+    {8445, 8445, 8445, 8445, 14526, 14526, 14526, 14526, 15202, 15202, 15202,
+     15202, 15202, 15202, 26687, 26687, 26687, 26687, 26687, 26687, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // hk
+    {4640, 4640, 4640, 4640, 17398, 17398, 17398, 17398, 22908, 22908, 22908,
+     25228, 25228, 26968, 28708, 28708, 28708, 31028, 31608, 31608, 32188,
+     32188, 32188, 32188, 32768, 32768},
+    // hl
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // hm
+    {6554, 6554, 6554, 6554, 13108, 13108, 13108, 13108, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // hn
+    {0, 0, 0, 0, 9363, 9363, 9363, 9363, 9363, 9363, 9363, 9363, 9363, 18725,
+     23406, 23406, 23406, 23406, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768},
+    // ho
+    {0, 0, 0, 0, 0, 1748, 1748, 1748, 2622, 2622, 2622, 6117, 8738, 11359,
+     13980, 14854, 14854, 19223, 21844, 22718, 30147, 30147, 32768, 32768,
+     32768, 32768},
+    // hp
+    {4478, 4682, 4682, 4682, 11295, 11499, 11499, 13636, 15061, 15061, 15061,
+     18114, 18216, 18216, 22694, 24831, 24831, 30224, 30631, 30835, 32361,
+     32361, 32361, 32361, 32768, 32768},
+    // hq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // hr
+    {0, 0, 0, 0, 7282, 7282, 7282, 7282, 20025, 20025, 20025, 20025, 20025,
+     20025, 29127, 29127, 29127, 29127, 29127, 29127, 29127, 29127, 29127,
+     29127, 32768, 32768},
+    // hs
+    {2178, 2275, 4550, 4550, 11084, 11084, 11084, 12972, 16070, 16070, 16360,
+     16457, 16651, 16748, 20088, 21298, 21298, 21298, 23960, 30735, 32284,
+     32284, 32478, 32478, 32768, 32768},
+    // ht
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // hu
+    {2427, 4854, 4854, 4854, 4854, 4854, 7281, 7281, 7281, 7281, 7281, 12136,
+     15777, 20632, 20632, 20632, 20632, 25487, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // hv
+    {2427, 2427, 2427, 2427, 21441, 21441, 21441, 21441, 29936, 29936, 29936,
+     29936, 29936, 29936, 32363, 32363, 32363, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // hw
+    {32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // hx
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // hy
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // hz
+    {12287, 12287, 12287, 12287, 23210, 23210, 23210, 25941, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 32768},
+    // i^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // ia
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10923, 17645, 29408, 29408, 29408, 29408,
+     31088, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // ib
+    {0, 0, 0, 0, 21845, 21845, 21845, 21845, 21845, 21845, 21845, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // ic
+    {4896, 4896, 5649, 5649, 13935, 13935, 13935, 21468, 22975, 22975, 25988,
+     26741, 26741, 26741, 28248, 28248, 28248, 28248, 29001, 30508, 32015,
+     32015, 32015, 32015, 32768, 32768},
+    // id
+    {1986, 1986, 1986, 3972, 29789, 29789, 29789, 29789, 29789, 29789, 29789,
+     29789, 29789, 29789, 29789, 29789, 29789, 29789, 29789, 31775, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // ie
+    {0, 0, 1456, 2912, 2912, 2912, 5825, 5825, 5825, 5825, 5825, 13108, 13108,
+     18205, 18205, 18205, 18205, 24030, 25486, 28399, 28399, 29855, 32768,
+     32768, 32768, 32768},
+    // if
+    {0, 0, 0, 0, 7282, 20025, 20025, 20025, 25486, 25486, 25486, 25486, 25486,
+     25486, 25486, 25486, 25486, 25486, 25486, 25486, 29127, 29127, 29127,
+     29127, 32768, 32768},
+    // ig
+    {1394, 1394, 1394, 1394, 2788, 2788, 2788, 18127, 20916, 20916, 20916,
+     20916, 20916, 27191, 27191, 27191, 27191, 27191, 27191, 28585, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // ih
+    {6963, 6963, 6963, 6963, 15155, 15155, 15155, 15155, 19456, 19456, 19456,
+     20002, 20821, 21708, 26965, 26965, 26965, 28194, 28331, 30242, 32085,
+     32085, 32222, 32222, 32768, 32768},
+    // ii
+    {2354, 2548, 5773, 7224, 9449, 10062, 11771, 11771, 11771, 11836, 12094,
+     14352, 15610, 21737, 23995, 24221, 24221, 25382, 28285, 31284, 31413,
+     32284, 32284, 32413, 32413, 32768},
+    // ij
+    {32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // ik
+    {8192, 8192, 8192, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // il
+    {2185, 2185, 2185, 4370, 5462, 5462, 5462, 5462, 10923, 10923, 10923,
+     26215, 27307, 27307, 27307, 27307, 27307, 27307, 28399, 28399, 28399,
+     29491, 29491, 29491, 32768, 32768},
+    // im
+    {7490, 9362, 9362, 9362, 14979, 14979, 14979, 14979, 16851, 16851, 16851,
+     16851, 17787, 17787, 21532, 30896, 30896, 30896, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // in
+    {1783, 1783, 4904, 9139, 13820, 14043, 22067, 22067, 23627, 23627, 24519,
+     24965, 24965, 25411, 25857, 25857, 25857, 26303, 28309, 31430, 32322,
+     32768, 32768, 32768, 32768, 32768},
+    // io
+    {0, 0, 0, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+     27483, 27483, 27483, 27483, 28540, 28540, 28540, 31711, 32768, 32768,
+     32768, 32768, 32768},
+    // ip
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // iq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // ir
+    {0, 0, 0, 2341, 16383, 16383, 18724, 18724, 18724, 18724, 18724, 23405,
+     25746, 25746, 30427, 30427, 30427, 30427, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // is
+    {3025, 3025, 6050, 6050, 11091, 11091, 11091, 14116, 16637, 16637, 17645,
+     18653, 18653, 18653, 19661, 19661, 19661, 19661, 23694, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // it
+    {1725, 1725, 2587, 2587, 8192, 8192, 8192, 14228, 18108, 18108, 18108,
+     18108, 18108, 18108, 18970, 18970, 18970, 19832, 21557, 25006, 26299,
+     26299, 26299, 26299, 32768, 32768},
+    // iu
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16384, 16384, 16384, 16384, 16384, 16384,
+     16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // iv
+    {4855, 4855, 4855, 4855, 26700, 26700, 26700, 26700, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // iw
+    {7284, 7284, 7284, 7284, 12563, 12563, 12563, 17114, 23121, 23121, 23121,
+     23485, 23485, 24941, 29856, 29856, 29856, 31676, 32040, 32404, 32404,
+     32404, 32404, 32404, 32768, 32768},
+    // ix
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // iy
+    {1365, 2730, 3413, 3413, 10922, 10922, 10922, 10922, 10922, 10922, 10922,
+     16383, 17066, 21162, 26282, 26965, 26965, 26965, 31061, 32085, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // iz
+    {8937, 8937, 8937, 8937, 26810, 26810, 26810, 26810, 26810, 26810, 26810,
+     26810, 26810, 26810, 26810, 26810, 26810, 26810, 26810, 26810, 26810,
+     26810, 26810, 26810, 26810, 32768},
+    // j^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // ja
+    {0, 0, 9177, 9177, 9177, 9177, 11798, 14419, 14419, 14419, 14419, 14419,
+     19662, 27526, 27526, 27526, 27526, 27526, 30147, 30147, 30147, 32768,
+     32768, 32768, 32768, 32768},
+    // jb
+    {4228, 4492, 4492, 4492, 15723, 15723, 15723, 15723, 18366, 18630, 18630,
+     22065, 22065, 22065, 25765, 25765, 25765, 29993, 29993, 29993, 31843,
+     32107, 32107, 32107, 32768, 32768},
+    // jc
+    {4054, 4054, 4720, 4720, 10829, 10829, 10829, 18272, 19883, 19883, 21438,
+     22549, 22549, 22549, 27159, 27159, 27215, 28048, 28159, 30991, 32324,
+     32324, 32324, 32324, 32768, 32768},
+    // jd
+    {3493, 3493, 3493, 4109, 15511, 15511, 15922, 15922, 21572, 21572, 21572,
+     21777, 22085, 22085, 24653, 24653, 24653, 27837, 27837, 28248, 30508,
+     30508, 30919, 30919, 32768, 32768},
+    // je
+    {3641, 3641, 10922, 10922, 10922, 14563, 14563, 14563, 14563, 14563, 14563,
+     14563, 14563, 18204, 18204, 18204, 18204, 25486, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // jf
+    {3081, 3081, 3081, 3081, 8962, 13863, 14143, 14143, 21286, 21286, 21286,
+     22126, 22686, 22686, 27447, 27447, 27447, 30248, 30248, 31088, 32488,
+     32488, 32488, 32488, 32768, 32768},
+    // jg
+    {4067, 4067, 4067, 4067, 13479, 13479, 13711, 17778, 20799, 20799, 20799,
+     22193, 22425, 23936, 26028, 26028, 26028, 29398, 29398, 29863, 32187,
+     32187, 32187, 32187, 32768, 32768},
+    // jh
+    {6963, 6963, 6963, 6963, 15155, 15155, 15155, 15155, 19456, 19456, 19456,
+     20002, 20821, 21708, 26965, 26965, 26965, 28194, 28331, 30242, 32085,
+     32085, 32222, 32222, 32768, 32768},
+    // ji
+    {2354, 2548, 5773, 7224, 9449, 10062, 11771, 11771, 11771, 11836, 12094,
+     14352, 15610, 21737, 23995, 24221, 24221, 25382, 28285, 31284, 31413,
+     32284, 32284, 32413, 32413, 32768},
+    // jj
+    {8445, 8445, 8445, 8445, 14526, 14526, 14526, 14526, 15202, 15202, 15202,
+     15202, 15202, 15202, 26687, 26687, 26687, 26687, 26687, 26687, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // jk
+    {4640, 4640, 4640, 4640, 17398, 17398, 17398, 17398, 22908, 22908, 22908,
+     25228, 25228, 26968, 28708, 28708, 28708, 31028, 31608, 31608, 32188,
+     32188, 32188, 32188, 32768, 32768},
+    // jl
+    {4634, 4823, 4823, 6525, 13522, 14420, 14515, 14515, 19054, 19054, 19338,
+     23925, 24114, 24114, 26951, 27140, 27140, 27235, 27613, 28370, 29316,
+     29647, 29742, 29742, 32484, 32768},
+    // jm
+    {8920, 9921, 9921, 9921, 17675, 17675, 17675, 17675, 22261, 22261, 22261,
+     22261, 23345, 23512, 28265, 30433, 30433, 30433, 31017, 31017, 32018,
+     32018, 32018, 32018, 32768, 32768},
+    // jn
+    {3358, 3358, 5446, 10257, 14115, 14206, 17973, 17973, 20605, 20877, 21512,
+     21784, 21920, 23599, 25142, 25142, 25142, 25324, 26413, 31315, 31678,
+     31860, 31860, 31860, 32586, 32768},
+    // jo
+    {1928, 3856, 3856, 3856, 5784, 5784, 5784, 11564, 13492, 13492, 13492,
+     13492, 13492, 19275, 19275, 19275, 19275, 23130, 28913, 28913, 28913,
+     28913, 28913, 28913, 32768, 32768},
+    // jp
+    {4478, 4682, 4682, 4682, 11295, 11499, 11499, 13636, 15061, 15061, 15061,
+     18114, 18216, 18216, 22694, 24831, 24831, 30224, 30631, 30835, 32361,
+     32361, 32361, 32361, 32768, 32768},
+    // jq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // jr
+    {3877, 3946, 4426, 5593, 13485, 13588, 14514, 14583, 18769, 18769, 19249,
+     20107, 20896, 21651, 25734, 25734, 25734, 26626, 27415, 29577, 30400,
+     30606, 30675, 30675, 32699, 32768},
+    // js
+    {2178, 2275, 4550, 4550, 11084, 11084, 11084, 12972, 16070, 16070, 16360,
+     16457, 16651, 16748, 20088, 21298, 21298, 21298, 23960, 30735, 32284,
+     32284, 32478, 32478, 32768, 32768},
+    // jt
+    {3075, 3075, 3363, 3363, 9753, 9753, 9753, 17202, 22247, 22247, 22247,
+     22631, 22823, 22823, 25129, 25129, 25129, 27531, 27915, 29453, 31087,
+     31087, 31279, 31279, 32768, 32768},
+    // ju
+    {3641, 3641, 3641, 10922, 10922, 10922, 10922, 10922, 10922, 10922, 10922,
+     18204, 18204, 21845, 21845, 21845, 21845, 25486, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // jv
+    {2427, 2427, 2427, 2427, 21441, 21441, 21441, 21441, 29936, 29936, 29936,
+     29936, 29936, 29936, 32363, 32363, 32363, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // jw
+    {7284, 7284, 7284, 7284, 12563, 12563, 12563, 17114, 23121, 23121, 23121,
+     23485, 23485, 24941, 29856, 29856, 29856, 31676, 32040, 32404, 32404,
+     32404, 32404, 32404, 32768, 32768},
+    // jx
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // jy
+    {1365, 2730, 3413, 3413, 10922, 10922, 10922, 10922, 10922, 10922, 10922,
+     16383, 17066, 21162, 26282, 26965, 26965, 26965, 31061, 32085, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // jz
+    {12287, 12287, 12287, 12287, 23210, 23210, 23210, 25941, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 32768},
+    // k^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // ka
+    {0, 0, 0, 0, 0, 0, 0, 0, 4681, 4681, 4681, 4681, 4681, 4681, 4681, 4681,
+     4681, 9362, 14043, 28087, 28087, 28087, 28087, 28087, 32768, 32768},
+    // kb
+    {4228, 4492, 4492, 4492, 15723, 15723, 15723, 15723, 18366, 18630, 18630,
+     22065, 22065, 22065, 25765, 25765, 25765, 29993, 29993, 29993, 31843,
+     32107, 32107, 32107, 32768, 32768},
+    // kc
+    {4054, 4054, 4720, 4720, 10829, 10829, 10829, 18272, 19883, 19883, 21438,
+     22549, 22549, 22549, 27159, 27159, 27215, 28048, 28159, 30991, 32324,
+     32324, 32324, 32324, 32768, 32768},
+    // kd
+    {3493, 3493, 3493, 4109, 15511, 15511, 15922, 15922, 21572, 21572, 21572,
+     21777, 22085, 22085, 24653, 24653, 24653, 27837, 27837, 28248, 30508,
+     30508, 30919, 30919, 32768, 32768},
+    // ke
+    {0, 0, 0, 0, 2185, 2185, 2185, 2185, 4370, 4370, 4370, 10924, 10924, 17478,
+     17478, 17478, 17478, 26213, 26213, 28398, 28398, 30583, 30583, 30583,
+     32768, 32768},
+    // kf
+    {3081, 3081, 3081, 3081, 8962, 13863, 14143, 14143, 21286, 21286, 21286,
+     22126, 22686, 22686, 27447, 27447, 27447, 30248, 30248, 31088, 32488,
+     32488, 32488, 32488, 32768, 32768},
+    // kg
+    {4067, 4067, 4067, 4067, 13479, 13479, 13711, 17778, 20799, 20799, 20799,
+     22193, 22425, 23936, 26028, 26028, 26028, 29398, 29398, 29863, 32187,
+     32187, 32187, 32187, 32768, 32768},
+    // kh
+    {6963, 6963, 6963, 6963, 15155, 15155, 15155, 15155, 19456, 19456, 19456,
+     20002, 20821, 21708, 26965, 26965, 26965, 28194, 28331, 30242, 32085,
+     32085, 32222, 32222, 32768, 32768},
+    // ki
+    {0, 0, 0, 3855, 7710, 7710, 7710, 7710, 7710, 7710, 7710, 15420, 19275,
+     28913, 28913, 28913, 28913, 28913, 28913, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // kj
+    {8445, 8445, 8445, 8445, 14526, 14526, 14526, 14526, 15202, 15202, 15202,
+     15202, 15202, 15202, 26687, 26687, 26687, 26687, 26687, 26687, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // kk
+    {4640, 4640, 4640, 4640, 17398, 17398, 17398, 17398, 22908, 22908, 22908,
+     25228, 25228, 26968, 28708, 28708, 28708, 31028, 31608, 31608, 32188,
+     32188, 32188, 32188, 32768, 32768},
+    // kl
+    {8192, 8192, 8192, 8192, 24576, 24576, 24576, 24576, 24576, 24576, 24576,
+     24576, 24576, 24576, 24576, 24576, 24576, 24576, 24576, 24576, 24576,
+     24576, 24576, 24576, 32768, 32768},
+    // km
+    {8920, 9921, 9921, 9921, 17675, 17675, 17675, 17675, 22261, 22261, 22261,
+     22261, 23345, 23512, 28265, 30433, 30433, 30433, 31017, 31017, 32018,
+     32018, 32018, 32018, 32768, 32768},
+    // kn
+    {0, 0, 0, 0, 0, 0, 0, 0, 10923, 10923, 10923, 10923, 10923, 10923, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768},
+    // ko
+    {0, 0, 10922, 10922, 10922, 10922, 10922, 21845, 21845, 21845, 21845,
+     21845, 21845, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // kp
+    {4478, 4682, 4682, 4682, 11295, 11499, 11499, 13636, 15061, 15061, 15061,
+     18114, 18216, 18216, 22694, 24831, 24831, 30224, 30631, 30835, 32361,
+     32361, 32361, 32361, 32768, 32768},
+    // kq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // kr
+    {24576, 24576, 24576, 24576, 24576, 24576, 24576, 24576, 24576, 24576,
+     24576, 24576, 24576, 24576, 24576, 24576, 24576, 24576, 24576, 24576,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // ks
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // kt
+    {3075, 3075, 3363, 3363, 9753, 9753, 9753, 17202, 22247, 22247, 22247,
+     22631, 22823, 22823, 25129, 25129, 25129, 27531, 27915, 29453, 31087,
+     31087, 31279, 31279, 32768, 32768},
+    // ku
+    {0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768},
+    // kv
+    {2427, 2427, 2427, 2427, 21441, 21441, 21441, 21441, 29936, 29936, 29936,
+     29936, 29936, 29936, 32363, 32363, 32363, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // kw
+    {7284, 7284, 7284, 7284, 12563, 12563, 12563, 17114, 23121, 23121, 23121,
+     23485, 23485, 24941, 29856, 29856, 29856, 31676, 32040, 32404, 32404,
+     32404, 32404, 32404, 32768, 32768},
+    // kx
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // ky
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // kz
+    {12287, 12287, 12287, 12287, 23210, 23210, 23210, 25941, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 32768},
+    // l^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // la
+    {0, 745, 2234, 2234, 2234, 2234, 2234, 2234, 4468, 4468, 4468, 4468, 4468,
+     11917, 11917, 11917, 11917, 16385, 20853, 23087, 27555, 27555, 29789,
+     30534, 32768, 32768},
+    // lb
+    {0, 0, 0, 0, 16384, 16384, 16384, 16384, 16384, 16384, 16384, 16384, 16384,
+     16384, 16384, 16384, 16384, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // lc
+    {4054, 4054, 4720, 4720, 10829, 10829, 10829, 18272, 19883, 19883, 21438,
+     22549, 22549, 22549, 27159, 27159, 27215, 28048, 28159, 30991, 32324,
+     32324, 32324, 32324, 32768, 32768},
+    // ld
+    {0, 0, 0, 0, 21845, 21845, 21845, 21845, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // le
+    {5461, 5461, 6144, 6827, 8192, 9557, 11605, 12288, 12971, 13654, 13654,
+     13654, 15019, 17750, 18433, 18433, 18433, 24576, 26283, 27648, 27648,
+     28672, 29355, 30720, 32085, 32768},
+    // lf
+    {0, 0, 0, 0, 0, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // lg
+    {32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // lh
+    {6963, 6963, 6963, 6963, 15155, 15155, 15155, 15155, 19456, 19456, 19456,
+     20002, 20821, 21708, 26965, 26965, 26965, 28194, 28331, 30242, 32085,
+     32085, 32222, 32222, 32768, 32768},
+    // li
+    {4935, 4935, 7754, 7754, 11982, 11982, 13391, 13391, 13391, 14096, 15505,
+     15505, 15505, 17971, 20085, 21494, 21494, 21494, 25017, 29245, 29245,
+     30654, 30654, 31359, 31359, 32768},
+    // lj
+    {8445, 8445, 8445, 8445, 14526, 14526, 14526, 14526, 15202, 15202, 15202,
+     15202, 15202, 15202, 26687, 26687, 26687, 26687, 26687, 26687, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // lk
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // ll
+    {1285, 1285, 1285, 1285, 14135, 14135, 14135, 14135, 20560, 20560, 20560,
+     20560, 20560, 20560, 24415, 24415, 24415, 24415, 24415, 24415, 24415,
+     24415, 24415, 24415, 32768, 32768},
+    // lm
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // ln
+    {3358, 3358, 5446, 10257, 14115, 14206, 17973, 17973, 20605, 20877, 21512,
+     21784, 21920, 23599, 25142, 25142, 25142, 25324, 26413, 31315, 31678,
+     31860, 31860, 31860, 32586, 32768},
+    // lo
+    {0, 0, 1170, 1170, 1170, 1170, 2925, 2925, 2925, 2925, 2925, 2925, 4095,
+     6436, 9947, 12873, 12873, 18725, 23406, 25747, 26917, 28087, 31598, 31598,
+     32768, 32768},
+    // lp
+    {0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768},
+    // lq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // lr
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // ls
+    {0, 0, 0, 0, 8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768},
+    // lt
+    {0, 0, 0, 0, 6554, 6554, 6554, 19661, 19661, 19661, 19661, 19661, 19661,
+     19661, 19661, 19661, 19661, 19661, 19661, 19661, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // lu
+    {0, 0, 6554, 16383, 22937, 22937, 22937, 22937, 29491, 29491, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // lv
+    {0, 0, 0, 0, 23406, 23406, 23406, 23406, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // lw
+    {32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // lx
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // ly
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24576, 24576, 24576, 24576, 24576,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // lz
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // m^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // ma
+    {0, 0, 318, 1591, 1591, 1591, 3500, 3500, 6045, 6681, 7317, 8590, 8590,
+     19724, 19724, 19724, 19724, 27996, 28632, 30859, 30859, 30859, 30859,
+     31495, 32768, 32768},
+    // mb
+    {0, 0, 0, 0, 27307, 27307, 27307, 27307, 27307, 27307, 27307, 27307, 27307,
+     27307, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // mc
+    {4054, 4054, 4720, 4720, 10829, 10829, 10829, 18272, 19883, 19883, 21438,
+     22549, 22549, 22549, 27159, 27159, 27215, 28048, 28159, 30991, 32324,
+     32324, 32324, 32324, 32768, 32768},
+    // md
+    {3493, 3493, 3493, 4109, 15511, 15511, 15922, 15922, 21572, 21572, 21572,
+     21777, 22085, 22085, 24653, 24653, 24653, 27837, 27837, 28248, 30508,
+     30508, 30919, 30919, 32768, 32768},
+    // me
+    {1771, 1771, 1771, 5313, 7084, 7084, 7970, 7970, 8856, 8856, 8856, 10627,
+     13284, 20811, 21697, 21697, 21697, 27454, 30111, 31882, 31882, 31882,
+     31882, 31882, 32768, 32768},
+    // mf
+    {3081, 3081, 3081, 3081, 8962, 13863, 14143, 14143, 21286, 21286, 21286,
+     22126, 22686, 22686, 27447, 27447, 27447, 30248, 30248, 31088, 32488,
+     32488, 32488, 32488, 32768, 32768},
+    // mg
+    {4067, 4067, 4067, 4067, 13479, 13479, 13711, 17778, 20799, 20799, 20799,
+     22193, 22425, 23936, 26028, 26028, 26028, 29398, 29398, 29863, 32187,
+     32187, 32187, 32187, 32768, 32768},
+    // mh
+    {6963, 6963, 6963, 6963, 15155, 15155, 15155, 15155, 19456, 19456, 19456,
+     20002, 20821, 21708, 26965, 26965, 26965, 28194, 28331, 30242, 32085,
+     32085, 32222, 32222, 32768, 32768},
+    // mi
+    {1192, 1192, 5958, 9533, 9533, 9533, 11916, 11916, 11916, 11916, 11916,
+     20256, 20256, 25618, 25618, 25618, 25618, 26810, 28002, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // mj
+    {8445, 8445, 8445, 8445, 14526, 14526, 14526, 14526, 15202, 15202, 15202,
+     15202, 15202, 15202, 26687, 26687, 26687, 26687, 26687, 26687, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // mk
+    {4640, 4640, 4640, 4640, 17398, 17398, 17398, 17398, 22908, 22908, 22908,
+     25228, 25228, 26968, 28708, 28708, 28708, 31028, 31608, 31608, 32188,
+     32188, 32188, 32188, 32768, 32768},
+    // ml
+    {4634, 4823, 4823, 6525, 13522, 14420, 14515, 14515, 19054, 19054, 19338,
+     23925, 24114, 24114, 26951, 27140, 27140, 27235, 27613, 28370, 29316,
+     29647, 29742, 29742, 32484, 32768},
+    // mm
+    {5041, 5041, 5041, 5041, 22686, 22686, 22686, 22686, 22686, 22686, 22686,
+     22686, 22686, 22686, 27727, 27727, 27727, 27727, 27727, 27727, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // mn
+    {3358, 3358, 5446, 10257, 14115, 14206, 17973, 17973, 20605, 20877, 21512,
+     21784, 21920, 23599, 25142, 25142, 25142, 25324, 26413, 31315, 31678,
+     31860, 31860, 31860, 32586, 32768},
+    // mo
+    {0, 0, 575, 1725, 1725, 1725, 1725, 2875, 2875, 2875, 2875, 4025, 5175,
+     16670, 17820, 17820, 17820, 21269, 23569, 25869, 28169, 32768, 32768,
+     32768, 32768, 32768},
+    // mp
+    {10081, 12602, 12602, 12602, 12602, 12602, 12602, 12602, 12602, 12602,
+     12602, 22684, 22684, 22684, 25205, 25205, 25205, 27726, 30247, 30247,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // mq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // mr
+    {3877, 3946, 4426, 5593, 13485, 13588, 14514, 14583, 18769, 18769, 19249,
+     20107, 20896, 21651, 25734, 25734, 25734, 26626, 27415, 29577, 30400,
+     30606, 30675, 30675, 32699, 32768},
+    // ms
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // mt
+    {3075, 3075, 3363, 3363, 9753, 9753, 9753, 17202, 22247, 22247, 22247,
+     22631, 22823, 22823, 25129, 25129, 25129, 27531, 27915, 29453, 31087,
+     31087, 31279, 31279, 32768, 32768},
+    // mu
+    {0, 0, 5461, 5461, 10922, 10922, 10922, 10922, 10922, 10922, 10922, 16383,
+     16383, 21844, 21844, 21844, 21844, 21844, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // mv
+    {2427, 2427, 2427, 2427, 21441, 21441, 21441, 21441, 29936, 29936, 29936,
+     29936, 29936, 29936, 32363, 32363, 32363, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // mw
+    {7284, 7284, 7284, 7284, 12563, 12563, 12563, 17114, 23121, 23121, 23121,
+     23485, 23485, 24941, 29856, 29856, 29856, 31676, 32040, 32404, 32404,
+     32404, 32404, 32404, 32768, 32768},
+    // mx
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // my
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // mz
+    {12287, 12287, 12287, 12287, 23210, 23210, 23210, 25941, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 32768},
+    // n^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // na
+    {0, 0, 0, 0, 0, 0, 2825, 3955, 3955, 3955, 5085, 14124, 15254, 19774,
+     19774, 19774, 19774, 20904, 22034, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768},
+    // nb
+    {4228, 4492, 4492, 4492, 15723, 15723, 15723, 15723, 18366, 18630, 18630,
+     22065, 22065, 22065, 25765, 25765, 25765, 29993, 29993, 29993, 31843,
+     32107, 32107, 32107, 32768, 32768},
+    // nc
+    {0, 0, 0, 0, 21371, 21371, 21371, 24220, 25645, 25645, 25645, 28494, 28494,
+     28494, 28494, 28494, 28494, 29919, 29919, 29919, 29919, 29919, 29919,
+     29919, 32768, 32768},
+    // nd
+    {4766, 4766, 4766, 4766, 13703, 13703, 13703, 13703, 17873, 17873, 17873,
+     17873, 17873, 17873, 20256, 20256, 20256, 28001, 28001, 29193, 30385,
+     30385, 30385, 30385, 32768, 32768},
+    // ne
+    {2621, 2621, 3932, 3932, 5243, 6554, 6554, 6554, 7865, 7865, 7865, 9176,
+     9176, 9176, 9176, 9176, 9176, 14418, 17039, 22282, 23593, 24904, 27525,
+     28836, 31457, 32768},
+    // nf
+    {0, 0, 0, 0, 16384, 16384, 16384, 16384, 16384, 16384, 16384, 16384, 16384,
+     16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // ng
+    {0, 0, 0, 0, 23831, 23831, 23831, 23831, 23831, 23831, 23831, 26810, 26810,
+     26810, 26810, 26810, 26810, 26810, 26810, 26810, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // nh
+    {6963, 6963, 6963, 6963, 15155, 15155, 15155, 15155, 19456, 19456, 19456,
+     20002, 20821, 21708, 26965, 26965, 26965, 28194, 28331, 30242, 32085,
+     32085, 32222, 32222, 32768, 32768},
+    // ni
+    {1170, 1170, 7023, 7023, 10534, 12289, 16970, 16970, 16970, 16970, 18140,
+     18140, 19310, 22821, 23991, 23991, 23991, 23991, 28087, 31013, 31013,
+     31013, 31013, 31013, 31013, 32768},
+    // nj
+    {10922, 10922, 10922, 10922, 10922, 10922, 10922, 10922, 21845, 21845,
+     21845, 21845, 21845, 21845, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // nk
+    {0, 0, 0, 0, 21845, 21845, 21845, 21845, 21845, 21845, 21845, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // nl
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     32768, 32768},
+    // nm
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // nn
+    {12288, 12288, 12288, 12288, 16384, 16384, 16384, 16384, 28672, 28672,
+     28672, 28672, 28672, 28672, 28672, 28672, 28672, 28672, 28672, 28672,
+     28672, 28672, 28672, 28672, 32768, 32768},
+    // no
+    {2427, 2427, 2427, 2427, 2427, 2427, 2427, 2427, 2427, 2427, 2427, 6068,
+     10923, 10923, 10923, 10923, 10923, 13350, 13350, 23059, 25486, 25486,
+     32768, 32768, 32768, 32768},
+    // np
+    {4478, 4682, 4682, 4682, 11295, 11499, 11499, 13636, 15061, 15061, 15061,
+     18114, 18216, 18216, 22694, 24831, 24831, 30224, 30631, 30835, 32361,
+     32361, 32361, 32361, 32768, 32768},
+    // nq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // nr
+    {0, 0, 0, 0, 0, 0, 0, 0, 16384, 16384, 16384, 16384, 16384, 16384, 16384,
+     16384, 16384, 16384, 16384, 16384, 16384, 16384, 16384, 16384, 32768,
+     32768},
+    // ns
+    {0, 0, 0, 0, 8937, 8937, 8937, 10426, 16384, 16384, 16384, 16384, 16384,
+     16384, 22342, 22342, 22342, 22342, 22342, 29789, 29789, 29789, 32768,
+     32768, 32768, 32768},
+    // nt
+    {3888, 3888, 3888, 3888, 10553, 10553, 10553, 16107, 23882, 23882, 23882,
+     24993, 24993, 24993, 28325, 28325, 28325, 31657, 31657, 31657, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // nu
+    {0, 0, 0, 0, 16384, 16384, 16384, 16384, 16384, 16384, 16384, 16384, 24576,
+     24576, 24576, 24576, 24576, 24576, 24576, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // nv
+    {0, 0, 0, 0, 0, 0, 0, 0, 16384, 16384, 16384, 16384, 16384, 16384, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768},
+    // nw
+    {7284, 7284, 7284, 7284, 12563, 12563, 12563, 17114, 23121, 23121, 23121,
+     23485, 23485, 24941, 29856, 29856, 29856, 31676, 32040, 32404, 32404,
+     32404, 32404, 32404, 32768, 32768},
+    // nx
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // ny
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16384, 16384, 16384, 16384,
+     16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // nz
+    {32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // o^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // oa
+    {0, 0, 5463, 10924, 10924, 10924, 10924, 16385, 16385, 16385, 16385, 21846,
+     21846, 27307, 27307, 27307, 27307, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // ob
+    {5461, 10922, 10922, 10922, 21846, 21846, 21846, 21846, 27307, 27307,
+     27307, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // oc
+    {2849, 2849, 5698, 5698, 11398, 11398, 11398, 14247, 19946, 19946, 25645,
+     25645, 25645, 25645, 25645, 25645, 25645, 27070, 27070, 29919, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // od
+    {3855, 3855, 3855, 3855, 11565, 11565, 11565, 11565, 11565, 11565, 11565,
+     11565, 11565, 11565, 11565, 11565, 11565, 15420, 15420, 15420, 25058,
+     25058, 25058, 25058, 32768, 32768},
+    // oe
+    {3233, 3510, 5219, 6004, 7274, 7690, 8198, 8337, 9215, 9261, 9353, 11962,
+     12863, 17043, 17274, 17782, 17828, 26050, 28382, 29906, 29998, 31083,
+     31452, 31937, 32399, 32768},
+    // of
+    {0, 0, 0, 0, 2979, 23831, 23831, 23831, 26810, 26810, 26810, 26810, 29789,
+     29789, 29789, 29789, 29789, 29789, 29789, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // og
+    {4369, 4369, 4369, 4369, 17476, 17476, 17476, 17476, 17476, 17476, 17476,
+     17476, 17476, 21845, 21845, 21845, 21845, 26214, 26214, 30583, 30583,
+     30583, 30583, 30583, 32768, 32768},
+    // oh
+    {4681, 4681, 4681, 4681, 4681, 4681, 4681, 4681, 4681, 4681, 4681, 14043,
+     18724, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // oi
+    {0, 0, 8192, 12288, 12288, 12288, 16384, 16384, 16384, 16384, 16384, 20480,
+     20480, 28672, 28672, 28672, 28672, 28672, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // oj
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // ok
+    {0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768},
+    // ol
+    {2260, 2260, 2260, 9038, 12428, 16383, 17513, 17513, 23163, 23163, 23163,
+     26553, 26553, 26553, 29378, 29378, 29378, 29378, 29378, 29378, 29378,
+     30508, 30508, 30508, 31638, 32768},
+    // om
+    {3277, 4915, 4915, 4915, 18023, 18023, 18023, 18023, 19661, 19661, 19661,
+     19661, 24576, 24576, 24576, 31130, 31130, 31130, 31130, 31130, 31130,
+     31130, 31130, 31130, 32768, 32768},
+    // on
+    {4411, 4411, 5671, 10082, 15125, 15440, 19221, 19221, 21742, 21742, 22372,
+     23002, 23632, 24262, 25522, 25522, 25522, 25522, 27097, 31508, 31508,
+     31508, 31508, 31508, 32138, 32768},
+    // oo
+    {0, 0, 0, 6144, 6144, 6144, 6144, 6144, 6144, 6144, 12288, 14336, 16384,
+     18432, 18432, 18432, 18432, 26624, 28672, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // op
+    {0, 0, 0, 0, 14896, 14896, 14896, 22343, 22343, 22343, 22343, 25322, 26811,
+     26811, 26811, 28300, 28300, 28300, 28300, 28300, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // oq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // or
+    {1237, 1237, 1855, 5565, 10511, 10511, 12057, 12057, 14530, 14530, 16385,
+     17003, 20094, 21331, 21949, 21949, 21949, 23186, 23804, 29059, 29059,
+     29059, 29677, 29677, 32768, 32768},
+    // os
+    {0, 0, 0, 0, 11469, 11469, 11469, 13107, 16384, 16384, 16384, 16384, 16384,
+     16384, 16384, 18022, 18022, 18022, 26214, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // ot
+    {0, 0, 0, 0, 4369, 4369, 4369, 26214, 26214, 26214, 26214, 26214, 26214,
+     26214, 26214, 26214, 26214, 26214, 26214, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // ou
+    {0, 809, 809, 809, 809, 809, 4450, 4450, 5259, 5259, 5259, 8495, 8495,
+     14563, 14563, 16181, 16181, 23464, 27509, 31959, 31959, 31959, 31959,
+     32768, 32768, 32768},
+    // ov
+    {2427, 2427, 2427, 2427, 27913, 27913, 27913, 27913, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // ow
+    {3641, 3641, 3641, 3641, 10923, 10923, 10923, 10923, 10923, 10923, 10923,
+     14564, 14564, 29127, 29127, 29127, 29127, 29127, 29127, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // ox
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // oy
+    {0, 0, 16384, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // oz
+    {12287, 12287, 12287, 12287, 23210, 23210, 23210, 25941, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 32768},
+    // p^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // pa
+    {0, 1489, 4468, 4468, 4468, 4468, 5957, 5957, 8936, 8936, 8936, 8936,
+     10425, 11914, 11914, 13403, 13403, 22343, 25322, 29790, 31279, 31279,
+     31279, 31279, 32768, 32768},
+    // pb
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // pc
+    {4054, 4054, 4720, 4720, 10829, 10829, 10829, 18272, 19883, 19883, 21438,
+     22549, 22549, 22549, 27159, 27159, 27215, 28048, 28159, 30991, 32324,
+     32324, 32324, 32324, 32768, 32768},
+    // pd
+    {3493, 3493, 3493, 4109, 15511, 15511, 15922, 15922, 21572, 21572, 21572,
+     21777, 22085, 22085, 24653, 24653, 24653, 27837, 27837, 28248, 30508,
+     30508, 30919, 30919, 32768, 32768},
+    // pe
+    {3449, 3449, 7473, 8623, 8623, 8623, 8623, 8623, 8623, 8623, 8623, 8623,
+     8623, 12072, 13222, 13222, 13222, 27019, 27019, 31618, 31618, 31618,
+     31618, 31618, 31618, 32768},
+    // pf
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // pg
+    {4067, 4067, 4067, 4067, 13479, 13479, 13711, 17778, 20799, 20799, 20799,
+     22193, 22425, 23936, 26028, 26028, 26028, 29398, 29398, 29863, 32187,
+     32187, 32187, 32187, 32768, 32768},
+    // ph
+    {3855, 3855, 3855, 3855, 9638, 9638, 9638, 9638, 25058, 25058, 25058,
+     25058, 25058, 25058, 28913, 28913, 28913, 28913, 28913, 28913, 28913,
+     28913, 28913, 28913, 32768, 32768},
+    // pi
+    {0, 0, 9363, 9363, 18725, 18725, 18725, 18725, 18725, 18725, 18725, 18725,
+     18725, 18725, 18725, 18725, 18725, 18725, 18725, 28087, 28087, 28087,
+     28087, 28087, 28087, 32768},
+    // pj
+    {8445, 8445, 8445, 8445, 14526, 14526, 14526, 14526, 15202, 15202, 15202,
+     15202, 15202, 15202, 26687, 26687, 26687, 26687, 26687, 26687, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // pk
+    {4640, 4640, 4640, 4640, 17398, 17398, 17398, 17398, 22908, 22908, 22908,
+     25228, 25228, 26968, 28708, 28708, 28708, 31028, 31608, 31608, 32188,
+     32188, 32188, 32188, 32768, 32768},
+    // pl
+    {15291, 15291, 15291, 15291, 26214, 26214, 26214, 26214, 26214, 26214,
+     26214, 26214, 26214, 26214, 28399, 28399, 28399, 28399, 28399, 28399,
+     28399, 28399, 28399, 28399, 32768, 32768},
+    // pm
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // pn
+    {3358, 3358, 5446, 10257, 14115, 14206, 17973, 17973, 20605, 20877, 21512,
+     21784, 21920, 23599, 25142, 25142, 25142, 25324, 26413, 31315, 31678,
+     31860, 31860, 31860, 32586, 32768},
+    // po
+    {0, 0, 0, 0, 0, 0, 0, 1489, 2978, 2978, 2978, 8936, 8936, 16385, 17874,
+     20108, 20108, 26811, 31279, 31279, 31279, 31279, 32768, 32768, 32768,
+     32768},
+    // pp
+    {0, 0, 0, 0, 12482, 12482, 12482, 12482, 12482, 12482, 12482, 18724, 18724,
+     18724, 23405, 23405, 23405, 26526, 26526, 26526, 26526, 26526, 26526,
+     26526, 32768, 32768},
+    // pq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // pr
+    {1237, 1237, 1237, 1237, 8656, 8656, 8656, 8656, 14839, 14839, 14839,
+     14839, 14839, 14839, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // ps
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // pt
+    {3075, 3075, 3363, 3363, 9753, 9753, 9753, 17202, 22247, 22247, 22247,
+     22631, 22823, 22823, 25129, 25129, 25129, 27531, 27915, 29453, 31087,
+     31087, 31279, 31279, 32768, 32768},
+    // pu
+    {0, 4369, 4369, 4369, 4369, 4369, 4369, 4369, 4369, 4369, 4369, 15292,
+     15292, 15292, 15292, 19661, 19661, 19661, 24030, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // pv
+    {2427, 2427, 2427, 2427, 21441, 21441, 21441, 21441, 29936, 29936, 29936,
+     29936, 29936, 29936, 32363, 32363, 32363, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // pw
+    {7284, 7284, 7284, 7284, 12563, 12563, 12563, 17114, 23121, 23121, 23121,
+     23485, 23485, 24941, 29856, 29856, 29856, 31676, 32040, 32404, 32404,
+     32404, 32404, 32404, 32768, 32768},
+    // px
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // py
+    {1365, 2730, 3413, 3413, 10922, 10922, 10922, 10922, 10922, 10922, 10922,
+     16383, 17066, 21162, 26282, 26965, 26965, 26965, 31061, 32085, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // pz
+    {12287, 12287, 12287, 12287, 23210, 23210, 23210, 25941, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 32768},
+    // q^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // qa
+    {103, 930, 2636, 3773, 3876, 4186, 5194, 5607, 7002, 7054, 7416, 11447,
+     13049, 19408, 19408, 19873, 19873, 25145, 26876, 29822, 30959, 31476,
+     31734, 31889, 32768, 32768},
+    // qb
+    {4228, 4492, 4492, 4492, 15723, 15723, 15723, 15723, 18366, 18630, 18630,
+     22065, 22065, 22065, 25765, 25765, 25765, 29993, 29993, 29993, 31843,
+     32107, 32107, 32107, 32768, 32768},
+    // qc
+    {4054, 4054, 4720, 4720, 10829, 10829, 10829, 18272, 19883, 19883, 21438,
+     22549, 22549, 22549, 27159, 27159, 27215, 28048, 28159, 30991, 32324,
+     32324, 32324, 32324, 32768, 32768},
+    // qd
+    {3493, 3493, 3493, 4109, 15511, 15511, 15922, 15922, 21572, 21572, 21572,
+     21777, 22085, 22085, 24653, 24653, 24653, 27837, 27837, 28248, 30508,
+     30508, 30919, 30919, 32768, 32768},
+    // qe
+    {3233, 3510, 5219, 6004, 7274, 7690, 8198, 8337, 9215, 9261, 9353, 11962,
+     12863, 17043, 17274, 17782, 17828, 26050, 28382, 29906, 29998, 31083,
+     31452, 31937, 32399, 32768},
+    // qf
+    {3081, 3081, 3081, 3081, 8962, 13863, 14143, 14143, 21286, 21286, 21286,
+     22126, 22686, 22686, 27447, 27447, 27447, 30248, 30248, 31088, 32488,
+     32488, 32488, 32488, 32768, 32768},
+    // qg
+    {4067, 4067, 4067, 4067, 13479, 13479, 13711, 17778, 20799, 20799, 20799,
+     22193, 22425, 23936, 26028, 26028, 26028, 29398, 29398, 29863, 32187,
+     32187, 32187, 32187, 32768, 32768},
+    // qh
+    {6963, 6963, 6963, 6963, 15155, 15155, 15155, 15155, 19456, 19456, 19456,
+     20002, 20821, 21708, 26965, 26965, 26965, 28194, 28331, 30242, 32085,
+     32085, 32222, 32222, 32768, 32768},
+    // qi
+    {2354, 2548, 5773, 7224, 9449, 10062, 11771, 11771, 11771, 11836, 12094,
+     14352, 15610, 21737, 23995, 24221, 24221, 25382, 28285, 31284, 31413,
+     32284, 32284, 32413, 32413, 32768},
+    // qj
+    {8445, 8445, 8445, 8445, 14526, 14526, 14526, 14526, 15202, 15202, 15202,
+     15202, 15202, 15202, 26687, 26687, 26687, 26687, 26687, 26687, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // qk
+    {4640, 4640, 4640, 4640, 17398, 17398, 17398, 17398, 22908, 22908, 22908,
+     25228, 25228, 26968, 28708, 28708, 28708, 31028, 31608, 31608, 32188,
+     32188, 32188, 32188, 32768, 32768},
+    // ql
+    {4634, 4823, 4823, 6525, 13522, 14420, 14515, 14515, 19054, 19054, 19338,
+     23925, 24114, 24114, 26951, 27140, 27140, 27235, 27613, 28370, 29316,
+     29647, 29742, 29742, 32484, 32768},
+    // qm
+    {8920, 9921, 9921, 9921, 17675, 17675, 17675, 17675, 22261, 22261, 22261,
+     22261, 23345, 23512, 28265, 30433, 30433, 30433, 31017, 31017, 32018,
+     32018, 32018, 32018, 32768, 32768},
+    // qn
+    {3358, 3358, 5446, 10257, 14115, 14206, 17973, 17973, 20605, 20877, 21512,
+     21784, 21920, 23599, 25142, 25142, 25142, 25324, 26413, 31315, 31678,
+     31860, 31860, 31860, 32586, 32768},
+    // qo
+    {434, 1012, 1843, 2746, 2818, 3649, 4263, 4805, 5383, 5455, 5708, 8020,
+     9610, 16764, 17992, 19076, 19076, 23881, 25398, 26843, 29842, 30817,
+     32262, 32334, 32768, 32768},
+    // qp
+    {4478, 4682, 4682, 4682, 11295, 11499, 11499, 13636, 15061, 15061, 15061,
+     18114, 18216, 18216, 22694, 24831, 24831, 30224, 30631, 30835, 32361,
+     32361, 32361, 32361, 32768, 32768},
+    // qq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // qr
+    {3877, 3946, 4426, 5593, 13485, 13588, 14514, 14583, 18769, 18769, 19249,
+     20107, 20896, 21651, 25734, 25734, 25734, 26626, 27415, 29577, 30400,
+     30606, 30675, 30675, 32699, 32768},
+    // qs
+    {2178, 2275, 4550, 4550, 11084, 11084, 11084, 12972, 16070, 16070, 16360,
+     16457, 16651, 16748, 20088, 21298, 21298, 21298, 23960, 30735, 32284,
+     32284, 32478, 32478, 32768, 32768},
+    // qt
+    {3075, 3075, 3363, 3363, 9753, 9753, 9753, 17202, 22247, 22247, 22247,
+     22631, 22823, 22823, 25129, 25129, 25129, 27531, 27915, 29453, 31087,
+     31087, 31279, 31279, 32768, 32768},
+    // qu
+    {5041, 5041, 5041, 5041, 17644, 17644, 17644, 17644, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // qv
+    {2427, 2427, 2427, 2427, 21441, 21441, 21441, 21441, 29936, 29936, 29936,
+     29936, 29936, 29936, 32363, 32363, 32363, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // qw
+    {7284, 7284, 7284, 7284, 12563, 12563, 12563, 17114, 23121, 23121, 23121,
+     23485, 23485, 24941, 29856, 29856, 29856, 31676, 32040, 32404, 32404,
+     32404, 32404, 32404, 32768, 32768},
+    // qx
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // qy
+    {1365, 2730, 3413, 3413, 10922, 10922, 10922, 10922, 10922, 10922, 10922,
+     16383, 17066, 21162, 26282, 26965, 26965, 26965, 31061, 32085, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // qz
+    {12287, 12287, 12287, 12287, 23210, 23210, 23210, 25941, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 32768},
+    // r^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // ra
+    {0, 0, 3449, 5174, 5174, 6554, 7244, 8624, 10004, 10004, 10004, 15523,
+     17593, 25179, 25179, 25179, 25179, 25869, 25869, 29318, 31388, 31388,
+     32078, 32078, 32768, 32768},
+    // rb
+    {32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // rc
+    {0, 0, 0, 0, 14044, 14044, 14044, 23406, 28087, 28087, 28087, 28087, 28087,
+     28087, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // rd
+    {8192, 8192, 8192, 8192, 24576, 24576, 24576, 24576, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // re
+    {6995, 7363, 10677, 11782, 14912, 14912, 15648, 15648, 16384, 16384, 16384,
+     16936, 18409, 22091, 22091, 23196, 23564, 23564, 29455, 30928, 30928,
+     31296, 31664, 31664, 32032, 32768},
+    // rf
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // rg
+    {3641, 3641, 3641, 3641, 20632, 20632, 20632, 20632, 25487, 25487, 25487,
+     25487, 27914, 27914, 27914, 27914, 27914, 27914, 27914, 27914, 30341,
+     30341, 30341, 30341, 32768, 32768},
+    // rh
+    {32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // ri
+    {3332, 3887, 9998, 9998, 13053, 13053, 14719, 14719, 14719, 14719, 14719,
+     15274, 15829, 20272, 22494, 23049, 23049, 23049, 27214, 29991, 29991,
+     32768, 32768, 32768, 32768, 32768},
+    // rj
+    {8445, 8445, 8445, 8445, 14526, 14526, 14526, 14526, 15202, 15202, 15202,
+     15202, 15202, 15202, 26687, 26687, 26687, 26687, 26687, 26687, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // rk
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // rl
+    {0, 0, 0, 3121, 9363, 9363, 9363, 9363, 9363, 9363, 9363, 9363, 9363, 9363,
+     15605, 15605, 15605, 15605, 15605, 15605, 15605, 15605, 15605, 15605,
+     32768, 32768},
+    // rm
+    {14894, 14894, 14894, 14894, 26810, 26810, 26810, 26810, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // rn
+    {13654, 13654, 13654, 13654, 19115, 19115, 19115, 19115, 24576, 24576,
+     24576, 24576, 27307, 27307, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // ro
+    {1170, 4096, 5266, 7899, 7899, 8484, 9654, 9654, 9654, 10239, 10239, 13165,
+     14335, 17847, 18432, 19602, 19602, 19602, 21943, 24284, 27502, 29257,
+     31598, 31598, 32768, 32768},
+    // rp
+    {4478, 4682, 4682, 4682, 11295, 11499, 11499, 13636, 15061, 15061, 15061,
+     18114, 18216, 18216, 22694, 24831, 24831, 30224, 30631, 30835, 32361,
+     32361, 32361, 32361, 32768, 32768},
+    // rq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // rr
+    {2521, 2521, 2521, 2521, 10083, 10083, 10083, 10083, 15124, 15124, 15124,
+     15124, 17645, 17645, 17645, 17645, 17645, 17645, 17645, 17645, 17645,
+     17645, 17645, 17645, 32768, 32768},
+    // rs
+    {0, 0, 0, 0, 13797, 13797, 13797, 13797, 13797, 13797, 13797, 13797, 13797,
+     13797, 24145, 24145, 24145, 24145, 24145, 29319, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // rt
+    {5958, 5958, 5958, 5958, 7944, 7944, 7944, 13902, 23831, 23831, 23831,
+     23831, 25817, 25817, 25817, 25817, 25817, 25817, 27803, 27803, 28796,
+     28796, 28796, 28796, 32768, 32768},
+    // ru
+    {0, 0, 5462, 5462, 8193, 8193, 13654, 13654, 13654, 13654, 13654, 16385,
+     16385, 21846, 21846, 21846, 21846, 21846, 27307, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // rv
+    {0, 0, 0, 0, 10923, 10923, 10923, 10923, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // rw
+    {32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // rx
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // ry
+    {8738, 13107, 13107, 13107, 13107, 13107, 13107, 13107, 13107, 13107,
+     13107, 17476, 17476, 21845, 26214, 26214, 26214, 26214, 30583, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // rz
+    {12287, 12287, 12287, 12287, 23210, 23210, 23210, 25941, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 32768},
+    // s^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // sa
+    {0, 5314, 5314, 5314, 5314, 5314, 7085, 7085, 8856, 8856, 8856, 8856,
+     14170, 22141, 22141, 22141, 22141, 27455, 27455, 27455, 29226, 30997,
+     30997, 30997, 32768, 32768},
+    // sb
+    {32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // sc
+    {1394, 1394, 1394, 1394, 2788, 2788, 2788, 24403, 25797, 25797, 25797,
+     25797, 25797, 25797, 29980, 29980, 29980, 31374, 31374, 31374, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // sd
+    {3493, 3493, 3493, 4109, 15511, 15511, 15922, 15922, 21572, 21572, 21572,
+     21777, 22085, 22085, 24653, 24653, 24653, 27837, 27837, 28248, 30508,
+     30508, 30919, 30919, 32768, 32768},
+    // se
+    {4855, 5664, 8900, 8900, 11327, 11327, 11327, 11327, 12136, 12136, 12136,
+     18204, 18204, 21440, 21440, 23058, 23058, 29532, 29532, 30341, 30341,
+     31959, 31959, 32768, 32768, 32768},
+    // sf
+    {3081, 3081, 3081, 3081, 8962, 13863, 14143, 14143, 21286, 21286, 21286,
+     22126, 22686, 22686, 27447, 27447, 27447, 30248, 30248, 31088, 32488,
+     32488, 32488, 32488, 32768, 32768},
+    // sg
+    {4067, 4067, 4067, 4067, 13479, 13479, 13711, 17778, 20799, 20799, 20799,
+     22193, 22425, 23936, 26028, 26028, 26028, 29398, 29398, 29863, 32187,
+     32187, 32187, 32187, 32768, 32768},
+    // sh
+    {10571, 10571, 10571, 10571, 12685, 12685, 12685, 12685, 17970, 17970,
+     17970, 20084, 20084, 20084, 30654, 30654, 30654, 30654, 30654, 30654,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // si
+    {0, 1057, 4228, 9513, 9513, 9513, 12156, 12156, 12156, 12156, 12156, 13213,
+     17441, 20612, 22198, 22198, 22198, 22198, 24312, 30654, 30654, 30654,
+     30654, 31711, 31711, 32768},
+    // sj
+    {8445, 8445, 8445, 8445, 14526, 14526, 14526, 14526, 15202, 15202, 15202,
+     15202, 15202, 15202, 26687, 26687, 26687, 26687, 26687, 26687, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // sk
+    {0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768},
+    // sl
+    {32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // sm
+    {16384, 16384, 16384, 16384, 16384, 16384, 16384, 16384, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // sn
+    {32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // so
+    {0, 0, 2048, 2048, 2048, 3072, 3072, 3072, 3072, 3072, 3072, 3072, 8192,
+     23552, 24576, 26624, 26624, 28672, 28672, 28672, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // sp
+    {2621, 2621, 2621, 2621, 14418, 14418, 14418, 14418, 19661, 19661, 19661,
+     19661, 19661, 19661, 30147, 30147, 30147, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // sq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // sr
+    {3877, 3946, 4426, 5593, 13485, 13588, 14514, 14583, 18769, 18769, 19249,
+     20107, 20896, 21651, 25734, 25734, 25734, 26626, 27415, 29577, 30400,
+     30606, 30675, 30675, 32699, 32768},
+    // ss
+    {9175, 9175, 9175, 9175, 14418, 14418, 14418, 14418, 22282, 22282, 22282,
+     22282, 22282, 22282, 27525, 27525, 27525, 27525, 27525, 27525, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // st
+    {8359, 8359, 8359, 8359, 15715, 15715, 15715, 15715, 21399, 21399, 21399,
+     22068, 22068, 22068, 26415, 26415, 26415, 30093, 30093, 30093, 32099,
+     32099, 32099, 32099, 32768, 32768},
+    // su
+    {2048, 4096, 8192, 10240, 12288, 12288, 16384, 16384, 16384, 16384, 16384,
+     20480, 22528, 22528, 22528, 24576, 24576, 30720, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // sv
+    {2427, 2427, 2427, 2427, 21441, 21441, 21441, 21441, 29936, 29936, 29936,
+     29936, 29936, 29936, 32363, 32363, 32363, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // sw
+    {0, 0, 0, 0, 16384, 16384, 16384, 16384, 16384, 16384, 16384, 16384, 16384,
+     16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // sx
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // sy
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16384, 16384, 16384, 16384, 16384, 16384,
+     16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // sz
+    {12287, 12287, 12287, 12287, 23210, 23210, 23210, 25941, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 32768},
+    // t^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // ta
+    {0, 2114, 3171, 3171, 3171, 4228, 5285, 5285, 10570, 10570, 11627, 16384,
+     16384, 21141, 21141, 21141, 21141, 24312, 25369, 29597, 29597, 29597,
+     29597, 30654, 32768, 32768},
+    // tb
+    {4228, 4492, 4492, 4492, 15723, 15723, 15723, 15723, 18366, 18630, 18630,
+     22065, 22065, 22065, 25765, 25765, 25765, 29993, 29993, 29993, 31843,
+     32107, 32107, 32107, 32768, 32768},
+    // tc
+    {0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768},
+    // td
+    {3493, 3493, 3493, 4109, 15511, 15511, 15922, 15922, 21572, 21572, 21572,
+     21777, 22085, 22085, 24653, 24653, 24653, 27837, 27837, 28248, 30508,
+     30508, 30919, 30919, 32768, 32768},
+    // te
+    {2570, 2570, 3534, 3534, 3534, 4177, 4820, 4820, 5463, 5463, 5463, 5784,
+     7069, 10282, 10282, 12210, 12210, 30840, 31483, 31483, 31483, 32768,
+     32768, 32768, 32768, 32768},
+    // tf
+    {3081, 3081, 3081, 3081, 8962, 13863, 14143, 14143, 21286, 21286, 21286,
+     22126, 22686, 22686, 27447, 27447, 27447, 30248, 30248, 31088, 32488,
+     32488, 32488, 32488, 32768, 32768},
+    // tg
+    {4067, 4067, 4067, 4067, 13479, 13479, 13711, 17778, 20799, 20799, 20799,
+     22193, 22425, 23936, 26028, 26028, 26028, 29398, 29398, 29863, 32187,
+     32187, 32187, 32187, 32768, 32768},
+    // th
+    {4795, 4795, 4795, 4795, 17849, 17849, 17849, 17849, 22911, 22911, 22911,
+     23444, 23444, 23444, 28239, 28239, 28239, 30104, 30104, 30104, 31702,
+     31702, 31702, 31702, 32768, 32768},
+    // ti
+    {1909, 1909, 5408, 5408, 6044, 7317, 7953, 7953, 7953, 7953, 7953, 9226,
+     11771, 16861, 29269, 29269, 29269, 29905, 30541, 31495, 31495, 32768,
+     32768, 32768, 32768, 32768},
+    // tj
+    {8445, 8445, 8445, 8445, 14526, 14526, 14526, 14526, 15202, 15202, 15202,
+     15202, 15202, 15202, 26687, 26687, 26687, 26687, 26687, 26687, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // tk
+    {4640, 4640, 4640, 4640, 17398, 17398, 17398, 17398, 22908, 22908, 22908,
+     25228, 25228, 26968, 28708, 28708, 28708, 31028, 31608, 31608, 32188,
+     32188, 32188, 32188, 32768, 32768},
+    // tl
+    {0, 0, 0, 0, 16384, 16384, 16384, 16384, 16384, 16384, 16384, 16384, 16384,
+     16384, 16384, 16384, 16384, 16384, 16384, 16384, 16384, 16384, 16384,
+     16384, 32768, 32768},
+    // tm
+    {16384, 16384, 16384, 16384, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // tn
+    {3358, 3358, 5446, 10257, 14115, 14206, 17973, 17973, 20605, 20877, 21512,
+     21784, 21920, 23599, 25142, 25142, 25142, 25324, 26413, 31315, 31678,
+     31860, 31860, 31860, 32586, 32768},
+    // to
+    {0, 0, 1680, 3360, 3360, 3360, 5040, 5040, 5040, 5040, 5040, 5040, 5040,
+     8401, 10081, 14282, 14282, 29407, 29407, 29407, 29407, 29407, 32768,
+     32768, 32768, 32768},
+    // tp
+    {4478, 4682, 4682, 4682, 11295, 11499, 11499, 13636, 15061, 15061, 15061,
+     18114, 18216, 18216, 22694, 24831, 24831, 30224, 30631, 30835, 32361,
+     32361, 32361, 32361, 32768, 32768},
+    // tq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // tr
+    {7865, 7865, 7865, 7865, 13108, 13108, 13108, 13108, 20972, 20972, 20972,
+     20972, 20972, 20972, 24904, 24904, 24904, 24904, 24904, 24904, 28836,
+     28836, 28836, 28836, 32768, 32768},
+    // ts
+    {0, 0, 0, 0, 16384, 16384, 16384, 16384, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // tt
+    {4681, 4681, 4681, 4681, 21064, 21064, 21064, 23405, 23405, 23405, 23405,
+     25746, 25746, 25746, 28087, 28087, 28087, 28087, 28087, 28087, 28087,
+     28087, 28087, 28087, 32768, 32768},
+    // tu
+    {3855, 3855, 3855, 7710, 7710, 9638, 9638, 9638, 9638, 9638, 9638, 9638,
+     11566, 12530, 12530, 12530, 12530, 31804, 31804, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // tv
+    {2427, 2427, 2427, 2427, 21441, 21441, 21441, 21441, 29936, 29936, 29936,
+     29936, 29936, 29936, 32363, 32363, 32363, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // tw
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // tx
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // ty
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21845, 21845, 21845, 21845, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // tz
+    {12287, 12287, 12287, 12287, 23210, 23210, 23210, 25941, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 32768},
+    // u^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // ua
+    {0, 0, 0, 0, 0, 0, 5041, 5041, 5041, 5041, 5041, 22686, 22686, 27727,
+     27727, 27727, 27727, 27727, 27727, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768},
+    // ub
+    {0, 0, 0, 0, 6554, 6554, 6554, 6554, 6554, 13108, 13108, 26214, 26214,
+     26214, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // uc
+    {5243, 5243, 7864, 7864, 15729, 15729, 15729, 23593, 26214, 26214, 26214,
+     26214, 26214, 26214, 26214, 26214, 26214, 26214, 26214, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // ud
+    {0, 0, 0, 3641, 10923, 10923, 10923, 10923, 21845, 21845, 21845, 21845,
+     21845, 21845, 21845, 21845, 21845, 21845, 21845, 21845, 21845, 21845,
+     25486, 25486, 32768, 32768},
+    // ue
+    {0, 0, 0, 0, 3449, 3449, 3449, 3449, 3449, 3449, 3449, 15521, 15521, 15521,
+     15521, 15521, 15521, 22420, 29319, 29319, 29319, 29319, 29319, 29319,
+     29319, 32768},
+    // uf
+    {0, 0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // ug
+    {2849, 2849, 2849, 2849, 11397, 11397, 14246, 29919, 29919, 29919, 29919,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // uh
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // ui
+    {0, 0, 4096, 4096, 4096, 4096, 8192, 8192, 8192, 8192, 8192, 16384, 16384,
+     16384, 16384, 16384, 16384, 20480, 28672, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // uj
+    {8445, 8445, 8445, 8445, 14526, 14526, 14526, 14526, 15202, 15202, 15202,
+     15202, 15202, 15202, 26687, 26687, 26687, 26687, 26687, 26687, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // uk
+    {16384, 16384, 16384, 16384, 16384, 16384, 16384, 16384, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // ul
+    {5334, 5334, 5334, 11430, 12954, 12954, 12954, 12954, 17526, 17526, 17526,
+     22098, 22098, 22098, 22098, 22098, 22098, 22098, 22098, 29720, 29720,
+     29720, 29720, 29720, 29720, 32768},
+    // um
+    {17645, 22686, 22686, 22686, 22686, 22686, 22686, 22686, 22686, 22686,
+     22686, 22686, 27727, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // un
+    {0, 0, 0, 13285, 13285, 13285, 17713, 17713, 22141, 22141, 22141, 22141,
+     22141, 22141, 23912, 23912, 23912, 23912, 23912, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // uo
+    {434, 1012, 1843, 2746, 2818, 3649, 4263, 4805, 5383, 5455, 5708, 8020,
+     9610, 16764, 17992, 19076, 19076, 23881, 25398, 26843, 29842, 30817,
+     32262, 32334, 32768, 32768},
+    // up
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6554, 6554, 6554, 19661, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // uq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // ur
+    {4520, 4520, 7910, 7910, 20338, 20338, 21468, 21468, 23728, 23728, 23728,
+     23728, 23728, 25988, 25988, 25988, 25988, 27118, 30508, 31638, 31638,
+     31638, 31638, 31638, 32768, 32768},
+    // us
+    {2849, 4274, 5699, 5699, 14247, 14247, 14247, 15672, 18521, 18521, 18521,
+     18521, 18521, 18521, 18521, 18521, 18521, 18521, 22795, 31343, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // ut
+    {0, 0, 0, 0, 4855, 4855, 4855, 16991, 23059, 23059, 23059, 23059, 23059,
+     23059, 23059, 23059, 23059, 23059, 25486, 27913, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // uu
+    {1105, 1841, 3682, 5007, 7290, 7437, 9278, 9425, 10603, 10603, 10898,
+     14359, 15316, 18482, 18482, 19587, 19587, 24742, 29234, 32179, 32179,
+     32179, 32179, 32326, 32768, 32768},
+    // uv
+    {2427, 2427, 2427, 2427, 21441, 21441, 21441, 21441, 29936, 29936, 29936,
+     29936, 29936, 29936, 32363, 32363, 32363, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // uw
+    {7284, 7284, 7284, 7284, 12563, 12563, 12563, 17114, 23121, 23121, 23121,
+     23485, 23485, 24941, 29856, 29856, 29856, 31676, 32040, 32404, 32404,
+     32404, 32404, 32404, 32768, 32768},
+    // ux
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // uy
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // uz
+    {12287, 12287, 12287, 12287, 23210, 23210, 23210, 25941, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 32768},
+    // v^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // va
+    {0, 0, 0, 0, 0, 0, 0, 0, 5461, 5461, 5461, 10922, 10922, 21846, 21846,
+     21846, 21846, 27307, 27307, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768},
+    // vb
+    {4228, 4492, 4492, 4492, 15723, 15723, 15723, 15723, 18366, 18630, 18630,
+     22065, 22065, 22065, 25765, 25765, 25765, 29993, 29993, 29993, 31843,
+     32107, 32107, 32107, 32768, 32768},
+    // vc
+    {4054, 4054, 4720, 4720, 10829, 10829, 10829, 18272, 19883, 19883, 21438,
+     22549, 22549, 22549, 27159, 27159, 27215, 28048, 28159, 30991, 32324,
+     32324, 32324, 32324, 32768, 32768},
+    // vd
+    {3493, 3493, 3493, 4109, 15511, 15511, 15922, 15922, 21572, 21572, 21572,
+     21777, 22085, 22085, 24653, 24653, 24653, 27837, 27837, 28248, 30508,
+     30508, 30919, 30919, 32768, 32768},
+    // ve
+    {1170, 1170, 1170, 1170, 1170, 1170, 1170, 1170, 1170, 1170, 1170, 5266,
+     6436, 13458, 13458, 13458, 13458, 32183, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // vf
+    {3081, 3081, 3081, 3081, 8962, 13863, 14143, 14143, 21286, 21286, 21286,
+     22126, 22686, 22686, 27447, 27447, 27447, 30248, 30248, 31088, 32488,
+     32488, 32488, 32488, 32768, 32768},
+    // vg
+    {4067, 4067, 4067, 4067, 13479, 13479, 13711, 17778, 20799, 20799, 20799,
+     22193, 22425, 23936, 26028, 26028, 26028, 29398, 29398, 29863, 32187,
+     32187, 32187, 32187, 32768, 32768},
+    // vh
+    {6963, 6963, 6963, 6963, 15155, 15155, 15155, 15155, 19456, 19456, 19456,
+     20002, 20821, 21708, 26965, 26965, 26965, 28194, 28331, 30242, 32085,
+     32085, 32222, 32222, 32768, 32768},
+    // vi
+    {1560, 1560, 4681, 10142, 17945, 17945, 17945, 17945, 17945, 17945, 17945,
+     19505, 19505, 22626, 24186, 24186, 24186, 27307, 31208, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // vj
+    {8445, 8445, 8445, 8445, 14526, 14526, 14526, 14526, 15202, 15202, 15202,
+     15202, 15202, 15202, 26687, 26687, 26687, 26687, 26687, 26687, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // vk
+    {4640, 4640, 4640, 4640, 17398, 17398, 17398, 17398, 22908, 22908, 22908,
+     25228, 25228, 26968, 28708, 28708, 28708, 31028, 31608, 31608, 32188,
+     32188, 32188, 32188, 32768, 32768},
+    // vl
+    {4634, 4823, 4823, 6525, 13522, 14420, 14515, 14515, 19054, 19054, 19338,
+     23925, 24114, 24114, 26951, 27140, 27140, 27235, 27613, 28370, 29316,
+     29647, 29742, 29742, 32484, 32768},
+    // vm
+    {8920, 9921, 9921, 9921, 17675, 17675, 17675, 17675, 22261, 22261, 22261,
+     22261, 23345, 23512, 28265, 30433, 30433, 30433, 31017, 31017, 32018,
+     32018, 32018, 32018, 32768, 32768},
+    // vn
+    {3358, 3358, 5446, 10257, 14115, 14206, 17973, 17973, 20605, 20877, 21512,
+     21784, 21920, 23599, 25142, 25142, 25142, 25324, 26413, 31315, 31678,
+     31860, 31860, 31860, 32586, 32768},
+    // vo
+    {0, 0, 0, 0, 0, 0, 10923, 10923, 27307, 27307, 27307, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768},
+    // vp
+    {4478, 4682, 4682, 4682, 11295, 11499, 11499, 13636, 15061, 15061, 15061,
+     18114, 18216, 18216, 22694, 24831, 24831, 30224, 30631, 30835, 32361,
+     32361, 32361, 32361, 32768, 32768},
+    // vq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // vr
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // vs
+    {2178, 2275, 4550, 4550, 11084, 11084, 11084, 12972, 16070, 16070, 16360,
+     16457, 16651, 16748, 20088, 21298, 21298, 21298, 23960, 30735, 32284,
+     32284, 32478, 32478, 32768, 32768},
+    // vt
+    {3075, 3075, 3363, 3363, 9753, 9753, 9753, 17202, 22247, 22247, 22247,
+     22631, 22823, 22823, 25129, 25129, 25129, 27531, 27915, 29453, 31087,
+     31087, 31279, 31279, 32768, 32768},
+    // vu
+    {1105, 1841, 3682, 5007, 7290, 7437, 9278, 9425, 10603, 10603, 10898,
+     14359, 15316, 18482, 18482, 19587, 19587, 24742, 29234, 32179, 32179,
+     32179, 32179, 32326, 32768, 32768},
+    // vv
+    {2427, 2427, 2427, 2427, 21441, 21441, 21441, 21441, 29936, 29936, 29936,
+     29936, 29936, 29936, 32363, 32363, 32363, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // vw
+    {7284, 7284, 7284, 7284, 12563, 12563, 12563, 17114, 23121, 23121, 23121,
+     23485, 23485, 24941, 29856, 29856, 29856, 31676, 32040, 32404, 32404,
+     32404, 32404, 32404, 32768, 32768},
+    // vx
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // vy
+    {1365, 2730, 3413, 3413, 10922, 10922, 10922, 10922, 10922, 10922, 10922,
+     16383, 17066, 21162, 26282, 26965, 26965, 26965, 31061, 32085, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // vz
+    {12287, 12287, 12287, 12287, 23210, 23210, 23210, 25941, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 32768},
+    // w^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // wa
+    {0, 0, 0, 0, 0, 0, 1638, 1638, 3276, 3276, 3276, 9830, 9830, 13107, 13107,
+     13107, 13107, 21299, 22937, 26214, 26214, 26214, 26214, 26214, 32768,
+     32768},
+    // wb
+    {4228, 4492, 4492, 4492, 15723, 15723, 15723, 15723, 18366, 18630, 18630,
+     22065, 22065, 22065, 25765, 25765, 25765, 29993, 29993, 29993, 31843,
+     32107, 32107, 32107, 32768, 32768},
+    // wc
+    {4054, 4054, 4720, 4720, 10829, 10829, 10829, 18272, 19883, 19883, 21438,
+     22549, 22549, 22549, 27159, 27159, 27215, 28048, 28159, 30991, 32324,
+     32324, 32324, 32324, 32768, 32768},
+    // wd
+    {3493, 3493, 3493, 4109, 15511, 15511, 15922, 15922, 21572, 21572, 21572,
+     21777, 22085, 22085, 24653, 24653, 24653, 27837, 27837, 28248, 30508,
+     30508, 30919, 30919, 32768, 32768},
+    // we
+    {4681, 7022, 7022, 7022, 9363, 9363, 9363, 9363, 16385, 16385, 16385,
+     18726, 18726, 18726, 18726, 18726, 18726, 28086, 30427, 30427, 30427,
+     32768, 32768, 32768, 32768, 32768},
+    // wf
+    {3081, 3081, 3081, 3081, 8962, 13863, 14143, 14143, 21286, 21286, 21286,
+     22126, 22686, 22686, 27447, 27447, 27447, 30248, 30248, 31088, 32488,
+     32488, 32488, 32488, 32768, 32768},
+    // wg
+    {4067, 4067, 4067, 4067, 13479, 13479, 13711, 17778, 20799, 20799, 20799,
+     22193, 22425, 23936, 26028, 26028, 26028, 29398, 29398, 29863, 32187,
+     32187, 32187, 32187, 32768, 32768},
+    // wh
+    {5243, 5243, 5243, 5243, 13107, 13107, 13107, 13107, 22283, 22283, 22283,
+     22283, 22283, 22283, 30147, 30147, 30147, 30147, 30147, 30147, 30147,
+     30147, 30147, 30147, 32768, 32768},
+    // wi
+    {0, 0, 0, 1986, 1986, 3972, 5958, 5958, 5958, 5958, 5958, 15887, 15887,
+     24824, 24824, 24824, 24824, 24824, 26810, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // wj
+    {8445, 8445, 8445, 8445, 14526, 14526, 14526, 14526, 15202, 15202, 15202,
+     15202, 15202, 15202, 26687, 26687, 26687, 26687, 26687, 26687, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // wk
+    {4640, 4640, 4640, 4640, 17398, 17398, 17398, 17398, 22908, 22908, 22908,
+     25228, 25228, 26968, 28708, 28708, 28708, 31028, 31608, 31608, 32188,
+     32188, 32188, 32188, 32768, 32768},
+    // wl
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // wm
+    {8920, 9921, 9921, 9921, 17675, 17675, 17675, 17675, 22261, 22261, 22261,
+     22261, 23345, 23512, 28265, 30433, 30433, 30433, 31017, 31017, 32018,
+     32018, 32018, 32018, 32768, 32768},
+    // wn
+    {3358, 3358, 5446, 10257, 14115, 14206, 17973, 17973, 20605, 20877, 21512,
+     21784, 21920, 23599, 25142, 25142, 25142, 25324, 26413, 31315, 31678,
+     31860, 31860, 31860, 32586, 32768},
+    // wo
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9175, 9175, 11796, 11796, 11796, 11796,
+     30147, 30147, 30147, 32768, 32768, 32768, 32768, 32768, 32768},
+    // wp
+    {4478, 4682, 4682, 4682, 11295, 11499, 11499, 13636, 15061, 15061, 15061,
+     18114, 18216, 18216, 22694, 24831, 24831, 30224, 30631, 30835, 32361,
+     32361, 32361, 32361, 32768, 32768},
+    // wq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // wr
+    {0, 0, 0, 0, 6554, 6554, 6554, 6554, 26214, 26214, 26214, 26214, 26214,
+     26214, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // ws
+    {2178, 2275, 4550, 4550, 11084, 11084, 11084, 12972, 16070, 16070, 16360,
+     16457, 16651, 16748, 20088, 21298, 21298, 21298, 23960, 30735, 32284,
+     32284, 32478, 32478, 32768, 32768},
+    // wt
+    {0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768},
+    // wu
+    {1105, 1841, 3682, 5007, 7290, 7437, 9278, 9425, 10603, 10603, 10898,
+     14359, 15316, 18482, 18482, 19587, 19587, 24742, 29234, 32179, 32179,
+     32179, 32179, 32326, 32768, 32768},
+    // wv
+    {2427, 2427, 2427, 2427, 21441, 21441, 21441, 21441, 29936, 29936, 29936,
+     29936, 29936, 29936, 32363, 32363, 32363, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // ww
+    {7284, 7284, 7284, 7284, 12563, 12563, 12563, 17114, 23121, 23121, 23121,
+     23485, 23485, 24941, 29856, 29856, 29856, 31676, 32040, 32404, 32404,
+     32404, 32404, 32404, 32768, 32768},
+    // wx
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // wy
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // wz
+    {12287, 12287, 12287, 12287, 23210, 23210, 23210, 25941, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 32768},
+    // x^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // xa
+    {0, 0, 10922, 10922, 10922, 10922, 10922, 10922, 10922, 10922, 10922,
+     10922, 21845, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // xb
+    {4228, 4492, 4492, 4492, 15723, 15723, 15723, 15723, 18366, 18630, 18630,
+     22065, 22065, 22065, 25765, 25765, 25765, 29993, 29993, 29993, 31843,
+     32107, 32107, 32107, 32768, 32768},
+    // xc
+    {4054, 4054, 4720, 4720, 10829, 10829, 10829, 18272, 19883, 19883, 21438,
+     22549, 22549, 22549, 27159, 27159, 27215, 28048, 28159, 30991, 32324,
+     32324, 32324, 32324, 32768, 32768},
+    // xd
+    {3493, 3493, 3493, 4109, 15511, 15511, 15922, 15922, 21572, 21572, 21572,
+     21777, 22085, 22085, 24653, 24653, 24653, 27837, 27837, 28248, 30508,
+     30508, 30919, 30919, 32768, 32768},
+    // xe
+    {0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // xf
+    {3081, 3081, 3081, 3081, 8962, 13863, 14143, 14143, 21286, 21286, 21286,
+     22126, 22686, 22686, 27447, 27447, 27447, 30248, 30248, 31088, 32488,
+     32488, 32488, 32488, 32768, 32768},
+    // xg
+    {4067, 4067, 4067, 4067, 13479, 13479, 13711, 17778, 20799, 20799, 20799,
+     22193, 22425, 23936, 26028, 26028, 26028, 29398, 29398, 29863, 32187,
+     32187, 32187, 32187, 32768, 32768},
+    // xh
+    {6963, 6963, 6963, 6963, 15155, 15155, 15155, 15155, 19456, 19456, 19456,
+     20002, 20821, 21708, 26965, 26965, 26965, 28194, 28331, 30242, 32085,
+     32085, 32222, 32222, 32768, 32768},
+    // xi
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // xj
+    {8445, 8445, 8445, 8445, 14526, 14526, 14526, 14526, 15202, 15202, 15202,
+     15202, 15202, 15202, 26687, 26687, 26687, 26687, 26687, 26687, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // xk
+    {4640, 4640, 4640, 4640, 17398, 17398, 17398, 17398, 22908, 22908, 22908,
+     25228, 25228, 26968, 28708, 28708, 28708, 31028, 31608, 31608, 32188,
+     32188, 32188, 32188, 32768, 32768},
+    // xl
+    {4634, 4823, 4823, 6525, 13522, 14420, 14515, 14515, 19054, 19054, 19338,
+     23925, 24114, 24114, 26951, 27140, 27140, 27235, 27613, 28370, 29316,
+     29647, 29742, 29742, 32484, 32768},
+    // xm
+    {8920, 9921, 9921, 9921, 17675, 17675, 17675, 17675, 22261, 22261, 22261,
+     22261, 23345, 23512, 28265, 30433, 30433, 30433, 31017, 31017, 32018,
+     32018, 32018, 32018, 32768, 32768},
+    // xn
+    {3358, 3358, 5446, 10257, 14115, 14206, 17973, 17973, 20605, 20877, 21512,
+     21784, 21920, 23599, 25142, 25142, 25142, 25324, 26413, 31315, 31678,
+     31860, 31860, 31860, 32586, 32768},
+    // xo
+    {434, 1012, 1843, 2746, 2818, 3649, 4263, 4805, 5383, 5455, 5708, 8020,
+     9610, 16764, 17992, 19076, 19076, 23881, 25398, 26843, 29842, 30817,
+     32262, 32334, 32768, 32768},
+    // xp
+    {0, 0, 0, 0, 23406, 23406, 23406, 23406, 23406, 23406, 23406, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // xq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // xr
+    {3877, 3946, 4426, 5593, 13485, 13588, 14514, 14583, 18769, 18769, 19249,
+     20107, 20896, 21651, 25734, 25734, 25734, 26626, 27415, 29577, 30400,
+     30606, 30675, 30675, 32699, 32768},
+    // xs
+    {2178, 2275, 4550, 4550, 11084, 11084, 11084, 12972, 16070, 16070, 16360,
+     16457, 16651, 16748, 20088, 21298, 21298, 21298, 23960, 30735, 32284,
+     32284, 32478, 32478, 32768, 32768},
+    // xt
+    {3075, 3075, 3363, 3363, 9753, 9753, 9753, 17202, 22247, 22247, 22247,
+     22631, 22823, 22823, 25129, 25129, 25129, 27531, 27915, 29453, 31087,
+     31087, 31279, 31279, 32768, 32768},
+    // xu
+    {1105, 1841, 3682, 5007, 7290, 7437, 9278, 9425, 10603, 10603, 10898,
+     14359, 15316, 18482, 18482, 19587, 19587, 24742, 29234, 32179, 32179,
+     32179, 32179, 32326, 32768, 32768},
+    // xv
+    {2427, 2427, 2427, 2427, 21441, 21441, 21441, 21441, 29936, 29936, 29936,
+     29936, 29936, 29936, 32363, 32363, 32363, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // xw
+    {7284, 7284, 7284, 7284, 12563, 12563, 12563, 17114, 23121, 23121, 23121,
+     23485, 23485, 24941, 29856, 29856, 29856, 31676, 32040, 32404, 32404,
+     32404, 32404, 32404, 32768, 32768},
+    // xx
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // xy
+    {1365, 2730, 3413, 3413, 10922, 10922, 10922, 10922, 10922, 10922, 10922,
+     16383, 17066, 21162, 26282, 26965, 26965, 26965, 31061, 32085, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // xz
+    {12287, 12287, 12287, 12287, 23210, 23210, 23210, 25941, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 32768},
+    // y^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // ya
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // yb
+    {0, 0, 0, 0, 16384, 16384, 16384, 16384, 16384, 16384, 16384, 16384, 16384,
+     16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // yc
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // yd
+    {3493, 3493, 3493, 4109, 15511, 15511, 15922, 15922, 21572, 21572, 21572,
+     21777, 22085, 22085, 24653, 24653, 24653, 27837, 27837, 28248, 30508,
+     30508, 30919, 30919, 32768, 32768},
+    // ye
+    {6554, 6554, 6554, 6554, 9831, 9831, 9831, 9831, 9831, 9831, 9831, 9831,
+     9831, 13108, 13108, 13108, 13108, 26214, 29491, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // yf
+    {3081, 3081, 3081, 3081, 8962, 13863, 14143, 14143, 21286, 21286, 21286,
+     22126, 22686, 22686, 27447, 27447, 27447, 30248, 30248, 31088, 32488,
+     32488, 32488, 32488, 32768, 32768},
+    // yg
+    {4067, 4067, 4067, 4067, 13479, 13479, 13711, 17778, 20799, 20799, 20799,
+     22193, 22425, 23936, 26028, 26028, 26028, 29398, 29398, 29863, 32187,
+     32187, 32187, 32187, 32768, 32768},
+    // yh
+    {6963, 6963, 6963, 6963, 15155, 15155, 15155, 15155, 19456, 19456, 19456,
+     20002, 20821, 21708, 26965, 26965, 26965, 28194, 28331, 30242, 32085,
+     32085, 32222, 32222, 32768, 32768},
+    // yi
+    {2354, 2548, 5773, 7224, 9449, 10062, 11771, 11771, 11771, 11836, 12094,
+     14352, 15610, 21737, 23995, 24221, 24221, 25382, 28285, 31284, 31413,
+     32284, 32284, 32413, 32413, 32768},
+    // yj
+    {8445, 8445, 8445, 8445, 14526, 14526, 14526, 14526, 15202, 15202, 15202,
+     15202, 15202, 15202, 26687, 26687, 26687, 26687, 26687, 26687, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // yk
+    {4640, 4640, 4640, 4640, 17398, 17398, 17398, 17398, 22908, 22908, 22908,
+     25228, 25228, 26968, 28708, 28708, 28708, 31028, 31608, 31608, 32188,
+     32188, 32188, 32188, 32768, 32768},
+    // yl
+    {9362, 9362, 9362, 9362, 23406, 23406, 23406, 23406, 23406, 23406, 23406,
+     23406, 23406, 23406, 28087, 28087, 28087, 28087, 28087, 28087, 28087,
+     32768, 32768, 32768, 32768, 32768},
+    // ym
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // yn
+    {0, 0, 0, 0, 16384, 16384, 16384, 16384, 16384, 16384, 16384, 16384, 16384,
+     16384, 16384, 16384, 16384, 16384, 16384, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // yo
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13107, 13107, 13107, 13107, 13107,
+     13107, 13107, 32768, 32768, 32768, 32768, 32768, 32768},
+    // yp
+    {0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // yq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // yr
+    {3877, 3946, 4426, 5593, 13485, 13588, 14514, 14583, 18769, 18769, 19249,
+     20107, 20896, 21651, 25734, 25734, 25734, 26626, 27415, 29577, 30400,
+     30606, 30675, 30675, 32699, 32768},
+    // ys
+    {0, 0, 0, 0, 6554, 6554, 6554, 6554, 19661, 19661, 19661, 19661, 19661,
+     19661, 19661, 19661, 19661, 19661, 19661, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // yt
+    {0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768},
+    // yu
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768},
+    // yv
+    {2427, 2427, 2427, 2427, 21441, 21441, 21441, 21441, 29936, 29936, 29936,
+     29936, 29936, 29936, 32363, 32363, 32363, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // yw
+    {7284, 7284, 7284, 7284, 12563, 12563, 12563, 17114, 23121, 23121, 23121,
+     23485, 23485, 24941, 29856, 29856, 29856, 31676, 32040, 32404, 32404,
+     32404, 32404, 32404, 32768, 32768},
+    // yx
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // yy
+    {1365, 2730, 3413, 3413, 10922, 10922, 10922, 10922, 10922, 10922, 10922,
+     16383, 17066, 21162, 26282, 26965, 26965, 26965, 31061, 32085, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // yz
+    {12287, 12287, 12287, 12287, 23210, 23210, 23210, 25941, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037, 30037,
+     30037, 30037, 30037, 30037, 30037, 32768},
+    // z^
+    {2389, 4175, 6443, 8011, 9326, 10846, 11799, 13307, 14043, 15020, 15828,
+     17505, 19496, 20328, 21088, 23151, 23272, 25046, 28751, 30368, 30573,
+     30838, 32455, 32455, 32684, 32768},
+    // za
+    {0, 9363, 18725, 18725, 18725, 18725, 18725, 18725, 18725, 18725, 18725,
+     28087, 28087, 28087, 28087, 28087, 28087, 28087, 28087, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // zb
+    {4228, 4492, 4492, 4492, 15723, 15723, 15723, 15723, 18366, 18630, 18630,
+     22065, 22065, 22065, 25765, 25765, 25765, 29993, 29993, 29993, 31843,
+     32107, 32107, 32107, 32768, 32768},
+    // zc
+    {4054, 4054, 4720, 4720, 10829, 10829, 10829, 18272, 19883, 19883, 21438,
+     22549, 22549, 22549, 27159, 27159, 27215, 28048, 28159, 30991, 32324,
+     32324, 32324, 32324, 32768, 32768},
+    // zd
+    {3493, 3493, 3493, 4109, 15511, 15511, 15922, 15922, 21572, 21572, 21572,
+     21777, 22085, 22085, 24653, 24653, 24653, 27837, 27837, 28248, 30508,
+     30508, 30919, 30919, 32768, 32768},
+    // ze
+    {3233, 3510, 5219, 6004, 7274, 7690, 8198, 8337, 9215, 9261, 9353, 11962,
+     12863, 17043, 17274, 17782, 17828, 26050, 28382, 29906, 29998, 31083,
+     31452, 31937, 32399, 32768},
+    // zf
+    {3081, 3081, 3081, 3081, 8962, 13863, 14143, 14143, 21286, 21286, 21286,
+     22126, 22686, 22686, 27447, 27447, 27447, 30248, 30248, 31088, 32488,
+     32488, 32488, 32488, 32768, 32768},
+    // zg
+    {4067, 4067, 4067, 4067, 13479, 13479, 13711, 17778, 20799, 20799, 20799,
+     22193, 22425, 23936, 26028, 26028, 26028, 29398, 29398, 29863, 32187,
+     32187, 32187, 32187, 32768, 32768},
+    // zh
+    {32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768},
+    // zi
+    {0, 0, 0, 0, 21845, 21845, 21845, 21845, 21845, 21845, 21845, 21845, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768},
+    // zj
+    {8445, 8445, 8445, 8445, 14526, 14526, 14526, 14526, 15202, 15202, 15202,
+     15202, 15202, 15202, 26687, 26687, 26687, 26687, 26687, 26687, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // zk
+    {4640, 4640, 4640, 4640, 17398, 17398, 17398, 17398, 22908, 22908, 22908,
+     25228, 25228, 26968, 28708, 28708, 28708, 31028, 31608, 31608, 32188,
+     32188, 32188, 32188, 32768, 32768},
+    // zl
+    {4634, 4823, 4823, 6525, 13522, 14420, 14515, 14515, 19054, 19054, 19338,
+     23925, 24114, 24114, 26951, 27140, 27140, 27235, 27613, 28370, 29316,
+     29647, 29742, 29742, 32484, 32768},
+    // zm
+    {8920, 9921, 9921, 9921, 17675, 17675, 17675, 17675, 22261, 22261, 22261,
+     22261, 23345, 23512, 28265, 30433, 30433, 30433, 31017, 31017, 32018,
+     32018, 32018, 32018, 32768, 32768},
+    // zn
+    {3358, 3358, 5446, 10257, 14115, 14206, 17973, 17973, 20605, 20877, 21512,
+     21784, 21920, 23599, 25142, 25142, 25142, 25324, 26413, 31315, 31678,
+     31860, 31860, 31860, 32586, 32768},
+    // zo
+    {434, 1012, 1843, 2746, 2818, 3649, 4263, 4805, 5383, 5455, 5708, 8020,
+     9610, 16764, 17992, 19076, 19076, 23881, 25398, 26843, 29842, 30817,
+     32262, 32334, 32768, 32768},
+    // zp
+    {4478, 4682, 4682, 4682, 11295, 11499, 11499, 13636, 15061, 15061, 15061,
+     18114, 18216, 18216, 22694, 24831, 24831, 30224, 30631, 30835, 32361,
+     32361, 32361, 32361, 32768, 32768},
+    // zq
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 32768,
+     32768, 32768, 32768, 32768},
+    // zr
+    {3877, 3946, 4426, 5593, 13485, 13588, 14514, 14583, 18769, 18769, 19249,
+     20107, 20896, 21651, 25734, 25734, 25734, 26626, 27415, 29577, 30400,
+     30606, 30675, 30675, 32699, 32768},
+    // zs
+    {2178, 2275, 4550, 4550, 11084, 11084, 11084, 12972, 16070, 16070, 16360,
+     16457, 16651, 16748, 20088, 21298, 21298, 21298, 23960, 30735, 32284,
+     32284, 32478, 32478, 32768, 32768},
+    // zt
+    {3075, 3075, 3363, 3363, 9753, 9753, 9753, 17202, 22247, 22247, 22247,
+     22631, 22823, 22823, 25129, 25129, 25129, 27531, 27915, 29453, 31087,
+     31087, 31279, 31279, 32768, 32768},
+    // zu
+    {1105, 1841, 3682, 5007, 7290, 7437, 9278, 9425, 10603, 10603, 10898,
+     14359, 15316, 18482, 18482, 19587, 19587, 24742, 29234, 32179, 32179,
+     32179, 32179, 32326, 32768, 32768},
+    // zv
+    {2427, 2427, 2427, 2427, 21441, 21441, 21441, 21441, 29936, 29936, 29936,
+     29936, 29936, 29936, 32363, 32363, 32363, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // zw
+    {7284, 7284, 7284, 7284, 12563, 12563, 12563, 17114, 23121, 23121, 23121,
+     23485, 23485, 24941, 29856, 29856, 29856, 31676, 32040, 32404, 32404,
+     32404, 32404, 32404, 32768, 32768},
+    // zx
+    {9362, 9362, 9362, 9362, 12483, 12483, 12483, 12483, 15604, 15604, 15604,
+     15604, 15604, 15604, 15604, 26526, 26526, 26526, 26526, 29647, 29647,
+     29647, 29647, 29647, 32768, 32768},
+    // zy
+    {1365, 2730, 3413, 3413, 10922, 10922, 10922, 10922, 10922, 10922, 10922,
+     16383, 17066, 21162, 26282, 26965, 26965, 26965, 31061, 32085, 32768,
+     32768, 32768, 32768, 32768, 32768},
+    // zz
+    {32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+     32768, 32768, 32768, 32768, 32768, 32768}
+};
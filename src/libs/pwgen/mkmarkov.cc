@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+// Train the Markov model of PronounceableGenerator on word lists.
+//
+// Usage: mkmarkov <output> <list>...
+//
+// Each list is a text file as read by Wordlist::readText(). Only the
+// letters of words are used, in lower case. The model is written as C++
+// header holding the cumulative weights of the letters following each
+// context.
+
+#include "config.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "pronounceable.hh"
+#include "wordlist.hh"
+
+using namespace yapet::pwgen;
+
+namespace {
+using Counts = std::vector<std::vector<unsigned long>>;
+
+bool empty(const std::vector<unsigned long>& counts) {
+    return std::all_of(counts.begin(), counts.end(),
+                       [](unsigned long count) { return count == 0; });
+}
+
+/**
+ * Scale \c counts to weights summing up to MARKOV_TOTAL. Letters seen keep
+ * a weight of at least one.
+ */
+std::vector<std::uint32_t> weights(const std::vector<unsigned long>& counts) {
+    unsigned long sum = 0;
+    for (auto count : counts) sum += count;
+
+    std::vector<std::uint32_t> weights(counts.size(), 0);
+    std::uint32_t total = 0;
+    for (std::size_t i = 0; i < counts.size(); i++) {
+        if (counts[i] == 0) continue;
+        weights[i] = std::max<std::uint32_t>(
+            1, (counts[i] * MARKOV_TOTAL + sum / 2) / sum);
+        total += weights[i];
+    }
+
+    // Rounding errors go to the most likely letter, which is far heavier
+    // than the error
+    auto largest = std::max_element(weights.begin(), weights.end());
+    *largest += MARKOV_TOTAL - total;
+    return weights;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "Usage: mkmarkov <output> <list>..." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    Counts counts(MARKOV_CONTEXTS,
+                  std::vector<unsigned long>(MARKOV_LETTERS, 0));
+    for (int i = 2; i < argc; i++) {
+        std::ifstream list{argv[i]};
+        if (!list) {
+            std::cerr << "mkmarkov: cannot open " << argv[i] << std::endl;
+            return EXIT_FAILURE;
+        }
+        for (auto& word : Wordlist::readText(list)) {
+            int context = 0;
+            for (auto c : word) {
+                if (!std::isalpha(static_cast<unsigned char>(c))) continue;
+                int letter =
+                    std::tolower(static_cast<unsigned char>(c)) - 'a';
+                counts[context][letter]++;
+                context = nextMarkovContext(context, letter);
+            }
+        }
+    }
+
+    if (empty(counts[0])) {
+        std::cerr << "mkmarkov: no words to train on" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Contexts only seen at the end of words back off to the letters
+    // following their last letter, or to the start of words.
+    Counts lastLetter(MARKOV_LETTERS + 1,
+                      std::vector<unsigned long>(MARKOV_LETTERS, 0));
+    for (int context = 0; context < MARKOV_CONTEXTS; context++) {
+        auto& last = lastLetter[context % (MARKOV_LETTERS + 1)];
+        for (int letter = 0; letter < MARKOV_LETTERS; letter++) {
+            last[letter] += counts[context][letter];
+        }
+    }
+
+    std::ofstream output{argv[1], std::ios::trunc};
+    output << "// Generated by mkmarkov, do not edit.\n"
+           << "//\n"
+           << "// The cumulative weights of the letters a to z following"
+           << " each context of\n"
+           << "// PronounceableGenerator, trained on "
+           << (argc - 2) << " word lists.\n\n"
+           << "constexpr std::uint16_t MARKOV_TABLE[MARKOV_CONTEXTS]"
+           << "[MARKOV_LETTERS]{\n";
+
+    for (int context = 0; context < MARKOV_CONTEXTS; context++) {
+        const auto* row = &counts[context];
+        if (empty(*row)) row = &lastLetter[context % (MARKOV_LETTERS + 1)];
+        if (empty(*row)) row = &counts[0];
+
+        std::string name;
+        for (int c = context, i = 0; i < MARKOV_ORDER;
+             i++, c /= MARKOV_LETTERS + 1) {
+            int symbol = c % (MARKOV_LETTERS + 1);
+            name.insert(name.begin(), symbol == 0 ? '^' : 'a' + symbol - 1);
+        }
+        output << "    // " << name << "\n    {";
+
+        std::uint32_t cumulative = 0;
+        std::size_t column = 5;
+        auto rowWeights = weights(*row);
+        for (int letter = 0; letter < MARKOV_LETTERS; letter++) {
+            cumulative += rowWeights[letter];
+            std::string value{std::to_string(cumulative)};
+            if (letter + 1 < MARKOV_LETTERS) value += ",";
+            if (column + value.size() + 1 > 79) {
+                output << "\n     ";
+                column = 5;
+            }
+            if (letter > 0 && column > 5) {
+                output << ' ';
+                column++;
+            }
+            output << value;
+            column += value.size();
+        }
+        output << "}" << (context + 1 < MARKOV_CONTEXTS ? "," : "") << '\n';
+    }
+    output << "};\n";
+
+    output.close();
+    if (!output) {
+        std::cerr << "mkmarkov: cannot write " << argv[1] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+// Compile word lists into the list used by PassphraseGenerator.
+//
+// Usage: mkwordlist <output> <list>...
+//
+// Each list is a text file as read by Wordlist::readText(). Words occurring
+// in more than one list are kept once.
+
+#include "config.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "wordlist.hh"
+
+using yapet::pwgen::Wordlist;
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "Usage: mkwordlist <output> <list>..." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<std::string> words;
+    std::unordered_set<std::string> seen;
+    for (int i = 2; i < argc; i++) {
+        std::ifstream list{argv[i]};
+        if (!list) {
+            std::cerr << "mkwordlist: cannot open " << argv[i] << std::endl;
+            return EXIT_FAILURE;
+        }
+        for (auto& word : Wordlist::readText(list)) {
+            if (seen.insert(word).second) words.push_back(word);
+        }
+    }
+
+    try {
+        auto serialized = Wordlist::serialize(words);
+
+        std::ofstream output{argv[1], std::ios::binary | std::ios::trunc};
+        output.write(reinterpret_cast<const char*>(serialized.data()),
+                     serialized.size());
+        output.close();
+        if (!output) {
+            std::cerr << "mkwordlist: cannot write " << argv[1] << std::endl;
+            return EXIT_FAILURE;
+        }
+    } catch (std::exception& ex) {
+        std::cerr << "mkwordlist: " << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include "consts.h"
+#include "intl.h"
+#include "passphrase.hh"
+
+using namespace yapet::pwgen;
+
+Capitalization yapet::pwgen::parseCapitalization(const std::string& name) {
+    if (name == "none") return Capitalization::NONE;
+    if (name == "first") return Capitalization::FIRST;
+    if (name == "random") return Capitalization::RANDOM;
+
+    char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+    std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                  _("Unknown capitalization '%s'"), name.c_str());
+    throw std::invalid_argument{msg};
+}
+
+const char* yapet::pwgen::capitalizationName(Capitalization capitalization) {
+    switch (capitalization) {
+        case Capitalization::FIRST:
+            return "first";
+        case Capitalization::RANDOM:
+            return "random";
+        default:
+            return "none";
+    }
+}
+
+PassphraseGenerator::PassphraseGenerator(
+    std::shared_ptr<const Wordlist> wordlist, int words,
+    const std::string& separator, Capitalization capitalization)
+    : _wordlist{wordlist},
+      _words{1},
+      _separator{separator},
+      _capitalization{capitalization},
+      _randomSource{} {
+    if (!_wordlist) {
+        throw std::invalid_argument{_("No word list provided")};
+    }
+    this->words(words);
+}
+
+void PassphraseGenerator::words(int words) {
+    if (words < 1) {
+        throw std::out_of_range{_("Passphrase must have at least one word")};
+    }
+    _words = words;
+}
+
+double PassphraseGenerator::entropy() const {
+    double bitsPerWord = std::log2(static_cast<double>(_wordlist->size()));
+    if (_capitalization == Capitalization::RANDOM) {
+        // Words not starting with a lower case letter are not changed
+        bitsPerWord += static_cast<double>(_wordlist->capitalizable()) /
+                       _wordlist->size();
+    }
+    return _words * bitsPerWord;
+}
+
+std::size_t PassphraseGenerator::maxLength() const {
+    return _words * _wordlist->maxWordLength() +
+           (_words - 1) * _separator.size();
+}
+
+std::size_t PassphraseGenerator::appendPassphrase(std::uint8_t* buffer) {
+    auto start = buffer;
+    for (int i = 0; i < _words; i++) {
+        if (i > 0) {
+            std::memcpy(buffer, _separator.data(), _separator.size());
+            buffer += _separator.size();
+        }
+
+        std::size_t length;
+        auto word = _wordlist->word(_randomSource.uniform(_wordlist->size()),
+                                    length);
+        std::memcpy(buffer, word, length);
+
+        bool capitalize =
+            _capitalization == Capitalization::FIRST ||
+            (_capitalization == Capitalization::RANDOM &&
+             (_randomSource.byte() & 1) != 0);
+        if (capitalize) {
+            buffer[0] = std::toupper(buffer[0]);
+        }
+        buffer += length;
+    }
+    return buffer - start;
+}
+
+yapet::SecureArray PassphraseGenerator::generatePassphrase() {
+    SecureArray buffer{static_cast<SecureArray::size_type>(maxLength() + 1)};
+    auto length = appendPassphrase(*buffer);
+
+    SecureArray passphrase{static_cast<SecureArray::size_type>(length + 1)};
+    std::memcpy(*passphrase, *buffer, length);
+    (*passphrase)[length] = '\0';
+    return passphrase;
+}
+
+std::size_t PassphraseGenerator::generatePassphrases(std::size_t count,
+                                                     std::uint8_t* buffer,
+                                                     std::uint8_t terminator) {
+    auto start = buffer;
+    for (std::size_t i = 0; i < count; i++) {
+        buffer += appendPassphrase(buffer);
+        *buffer++ = terminator;
+    }
+    return buffer - start;
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _PASSPHRASE_HH
+#define _PASSPHRASE_HH
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "randomsource.hh"
+#include "securearray.hh"
+#include "wordlist.hh"
+
+namespace yapet {
+namespace pwgen {
+enum class Capitalization {
+    /**
+     * Words are used as they are in the word list.
+     */
+    NONE,
+    /**
+     * The first letter of each word is upper case.
+     */
+    FIRST,
+    /**
+     * The first letter of each word is upper case with a probability of
+     * one half, adding one bit of entropy per word.
+     */
+    RANDOM
+};
+
+/**
+ * Parse \c none, \c first, or \c random.
+ *
+ * @throw std::invalid_argument for any other name.
+ */
+Capitalization parseCapitalization(const std::string& name);
+const char* capitalizationName(Capitalization capitalization);
+
+/**
+ * Passphrases made of words picked uniformly at random from a \c Wordlist,
+ * as described by Diceware.
+ */
+class PassphraseGenerator {
+   private:
+    std::shared_ptr<const Wordlist> _wordlist;
+    int _words;
+    std::string _separator;
+    Capitalization _capitalization;
+    RandomSource _randomSource;
+
+    std::size_t appendPassphrase(std::uint8_t* buffer);
+
+   public:
+    PassphraseGenerator(std::shared_ptr<const Wordlist> wordlist, int words,
+                        const std::string& separator = " ",
+                        Capitalization capitalization = Capitalization::NONE);
+    PassphraseGenerator(const PassphraseGenerator&) = delete;
+    PassphraseGenerator& operator=(const PassphraseGenerator&) = delete;
+
+    /**
+     * @param words the number of words, at least 1.
+     */
+    void words(int words);
+    int words() const { return _words; }
+
+    void separator(const std::string& separator) { _separator = separator; }
+    const std::string& separator() const { return _separator; }
+
+    void capitalization(Capitalization capitalization) {
+        _capitalization = capitalization;
+    }
+    Capitalization capitalization() const { return _capitalization; }
+
+    const Wordlist& wordlist() const { return *_wordlist; }
+
+    /**
+     * Entropy of the passphrases generated in bits.
+     */
+    double entropy() const;
+
+    /**
+     * The maximum length of a passphrase, without terminator.
+     */
+    std::size_t maxLength() const;
+
+    /**
+     * Return a zero terminated random passphrase.
+     */
+    SecureArray generatePassphrase();
+
+    /**
+     * Generate \c count passphrases, each followed by \c terminator, into
+     * \c buffer, which must hold \c count * (\c maxLength() + 1) bytes.
+     *
+     * @return the number of bytes written.
+     */
+    std::size_t generatePassphrases(std::size_t count, std::uint8_t* buffer,
+                                    std::uint8_t terminator = '\n');
+};
+}  // namespace pwgen
+}  // namespace yapet
+
+#endif
@@ -0,0 +1,269 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <stdexcept>
+
+#include "characterpool.hh"
+#include "consts.h"
+#include "intl.h"
+#include "policy.hh"
+
+using namespace yapet::pwgen;
+
+constexpr int Policy::CLASSES;
+
+namespace {
+const char* const CLASS_NAMES[Policy::CLASSES]{"lower",   "upper",
+                                               "digits",  "punct",
+                                               "special", "other"};
+
+const std::string& classCharacters(int characterClass) {
+    static const std::string lower{letters.substr(0, 26)};
+    static const std::string upper{letters.substr(26)};
+    switch (characterClass) {
+        case CLASS_LOWER:
+            return lower;
+        case CLASS_UPPER:
+            return upper;
+        case CLASS_DIGITS:
+            return digits;
+        case CLASS_PUNCT:
+            return punctuation;
+        case CLASS_SPECIAL:
+            return special;
+        default:
+            return other;
+    }
+}
+
+int classOf(std::uint8_t c) {
+    for (int i = 0; i < Policy::CLASSES; i++) {
+        if (classCharacters(i).find(static_cast<char>(c)) !=
+            std::string::npos) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+[[noreturn]] void invalidRule(const char* format, const std::string& rule) {
+    char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+    std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE, format,
+                  rule.c_str());
+    throw std::invalid_argument{msg};
+}
+
+bool parseNumber(const std::string& str, int& number) {
+    if (str.empty() ||
+        !std::isdigit(static_cast<unsigned char>(str.front()))) {
+        return false;
+    }
+
+    char* end;
+    errno = 0;
+    long value = std::strtol(str.c_str(), &end, 10);
+    if (errno != 0 || *end != '\0' ||
+        value > YAPET::Consts::MAX_PASSWORD_LENGTH) {
+        return false;
+    }
+    number = static_cast<int>(value);
+    return true;
+}
+
+/**
+ * Parse \c n, \c n-m, \c n-, or \c -m into \c min and \c max.
+ */
+void parseRange(const std::string& rule, const std::string& range, int& min,
+                int& max) {
+    auto dash = range.find('-');
+    bool valid;
+    if (dash == std::string::npos) {
+        valid = parseNumber(range, min);
+        max = min;
+    } else {
+        auto low = range.substr(0, dash);
+        auto high = range.substr(dash + 1);
+        min = 0;
+        max = YAPET::Consts::MAX_PASSWORD_LENGTH;
+        valid = (low.empty() || parseNumber(low, min)) &&
+                (high.empty() || parseNumber(high, max)) &&
+                !(low.empty() && high.empty());
+    }
+
+    if (!valid || min > max) {
+        invalidRule(_("Invalid range in rule '%s'"), rule);
+    }
+}
+
+void checkCharacters(const std::string& rule, const std::string& characters) {
+    for (auto c : characters) {
+        if (classOf(static_cast<std::uint8_t>(c)) < 0) {
+            invalidRule(_("Rule '%s' contains a character not used in "
+                          "passwords"),
+                        rule);
+        }
+    }
+}
+}  // namespace
+
+Policy::Policy()
+    : _characters{},
+      _minCount{},
+      _maxCount{},
+      _minLength{YAPET::Consts::MIN_PASSWORD_LENGTH},
+      _maxLength{YAPET::Consts::MAX_PASSWORD_LENGTH},
+      _maxRepeat{0} {
+    for (int i = 0; i < CLASSES; i++) {
+        _characters[i] = classCharacters(i);
+        _maxCount[i] = YAPET::Consts::MAX_PASSWORD_LENGTH;
+    }
+}
+
+Policy Policy::parse(const std::string& rules) {
+    Policy policy;
+    bool restricted = false;
+    std::string allowed;
+    std::string forbidden;
+
+    std::istringstream in{rules};
+    std::string rule;
+    while (in >> rule) {
+        auto equals = rule.find('=');
+        if (equals == std::string::npos || equals + 1 == rule.size()) {
+            invalidRule(_("Rule '%s' has no value"), rule);
+        }
+        auto name = rule.substr(0, equals);
+        auto value = rule.substr(equals + 1);
+
+        auto found =
+            std::find(std::begin(CLASS_NAMES), std::end(CLASS_NAMES), name);
+        if (found != std::end(CLASS_NAMES)) {
+            auto i = found - std::begin(CLASS_NAMES);
+            parseRange(rule, value, policy._minCount[i], policy._maxCount[i]);
+        } else if (name == "length") {
+            parseRange(rule, value, policy._minLength, policy._maxLength);
+            if (policy._minLength < 1) {
+                invalidRule(_("Invalid range in rule '%s'"), rule);
+            }
+        } else if (name == "allow") {
+            checkCharacters(rule, value);
+            restricted = true;
+            allowed = value;
+        } else if (name == "forbid") {
+            checkCharacters(rule, value);
+            forbidden = value;
+        } else if (name == "repeat") {
+            if (!parseNumber(value, policy._maxRepeat) ||
+                policy._maxRepeat < 1) {
+                invalidRule(_("Invalid number in rule '%s'"), rule);
+            }
+        } else {
+            invalidRule(_("Unknown rule '%s'"), rule);
+        }
+    }
+
+    int minimum = 0;
+    int available = 0;
+    for (int i = 0; i < CLASSES; i++) {
+        auto& characters = policy._characters[i];
+        characters.erase(
+            std::remove_if(characters.begin(), characters.end(),
+                           [&](char c) {
+                               return (restricted && allowed.find(c) ==
+                                                         std::string::npos) ||
+                                      forbidden.find(c) != std::string::npos;
+                           }),
+            characters.end());
+
+        if (characters.empty()) {
+            if (policy._minCount[i] > 0) {
+                invalidRule(_("The rules allow no characters of class '%s'"),
+                            CLASS_NAMES[i]);
+            }
+            policy._maxCount[i] = 0;
+        }
+        minimum += policy._minCount[i];
+        available += policy._maxCount[i];
+    }
+
+    if (available == 0) {
+        invalidRule(_("The rules '%s' allow no characters"), rules);
+    }
+    if (minimum > policy._maxLength) {
+        invalidRule(_("The rules '%s' require more characters than the "
+                      "maximum length"),
+                    rules);
+    }
+
+    return policy;
+}
+
+const char* Policy::className(int characterClass) {
+    return CLASS_NAMES[characterClass];
+}
+
+int Policy::clampLength(int length) const {
+    return std::max(_minLength, std::min(_maxLength, length));
+}
+
+bool Policy::satisfiedBy(const std::uint8_t* password, int size) const {
+    if (size < _minLength || size > _maxLength) return false;
+
+    int counts[CLASSES]{};
+    int occurrences[256]{};
+    for (int i = 0; i < size; i++) {
+        int characterClass = classOf(password[i]);
+        if (characterClass < 0 ||
+            _characters[characterClass].find(static_cast<char>(
+                password[i])) == std::string::npos) {
+            return false;
+        }
+        counts[characterClass]++;
+        if (++occurrences[password[i]] > _maxRepeat && _maxRepeat > 0) {
+            return false;
+        }
+    }
+
+    for (int i = 0; i < CLASSES; i++) {
+        if (counts[i] < _minCount[i] || counts[i] > _maxCount[i]) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _POLICY_HH
+#define _POLICY_HH
+
+#include <cstdint>
+#include <string>
+
+namespace yapet {
+namespace pwgen {
+/**
+ * The classes of characters rules apply to. Together, they contain the
+ * characters of all character pools.
+ */
+enum CharacterClass {
+    CLASS_LOWER,
+    CLASS_UPPER,
+    CLASS_DIGITS,
+    CLASS_PUNCT,
+    CLASS_SPECIAL,
+    CLASS_OTHER
+};
+
+/**
+ * Rules passwords have to satisfy, e.g. the rules of a site.
+ *
+ * Rules are given as white space separated list of \c name=value pairs:
+ *
+ * - \c length=range: the range of password lengths.
+ * - \c lower, \c upper, \c digits, \c punct, \c special, \c other=range:
+ *   how many characters of the class a password has.
+ * - \c allow=characters: use only these characters.
+ * - \c forbid=characters: never use these characters.
+ * - \c repeat=n: use each character at most \c n times.
+ *
+ * A range is either a number \c n, or \c n-m, \c n-, or \c -m. For
+ * instance, <tt>length=8-12 digits=2- special=0 forbid=0O1l</tt>.
+ */
+class Policy {
+   public:
+    static constexpr int CLASSES{6};
+
+   private:
+    std::string _characters[CLASSES];
+    int _minCount[CLASSES];
+    int _maxCount[CLASSES];
+    int _minLength;
+    int _maxLength;
+    int _maxRepeat;
+
+   public:
+    /**
+     * Allow all characters of the character pools, in any number.
+     */
+    Policy();
+
+    /**
+     * @throw std::invalid_argument if the rules are malformed or
+     * contradict each other.
+     */
+    static Policy parse(const std::string& rules);
+
+    /**
+     * The name of \c characterClass used by rules.
+     */
+    static const char* className(int characterClass);
+
+    /**
+     * The allowed characters of \c characterClass.
+     */
+    const std::string& characters(int characterClass) const {
+        return _characters[characterClass];
+    }
+    int minCount(int characterClass) const {
+        return _minCount[characterClass];
+    }
+    int maxCount(int characterClass) const {
+        return _maxCount[characterClass];
+    }
+
+    int minLength() const { return _minLength; }
+    int maxLength() const { return _maxLength; }
+    /**
+     * The length in the range of lengths closest to \c length.
+     */
+    int clampLength(int length) const;
+
+    /**
+     * How often each character may be used, or 0 if unlimited.
+     */
+    int maxRepeat() const { return _maxRepeat; }
+
+    bool satisfiedBy(const std::uint8_t* password, int size) const;
+};
+}  // namespace pwgen
+}  // namespace yapet
+
+#endif
@@ -0,0 +1,269 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include "consts.h"
+#include "intl.h"
+#include "policygenerator.hh"
+
+using namespace yapet::pwgen;
+
+PolicyGenerator::PolicyGenerator(const Policy& policy)
+    : _policy{policy},
+      _randomSource{},
+      _size{0},
+      _binomials{},
+      _sequences{},
+      _strings{},
+      _ways{},
+      _classes{},
+      _characters{} {}
+
+PolicyGenerator::~PolicyGenerator() {
+    std::fill(_characters.begin(), _characters.end(), 0);
+}
+
+void PolicyGenerator::prepare(int size) {
+    if (size < _policy.minLength() || size > _policy.maxLength()) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("The rules require passwords of %d to %d characters"),
+                      _policy.minLength(), _policy.maxLength());
+        throw std::invalid_argument{msg};
+    }
+    if (size == _size) return;
+
+    _binomials.assign(size + 1, std::vector<BigCount>{});
+    for (int n = 0; n <= size; n++) {
+        _binomials[n].resize(n + 1);
+        _binomials[n][0] = 1;
+        _binomials[n][n] = 1;
+        for (int k = 1; k < n; k++) {
+            _binomials[n][k] = _binomials[n - 1][k - 1];
+            _binomials[n][k] += _binomials[n - 1][k];
+        }
+    }
+
+    int maxRepeat = _policy.maxRepeat();
+    bool limited = maxRepeat > 0 && maxRepeat < size;
+    _sequences.assign(Policy::CLASSES, {});
+    _strings.assign(Policy::CLASSES, std::vector<BigCount>(size + 1));
+    for (int c = 0; c < Policy::CLASSES; c++) {
+        auto characters = _policy.characters(c).size();
+        auto& strings = _strings[c];
+
+        if (!limited) {
+            strings[0] = 1;
+            for (int n = 1; n <= size; n++) {
+                strings[n] = strings[n - 1];
+                strings[n] *= characters;
+            }
+            continue;
+        }
+
+        // Add one character at a time, which may be put into j of the n
+        // positions
+        auto& sequences = _sequences[c];
+        sequences.assign(characters + 1, std::vector<BigCount>(size + 1));
+        sequences[0][0] = 1;
+        for (std::size_t i = 1; i <= characters; i++) {
+            for (int n = 0; n <= size; n++) {
+                for (int j = 0; j <= std::min(maxRepeat, n); j++) {
+                    sequences[i][n] +=
+                        _binomials[n][j] * sequences[i - 1][n - j];
+                }
+            }
+        }
+        strings = sequences[characters];
+    }
+
+    _ways.assign(Policy::CLASSES + 1, std::vector<BigCount>(size + 1));
+    _ways[Policy::CLASSES][0] = 1;
+    for (int c = Policy::CLASSES - 1; c >= 0; c--) {
+        for (int r = 0; r <= size; r++) {
+            int last = std::min(_policy.maxCount(c), r);
+            for (int n = _policy.minCount(c); n <= last; n++) {
+                _ways[c][r] += term(c, r, n);
+            }
+        }
+    }
+
+    _classes.resize(size);
+    _size = size;
+}
+
+void PolicyGenerator::checkSatisfiable(int size) {
+    prepare(size);
+    if (_ways[0][size].isZero()) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("No password of %d characters satisfies the rules"),
+                      size);
+        throw std::invalid_argument{msg};
+    }
+}
+
+/**
+ * The number of strings of \c remaining characters of the classes \c
+ * characterClass and above, having \c count characters of \c
+ * characterClass.
+ */
+BigCount PolicyGenerator::term(int characterClass, int remaining,
+                               int count) const {
+    return _binomials[remaining][count] *
+           (_strings[characterClass][count] *
+            _ways[characterClass + 1][remaining - count]);
+}
+
+/**
+ * Append \c count random characters of \c characterClass to \c
+ * _characters.
+ */
+void PolicyGenerator::generateClass(int characterClass, int count) {
+    const auto& characters = _policy.characters(characterClass);
+    auto start = _characters.size();
+
+    if (count == 0) return;
+    if (_sequences[characterClass].empty()) {
+        for (int i = 0; i < count; i++) {
+            _characters.push_back(static_cast<std::uint8_t>(
+                characters[_randomSource.uniform(characters.size())]));
+        }
+        return;
+    }
+
+    // Draw how often each character is used, in proportion to the number
+    // of strings the remaining characters can make, then shuffle them
+    const auto& sequences = _sequences[characterClass];
+    int maxRepeat = _policy.maxRepeat();
+    int remaining = count;
+    for (std::size_t i = characters.size(); i > 0 && remaining > 0; i--) {
+        auto x = BigCount::uniform(sequences[i][remaining], _randomSource);
+        int j = 0;
+        for (;; j++) {
+            assert(j <= std::min(maxRepeat, remaining));
+            auto weight =
+                _binomials[remaining][j] * sequences[i - 1][remaining - j];
+            if (x < weight) break;
+            x -= weight;
+        }
+        _characters.insert(_characters.end(), j,
+                           static_cast<std::uint8_t>(characters[i - 1]));
+        remaining -= j;
+    }
+    assert(remaining == 0);
+
+    for (auto i = _characters.size() - 1; i > start; i--) {
+        auto k = start + _randomSource.uniform(i - start + 1);
+        std::swap(_characters[i], _characters[k]);
+    }
+}
+
+void PolicyGenerator::generate(std::uint8_t* password, int size) {
+    // Draw the number of characters of each class in proportion to the
+    // passwords having that number
+    int counts[Policy::CLASSES];
+    int remaining = size;
+    int position = 0;
+    for (int c = 0; c < Policy::CLASSES; c++) {
+        int n = _policy.minCount(c);
+        int last = std::min(_policy.maxCount(c), remaining);
+        if (n < last) {
+            auto x = BigCount::uniform(_ways[c][remaining], _randomSource);
+            for (; n < last; n++) {
+                auto weight = term(c, remaining, n);
+                if (x < weight) break;
+                x -= weight;
+            }
+        }
+        counts[c] = n;
+        std::fill_n(_classes.begin() + position, n, c);
+        position += n;
+        remaining -= n;
+    }
+    assert(remaining == 0);
+
+    // Each arrangement of the classes is equally likely
+    for (int i = size - 1; i > 0; i--) {
+        std::swap(_classes[i], _classes[_randomSource.uniform(i + 1)]);
+    }
+
+    _characters.clear();
+    std::size_t offsets[Policy::CLASSES];
+    for (int c = 0; c < Policy::CLASSES; c++) {
+        offsets[c] = _characters.size();
+        generateClass(c, counts[c]);
+    }
+    for (int i = 0; i < size; i++) {
+        password[i] = _characters[offsets[_classes[i]]++];
+    }
+    std::fill(_characters.begin(), _characters.end(), 0);
+}
+
+BigCount PolicyGenerator::count(int size) {
+    prepare(size);
+    return _ways[0][size];
+}
+
+double PolicyGenerator::entropy(int size) {
+    auto passwords = count(size);
+    return passwords.isZero() ? 0 : passwords.log2();
+}
+
+yapet::SecureArray PolicyGenerator::generatePassword(int size) {
+    checkSatisfiable(size);
+
+    SecureArray password{size + 1};
+    generate(*password, size);
+    password[size] = '\0';
+
+    assert(_policy.satisfiedBy(*password, size));
+    return password;
+}
+
+void PolicyGenerator::generatePasswords(int size, std::size_t count,
+                                        std::uint8_t* buffer,
+                                        std::uint8_t separator) {
+    checkSatisfiable(size);
+
+    for (std::size_t i = 0; i < count; i++) {
+        generate(buffer, size);
+        buffer[size] = separator;
+        buffer += size + 1;
+    }
+}
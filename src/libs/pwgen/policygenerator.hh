@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _POLICYGENERATOR_HH
+#define _POLICYGENERATOR_HH
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "bigcount.hh"
+#include "policy.hh"
+#include "randomsource.hh"
+#include "securearray.hh"
+
+namespace yapet {
+namespace pwgen {
+/**
+ * Random passwords satisfying a \c Policy, each equally likely.
+ *
+ * Passwords are not generated until one satisfies the rules. Instead, the
+ * passwords satisfying the rules are counted per character class, and the
+ * number of characters of each class, their positions, and the characters
+ * are drawn in proportion to these counts. Thus, each password satisfying
+ * the rules is equally likely, and generating one takes about the same
+ * time however tight the rules are.
+ *
+ * The counts are computed once per password length.
+ */
+class PolicyGenerator {
+   private:
+    Policy _policy;
+    RandomSource _randomSource;
+    int _size;
+    // _binomials[n][k] is n choose k
+    std::vector<std::vector<BigCount>> _binomials;
+    // _sequences[c][i][n] is the number of strings of n characters made of
+    // the first i characters of class c, using each at most maxRepeat()
+    // times. Empty if characters may be repeated without limit.
+    std::vector<std::vector<std::vector<BigCount>>> _sequences;
+    // _strings[c][n] is the number of strings of n characters of class c
+    std::vector<std::vector<BigCount>> _strings;
+    // _ways[c][r] is the number of strings of r characters of the classes c
+    // and above satisfying the rules
+    std::vector<std::vector<BigCount>> _ways;
+    std::vector<int> _classes;
+    std::vector<std::uint8_t> _characters;
+
+    void prepare(int size);
+    void checkSatisfiable(int size);
+    BigCount term(int characterClass, int remaining, int count) const;
+    void generateClass(int characterClass, int count);
+    void generate(std::uint8_t* password, int size);
+
+   public:
+    PolicyGenerator(const Policy& policy);
+    PolicyGenerator(const PolicyGenerator&) = delete;
+    PolicyGenerator& operator=(const PolicyGenerator&) = delete;
+    ~PolicyGenerator();
+
+    const Policy& policy() const { return _policy; }
+
+    /**
+     * The number of passwords of \c size characters satisfying the rules.
+     *
+     * @throw std::invalid_argument if \c size is not in the range of
+     * lengths of the rules.
+     */
+    BigCount count(int size);
+
+    /**
+     * The entropy of passwords of \c size characters in bits, or 0 if no
+     * password of this length satisfies the rules.
+     */
+    double entropy(int size);
+
+    /**
+     * Return a zero terminated random password.
+     *
+     * @throw std::invalid_argument if no password of \c size characters
+     * satisfies the rules.
+     */
+    SecureArray generatePassword(int size);
+
+    /**
+     * Generate \c count passwords of \c size characters, each followed by
+     * \c separator, into \c buffer, which must hold \c count * (\c size +
+     * 1) bytes.
+     */
+    void generatePasswords(int size, std::size_t count, std::uint8_t* buffer,
+                           std::uint8_t separator = '\n');
+};
+}  // namespace pwgen
+}  // namespace yapet
+
+#endif
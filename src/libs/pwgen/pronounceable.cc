@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include "consts.h"
+#include "intl.h"
+#include "pronounceable.hh"
+
+using namespace yapet::pwgen;
+
+namespace {
+#include "markovtable.hh"
+
+constexpr bool validMarkovTable() {
+    for (int context = 0; context < MARKOV_CONTEXTS; context++) {
+        for (int letter = 1; letter < MARKOV_LETTERS; letter++) {
+            if (MARKOV_TABLE[context][letter] <
+                MARKOV_TABLE[context][letter - 1])
+                return false;
+        }
+        if (MARKOV_TABLE[context][MARKOV_LETTERS - 1] != MARKOV_TOTAL)
+            return false;
+    }
+    return true;
+}
+
+static_assert(validMarkovTable(),
+              "Markov table weights must add up to MARKOV_TOTAL");
+
+constexpr std::uint32_t markovWeight(int context, int letter) {
+    return letter == 0 ? MARKOV_TABLE[context][0]
+                       : MARKOV_TABLE[context][letter] -
+                             MARKOV_TABLE[context][letter - 1];
+}
+
+void checkSize(int size) {
+    if (size < 1) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("%d is not a valid password size"), size);
+        throw std::invalid_argument(msg);
+    }
+}
+}  // namespace
+
+PronounceableGenerator::PronounceableGenerator() : _randomSource{} {}
+
+void PronounceableGenerator::generate(std::uint8_t* password, int size) {
+    int context = 0;
+    for (int i = 0; i < size; i++) {
+        // MARKOV_TOTAL is a power of two, so no draw is rejected
+        std::uint32_t value =
+            ((_randomSource.byte() << 8) | _randomSource.byte()) &
+            (MARKOV_TOTAL - 1);
+        const auto* row = MARKOV_TABLE[context];
+        int letter = std::upper_bound(row, row + MARKOV_LETTERS, value) - row;
+        password[i] = static_cast<std::uint8_t>('a' + letter);
+        context = nextMarkovContext(context, letter);
+    }
+}
+
+double PronounceableGenerator::entropy(int size) {
+    checkSize(size);
+
+    // Entropy of the letter following each context
+    static const std::vector<double> letterEntropy = []() {
+        std::vector<double> entropy(MARKOV_CONTEXTS, 0);
+        for (int context = 0; context < MARKOV_CONTEXTS; context++) {
+            for (int letter = 0; letter < MARKOV_LETTERS; letter++) {
+                auto weight = markovWeight(context, letter);
+                if (weight == 0) continue;
+                double p = static_cast<double>(weight) / MARKOV_TOTAL;
+                entropy[context] -= p * std::log2(p);
+            }
+        }
+        return entropy;
+    }();
+
+    // Since the context follows from the letters, the entropy of a
+    // password is the sum of the expected entropies of its letters.
+    std::vector<double> probability(MARKOV_CONTEXTS, 0);
+    std::vector<double> next(MARKOV_CONTEXTS);
+    probability[0] = 1;
+    double entropy = 0;
+    for (int i = 0; i < size; i++) {
+        std::fill(next.begin(), next.end(), 0);
+        for (int context = 0; context < MARKOV_CONTEXTS; context++) {
+            if (probability[context] == 0) continue;
+            entropy += probability[context] * letterEntropy[context];
+            for (int letter = 0; letter < MARKOV_LETTERS; letter++) {
+                next[nextMarkovContext(context, letter)] +=
+                    probability[context] * markovWeight(context, letter) /
+                    MARKOV_TOTAL;
+            }
+        }
+        probability.swap(next);
+    }
+    return entropy;
+}
+
+yapet::SecureArray PronounceableGenerator::generatePassword(int size) {
+    checkSize(size);
+
+    SecureArray password{size + 1};
+    generate(*password, size);
+    (*password)[size] = '\0';
+    return password;
+}
+
+void PronounceableGenerator::generatePasswords(int size, std::size_t count,
+                                               std::uint8_t* buffer,
+                                               std::uint8_t separator) {
+    checkSize(size);
+
+    for (std::size_t i = 0; i < count; i++) {
+        generate(buffer, size);
+        buffer[size] = separator;
+        buffer += size + 1;
+    }
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _PRONOUNCEABLE_HH
+#define _PRONOUNCEABLE_HH
+
+#include <cstddef>
+#include <cstdint>
+
+#include "randomsource.hh"
+#include "securearray.hh"
+
+namespace yapet {
+namespace pwgen {
+/**
+ * The number of preceding letters a letter of a pronounceable password
+ * depends on.
+ */
+constexpr int MARKOV_ORDER{2};
+/**
+ * Letters \c a to \c z. The contexts additionally use the word start.
+ */
+constexpr int MARKOV_LETTERS{26};
+constexpr int MARKOV_CONTEXTS{27 * 27};
+/**
+ * The sum of the weights of the letters following a context.
+ */
+constexpr std::uint32_t MARKOV_TOTAL{1 << 15};
+
+/**
+ * The context following \c context when \c letter, 0 for \c a, is
+ * appended. Context 0 is the start of the password.
+ */
+constexpr int nextMarkovContext(int context, int letter) {
+    return (context * (MARKOV_LETTERS + 1) + letter + 1) % MARKOV_CONTEXTS;
+}
+
+/**
+ * Pronounceable passwords made of lower case letters.
+ *
+ * Each letter is drawn depending on the two preceding ones from a
+ * character Markov model trained on English words and names by \c
+ * mkmarkov. The model is compiled in as table of cumulative weights, so
+ * drawing a letter takes two random bytes and a table lookup.
+ *
+ * Pronounceable passwords are far more predictable than passwords of the
+ * same length drawn from character pools. \c entropy() tells how much.
+ */
+class PronounceableGenerator {
+   private:
+    RandomSource _randomSource;
+
+    void generate(std::uint8_t* password, int size);
+
+   public:
+    PronounceableGenerator();
+    PronounceableGenerator(const PronounceableGenerator&) = delete;
+    PronounceableGenerator& operator=(const PronounceableGenerator&) = delete;
+
+    /**
+     * The Shannon entropy of the passwords of \c size letters generated in
+     * bits.
+     *
+     * It is computed exactly from the model by following the probability
+     * of each context letter by letter.
+     */
+    static double entropy(int size);
+
+    /**
+     * Return a zero terminated random password.
+     *
+     * \c size must be at least 1.
+     */
+    SecureArray generatePassword(int size);
+
+    /**
+     * Generate \c count passwords of \c size letters, each followed by \c
+     * separator, into \c buffer, which must hold \c count * (\c size + 1)
+     * bytes.
+     *
+     * \c size must be at least 1.
+     */
+    void generatePasswords(int size, std::size_t count, std::uint8_t* buffer,
+                           std::uint8_t separator = '\n');
+};
+}  // namespace pwgen
+}  // namespace yapet
+
+#endif
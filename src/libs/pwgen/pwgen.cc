@@ -32,8 +32,9 @@
 #endif
 
 #include <cassert>
-#include <limits>
+#include <cstdio>
 #include <stdexcept>
+#include <utility>
 
 #include "consts.h"
 #include "intl.h"
@@ -42,87 +43,75 @@
 using namespace yapet::pwgen;
 
 namespace {
-int countPools(int pools) {
-    int numberOfPools = 0;
-    if (isLetters(pools)) {
-        numberOfPools++;
-    }
-    if (isDigits(pools)) {
-        numberOfPools++;
-    }
-    if (isPunct(pools)) {
-        numberOfPools++;
-    }
-    if (isSpecial(pools)) {
-        numberOfPools++;
-    }
-    if (isOther(pools)) {
-        numberOfPools++;
+void checkSize(int size) {
+    if (size < 1) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("%d is not a valid password size"), size);
+        throw std::invalid_argument(msg);
     }
-    return numberOfPools;
 }
 
-bool canContainCharactersFromSelectedPools(int pools,
-                                           const yapet::SecureArray& password) {
-    int numberOfPools{countPools(pools)};
-    int sizeOfPassword{password.size() - 1};
-
-    return numberOfPools <= sizeOfPassword;
-}
-
-bool containsCharactersFromPool(const std::string& pool,
-                                const yapet::SecureArray& password) {
-    for (yapet::SecureArray::size_type i = 0; i < password.size() - 1; i++) {
-        char passwordCharacter = static_cast<char>(password[i]);
-        if (pool.find(passwordCharacter, 0) != std::string::npos) {
-            return true;
+/**
+ * Fill \c password with \c size random characters, one of each of \c
+ * selectedPools first if there is room for, the remaining of \c pool, and
+ * shuffle them.
+ */
+void generate(std::uint8_t* password, int size, const std::string& pool,
+              const std::vector<std::string>& selectedPools,
+              RandomSource& randomSource) {
+    int position = 0;
+    if (selectedPools.size() <= static_cast<std::size_t>(size)) {
+        for (const auto& selectedPool : selectedPools) {
+            password[position++] = static_cast<std::uint8_t>(
+                selectedPool[randomSource.uniform(selectedPool.size())]);
         }
     }
-    return false;
-}
-bool containsSelectedPools(int pools, const yapet::SecureArray& password) {
-    if (!canContainCharactersFromSelectedPools(pools, password)) {
-        return true;
-    }
-
-    bool satisfied = true;
-
-    if (isLetters(pools)) {
-        satisfied = satisfied &&
-                    containsCharactersFromPool(yapet::pwgen::letters, password);
+    for (; position < size; position++) {
+        password[position] =
+            static_cast<std::uint8_t>(pool[randomSource.uniform(pool.size())]);
     }
 
-    if (isDigits(pools)) {
-        satisfied = satisfied &&
-                    containsCharactersFromPool(yapet::pwgen::digits, password);
-    }
-
-    if (isPunct(pools)) {
-        satisfied = satisfied && containsCharactersFromPool(
-                                     yapet::pwgen::punctuation, password);
+    // Fisher-Yates shuffle, so the characters placed first may end up
+    // anywhere
+    for (int i = size - 1; i > 0; i--) {
+        std::swap(password[i], password[randomSource.uniform(i + 1)]);
     }
+}
+}  // namespace
 
-    if (isSpecial(pools)) {
-        satisfied = satisfied &&
-                    containsCharactersFromPool(yapet::pwgen::special, password);
+bool yapet::pwgen::containsSelectedPools(int pools,
+                                         const std::uint8_t* password,
+                                         int size) {
+    auto selectedPools{getSelectedPools(pools)};
+    if (selectedPools.size() > static_cast<std::size_t>(size)) {
+        return true;
     }
 
-    if (isOther(pools)) {
-        satisfied = satisfied &&
-                    containsCharactersFromPool(yapet::pwgen::other, password);
+    for (const auto& selectedPool : selectedPools) {
+        CharacterTable table{selectedPool};
+        bool found = false;
+        for (int i = 0; i < size && !found; i++) {
+            found = table.contains(password[i]);
+        }
+        if (!found) return false;
     }
-
-    return satisfied;
+    return true;
 }
-}  // namespace
 
 PasswordGenerator::PasswordGenerator(POOLS pool)
     : PasswordGenerator{static_cast<int>(pool)} {}
 
-PasswordGenerator::PasswordGenerator(int pools) : _characterPools{pools} {}
+PasswordGenerator::PasswordGenerator(int pools)
+    : _characterPools{}, _pool{}, _selectedPools{}, _randomSource{} {
+    characterPools(pools);
+}
 
 PasswordGenerator::PasswordGenerator(PasswordGenerator&& other)
-    : _characterPools{other._characterPools} {}
+    : _characterPools{other._characterPools},
+      _pool{std::move(other._pool)},
+      _selectedPools{std::move(other._selectedPools)},
+      _randomSource{std::move(other._randomSource)} {}
 
 PasswordGenerator& PasswordGenerator::operator=(PasswordGenerator&& other) {
     if (this == &other) {
@@ -130,34 +119,47 @@ PasswordGenerator& PasswordGenerator::operator=(PasswordGenerator&& other) {
     }
 
     _characterPools = other._characterPools;
+    _pool = std::move(other._pool);
+    _selectedPools = std::move(other._selectedPools);
+    _randomSource = std::move(other._randomSource);
 
     return *this;
 }
 
-void PasswordGenerator::characterPools(int pools) { _characterPools = pools; }
+void PasswordGenerator::characterPools(int pools) {
+    _characterPools = pools;
+    _selectedPools = getSelectedPools(pools);
+    _pool.clear();
+    for (const auto& selectedPool : _selectedPools) {
+        _pool += selectedPool;
+    }
+}
 
 yapet::SecureArray PasswordGenerator::generatePassword(int size) {
-    if (size < 1) {
-        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
-        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
-                      _("%d is not a valid password size"), size);
-        throw std::invalid_argument(msg);
+    checkSize(size);
+    if (_pool.empty()) {
+        throw std::out_of_range{_("No character pools selected")};
     }
 
-    std::string pools{getPools(_characterPools)};
-    auto poolSize{pools.size()};
+    SecureArray password{size + 1};
+    generate(*password, size, _pool, _selectedPools, _randomSource);
+    password[size] = '\0';
 
-    assert(poolSize < std::numeric_limits<std::uint8_t>::max());
-    std::uint8_t poolSizeUint8{static_cast<std::uint8_t>(poolSize)};
+    assert(containsSelectedPools(_characterPools, *password, size));
+    return password;
+}
 
-    Rng rng(std::uint8_t(poolSizeUint8) - 1);
+void PasswordGenerator::generatePasswords(int size, std::size_t count,
+                                          std::uint8_t* buffer,
+                                          std::uint8_t separator) {
+    checkSize(size);
+    if (_pool.empty()) {
+        throw std::out_of_range{_("No character pools selected")};
+    }
 
-    SecureArray password{size + 1};
-    do {
-        for (int i = 0; i < size; i++) {
-            password[i] = pools[rng.getNextInt()];
-        }
-        password[size] = '\0';
-    } while (!containsSelectedPools(_characterPools, password));
-    return password;
+    for (std::size_t i = 0; i < count; i++) {
+        generate(buffer, size, _pool, _selectedPools, _randomSource);
+        buffer[size] = separator;
+        buffer += size + 1;
+    }
 }
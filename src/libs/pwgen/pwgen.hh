@@ -30,17 +30,43 @@
 #ifndef _PWGEN_HH
 #define _PWGEN_HH
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "characterpool.hh"
-#include "rng.hh"
+#include "randomsource.hh"
 #include "securearray.hh"
 
 namespace yapet {
 namespace pwgen {
+/**
+ * Whether \c password, having \c size characters, contains a character of
+ * each pool selected by \c pools. Passwords shorter than the number of
+ * pools selected are not required to.
+ */
+bool containsSelectedPools(int pools, const std::uint8_t* password,
+                           int size);
+
+/**
+ * Random passwords made of the characters of the selected pools.
+ *
+ * Passwords contain a character of each pool selected, as long as they are
+ * long enough. Instead of generating passwords until one does, a
+ * character of each pool is placed first, the remaining characters are
+ * drawn from all pools, and the characters are shuffled. Generating a
+ * password thus takes a fixed number of random values, which are read from
+ * a buffered \c RandomSource. Thus, generating many passwords is cheap,
+ * see \c generatePasswords().
+ */
 class PasswordGenerator {
    private:
     int _characterPools;
+    std::string _pool;
+    std::vector<std::string> _selectedPools;
+    RandomSource _randomSource;
 
    public:
     PasswordGenerator(POOLS pool);
@@ -57,10 +83,20 @@ class PasswordGenerator {
 
     /**
      * Return a zero terminated random password.
-     * 
+     *
      * \c size must be at least 1.
      */
     SecureArray generatePassword(int size);
+
+    /**
+     * Generate \c count passwords of \c size characters, each followed by
+     * \c separator, into \c buffer, which must hold \c count * (\c size +
+     * 1) bytes.
+     *
+     * \c size must be at least 1.
+     */
+    void generatePasswords(int size, std::size_t count, std::uint8_t* buffer,
+                           std::uint8_t separator = '\n');
 };
 }  // namespace pwgen
 }  // namespace yapet
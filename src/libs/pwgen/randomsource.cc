@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cassert>
+
+#include "chacha20drbg.hh"
+#include "randomsource.hh"
+
+using namespace yapet::pwgen;
+
+constexpr int RandomSource::BUFFER_SIZE;
+
+RandomSource::RandomSource() : _buffer{BUFFER_SIZE}, _position{BUFFER_SIZE} {}
+
+RandomSource::RandomSource(RandomSource&& other)
+    : _buffer{std::move(other._buffer)}, _position{other._position} {
+    other._position = BUFFER_SIZE;
+}
+
+RandomSource& RandomSource::operator=(RandomSource&& other) {
+    if (this == &other) return *this;
+
+    _buffer = std::move(other._buffer);
+    _position = other._position;
+    other._position = BUFFER_SIZE;
+
+    return *this;
+}
+
+void RandomSource::fill() {
+    // A moved from source has lost its buffer
+    if (_buffer.size() != BUFFER_SIZE) {
+        _buffer = SecureArray{BUFFER_SIZE};
+    }
+
+    randomBytes(*_buffer, BUFFER_SIZE);
+    _position = 0;
+}
+
+std::uint32_t RandomSource::uniform(std::uint32_t n) {
+    assert(n > 0);
+
+    // Values at or above the largest multiple of n are rejected, since they
+    // would favour small numbers
+    if (n <= 256) {
+        std::uint32_t limit = 256 - 256 % n;
+        std::uint32_t value;
+        do {
+            value = byte();
+        } while (value >= limit);
+        return value % n;
+    }
+
+    constexpr std::uint64_t RANGE{std::uint64_t{1} << 32};
+    std::uint64_t limit = RANGE - RANGE % n;
+    std::uint64_t value;
+    do {
+        value = 0;
+        for (int i = 0; i < 4; i++) value = (value << 8) | byte();
+    } while (value >= limit);
+    return static_cast<std::uint32_t>(value % n);
+}
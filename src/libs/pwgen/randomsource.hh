@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _RANDOMSOURCE_HH
+#define _RANDOMSOURCE_HH
+
+#include <cstdint>
+
+#include "securearray.hh"
+
+namespace yapet {
+namespace pwgen {
+/**
+ * Buffered random bytes of the generator of the calling thread.
+ *
+ * Bytes are taken from \c ChaCha20Drbg in batches of \c BUFFER_SIZE
+ * bytes, so drawing single bytes is cheap. The buffer is wiped when the
+ * source is destroyed.
+ */
+class RandomSource {
+   public:
+    static constexpr int BUFFER_SIZE{4096};
+
+   private:
+    SecureArray _buffer;
+    int _position;
+
+    void fill();
+
+   public:
+    RandomSource();
+
+    RandomSource(const RandomSource&) = delete;
+    RandomSource& operator=(const RandomSource&) = delete;
+
+    RandomSource(RandomSource&& other);
+    RandomSource& operator=(RandomSource&& other);
+
+    std::uint8_t byte() {
+        if (_position == BUFFER_SIZE) fill();
+        return (*_buffer)[_position++];
+    }
+
+    /**
+     * A uniformly distributed random number in the range <tt>[0, n)</tt>.
+     *
+     * \c n must be at least 1.
+     */
+    std::uint32_t uniform(std::uint32_t n);
+};
+}  // namespace pwgen
+}  // namespace yapet
+
+#endif
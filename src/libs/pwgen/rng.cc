@@ -31,18 +31,18 @@
 
 using namespace yapet::pwgen;
 
-Rng::Rng(std::uint8_t hi) : _rngEngine{}, _distribution{0, hi} {}
+Rng::Rng(std::uint8_t hi) : _randomEngine{}, _distribution{0, hi} {}
 
-Rng::Rng(const Rng& rng) : _rngEngine{}, _distribution{rng._distribution} {}
+Rng::Rng(const Rng& rng) : _randomEngine{}, _distribution{rng._distribution} {}
 
 Rng::Rng(Rng&& rng)
-    : _rngEngine{std::move(rng._rngEngine)},
+    : _randomEngine{std::move(rng._randomEngine)},
       _distribution{std::move(rng._distribution)} {}
 
 Rng& Rng::operator=(const Rng& rng) {
     if (this == &rng) return *this;
 
-    _rngEngine = rng._rngEngine;
+    _randomEngine = rng._randomEngine;
     _distribution = rng._distribution;
 
     return *this;
@@ -51,10 +51,10 @@ Rng& Rng::operator=(const Rng& rng) {
 Rng& Rng::operator=(Rng&& rng) {
     if (this == &rng) return *this;
 
-    _rngEngine = std::move(rng._rngEngine);
+    _randomEngine = std::move(rng._randomEngine);
     _distribution = std::move(rng._distribution);
 
     return *this;
 }
 
-std::uint8_t Rng::getNextInt() { return _distribution(_rngEngine); }
\ No newline at end of file
+std::uint8_t Rng::getNextInt() { return _distribution(_randomEngine); }
\ No newline at end of file
@@ -32,14 +32,15 @@
 
 #include <cstdint>
 #include <random>
-#include <rngengine.hh>
+
+#include "chacha20drbg.hh"
 
 namespace yapet {
 namespace pwgen {
 
 class Rng {
    private:
-    RngEngine _rngEngine;
+    RandomEngine _randomEngine;
     std::uniform_int_distribution<std::uint8_t> _distribution;
 
    public:
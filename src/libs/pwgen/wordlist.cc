@@ -0,0 +1,267 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_set>
+
+#include "consts.h"
+#include "fileerror.hh"
+#include "intl.h"
+#include "ods.hh"
+#include "wordlist.hh"
+
+using namespace yapet::pwgen;
+
+constexpr char Wordlist::MAGIC[];
+constexpr char Wordlist::DEFAULT_FILENAME[];
+constexpr std::size_t Wordlist::MAX_WORD_LENGTH;
+constexpr std::uint32_t Wordlist::MIN_WORDS;
+
+namespace {
+std::uint32_t readUint32(const std::uint8_t* ptr) {
+    std::uint32_t value;
+    std::memcpy(&value, ptr, sizeof(value));
+    return yapet::toHost(value);
+}
+
+void appendUint32(std::vector<std::uint8_t>& buffer, std::uint32_t value) {
+    value = yapet::toODS(value);
+    auto bytes = reinterpret_cast<const std::uint8_t*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(value));
+}
+
+bool isCompiled(const yapet::MappedFile& mappedFile) {
+    return mappedFile.size() >= Wordlist::MAGIC_SIZE &&
+           std::memcmp(mappedFile.data(), Wordlist::MAGIC,
+                       Wordlist::MAGIC_SIZE) == 0;
+}
+}  // namespace
+
+Wordlist::Wordlist(const std::string& filename)
+    : _mappedFile{new MappedFile{filename}},
+      _ownData{},
+      _offsets{nullptr},
+      _text{nullptr},
+      _size{0},
+      _maxWordLength{0},
+      _capitalizable{0} {
+    try {
+        if (isCompiled(*_mappedFile)) {
+            use(_mappedFile->data(), _mappedFile->size());
+            return;
+        }
+
+        _mappedFile.reset();
+        std::ifstream in{filename};
+        _ownData = serialize(readText(in));
+        use(_ownData.data(), _ownData.size());
+    } catch (std::invalid_argument& ex) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("'%s' is not a word list: %s"), filename.c_str(),
+                      ex.what());
+        throw FileFormatError{msg};
+    }
+}
+
+Wordlist::Wordlist(const std::vector<std::uint8_t>& serialized)
+    : _mappedFile{},
+      _ownData{serialized},
+      _offsets{nullptr},
+      _text{nullptr},
+      _size{0},
+      _maxWordLength{0},
+      _capitalizable{0} {
+    try {
+        use(_ownData.data(), _ownData.size());
+    } catch (std::invalid_argument& ex) {
+        throw FileFormatError{ex.what()};
+    }
+}
+
+/**
+ * Validate the serialized list, so word lookups need no bounds checks.
+ */
+void Wordlist::use(const std::uint8_t* data, std::size_t size) {
+    if (size < HEADER_SIZE || std::memcmp(data, MAGIC, MAGIC_SIZE) != 0) {
+        throw std::invalid_argument{_("Invalid word list")};
+    }
+
+    std::uint64_t words = readUint32(data + MAGIC_SIZE);
+    std::uint64_t textSize =
+        readUint32(data + MAGIC_SIZE + sizeof(std::uint32_t));
+    if (words < MIN_WORDS ||
+        size != HEADER_SIZE + (words + 1) * sizeof(std::uint32_t) + textSize) {
+        throw std::invalid_argument{_("Invalid word list")};
+    }
+
+    _offsets = data + HEADER_SIZE;
+    _text = reinterpret_cast<const char*>(_offsets +
+                                          (words + 1) * sizeof(std::uint32_t));
+    _size = static_cast<std::uint32_t>(words);
+
+    _maxWordLength = 0;
+    _capitalizable = 0;
+    std::uint32_t previous = readUint32(_offsets);
+    if (previous != 0) {
+        throw std::invalid_argument{_("Invalid word list")};
+    }
+    for (std::uint32_t i = 1; i <= _size; i++) {
+        std::uint32_t offset = readUint32(_offsets + i * sizeof(offset));
+        if (offset <= previous || offset - previous > MAX_WORD_LENGTH ||
+            offset > textSize) {
+            throw std::invalid_argument{_("Invalid word list")};
+        }
+        if (std::islower(static_cast<unsigned char>(_text[previous]))) {
+            _capitalizable++;
+        }
+        _maxWordLength = std::max<std::size_t>(_maxWordLength,
+                                               offset - previous);
+        previous = offset;
+    }
+    if (previous != textSize) {
+        throw std::invalid_argument{_("Invalid word list")};
+    }
+}
+
+const char* Wordlist::word(std::uint32_t index, std::size_t& length) const {
+    if (index >= _size) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Index out of range: %u"), index);
+        throw std::out_of_range{msg};
+    }
+
+    auto start = readUint32(_offsets + index * sizeof(std::uint32_t));
+    auto end = readUint32(_offsets + (index + 1) * sizeof(std::uint32_t));
+    length = end - start;
+    return _text + start;
+}
+
+std::string Wordlist::word(std::uint32_t index) const {
+    std::size_t length;
+    auto start = word(index, length);
+    return std::string{start, length};
+}
+
+std::vector<std::string> Wordlist::readText(std::istream& in) {
+    std::vector<std::string> words;
+    std::unordered_set<std::string> seen;
+
+    std::string line;
+    while (std::getline(in, line)) {
+        std::string::size_type begin = 0;
+        while (begin < line.size() &&
+               std::isspace(static_cast<unsigned char>(line[begin]))) {
+            begin++;
+        }
+        if (begin == line.size() || line[begin] == '#') continue;
+
+        // Skip dice numbers followed by white space
+        auto digits = begin;
+        while (digits < line.size() &&
+               std::isdigit(static_cast<unsigned char>(line[digits]))) {
+            digits++;
+        }
+        if (digits > begin && digits < line.size() &&
+            std::isspace(static_cast<unsigned char>(line[digits]))) {
+            begin = digits;
+            while (begin < line.size() &&
+                   std::isspace(static_cast<unsigned char>(line[begin]))) {
+                begin++;
+            }
+        }
+
+        auto end = line.size();
+        while (end > begin &&
+               std::isspace(static_cast<unsigned char>(line[end - 1]))) {
+            end--;
+        }
+        if (end == begin) continue;
+
+        std::string word{line, begin, end - begin};
+        if (seen.insert(word).second) {
+            words.push_back(std::move(word));
+        }
+    }
+
+    return words;
+}
+
+std::vector<std::uint8_t> Wordlist::serialize(
+    const std::vector<std::string>& words) {
+    if (words.size() < MIN_WORDS) {
+        throw std::invalid_argument{_("Word list has too few words")};
+    }
+
+    std::vector<std::uint8_t> serialized{MAGIC, MAGIC + MAGIC_SIZE};
+    std::uint64_t textSize = 0;
+    for (const auto& word : words) {
+        if (word.empty() || word.size() > MAX_WORD_LENGTH) {
+            char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+            std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                          _("Word '%.64s' is empty or too long"),
+                          word.c_str());
+            throw std::invalid_argument{msg};
+        }
+        textSize += word.size();
+    }
+    if (words.size() >= UINT32_MAX || textSize > UINT32_MAX) {
+        throw std::invalid_argument{_("Word list is too large")};
+    }
+
+    appendUint32(serialized, static_cast<std::uint32_t>(words.size()));
+    appendUint32(serialized, static_cast<std::uint32_t>(textSize));
+
+    std::uint32_t offset = 0;
+    appendUint32(serialized, offset);
+    for (const auto& word : words) {
+        offset += word.size();
+        appendUint32(serialized, offset);
+    }
+    for (const auto& word : words) {
+        serialized.insert(serialized.end(), word.begin(), word.end());
+    }
+
+    return serialized;
+}
+
+std::shared_ptr<const Wordlist> Wordlist::loadDefault() {
+    return std::make_shared<const Wordlist>(std::string{DICTIONARYDIR} + "/" +
+                                            DEFAULT_FILENAME);
+}
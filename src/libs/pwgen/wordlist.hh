@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _WORDLIST_HH
+#define _WORDLIST_HH
+
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mappedfile.hh"
+
+namespace yapet {
+namespace pwgen {
+/**
+ * List of words passphrases are made of.
+ *
+ * Words are stored as offset-indexed array, so looking up a word by its
+ * index takes constant time, and compiled lists are used without parsing
+ * them. All numbers are 32 bit integers in On-Disk-Structure. A file
+ * consists of
+ *
+ * - the magic \c YAPETWRD,
+ * - the number of words \c n,
+ * - the size of the text holding the words,
+ * - \c n + 1 offsets into the text, where word \c i starts at offset \c i
+ *   and ends before offset \c i + 1,
+ * - the text holding the words, without separators.
+ */
+class Wordlist {
+   public:
+    static constexpr char MAGIC[] = "YAPETWRD";
+    static constexpr std::size_t MAGIC_SIZE = sizeof(MAGIC) - 1;
+    static constexpr std::size_t HEADER_SIZE =
+        MAGIC_SIZE + 2 * sizeof(std::uint32_t);
+    static constexpr std::size_t MAX_WORD_LENGTH{64};
+    static constexpr std::uint32_t MIN_WORDS{2};
+    static constexpr char DEFAULT_FILENAME[] = "passphrase.words";
+
+   private:
+    std::unique_ptr<MappedFile> _mappedFile;
+    std::vector<std::uint8_t> _ownData;
+    const std::uint8_t* _offsets;
+    const char* _text;
+    std::uint32_t _size;
+    std::size_t _maxWordLength;
+    std::uint32_t _capitalizable;
+
+    void use(const std::uint8_t* data, std::size_t size);
+
+   public:
+    /**
+     * Use the list stored in \c filename.
+     *
+     * Compiled lists are mapped into memory. Any other file is read as
+     * text list, see \c readText().
+     */
+    Wordlist(const std::string& filename);
+    /**
+     * Use the list serialized in \c serialized, as produced by \c
+     * serialize().
+     */
+    Wordlist(const std::vector<std::uint8_t>& serialized);
+
+    Wordlist(const Wordlist&) = delete;
+    Wordlist& operator=(const Wordlist&) = delete;
+
+    std::uint32_t size() const { return _size; }
+
+    /**
+     * Return the start of word \c index, and its length in \c length. The
+     * word is not zero terminated.
+     */
+    const char* word(std::uint32_t index, std::size_t& length) const;
+    std::string word(std::uint32_t index) const;
+
+    std::size_t maxWordLength() const { return _maxWordLength; }
+
+    /**
+     * Number of words starting with a lower case letter.
+     */
+    std::uint32_t capitalizable() const { return _capitalizable; }
+
+    /**
+     * Read a text list holding one word per line.
+     *
+     * Leading and trailing white space, and leading dice numbers as in the
+     * Diceware and EFF lists, are removed. Empty lines and lines starting
+     * with '#' are ignored, and only the first occurrence of a word is
+     * kept.
+     */
+    static std::vector<std::string> readText(std::istream& in);
+
+    static std::vector<std::uint8_t> serialize(
+        const std::vector<std::string>& words);
+
+    /**
+     * Load the list installed with YAPET.
+     */
+    static std::shared_ptr<const Wordlist> loadDefault();
+};
+}  // namespace pwgen
+}  // namespace yapet
+
+#endif
@@ -0,0 +1,289 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include "consts.h"
+#include "dawg.hh"
+#include "fileerror.hh"
+#include "intl.h"
+
+using namespace yapet::strength;
+
+constexpr char Dawg::MAGIC[];
+constexpr Dawg::Node Dawg::NO_NODE;
+
+namespace {
+std::uint32_t readUint32(const std::uint8_t* ptr) {
+    std::uint32_t value;
+    std::memcpy(&value, ptr, sizeof(value));
+    return yapet::toHost(value);
+}
+
+void appendUint32(std::vector<std::uint8_t>& buffer, std::uint32_t value) {
+    value = yapet::toODS(value);
+    auto bytes = reinterpret_cast<const std::uint8_t*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(value));
+}
+}  // namespace
+
+Dawg::Dawg(const std::string& filename)
+    : _mappedFile{new MappedFile{filename}},
+      _ownEdges{},
+      _edges{nullptr},
+      _numberOfEdges{0},
+      _root{NO_NODE} {
+    auto data = _mappedFile->data();
+    if (_mappedFile->size() < HEADER_SIZE ||
+        std::memcmp(data, MAGIC, MAGIC_SIZE) != 0) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("'%s' is not a dictionary"), filename.c_str());
+        throw FileFormatError{msg};
+    }
+
+    _numberOfEdges = readUint32(data + MAGIC_SIZE);
+    _root = readUint32(data + MAGIC_SIZE + sizeof(std::uint32_t));
+    if (_mappedFile->size() != HEADER_SIZE + _numberOfEdges * sizeof(Edge)) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Dictionary '%s' is truncated"), filename.c_str());
+        throw FileFormatError{msg};
+    }
+    // The header size is a multiple of the edge size, so edges are aligned.
+    _edges = reinterpret_cast<const Edge*>(data + HEADER_SIZE);
+    validate();
+}
+
+Dawg::Dawg(const std::vector<std::uint8_t>& serialized)
+    : _mappedFile{},
+      _ownEdges{},
+      _edges{nullptr},
+      _numberOfEdges{0},
+      _root{NO_NODE} {
+    if (serialized.size() < HEADER_SIZE ||
+        std::memcmp(serialized.data(), MAGIC, MAGIC_SIZE) != 0) {
+        throw FileFormatError{_("Invalid dictionary")};
+    }
+
+    _numberOfEdges = readUint32(serialized.data() + MAGIC_SIZE);
+    _root = readUint32(serialized.data() + MAGIC_SIZE + sizeof(std::uint32_t));
+    if (serialized.size() != HEADER_SIZE + _numberOfEdges * sizeof(Edge)) {
+        throw FileFormatError{_("Invalid dictionary")};
+    }
+
+    _ownEdges.resize(_numberOfEdges);
+    std::memcpy(_ownEdges.data(), serialized.data() + HEADER_SIZE,
+                _numberOfEdges * sizeof(Edge));
+    _edges = _ownEdges.data();
+    validate();
+}
+
+/**
+ * Make sure no edge points outside the edge array, so lookups need no bounds
+ * checks.
+ */
+void Dawg::validate() const {
+    if (_numberOfEdges == 0 || _root >= _numberOfEdges) {
+        throw FileFormatError{_("Invalid dictionary")};
+    }
+
+    if (_numberOfEdges == 1) {
+        // Empty DAWG
+        return;
+    }
+
+    bool lastEdgeSeen = false;
+    for (std::uint32_t index = 1; index < _numberOfEdges; index++) {
+        Edge edge = toHost(_edges[index]);
+        Node target = edge >> TARGET_SHIFT;
+        if (target >= _numberOfEdges) {
+            throw FileFormatError{_("Invalid dictionary")};
+        }
+        lastEdgeSeen = (edge & LAST_EDGE_FLAG) != 0;
+    }
+
+    if (!lastEdgeSeen) {
+        throw FileFormatError{_("Invalid dictionary")};
+    }
+}
+
+Dawg::Node Dawg::follow(Node node, std::uint8_t label, bool& terminal) const {
+    terminal = false;
+    if (node == NO_NODE) return NO_NODE;
+
+    for (Node index = node;; index++) {
+        Edge edge = toHost(_edges[index]);
+        auto edgeLabel = static_cast<std::uint8_t>(edge & LABEL_MASK);
+        if (edgeLabel == label) {
+            terminal = (edge & TERMINAL_FLAG) != 0;
+            return edge >> TARGET_SHIFT;
+        }
+        // Edges are sorted by label
+        if (edgeLabel > label || (edge & LAST_EDGE_FLAG)) {
+            return NO_NODE;
+        }
+    }
+}
+
+bool Dawg::contains(const std::string& word) const {
+    if (word.empty()) return false;
+
+    Node node = _root;
+    bool terminal = false;
+    for (auto c : word) {
+        if (node == NO_NODE) return false;
+        node = follow(node, static_cast<std::uint8_t>(c), terminal);
+        if (node == NO_NODE && !terminal) return false;
+    }
+    return terminal;
+}
+
+DawgBuilder::DawgBuilder()
+    : _nodes(1), _unchecked{}, _register{}, _previousWord{}, _finished{false} {}
+
+std::string DawgBuilder::signature(std::size_t node) const {
+    const BuilderNode& builderNode = _nodes[node];
+    std::string result(1, builderNode.final ? '1' : '0');
+    for (const auto& edge : builderNode.edges) {
+        result += static_cast<char>(edge.first);
+        result.append(reinterpret_cast<const char*>(&edge.second),
+                      sizeof(edge.second));
+    }
+    return result;
+}
+
+void DawgBuilder::minimize(std::size_t downTo) {
+    while (_unchecked.size() > downTo) {
+        UncheckedEdge unchecked = _unchecked.back();
+        _unchecked.pop_back();
+
+        auto childSignature{signature(unchecked.child)};
+        auto registered = _register.find(childSignature);
+        if (registered != _register.end()) {
+            // Nodes are only ever appended while building the path of the
+            // current word, so an equivalent node replaces the child.
+            _nodes[unchecked.parent].edges.back().second = registered->second;
+        } else {
+            _register.emplace(std::move(childSignature), unchecked.child);
+        }
+    }
+}
+
+void DawgBuilder::add(const std::string& word) {
+    if (_finished) {
+        throw std::logic_error(_("Dictionary already serialized"));
+    }
+    if (word.empty()) return;
+    if (!_previousWord.empty() && word <= _previousWord) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("'%s' is not in ascending order"), word.c_str());
+        throw std::invalid_argument(msg);
+    }
+
+    std::size_t commonPrefix = 0;
+    while (commonPrefix < word.size() && commonPrefix < _previousWord.size() &&
+           word[commonPrefix] == _previousWord[commonPrefix]) {
+        commonPrefix++;
+    }
+
+    minimize(commonPrefix);
+
+    std::size_t node = _unchecked.empty() ? 0 : _unchecked.back().child;
+    for (auto i = commonPrefix; i < word.size(); i++) {
+        _nodes.emplace_back();
+        std::size_t child = _nodes.size() - 1;
+        auto label = static_cast<std::uint8_t>(word[i]);
+        _nodes[node].edges.emplace_back(label, child);
+        _unchecked.push_back(UncheckedEdge{node, label, child});
+        node = child;
+    }
+    _nodes[node].final = true;
+    _previousWord = word;
+}
+
+std::vector<std::uint8_t> DawgBuilder::serialize() {
+    minimize(0);
+    _finished = true;
+
+    // Assign edge array positions to all reachable nodes having edges, root
+    // first. Edge 0 is reserved for NO_NODE.
+    std::vector<Dawg::Node> position(_nodes.size(), Dawg::NO_NODE);
+    std::vector<std::size_t> order;
+    std::vector<std::size_t> pending{0};
+    std::uint32_t nextPosition = 1;
+    while (!pending.empty()) {
+        auto node = pending.back();
+        pending.pop_back();
+        if (_nodes[node].edges.empty() || position[node] != Dawg::NO_NODE) {
+            continue;
+        }
+
+        position[node] = nextPosition;
+        nextPosition += _nodes[node].edges.size();
+        if (nextPosition > Dawg::MAX_NODE) {
+            throw std::length_error(_("Dictionary too large"));
+        }
+        order.push_back(node);
+        for (const auto& edge : _nodes[node].edges) {
+            pending.push_back(edge.second);
+        }
+    }
+
+    std::vector<std::uint8_t> result{Dawg::MAGIC,
+                                     Dawg::MAGIC + Dawg::MAGIC_SIZE};
+    appendUint32(result, nextPosition);
+    appendUint32(result, _nodes[0].edges.empty() ? Dawg::NO_NODE : position[0]);
+    // Edge 0
+    appendUint32(result, 0);
+
+    for (auto node : order) {
+        const auto& edges = _nodes[node].edges;
+        for (std::size_t i = 0; i < edges.size(); i++) {
+            const auto& target = _nodes[edges[i].second];
+            Dawg::Edge edge = edges[i].first;
+            if (target.final) edge |= Dawg::TERMINAL_FLAG;
+            if (i + 1 == edges.size()) edge |= Dawg::LAST_EDGE_FLAG;
+            edge |= position[edges[i].second] << Dawg::TARGET_SHIFT;
+            appendUint32(result, edge);
+        }
+    }
+
+    _nodes.clear();
+    _register.clear();
+    return result;
+}
@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _DAWG_HH
+#define _DAWG_HH
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "mappedfile.hh"
+#include "ods.hh"
+
+namespace yapet {
+namespace strength {
+/**
+ * Directed acyclic word graph, i.e. a minimized trie, stored as an array of
+ * 32 bit edges.
+ *
+ * All outgoing edges of a node are stored contiguously. An edge is stored in
+ * On-Disk-Structure and consists of
+ *
+ * - bits 0..7: the label,
+ * - bit 8: set if a word ends after this edge,
+ * - bit 9: set on the last edge of a node,
+ * - bits 10..31: the index of the first edge of the target node, or 0 if
+ *   the target node has no outgoing edges.
+ *
+ * A file consists of the magic \c YAPETDWG, the number of edges and the
+ * index of the first edge of the root node, both as 32 bit integers in
+ * On-Disk-Structure, followed by the edges. Edge 0 is unused.
+ */
+class Dawg {
+   public:
+    using Edge = std::uint32_t;
+    /**
+     * A node is identified by the index of its first edge.
+     */
+    using Node = std::uint32_t;
+
+    static constexpr Node NO_NODE = 0;
+    static constexpr Edge LABEL_MASK = 0xff;
+    static constexpr Edge TERMINAL_FLAG = 1 << 8;
+    static constexpr Edge LAST_EDGE_FLAG = 1 << 9;
+    static constexpr int TARGET_SHIFT = 10;
+    static constexpr Node MAX_NODE = (1 << (32 - TARGET_SHIFT)) - 1;
+
+    static constexpr char MAGIC[] = "YAPETDWG";
+    static constexpr std::size_t MAGIC_SIZE = sizeof(MAGIC) - 1;
+    static constexpr std::size_t HEADER_SIZE =
+        MAGIC_SIZE + 2 * sizeof(std::uint32_t);
+
+   private:
+    std::unique_ptr<MappedFile> _mappedFile;
+    std::vector<Edge> _ownEdges;
+    const Edge* _edges;
+    std::uint32_t _numberOfEdges;
+    Node _root;
+
+    void validate() const;
+
+   public:
+    /**
+     * Map the DAWG stored in \c filename.
+     */
+    Dawg(const std::string& filename);
+    /**
+     * Use the DAWG serialized in \c serialized, as produced by \c
+     * DawgBuilder::serialize().
+     */
+    Dawg(const std::vector<std::uint8_t>& serialized);
+
+    Dawg(const Dawg&) = delete;
+    Dawg& operator=(const Dawg&) = delete;
+
+    Node root() const { return _root; }
+
+    /**
+     * Follow the edge labeled \c label from \c node.
+     *
+     * @param node the node to start from. Must not be \c NO_NODE.
+     *
+     * @param label the label of the edge.
+     *
+     * @param terminal set to \c true if a word ends after the edge.
+     *
+     * @return the target node, which is \c NO_NODE if the edge does not
+     * exist or the target node has no outgoing edges. Check \c terminal in
+     * the latter case.
+     */
+    Node follow(Node node, std::uint8_t label, bool& terminal) const;
+
+    /**
+     * Call \c func(label, terminal, target) for each outgoing edge of \c
+     * node.
+     */
+    template <class Function>
+    void forEachEdge(Node node, Function func) const;
+
+    /**
+     * Return whether \c word is stored in the DAWG.
+     */
+    bool contains(const std::string& word) const;
+
+    std::uint32_t numberOfEdges() const { return _numberOfEdges; }
+};
+
+/**
+ * Build a \c Dawg from words added in strictly ascending byte order, using
+ * the incremental construction algorithm of Daciuk et al.
+ */
+class DawgBuilder {
+   private:
+    struct BuilderNode {
+        std::vector<std::pair<std::uint8_t, std::size_t>> edges;
+        bool final;
+        BuilderNode() : edges{}, final{false} {}
+    };
+
+    struct UncheckedEdge {
+        std::size_t parent;
+        std::uint8_t label;
+        std::size_t child;
+    };
+
+    std::vector<BuilderNode> _nodes;
+    std::vector<UncheckedEdge> _unchecked;
+    std::unordered_map<std::string, std::size_t> _register;
+    std::string _previousWord;
+    bool _finished;
+
+    std::string signature(std::size_t node) const;
+    void minimize(std::size_t downTo);
+
+   public:
+    DawgBuilder();
+
+    /**
+     * Add \c word, which has to be greater than the previously added word.
+     */
+    void add(const std::string& word);
+
+    /**
+     * Finish building and return the serialized DAWG. No more words can be
+     * added afterwards.
+     */
+    std::vector<std::uint8_t> serialize();
+};
+
+template <class Function>
+void Dawg::forEachEdge(Node node, Function func) const {
+    if (node == NO_NODE) return;
+
+    for (Node index = node;; index++) {
+        Edge edge = toHost(_edges[index]);
+        func(static_cast<std::uint8_t>(edge & LABEL_MASK),
+             (edge & TERMINAL_FLAG) != 0, edge >> TARGET_SHIFT);
+        if (edge & LAST_EDGE_FLAG) break;
+    }
+}
+}  // namespace strength
+}  // namespace yapet
+
+#endif
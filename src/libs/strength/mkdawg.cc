@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+// Compile word lists into the dictionary used by StrengthEstimator.
+//
+// Usage: mkdawg <output> <list>...
+//
+// Each list is a file holding one word per line, most common words first.
+// Empty lines and lines starting with '#' are ignored.
+
+#include "config.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <string>
+
+#include "dawg.hh"
+#include "strengthestimator.hh"
+
+using namespace yapet::strength;
+
+namespace {
+bool readList(const char* filename, std::uint8_t listId,
+              std::set<std::string>& entries) {
+    std::ifstream list{filename};
+    if (!list) {
+        std::cerr << "mkdawg: cannot open " << filename << std::endl;
+        return false;
+    }
+
+    std::set<std::string> seen;
+    std::uint64_t rank = 0;
+    std::string word;
+    while (std::getline(list, word)) {
+        if (!word.empty() && word.back() == '\r') word.pop_back();
+        if (word.empty() || word[0] == '#') continue;
+        for (auto& c : word) {
+            if (c >= 'A' && c <= 'Z') c = c - 'A' + 'a';
+        }
+        if (!seen.insert(word).second) continue;
+
+        rank++;
+        std::string entry{word};
+        entry.push_back('\0');
+        entry.push_back(static_cast<char>(listId));
+        entry.push_back(
+            static_cast<char>(StrengthEstimator::rankClass(rank)));
+        entries.insert(entry);
+    }
+    return true;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "Usage: mkdawg <output> <list>..." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::set<std::string> entries;
+    for (int i = 2; i < argc; i++) {
+        if (!readList(argv[i], static_cast<std::uint8_t>(i - 1), entries)) {
+            return EXIT_FAILURE;
+        }
+    }
+
+    try {
+        DawgBuilder builder;
+        for (const auto& entry : entries) {
+            builder.add(entry);
+        }
+        auto serialized = builder.serialize();
+
+        std::ofstream output{argv[1], std::ios::binary | std::ios::trunc};
+        output.write(reinterpret_cast<const char*>(serialized.data()),
+                     serialized.size());
+        output.close();
+        if (!output) {
+            std::cerr << "mkdawg: cannot write " << argv[1] << std::endl;
+            return EXIT_FAILURE;
+        }
+    } catch (std::exception& ex) {
+        std::cerr << "mkdawg: " << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,768 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#include "config.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <limits>
+
+#include "intl.h"
+#include "logger.hh"
+#include "strengthestimator.hh"
+
+using namespace yapet::strength;
+
+constexpr int StrengthEstimator::MAX_SCORE;
+constexpr int StrengthEstimator::MAX_LENGTH;
+constexpr char StrengthEstimator::DICTIONARY_FILENAME[];
+
+namespace {
+/**
+ * Additional guesses needed for each further match in a sequence of matches.
+ */
+constexpr double LOG10_MIN_GUESSES_BEFORE_GROWING_SEQUENCE = 4.0;
+/**
+ * Lower bound of guesses of a match not spanning the entire password.
+ */
+constexpr double LOG10_MIN_SUBMATCH_GUESSES_SINGLE_CHAR = 1.0;
+constexpr double LOG10_MIN_SUBMATCH_GUESSES_MULTI_CHAR = 1.69897;  // 50
+constexpr double LOG10_MIN_YEAR_SPACE = 1.30103;                   // 20
+constexpr int MIN_SPATIAL_LENGTH = 3;
+constexpr int MIN_SEQUENCE_LENGTH = 3;
+constexpr int MAX_SEQUENCE_DELTA = 5;
+constexpr int MIN_REPEAT_LENGTH = 3;
+constexpr int MAX_REPEAT_BLOCK = 16;
+constexpr int YEAR_LENGTH = 4;
+
+/**
+ * Upper bounds of the guesses of scores 0 to MAX_SCORE - 1.
+ */
+const double SCORE_THRESHOLDS[] = {std::log10(1e3 + 5), std::log10(1e6 + 5),
+                                   std::log10(1e8 + 5), std::log10(1e10 + 5)};
+
+inline double log10Add(double a, double b) {
+    if (a < b) std::swap(a, b);
+    return a + std::log10(1.0 + std::pow(10.0, b - a));
+}
+
+inline double log10Binomial(int n, int k) {
+    return (std::lgamma(n + 1.0) - std::lgamma(k + 1.0) -
+            std::lgamma(n - k + 1.0)) /
+           std::log(10.0);
+}
+
+inline double log10Factorial(int n) {
+    return std::lgamma(n + 1.0) / std::log(10.0);
+}
+
+/**
+ * log10 of the number of ways to choose at most min(a, b) out of a + b
+ * characters to vary, but at least one.
+ */
+double log10Variations(int a, int b) {
+    double result = -std::numeric_limits<double>::infinity();
+    for (int i = 1; i <= std::min(a, b); i++) {
+        result = log10Add(result, log10Binomial(a + b, i));
+    }
+    return result;
+}
+
+inline double log10Bruteforce(int length) {
+    return std::max(static_cast<double>(length),
+                    length == 1 ? std::log10(11.0) : std::log10(51.0));
+}
+
+inline bool isUpper(std::uint8_t c) { return c >= 'A' && c <= 'Z'; }
+inline bool isLower(std::uint8_t c) { return c >= 'a' && c <= 'z'; }
+inline bool isDigit(std::uint8_t c) { return c >= '0' && c <= '9'; }
+inline std::uint8_t toLower(std::uint8_t c) {
+    return isUpper(c) ? c - 'A' + 'a' : c;
+}
+
+/**
+ * Letters a character may stand for in l33t speak.
+ */
+const char* l33tLetters(std::uint8_t c) {
+    switch (c) {
+        case '4':
+        case '@':
+            return "a";
+        case '8':
+            return "b";
+        case '(':
+        case '{':
+        case '[':
+        case '<':
+            return "c";
+        case '3':
+            return "e";
+        case '6':
+        case '9':
+            return "g";
+        case '1':
+        case '|':
+            return "il";
+        case '!':
+            return "i";
+        case '7':
+            return "lt";
+        case '0':
+            return "o";
+        case '$':
+        case '5':
+            return "s";
+        case '+':
+            return "t";
+        case '%':
+            return "x";
+        case '2':
+            return "z";
+        default:
+            return "";
+    }
+}
+
+/**
+ * log10 of the number of ways the capitalization of a dictionary word may
+ * vary.
+ */
+double log10UppercaseVariations(const std::uint8_t* word, int length) {
+    int upper = 0, lower = 0;
+    for (int i = 0; i < length; i++) {
+        if (isUpper(word[i])) upper++;
+        if (isLower(word[i])) lower++;
+    }
+    if (upper == 0) return 0.0;
+    if (lower == 0) return std::log10(2.0);
+    if (upper == 1 && (isUpper(word[0]) || isUpper(word[length - 1]))) {
+        return std::log10(2.0);
+    }
+    return log10Variations(upper, lower);
+}
+
+/**
+ * The US keyboard, each row shifted by half a key against the previous one,
+ * so the keys above a key are at the same and the next column, and the keys
+ * below a key are at the previous and the same column.
+ */
+const char* const KEYBOARD[] = {"`1234567890-=", " qwertyuiop[]\\",
+                                " asdfghjkl;'", " zxcvbnm,./"};
+const char* const SHIFTED_KEYBOARD[] = {"~!@#$%^&*()_+", " QWERTYUIOP{}|",
+                                        " ASDFGHJKL:\"", " ZXCVBNM<>?"};
+constexpr int KEYBOARD_ROWS = sizeof(KEYBOARD) / sizeof(KEYBOARD[0]);
+constexpr int DIRECTIONS = 6;
+const int DIRECTION_ROW[DIRECTIONS] = {0, 0, -1, -1, 1, 1};
+const int DIRECTION_COLUMN[DIRECTIONS] = {-1, 1, 0, 1, -1, 0};
+
+class Keyboard {
+   private:
+    struct Key {
+        int row;
+        int column;
+        bool shifted;
+    };
+
+    Key _keys[256];
+    int _numberOfKeys;
+    double _averageDegree;
+    /**
+     * log10 of the guesses of a keyboard pattern by length and number of
+     * turns.
+     */
+    std::vector<std::vector<double>> _log10Guesses;
+
+    char keyAt(int row, int column) const {
+        if (row < 0 || row >= KEYBOARD_ROWS || column < 0 ||
+            column >= static_cast<int>(std::strlen(KEYBOARD[row]))) {
+            return ' ';
+        }
+        return KEYBOARD[row][column];
+    }
+
+   public:
+    Keyboard() : _keys{}, _numberOfKeys{0}, _averageDegree{0} {
+        for (auto& key : _keys) key.row = -1;
+
+        int degrees = 0;
+        for (int row = 0; row < KEYBOARD_ROWS; row++) {
+            for (int column = 0; KEYBOARD[row][column] != '\0'; column++) {
+                if (KEYBOARD[row][column] == ' ') continue;
+                _keys[static_cast<std::uint8_t>(KEYBOARD[row][column])] = {
+                    row, column, false};
+                _keys[static_cast<std::uint8_t>(
+                    SHIFTED_KEYBOARD[row][column])] = {row, column, true};
+                _numberOfKeys++;
+                for (int direction = 0; direction < DIRECTIONS; direction++) {
+                    if (keyAt(row + DIRECTION_ROW[direction],
+                              column + DIRECTION_COLUMN[direction]) != ' ') {
+                        degrees++;
+                    }
+                }
+            }
+        }
+        _averageDegree = static_cast<double>(degrees) / _numberOfKeys;
+
+        // guesses(length, turns) = sum over i = 2..length, j = 1..min(turns,
+        // i - 1) of binomial(i - 1, j - 1) * keys * degree^j
+        const double log10Keys = std::log10(_numberOfKeys);
+        const double log10Degree = std::log10(_averageDegree);
+        _log10Guesses.assign(
+            StrengthEstimator::MAX_LENGTH + 1,
+            std::vector<double>(StrengthEstimator::MAX_LENGTH + 1,
+                                -std::numeric_limits<double>::infinity()));
+        for (int turns = 1; turns <= StrengthEstimator::MAX_LENGTH; turns++) {
+            double sum = -std::numeric_limits<double>::infinity();
+            for (int i = 2; i <= StrengthEstimator::MAX_LENGTH; i++) {
+                for (int j = 1; j <= std::min(turns, i - 1); j++) {
+                    sum = log10Add(sum, log10Binomial(i - 1, j - 1) +
+                                            log10Keys + j * log10Degree);
+                }
+                _log10Guesses[i][turns] = sum;
+            }
+        }
+    }
+
+    /**
+     * The direction from key \c a to key \c b, or -1 if they are not
+     * adjacent.
+     */
+    int direction(std::uint8_t a, std::uint8_t b) const {
+        const Key& from = _keys[a];
+        const Key& to = _keys[b];
+        if (from.row < 0 || to.row < 0) return -1;
+        for (int direction = 0; direction < DIRECTIONS; direction++) {
+            if (from.row + DIRECTION_ROW[direction] == to.row &&
+                from.column + DIRECTION_COLUMN[direction] == to.column) {
+                return direction;
+            }
+        }
+        return -1;
+    }
+
+    bool isShifted(std::uint8_t c) const { return _keys[c].shifted; }
+
+    double log10Guesses(int length, int turns) const {
+        return _log10Guesses[length][turns];
+    }
+};
+
+const Keyboard& keyboard() {
+    static const Keyboard keyboard{};
+    return keyboard;
+}
+
+void addMatch(std::vector<std::vector<Match>>& matches, int begin, int end,
+              double log10Guesses, Pattern pattern) {
+    matches[end].push_back(Match{begin, end, log10Guesses, pattern});
+}
+
+const StrengthEstimator::State::Optimal* findOptimal(
+    const std::vector<StrengthEstimator::State::Optimal>& optimal,
+    int length) {
+    for (const auto& candidate : optimal) {
+        if (candidate.length == length) return &candidate;
+    }
+    return nullptr;
+}
+
+void addCandidate(std::vector<StrengthEstimator::State::Optimal>& optimal,
+                  const Match& match, int length, double log10Product,
+                  int previousLength) {
+    double log10Guesses =
+        log10Add(log10Factorial(length) + log10Product,
+                 (length - 1) * LOG10_MIN_GUESSES_BEFORE_GROWING_SEQUENCE);
+    for (const auto& competing : optimal) {
+        if (competing.length <= length &&
+            competing.log10Guesses <= log10Guesses) {
+            return;
+        }
+    }
+
+    StrengthEstimator::State::Optimal candidate{
+        length, log10Product, log10Guesses, match, previousLength};
+    for (auto& existing : optimal) {
+        if (existing.length == length) {
+            existing = candidate;
+            return;
+        }
+    }
+    optimal.push_back(candidate);
+}
+}  // namespace
+
+double Strength::bits() const { return log10Guesses / std::log10(2.0); }
+
+StrengthEstimator::State::State() : _password{}, _matches{}, _optimal{} {}
+
+StrengthEstimator::State::~State() { clear(); }
+
+void StrengthEstimator::State::clear() {
+    if (!_password.empty()) {
+        std::memset(_password.data(), 0, _password.size());
+    }
+    _password.clear();
+    _matches.clear();
+    _optimal.clear();
+}
+
+StrengthEstimator::StrengthEstimator(std::shared_ptr<const Dawg> dictionary)
+    : _dictionary{dictionary}, _referenceYear{2000} {
+    std::time_t now = std::time(nullptr);
+    std::tm tm;
+    if (localtime_r(&now, &tm) != nullptr) {
+        _referenceYear = tm.tm_year + 1900;
+    }
+}
+
+int StrengthEstimator::wordRankClass(Dawg::Node node) const {
+    int result = -1;
+    _dictionary->forEachEdge(
+        node, [this, &result](std::uint8_t, bool, Dawg::Node list) {
+            _dictionary->forEachEdge(
+                list, [&result](std::uint8_t rankClass, bool, Dawg::Node) {
+                    if (result < 0 || rankClass < result) result = rankClass;
+                });
+        });
+    return result;
+}
+
+void StrengthEstimator::dictionaryMatches(
+    const std::uint8_t* password, int length, int fromEnd,
+    std::vector<std::vector<Match>>& matches) const {
+    if (!_dictionary) return;
+
+    struct Step {
+        Dawg::Node node;
+        int position;
+        int substitutions;
+        std::uint32_t substituted;
+    };
+    std::vector<Step> stack;
+
+    for (int begin = 0; begin < length; begin++) {
+        stack.push_back(Step{_dictionary->root(), begin, 0, 0});
+        while (!stack.empty()) {
+            Step step = stack.back();
+            stack.pop_back();
+            if (step.position >= length) continue;
+
+            std::uint8_t c = password[step.position];
+            auto proceed = [&](std::uint8_t label, bool substitution) {
+                bool terminal;
+                Dawg::Node node = _dictionary->follow(step.node, label,
+                                                      terminal);
+                if (node == Dawg::NO_NODE) return;
+
+                Step next{node, step.position + 1, step.substitutions,
+                          step.substituted};
+                if (substitution) {
+                    next.substitutions++;
+                    next.substituted |= 1u << (label - 'a');
+                }
+
+                int end = step.position;
+                Dawg::Node wordEnd = _dictionary->follow(node, 0, terminal);
+                if (end >= fromEnd && wordEnd != Dawg::NO_NODE) {
+                    int rankClass = wordRankClass(wordEnd);
+                    double log10Guesses =
+                        rankClass / 4.0 * std::log10(2.0) +
+                        log10UppercaseVariations(password + begin,
+                                                 end - begin + 1);
+                    if (next.substitutions > 0) {
+                        int unsubstituted = 0;
+                        for (int i = begin; i <= end; i++) {
+                            std::uint8_t l = toLower(password[i]);
+                            if (isLower(l) &&
+                                (next.substituted & (1u << (l - 'a')))) {
+                                unsubstituted++;
+                            }
+                        }
+                        log10Guesses +=
+                            unsubstituted == 0
+                                ? std::log10(2.0)
+                                : log10Variations(next.substitutions,
+                                                  unsubstituted);
+                    }
+                    addMatch(matches, begin, end, log10Guesses,
+                             Pattern::DICTIONARY);
+                }
+                stack.push_back(next);
+            };
+
+            proceed(toLower(c), false);
+            for (const char* l = l33tLetters(c); *l != '\0'; l++) {
+                proceed(static_cast<std::uint8_t>(*l), true);
+            }
+        }
+    }
+}
+
+void StrengthEstimator::reversedDictionaryMatches(
+    const std::uint8_t* password, int length, int fromEnd,
+    std::vector<std::vector<Match>>& matches) const {
+    if (!_dictionary) return;
+
+    for (int end = fromEnd; end < length; end++) {
+        Dawg::Node node = _dictionary->root();
+        for (int begin = end; begin >= 0; begin--) {
+            bool terminal;
+            node = _dictionary->follow(node, toLower(password[begin]),
+                                       terminal);
+            if (node == Dawg::NO_NODE) break;
+            if (begin == end) continue;
+
+            Dawg::Node wordEnd = _dictionary->follow(node, 0, terminal);
+            if (wordEnd == Dawg::NO_NODE) continue;
+            double log10Guesses =
+                wordRankClass(wordEnd) / 4.0 * std::log10(2.0) +
+                log10UppercaseVariations(password + begin, end - begin + 1) +
+                std::log10(2.0);
+            addMatch(matches, begin, end, log10Guesses,
+                     Pattern::REVERSED_DICTIONARY);
+        }
+    }
+}
+
+void StrengthEstimator::spatialMatches(
+    const std::uint8_t* password, int length, int fromEnd,
+    std::vector<std::vector<Match>>& matches) const {
+    const Keyboard& kbd = keyboard();
+
+    for (int end = std::max(fromEnd, MIN_SPATIAL_LENGTH - 1); end < length;
+         end++) {
+        int lastDirection = kbd.direction(password[end - 1], password[end]);
+        if (lastDirection < 0) continue;
+
+        int turns = 1;
+        int shifted = kbd.isShifted(password[end]) ? 1 : 0;
+        int direction = lastDirection;
+        for (int begin = end - 1; begin >= 0; begin--) {
+            if (begin < end - 1) {
+                int d = kbd.direction(password[begin], password[begin + 1]);
+                if (d < 0) break;
+                if (d != direction) turns++;
+                direction = d;
+            }
+            if (kbd.isShifted(password[begin])) shifted++;
+
+            int matchLength = end - begin + 1;
+            if (matchLength < MIN_SPATIAL_LENGTH) continue;
+
+            double log10Guesses = kbd.log10Guesses(matchLength, turns);
+            if (shifted > 0) {
+                int unshifted = matchLength - shifted;
+                log10Guesses += unshifted == 0
+                                    ? std::log10(2.0)
+                                    : log10Variations(shifted, unshifted);
+            }
+            addMatch(matches, begin, end, log10Guesses, Pattern::SPATIAL);
+        }
+    }
+}
+
+void StrengthEstimator::repeatMatches(
+    const std::uint8_t* password, int length, int fromEnd,
+    std::vector<std::vector<Match>>& matches) const {
+    for (int end = std::max(fromEnd, MIN_REPEAT_LENGTH - 1); end < length;
+         end++) {
+        // Repeated characters
+        int begin = end;
+        while (begin > 0 && password[begin - 1] == password[end]) begin--;
+        for (int b = end - MIN_REPEAT_LENGTH + 1; b >= begin; b--) {
+            addMatch(matches, b, end,
+                     std::log10(11.0) + std::log10(end - b + 1.0),
+                     Pattern::REPEAT);
+        }
+
+        // Repeated blocks of characters, the block estimated on its own
+        for (int block = 2; block <= MAX_REPEAT_BLOCK && 2 * block <= end + 1;
+             block++) {
+            int periodic = block;
+            while (end - periodic >= 0 && password[end - periodic] ==
+                                              password[end - periodic + block]) {
+                periodic++;
+            }
+            int repetitions = periodic / block;
+            if (repetitions < 2) continue;
+
+            int first = end - repetitions * block + 1;
+            bool single = true;
+            for (int i = first + 1; i < first + block; i++) {
+                single = single && password[i] == password[first];
+            }
+            if (single) continue;
+
+            State blockState;
+            Strength blockStrength = run(password + first, block, blockState);
+            addMatch(matches, first, end,
+                     blockStrength.log10Guesses + std::log10(repetitions),
+                     Pattern::REPEAT);
+        }
+    }
+}
+
+void StrengthEstimator::sequenceMatches(
+    const std::uint8_t* password, int length, int fromEnd,
+    std::vector<std::vector<Match>>& matches) const {
+    auto characterClass = [](std::uint8_t c) {
+        return isLower(c) ? 1 : isUpper(c) ? 2 : isDigit(c) ? 3 : 0;
+    };
+
+    for (int end = std::max(fromEnd, MIN_SEQUENCE_LENGTH - 1); end < length;
+         end++) {
+        int cls = characterClass(password[end]);
+        int delta = password[end] - password[end - 1];
+        if (cls == 0 || delta == 0 || std::abs(delta) > MAX_SEQUENCE_DELTA ||
+            characterClass(password[end - 1]) != cls) {
+            continue;
+        }
+
+        for (int begin = end - 2; begin >= 0; begin--) {
+            if (characterClass(password[begin]) != cls ||
+                password[begin + 1] - password[begin] != delta) {
+                break;
+            }
+
+            std::uint8_t start = password[begin];
+            double base = std::strchr("aAzZ019", start) != nullptr
+                              ? 4.0
+                              : isDigit(start) ? 10.0 : 26.0;
+            if (delta < 0) base *= 2.0;
+            addMatch(matches, begin, end,
+                     std::log10(base * (end - begin + 1)), Pattern::SEQUENCE);
+        }
+    }
+}
+
+void StrengthEstimator::yearMatches(
+    const std::uint8_t* password, int length, int fromEnd,
+    std::vector<std::vector<Match>>& matches) const {
+    for (int end = std::max(fromEnd, YEAR_LENGTH - 1); end < length; end++) {
+        int begin = end - YEAR_LENGTH + 1;
+        int year = 0;
+        bool digits = true;
+        for (int i = begin; i <= end && digits; i++) {
+            digits = isDigit(password[i]);
+            year = year * 10 + (password[i] - '0');
+        }
+        if (!digits || year < 1900 || year > 2099) continue;
+
+        addMatch(matches, begin, end,
+                 std::max(std::log10(std::abs(year - _referenceYear) + 1.0),
+                          LOG10_MIN_YEAR_SPACE),
+                 Pattern::YEAR);
+    }
+}
+
+void StrengthEstimator::collectMatches(
+    const std::uint8_t* password, int length, int fromEnd,
+    std::vector<std::vector<Match>>& matches) const {
+    dictionaryMatches(password, length, fromEnd, matches);
+    reversedDictionaryMatches(password, length, fromEnd, matches);
+    spatialMatches(password, length, fromEnd, matches);
+    repeatMatches(password, length, fromEnd, matches);
+    sequenceMatches(password, length, fromEnd, matches);
+    yearMatches(password, length, fromEnd, matches);
+}
+
+void StrengthEstimator::optimize(int length, int fromEnd, State& state) const {
+    for (int end = fromEnd; end < length; end++) {
+        auto& optimal = state._optimal[end];
+        optimal.clear();
+
+        auto extend = [&state, &optimal](const Match& match,
+                                         double log10Guesses) {
+            if (match.begin == 0) {
+                addCandidate(optimal, match, 1, log10Guesses, 0);
+                return;
+            }
+            for (const auto& previous : state._optimal[match.begin - 1]) {
+                if (match.pattern == Pattern::BRUTEFORCE &&
+                    previous.match.pattern == Pattern::BRUTEFORCE) {
+                    continue;
+                }
+                addCandidate(optimal, match, previous.length + 1,
+                             previous.log10Product + log10Guesses,
+                             previous.length);
+            }
+        };
+
+        for (const auto& match : state._matches[end]) {
+            // The lower bound is not applied to matches spanning the entire
+            // password, see run().
+            double minimum = match.begin == end
+                                 ? LOG10_MIN_SUBMATCH_GUESSES_SINGLE_CHAR
+                                 : LOG10_MIN_SUBMATCH_GUESSES_MULTI_CHAR;
+            extend(match, std::max(match.log10Guesses, minimum));
+        }
+        for (int begin = 0; begin <= end; begin++) {
+            Match bruteforce{begin, end, log10Bruteforce(end - begin + 1),
+                             Pattern::BRUTEFORCE};
+            extend(bruteforce, bruteforce.log10Guesses);
+        }
+    }
+}
+
+Strength StrengthEstimator::run(const std::uint8_t* password, int length,
+                                State& state) const {
+    int analyzed = std::min(length, MAX_LENGTH);
+
+    int common = 0;
+    int previous = static_cast<int>(state._password.size());
+    while (common < analyzed && common < previous &&
+           state._password[common] == password[common]) {
+        common++;
+    }
+
+    if (!state._password.empty()) {
+        std::memset(state._password.data(), 0, state._password.size());
+    }
+    state._password.assign(password, password + analyzed);
+    state._matches.resize(analyzed);
+    state._optimal.resize(analyzed);
+    for (int end = common; end < analyzed; end++) {
+        state._matches[end].clear();
+    }
+
+    collectMatches(password, analyzed, common, state._matches);
+    optimize(analyzed, common, state);
+
+    if (analyzed == 0) {
+        return Strength{0.0, 0, Pattern::BRUTEFORCE};
+    }
+
+    const int last = analyzed - 1;
+    Strength strength{std::numeric_limits<double>::infinity(), 0,
+                      Pattern::BRUTEFORCE};
+    const State::Optimal* best = nullptr;
+    for (const auto& optimal : state._optimal[last]) {
+        if (optimal.log10Guesses < strength.log10Guesses) {
+            strength.log10Guesses = optimal.log10Guesses;
+            best = &optimal;
+        }
+    }
+    for (const auto& match : state._matches[last]) {
+        if (match.begin != 0) continue;
+        double log10Guesses = log10Add(match.log10Guesses, 0.0);
+        if (log10Guesses < strength.log10Guesses) {
+            strength.log10Guesses = log10Guesses;
+            strength.pattern = match.pattern;
+            best = nullptr;
+        }
+    }
+
+    // The pattern of the longest match in the optimal sequence
+    int longest = 0;
+    for (int end = last; best != nullptr;) {
+        const Match& match = best->match;
+        if (match.pattern != Pattern::BRUTEFORCE &&
+            match.end - match.begin + 1 > longest) {
+            longest = match.end - match.begin + 1;
+            strength.pattern = match.pattern;
+        }
+        end = match.begin - 1;
+        best = end < 0 ? nullptr
+                       : findOptimal(state._optimal[end], best->previousLength);
+    }
+
+    strength.log10Guesses += length - analyzed;
+    while (strength.score < MAX_SCORE &&
+           strength.log10Guesses >= SCORE_THRESHOLDS[strength.score]) {
+        strength.score++;
+    }
+    return strength;
+}
+
+Strength StrengthEstimator::estimate(const std::uint8_t* password,
+                                     int length) const {
+    State state;
+    return run(password, length, state);
+}
+
+Strength StrengthEstimator::estimate(const std::string& password) const {
+    return estimate(reinterpret_cast<const std::uint8_t*>(password.data()),
+                    static_cast<int>(password.size()));
+}
+
+Strength StrengthEstimator::estimate(const std::string& password,
+                                     State& state) const {
+    return run(reinterpret_cast<const std::uint8_t*>(password.data()),
+               static_cast<int>(password.size()), state);
+}
+
+std::shared_ptr<const Dawg> StrengthEstimator::loadDefaultDictionary() {
+    std::string filename{std::string{DICTIONARYDIR} + "/" +
+                         DICTIONARY_FILENAME};
+    try {
+        return std::make_shared<const Dawg>(filename);
+    } catch (std::exception& ex) {
+        LOG_MESSAGE(std::string{__func__} + ": cannot load " + filename +
+                    ": " + ex.what());
+        return std::shared_ptr<const Dawg>{};
+    }
+}
+
+const char* StrengthEstimator::scoreDescription(int score) {
+    switch (score) {
+        case 0:
+            return _("very weak");
+        case 1:
+            return _("weak");
+        case 2:
+            return _("fair");
+        case 3:
+            return _("good");
+        default:
+            return _("strong");
+    }
+}
+
+const char* StrengthEstimator::patternDescription(Pattern pattern) {
+    switch (pattern) {
+        case Pattern::DICTIONARY:
+            return _("common word");
+        case Pattern::REVERSED_DICTIONARY:
+            return _("reversed common word");
+        case Pattern::SPATIAL:
+            return _("keyboard pattern");
+        case Pattern::REPEAT:
+            return _("repetition");
+        case Pattern::SEQUENCE:
+            return _("character sequence");
+        case Pattern::YEAR:
+            return _("year");
+        default:
+            return _("no pattern");
+    }
+}
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _STRENGTHESTIMATOR_HH
+#define _STRENGTHESTIMATOR_HH
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "dawg.hh"
+
+namespace yapet {
+namespace strength {
+/**
+ * Kind of pattern a part of a password has been recognized as.
+ */
+enum class Pattern {
+    BRUTEFORCE,
+    DICTIONARY,
+    REVERSED_DICTIONARY,
+    SPATIAL,
+    REPEAT,
+    SEQUENCE,
+    YEAR
+};
+
+/**
+ * A part of the password, <tt>[begin, end]</tt>, recognized as pattern,
+ * and the decadic logarithm of the number of guesses needed to find it.
+ */
+struct Match {
+    int begin;
+    int end;
+    double log10Guesses;
+    Pattern pattern;
+};
+
+/**
+ * The estimated strength of a password.
+ */
+struct Strength {
+    /**
+     * Decadic logarithm of the number of guesses needed to find the password.
+     */
+    double log10Guesses;
+    /**
+     * Score from 0 (too guessable) to \c MAX_SCORE (very unguessable).
+     */
+    int score;
+    /**
+     * The most prominent pattern found in the password, \c BRUTEFORCE if
+     * there was none.
+     */
+    Pattern pattern;
+
+    /**
+     * The strength expressed as bits of entropy.
+     */
+    double bits() const;
+};
+
+/**
+ * Estimate the strength of passwords the way zxcvbn does.
+ *
+ * The password is broken down into matches of known patterns: words from the
+ * dictionary, also reversed or with l33t substitutions and capitalized,
+ * keyboard patterns, repeats, sequences and years. Each match is assigned
+ * the number of guesses an attacker needs to find it, and the sequence of
+ * matches, filled with brute force matches, minimizing the total number of
+ * guesses is the estimate.
+ *
+ * The dictionary is a \c Dawg whose words are stored followed by a zero
+ * byte, a byte identifying the source list and a byte holding the rank
+ * class of the word in the list. See \c rankClass().
+ */
+class StrengthEstimator {
+   public:
+    static constexpr int MAX_SCORE = 4;
+    /**
+     * Only the first \c MAX_LENGTH characters are searched for patterns, the
+     * remaining are accounted for as brute force guesses.
+     */
+    static constexpr int MAX_LENGTH = 100;
+    static constexpr char DICTIONARY_FILENAME[] = "strength.dawg";
+
+    /**
+     * Holds the matches and the optimal match sequences of each end
+     * position, so they can be reused for passwords sharing a prefix.
+     */
+    class State;
+
+   private:
+    std::shared_ptr<const Dawg> _dictionary;
+    int _referenceYear;
+
+    void dictionaryMatches(const std::uint8_t* password, int length,
+                           int fromEnd,
+                           std::vector<std::vector<Match>>& matches) const;
+    void reversedDictionaryMatches(
+        const std::uint8_t* password, int length, int fromEnd,
+        std::vector<std::vector<Match>>& matches) const;
+    void spatialMatches(const std::uint8_t* password, int length, int fromEnd,
+                        std::vector<std::vector<Match>>& matches) const;
+    void repeatMatches(const std::uint8_t* password, int length, int fromEnd,
+                       std::vector<std::vector<Match>>& matches) const;
+    void sequenceMatches(const std::uint8_t* password, int length,
+                         int fromEnd,
+                         std::vector<std::vector<Match>>& matches) const;
+    void yearMatches(const std::uint8_t* password, int length, int fromEnd,
+                     std::vector<std::vector<Match>>& matches) const;
+
+    int wordRankClass(Dawg::Node node) const;
+
+    void collectMatches(const std::uint8_t* password, int length, int fromEnd,
+                        std::vector<std::vector<Match>>& matches) const;
+    void optimize(int length, int fromEnd, State& state) const;
+    Strength run(const std::uint8_t* password, int length,
+                 State& state) const;
+
+   public:
+    /**
+     * @param dictionary the dictionary to use. Without dictionary, no
+     * dictionary matches are found.
+     */
+    StrengthEstimator(std::shared_ptr<const Dawg> dictionary = {});
+
+    Strength estimate(const std::uint8_t* password, int length) const;
+    Strength estimate(const std::string& password) const;
+
+    /**
+     * Estimate \c password, reusing the work done for the password
+     * previously estimated with \c state.
+     */
+    Strength estimate(const std::string& password, State& state) const;
+
+    /**
+     * The rank class stored in the dictionary for a word of rank \c rank,
+     * counted from 1. A word of rank class \c c takes <tt>2^(c/4)</tt>
+     * guesses.
+     */
+    static std::uint8_t rankClass(std::uint64_t rank) {
+        if (rank <= 1) return 0;
+        return static_cast<std::uint8_t>(std::min(
+            std::round(4.0 * std::log2(static_cast<double>(rank))), 255.0));
+    }
+
+    /**
+     * Load the dictionary installed with YAPET. Returns an empty pointer if
+     * it cannot be loaded.
+     */
+    static std::shared_ptr<const Dawg> loadDefaultDictionary();
+
+    static const char* scoreDescription(int score);
+    static const char* patternDescription(Pattern pattern);
+};
+
+class StrengthEstimator::State {
+    friend class StrengthEstimator;
+
+   public:
+    struct Optimal {
+        int length;
+        double log10Product;
+        double log10Guesses;
+        Match match;
+        int previousLength;
+    };
+
+   private:
+    std::vector<std::uint8_t> _password;
+    std::vector<std::vector<Match>> _matches;
+    std::vector<std::vector<Optimal>> _optimal;
+
+   public:
+    State();
+    ~State();
+    State(const State&) = delete;
+    State& operator=(const State&) = delete;
+
+    void clear();
+};
+}  // namespace strength
+}  // namespace yapet
+
+#endif
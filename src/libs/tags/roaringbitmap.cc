@@ -0,0 +1,349 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <algorithm>
+#include <bitset>
+#include <iterator>
+
+#include "roaringbitmap.hh"
+
+using namespace yapet;
+
+constexpr std::uint32_t RoaringBitmap::ARRAY_MAX;
+constexpr std::uint32_t RoaringBitmap::BITMAP_WORDS;
+
+namespace {
+inline std::uint16_t highBits(std::uint32_t value) {
+    return static_cast<std::uint16_t>(value >> 16);
+}
+
+inline std::uint16_t lowBits(std::uint32_t value) {
+    return static_cast<std::uint16_t>(value & 0xffff);
+}
+
+inline std::uint32_t popcount(std::uint64_t word) {
+    return static_cast<std::uint32_t>(std::bitset<64>{word}.count());
+}
+
+inline bool testBit(const std::vector<std::uint64_t>& bitmap,
+                    std::uint16_t value) {
+    return (bitmap[value / 64] >> (value % 64)) & 1;
+}
+}  // namespace
+
+bool RoaringBitmap::Container::contains(std::uint16_t value) const {
+    if (isBitmap()) return testBit(bitmap, value);
+    return std::binary_search(array.begin(), array.end(), value);
+}
+
+bool RoaringBitmap::Container::add(std::uint16_t value) {
+    if (isBitmap()) {
+        std::uint64_t mask = std::uint64_t{1} << (value % 64);
+        if (bitmap[value / 64] & mask) return false;
+        bitmap[value / 64] |= mask;
+        cardinality++;
+        return true;
+    }
+
+    auto position = std::lower_bound(array.begin(), array.end(), value);
+    if (position != array.end() && *position == value) return false;
+    array.insert(position, value);
+    cardinality++;
+    normalize();
+    return true;
+}
+
+bool RoaringBitmap::Container::remove(std::uint16_t value) {
+    if (isBitmap()) {
+        std::uint64_t mask = std::uint64_t{1} << (value % 64);
+        if (!(bitmap[value / 64] & mask)) return false;
+        bitmap[value / 64] &= ~mask;
+        cardinality--;
+        normalize();
+        return true;
+    }
+
+    auto position = std::lower_bound(array.begin(), array.end(), value);
+    if (position == array.end() || *position != value) return false;
+    array.erase(position);
+    cardinality--;
+    return true;
+}
+
+void RoaringBitmap::Container::normalize() {
+    if (isBitmap() && cardinality <= ARRAY_MAX) {
+        std::vector<std::uint16_t> values;
+        values.reserve(cardinality);
+        for (std::uint32_t word = 0; word < BITMAP_WORDS; word++) {
+            std::uint64_t bits = bitmap[word];
+            for (std::uint32_t bit = 0; bits != 0; bit++, bits >>= 1) {
+                if (bits & 1) {
+                    values.push_back(static_cast<std::uint16_t>(word * 64 + bit));
+                }
+            }
+        }
+        array.swap(values);
+        std::vector<std::uint64_t>{}.swap(bitmap);
+    } else if (!isBitmap() && cardinality > ARRAY_MAX) {
+        bitmap.assign(BITMAP_WORDS, 0);
+        for (auto value : array) {
+            bitmap[value / 64] |= std::uint64_t{1} << (value % 64);
+        }
+        std::vector<std::uint16_t>{}.swap(array);
+    }
+}
+
+std::vector<RoaringBitmap::Container>::iterator RoaringBitmap::findContainer(
+    std::uint16_t key) {
+    return std::lower_bound(
+        _containers.begin(), _containers.end(), key,
+        [](const Container& c, std::uint16_t k) { return c.key < k; });
+}
+
+std::vector<RoaringBitmap::Container>::const_iterator
+RoaringBitmap::findContainer(std::uint16_t key) const {
+    return std::lower_bound(
+        _containers.begin(), _containers.end(), key,
+        [](const Container& c, std::uint16_t k) { return c.key < k; });
+}
+
+RoaringBitmap::Container RoaringBitmap::intersect(const Container& a,
+                                                  const Container& b) {
+    Container result{a.key, 0, {}, {}};
+
+    if (a.isBitmap() && b.isBitmap()) {
+        result.bitmap.resize(BITMAP_WORDS);
+        for (std::uint32_t word = 0; word < BITMAP_WORDS; word++) {
+            result.bitmap[word] = a.bitmap[word] & b.bitmap[word];
+            result.cardinality += popcount(result.bitmap[word]);
+        }
+    } else if (a.isBitmap() || b.isBitmap()) {
+        const Container& array = a.isBitmap() ? b : a;
+        const Container& bitmap = a.isBitmap() ? a : b;
+        for (auto value : array.array) {
+            if (testBit(bitmap.bitmap, value)) result.array.push_back(value);
+        }
+        result.cardinality = result.array.size();
+    } else {
+        std::set_intersection(a.array.begin(), a.array.end(), b.array.begin(),
+                              b.array.end(), std::back_inserter(result.array));
+        result.cardinality = result.array.size();
+    }
+
+    result.normalize();
+    return result;
+}
+
+RoaringBitmap::Container RoaringBitmap::unite(const Container& a,
+                                              const Container& b) {
+    Container result{a.key, 0, {}, {}};
+
+    if (!a.isBitmap() && !b.isBitmap() &&
+        a.cardinality + b.cardinality <= ARRAY_MAX) {
+        std::set_union(a.array.begin(), a.array.end(), b.array.begin(),
+                       b.array.end(), std::back_inserter(result.array));
+        result.cardinality = result.array.size();
+        return result;
+    }
+
+    result.bitmap.assign(BITMAP_WORDS, 0);
+    for (const Container* source : {&a, &b}) {
+        if (source->isBitmap()) {
+            for (std::uint32_t word = 0; word < BITMAP_WORDS; word++) {
+                result.bitmap[word] |= source->bitmap[word];
+            }
+        } else {
+            for (auto value : source->array) {
+                result.bitmap[value / 64] |= std::uint64_t{1} << (value % 64);
+            }
+        }
+    }
+    for (auto word : result.bitmap) {
+        result.cardinality += popcount(word);
+    }
+
+    result.normalize();
+    return result;
+}
+
+RoaringBitmap::Container RoaringBitmap::subtract(const Container& a,
+                                                 const Container& b) {
+    Container result{a.key, 0, {}, {}};
+
+    if (a.isBitmap()) {
+        result.bitmap = a.bitmap;
+        if (b.isBitmap()) {
+            for (std::uint32_t word = 0; word < BITMAP_WORDS; word++) {
+                result.bitmap[word] &= ~b.bitmap[word];
+            }
+        } else {
+            for (auto value : b.array) {
+                result.bitmap[value / 64] &= ~(std::uint64_t{1} << (value % 64));
+            }
+        }
+        for (auto word : result.bitmap) {
+            result.cardinality += popcount(word);
+        }
+    } else if (b.isBitmap()) {
+        for (auto value : a.array) {
+            if (!testBit(b.bitmap, value)) result.array.push_back(value);
+        }
+        result.cardinality = result.array.size();
+    } else {
+        std::set_difference(a.array.begin(), a.array.end(), b.array.begin(),
+                            b.array.end(), std::back_inserter(result.array));
+        result.cardinality = result.array.size();
+    }
+
+    result.normalize();
+    return result;
+}
+
+RoaringBitmap::RoaringBitmap() : _containers{} {}
+
+bool RoaringBitmap::add(std::uint32_t value) {
+    auto container = findContainer(highBits(value));
+    if (container == _containers.end() || container->key != highBits(value)) {
+        container = _containers.insert(
+            container, Container{highBits(value), 0, {}, {}});
+    }
+    return container->add(lowBits(value));
+}
+
+bool RoaringBitmap::remove(std::uint32_t value) {
+    auto container = findContainer(highBits(value));
+    if (container == _containers.end() || container->key != highBits(value)) {
+        return false;
+    }
+
+    bool removed = container->remove(lowBits(value));
+    if (container->cardinality == 0) {
+        _containers.erase(container);
+    }
+    return removed;
+}
+
+bool RoaringBitmap::contains(std::uint32_t value) const {
+    auto container = findContainer(highBits(value));
+    return container != _containers.end() &&
+           container->key == highBits(value) &&
+           container->contains(lowBits(value));
+}
+
+std::uint64_t RoaringBitmap::cardinality() const {
+    std::uint64_t result = 0;
+    for (const auto& container : _containers) {
+        result += container.cardinality;
+    }
+    return result;
+}
+
+RoaringBitmap RoaringBitmap::operator&(const RoaringBitmap& other) const {
+    RoaringBitmap result;
+    auto a = _containers.begin();
+    auto b = other._containers.begin();
+    while (a != _containers.end() && b != other._containers.end()) {
+        if (a->key < b->key) {
+            ++a;
+        } else if (b->key < a->key) {
+            ++b;
+        } else {
+            Container container{intersect(*a, *b)};
+            if (container.cardinality > 0) {
+                result._containers.push_back(std::move(container));
+            }
+            ++a;
+            ++b;
+        }
+    }
+    return result;
+}
+
+RoaringBitmap RoaringBitmap::operator|(const RoaringBitmap& other) const {
+    RoaringBitmap result;
+    auto a = _containers.begin();
+    auto b = other._containers.begin();
+    while (a != _containers.end() || b != other._containers.end()) {
+        if (b == other._containers.end() ||
+            (a != _containers.end() && a->key < b->key)) {
+            result._containers.push_back(*a++);
+        } else if (a == _containers.end() || b->key < a->key) {
+            result._containers.push_back(*b++);
+        } else {
+            result._containers.push_back(unite(*a++, *b++));
+        }
+    }
+    return result;
+}
+
+RoaringBitmap RoaringBitmap::operator-(const RoaringBitmap& other) const {
+    RoaringBitmap result;
+    auto b = other._containers.begin();
+    for (const auto& a : _containers) {
+        while (b != other._containers.end() && b->key < a.key) ++b;
+
+        if (b == other._containers.end() || b->key != a.key) {
+            result._containers.push_back(a);
+            continue;
+        }
+
+        Container container{subtract(a, *b)};
+        if (container.cardinality > 0) {
+            result._containers.push_back(std::move(container));
+        }
+    }
+    return result;
+}
+
+bool RoaringBitmap::operator==(const RoaringBitmap& other) const {
+    if (_containers.size() != other._containers.size()) return false;
+
+    for (std::size_t i = 0; i < _containers.size(); i++) {
+        const Container& a = _containers[i];
+        const Container& b = other._containers[i];
+        // Containers are normalized, so equal containers are of the same
+        // kind.
+        if (a.key != b.key || a.cardinality != b.cardinality ||
+            a.array != b.array || a.bitmap != b.bitmap) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<std::uint32_t> RoaringBitmap::values() const {
+    std::vector<std::uint32_t> result;
+    result.reserve(cardinality());
+    forEach([&result](std::uint32_t value) { result.push_back(value); });
+    return result;
+}
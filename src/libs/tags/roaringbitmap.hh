@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _ROARINGBITMAP_HH
+#define _ROARINGBITMAP_HH
+
+#include <cstdint>
+#include <vector>
+
+namespace yapet {
+/**
+ * Compressed bitmap of 32 bit integers in the manner of Roaring bitmaps.
+ *
+ * Values are partitioned by their upper 16 bits into containers. A
+ * container holding at most \c ARRAY_MAX values stores them as sorted
+ * array, a container holding more as bitmap of 2^16 bits. Set operations
+ * are performed container by container, choosing the algorithm by the
+ * kinds of the containers involved.
+ */
+class RoaringBitmap {
+   public:
+    static constexpr std::uint32_t ARRAY_MAX = 4096;
+    static constexpr std::uint32_t BITMAP_WORDS = (1 << 16) / 64;
+
+   private:
+    struct Container {
+        std::uint16_t key;
+        std::uint32_t cardinality;
+        /**
+         * Sorted values, if the container is an array container.
+         */
+        std::vector<std::uint16_t> array;
+        /**
+         * \c BITMAP_WORDS words, if the container is a bitmap container.
+         */
+        std::vector<std::uint64_t> bitmap;
+
+        bool isBitmap() const { return !bitmap.empty(); }
+        bool contains(std::uint16_t value) const;
+        bool add(std::uint16_t value);
+        bool remove(std::uint16_t value);
+        /**
+         * Convert to the kind of container appropriate for the cardinality.
+         */
+        void normalize();
+    };
+
+    std::vector<Container> _containers;
+
+    std::vector<Container>::iterator findContainer(std::uint16_t key);
+    std::vector<Container>::const_iterator findContainer(
+        std::uint16_t key) const;
+
+    static Container intersect(const Container& a, const Container& b);
+    static Container unite(const Container& a, const Container& b);
+    static Container subtract(const Container& a, const Container& b);
+
+   public:
+    RoaringBitmap();
+
+    /**
+     * @return \c true if \c value has been added, \c false if it was
+     * already contained.
+     */
+    bool add(std::uint32_t value);
+    /**
+     * @return \c true if \c value has been removed, \c false if it was not
+     * contained.
+     */
+    bool remove(std::uint32_t value);
+    bool contains(std::uint32_t value) const;
+
+    std::uint64_t cardinality() const;
+    bool empty() const { return _containers.empty(); }
+    void clear() { _containers.clear(); }
+
+    RoaringBitmap operator&(const RoaringBitmap& other) const;
+    RoaringBitmap operator|(const RoaringBitmap& other) const;
+    /**
+     * The values contained in this bitmap but not in \c other.
+     */
+    RoaringBitmap operator-(const RoaringBitmap& other) const;
+
+    bool operator==(const RoaringBitmap& other) const;
+    bool operator!=(const RoaringBitmap& other) const {
+        return !operator==(other);
+    }
+
+    /**
+     * Call \c func for each value in ascending order.
+     */
+    template <class Function>
+    void forEach(Function func) const;
+
+    std::vector<std::uint32_t> values() const;
+};
+
+template <class Function>
+void RoaringBitmap::forEach(Function func) const {
+    for (const auto& container : _containers) {
+        std::uint32_t high = static_cast<std::uint32_t>(container.key) << 16;
+        if (container.isBitmap()) {
+            for (std::uint32_t word = 0; word < BITMAP_WORDS; word++) {
+                std::uint64_t bits = container.bitmap[word];
+                for (std::uint32_t bit = 0; bits != 0; bit++, bits >>= 1) {
+                    if (bits & 1) func(high | (word * 64 + bit));
+                }
+            }
+        } else {
+            for (auto low : container.array) {
+                func(high | low);
+            }
+        }
+    }
+}
+}  // namespace yapet
+
+#endif
@@ -0,0 +1,247 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "consts.h"
+#include "intl.h"
+#include "logger.hh"
+#include "parallel.hh"
+#include "passwordrecord.hh"
+#include "tagindex.hh"
+
+using namespace yapet;
+
+namespace {
+inline bool isSeparator(char c) {
+    return std::strchr(",&|!() \t\r\n", c) != nullptr;
+}
+}  // namespace
+
+/**
+ * Recursive descent parser evaluating tag expressions against the index.
+ *
+ * expression := term { '|' term }
+ * term       := factor { '&' factor }
+ * factor     := '!' factor | '(' expression ')' | tag
+ */
+class TagIndex::Parser {
+   private:
+    const TagIndex& _index;
+    const std::string& _expression;
+    std::string::size_type _position;
+
+    void skipWhitespace() {
+        while (_position < _expression.size() &&
+               std::strchr(" \t", _expression[_position]) != nullptr) {
+            _position++;
+        }
+    }
+
+    bool accept(char c) {
+        skipWhitespace();
+        if (_position < _expression.size() && _expression[_position] == c) {
+            _position++;
+            return true;
+        }
+        return false;
+    }
+
+    [[noreturn]] void error(const char* message) const {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("%s at position %d of tag expression"), message,
+                      static_cast<int>(_position + 1));
+        throw TagExpressionError{msg};
+    }
+
+    RoaringBitmap expression() {
+        RoaringBitmap result{term()};
+        while (accept('|')) {
+            result = result | term();
+        }
+        return result;
+    }
+
+    RoaringBitmap term() {
+        RoaringBitmap result{factor()};
+        while (accept('&')) {
+            result = result & factor();
+        }
+        return result;
+    }
+
+    RoaringBitmap factor() {
+        if (accept('!')) {
+            return _index.all() - factor();
+        }
+
+        if (accept('(')) {
+            RoaringBitmap result{expression()};
+            if (!accept(')')) error(_("Missing ')'"));
+            return result;
+        }
+
+        skipWhitespace();
+        auto begin = _position;
+        while (_position < _expression.size() &&
+               !isSeparator(_expression[_position])) {
+            _position++;
+        }
+        if (begin == _position) error(_("Tag expected"));
+
+        return _index.records(_expression.substr(begin, _position - begin));
+    }
+
+   public:
+    Parser(const TagIndex& index, const std::string& expression)
+        : _index{index}, _expression{expression}, _position{0} {}
+
+    RoaringBitmap parse() {
+        RoaringBitmap result{expression()};
+        skipWhitespace();
+        if (_position != _expression.size()) error(_("Unexpected character"));
+        return result;
+    }
+};
+
+TagIndex::TagIndex() : _tags{}, _all{}, _tagsById{} {}
+
+std::vector<std::string> TagIndex::parseTags(const char* tags) {
+    std::vector<std::string> result;
+
+    const char* position = tags;
+    while (*position != '\0') {
+        while (*position != '\0' && isSeparator(*position)) position++;
+        const char* begin = position;
+        while (*position != '\0' && !isSeparator(*position)) position++;
+
+        if (position != begin) {
+            std::string tag{begin, position};
+            if (std::find(result.begin(), result.end(), tag) == result.end()) {
+                result.push_back(tag);
+            }
+        }
+    }
+
+    return result;
+}
+
+std::uint32_t TagIndex::build(
+    std::list<PasswordListItem>& items,
+    const std::shared_ptr<AbstractCryptoFactory>& cryptoFactory) {
+    clear();
+
+    std::vector<PasswordListItem*> itemPointers;
+    itemPointers.reserve(items.size());
+    std::uint32_t id = 0;
+    for (auto& item : items) {
+        item.id(id++);
+        itemPointers.push_back(&item);
+    }
+
+    std::vector<std::vector<std::string>> tags(itemPointers.size());
+    parallelFor(itemPointers.size(),
+                [&itemPointers, &tags, &cryptoFactory](
+                    unsigned int, std::size_t begin, std::size_t end) {
+                    auto crypto{cryptoFactory->crypto()};
+                    for (auto i = begin; i < end; i++) {
+                        PasswordRecord record{crypto->decrypt(
+                            itemPointers[i]->encryptedRecord())};
+                        tags[i] = parseTags(
+                            reinterpret_cast<const char*>(record.tags()));
+                    }
+                });
+
+    for (std::size_t i = 0; i < itemPointers.size(); i++) {
+        add(itemPointers[i]->id(), tags[i]);
+    }
+
+    LOG_MESSAGE(std::string{__func__} + ": indexed " +
+                std::to_string(_tags.size()) + " tags of " +
+                std::to_string(itemPointers.size()) + " records");
+    return id;
+}
+
+void TagIndex::add(std::uint32_t id, const std::vector<std::string>& tags) {
+    remove(id);
+
+    _all.add(id);
+    _tagsById[id] = tags;
+    for (const auto& tag : tags) {
+        _tags[tag].add(id);
+    }
+}
+
+void TagIndex::remove(std::uint32_t id) {
+    auto indexed = _tagsById.find(id);
+    if (indexed == _tagsById.end()) return;
+
+    for (const auto& tag : indexed->second) {
+        auto bitmap = _tags.find(tag);
+        bitmap->second.remove(id);
+        if (bitmap->second.empty()) {
+            _tags.erase(bitmap);
+        }
+    }
+
+    _all.remove(id);
+    _tagsById.erase(indexed);
+}
+
+void TagIndex::clear() {
+    _tags.clear();
+    _all.clear();
+    _tagsById.clear();
+}
+
+RoaringBitmap TagIndex::records(const std::string& tag) const {
+    auto bitmap = _tags.find(tag);
+    if (bitmap == _tags.end()) return RoaringBitmap{};
+    return bitmap->second;
+}
+
+RoaringBitmap TagIndex::select(const std::string& expression) const {
+    return Parser{*this, expression}.parse();
+}
+
+std::vector<std::pair<std::string, std::uint64_t>> TagIndex::counts() const {
+    std::vector<std::pair<std::string, std::uint64_t>> result;
+    result.reserve(_tags.size());
+    for (const auto& tag : _tags) {
+        result.emplace_back(tag.first, tag.second.cardinality());
+    }
+    return result;
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _TAGINDEX_HH
+#define _TAGINDEX_HH
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "abstractcryptofactory.hh"
+#include "passwordlistitem.hh"
+#include "roaringbitmap.hh"
+
+namespace yapet {
+/**
+ * Index of the tags of password records.
+ *
+ * For each tag, a bitmap holds the ids of the records, see \c
+ * PasswordListItem::id(), having the tag. Selecting records by a tag
+ * expression is then performed by bitmap operations, without decrypting
+ * any record.
+ *
+ * Tag expressions consist of tags, the operators \c & (and), \c | (or) and
+ * \c ! (not), and parentheses. \c & binds stronger than \c |, e.g.
+ * <tt>work & !old | personal</tt>.
+ */
+class TagIndex {
+   private:
+    std::map<std::string, RoaringBitmap> _tags;
+    RoaringBitmap _all;
+    std::unordered_map<std::uint32_t, std::vector<std::string>> _tagsById;
+
+    class Parser;
+
+   public:
+    TagIndex();
+
+    /**
+     * Split the tags field of a password record into tags. Tags are
+     * separated by commas or white space. Operator characters and
+     * parentheses cannot be part of tags and separate them too. Duplicates
+     * are removed.
+     */
+    static std::vector<std::string> parseTags(const char* tags);
+
+    /**
+     * Assign ids to \c items in list order, starting at 0, and index the
+     * tags of the records. Records are decrypted in parallel.
+     *
+     * @return the next free id.
+     */
+    std::uint32_t build(
+        std::list<PasswordListItem>& items,
+        const std::shared_ptr<AbstractCryptoFactory>& cryptoFactory);
+
+    /**
+     * Add the record \c id with \c tags, replacing the tags already indexed
+     * for \c id.
+     */
+    void add(std::uint32_t id, const std::vector<std::string>& tags);
+    void remove(std::uint32_t id);
+    void clear();
+
+    /**
+     * The ids of all records indexed.
+     */
+    const RoaringBitmap& all() const { return _all; }
+
+    /**
+     * The ids of the records having \c tag.
+     */
+    RoaringBitmap records(const std::string& tag) const;
+
+    /**
+     * The ids of the records matching \c expression.
+     *
+     * @throw TagExpressionError if \c expression is malformed.
+     */
+    RoaringBitmap select(const std::string& expression) const;
+
+    /**
+     * The tags in use and the number of records having them, sorted by
+     * tag.
+     */
+    std::vector<std::pair<std::string, std::uint64_t>> counts() const;
+};
+
+class TagExpressionError : public std::runtime_error {
+   public:
+    TagExpressionError(const char* msg) : runtime_error{msg} {}
+};
+}  // namespace yapet
+
+#endif
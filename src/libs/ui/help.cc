@@ -100,6 +100,11 @@ HelpDialog::HelpDialog()
     searchndescr = new YACURS::Label(_("Search Next"));
     rightpack->add_back(searchndescr);
 
+    tagfilterkey = new YACURS::Label(" t ");
+    leftpack->add_back(tagfilterkey);
+    tagfilterdescr = new YACURS::Label(_("Filter by Tags"));
+    rightpack->add_back(tagfilterdescr);
+
     chpwkey = new YACURS::Label(" c ");
     leftpack->add_back(chpwkey);
     chpwdescr = new YACURS::Label(_("Change Password"));
@@ -152,6 +157,9 @@ HelpDialog::HelpDialog()
     searchnkey->color(YACURS::DIALOG);
     searchndescr->color(YACURS::DIALOG);
 
+    tagfilterkey->color(YACURS::DIALOG);
+    tagfilterdescr->color(YACURS::DIALOG);
+
     chpwkey->color(YACURS::DIALOG);
     chpwdescr->color(YACURS::DIALOG);
 
@@ -200,6 +208,9 @@ HelpDialog::~HelpDialog() {
     delete searchnkey;
     delete searchndescr;
 
+    delete tagfilterkey;
+    delete tagfilterdescr;
+
     delete chpwkey;
     delete chpwdescr;
 
@@ -71,6 +71,9 @@ class HelpDialog : public YACURS::Dialog {
     YACURS::Label* searchnkey;
     YACURS::Label* searchndescr;
 
+    YACURS::Label* tagfilterkey;
+    YACURS::Label* tagfilterdescr;
+
     YACURS::Label* chpwkey;
     YACURS::Label* chpwdescr;
 
@@ -37,6 +37,7 @@
 
 #include <sys/resource.h>
 
+#include <cstdio>
 #include <sstream>
 
 #include "filehelper.hh"
@@ -117,7 +118,11 @@ InfoDialog::InfoDialog(const MainWindow& mainWindow,
       argon2Paralleism{_("Argon2 Parallelism")},
       argon2ParalleismStatus{_("n/a")},
       argon2Iterations{_("Argon2 Iterations")},
-      argon2IterationsStatus{_("n/a")} {
+      argon2IterationsStatus{_("n/a")},
+      rcache{_("Record cache: ")},
+      rcache_status{},
+      tags{_("Tags: ")},
+      tags_status{std::string()} {
     // used to make the file name label get the entire space available
     // to the pack.
     rightpack.always_dynamic(true);
@@ -233,6 +238,30 @@ InfoDialog::InfoDialog(const MainWindow& mainWindow,
     leftpack.add_back(&argon2Paralleism);
     rightpack.add_back(&argon2ParalleismStatus);
 
+    leftpack.add_back(&rcache);
+    const auto& recordCache{mainWindow.recordCache()};
+    char rcachestr[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+    std::snprintf(rcachestr, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                  _("%lu of %lu, %llu hits, %llu misses%s"),
+                  static_cast<unsigned long>(recordCache.size()),
+                  static_cast<unsigned long>(recordCache.capacity()),
+                  static_cast<unsigned long long>(recordCache.hits()),
+                  static_cast<unsigned long long>(recordCache.misses()),
+                  recordCache.locked() ? "" : _(", not locked in memory"));
+    rcache_status.label(rcachestr);
+    rightpack.add_back(&rcache_status);
+
+    leftpack.add_back(&tags);
+    std::string tagsstr;
+    for (const auto& tagCount : mainWindow.tagIndex().counts()) {
+        if (!tagsstr.empty()) tagsstr += ", ";
+        tagsstr += tagCount.first + " (" + std::to_string(tagCount.second) +
+                   ")";
+    }
+    if (tagsstr.empty()) tagsstr = _("none");
+    tags_status.label(tagsstr);
+    rightpack.add_back(&tags_status);
+
     // colors
     fn.color(YACURS::DIALOG);
     fn_status.color(YACURS::DIALOG);
@@ -275,6 +304,12 @@ InfoDialog::InfoDialog(const MainWindow& mainWindow,
 
     argon2Paralleism.color(YACURS::DIALOG);
     argon2ParalleismStatus.color(YACURS::DIALOG);
+
+    rcache.color(YACURS::DIALOG);
+    rcache_status.color(YACURS::DIALOG);
+
+    tags.color(YACURS::DIALOG);
+    tags_status.color(YACURS::DIALOG);
 }
 
 InfoDialog::~InfoDialog() {}
@@ -87,6 +87,12 @@ class InfoDialog : public YACURS::Dialog {
     YACURS::Label argon2Iterations;
     YACURS::Label argon2IterationsStatus;
 
+    YACURS::Label rcache;
+    YACURS::Label rcache_status;
+
+    YACURS::Label tags;
+    YACURS::DynLabel tags_status;
+
    public:
     InfoDialog(const MainWindow& mainWindow, YACURS::ListBox<>::lsz_t entries);
     virtual ~InfoDialog();
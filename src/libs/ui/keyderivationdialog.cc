@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#include <signal.h>
+#include <unistd.h>
+
+#include <cassert>
+
+#include "globals.h"
+#include "intl.h"
+#include "keyderivationdialog.h"
+
+namespace {
+constexpr char SPINNER[]{'|', '/', '-', '\\'};
+}
+
+//
+// Private
+//
+
+void KeyDerivationDialog::sigusr1_handler(YACURS::Event& e) {
+    assert(e == YACURS::EVT_SIGUSR1);
+
+    if (_submitted || _derivation.cancelled()) return;
+
+    if (_derivation.finished()) {
+        _submitted = true;
+        YACURS::EventQueue::submit(YACURS::EventEx<KeyDerivationDialog*>(
+            YAPET::EVT_KEYS_DERIVED, this));
+        return;
+    }
+
+    _ticks++;
+    _spinner.label(spinner(_ticks));
+}
+
+//
+// Protected
+//
+
+bool KeyDerivationDialog::on_close() {
+    if (dialog_state() != YACURS::DIALOG_OK) _derivation.cancel();
+    return true;
+}
+
+//
+// Public
+//
+
+KeyDerivationDialog::KeyDerivationDialog(
+    const std::string& message,
+    const std::vector<yapet::KeyDerivation::Job>& jobs)
+    : Dialog{_("Deriving Key"), YACURS::OKCANCEL},
+      // Signals are handled by the event loop, which submits them as events
+      _derivation{[]() { ::kill(::getpid(), SIGUSR1); }},
+      _message{message},
+      _spinner{spinner(0)},
+      _ticks{0},
+      _submitted{false} {
+    _message.color(YACURS::DIALOG);
+    _spinner.color(YACURS::DIALOG);
+    widget(&_message);
+    widget(&_spinner);
+
+    YACURS::EventQueue::connect_event(
+        YACURS::EventConnectorMethod1<KeyDerivationDialog>(
+            YACURS::EVT_SIGUSR1, this, &KeyDerivationDialog::sigusr1_handler));
+
+    for (auto& job : jobs) _derivation.add(job);
+    _derivation.start();
+}
+
+KeyDerivationDialog::~KeyDerivationDialog() {
+    YACURS::EventQueue::disconnect_event(
+        YACURS::EventConnectorMethod1<KeyDerivationDialog>(
+            YACURS::EVT_SIGUSR1, this, &KeyDerivationDialog::sigusr1_handler));
+}
+
+std::string KeyDerivationDialog::spinner(int ticks) {
+    return std::string(1, SPINNER[ticks % sizeof(SPINNER)]);
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _KEYDERIVATIONDIALOG_H
+#define _KEYDERIVATIONDIALOG_H 1
+
+#include <memory>
+#include <vector>
+
+#include "keyderivation.hh"
+#include "yacurs.h"
+
+/**
+ * @brief Shows a spinner while keys are derived on worker threads.
+ *
+ * The jobs start when the dialog is created. Worker threads raise SIGUSR1
+ * every tick, upon which the spinner advances, and once all jobs are done,
+ * upon which the dialog submits a YAPET::EVT_KEYS_DERIVED event. The
+ * results are then available through \c result().
+ *
+ * Closing the dialog with Cancel abandons the derivation. Closing it with
+ * OK merely hides it: the derivation goes on and its completion is still
+ * submitted.
+ */
+class KeyDerivationDialog : public YACURS::Dialog {
+   private:
+    yapet::KeyDerivation _derivation;
+    YACURS::Label _message;
+    YACURS::DynLabel _spinner;
+    int _ticks;
+    bool _submitted;
+
+    void sigusr1_handler(YACURS::Event& e);
+
+   protected:
+    virtual bool on_close();
+
+   public:
+    KeyDerivationDialog(const std::string& message,
+                        const std::vector<yapet::KeyDerivation::Job>& jobs);
+    KeyDerivationDialog(const KeyDerivationDialog&) = delete;
+    KeyDerivationDialog(KeyDerivationDialog&&) = delete;
+    KeyDerivationDialog& operator=(const KeyDerivationDialog&) = delete;
+    KeyDerivationDialog& operator=(KeyDerivationDialog&&) = delete;
+
+    virtual ~KeyDerivationDialog();
+
+    /**
+     * The spinner shown after \c ticks ticks.
+     */
+    static std::string spinner(int ticks);
+
+    bool cancelled() const { return _derivation.cancelled(); }
+
+    /**
+     * @throw the exception thrown by the job \c index, if any.
+     */
+    std::shared_ptr<yapet::AbstractCryptoFactory> result(
+        std::size_t index) const {
+        return _derivation.result(index);
+    }
+};
+
+#endif  // _KEYDERIVATIONDIALOG_H
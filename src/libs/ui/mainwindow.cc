@@ -35,10 +35,14 @@
 #include <libgen.h>
 #endif
 
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
 
+#include "aes256factory.hh"
 #include "cfg.h"
+#include "consts.h"
+#include "cryptofactoryhelper.hh"
 #include "filehelper.hh"
 #include "globals.h"
 #include "logger.hh"
@@ -224,8 +228,13 @@ void MainWindow::window_close_handler(YACURS::Event& e) {
     if (passwordrecord != nullptr && evt.data() == passwordrecord) {
         if (passwordrecord->dialog_state() == YACURS::DIALOG_OK) {
             if (passwordrecord->changed()) {
+                auto item{passwordrecord->getEncEntry()};
+                auto recordTags{yapet::TagIndex::parseTags(
+                    passwordrecord->tags_input().c_str())};
                 if (passwordrecord->newrecord()) {
-                    recordlist->add(*passwordrecord->getEncEntry());
+                    item->id(_nextId++);
+                    _tagIndex.add(item->id(), recordTags);
+                    recordlist->add(*item);
                     YACURS::Curses::statusbar()->set(_("Added new Record"));
                 } else {
                     assert(record_index !=
@@ -236,7 +245,9 @@ void MainWindow::window_close_handler(YACURS::Event& e) {
                     // the dialog opened. Need in case a screen resize
                     // changed the selection index.
                     recordlist->high_light(record_index);
-                    recordlist->selected(*passwordrecord->getEncEntry());
+                    item->id(recordlist->selected().id());
+                    _tagIndex.add(item->id(), recordTags);
+                    recordlist->selected(*item);
 
                     YACURS::Curses::statusbar()->set(_("Updated Record"));
                 }
@@ -261,6 +272,7 @@ void MainWindow::window_close_handler(YACURS::Event& e) {
             // the dialog opened. Need in case a screen resize
             // changed the selection index.
             recordlist->high_light(record_index);
+            _tagIndex.remove(recordlist->selected().id());
             recordlist->delete_selected();
             YACURS::Curses::statusbar()->set(_("Delete selected Record"));
             YAPET::Globals::records_changed = true;
@@ -318,6 +330,26 @@ void MainWindow::window_close_handler(YACURS::Event& e) {
         return;
     }
 
+    if (tagfilterdialog != nullptr && evt.data() == tagfilterdialog) {
+        if (tagfilterdialog->dialog_state() == YACURS::DIALOG_OK) {
+            try {
+                tag_filter(tagfilterdialog->input());
+            } catch (yapet::TagExpressionError& ex) {
+                yapet::deleteAndZero(&tagfilterdialog);
+
+                assert(errormsgdialog == nullptr);
+                errormsgdialog = new YACURS::MessageBox2(
+                    _("Error"), _("Invalid tag filter:"), ex.what(),
+                    YACURS::OK_ONLY);
+                errormsgdialog->show();
+                return;
+            }
+        }
+
+        yapet::deleteAndZero(&tagfilterdialog);
+        return;
+    }
+
     if (errormsgdialog != nullptr && evt.data() == errormsgdialog) {
         yapet::deleteAndZero(&errormsgdialog);
         return;
@@ -340,6 +372,19 @@ void MainWindow::listbox_enter_handler(YACURS::Event& e) {
     }
 }
 
+void MainWindow::set_records(std::list<yapet::PasswordListItem> records) {
+    _nextId = _tagIndex.build(records, _cryptoFactory);
+    _tagFilter.clear();
+    _filteredOut.clear();
+    recordlist->set(records);
+}
+
+std::list<yapet::PasswordListItem> MainWindow::all_records() const {
+    std::list<yapet::PasswordListItem> records{recordlist->list()};
+    records.insert(records.end(), _filteredOut.begin(), _filteredOut.end());
+    return records;
+}
+
 //
 // Protected
 //
@@ -358,12 +403,22 @@ MainWindow::MainWindow(const std::string& fileToLoadOnShow)
       passwordrecord{nullptr},
       errormsgdialog{nullptr},
       searchdialog{nullptr},
+      tagfilterdialog{nullptr},
       pwgendialog{nullptr},
       finder{nullptr},
       record_index{NO_INDEX},
       last_search_index{0},
       _yapetFile{nullptr},
-      _cryptoFactory{nullptr} {
+      _cryptoFactory{nullptr},
+      _tagIndex{},
+      _nextId{0},
+      _tagFilter{},
+      _filteredOut{},
+      _recordCache{new yapet::RecordCache{
+          static_cast<std::size_t>(
+              YAPET::Globals::config.record_cache_size.get()),
+          std::chrono::seconds{
+              YAPET::Globals::config.record_cache_ttl.get()}}} {
     Window::widget(recordlist);
     frame(false);
 
@@ -410,6 +465,9 @@ MainWindow::MainWindow(const std::string& fileToLoadOnShow)
     add_hotkey(HotKeyG(*this));
     add_hotkey(HotKeyg(*this));
 
+    add_hotkey(HotKeyT(*this));
+    add_hotkey(HotKeyt(*this));
+
     YACURS::EventQueue::connect_event(YACURS::EventConnectorMethod1<MainWindow>(
         YACURS::EVT_WINDOW_CLOSE, this, &MainWindow::window_close_handler));
 
@@ -434,6 +492,7 @@ MainWindow::~MainWindow() {
     if (passwordrecord) delete passwordrecord;
     if (errormsgdialog) delete errormsgdialog;
     if (searchdialog) delete searchdialog;
+    if (tagfilterdialog) delete tagfilterdialog;
     if (pwgendialog) delete pwgendialog;
     if (finder) delete finder;
 
@@ -459,6 +518,7 @@ void MainWindow::load_password_file(
     const std::string& filename,
     std::shared_ptr<yapet::AbstractCryptoFactory>& cryptoFactory, bool create) {
     try {
+        _recordCache->flush();
         _cryptoFactory = cryptoFactory;
         _yapetFile = std::unique_ptr<YAPET::File>{
             new YAPET::File{_cryptoFactory, filename, create,
@@ -466,7 +526,7 @@ void MainWindow::load_password_file(
         YAPET::Globals::records_changed = false;
 
         recordlist->clear();
-        recordlist->set(_yapetFile->read());
+        set_records(_yapetFile->read());
         std::string msg(_("Opened file: "));
         YACURS::Curses::statusbar()->set(msg + _yapetFile->getFilename());
 
@@ -483,6 +543,9 @@ void MainWindow::load_password_file(
         YACURS::Curses::set_terminal_title(ttl);
     } catch (std::exception& e) {
         recordlist->clear();
+        _tagIndex.clear();
+        _tagFilter.clear();
+        _filteredOut.clear();
 
         assert(errormsgdialog == nullptr);
 
@@ -504,8 +567,8 @@ void MainWindow::show_password_record(bool selected) {
         assert(record_index ==
                (YACURS::ListBox<yapet::PasswordListItem>::lsz_t) - 1);
         record_index = recordlist->selected_index();
-        passwordrecord =
-            new PasswordRecord(_cryptoFactory, recordlist->selected());
+        passwordrecord = new PasswordRecord(_cryptoFactory, *_recordCache,
+                                            recordlist->selected());
     } else {
         passwordrecord = new PasswordRecord(_cryptoFactory);
     }
@@ -521,7 +584,7 @@ bool MainWindow::save_records() {
 
     try {
         if (YAPET::Globals::records_changed) {
-            _yapetFile->save(recordlist->list());
+            _yapetFile->save(all_records());
             std::string msg(_("Saved file: "));
             YACURS::Curses::statusbar()->set(msg + _yapetFile->getFilename());
             YAPET::Globals::records_changed = false;
@@ -548,11 +611,12 @@ void MainWindow::change_password(
         throw std::invalid_argument(_("New key must not be nullptr"));
 
     try {
+        _recordCache->flush();
         _cryptoFactory = newCryptoFactory;
         LOG_MESSAGE(std::string{__func__} + ": set new key");
         _yapetFile->setNewKey(_cryptoFactory);
         // Reread the records
-        recordlist->set(_yapetFile->read());
+        set_records(_yapetFile->read());
 
         YACURS::Curses::statusbar()->set(
             std::string(_("Changed password on ")) + _yapetFile->getFilename());
@@ -590,7 +654,7 @@ void MainWindow::show_help() {
 void MainWindow::show_info() {
     assert(infodialog == nullptr);
 
-    infodialog = new InfoDialog(*this, recordlist->list().size());
+    infodialog = new InfoDialog(*this, size());
     infodialog->show();
 }
 
@@ -601,6 +665,55 @@ void MainWindow::show_pwgen() {
     pwgendialog->show();
 }
 
+void MainWindow::show_tag_filter() {
+    assert(tagfilterdialog == nullptr);
+
+    if (!_yapetFile) return;
+
+    tagfilterdialog = new YACURS::InputBox(
+        _("Tag Filter"),
+        _("Enter tag expression, e.g. 'work & !old', empty to show all"));
+    tagfilterdialog->show();
+}
+
+void MainWindow::tag_filter(const std::string& expression) {
+    if (expression.empty()) {
+        if (!_filteredOut.empty()) {
+            recordlist->set(all_records());
+            _filteredOut.clear();
+        }
+        _tagFilter.clear();
+        YACURS::Curses::statusbar()->set(_("Showing all records"));
+        return;
+    }
+
+    // Throws on malformed expressions, before anything has been changed
+    auto selection{_tagIndex.select(expression)};
+
+    std::list<yapet::PasswordListItem> shown;
+    std::list<yapet::PasswordListItem> hidden;
+    for (const auto& item : all_records()) {
+        if (selection.contains(item.id())) {
+            shown.push_back(item);
+        } else {
+            hidden.push_back(item);
+        }
+    }
+
+    auto total{shown.size() + hidden.size()};
+    recordlist->set(shown);
+    _filteredOut = std::move(hidden);
+    _tagFilter = expression;
+    last_search_index = 0;
+
+    char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+    std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                  _("Showing %lu of %lu records matching '%s'"),
+                  static_cast<unsigned long>(recordlist->list().size()),
+                  static_cast<unsigned long>(total), expression.c_str());
+    YACURS::Curses::statusbar()->set(msg);
+}
+
 void MainWindow::quit() {
     if (YAPET::Globals::records_changed) {
         assert(confirmquit == nullptr);
@@ -701,19 +814,44 @@ std::int64_t MainWindow::passwordLastChanged() const {
     return _yapetFile->getMasterPWSet();
 }
 
-bool MainWindow::matchPasswordWithCurrent(
+yapet::KeyDerivation::Job MainWindow::passwordKeyDerivation(
     const yapet::SecureArray& password) const {
-    if (!_cryptoFactory) {
-        return false;
+    std::shared_ptr<yapet::AbstractCryptoFactory> cryptoFactory{_cryptoFactory};
+    if (!cryptoFactory) {
+        return []() {
+            return std::shared_ptr<yapet::AbstractCryptoFactory>{};
+        };
     }
 
+    // Read on this thread, only the key is derived on the worker thread
     auto keyingParameters{yapet::readMetaData(
         _yapetFile->getFilename(), _yapetFile->filesecurityEnabled())};
-    auto temporayCryptoFactory{
-        _cryptoFactory->newFactory(password, keyingParameters)};
+
+    return [cryptoFactory, password, keyingParameters]() {
+        return cryptoFactory->newFactory(password, keyingParameters);
+    };
+}
+
+yapet::KeyDerivation::Job MainWindow::newPasswordKeyDerivation(
+    const yapet::SecureArray& password) const {
+    std::shared_ptr<yapet::AbstractCryptoFactory> cryptoFactory{_cryptoFactory};
+    // Read on this thread, since it accesses the configuration
+    auto keyingParameters{yapet::Key256::newDefaultKeyingParameters()};
+
+    return [cryptoFactory, password, keyingParameters]() {
+        return yapet::getCryptoFactoryForNewPassword(cryptoFactory, password,
+                                                     keyingParameters);
+    };
+}
+
+bool MainWindow::matchKeyWithCurrent(
+    const std::shared_ptr<yapet::AbstractCryptoFactory>& cryptoFactory) const {
+    if (!_cryptoFactory || !cryptoFactory) {
+        return false;
+    }
 
     auto currentKey{_cryptoFactory->key()};
-    auto keyFromPassword{temporayCryptoFactory->key()};
+    auto keyFromPassword{cryptoFactory->key()};
 
     return *currentKey == *keyFromPassword;
 }
\ No newline at end of file
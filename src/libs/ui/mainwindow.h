@@ -45,16 +45,21 @@ class InfoDialog;
 
 #include <yacurs.h>
 
+#include <cstdint>
 #include <cstring>
 #include <limits>
+#include <list>
 #include <string>
 
 #include "file.hh"
 #include "help.h"
 #include "info.h"
+#include "keyderivation.hh"
 #include "passwordlistitem.hh"
 #include "passwordrecord.h"
 #include "pwgendialog.h"
+#include "recordcache.hh"
+#include "tagindex.hh"
 
 namespace INTERNAL {
 
@@ -73,6 +78,7 @@ class MainWindow : public YACURS::Window {
     PasswordRecord* passwordrecord;
     YACURS::MessageBox2* errormsgdialog;
     YACURS::InputBox* searchdialog;
+    YACURS::InputBox* tagfilterdialog;
     PwGenDialog* pwgendialog;
     INTERNAL::Finder* finder;
     // Used when opening an existing record or deleting a record
@@ -86,6 +92,15 @@ class MainWindow : public YACURS::Window {
     YACURS::ListBox<yapet::PasswordListItem>::lsz_t last_search_index;
     std::unique_ptr<YAPET::File> _yapetFile;
     std::shared_ptr<yapet::AbstractCryptoFactory> _cryptoFactory;
+    // Index of the tags of all records, including the records hidden by
+    // the tag filter.
+    yapet::TagIndex _tagIndex;
+    std::uint32_t _nextId;
+    // The current tag filter expression, and the records not matching it.
+    std::string _tagFilter;
+    std::list<yapet::PasswordListItem> _filteredOut;
+    // Decrypted records opened recently, flushed on lock and key change.
+    std::unique_ptr<yapet::RecordCache> _recordCache;
 
     MainWindow(const MainWindow&) {}
 
@@ -99,6 +114,17 @@ class MainWindow : public YACURS::Window {
 
     void listbox_enter_handler(YACURS::Event& e);
 
+    /**
+     * Index the tags of \c records and show them, resetting the tag
+     * filter.
+     */
+    void set_records(std::list<yapet::PasswordListItem> records);
+
+    /**
+     * All records, the ones shown and the ones hidden by the tag filter.
+     */
+    std::list<yapet::PasswordListItem> all_records() const;
+
    public:
     MainWindow(const std::string& fileToLoadOnShow = std::string{});
     virtual ~MainWindow();
@@ -143,12 +169,34 @@ class MainWindow : public YACURS::Window {
 
     void show_pwgen();
 
+    void show_tag_filter();
+
+    /**
+     * Show only the records matching the tag expression \c expression. An
+     * empty expression shows all records.
+     *
+     * @throw yapet::TagExpressionError if \c expression is malformed.
+     */
+    void tag_filter(const std::string& expression);
+
+    const yapet::TagIndex& tagIndex() const { return _tagIndex; }
+
+    const yapet::RecordCache& recordCache() const { return *_recordCache; }
+
+    /**
+     * Wipe the decrypted records cached, e.g. when the screen is locked.
+     */
+    void flush_record_cache() { _recordCache->flush(); }
+
     void quit();
 
     /**
-     * Get the number of password records.
+     * Get the number of password records, including records hidden by the
+     * tag filter.
      */
-    YACURS::ListBox<>::lsz_t size() { return recordlist->list().size(); }
+    YACURS::ListBox<>::lsz_t size() {
+        return recordlist->list().size() + _filteredOut.size();
+    }
 
     void sort_asc(bool f);
     bool sort_asc() const;
@@ -160,7 +208,26 @@ class MainWindow : public YACURS::Window {
     std::string currentFilename() const;
     std::string fileVersion() const;
     std::int64_t passwordLastChanged() const;
-    bool matchPasswordWithCurrent(const yapet::SecureArray& password) const;
+
+    /**
+     * Returns a job deriving the key of \c password with the keying
+     * parameters of the current file, to be run by a yapet::KeyDerivation.
+     *
+     * @see matchKeyWithCurrent
+     */
+    yapet::KeyDerivation::Job passwordKeyDerivation(
+        const yapet::SecureArray& password) const;
+    /**
+     * Returns a job deriving the key of \c password with new keying
+     * parameters, to be passed to \c change_password(). The data key of the
+     * current file is kept, so that changing the password does not require
+     * re-encrypting the records.
+     */
+    yapet::KeyDerivation::Job newPasswordKeyDerivation(
+        const yapet::SecureArray& password) const;
+    bool matchKeyWithCurrent(
+        const std::shared_ptr<yapet::AbstractCryptoFactory>& cryptoFactory)
+        const;
 };
 
 #endif  // _MAINWINDOW_H
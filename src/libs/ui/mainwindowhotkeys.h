@@ -422,4 +422,31 @@ class HotKeyg : public YACURS::HotKey {
     HotKey* clone() const { return new HotKeyg(*this); }
 };
 
+// TAG FILTER
+class HotKeyT : public YACURS::HotKey {
+   private:
+    MainWindow& ref;
+
+   public:
+    HotKeyT(MainWindow& r) : HotKey('T'), ref(r) {}
+    HotKeyT(const HotKeyT& hkh) : HotKey(hkh), ref(hkh.ref) {}
+
+    void action() { ref.show_tag_filter(); }
+
+    HotKey* clone() const { return new HotKeyT(*this); }
+};
+
+class HotKeyt : public YACURS::HotKey {
+   private:
+    MainWindow& ref;
+
+   public:
+    HotKeyt(MainWindow& r) : HotKey('t'), ref(r) {}
+    HotKeyt(const HotKeyt& hkh) : HotKey(hkh), ref(hkh.ref) {}
+
+    void action() { ref.show_tag_filter(); }
+
+    HotKey* clone() const { return new HotKeyt(*this); }
+};
+
 #endif  // _MAINWINDOWHOTKEYS_H
@@ -31,12 +31,24 @@
 #include "config.h"
 #endif
 
+#include <algorithm>
+#include <cstdio>
+
 #include "baseerror.hh"
+#include "consts.h"
 #include "globals.h"
 #include "intl.h"
 #include "passwordrecord.h"
 #include "utils.hh"
 
+namespace {
+const yapet::strength::StrengthEstimator& estimator() {
+    static const yapet::strength::StrengthEstimator estimator{
+        yapet::strength::StrengthEstimator::loadDefaultDictionary()};
+    return estimator;
+}
+}  // namespace
+
 class HotKeyCtrlR : public YACURS::HotKey {
    private:
     PasswordRecord* ptr;
@@ -72,6 +84,7 @@ void PasswordRecord::on_ok_button() {
     passwordRecord.username(username->input().c_str());
     passwordRecord.password(password->input().c_str());
     passwordRecord.comment(comment->input().c_str());
+    passwordRecord.tags(tags->input().c_str());
 
     try {
         auto serializedPasswordRecord{passwordRecord.serialize()};
@@ -136,6 +149,42 @@ void PasswordRecord::window_close_handler(YACURS::Event& e) {
     }
 }
 
+void PasswordRecord::update_handler(YACURS::Event& e) {
+    assert(e == YACURS::EVT_DOUPDATE);
+    update_strength();
+}
+
+void PasswordRecord::update_strength() {
+    // The password is estimated after the screen has been updated, so that
+    // the key pressed has already been processed by the input widget.
+    if (password->input() == _estimated_password) return;
+
+    std::fill(_estimated_password.begin(), _estimated_password.end(), '\0');
+    _estimated_password = password->input();
+
+    if (_estimated_password.empty()) {
+        lstrength->label(_("Strength: -"));
+        return;
+    }
+
+    using yapet::strength::StrengthEstimator;
+    auto strength{estimator().estimate(_estimated_password, _estimator_state)};
+    char text[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+    if (strength.pattern == yapet::strength::Pattern::BRUTEFORCE) {
+        std::snprintf(text, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Strength: %s (about %d bits)"),
+                      StrengthEstimator::scoreDescription(strength.score),
+                      static_cast<int>(strength.bits()));
+    } else {
+        std::snprintf(text, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Strength: %s (about %d bits, %s)"),
+                      StrengthEstimator::scoreDescription(strength.score),
+                      static_cast<int>(strength.bits()),
+                      StrengthEstimator::patternDescription(strength.pattern));
+    }
+    lstrength->label(text);
+}
+
 bool PasswordRecord::on_close() {
     if (changed() && dialog_state() != YACURS::DIALOG_OK && !_force_close) {
         assert(confirmdialog == nullptr);
@@ -154,14 +203,12 @@ bool PasswordRecord::on_close() {
 
 PasswordRecord::PasswordRecord(
     std::shared_ptr<yapet::AbstractCryptoFactory>& cryptoFactory,
+    yapet::RecordCache& recordCache,
     const yapet::PasswordListItem& passwordListItem)
     : PasswordRecord{cryptoFactory} {
     _newrecord = false;
     try {
-        auto crypto{_cryptoFactory->crypto()};
-        auto decryptedSerializedRecord{
-            crypto->decrypt(passwordListItem.encryptedRecord())};
-        yapet::PasswordRecord passwordRecord{decryptedSerializedRecord};
+        auto passwordRecord{recordCache.get(passwordListItem, _cryptoFactory)};
         // This also sets the _password_hidden attribute
         readonly(true);
         name->input(reinterpret_cast<const char*>(passwordRecord.name()));
@@ -171,6 +218,7 @@ PasswordRecord::PasswordRecord(
         password->input(
             reinterpret_cast<const char*>(passwordRecord.password()));
         comment->input(reinterpret_cast<const char*>(passwordRecord.comment()));
+        tags->input(reinterpret_cast<const char*>(passwordRecord.tags()));
     } catch (yapet::YAPETBaseError& ex) {
         try {
             errordialog = new YACURS::MessageBox(_("Error"), ex.what());
@@ -192,11 +240,14 @@ PasswordRecord::PasswordRecord(
       lusername{new YACURS::Label{_("User Name")}},
       lpassword{new YACURS::Label{_("Password")}},
       lcomment{new YACURS::Label{_("Comment")}},
+      ltags{new YACURS::Label{_("Tags")}},
+      lstrength{new YACURS::Label{_("Strength: -")}},
       name{new YACURS::Input<std::string>},
       host{new YACURS::Input<std::string>},
       username{new YACURS::Input<std::string>},
       password{new YACURS::Input<std::string>},
       comment{new YACURS::Input<std::string>},
+      tags{new YACURS::Input<std::string>},
       pwgenbutton{new YACURS::Button{_("Password Generator")}},
       pwgenbutton_spacer{new YACURS::Spacer},
       errordialog{nullptr},
@@ -208,18 +259,23 @@ PasswordRecord::PasswordRecord(
       _readonly{false},
       _password_hidden{false},
       _force_close{false},
-      _modified_by_pwgen{false} {
+      _modified_by_pwgen{false},
+      _estimated_password{},
+      _estimator_state{} {
     name->max_input(yapet::PasswordRecord::NAME_SIZE);
     host->max_input(yapet::PasswordRecord::HOST_SIZE);
     username->max_input(yapet::PasswordRecord::USERNAME_SIZE);
     password->max_input(yapet::PasswordRecord::PASSWORD_SIZE);
     comment->max_input(yapet::PasswordRecord::COMMENT_SIZE);
+    tags->max_input(yapet::PasswordRecord::TAGS_SIZE);
 
     lname->color(YACURS::DIALOG);
     lhost->color(YACURS::DIALOG);
     lusername->color(YACURS::DIALOG);
     lpassword->color(YACURS::DIALOG);
     lcomment->color(YACURS::DIALOG);
+    ltags->color(YACURS::DIALOG);
+    lstrength->color(YACURS::DIALOG);
 
     vpack->add_back(lname);
     vpack->add_back(name);
@@ -229,8 +285,11 @@ PasswordRecord::PasswordRecord(
     vpack->add_back(username);
     vpack->add_back(lpassword);
     vpack->add_back(password);
+    vpack->add_back(lstrength);
     vpack->add_back(lcomment);
     vpack->add_back(comment);
+    vpack->add_back(ltags);
+    vpack->add_back(tags);
 
     add_button(pwgenbutton_spacer);
     add_button(pwgenbutton);
@@ -244,19 +303,27 @@ PasswordRecord::PasswordRecord(
         YACURS::EventConnectorMethod1<PasswordRecord>(
             YACURS::EVT_WINDOW_CLOSE, this,
             &PasswordRecord::window_close_handler));
+    YACURS::EventQueue::connect_event(
+        YACURS::EventConnectorMethod1<PasswordRecord>(
+            YACURS::EVT_DOUPDATE, this, &PasswordRecord::update_handler));
 }
 
 PasswordRecord::~PasswordRecord() {
+    std::fill(_estimated_password.begin(), _estimated_password.end(), '\0');
+
     delete lname;
     delete lhost;
     delete lusername;
     delete lpassword;
     delete lcomment;
+    delete ltags;
+    delete lstrength;
     delete name;
     delete host;
     delete username;
     delete password;
     delete comment;
+    delete tags;
     delete pwgenbutton;
     delete pwgenbutton_spacer;
     delete vpack;
@@ -269,11 +336,15 @@ PasswordRecord::~PasswordRecord() {
         YACURS::EventConnectorMethod1<PasswordRecord>(
             YACURS::EVT_WINDOW_CLOSE, this,
             &PasswordRecord::window_close_handler));
+    YACURS::EventQueue::disconnect_event(
+        YACURS::EventConnectorMethod1<PasswordRecord>(
+            YACURS::EVT_DOUPDATE, this, &PasswordRecord::update_handler));
 }
 
 bool PasswordRecord::changed() const {
     return name->changed() || host->changed() || username->changed() ||
-           password->changed() || comment->changed() || _modified_by_pwgen;
+           password->changed() || comment->changed() || tags->changed() ||
+           _modified_by_pwgen;
 }
 
 void PasswordRecord::readonly(bool f) {
@@ -283,6 +354,7 @@ void PasswordRecord::readonly(bool f) {
     password->readonly(f);
     password->hide_input(f);
     comment->readonly(f);
+    tags->readonly(f);
     _password_hidden = _readonly = f;
 
     if (_readonly)
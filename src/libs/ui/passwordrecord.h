@@ -40,6 +40,8 @@
 
 #include "file.hh"
 #include "pwgendialog.h"
+#include "recordcache.hh"
+#include "strengthestimator.hh"
 
 /**
  * @brief A window that displays all the information associated with a
@@ -71,11 +73,14 @@ class PasswordRecord : public YACURS::Dialog {
     YACURS::Label* lusername;
     YACURS::Label* lpassword;
     YACURS::Label* lcomment;
+    YACURS::Label* ltags;
+    YACURS::Label* lstrength;
     YACURS::Input<std::string>* name;
     YACURS::Input<std::string>* host;
     YACURS::Input<std::string>* username;
     YACURS::Input<std::string>* password;
     YACURS::Input<std::string>* comment;
+    YACURS::Input<std::string>* tags;
     YACURS::Button* pwgenbutton;
     YACURS::Spacer* pwgenbutton_spacer;
 
@@ -96,12 +101,23 @@ class PasswordRecord : public YACURS::Dialog {
     bool _force_close;
     bool _modified_by_pwgen;
 
+    /**
+     * The password last estimated, and the state kept to estimate its
+     * successors incrementally.
+     */
+    std::string _estimated_password;
+    yapet::strength::StrengthEstimator::State _estimator_state;
+
+    void update_strength();
+
     virtual void on_ok_button();
 
     void button_press_handler(YACURS::Event& e);
 
     void window_close_handler(YACURS::Event& e);
 
+    void update_handler(YACURS::Event& e);
+
     virtual bool on_close();
 
    public:
@@ -114,6 +130,7 @@ class PasswordRecord : public YACURS::Dialog {
      * except the password record is displaying in read-only mode.
      */
     PasswordRecord(std::shared_ptr<yapet::AbstractCryptoFactory>& cryptoFactory,
+                   yapet::RecordCache& recordCache,
                    const yapet::PasswordListItem& passwordListItem);
     PasswordRecord(
         std::shared_ptr<yapet::AbstractCryptoFactory>& cryptoFactory);
@@ -153,6 +170,11 @@ class PasswordRecord : public YACURS::Dialog {
      */
     bool changed() const;
 
+    /**
+     * @brief The tags as entered in the dialog.
+     */
+    std::string tags_input() const { return tags->input(); }
+
     void readonly(bool f);
 
     bool readonly() const { return _readonly; }
@@ -31,13 +31,141 @@
 #include "config.h"
 #endif
 
+#include <cmath>
+#include <cstdio>
+
+#include "consts.h"
 #include "globals.h"
 #include "intl.h"
 #include "pwgendialog.h"
+#include "wordlist.hh"
 
 //
 // Private
 //
+bool PwGenDialog::load_wordlist(std::string& error) {
+    if (passphraseGenerator) return true;
+
+    try {
+        std::string filename{YAPET::Globals::config.pwgen_wordlist.get()};
+        auto wordlist = filename.empty()
+                            ? yapet::pwgen::Wordlist::loadDefault()
+                            : std::make_shared<const yapet::pwgen::Wordlist>(
+                                  filename);
+        passphraseGenerator.reset(new yapet::pwgen::PassphraseGenerator{
+            wordlist, YAPET::Globals::config.pwgen_words,
+            YAPET::Globals::config.pwgen_separator,
+            yapet::pwgen::parseCapitalization(
+                YAPET::Globals::config.pwgen_capitalization)});
+        return true;
+    } catch (std::exception& ex) {
+        error = ex.what();
+        return false;
+    }
+}
+
+bool PwGenDialog::load_profile(std::string& error) {
+    if (policyGenerator) return true;
+
+    std::string name{YAPET::Globals::config.pwgen_profile.get()};
+    auto profiles = YAPET::Globals::config.pwgen_rules.get();
+    auto profile = profiles.find(name);
+    if (profile == profiles.end()) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Unknown rule profile '%s'"), name.c_str());
+        error = msg;
+        return false;
+    }
+
+    try {
+        policyGenerator.reset(new yapet::pwgen::PolicyGenerator{
+            yapet::pwgen::Policy::parse(profile->second)});
+        return true;
+    } catch (std::invalid_argument& ex) {
+        error = ex.what();
+        return false;
+    }
+}
+
+void PwGenDialog::transfer_passphrase_options() {
+    // Configuration takes care of sanitizing number with respect to
+    // min/max value.
+    YAPET::Globals::config.pwgen_words.set_str(words.input());
+    std::ostringstream conv;
+    conv << YAPET::Globals::config.pwgen_words.get();
+    words.input(conv.str());
+
+    YAPET::Globals::config.pwgen_separator.set(separator.input());
+
+    if (passphraseGenerator) {
+        passphraseGenerator->words(YAPET::Globals::config.pwgen_words);
+        passphraseGenerator->separator(YAPET::Globals::config.pwgen_separator);
+    }
+}
+
+void PwGenDialog::generate() {
+    char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+    // Tells why the password generator is used, if passphrases or rules
+    // were asked for
+    std::string error{" "};
+
+    try {
+        if (YAPET::Globals::config.pwgen_passphrase) {
+            if (load_wordlist(error)) {
+                auto passphrase{passphraseGenerator->generatePassphrase()};
+                genpw.input(reinterpret_cast<const char*>(*passphrase));
+
+                std::snprintf(msg,
+                              YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                              _("Entropy: %d bits"),
+                              static_cast<int>(std::floor(
+                                  passphraseGenerator->entropy())));
+                entropylabel.label(msg);
+                return;
+            }
+        } else if (YAPET::Globals::config.pwgen_pronounceable) {
+            auto password{pronounceableGenerator.generatePassword(
+                YAPET::Globals::config.pwgenpwlen)};
+            genpw.input(reinterpret_cast<const char*>(*password));
+
+            std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                          _("Entropy: %d bits"),
+                          static_cast<int>(std::floor(
+                              yapet::pwgen::PronounceableGenerator::entropy(
+                                  YAPET::Globals::config.pwgenpwlen))));
+            entropylabel.label(msg);
+            return;
+        } else if (!YAPET::Globals::config.pwgen_profile.get().empty() &&
+                   load_profile(error)) {
+            // Transfer the length allowed by the rules back to input
+            int size = policyGenerator->policy().clampLength(
+                YAPET::Globals::config.pwgenpwlen);
+            if (size != YAPET::Globals::config.pwgenpwlen) {
+                YAPET::Globals::config.pwgenpwlen.set(size);
+                pwlen.input(YAPET::Globals::config.pwgenpwlen);
+            }
+
+            auto password{policyGenerator->generatePassword(
+                YAPET::Globals::config.pwgenpwlen)};
+            genpw.input(reinterpret_cast<const char*>(*password));
+
+            std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                          _("Entropy: %d bits"),
+                          static_cast<int>(std::floor(policyGenerator->entropy(
+                              YAPET::Globals::config.pwgenpwlen))));
+            entropylabel.label(msg);
+            return;
+        }
+    } catch (std::invalid_argument& ex) {
+        error = ex.what();
+    }
+
+    auto password{passwordGenerator.generatePassword(
+        YAPET::Globals::config.pwgenpwlen)};
+    genpw.input(reinterpret_cast<const char*>(*password));
+    entropylabel.label(error);
+}
 
 //
 // Protected
@@ -71,6 +199,41 @@ void PwGenDialog::checkbox_selection_handler(YACURS::Event& _e) {
             YAPET::Globals::config.character_pools());
         return;
     }
+
+    if (evt.data() == profiles) {
+        // Item 0 selects the character pools
+        std::string selected;
+        for (const auto& profile : YAPET::Globals::config.pwgen_rules.get()) {
+            if (profiles->selected(profile.first)) selected = profile.first;
+        }
+        YAPET::Globals::config.pwgen_profile.set(selected);
+        policyGenerator.reset();
+        generate();
+        return;
+    }
+
+    if (evt.data() == mode) {
+        YAPET::Globals::config.pwgen_passphrase.set(
+            mode->selected(_("Passphrase")));
+        YAPET::Globals::config.pwgen_pronounceable.set(
+            mode->selected(_("Pronounceable")));
+        generate();
+        return;
+    }
+
+    if (evt.data() == capitalization) {
+        yapet::pwgen::Capitalization selected{
+            yapet::pwgen::Capitalization::NONE};
+        if (capitalization->selected(_("Capitalized")))
+            selected = yapet::pwgen::Capitalization::FIRST;
+        if (capitalization->selected(_("Randomly capitalized")))
+            selected = yapet::pwgen::Capitalization::RANDOM;
+
+        YAPET::Globals::config.pwgen_capitalization.set(
+            yapet::pwgen::capitalizationName(selected));
+        if (passphraseGenerator) passphraseGenerator->capitalization(selected);
+        return;
+    }
 }
 
 void PwGenDialog::button_press_handler(YACURS::Event& _e) {
@@ -89,9 +252,8 @@ void PwGenDialog::button_press_handler(YACURS::Event& _e) {
         // place and changed the value
         pwlen.input(YAPET::Globals::config.pwgenpwlen);
 
-        auto password{passwordGenerator.generatePassword(
-            YAPET::Globals::config.pwgenpwlen)};
-        genpw.input(reinterpret_cast<const char*>(*password));
+        transfer_passphrase_options();
+        generate();
     }
 }
 
@@ -102,20 +264,62 @@ PwGenDialog::PwGenDialog()
     : YACURS::Dialog{_("Password Generator"), YACURS::OKCANCEL,
                      YACURS::AUTOMATIC},
       passwordGenerator{YAPET::Globals::config.character_pools()},
+      passphraseGenerator{},
+      policyGenerator{},
+      pronounceableGenerator{},
       mainpack{},
+      optionspack{},
+      passwordpack{},
+      passphrasepack{},
       genpwlabel{_("Generated password")},
       genpw{},
+      entropylabel{" "},
       pwlenlabel{_("Password length")},
       pwlen{},
+      wordslabel{_("Passphrase words")},
+      words{},
+      separatorlabel{_("Word separator")},
+      separator{},
       regenbutton_spacer{},
       regenbutton{_("Regenerate")} {
     // coloring
     genpwlabel.color(YACURS::DIALOG);
+    entropylabel.color(YACURS::DIALOG);
     pwlenlabel.color(YACURS::DIALOG);
+    wordslabel.color(YACURS::DIALOG);
+    separatorlabel.color(YACURS::DIALOG);
 
     genpw.max_input(256);
     pwlen.max_input(3);
     pwlen.filter(YACURS::FilterDigit());
+    words.max_input(2);
+    words.filter(YACURS::FilterDigit());
+    separator.max_input(8);
+
+    std::vector<std::string> modes;
+    modes.push_back(_("Password"));
+    modes.push_back(_("Pronounceable"));
+    modes.push_back(_("Passphrase"));
+    mode = new YACURS::RadioBox(_("Generate"), modes);
+    if (YAPET::Globals::config.pwgen_passphrase)
+        mode->set_selection(2);
+    else if (YAPET::Globals::config.pwgen_pronounceable)
+        mode->set_selection(1);
+    else
+        mode->set_selection(0);
+
+    // Rule profiles are listed after the character pools, see
+    // PwGenDialog::checkbox_selection_handler()
+    std::vector<std::string> profilenames;
+    profilenames.push_back(_("Character pools"));
+    std::size_t profileselection = 0;
+    for (const auto& profile : YAPET::Globals::config.pwgen_rules.get()) {
+        if (profile.first == YAPET::Globals::config.pwgen_profile.get())
+            profileselection = profilenames.size();
+        profilenames.push_back(profile.first);
+    }
+    profiles = new YACURS::RadioBox(_("Rules"), profilenames);
+    profiles->set_selection(profileselection);
 
     std::vector<std::string> labels;
 
@@ -140,13 +344,36 @@ PwGenDialog::PwGenDialog()
     if (yapet::pwgen::isOther(YAPET::Globals::config.character_pools()))
         charpools->set_selection(_("Other"));
 
+    // If labels are updated, please make sure
+    // PwGenDialog::checkbox_selection_handler() is adjusted accordingly.
+    std::vector<std::string> capitalizations;
+    capitalizations.push_back(_("Unchanged"));
+    capitalizations.push_back(_("Capitalized"));
+    capitalizations.push_back(_("Randomly capitalized"));
+    capitalization = new YACURS::RadioBox(_("Words"), capitalizations);
+    capitalization->set_selection(static_cast<std::size_t>(
+        yapet::pwgen::parseCapitalization(
+            YAPET::Globals::config.pwgen_capitalization)));
+
     mainpack.add_back(&genpwlabel);
     mainpack.add_back(&genpw);
+    mainpack.add_back(&entropylabel);
+    mainpack.add_back(mode);
+
+    passwordpack.add_back(&pwlenlabel);
+    passwordpack.add_back(&pwlen);
+    passwordpack.add_back(charpools);
+    passwordpack.add_back(profiles);
 
-    mainpack.add_back(&pwlenlabel);
-    mainpack.add_back(&pwlen);
+    passphrasepack.add_back(&wordslabel);
+    passphrasepack.add_back(&words);
+    passphrasepack.add_back(&separatorlabel);
+    passphrasepack.add_back(&separator);
+    passphrasepack.add_back(capitalization);
 
-    mainpack.add_back(charpools);
+    optionspack.add_back(&passwordpack);
+    optionspack.add_back(&passphrasepack);
+    mainpack.add_back(&optionspack);
 
     widget(&mainpack);
 
@@ -159,9 +386,12 @@ PwGenDialog::PwGenDialog()
     conv << YAPET::Globals::config.pwgenpwlen.get();
     pwlen.input(conv.str());
 
-    auto password{passwordGenerator.generatePassword(
-        YAPET::Globals::config.pwgenpwlen.get())};
-    genpw.input(reinterpret_cast<const char*>(*password));
+    conv.str("");
+    conv << YAPET::Globals::config.pwgen_words.get();
+    words.input(conv.str());
+    separator.input(YAPET::Globals::config.pwgen_separator);
+
+    generate();
 
     YACURS::EventQueue::connect_event(
         YACURS::EventConnectorMethod1<PwGenDialog>(
@@ -175,5 +405,8 @@ PwGenDialog::~PwGenDialog() {
             YACURS::EVT_CHECKBOX_SELECTION, this,
             &PwGenDialog::checkbox_selection_handler));
 
+    delete mode;
     delete charpools;
+    delete profiles;
+    delete capitalization;
 }
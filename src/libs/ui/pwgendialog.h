@@ -34,27 +34,72 @@
 #include "config.h"
 #endif
 
+#include <memory>
+
+#include "passphrase.hh"
+#include "policygenerator.hh"
+#include "pronounceable.hh"
 #include "pwgen.hh"
 
 #include <yacurs.h>
 
 /**
+ * Generates passwords from character pools or satisfying the rules of a
+ * profile, pronounceable passwords, or passphrases from the words of a word
+ * list.
  */
 class PwGenDialog : public YACURS::Dialog {
    private:
     yapet::pwgen::PasswordGenerator passwordGenerator;
+    std::unique_ptr<yapet::pwgen::PassphraseGenerator> passphraseGenerator;
+    std::unique_ptr<yapet::pwgen::PolicyGenerator> policyGenerator;
+    yapet::pwgen::PronounceableGenerator pronounceableGenerator;
     YACURS::VPack mainpack;
+    YACURS::HPack optionspack;
+    YACURS::VPack passwordpack;
+    YACURS::VPack passphrasepack;
 
     YACURS::Label genpwlabel;
     YACURS::Input<> genpw;
+    YACURS::Label entropylabel;
 
     YACURS::Label pwlenlabel;
     YACURS::Input<> pwlen;
 
+    YACURS::Label wordslabel;
+    YACURS::Input<> words;
+
+    YACURS::Label separatorlabel;
+    YACURS::Input<> separator;
+
     YACURS::Spacer regenbutton_spacer;
     YACURS::Button regenbutton;
 
+    YACURS::RadioBox* mode;
     YACURS::CheckBox* charpools;
+    YACURS::RadioBox* profiles;
+    YACURS::RadioBox* capitalization;
+
+    /**
+     * Creates the passphrase generator from the configured word list, unless
+     * already done.
+     *
+     * @return \c false if the word list cannot be loaded, and the reason in
+     * \c error.
+     */
+    bool load_wordlist(std::string& error);
+
+    /**
+     * Creates the generator of passwords satisfying the rules of the
+     * configured profile, unless already done.
+     *
+     * @return \c false if the rules cannot be used, and the reason in \c
+     * error.
+     */
+    bool load_profile(std::string& error);
+
+    void transfer_passphrase_options();
+    void generate();
 
    protected:
     virtual void checkbox_selection_handler(YACURS::Event& _e);
@@ -51,7 +51,7 @@ YapetLockScreen::YapetLockScreen(YACURS::Window& mainWindow,
                                  unsigned int timeout,
                                  unsigned int ulck_timeout)
     : LockScreen{_unlock, timeout, ulck_timeout},
-      _mainWindow{dynamic_cast<const MainWindow&>(mainWindow)} {}
+      _mainWindow{dynamic_cast<MainWindow&>(mainWindow)} {}
 
 YapetLockScreen::~YapetLockScreen() {}
 
@@ -61,6 +61,9 @@ void YapetLockScreen::show() {
         return;
     }
 
+    // Do not keep decrypted records while nobody is around
+    _mainWindow.flush_record_cache();
+
     LockScreen::show();
 
     YACURS::Curses::set_terminal_title(_("YAPET LOCKED"));
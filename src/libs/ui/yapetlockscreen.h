@@ -39,7 +39,7 @@
 
 class YapetLockScreen : public YACURS::LockScreen {
    private:
-    const MainWindow& _mainWindow;
+    MainWindow& _mainWindow;
 
    public:
     YapetLockScreen(YACURS::Window& mainWindow, YACURS::UnlockDialog* _unlock,
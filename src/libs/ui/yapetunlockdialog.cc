@@ -31,10 +31,34 @@
 #include "config.h"
 #endif
 
+#include <signal.h>
+#include <unistd.h>
+
 #include "globals.h"
 #include "intl.h"
+#include "keyderivationdialog.h"
 #include "yapetunlockdialog.h"
 
+//
+// Private
+//
+void YapetUnlockDialog::sigusr1_handler(YACURS::Event& _e) {
+    assert(_e == YACURS::EVT_SIGUSR1);
+
+    if (!_derivation || _derivation->cancelled()) return;
+
+    if (_derivation->finished()) {
+        // on_close() lets the dialog close now, and unlock() compares the
+        // key
+        close();
+        return;
+    }
+
+    _ticks++;
+    _text3->label(std::string{_("Checking password ")} +
+                  KeyDerivationDialog::spinner(_ticks));
+}
+
 //
 // Protected
 //
@@ -52,6 +76,28 @@ void YapetUnlockDialog::window_show_handler(YACURS::Event& _e) {
     }
 }
 
+bool YapetUnlockDialog::on_close() {
+    if (dialog_state() != YACURS::DIALOG_OK) {
+        _derivation.reset();
+        return true;
+    }
+
+    if (_derivation) return _derivation->finished();
+
+    // Derive the key on a worker thread and keep the dialog open until
+    // it is available
+    auto suppliedPassword{yapet::toSecureArray(_secret_input->input())};
+    _derivation.reset(new yapet::KeyDerivation{
+        []() { ::kill(::getpid(), SIGUSR1); }});
+    _derivation->add(_mainWindow.passwordKeyDerivation(suppliedPassword));
+    _derivation->start();
+
+    _ticks = 0;
+    _text3->label(std::string{_("Checking password ")} +
+                  KeyDerivationDialog::spinner(0));
+    return false;
+}
+
 void YapetUnlockDialog::button_press_handler(YACURS::Event& _e) {
     UnlockDialog::button_press_handler(_e);
 
@@ -76,7 +122,9 @@ YapetUnlockDialog::YapetUnlockDialog(const YACURS::Window& mainWindow)
       _text3{new YACURS::DynLabel{_("in order to unlock screen")}},
       _secret_input{new YACURS::Input<>{}},
       _quit{nullptr},
-      _quit_spacer{nullptr} {
+      _quit_spacer{nullptr},
+      _derivation{},
+      _ticks{0} {
     _vpack = new YACURS::VPack;
     _vpack->always_dynamic(true);
 
@@ -104,6 +152,9 @@ YapetUnlockDialog::YapetUnlockDialog(const YACURS::Window& mainWindow)
         YACURS::EventConnectorMethod1<YapetUnlockDialog>(
             YACURS::EVT_WINDOW_SHOW, this,
             &YapetUnlockDialog::window_show_handler));
+    YACURS::EventQueue::connect_event(
+        YACURS::EventConnectorMethod1<YapetUnlockDialog>(
+            YACURS::EVT_SIGUSR1, this, &YapetUnlockDialog::sigusr1_handler));
 }
 
 YapetUnlockDialog::~YapetUnlockDialog() {
@@ -117,6 +168,9 @@ YapetUnlockDialog::~YapetUnlockDialog() {
         YACURS::EventConnectorMethod1<YapetUnlockDialog>(
             YACURS::EVT_WINDOW_SHOW, this,
             &YapetUnlockDialog::window_show_handler));
+    YACURS::EventQueue::disconnect_event(
+        YACURS::EventConnectorMethod1<YapetUnlockDialog>(
+            YACURS::EVT_SIGUSR1, this, &YapetUnlockDialog::sigusr1_handler));
 
     delete _text1;
     delete _text2;
@@ -130,12 +184,22 @@ YapetUnlockDialog::~YapetUnlockDialog() {
 }
 
 bool YapetUnlockDialog::unlock() {
-    if (dialog_state() == YACURS::DIALOG_OK) {
-        auto suppliedPassword{yapet::toSecureArray(_secret_input->input())};
-        return _mainWindow.matchPasswordWithCurrent(suppliedPassword);
+    bool unlocked{false};
+    if (dialog_state() == YACURS::DIALOG_OK && _derivation &&
+        _derivation->finished()) {
+        try {
+            unlocked = _mainWindow.matchKeyWithCurrent(_derivation->result(0));
+        } catch (std::exception&) {
+            // Treat like a wrong password
+        }
     }
 
-    return false;
+    _derivation.reset();
+    return unlocked;
 }
 
-void YapetUnlockDialog::clear() { _secret_input->clear(); }
+void YapetUnlockDialog::clear() {
+    _derivation.reset();
+    _text3->label(_("in order to unlock screen"));
+    _secret_input->clear();
+}
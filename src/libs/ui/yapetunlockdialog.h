@@ -35,8 +35,17 @@
 #endif
 
 #include <yacurs.h>
+
+#include <memory>
+
+#include "keyderivation.hh"
 #include "mainwindow.h"
 
+/**
+ * The key of the password entered is derived on a worker thread, so that
+ * the dialog is only closed, and the password checked by \c unlock(), once
+ * it is available.
+ */
 class YapetUnlockDialog : public YACURS::UnlockDialog {
    private:
     const MainWindow& _mainWindow;
@@ -49,9 +58,16 @@ class YapetUnlockDialog : public YACURS::UnlockDialog {
     YACURS::Button* _quit;
     YACURS::Spacer* _quit_spacer;
 
+    std::unique_ptr<yapet::KeyDerivation> _derivation;
+    int _ticks;
+
+    void sigusr1_handler(YACURS::Event& _e);
+
    protected:
     void window_show_handler(YACURS::Event& _e);
 
+    virtual bool on_close();
+
     // From dialog
     void button_press_handler(YACURS::Event& _e);
 
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _BOUNDEDQUEUE_HH
+#define _BOUNDEDQUEUE_HH
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+namespace yapet {
+/**
+ * Blocking FIFO queue holding at most a fixed number of items.
+ *
+ * Used to connect the stages of a producer/consumer pipeline. \c push()
+ * blocks while the queue is full and \c pop() blocks while it is empty, so a
+ * fast stage cannot run arbitrarily far ahead of a slow one.
+ *
+ * Once \c close() has been called, \c push() fails and \c pop() drains the
+ * items still queued before failing as well.
+ */
+template <class T>
+class BoundedQueue {
+   private:
+    std::size_t _capacity;
+    bool _closed;
+    std::deque<T> _items;
+    std::mutex _mutex;
+    std::condition_variable _notFull;
+    std::condition_variable _notEmpty;
+
+   public:
+    explicit BoundedQueue(std::size_t capacity)
+        : _capacity{capacity == 0 ? 1 : capacity}, _closed{false}, _items{} {}
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue(BoundedQueue&&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(BoundedQueue&&) = delete;
+
+    /**
+     * Append \c item, waiting for space if the queue is full.
+     *
+     * @return \c false if the queue has been closed, in which case \c item
+     * has not been queued.
+     */
+    bool push(T item) {
+        std::unique_lock<std::mutex> lock{_mutex};
+        _notFull.wait(lock, [this] {
+            return _closed || _items.size() < _capacity;
+        });
+        if (_closed) return false;
+
+        _items.push_back(std::move(item));
+        lock.unlock();
+        _notEmpty.notify_one();
+        return true;
+    }
+
+    /**
+     * Remove the oldest item, waiting for one if the queue is empty.
+     *
+     * @return \c false if the queue has been closed and is empty.
+     */
+    bool pop(T& item) {
+        std::unique_lock<std::mutex> lock{_mutex};
+        _notEmpty.wait(lock, [this] { return _closed || !_items.empty(); });
+        if (_items.empty()) return false;
+
+        item = std::move(_items.front());
+        _items.pop_front();
+        lock.unlock();
+        _notFull.notify_one();
+        return true;
+    }
+
+    /**
+     * Close the queue, waking up all waiting threads.
+     */
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _closed = true;
+        }
+        _notFull.notify_all();
+        _notEmpty.notify_all();
+    }
+
+    std::size_t capacity() const { return _capacity; }
+};
+}  // namespace yapet
+
+#endif
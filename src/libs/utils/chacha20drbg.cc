@@ -0,0 +1,248 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <pthread.h>
+#include <unistd.h>
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
+#if defined(HAVE_GETRANDOM) && defined(HAVE_SYS_RANDOM_H)
+#include <sys/random.h>
+#define USE_GETRANDOM 1
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <stdexcept>
+#include <string>
+
+#include "chacha20drbg.hh"
+#include "intl.h"
+
+using namespace yapet;
+
+constexpr std::size_t ChaCha20Drbg::KEY_SIZE;
+constexpr std::size_t ChaCha20Drbg::BLOCK_SIZE;
+constexpr std::size_t ChaCha20Drbg::BUFFER_SIZE;
+constexpr std::size_t ChaCha20Drbg::RESEED_INTERVAL;
+
+namespace {
+constexpr std::uint32_t SIGMA[4]{0x61707865, 0x3320646e, 0x79622d32,
+                                 0x6b206574};
+constexpr std::uint32_t ZERO_NONCE[3]{0, 0, 0};
+
+thread_local ChaCha20Drbg* currentThreadDrbg{nullptr};
+
+inline std::uint32_t rotateLeft(std::uint32_t value, int bits) {
+    return (value << bits) | (value >> (32 - bits));
+}
+
+inline void quarterRound(std::uint32_t* x, int a, int b, int c, int d) {
+    x[a] += x[b];
+    x[d] = rotateLeft(x[d] ^ x[a], 16);
+    x[c] += x[d];
+    x[b] = rotateLeft(x[b] ^ x[c], 12);
+    x[a] += x[b];
+    x[d] = rotateLeft(x[d] ^ x[a], 8);
+    x[c] += x[d];
+    x[b] = rotateLeft(x[b] ^ x[c], 7);
+}
+
+inline std::uint32_t load32(const std::uint8_t* bytes) {
+    return std::uint32_t(bytes[0]) | std::uint32_t(bytes[1]) << 8 |
+           std::uint32_t(bytes[2]) << 16 | std::uint32_t(bytes[3]) << 24;
+}
+
+inline void store32(std::uint8_t* bytes, std::uint32_t value) {
+    bytes[0] = value & 0xff;
+    bytes[1] = (value >> 8) & 0xff;
+    bytes[2] = (value >> 16) & 0xff;
+    bytes[3] = (value >> 24) & 0xff;
+}
+
+void readEntropy(std::uint8_t* buffer, std::size_t size) {
+#ifdef USE_GETRANDOM
+    std::size_t filled = 0;
+    while (filled < size) {
+        auto retval = ::getrandom(buffer + filled, size - filled, 0);
+        if (retval < 0 && errno == EINTR) continue;
+        if (retval <= 0) {
+            throw std::runtime_error(_("Error reading random bytes"));
+        }
+        filled += static_cast<std::size_t>(retval);
+    }
+#else
+    constexpr char DEV_URANDOM[]{"/dev/urandom"};
+    auto fd{::open(DEV_URANDOM, O_RDONLY)};
+    if (fd == -1) {
+        throw std::runtime_error(std::string{_("Cannot open ")} +
+                                 DEV_URANDOM);
+    }
+
+    std::size_t filled = 0;
+    while (filled < size) {
+        auto retval = ::read(fd, buffer + filled, size - filled);
+        if (retval < 0 && errno == EINTR) continue;
+        if (retval <= 0) {
+            ::close(fd);
+            throw std::runtime_error(_("Error reading random bytes"));
+        }
+        filled += static_cast<std::size_t>(retval);
+    }
+    ::close(fd);
+#endif
+}
+}  // namespace
+
+void ChaCha20Drbg::block(const std::uint32_t key[8], std::uint32_t counter,
+                         const std::uint32_t nonce[3],
+                         std::uint8_t out[BLOCK_SIZE]) {
+    std::uint32_t input[16]{SIGMA[0], SIGMA[1], SIGMA[2], SIGMA[3],
+                            key[0],   key[1],   key[2],   key[3],
+                            key[4],   key[5],   key[6],   key[7],
+                            counter,  nonce[0], nonce[1], nonce[2]};
+    std::uint32_t x[16];
+    std::copy(input, input + 16, x);
+
+    for (int i = 0; i < 10; i++) {
+        quarterRound(x, 0, 4, 8, 12);
+        quarterRound(x, 1, 5, 9, 13);
+        quarterRound(x, 2, 6, 10, 14);
+        quarterRound(x, 3, 7, 11, 15);
+        quarterRound(x, 0, 5, 10, 15);
+        quarterRound(x, 1, 6, 11, 12);
+        quarterRound(x, 2, 7, 8, 13);
+        quarterRound(x, 3, 4, 9, 14);
+    }
+
+    for (int i = 0; i < 16; i++) {
+        store32(out + 4 * i, x[i] + input[i]);
+    }
+
+    std::fill(x, x + 16, 0);
+    std::fill(input, input + 16, 0);
+}
+
+void ChaCha20Drbg::afterFork() {
+    // Parent and child share the state now. Reading from the kernel is
+    // deferred to the next refill, since it may fail.
+    if (currentThreadDrbg != nullptr) {
+        std::memset(currentThreadDrbg->_buffer, 0, BUFFER_SIZE);
+        currentThreadDrbg->_position = BUFFER_SIZE;
+        currentThreadDrbg->_reseedPending = true;
+    }
+}
+
+ChaCha20Drbg::ChaCha20Drbg()
+    : _key{0},
+      _buffer{0},
+      _position{BUFFER_SIZE},
+      _generatedSinceSeed{0},
+      _reseedPending{false} {
+    reseed();
+}
+
+ChaCha20Drbg::ChaCha20Drbg(const std::uint8_t* seed)
+    : _key{0},
+      _buffer{0},
+      _position{BUFFER_SIZE},
+      _generatedSinceSeed{0},
+      _reseedPending{false} {
+    for (std::size_t i = 0; i < KEY_SIZE / 4; i++) {
+        _key[i] = load32(seed + 4 * i);
+    }
+}
+
+ChaCha20Drbg::~ChaCha20Drbg() {
+    std::memset(_key, 0, sizeof(_key));
+    std::memset(_buffer, 0, BUFFER_SIZE);
+}
+
+void ChaCha20Drbg::reseed() {
+    std::uint8_t entropy[KEY_SIZE];
+    readEntropy(entropy, KEY_SIZE);
+
+    for (std::size_t i = 0; i < KEY_SIZE / 4; i++) {
+        _key[i] ^= load32(entropy + 4 * i);
+    }
+    std::memset(entropy, 0, KEY_SIZE);
+    std::memset(_buffer, 0, BUFFER_SIZE);
+
+    _position = BUFFER_SIZE;
+    _generatedSinceSeed = 0;
+    _reseedPending = false;
+}
+
+void ChaCha20Drbg::refill() {
+    if (_reseedPending || _generatedSinceSeed >= RESEED_INTERVAL) {
+        reseed();
+    }
+
+    for (std::size_t i = 0; i < BUFFER_SIZE / BLOCK_SIZE; i++) {
+        block(_key, i, ZERO_NONCE, _buffer + i * BLOCK_SIZE);
+    }
+
+    // The key used is replaced by the first bytes of its output, which are
+    // never returned
+    for (std::size_t i = 0; i < KEY_SIZE / 4; i++) {
+        _key[i] = load32(_buffer + 4 * i);
+    }
+    std::memset(_buffer, 0, KEY_SIZE);
+
+    _position = KEY_SIZE;
+    _generatedSinceSeed += BUFFER_SIZE - KEY_SIZE;
+}
+
+void ChaCha20Drbg::generate(std::uint8_t* buffer, std::size_t size) {
+    while (size > 0) {
+        if (_position == BUFFER_SIZE) refill();
+
+        auto chunk = std::min(size, BUFFER_SIZE - _position);
+        std::memcpy(buffer, _buffer + _position, chunk);
+        std::memset(_buffer + _position, 0, chunk);
+
+        _position += chunk;
+        buffer += chunk;
+        size -= chunk;
+    }
+}
+
+ChaCha20Drbg& ChaCha20Drbg::threadLocal() {
+    static const int atforkRegistered =
+        ::pthread_atfork(nullptr, nullptr, &ChaCha20Drbg::afterFork);
+    (void)atforkRegistered;
+
+    thread_local ChaCha20Drbg drbg;
+    currentThreadDrbg = &drbg;
+    return drbg;
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _CHACHA20DRBG_HH
+#define _CHACHA20DRBG_HH
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace yapet {
+/**
+ * @brief Random bit generator based on the ChaCha20 stream cipher
+ *
+ * The generator is seeded from \c getrandom(2), or \c /dev/urandom where
+ * \c getrandom(2) is not available, and reseeded after \c RESEED_INTERVAL
+ * bytes and in the child after \c fork(2). Output is produced in batches of \c
+ * BUFFER_SIZE bytes: the first 32 bytes of each batch replace the key
+ * ("fast key erasure"), so bytes already returned cannot be reconstructed
+ * from the state.
+ *
+ * Instances are not thread-safe. Use \c threadLocal() or \c RandomEngine
+ * instead of creating instances.
+ */
+class ChaCha20Drbg {
+   public:
+    static constexpr std::size_t KEY_SIZE{32};
+    static constexpr std::size_t BLOCK_SIZE{64};
+    static constexpr std::size_t BUFFER_SIZE{16 * BLOCK_SIZE};
+    static constexpr std::size_t RESEED_INTERVAL{1024 * 1024};
+
+   private:
+    std::uint32_t _key[KEY_SIZE / 4];
+    std::uint8_t _buffer[BUFFER_SIZE];
+    std::size_t _position;
+    std::size_t _generatedSinceSeed;
+    bool _reseedPending;
+
+    void refill();
+    static void afterFork();
+
+   public:
+    /**
+     * Create a generator seeded from the kernel.
+     */
+    ChaCha20Drbg();
+    /**
+     * Create a generator seeded with the \c KEY_SIZE bytes of \c seed.
+     *
+     * The output is determined by \c seed until the generator is reseeded,
+     * which is meant for tests only.
+     */
+    explicit ChaCha20Drbg(const std::uint8_t* seed);
+    ~ChaCha20Drbg();
+
+    ChaCha20Drbg(const ChaCha20Drbg&) = delete;
+    ChaCha20Drbg& operator=(const ChaCha20Drbg&) = delete;
+    ChaCha20Drbg(ChaCha20Drbg&&) = delete;
+    ChaCha20Drbg& operator=(ChaCha20Drbg&&) = delete;
+
+    /**
+     * Mix fresh bytes from the kernel into the key and discard buffered
+     * output.
+     */
+    void reseed();
+
+    /**
+     * Fill \c size bytes at \c buffer with random bytes.
+     */
+    void generate(std::uint8_t* buffer, std::size_t size);
+
+    std::uint32_t next32() {
+        if (BUFFER_SIZE - _position < sizeof(std::uint32_t)) refill();
+        std::uint32_t value;
+        std::memcpy(&value, _buffer + _position, sizeof(value));
+        std::memset(_buffer + _position, 0, sizeof(value));
+        _position += sizeof(value);
+        return value;
+    }
+
+    /**
+     * The generator of the calling thread.
+     */
+    static ChaCha20Drbg& threadLocal();
+
+    /**
+     * The ChaCha20 block function as specified by RFC 8439: write the key
+     * stream block \c counter for \c key and \c nonce to \c out.
+     */
+    static void block(const std::uint32_t key[8], std::uint32_t counter,
+                      const std::uint32_t nonce[3],
+                      std::uint8_t out[BLOCK_SIZE]);
+};
+
+/**
+ * @brief UniformRandomBitGenerator drawing from the generator of the calling
+ * thread
+ *
+ * Instances hold no state, so they are cheap to create, copy, and move, and
+ * may be used with the distributions of \c <random>.
+ */
+class RandomEngine {
+   public:
+    using result_type = std::uint32_t;
+    static constexpr result_type min() {
+        return std::numeric_limits<result_type>::min();
+    }
+    static constexpr result_type max() {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    result_type operator()() { return ChaCha20Drbg::threadLocal().next32(); }
+};
+
+/**
+ * Fill \c size bytes at \c buffer with random bytes from the generator of
+ * the calling thread.
+ */
+inline void randomBytes(std::uint8_t* buffer, std::size_t size) {
+    ChaCha20Drbg::threadLocal().generate(buffer, size);
+}
+}  // namespace yapet
+
+#endif
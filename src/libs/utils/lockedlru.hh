@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _LOCKEDLRU_HH
+#define _LOCKEDLRU_HH
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+#include "lockedslab.hh"
+
+namespace yapet {
+/**
+ * The value of \c LockedLru entries holding data only.
+ */
+struct NoValue {};
+
+/**
+ * Least recently used map of byte strings kept in a \c LockedSlab.
+ *
+ * Each entry holds up to a slot of data in the slab, along with a \c Value
+ * kept in ordinary memory. Storing an entry while all slots are used drops
+ * the least recently used entry. The slot of an entry dropped is zeroed.
+ *
+ * The map is not safe to be used by several threads.
+ */
+template <typename Value = NoValue>
+class LockedLru {
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry {
+        std::string key;
+        std::size_t slot;
+        std::size_t size;
+        Clock::time_point lastUsed;
+        Value value;
+    };
+
+    using iterator = typename std::list<Entry>::iterator;
+
+   private:
+    LockedSlab _slab;
+    // Most recently used entry first
+    std::list<Entry> _lru;
+    std::unordered_map<std::string, iterator> _index;
+
+   public:
+    /**
+     * @param capacity the number of entries held. Nothing can be stored if
+     * zero.
+     *
+     * @param slotSize the maximum size of the data of an entry.
+     */
+    LockedLru(std::size_t capacity, std::size_t slotSize)
+        : _slab{capacity, slotSize}, _lru{}, _index{} {
+        _index.reserve(capacity);
+    }
+
+    LockedLru(const LockedLru&) = delete;
+    LockedLru(LockedLru&&) = delete;
+    LockedLru& operator=(const LockedLru&) = delete;
+    LockedLru& operator=(LockedLru&&) = delete;
+
+    iterator begin() { return _lru.begin(); }
+    iterator end() { return _lru.end(); }
+
+    /**
+     * @return \c end() if no entry has the key \c key.
+     */
+    iterator find(const std::string& key) {
+        auto found{_index.find(key)};
+        return found == _index.end() ? _lru.end() : found->second;
+    }
+
+    /**
+     * The least recently used entry. The map must not be empty.
+     */
+    iterator leastRecentlyUsed() { return std::prev(_lru.end()); }
+
+    /**
+     * The data of \c entry in the slab.
+     */
+    std::uint8_t* data(iterator entry) const {
+        return _slab.slot(entry->slot);
+    }
+
+    /**
+     * Mark \c entry as used at \c now.
+     */
+    void touch(iterator entry, Clock::time_point now) {
+        entry->lastUsed = now;
+        _lru.splice(_lru.begin(), _lru, entry);
+    }
+
+    /**
+     * Store \c size bytes at \c data with the key \c key, replacing the
+     * entry with the same key. \c size must not exceed the slot size, and
+     * the capacity must not be zero.
+     */
+    iterator store(const std::string& key, const std::uint8_t* data,
+                   std::size_t size, Clock::time_point now,
+                   const Value& value = Value{}) {
+        auto found{find(key)};
+        if (found != _lru.end()) {
+            erase(found);
+        }
+        if (_slab.full()) {
+            erase(leastRecentlyUsed());
+        }
+
+        auto slot{_slab.allocate()};
+        std::memcpy(_slab.slot(slot), data, size);
+
+        _lru.push_front(Entry{key, slot, size, now, value});
+        _index.emplace(key, _lru.begin());
+        return _lru.begin();
+    }
+
+    /**
+     * Drop \c entry, zeroing its slot.
+     */
+    void erase(iterator entry) {
+        _slab.release(entry->slot);
+        _index.erase(entry->key);
+        _lru.erase(entry);
+    }
+
+    /**
+     * Drop the entries not used for longer than \c idle.
+     */
+    void expire(Clock::time_point now, Clock::duration idle) {
+        while (!_lru.empty() && now - _lru.back().lastUsed > idle) {
+            erase(leastRecentlyUsed());
+        }
+    }
+
+    void clear() {
+        while (!_lru.empty()) {
+            erase(_lru.begin());
+        }
+    }
+
+    bool empty() const { return _lru.empty(); }
+    std::size_t size() const { return _lru.size(); }
+    std::size_t capacity() const { return _slab.slots(); }
+    std::size_t slotSize() const { return _slab.slotSize(); }
+
+    /**
+     * Whether or not the memory holding the data could be locked into
+     * memory.
+     */
+    bool locked() const { return _slab.locked(); }
+};
+}  // namespace yapet
+
+#endif
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+#include "intl.h"
+#include "lockedslab.hh"
+
+using namespace yapet;
+
+namespace {
+std::size_t roundToPageSize(std::size_t size) {
+    auto pageSize{static_cast<std::size_t>(::sysconf(_SC_PAGESIZE))};
+    return (size + pageSize - 1) / pageSize * pageSize;
+}
+}  // namespace
+
+LockedSlab::LockedSlab(std::size_t slots, std::size_t slotSize)
+    : _slots{slots},
+      _slotSize{slotSize},
+      _slab{nullptr},
+      _size{0},
+      _locked{false},
+      _freeSlots{} {
+    if (_slots == 0) return;
+
+    _size = roundToPageSize(_slots * _slotSize);
+    void* mapping = ::mmap(nullptr, _size, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED) {
+        throw std::bad_alloc{};
+    }
+    _slab = static_cast<std::uint8_t*>(mapping);
+
+#ifdef HAVE_MLOCK
+    // Not being allowed to lock memory is not fatal, the slots are merely as
+    // safe as the rest of the memory of the process then.
+    _locked = ::mlock(_slab, _size) == 0;
+#endif
+#if defined(HAVE_MADVISE) && defined(MADV_DONTDUMP)
+    ::madvise(_slab, _size, MADV_DONTDUMP);
+#endif
+
+    _freeSlots.reserve(_slots);
+    for (auto s = _slots; s > 0; s--) {
+        _freeSlots.push_back(s - 1);
+    }
+}
+
+LockedSlab::~LockedSlab() {
+    if (_slab == nullptr) return;
+
+    std::memset(_slab, 0, _size);
+#ifdef HAVE_MLOCK
+    if (_locked) ::munlock(_slab, _size);
+#endif
+    ::munmap(_slab, _size);
+}
+
+std::size_t LockedSlab::allocate() {
+    if (_freeSlots.empty()) {
+        throw std::logic_error{_("No free slot left")};
+    }
+
+    auto s{_freeSlots.back()};
+    _freeSlots.pop_back();
+    return s;
+}
+
+void LockedSlab::release(std::size_t s) {
+    std::memset(slot(s), 0, _slotSize);
+    _freeSlots.push_back(s);
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _LOCKEDSLAB_HH
+#define _LOCKEDSLAB_HH
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace yapet {
+/**
+ * Memory region holding a fixed number of slots of fixed size.
+ *
+ * The region is allocated once, locked into memory if possible and excluded
+ * from core dumps. Slots are either used by their index directly, or
+ * allocated and released. Slots are zeroed when released and the whole
+ * region is zeroed when destroyed.
+ *
+ * The slab is not safe to be used by several threads.
+ */
+class LockedSlab {
+   private:
+    std::size_t _slots;
+    std::size_t _slotSize;
+    std::uint8_t* _slab;
+    std::size_t _size;
+    bool _locked;
+    std::vector<std::size_t> _freeSlots;
+
+   public:
+    /**
+     * @param slots the number of slots. No memory is allocated if zero.
+     *
+     * @param slotSize the size of a slot in bytes.
+     *
+     * @throw std::bad_alloc if the memory cannot be allocated.
+     */
+    LockedSlab(std::size_t slots, std::size_t slotSize);
+    ~LockedSlab();
+
+    LockedSlab(const LockedSlab&) = delete;
+    LockedSlab(LockedSlab&&) = delete;
+    LockedSlab& operator=(const LockedSlab&) = delete;
+    LockedSlab& operator=(LockedSlab&&) = delete;
+
+    std::uint8_t* slot(std::size_t s) const { return _slab + s * _slotSize; }
+
+    /**
+     * Allocate a free slot.
+     *
+     * @throw std::logic_error if all slots are allocated.
+     */
+    std::size_t allocate();
+    /**
+     * Zero the slot \c s and make it free again.
+     */
+    void release(std::size_t s);
+
+    bool full() const { return _freeSlots.empty(); }
+    std::size_t slots() const { return _slots; }
+    std::size_t slotSize() const { return _slotSize; }
+
+    /**
+     * Whether or not the memory could be locked into memory.
+     */
+    bool locked() const { return _locked; }
+};
+}  // namespace yapet
+
+#endif
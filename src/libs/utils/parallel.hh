@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifndef _PARALLEL_HH
+#define _PARALLEL_HH
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace yapet {
+/**
+ * Minimum number of items a worker thread has to process. Spawning threads
+ * for less work costs more than it saves.
+ */
+constexpr std::size_t PARALLEL_MIN_ITEMS_PER_WORKER = 256;
+
+/**
+ * Return the number of worker threads to use for processing \c items items.
+ *
+ * The result is at least 1 and never exceeds the number of hardware threads.
+ */
+inline unsigned int numberOfWorkers(std::size_t items) {
+    unsigned int hardwareThreads = std::thread::hardware_concurrency();
+    if (hardwareThreads == 0) hardwareThreads = 1;
+
+    std::size_t byItems = items / PARALLEL_MIN_ITEMS_PER_WORKER;
+    if (byItems == 0) byItems = 1;
+
+    return static_cast<unsigned int>(
+        std::min<std::size_t>(hardwareThreads, byItems));
+}
+
+/**
+ * Split the range <tt>[0, items)</tt> into contiguous chunks and call
+ *
+ * @code
+ * func(unsigned int worker, std::size_t begin, std::size_t end)
+ * @endcode
+ *
+ * once per chunk, each on its own thread. \c worker is the zero based index
+ * of the chunk, and is less than \c workers. The chunk of worker 0 is
+ * processed on the calling thread.
+ *
+ * The function returns after all chunks have been processed. If any
+ * invocation of \c func throws, the first exception caught is rethrown on the
+ * calling thread.
+ *
+ * @param items number of items to process.
+ *
+ * @param workers number of workers to use. Use \c numberOfWorkers() if in
+ * doubt.
+ *
+ * @param func the function processing a chunk.
+ */
+template <class Function>
+void parallelFor(std::size_t items, unsigned int workers, Function func) {
+    if (items == 0) return;
+    if (workers == 0) workers = 1;
+    if (workers > items) workers = static_cast<unsigned int>(items);
+
+    std::vector<std::exception_ptr> errors(workers);
+    auto runChunk = [&func, &errors, items, workers](unsigned int worker) {
+        std::size_t begin = items * worker / workers;
+        std::size_t end = items * (worker + 1) / workers;
+        try {
+            func(worker, begin, end);
+        } catch (...) {
+            errors[worker] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (unsigned int worker = 1; worker < workers; worker++) {
+        threads.emplace_back(runChunk, worker);
+    }
+    runChunk(0);
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (auto& error : errors) {
+        if (error) std::rethrow_exception(error);
+    }
+}
+
+/**
+ * Same as above, using \c numberOfWorkers(items) workers.
+ */
+template <class Function>
+inline void parallelFor(std::size_t items, Function func) {
+    parallelFor(items, numberOfWorkers(items), func);
+}
+}  // namespace yapet
+
+#endif
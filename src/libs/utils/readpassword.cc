@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <unistd.h>
+
+#ifdef HAVE_TERMIOS_H
+#include <termios.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include "intl.h"
+#include "readpassword.hh"
+
+#if defined(HAVE_TERMIOS_H) && defined(HAVE_TCSETATTR) && \
+    defined(HAVE_TCGETATTR)
+#define CAN_DISABLE_ECHO 1
+#endif
+
+using namespace yapet;
+
+namespace {
+constexpr std::string::size_type LINE_RESERVE{1024};
+
+/**
+ * Disables echoing of the file descriptor \c fd for its lifetime, if it is a
+ * terminal.
+ */
+class NoEcho {
+#ifdef CAN_DISABLE_ECHO
+   private:
+    int _fd;
+    bool _disabled;
+
+    void echo(bool enable) {
+        struct termios ctios;
+        int err = tcgetattr(_fd, &ctios);
+
+        if (err < 0) throw std::runtime_error(std::strerror(errno));
+
+        if (enable) {
+            ctios.c_lflag |= ECHO;
+        } else {
+            ctios.c_lflag &= ~ECHO;
+        }
+        err = tcsetattr(_fd, TCSANOW, &ctios);
+
+        if (err < 0) throw std::runtime_error(std::strerror(errno));
+    }
+
+   public:
+    NoEcho(int fd) : _fd{fd}, _disabled{::isatty(fd) == 1} {
+        if (_disabled) echo(false);
+    }
+    ~NoEcho() {
+        try {
+            if (_disabled) echo(true);
+        } catch (std::runtime_error&) {
+            // intentionally empty
+        }
+    }
+#else
+   public:
+    NoEcho(int) {}
+#endif
+};
+}  // namespace
+
+SecureArray yapet::readPassword(const std::string& prompt,
+                                std::ostream& out) {
+    out << prompt;
+    out.flush();
+
+    std::string line;
+    {
+        NoEcho noEcho{STDIN_FILENO};
+        std::getline(std::cin, line);
+    }
+    out << std::endl;
+
+    auto password{toSecureArray(line)};
+    std::fill(line.begin(), line.end(), '\0');
+    return password;
+}
+
+SecureArray yapet::readPassword(const std::string& prompt,
+                                std::FILE* terminal) {
+    std::fputs(prompt.c_str(), terminal);
+    std::fflush(terminal);
+
+    std::string line;
+    // Avoid leaving copies of the password behind while the line grows
+    line.reserve(LINE_RESERVE);
+    int c = EOF;
+    {
+        NoEcho noEcho{::fileno(terminal)};
+        while ((c = std::fgetc(terminal)) != EOF && c != '\n') {
+            line.push_back(static_cast<char>(c));
+        }
+    }
+    // A stream cannot switch from reading to writing without repositioning
+    // it, which a terminal does not support, so the descriptor is written.
+    if (::write(::fileno(terminal), "\n", 1) < 0) {
+        // intentionally empty, the line has been read anyway
+    }
+
+    if (c == EOF && line.empty()) {
+        throw std::runtime_error(_("Cannot read password"));
+    }
+    if (!line.empty() && line.back() == '\r') {
+        line.pop_back();
+    }
+
+    auto password{toSecureArray(line)};
+    std::fill(line.begin(), line.end(), '\0');
+    return password;
+}
@@ -0,0 +1,347 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef HAVE_GETOPT_H
+#include <getopt.h>
+#endif
+
+#include <fcntl.h>
+#include <libgen.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <climits>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "agentclient.hh"
+#include "agentserver.hh"
+#include "intl.h"
+#include "openssl.hh"
+#include "readpassword.hh"
+
+enum {
+    /**
+     * Error on command line, i.e. missing parameter.
+     */
+    ERR_CMDLINE = 1,
+    /**
+     * A fatal error.
+     */
+    ERR_FATAL = 2,
+    /**
+     * Default time in seconds keys not used are kept.
+     */
+    DEFAULT_IDLE_TIMEOUT = 900
+};
+
+const char COPYRIGHT[] =
+    "\nCopyright (C) 2018  Rafael Ostertag\n"
+    "\n"
+    "yapet-agent is part of YAPET.\n"
+    "\n"
+    "This program is free software: you can redistribute it and/or modify\n"
+    "it under the terms of the GNU General Public License as published by\n"
+    "the Free Software Foundation, either version 3 of the License, or\n"
+    "(at your option) any later version.\n"
+    "\n"
+    "This program is distributed in the hope that it will be useful,\n"
+    "but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+    "MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+    "GNU General Public License for more details.\n"
+    "\n"
+    "You should have received a copy of the GNU General Public License\n"
+    "along with this program.  If not, see <http://www.gnu.org/licenses/>.\n";
+
+namespace {
+yapet::agent::AgentServer* runningServer = nullptr;
+
+void stop_server(int) {
+    if (runningServer != nullptr) runningServer->stop();
+}
+}  // namespace
+
+void show_version() {
+    std::cout << _("yapet-agent is part of ");
+    std::cout << PACKAGE_STRING << std::endl;
+}
+
+void show_copyright() { std::cout << COPYRIGHT << std::endl; }
+
+void show_help(char* prgname) {
+    std::cout << std::endl;
+    std::cout << basename(prgname)
+              << " [-c] [-D] [-h] [-V] [-a <socket>] [-t <seconds>]"
+              << std::endl;
+    std::cout << basename(prgname) << " [-a <socket>] -u <file>" << std::endl;
+    std::cout << basename(prgname) << " [-a <socket>] -l" << std::endl;
+    std::cout << basename(prgname) << " [-a <socket>] -k" << std::endl
+              << std::endl;
+    std::cout << "-a\t" << _("the path of the agent socket") << std::endl
+              << std::endl;
+    std::cout << "-c\t" << _("show copyright information") << std::endl
+              << std::endl;
+    std::cout << "-D\t" << _("stay in the foreground") << std::endl
+              << std::endl;
+    std::cout << "-h\t" << _("show this help text") << std::endl << std::endl;
+    std::cout << "-k\t" << _("stop the running agent") << std::endl
+              << std::endl;
+    std::cout << "-l\t" << _("make the running agent forget all keys")
+              << std::endl
+              << std::endl;
+    std::cout << "-t\t" << _("forget keys not used for <seconds>. 0 keeps")
+              << std::endl
+              << "\t" << _("keys until the agent is stopped. Default: ")
+              << DEFAULT_IDLE_TIMEOUT << std::endl
+              << std::endl;
+    std::cout << "-u\t" << _("ask for the password of <file> and pass it to")
+              << std::endl
+              << "\t" << _("the running agent") << std::endl
+              << std::endl;
+    std::cout << "-V\t" << _("show the version of yapet-agent") << std::endl
+              << std::endl;
+    std::cout << _("yapet-agent keeps the keys of YAPET files, so YAPET tools "
+                   "do not ask for the password each time.")
+              << std::endl
+              << std::endl;
+}
+
+void print_environment(const std::string& socketPath) {
+    std::cout << yapet::agent::SOCKET_ENVIRONMENT_VARIABLE << "=" << socketPath
+              << "; export " << yapet::agent::SOCKET_ENVIRONMENT_VARIABLE
+              << ";" << std::endl;
+}
+
+void serve(yapet::agent::AgentServer& server) {
+    runningServer = &server;
+    std::signal(SIGINT, stop_server);
+    std::signal(SIGTERM, stop_server);
+    std::signal(SIGHUP, stop_server);
+
+    server.run();
+    runningServer = nullptr;
+}
+
+/**
+ * Start the agent in the background.
+ *
+ * The agent is created in the child process, since memory locks are not
+ * inherited. The parent waits for the agent being ready to accept
+ * connections before it reports the socket.
+ */
+int start_daemon(const std::string& socketPath, std::chrono::seconds timeout) {
+    int ready[2];
+    if (::pipe(ready) != 0) {
+        std::cerr << std::strerror(errno) << std::endl;
+        return ERR_FATAL;
+    }
+
+    auto pid = ::fork();
+    if (pid < 0) {
+        std::cerr << std::strerror(errno) << std::endl;
+        return ERR_FATAL;
+    }
+
+    if (pid > 0) {
+        ::close(ready[1]);
+        char status = 1;
+        auto received = ::read(ready[0], &status, 1);
+        ::close(ready[0]);
+        if (received != 1 || status != 0) return ERR_FATAL;
+
+        print_environment(socketPath);
+        return 0;
+    }
+
+    ::close(ready[0]);
+    ::setsid();
+    try {
+        yapet::agent::AgentServer server{socketPath, timeout};
+        if (!server.keysLocked()) {
+            std::cerr << _("Warning: keys cannot be locked into memory")
+                      << std::endl;
+        }
+
+        char status = 0;
+        if (::write(ready[1], &status, 1) != 1) return ERR_FATAL;
+        ::close(ready[1]);
+
+        int devNull = ::open("/dev/null", O_RDWR);
+        if (devNull > -1) {
+            ::dup2(devNull, STDIN_FILENO);
+            ::dup2(devNull, STDOUT_FILENO);
+            ::dup2(devNull, STDERR_FILENO);
+            if (devNull > STDERR_FILENO) ::close(devNull);
+        }
+        if (::chdir("/") != 0) return ERR_FATAL;
+
+        serve(server);
+    } catch (std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        char status = 1;
+        if (::write(ready[1], &status, 1) != 1) return ERR_FATAL;
+        return ERR_FATAL;
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    std::string socketPath;
+    std::string unlockFile;
+    long timeout = DEFAULT_IDLE_TIMEOUT;
+    bool foreground = false;
+    bool lock = false;
+    bool kill = false;
+
+    int c;
+    extern char* optarg;
+    extern int optopt, optind;
+
+    while ((c = getopt(argc, argv, ":a:cDhklt:u:V")) != -1) {
+        switch (c) {
+            case 'a':
+                socketPath = optarg;
+                break;
+            case 'c':
+                show_copyright();
+                return 0;
+            case 'D':
+                foreground = true;
+                break;
+            case 'h':
+                show_help(argv[0]);
+                return 0;
+            case 'k':
+                kill = true;
+                break;
+            case 'l':
+                lock = true;
+                break;
+            case 't': {
+                char* end;
+                timeout = std::strtol(optarg, &end, 10);
+                if (*optarg == '\0' || *end != '\0' || timeout < 0 ||
+                    timeout > INT_MAX) {
+                    std::cerr << _("invalid timeout") << " '" << optarg << "'"
+                              << std::endl;
+                    return ERR_CMDLINE;
+                }
+                break;
+            }
+            case 'u':
+                unlockFile = optarg;
+                break;
+            case 'V':
+                show_version();
+                return 0;
+            case ':':
+                std::cerr << "-" << (char)optopt << _(" without argument")
+                          << std::endl;
+                return ERR_CMDLINE;
+            case '?':
+                std::cerr << _("unknown argument") << " '" << (char)optopt
+                          << "'" << std::endl;
+                return ERR_CMDLINE;
+        }
+    }
+
+    if (optind < argc || (kill + lock + !unlockFile.empty()) > 1) {
+        std::cerr << _("Invalid arguments.") << std::endl;
+        show_help(argv[0]);
+        return ERR_CMDLINE;
+    }
+
+    yapet::OpenSSL::init();
+
+    bool client = kill || lock || !unlockFile.empty();
+    if (!client) {
+        if (socketPath.empty()) {
+            socketPath = yapet::agent::defaultSocketPath();
+        }
+
+        if (!foreground) {
+            return start_daemon(socketPath, std::chrono::seconds{timeout});
+        }
+
+        try {
+            yapet::agent::AgentServer server{socketPath,
+                                             std::chrono::seconds{timeout}};
+            if (!server.keysLocked()) {
+                std::cerr << _("Warning: keys cannot be locked into memory")
+                          << std::endl;
+            }
+            print_environment(socketPath);
+            serve(server);
+        } catch (std::exception& ex) {
+            std::cerr << ex.what() << std::endl;
+            return ERR_FATAL;
+        }
+        return 0;
+    }
+
+    if (socketPath.empty()) {
+        socketPath = yapet::agent::AgentClient::socketPathFromEnvironment();
+    }
+    if (socketPath.empty()) {
+        std::cerr << yapet::agent::SOCKET_ENVIRONMENT_VARIABLE << " "
+                  << _("not set, and no socket given") << std::endl;
+        return ERR_CMDLINE;
+    }
+
+    try {
+        yapet::agent::AgentClient agent{socketPath};
+
+        if (kill) {
+            agent.stop();
+        } else if (lock) {
+            agent.removeAll();
+        } else {
+            auto password{yapet::readPassword(
+                _("Please enter the password for ") + unlockFile + ": ",
+                std::cerr)};
+
+            agent.addKey(unlockFile, password);
+        }
+    } catch (std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        return ERR_FATAL;
+    }
+
+    return 0;
+}
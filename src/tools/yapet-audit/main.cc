@@ -0,0 +1,322 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef HAVE_GETOPT_H
+#include <getopt.h>
+#endif
+
+#include <libgen.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "agentclient.hh"
+#include "consts.h"
+#include "cryptofactoryhelper.hh"
+#include "file.hh"
+#include "fileerror.hh"
+#include "intl.h"
+#include "breachcorpus.hh"
+#include "openssl.hh"
+#include "passwordaudit.hh"
+#include "readpassword.hh"
+#include "strengthestimator.hh"
+
+enum {
+    /**
+     * Error on command line, i.e. missing parameter.
+     */
+    ERR_CMDLINE = 1,
+    /**
+     * The audit found issues.
+     */
+    ERR_FINDINGS = 2,
+    /**
+     * A fatal error.
+     */
+    ERR_FATAL = 3,
+    /**
+     * The max password length
+     */
+    MAX_PASSWD = 1024
+};
+
+const char COPYRIGHT[] =
+    "\nCopyright (C) 2018  Rafael Ostertag\n"
+    "\n"
+    "yapet-audit is part of YAPET.\n"
+    "\n"
+    "This program is free software: you can redistribute it and/or modify\n"
+    "it under the terms of the GNU General Public License as published by\n"
+    "the Free Software Foundation, either version 3 of the License, or\n"
+    "(at your option) any later version.\n"
+    "\n"
+    "This program is distributed in the hope that it will be useful,\n"
+    "but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+    "MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+    "GNU General Public License for more details.\n"
+    "\n"
+    "You should have received a copy of the GNU General Public License\n"
+    "along with this program.  If not, see <http://www.gnu.org/licenses/>.\n";
+
+void show_version() {
+    std::cout << _("yapet-audit is part of ");
+    std::cout << PACKAGE_STRING << std::endl;
+}
+
+void show_copyright() { std::cout << COPYRIGHT << std::endl; }
+
+void show_help(char* prgname) {
+    std::cout << std::endl;
+    std::cout << basename(prgname)
+              << " [-c] [-h] [-V] [-b <corpus>] [-p <password>] [-s <score>]"
+                 " <src>"
+              << std::endl
+              << std::endl;
+    std::cout << "-b\t" << _("look up passwords in the breached password")
+              << std::endl
+              << "\t" << _("<corpus> created by yapet-breachdb") << std::endl
+              << std::endl;
+    std::cout << "-c\t" << _("show copyright information") << std::endl
+              << std::endl;
+    std::cout << "-h\t" << _("show this help text") << std::endl << std::endl;
+    std::cout << "-p\t" << _("use <password> to open yapet file.") << std::endl
+              << "\t" << _("The use of this option is discouraged.")
+              << std::endl
+              << std::endl;
+    std::cout << "-s\t" << _("report passwords with an estimated strength")
+              << std::endl
+              << "\t" << _("below <score>, ranging from 1 to 4") << std::endl
+              << std::endl;
+    std::cout << "-V\t" << _("show the version of yapet-audit") << std::endl
+              << std::endl;
+    std::cout << "<src>\t" << _("the YAPET file to audit") << std::endl
+              << std::endl;
+    std::cout << _("yapet-audit reports reused passwords, duplicate names "
+                   "and accounts, and empty passwords.")
+              << std::endl
+              << std::endl;
+}
+
+void print_group(const yapet::audit::RecordGroup& group,
+                 const std::vector<std::string>& names) {
+    std::string separator{"\t"};
+    for (auto index : group) {
+        std::cout << separator << '"' << names[index] << '"';
+        separator = ", ";
+    }
+    std::cout << '\n';
+}
+
+void print_groups(const char* title,
+                  const std::vector<yapet::audit::RecordGroup>& groups,
+                  const std::vector<std::string>& names) {
+    std::cout << title << ": " << groups.size() << '\n';
+    for (const auto& group : groups) {
+        print_group(group, names);
+    }
+}
+
+void print_records(const char* title, const yapet::audit::RecordGroup& group,
+                   const std::vector<std::string>& names) {
+    std::cout << title << ": " << group.size() << '\n';
+    for (auto index : group) {
+        std::cout << "\t\"" << names[index] << "\"\n";
+    }
+}
+
+void print_weak(const yapet::audit::AuditReport& report) {
+    std::cout << _("Weak passwords") << ": " << report.weakPasswords.size()
+              << '\n';
+    for (auto index : report.weakPasswords) {
+        const auto& strength = report.strengths[index];
+        std::cout << "\t\"" << report.names[index] << "\" ("
+                  << yapet::strength::StrengthEstimator::scoreDescription(
+                         strength.score);
+        if (strength.pattern != yapet::strength::Pattern::BRUTEFORCE) {
+            std::cout << ", "
+                      << yapet::strength::StrengthEstimator::patternDescription(
+                             strength.pattern);
+        }
+        std::cout << ")\n";
+    }
+}
+
+void print_report(const yapet::audit::AuditReport& report, bool breachCheck,
+                  bool strengthCheck) {
+    std::cout << _("Records audited") << ": " << report.names.size() << '\n';
+
+    print_records(_("Empty passwords"), report.emptyPasswords, report.names);
+    if (breachCheck) {
+        print_records(_("Breached passwords"), report.breachedPasswords,
+                      report.names);
+    }
+    if (strengthCheck) {
+        print_weak(report);
+    }
+
+    print_groups(_("Reused passwords"), report.reusedPasswords, report.names);
+    print_groups(_("Duplicate names"), report.duplicateNames, report.names);
+    print_groups(_("Duplicate accounts"), report.duplicateAccounts,
+                 report.names);
+    std::cout.flush();
+}
+
+int main(int argc, char** argv) {
+    bool cmdline_pw = false;
+    char passwd[MAX_PASSWD];
+    std::string srcfile;
+    std::string corpusfile;
+    int minimumScore = 0;
+
+    int c;
+    extern char* optarg;
+    extern int optopt, optind;
+
+    while ((c = getopt(argc, argv, ":b:chp:s:V")) != -1) {
+        switch (c) {
+            case 'b':
+                corpusfile = optarg;
+                break;
+            case 'c':
+                show_copyright();
+                return 0;
+            case 'h':
+                show_help(argv[0]);
+                return 0;
+            case 'p':
+                strncpy(passwd, optarg, MAX_PASSWD - 1);
+                passwd[MAX_PASSWD - 1] = 0;
+                cmdline_pw = true;
+                break;
+            case 's': {
+                char* end;
+                long score = std::strtol(optarg, &end, 10);
+                if (*optarg == '\0' || *end != '\0' || score < 1 ||
+                    score > yapet::strength::StrengthEstimator::MAX_SCORE) {
+                    std::cerr << _("invalid score") << " '" << optarg << "'"
+                              << std::endl;
+                    return ERR_CMDLINE;
+                }
+                minimumScore = static_cast<int>(score);
+                break;
+            }
+            case 'V':
+                show_version();
+                return 0;
+            case ':':
+                std::cerr << "-" << (char)optopt << _(" without argument")
+                          << std::endl;
+                return ERR_CMDLINE;
+            case '?':
+                std::cerr << _("unknown argument") << " '" << (char)optopt
+                          << "'" << std::endl;
+                return ERR_CMDLINE;
+        }
+    }
+
+    if (optind < argc && (argc - optind) == 1) {
+        srcfile = argv[optind];
+    } else {
+        std::cerr << _("Missing argument.") << std::endl;
+        show_help(argv[0]);
+        return ERR_CMDLINE;
+    }
+
+    yapet::OpenSSL::init();
+
+    try {
+        // The agent, if it holds the key of the file, saves asking for the
+        // password.
+        std::shared_ptr<yapet::AbstractCryptoFactory> cryptoFactory;
+        if (!cmdline_pw) {
+            cryptoFactory = yapet::agent::agentCryptoFactoryForFile(srcfile);
+        }
+
+        if (!cryptoFactory) {
+            // We read the password from stdin only if the user did not
+            // provide the -p switch.
+            yapet::SecureArray password;
+            if (cmdline_pw) {
+                password = yapet::toSecureArray(passwd);
+                std::memset(passwd, 0, MAX_PASSWD);
+            } else {
+                password = yapet::readPassword(
+                    _("Please enter the password for ") + srcfile + ": ");
+            }
+
+            cryptoFactory = yapet::getCryptoFactoryForFile(srcfile, password);
+            if (!cryptoFactory) {
+                char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+                std::snprintf(msg,
+                              YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                              _("File '%s' not recognized"), srcfile.c_str());
+                throw yapet::FileFormatError{msg};
+            }
+        }
+
+        YAPET::File yapetFile{cryptoFactory, srcfile, false, false};
+        auto encryptedRecords{yapetFile.readEncryptedRecords()};
+
+        yapet::audit::PasswordAudit audit{cryptoFactory};
+        if (!corpusfile.empty()) {
+            audit.breachCorpus(std::make_shared<yapet::audit::BreachCorpus>(
+                corpusfile));
+        }
+        if (minimumScore > 0) {
+            using yapet::strength::StrengthEstimator;
+            audit.strengthEstimator(
+                std::make_shared<StrengthEstimator>(
+                    StrengthEstimator::loadDefaultDictionary()),
+                minimumScore);
+        }
+        auto report{audit.audit(encryptedRecords)};
+
+        print_report(report, !corpusfile.empty(), minimumScore > 0);
+
+        if (report.hasFindings()) {
+            return ERR_FINDINGS;
+        }
+    } catch (std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        return ERR_FATAL;
+    }
+
+    return 0;
+}
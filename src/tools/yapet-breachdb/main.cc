@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef HAVE_GETOPT_H
+#include <getopt.h>
+#endif
+
+#include <libgen.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "breachcorpus.hh"
+#include "consts.h"
+#include "intl.h"
+#include "openssl.hh"
+
+enum {
+    /**
+     * Error on command line, i.e. missing parameter.
+     */
+    ERR_CMDLINE = 1,
+    /**
+     * The destination file already exists.
+     */
+    ERR_FILEEXISTS = 2,
+    /**
+     * A fatal error.
+     */
+    ERR_FATAL = 3
+};
+
+const char COPYRIGHT[] =
+    "\nCopyright (C) 2018  Rafael Ostertag\n"
+    "\n"
+    "yapet-breachdb is part of YAPET.\n"
+    "\n"
+    "This program is free software: you can redistribute it and/or modify\n"
+    "it under the terms of the GNU General Public License as published by\n"
+    "the Free Software Foundation, either version 3 of the License, or\n"
+    "(at your option) any later version.\n"
+    "\n"
+    "This program is distributed in the hope that it will be useful,\n"
+    "but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+    "MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+    "GNU General Public License for more details.\n"
+    "\n"
+    "You should have received a copy of the GNU General Public License\n"
+    "along with this program.  If not, see <http://www.gnu.org/licenses/>.\n";
+
+void show_version() {
+    std::cout << _("yapet-breachdb is part of ");
+    std::cout << PACKAGE_STRING << std::endl;
+}
+
+void show_copyright() { std::cout << COPYRIGHT << std::endl; }
+
+void show_help(char* prgname) {
+    std::cout << std::endl;
+    std::cout << basename(prgname) << " [-c] [-h] [-V] [-q] <src> <dst>"
+              << std::endl
+              << std::endl;
+    std::cout << "-c\t" << _("show copyright information") << std::endl
+              << std::endl;
+    std::cout << "-h\t" << _("show this help text") << std::endl << std::endl;
+    std::cout << "-q\t" << _("operate quietly") << std::endl << std::endl;
+    std::cout << "-V\t" << _("show the version of yapet-breachdb")
+              << std::endl
+              << std::endl;
+    std::cout << "<src>\t" << _("the SHA-1 password list, ordered by hash.")
+              << std::endl
+              << "\t" << _("Use - to read from stdin.") << std::endl
+              << std::endl;
+    std::cout << "<dst>\t" << _("the breached password corpus to create")
+              << std::endl
+              << std::endl;
+    std::cout << _("yapet-breachdb converts the Have I Been Pwned SHA-1 "
+                   "password list to a corpus for yapet-audit.")
+              << std::endl
+              << std::endl;
+}
+
+int main(int argc, char** argv) {
+    bool quiet = false;
+    std::string srcfile;
+    std::string dstfile;
+
+    int c;
+    extern int optopt, optind;
+
+    while ((c = getopt(argc, argv, ":chqV")) != -1) {
+        switch (c) {
+            case 'c':
+                show_copyright();
+                return 0;
+            case 'h':
+                show_help(argv[0]);
+                return 0;
+            case 'q':
+                quiet = true;
+                break;
+            case 'V':
+                show_version();
+                return 0;
+            case ':':
+                std::cerr << "-" << (char)optopt << _(" without argument")
+                          << std::endl;
+                return ERR_CMDLINE;
+            case '?':
+                std::cerr << _("unknown argument") << " '" << (char)optopt
+                          << "'" << std::endl;
+                return ERR_CMDLINE;
+        }
+    }
+
+    if (optind < argc && (argc - optind) == 2) {
+        srcfile = argv[optind];
+        dstfile = argv[++optind];
+    } else {
+        std::cerr << _("Missing argument.") << std::endl;
+
+        if (!quiet) show_help(argv[0]);
+
+        return ERR_CMDLINE;
+    }
+
+    if (access(dstfile.c_str(), F_OK) == 0) {
+        std::cerr << dstfile << _(" already exists. Aborting.") << std::endl;
+        return ERR_FILEEXISTS;
+    }
+
+    yapet::OpenSSL::init();
+
+    try {
+        std::uint64_t numberOfDigests;
+        if (srcfile == "-") {
+            numberOfDigests =
+                yapet::audit::BreachCorpus::convert(std::cin, dstfile);
+        } else {
+            std::ifstream hibpText{srcfile};
+            if (!hibpText) {
+                char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+                std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                              _("Cannot open '%s'"), srcfile.c_str());
+                throw std::runtime_error(msg);
+            }
+            numberOfDigests =
+                yapet::audit::BreachCorpus::convert(hibpText, dstfile);
+        }
+
+        // Build the prefix index now rather than on first use by yapet-audit
+        yapet::audit::BreachCorpus corpus{dstfile};
+
+        if (!quiet) {
+            std::cout << dstfile << _(" successfully created with ")
+                      << numberOfDigests << _(" digests.") << std::endl;
+        }
+    } catch (std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        return ERR_FATAL;
+    }
+
+    return 0;
+}
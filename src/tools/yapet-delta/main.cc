@@ -0,0 +1,270 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef HAVE_GETOPT_H
+#include <getopt.h>
+#endif
+
+#include <libgen.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "consts.h"
+#include "cryptofactoryhelper.hh"
+#include "file.hh"
+#include "fileerror.hh"
+#include "intl.h"
+#include "openssl.hh"
+#include "readpassword.hh"
+#include "recorddelta.hh"
+
+enum {
+    /**
+     * Error on command line, i.e. missing parameter.
+     */
+    ERR_CMDLINE = 1,
+    /**
+     * A fatal error.
+     */
+    ERR_FATAL = 2,
+    /**
+     * The max password length
+     */
+    MAX_PASSWD = 1024
+};
+
+const char COPYRIGHT[] =
+    "\nCopyright (C) 2018  Rafael Ostertag\n"
+    "\n"
+    "yapet-delta is part of YAPET.\n"
+    "\n"
+    "This program is free software: you can redistribute it and/or modify\n"
+    "it under the terms of the GNU General Public License as published by\n"
+    "the Free Software Foundation, either version 3 of the License, or\n"
+    "(at your option) any later version.\n"
+    "\n"
+    "This program is distributed in the hope that it will be useful,\n"
+    "but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+    "MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+    "GNU General Public License for more details.\n"
+    "\n"
+    "You should have received a copy of the GNU General Public License\n"
+    "along with this program.  If not, see <http://www.gnu.org/licenses/>.\n";
+
+void show_version() {
+    std::cout << _("yapet-delta is part of ");
+    std::cout << PACKAGE_STRING << std::endl;
+}
+
+void show_copyright() { std::cout << COPYRIGHT << std::endl; }
+
+void show_help(char* prgname) {
+    std::cout << std::endl;
+    std::cout << basename(prgname) << " [-c] [-h] [-V] create <old> <new>"
+              << std::endl;
+    std::cout << basename(prgname)
+              << " [-c] [-h] [-V] [-p <password>] apply <file> [<delta>]"
+              << std::endl
+              << std::endl;
+    std::cout << "-c\t" << _("show copyright information") << std::endl
+              << std::endl;
+    std::cout << "-h\t" << _("show this help text") << std::endl << std::endl;
+    std::cout << "-p\t" << _("use <password> to open yapet file.") << std::endl
+              << "\t" << _("The use of this option is discouraged.")
+              << std::endl
+              << std::endl;
+    std::cout << "-V\t" << _("show the version of yapet-delta") << std::endl
+              << std::endl;
+    std::cout << "create\t" << _("write the records changed from <old> to")
+              << std::endl
+              << "\t" << _("<new> to stdout") << std::endl
+              << std::endl;
+    std::cout << "apply\t" << _("apply the <delta> to <file>. Without")
+              << std::endl
+              << "\t" << _("<delta> or with -, read it from stdin.")
+              << std::endl
+              << std::endl;
+    std::cout << _("yapet-delta transfers changes between copies of a YAPET "
+                   "file without copying the entire file.")
+              << std::endl
+              << std::endl;
+}
+
+int create(const std::string& oldfile, const std::string& newfile) {
+    if (isatty(STDOUT_FILENO)) {
+        std::cerr << _("Refusing to write the delta to a terminal.")
+                  << std::endl;
+        return ERR_CMDLINE;
+    }
+
+    auto oldImage{yapet::merge::readFileImage(oldfile)};
+    auto newImage{yapet::merge::readFileImage(newfile)};
+    yapet::merge::RecordDelta delta{oldImage, newImage};
+
+    delta.write(std::cout);
+    std::cout.flush();
+    if (!std::cout) {
+        throw std::runtime_error{_("Cannot write delta")};
+    }
+
+    std::cerr << _("Records inserted") << ": " << delta.inserted() << '\n'
+              << _("Records removed") << ": " << delta.deleted() << std::endl;
+    return 0;
+}
+
+int apply(const std::string& file, const std::string& deltafile,
+          bool cmdline_pw, char* passwd) {
+    // We read the password from stdin only if the user did not provide the -p
+    // switch.
+    yapet::SecureArray password;
+    if (cmdline_pw) {
+        password = yapet::toSecureArray(passwd);
+        std::memset(passwd, 0, MAX_PASSWD);
+    } else {
+        if (deltafile == "-") {
+            std::cerr << _("The password has to be provided by -p when "
+                           "reading the delta from stdin.")
+                      << std::endl;
+            return ERR_CMDLINE;
+        }
+
+        password = yapet::readPassword(_("Please enter the password for ") +
+                                       file + ": ");
+    }
+
+    std::shared_ptr<yapet::AbstractCryptoFactory> cryptoFactory{
+        yapet::getCryptoFactoryForFile(file, password)};
+    if (!cryptoFactory) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("File '%s' not recognized"), file.c_str());
+        throw yapet::FileFormatError{msg};
+    }
+
+    // Opening the file verifies the password before anything is written.
+    YAPET::File yapetFile{cryptoFactory, file, false};
+
+    std::unique_ptr<yapet::merge::RecordDelta> delta;
+    if (deltafile == "-") {
+        delta.reset(new yapet::merge::RecordDelta{
+            yapet::merge::RecordDelta::read(std::cin)});
+    } else {
+        std::ifstream in{deltafile, std::ios::in | std::ios::binary};
+        if (!in) {
+            char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+            std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                          _("Cannot open '%s'"), deltafile.c_str());
+            throw yapet::FileError{msg, errno};
+        }
+        delta.reset(new yapet::merge::RecordDelta{
+            yapet::merge::RecordDelta::read(in)});
+    }
+
+    auto records{delta->apply(yapet::merge::readFileImage(file))};
+
+    yapetFile.beginSave();
+    for (const auto& record : records) {
+        yapetFile.saveRecord(record);
+    }
+    yapetFile.endSave();
+
+    std::cout << _("Records inserted") << ": " << delta->inserted() << '\n'
+              << _("Records removed") << ": " << delta->deleted() << std::endl;
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    bool cmdline_pw = false;
+    char passwd[MAX_PASSWD];
+
+    int c;
+    extern char* optarg;
+    extern int optopt, optind;
+
+    while ((c = getopt(argc, argv, ":chp:V")) != -1) {
+        switch (c) {
+            case 'c':
+                show_copyright();
+                return 0;
+            case 'h':
+                show_help(argv[0]);
+                return 0;
+            case 'p':
+                strncpy(passwd, optarg, MAX_PASSWD - 1);
+                passwd[MAX_PASSWD - 1] = 0;
+                cmdline_pw = true;
+                break;
+            case 'V':
+                show_version();
+                return 0;
+            case ':':
+                std::cerr << "-" << (char)optopt << _(" without argument")
+                          << std::endl;
+                return ERR_CMDLINE;
+            case '?':
+                std::cerr << _("unknown argument") << " '" << (char)optopt
+                          << "'" << std::endl;
+                return ERR_CMDLINE;
+        }
+    }
+
+    int arguments = argc - optind;
+    std::string command{arguments > 0 ? argv[optind] : ""};
+    if (!((command == "create" && arguments == 3) ||
+          (command == "apply" && (arguments == 2 || arguments == 3)))) {
+        std::cerr << _("Missing argument.") << std::endl;
+        show_help(argv[0]);
+        return ERR_CMDLINE;
+    }
+
+    yapet::OpenSSL::init();
+
+    try {
+        if (command == "create") {
+            return create(argv[optind + 1], argv[optind + 2]);
+        }
+        return apply(argv[optind + 1], arguments == 3 ? argv[optind + 2] : "-",
+                     cmdline_pw, passwd);
+    } catch (std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        return ERR_FATAL;
+    }
+}
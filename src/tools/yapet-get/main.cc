@@ -0,0 +1,348 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef HAVE_GETOPT_H
+#include <getopt.h>
+#endif
+
+#include <libgen.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "agentclient.hh"
+#include "consts.h"
+#include "cryptofactoryhelper.hh"
+#include "file.hh"
+#include "fileerror.hh"
+#include "intl.h"
+#include "openssl.hh"
+#include "readpassword.hh"
+#include "recordfield.hh"
+#include "recordlookup.hh"
+
+enum {
+    /**
+     * Error on command line, i.e. missing parameter.
+     */
+    ERR_CMDLINE = 1,
+    /**
+     * No record matches.
+     */
+    ERR_NOTFOUND = 2,
+    /**
+     * More than one record matches, and -a has not been given.
+     */
+    ERR_AMBIGUOUS = 3,
+    /**
+     * A fatal error.
+     */
+    ERR_FATAL = 4,
+    /**
+     * The max password length
+     */
+    MAX_PASSWD = 1024
+};
+
+const char COPYRIGHT[] =
+    "\nCopyright (C) 2018  Rafael Ostertag\n"
+    "\n"
+    "yapet-get is part of YAPET.\n"
+    "\n"
+    "This program is free software: you can redistribute it and/or modify\n"
+    "it under the terms of the GNU General Public License as published by\n"
+    "the Free Software Foundation, either version 3 of the License, or\n"
+    "(at your option) any later version.\n"
+    "\n"
+    "This program is distributed in the hope that it will be useful,\n"
+    "but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+    "MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+    "GNU General Public License for more details.\n"
+    "\n"
+    "You should have received a copy of the GNU General Public License\n"
+    "along with this program.  If not, see <http://www.gnu.org/licenses/>.\n";
+
+void show_version() {
+    std::cout << _("yapet-get is part of ");
+    std::cout << PACKAGE_STRING << std::endl;
+}
+
+void show_copyright() { std::cout << COPYRIGHT << std::endl; }
+
+void show_help(char* prgname) {
+    std::cout << std::endl;
+    std::cout << basename(prgname)
+              << " [-a] [-c] [-h] [-n] [-V] [-d <fd>] [-F <field>]"
+                 " [-p <password>] -f <file> <name>"
+              << std::endl
+              << std::endl;
+    std::cout << "-a\t" << _("write the field of all records matching")
+              << std::endl
+              << "\t" << _("<name>, one per line") << std::endl
+              << std::endl;
+    std::cout << "-c\t" << _("show copyright information") << std::endl
+              << std::endl;
+    std::cout << "-d\t" << _("write to the file descriptor <fd> instead of")
+              << std::endl
+              << "\t" << _("stdout") << std::endl
+              << std::endl;
+    std::cout << "-F\t" << _("the field to write: name, host, username,")
+              << std::endl
+              << "\t" << _("password, comment or tags. Default: password")
+              << std::endl
+              << std::endl;
+    std::cout << "-f\t" << _("the YAPET file to read") << std::endl
+              << std::endl;
+    std::cout << "-h\t" << _("show this help text") << std::endl << std::endl;
+    std::cout << "-n\t" << _("do not write a new line after the field")
+              << std::endl
+              << std::endl;
+    std::cout << "-p\t" << _("use <password> to open yapet file.") << std::endl
+              << "\t" << _("The use of this option is discouraged.")
+              << std::endl
+              << std::endl;
+    std::cout << "-V\t" << _("show the version of yapet-get") << std::endl
+              << std::endl;
+    std::cout << "<name>\t" << _("the name of the record. Shell wildcards")
+              << std::endl
+              << "\t" << _("may be used.") << std::endl
+              << std::endl;
+    std::cout << _("yapet-get writes a field of the record named <name> to "
+                   "stdout.")
+              << std::endl
+              << std::endl;
+}
+
+void write_fully(int fd, const char* data, std::size_t size) {
+    while (size > 0) {
+        auto written = ::write(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            throw yapet::FileError{_("Cannot write field"), errno};
+        }
+        data += written;
+        size -= written;
+    }
+}
+
+/**
+ * Look up the records matching \c pattern by the agent.
+ *
+ * @return \c false if no agent is set in the environment, it does not hold
+ * the key of \c srcfile, or does not support the file at all.
+ */
+bool agent_lookup(const std::string& srcfile, const std::string& pattern,
+                  std::vector<yapet::PasswordRecord>& records) {
+    auto socketPath{yapet::agent::AgentClient::socketPathFromEnvironment()};
+    if (socketPath.empty()) return false;
+
+    std::string keyId;
+    try {
+        keyId = yapet::agent::keyId(srcfile);
+    } catch (yapet::agent::AgentError&) {
+        return false;
+    }
+
+    try {
+        yapet::agent::AgentClient agent{socketPath};
+        if (!agent.hasKey(keyId)) return false;
+
+        records = agent.lookup(srcfile, pattern);
+        return true;
+    } catch (yapet::agent::AgentError& ex) {
+        std::cerr << ex.what() << std::endl;
+        return false;
+    }
+}
+
+/**
+ * Look up the records matching \c pattern using \c password.
+ */
+std::vector<yapet::PasswordRecord> lookup(const std::string& srcfile,
+                                          const yapet::SecureArray& password,
+                                          const std::string& pattern) {
+    std::shared_ptr<yapet::AbstractCryptoFactory> cryptoFactory{
+        yapet::getCryptoFactoryForFile(srcfile, password)};
+    if (!cryptoFactory) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("File '%s' not recognized"), srcfile.c_str());
+        throw yapet::FileFormatError{msg};
+    }
+
+    // Opening the file verifies the password, which finding records by
+    // their name does not.
+    YAPET::File yapetFile{cryptoFactory, srcfile, false, false};
+    auto encryptedRecords{yapetFile.readEncryptedRecords()};
+
+    yapet::RecordLookup recordLookup{cryptoFactory};
+    auto found{recordLookup.find(encryptedRecords, pattern)};
+
+    std::vector<yapet::PasswordRecord> records;
+    for (auto index : found) {
+        records.push_back(recordLookup.decrypt(encryptedRecords[index]));
+    }
+    return records;
+}
+
+int main(int argc, char** argv) {
+    bool cmdline_pw = false;
+    char passwd[MAX_PASSWD];
+    std::string srcfile;
+    std::string pattern;
+    yapet::RecordField field{yapet::RecordField::PASSWORD};
+    int fd = STDOUT_FILENO;
+    bool all = false;
+    bool newline = true;
+
+    int c;
+    extern char* optarg;
+    extern int optopt, optind;
+
+    while ((c = getopt(argc, argv, ":acd:F:f:hnp:V")) != -1) {
+        switch (c) {
+            case 'a':
+                all = true;
+                break;
+            case 'c':
+                show_copyright();
+                return 0;
+            case 'd': {
+                char* end;
+                long descriptor = std::strtol(optarg, &end, 10);
+                if (*optarg == '\0' || *end != '\0' || descriptor < 0 ||
+                    descriptor > INT_MAX) {
+                    std::cerr << _("invalid file descriptor") << " '"
+                              << optarg << "'" << std::endl;
+                    return ERR_CMDLINE;
+                }
+                fd = static_cast<int>(descriptor);
+                break;
+            }
+            case 'F':
+                try {
+                    field = yapet::parseRecordField(optarg);
+                } catch (std::invalid_argument& ex) {
+                    std::cerr << ex.what() << std::endl;
+                    return ERR_CMDLINE;
+                }
+                break;
+            case 'f':
+                srcfile = optarg;
+                break;
+            case 'h':
+                show_help(argv[0]);
+                return 0;
+            case 'n':
+                newline = false;
+                break;
+            case 'p':
+                strncpy(passwd, optarg, MAX_PASSWD - 1);
+                passwd[MAX_PASSWD - 1] = 0;
+                cmdline_pw = true;
+                break;
+            case 'V':
+                show_version();
+                return 0;
+            case ':':
+                std::cerr << "-" << (char)optopt << _(" without argument")
+                          << std::endl;
+                return ERR_CMDLINE;
+            case '?':
+                std::cerr << _("unknown argument") << " '" << (char)optopt
+                          << "'" << std::endl;
+                return ERR_CMDLINE;
+        }
+    }
+
+    if (!srcfile.empty() && optind < argc && (argc - optind) == 1) {
+        pattern = argv[optind];
+    } else {
+        std::cerr << _("Missing argument.") << std::endl;
+        show_help(argv[0]);
+        return ERR_CMDLINE;
+    }
+
+    yapet::OpenSSL::init();
+
+    try {
+        std::vector<yapet::PasswordRecord> records;
+        if (cmdline_pw || !agent_lookup(srcfile, pattern, records)) {
+            // We read the password from stdin only if the user did not
+            // provide the -p switch. The prompt goes to stderr, stdout is
+            // reserved for the field.
+            yapet::SecureArray password;
+            if (cmdline_pw) {
+                password = yapet::toSecureArray(passwd);
+                std::memset(passwd, 0, MAX_PASSWD);
+            } else {
+                password = yapet::readPassword(
+                    _("Please enter the password for ") + srcfile + ": ",
+                    std::cerr);
+            }
+            records = lookup(srcfile, password, pattern);
+        }
+
+        if (records.empty()) {
+            std::cerr << _("No record matches") << " '" << pattern << "'"
+                      << std::endl;
+            return ERR_NOTFOUND;
+        }
+        if (records.size() > 1 && !all) {
+            std::cerr << records.size() << " " << _("records match") << " '"
+                      << pattern << "'" << std::endl;
+            return ERR_AMBIGUOUS;
+        }
+
+        for (const auto& record : records) {
+            std::size_t size;
+            auto value = yapet::recordFieldValue(record, field, size);
+            write_fully(fd, value, size);
+            if (newline) write_fully(fd, "\n", 1);
+        }
+    } catch (std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        return ERR_FATAL;
+    }
+
+    return 0;
+}
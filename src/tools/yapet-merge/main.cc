@@ -0,0 +1,292 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef HAVE_GETOPT_H
+#include <getopt.h>
+#endif
+
+#include <libgen.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "consts.h"
+#include "cryptofactoryhelper.hh"
+#include "file.hh"
+#include "fileerror.hh"
+#include "filehelper.hh"
+#include "intl.h"
+#include "openssl.hh"
+#include "readpassword.hh"
+#include "recordmerge.hh"
+
+enum {
+    /**
+     * Error on command line, i.e. missing parameter.
+     */
+    ERR_CMDLINE = 1,
+    /**
+     * The merge left conflicts.
+     */
+    ERR_CONFLICTS = 2,
+    /**
+     * A fatal error.
+     */
+    ERR_FATAL = 3,
+    /**
+     * The max password length
+     */
+    MAX_PASSWD = 1024
+};
+
+const char COPYRIGHT[] =
+    "\nCopyright (C) 2018  Rafael Ostertag\n"
+    "\n"
+    "yapet-merge is part of YAPET.\n"
+    "\n"
+    "This program is free software: you can redistribute it and/or modify\n"
+    "it under the terms of the GNU General Public License as published by\n"
+    "the Free Software Foundation, either version 3 of the License, or\n"
+    "(at your option) any later version.\n"
+    "\n"
+    "This program is distributed in the hope that it will be useful,\n"
+    "but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+    "MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+    "GNU General Public License for more details.\n"
+    "\n"
+    "You should have received a copy of the GNU General Public License\n"
+    "along with this program.  If not, see <http://www.gnu.org/licenses/>.\n";
+
+void show_version() {
+    std::cout << _("yapet-merge is part of ");
+    std::cout << PACKAGE_STRING << std::endl;
+}
+
+void show_copyright() { std::cout << COPYRIGHT << std::endl; }
+
+void show_help(char* prgname) {
+    std::cout << std::endl;
+    std::cout << basename(prgname)
+              << " [-c] [-h] [-V] [-o <output>] [-p <password>] <base> <ours>"
+                 " <theirs>"
+              << std::endl
+              << std::endl;
+    std::cout << "-c\t" << _("show copyright information") << std::endl
+              << std::endl;
+    std::cout << "-h\t" << _("show this help text") << std::endl << std::endl;
+    std::cout << "-o\t" << _("write the merged records to the new file")
+              << std::endl
+              << "\t" << _("<output> instead of <ours>") << std::endl
+              << std::endl;
+    std::cout << "-p\t" << _("use <password> to open the yapet files.")
+              << std::endl
+              << "\t" << _("The use of this option is discouraged.")
+              << std::endl
+              << std::endl;
+    std::cout << "-V\t" << _("show the version of yapet-merge") << std::endl
+              << std::endl;
+    std::cout << "<base>\t" << _("the common ancestor of both files")
+              << std::endl
+              << std::endl;
+    std::cout << "<ours>\t" << _("our version of the file") << std::endl
+              << std::endl;
+    std::cout << "<theirs>\t" << _("their version of the file") << std::endl
+              << std::endl;
+    std::cout << _("yapet-merge merges the changes made to <base> in <theirs> "
+                   "into <ours>.")
+              << std::endl
+              << std::endl;
+}
+
+/**
+ * Return \c knownCryptoFactory if \c filename uses the same file format and
+ * keying parameters as \c knownFilename. Deriving the key once per distinct
+ * set of keying parameters saves the expensive key derivation, and lets the
+ * merge copy records without re-encrypting them.
+ */
+std::shared_ptr<yapet::AbstractCryptoFactory> cryptoFactoryFor(
+    const std::string& filename, const yapet::SecureArray& password,
+    const std::string& knownFilename,
+    const std::shared_ptr<yapet::AbstractCryptoFactory>& knownCryptoFactory) {
+    auto file{yapet::getFile(filename, false)};
+    auto knownFile{yapet::getFile(knownFilename, false)};
+    file->open();
+    knownFile->open();
+    if (file->readIdentifier() == knownFile->readIdentifier() &&
+        file->readUnencryptedMetaData() ==
+            knownFile->readUnencryptedMetaData()) {
+        return knownCryptoFactory;
+    }
+
+    std::shared_ptr<yapet::AbstractCryptoFactory> cryptoFactory{
+        yapet::getCryptoFactoryForFile(filename, password)};
+    if (!cryptoFactory) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("File '%s' not recognized"), filename.c_str());
+        throw yapet::FileFormatError{msg};
+    }
+    return cryptoFactory;
+}
+
+void print_report(const yapet::merge::MergeReport& report) {
+    std::cout << _("Records merged") << ": " << report.records.size() << '\n';
+    std::cout << _("Records added") << ": " << report.added << '\n';
+    std::cout << _("Records changed") << ": " << report.changed << '\n';
+    std::cout << _("Records deleted") << ": " << report.deleted << '\n';
+    std::cout << _("Conflicts") << ": " << report.conflicts.size() << '\n';
+    for (const auto& name : report.conflicts) {
+        std::cout << "\t\"" << name << "\"\n";
+    }
+    std::cout.flush();
+}
+
+int main(int argc, char** argv) {
+    bool cmdline_pw = false;
+    char passwd[MAX_PASSWD];
+    std::string basefile;
+    std::string ourfile;
+    std::string theirfile;
+    std::string outputfile;
+
+    int c;
+    extern char* optarg;
+    extern int optopt, optind;
+
+    while ((c = getopt(argc, argv, ":cho:p:V")) != -1) {
+        switch (c) {
+            case 'c':
+                show_copyright();
+                return 0;
+            case 'h':
+                show_help(argv[0]);
+                return 0;
+            case 'o':
+                outputfile = optarg;
+                break;
+            case 'p':
+                strncpy(passwd, optarg, MAX_PASSWD - 1);
+                passwd[MAX_PASSWD - 1] = 0;
+                cmdline_pw = true;
+                break;
+            case 'V':
+                show_version();
+                return 0;
+            case ':':
+                std::cerr << "-" << (char)optopt << _(" without argument")
+                          << std::endl;
+                return ERR_CMDLINE;
+            case '?':
+                std::cerr << _("unknown argument") << " '" << (char)optopt
+                          << "'" << std::endl;
+                return ERR_CMDLINE;
+        }
+    }
+
+    if (optind < argc && (argc - optind) == 3) {
+        basefile = argv[optind];
+        ourfile = argv[optind + 1];
+        theirfile = argv[optind + 2];
+    } else {
+        std::cerr << _("Missing argument.") << std::endl;
+        show_help(argv[0]);
+        return ERR_CMDLINE;
+    }
+
+    yapet::OpenSSL::init();
+
+    try {
+        // We read the password from stdin only if the user did not provide the
+        // -p switch.
+        yapet::SecureArray password;
+        if (cmdline_pw) {
+            password = yapet::toSecureArray(passwd);
+            std::memset(passwd, 0, MAX_PASSWD);
+        } else {
+            password = yapet::readPassword(
+                _("Please enter the password for ") + ourfile + ": ");
+        }
+
+        std::shared_ptr<yapet::AbstractCryptoFactory> ourCryptoFactory{
+            yapet::getCryptoFactoryForFile(ourfile, password)};
+        if (!ourCryptoFactory) {
+            char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+            std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                          _("File '%s' not recognized"), ourfile.c_str());
+            throw yapet::FileFormatError{msg};
+        }
+        auto baseCryptoFactory{
+            cryptoFactoryFor(basefile, password, ourfile, ourCryptoFactory)};
+        auto theirCryptoFactory{
+            cryptoFactoryFor(theirfile, password, ourfile, ourCryptoFactory)};
+
+        YAPET::File baseFile{baseCryptoFactory, basefile, false, false};
+        YAPET::File ourFile{ourCryptoFactory, ourfile, false, false};
+        YAPET::File theirFile{theirCryptoFactory, theirfile, false, false};
+
+        yapet::merge::RecordMerge merge{baseCryptoFactory, ourCryptoFactory,
+                                        theirCryptoFactory};
+        auto report{merge.merge(baseFile.readEncryptedRecords(),
+                                ourFile.readEncryptedRecords(),
+                                theirFile.readEncryptedRecords())};
+
+        std::unique_ptr<YAPET::File> outFile;
+        if (outputfile.empty()) {
+            outFile.reset(new YAPET::File{ourCryptoFactory, ourfile, false});
+        } else {
+            outFile.reset(
+                new YAPET::File{ourCryptoFactory, outputfile, true});
+        }
+        outFile->beginSave();
+        for (const auto& record : report.records) {
+            outFile->saveRecord(record);
+        }
+        outFile->endSave();
+
+        print_report(report);
+
+        if (report.hasConflicts()) {
+            return ERR_CONFLICTS;
+        }
+    } catch (std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        return ERR_FATAL;
+    }
+
+    return 0;
+}
@@ -0,0 +1,430 @@
+/*
+ * Copyright (C) 2018 Rafael Ostertag
+ *
+ * This file is part of YAPET.
+ *
+ * YAPET is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * YAPET is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * YAPET.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7
+ *
+ * If you modify this program, or any covered work, by linking or combining it
+ * with the OpenSSL project's OpenSSL library (or a modified version of that
+ * library), containing parts covered by the terms of the OpenSSL or SSLeay
+ * licenses, Rafael Ostertag grants you additional permission to convey the
+ * resulting work.  Corresponding Source for a non-source form of such a
+ * combination shall include the source code for the parts of OpenSSL used as
+ * well as that of the covered work.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef HAVE_GETOPT_H
+#include <getopt.h>
+#endif
+
+#include <libgen.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "cfg.h"
+#include "characterpool.hh"
+#include "consts.h"
+#include "intl.h"
+#include "passphrase.hh"
+#include "policygenerator.hh"
+#include "pronounceable.hh"
+#include "pwgen.hh"
+#include "securearray.hh"
+
+enum {
+    /**
+     * Error on command line, i.e. missing parameter.
+     */
+    ERR_CMDLINE = 1,
+    /**
+     * A fatal error.
+     */
+    ERR_FATAL = 2
+};
+
+/**
+ * Number of passwords or passphrases generated and written at once.
+ */
+constexpr std::size_t PASSWORDS_PER_WRITE{4096};
+
+const char COPYRIGHT[] =
+    "\nCopyright (C) 2018  Rafael Ostertag\n"
+    "\n"
+    "yapet-pwgen is part of YAPET.\n"
+    "\n"
+    "This program is free software: you can redistribute it and/or modify\n"
+    "it under the terms of the GNU General Public License as published by\n"
+    "the Free Software Foundation, either version 3 of the License, or\n"
+    "(at your option) any later version.\n"
+    "\n"
+    "This program is distributed in the hope that it will be useful,\n"
+    "but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+    "MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+    "GNU General Public License for more details.\n"
+    "\n"
+    "You should have received a copy of the GNU General Public License\n"
+    "along with this program.  If not, see <http://www.gnu.org/licenses/>.\n";
+
+void show_version() {
+    std::cout << _("yapet-pwgen is part of ");
+    std::cout << PACKAGE_STRING << std::endl;
+}
+
+void show_copyright() { std::cout << COPYRIGHT << std::endl; }
+
+void show_help(char* prgname) {
+    std::cout << std::endl;
+    std::cout << basename(prgname)
+              << " [-a] [-c] [-h] [-V] [-l <length>] [-n <count>] [-P <pools>]"
+              << std::endl
+              << "\t[-e] [-w <words>] [-W <wordlist>] [-s <separator>]"
+              << std::endl
+              << "\t[-C <capitalization>] [-p <profile>] [-r <rules>]"
+              << std::endl
+              << std::endl;
+    std::cout << "-a\t" << _("generate pronounceable passwords of lower case")
+              << std::endl
+              << "\t" << _("letters") << std::endl
+              << std::endl;
+    std::cout << "-C\t" << _("capitalization of passphrase words: none,")
+              << std::endl
+              << "\t" << _("first, or random. Default: ")
+              << YAPET::Consts::DEFAULT_PASSPHRASE_CAPITALIZATION << std::endl
+              << std::endl;
+    std::cout << "-c\t" << _("show copyright information") << std::endl
+              << std::endl;
+    std::cout << "-e\t" << _("write the entropy of the passphrases, or of")
+              << std::endl
+              << "\t" << _("pronounceable passwords or passwords")
+              << std::endl
+              << "\t" << _("satisfying rules, to stderr")
+              << std::endl
+              << std::endl;
+    std::cout << "-h\t" << _("show this help text") << std::endl << std::endl;
+    std::cout << "-l\t" << _("the length of the passwords. Default: ")
+              << YAPET::Consts::DEFAULT_PASSWORD_LENGTH << std::endl
+              << std::endl;
+    std::cout << "-n\t" << _("the number of passwords to generate.")
+              << std::endl
+              << "\t" << _("Default: 1") << std::endl
+              << std::endl;
+    std::cout << "-P\t" << _("comma separated list of the character pools")
+              << std::endl
+              << "\t" << _("to use: letters, digits, punct, special, and")
+              << std::endl
+              << "\t" << _("other. Default: letters,digits,punct,special")
+              << std::endl
+              << std::endl;
+    std::cout << "-p\t" << _("generate passwords satisfying the rules of")
+              << std::endl
+              << "\t" << _("profile in the configuration file") << std::endl
+              << std::endl;
+    std::cout << "-r\t" << _("generate passwords satisfying rules, e.g.")
+              << std::endl
+              << "\t" << _("'length=8-12 digits=2- special=0 repeat=1'")
+              << std::endl
+              << std::endl;
+    std::cout << "-s\t" << _("the separator of passphrase words. Default: ")
+              << YAPET::Consts::DEFAULT_PASSPHRASE_SEPARATOR << std::endl
+              << std::endl;
+    std::cout << "-V\t" << _("show the version of yapet-pwgen") << std::endl
+              << std::endl;
+    std::cout << "-W\t" << _("generate passphrases from the words of")
+              << std::endl
+              << "\t" << _("wordlist instead of the list installed.")
+              << std::endl
+              << std::endl;
+    std::cout << "-w\t" << _("generate passphrases of words words instead")
+              << std::endl
+              << "\t" << _("of passwords. Default: ")
+              << YAPET::Consts::DEFAULT_PASSPHRASE_WORDS << std::endl
+              << std::endl;
+    std::cout << _("yapet-pwgen writes random passwords to stdout, one per "
+                   "line.\n"
+                   "Each password contains a character of each pool, if it "
+                   "is long\n"
+                   "enough. With -p or -r, passwords satisfying the rules "
+                   "are\n"
+                   "written instead, and with -a pronounceable passwords. "
+                   "With -w\n"
+                   "or -W, passphrases of words picked at random from a "
+                   "word list\n"
+                   "are written instead.")
+              << std::endl
+              << std::endl;
+}
+
+bool parse_number(const char* str, unsigned long long& number) {
+    char* end;
+    errno = 0;
+    number = std::strtoull(str, &end, 10);
+    return *str != '\0' && *str != '-' && *end == '\0' && errno == 0;
+}
+
+void write_fully(int fd, const std::uint8_t* data, std::size_t size) {
+    while (size > 0) {
+        auto written = ::write(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error(std::strerror(errno));
+        }
+        data += written;
+        size -= written;
+    }
+}
+
+/**
+ * The rules of the rule profile \c name of the configuration file.
+ */
+std::string profile_rules(const std::string& name) {
+    YAPET::CONFIG::Config config;
+    YAPET::CONFIG::ConfigFile configFile{config};
+    configFile.parse();
+
+    auto profiles = config.pwgen_rules.get();
+    auto profile = profiles.find(name);
+    if (profile == profiles.end()) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("Unknown rule profile '%s'"), name.c_str());
+        throw std::invalid_argument{msg};
+    }
+    return profile->second;
+}
+
+int main(int argc, char** argv) {
+    unsigned long long length = YAPET::Consts::DEFAULT_PASSWORD_LENGTH;
+    bool lengthGiven = false;
+    unsigned long long count = 1;
+    int pools = YAPET::Consts::DEFAULT_CHARACTER_POOLS;
+    bool passphrases = false;
+    bool showEntropy = false;
+    unsigned long long words = YAPET::Consts::DEFAULT_PASSPHRASE_WORDS;
+    std::string wordlist;
+    std::string separator{YAPET::Consts::DEFAULT_PASSPHRASE_SEPARATOR};
+    auto capitalization = yapet::pwgen::parseCapitalization(
+        YAPET::Consts::DEFAULT_PASSPHRASE_CAPITALIZATION);
+    bool useRules = false;
+    bool pronounceable = false;
+    std::string rules;
+
+    int c;
+    extern char* optarg;
+    extern int optopt;
+
+    while ((c = getopt(argc, argv, ":aC:cehl:n:P:p:r:s:VW:w:")) != -1) {
+        switch (c) {
+            case 'a':
+                pronounceable = true;
+                break;
+            case 'C':
+                try {
+                    capitalization = yapet::pwgen::parseCapitalization(optarg);
+                } catch (std::invalid_argument& ex) {
+                    std::cerr << ex.what() << std::endl;
+                    return ERR_CMDLINE;
+                }
+                break;
+            case 'c':
+                show_copyright();
+                return 0;
+            case 'e':
+                showEntropy = true;
+                break;
+            case 'h':
+                show_help(argv[0]);
+                return 0;
+            case 'l':
+                if (!parse_number(optarg, length) ||
+                    length < YAPET::Consts::MIN_PASSWORD_LENGTH ||
+                    length > YAPET::Consts::MAX_PASSWORD_LENGTH) {
+                    std::cerr << _("invalid password length") << " '"
+                              << optarg << "'" << std::endl;
+                    return ERR_CMDLINE;
+                }
+                lengthGiven = true;
+                break;
+            case 'n':
+                if (!parse_number(optarg, count)) {
+                    std::cerr << _("invalid number of passwords") << " '"
+                              << optarg << "'" << std::endl;
+                    return ERR_CMDLINE;
+                }
+                break;
+            case 'P':
+                try {
+                    pools = yapet::pwgen::parsePools(optarg);
+                } catch (std::invalid_argument& ex) {
+                    std::cerr << ex.what() << std::endl;
+                    return ERR_CMDLINE;
+                }
+                break;
+            case 'p':
+                try {
+                    rules = profile_rules(optarg);
+                } catch (std::exception& ex) {
+                    std::cerr << ex.what() << std::endl;
+                    return ERR_CMDLINE;
+                }
+                useRules = true;
+                break;
+            case 'r':
+                rules = optarg;
+                useRules = true;
+                break;
+            case 's':
+                separator = optarg;
+                break;
+            case 'V':
+                show_version();
+                return 0;
+            case 'W':
+                wordlist = optarg;
+                passphrases = true;
+                break;
+            case 'w':
+                if (!parse_number(optarg, words) ||
+                    words < YAPET::Consts::MIN_PASSPHRASE_WORDS ||
+                    words > YAPET::Consts::MAX_PASSPHRASE_WORDS) {
+                    std::cerr << _("invalid number of words") << " '"
+                              << optarg << "'" << std::endl;
+                    return ERR_CMDLINE;
+                }
+                passphrases = true;
+                break;
+            case ':':
+                std::cerr << "-" << (char)optopt << _(" without argument")
+                          << std::endl;
+                return ERR_CMDLINE;
+            case '?':
+                std::cerr << _("unknown argument") << " '" << (char)optopt
+                          << "'" << std::endl;
+                return ERR_CMDLINE;
+        }
+    }
+
+    yapet::pwgen::Policy policy;
+    if (useRules) {
+        try {
+            policy = yapet::pwgen::Policy::parse(rules);
+        } catch (std::invalid_argument& ex) {
+            std::cerr << ex.what() << std::endl;
+            return ERR_CMDLINE;
+        }
+        if (!lengthGiven) length = policy.clampLength(length);
+    }
+
+    try {
+        if (passphrases) {
+            auto list = wordlist.empty()
+                            ? yapet::pwgen::Wordlist::loadDefault()
+                            : std::make_shared<const yapet::pwgen::Wordlist>(
+                                  wordlist);
+            yapet::pwgen::PassphraseGenerator passphraseGenerator{
+                list, static_cast<int>(words), separator, capitalization};
+            if (showEntropy) {
+                std::cerr << _("Entropy: ")
+                          << static_cast<int>(passphraseGenerator.entropy())
+                          << _(" bits") << std::endl;
+            }
+
+            yapet::SecureArray buffer{
+                static_cast<yapet::SecureArray::size_type>(
+                    PASSWORDS_PER_WRITE *
+                    (passphraseGenerator.maxLength() + 1))};
+            while (count > 0) {
+                auto passwords = std::min<unsigned long long>(
+                    count, PASSWORDS_PER_WRITE);
+                auto size = passphraseGenerator.generatePassphrases(
+                    passwords, *buffer);
+                write_fully(STDOUT_FILENO, *buffer, size);
+                count -= passwords;
+            }
+            return 0;
+        }
+
+        int size = static_cast<int>(length);
+        yapet::SecureArray buffer{static_cast<yapet::SecureArray::size_type>(
+            PASSWORDS_PER_WRITE * (size + 1))};
+
+        if (useRules) {
+            yapet::pwgen::PolicyGenerator policyGenerator{policy};
+            if (showEntropy) {
+                std::cerr << _("Entropy: ")
+                          << static_cast<int>(policyGenerator.entropy(size))
+                          << _(" bits") << std::endl;
+            }
+
+            while (count > 0) {
+                auto passwords = std::min<unsigned long long>(
+                    count, PASSWORDS_PER_WRITE);
+                policyGenerator.generatePasswords(size, passwords, *buffer);
+                write_fully(STDOUT_FILENO, *buffer, passwords * (size + 1));
+                count -= passwords;
+            }
+            return 0;
+        }
+
+        if (pronounceable) {
+            yapet::pwgen::PronounceableGenerator pronounceableGenerator;
+            if (showEntropy) {
+                std::cerr << _("Entropy: ")
+                          << static_cast<int>(
+                                 yapet::pwgen::PronounceableGenerator::entropy(
+                                     size))
+                          << _(" bits") << std::endl;
+            }
+
+            while (count > 0) {
+                auto passwords = std::min<unsigned long long>(
+                    count, PASSWORDS_PER_WRITE);
+                pronounceableGenerator.generatePasswords(size, passwords,
+                                                         *buffer);
+                write_fully(STDOUT_FILENO, *buffer, passwords * (size + 1));
+                count -= passwords;
+            }
+            return 0;
+        }
+
+        yapet::pwgen::PasswordGenerator passwordGenerator{pools};
+
+        while (count > 0) {
+            auto passwords = std::min<unsigned long long>(
+                count, PASSWORDS_PER_WRITE);
+            passwordGenerator.generatePasswords(size, passwords, *buffer);
+            write_fully(STDOUT_FILENO, *buffer, passwords * (size + 1));
+            count -= passwords;
+        }
+    } catch (std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        return ERR_FATAL;
+    }
+
+    return 0;
+}
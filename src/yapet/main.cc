@@ -50,13 +50,27 @@
 #include <getopt.h>
 #endif
 
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <stdexcept>
 #include <string>
 
 #include <yacurs.h>
 
+#include "aes256factory.hh"
+#include "agentclient.hh"
+#include "consts.h"
+#include "cryptofactoryhelper.hh"
+#include "file.hh"
+#include "fileerror.hh"
 #include "globals.h"
 #include "mainwindow.h"
+#include "readpassword.hh"
+#include "recordbatch.hh"
 #include "yapetlockscreen.h"
 #include "yapetunlockdialog.h"
 #include "openssl.hh"
@@ -70,6 +84,12 @@
  * and initialize curses.
  */
 
+/**
+ * The options running a command instead of the user interface, which cannot
+ * be combined.
+ */
+const char COMMAND_OPTIONS[] = "abdkl";
+
 const char COPYRIGHT[] =
     "YAPET -- Yet Another Password Encryption Tool\n"
     "Copyright (C) 2008-2018  Rafael Ostertag\n"
@@ -140,15 +160,39 @@ void show_copyright() { std::cout << COPYRIGHT << std::endl; }
 void show_help(char* prgname) {
     std::cout << std::endl;
     std::cout << basename(prgname)
-              << " [-chV] [-i | -r <rcfile>] [-s | -S] [-t <sec>] [<filename>]"
+              << " [-bchkV] [-a | -d <slot> | -l] [-i | -r <rcfile>] "
+                 "[-s | -S]\n\t[-t <sec>] [<filename>]"
+              << std::endl
+              << std::endl;
+    std::cout << "-a\t\t"
+              << _("add a key slot holding a new password to <filename>,\n"
+                   "\t\twithout starting the user interface.")
+              << std::endl
+              << std::endl;
+    std::cout << "-b\t\t"
+              << _("apply the commands read from stdin to <filename> and save\n"
+                   "\t\tit once, without starting the user interface.")
               << std::endl
               << std::endl;
     std::cout << "-c\t\t" << _("show copyright information") << std::endl
               << std::endl;
+    std::cout << "-d <slot>\t"
+              << _("remove the key slot <slot> from <filename>, without\n"
+                   "\t\tstarting the user interface.")
+              << std::endl
+              << std::endl;
     std::cout << "-h\t\t" << _("show this help text") << std::endl << std::endl;
     std::cout << "-i\t\t" << _("do not read the configuration file.")
               << std::endl
               << std::endl;
+    std::cout << "-k\t\t"
+              << _("re-encrypt all records of <filename> using a new data "
+                   "key,\n"
+                   "\t\twithout starting the user interface.")
+              << std::endl
+              << std::endl;
+    std::cout << "-l\t\t" << _("list the key slots of <filename>.") << std::endl
+              << std::endl;
     std::cout
         << "-r <rfcfile>\t"
         << _("read the configuration file specified by <rcfile>. If this\n"
@@ -190,6 +234,217 @@ void show_help(char* prgname) {
     std::cout << buff << std::endl << std::endl;
 }
 
+/**
+ * Reads a password from the terminal after showing \c prompt, since the
+ * standard input holds the commands in batch mode.
+ */
+yapet::SecureArray read_secret(const std::string& prompt) {
+    std::FILE* tty = std::fopen("/dev/tty", "r+");
+    if (tty == nullptr) {
+        throw std::runtime_error(_("Cannot open terminal to read password"));
+    }
+
+    try {
+        auto password{yapet::readPassword(prompt, tty)};
+        std::fclose(tty);
+        return password;
+    } catch (...) {
+        std::fclose(tty);
+        throw;
+    }
+}
+
+/**
+ * Reads the password of \c filename from the terminal.
+ */
+yapet::SecureArray read_password(const std::string& filename) {
+    return read_secret(std::string{_("Please enter the password for ")} +
+                       filename + ": ");
+}
+
+/**
+ * Returns the crypto factory for \c filename derived from \c password.
+ */
+std::shared_ptr<yapet::AbstractCryptoFactory> crypto_factory(
+    const std::string& filename, const yapet::SecureArray& password) {
+    std::shared_ptr<yapet::AbstractCryptoFactory> cryptoFactory{
+        yapet::getCryptoFactoryForFile(filename, password)};
+    if (!cryptoFactory) {
+        char msg[YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE];
+        std::snprintf(msg, YAPET::Consts::EXCEPTION_MESSAGE_BUFFER_SIZE,
+                      _("File '%s' not recognized"), filename.c_str());
+        throw yapet::FileFormatError{msg};
+    }
+    return cryptoFactory;
+}
+
+/**
+ * Applies the commands read from stdin to \c filename, and saves the file
+ * once all commands have been applied. The file is left unchanged if any
+ * command fails.
+ *
+ * The password is only asked for if the agent does not hold the key of \c
+ * filename.
+ */
+int run_batch(const std::string& filename) {
+    if (filename.empty()) {
+        std::cerr << _("No file specified") << std::endl;
+        return 1;
+    }
+
+    try {
+        auto cryptoFactory{yapet::agent::agentCryptoFactoryForFile(filename)};
+        if (!cryptoFactory) {
+            cryptoFactory = crypto_factory(filename, read_password(filename));
+        }
+
+        YAPET::File file{cryptoFactory, filename, false,
+                         YAPET::Globals::config.filesecurity};
+        yapet::RecordBatch batch{cryptoFactory, file.readEncryptedRecords()};
+        auto commands{batch.apply("/dev/stdin")};
+        if (batch.modified()) {
+            file.saveAtomically(batch.encryptedRecords());
+        }
+
+        std::cerr << commands << _(" commands applied, ") << batch.size()
+                  << _(" records stored") << std::endl;
+    } catch (std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * Re-encrypts all records of \c filename using a new random data key. The
+ * passwords stay the same, but new keying parameters are used.
+ *
+ * The new data key is wrapped into every key slot in use, so the password of
+ * each key slot other than the one opening the file is asked for.
+ */
+int run_rotate(const std::string& filename) {
+    if (filename.empty()) {
+        std::cerr << _("No file specified") << std::endl;
+        return 1;
+    }
+
+    try {
+        auto password{read_password(filename)};
+        auto cryptoFactory{crypto_factory(filename, password)};
+
+        YAPET::File file{cryptoFactory, filename, false,
+                         YAPET::Globals::config.filesecurity};
+        auto currentKey{
+            std::dynamic_pointer_cast<yapet::Key256>(cryptoFactory->key())};
+
+        std::shared_ptr<yapet::AbstractCryptoFactory> newCryptoFactory;
+        if (currentKey && currentKey->isDataKey()) {
+            std::map<int, yapet::SecureArray> passwords;
+            for (auto keySlot : currentKey->keySlots()) {
+                if (keySlot == currentKey->keySlot()) {
+                    passwords[keySlot] = password;
+                    continue;
+                }
+
+                passwords[keySlot] = read_secret(
+                    std::string{_("Please enter the password of key slot ")} +
+                    std::to_string(keySlot) + ": ");
+            }
+
+            std::shared_ptr<yapet::Key256> key256{
+                new yapet::Key256{*currentKey}};
+            key256->rotateDataKey(passwords);
+            newCryptoFactory.reset(new yapet::Aes256Factory{key256});
+        } else {
+            newCryptoFactory.reset(new yapet::Aes256Factory{
+                password, yapet::Key256::newDefaultKeyingParameters()});
+        }
+        file.setNewKey(newCryptoFactory);
+
+        std::cerr << _("Data key rotated") << std::endl;
+    } catch (std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * Lists, adds or removes the key slots of \c filename, depending on \c
+ * command being \c l, \c a or \c d. Adding or removing a key slot only
+ * rewrites the file header, records are not re-encrypted.
+ *
+ * @param slot the key slot to remove.
+ */
+int run_key_slots(const std::string& filename, char command, int slot) {
+    if (filename.empty()) {
+        std::cerr << _("No file specified") << std::endl;
+        return 1;
+    }
+
+    try {
+        auto cryptoFactory{crypto_factory(filename, read_password(filename))};
+
+        YAPET::File file{cryptoFactory, filename, false,
+                         YAPET::Globals::config.filesecurity};
+        auto currentKey{
+            std::dynamic_pointer_cast<yapet::Key256>(cryptoFactory->key())};
+        if (!currentKey || !currentKey->isDataKey()) {
+            throw std::runtime_error(
+                _("File has no key slots, change its password first"));
+        }
+
+        if (command == 'l') {
+            for (auto keySlot : currentKey->keySlots()) {
+                auto parameters{currentKey->keySlotParameters(keySlot)};
+                std::cout
+                    << keySlot << "\t" << _("time cost ")
+                    << parameters.getValue(
+                           YAPET::Consts::ARGON2_TIME_COST_KEY)
+                    << ", " << _("memory cost ")
+                    << parameters.getValue(
+                           YAPET::Consts::ARGON2_MEMORY_COST_KEY)
+                    << ", " << _("parallelism ")
+                    << parameters.getValue(
+                           YAPET::Consts::ARGON2_PARALLELISM_KEY)
+                    << (keySlot == currentKey->keySlot() ? " *" : "")
+                    << std::endl;
+            }
+            return 0;
+        }
+
+        std::shared_ptr<yapet::Key256> key256{
+            new yapet::Key256{*currentKey}};
+        if (command == 'a') {
+            auto password{read_secret(_("Please enter the new password: "))};
+            if (password !=
+                read_secret(_("Please enter the new password again: "))) {
+                throw std::runtime_error(_("Passwords do not match"));
+            }
+
+            slot = key256->addKeySlot(
+                password, yapet::Key256::newDefaultKeyingParameters());
+        } else {
+            key256->removeKeySlot(slot);
+        }
+
+        std::shared_ptr<yapet::AbstractCryptoFactory> newCryptoFactory{
+            new yapet::Aes256Factory{key256}};
+        file.setNewKey(newCryptoFactory);
+
+        std::cerr << (command == 'a' ? _("Key slot added: ")
+                                     : _("Key slot removed: "))
+                  << slot << std::endl;
+    } catch (std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
 int main(int argc, char** argv) {
     set_rlimit();
 
@@ -204,16 +459,46 @@ int main(int argc, char** argv) {
 
     // If empty, default is taken
     std::string cfgfilepath;
+    // The option of the command run instead of the user interface
+    char command = '\0';
+    int keySlot = -1;
+    char* end;
     int c;
     extern char* optarg;
     extern int optopt, optind;
 
-    while ((c = getopt(argc, argv, ":chir:sSt:V")) != -1) {
+    while ((c = getopt(argc, argv, ":abcd:hiklr:sSt:V")) != -1) {
+        if (std::strchr(COMMAND_OPTIONS, c) != nullptr && command != '\0' &&
+            command != c) {
+            std::cerr << "-" << command << _(" cannot be used with ") << "-"
+                      << (char)c << std::endl;
+            show_help(argv[0]);
+            return 1;
+        }
+
         switch (c) {
+            case 'a':
+                command = 'a';
+                break;
+
+            case 'b':
+                command = 'b';
+                break;
+
             case 'c':
                 show_copyright();
                 return 0;
 
+            case 'd':
+                keySlot = std::strtol(optarg, &end, 10);
+                if (*optarg == '\0' || *end != '\0') {
+                    std::cerr << _("invalid key slot") << " '" << optarg
+                              << "'" << std::endl;
+                    return 1;
+                }
+                command = 'd';
+                break;
+
             case 'h':
                 show_help(argv[0]);
                 return 0;
@@ -223,6 +508,14 @@ int main(int argc, char** argv) {
                 YAPET::Globals::config.ignorerc.lock();
                 break;
 
+            case 'k':
+                command = 'k';
+                break;
+
+            case 'l':
+                command = 'l';
+                break;
+
             case 'r':
                 cfgfilepath = optarg;
                 break;
@@ -281,6 +574,19 @@ int main(int argc, char** argv) {
 
     yapet::OpenSSL::init();
 
+    if (command == 'b') {
+        return run_batch(YAPET::Globals::config.petfile);
+    }
+
+    if (command == 'k') {
+        return run_rotate(YAPET::Globals::config.petfile);
+    }
+
+    if (command != '\0') {
+        return run_key_slots(YAPET::Globals::config.petfile, command,
+                             keySlot);
+    }
+
     YapetUnlockDialog* yunlockdia = nullptr;
     try {
         try {
@@ -0,0 +1,272 @@
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "aes256factory.hh"
+#include "agentclient.hh"
+#include "agentserver.hh"
+#include "file.hh"
+#include "key256.hh"
+#include "keystore.hh"
+#include "passwordlistitem.hh"
+#include "passwordrecord.hh"
+
+constexpr auto TEST_FILE{"agent-test.pet"};
+constexpr auto TEST_SOCKET{"agent-test.socket"};
+constexpr auto TEST_PASSWORD{"Secret"};
+constexpr auto ROUNDS{200};
+
+using yapet::agent::AgentClient;
+using yapet::agent::AgentError;
+using yapet::agent::AgentServer;
+using yapet::agent::Fields;
+using yapet::agent::KeyStore;
+using yapet::agent::Message;
+
+class AgentTest : public CppUnit::TestFixture {
+   private:
+    static yapet::SecureArray key(std::uint8_t value) {
+        yapet::SecureArray key{KeyStore::SLOT_SIZE};
+        std::memset(*key, value, KeyStore::SLOT_SIZE);
+        return key;
+    }
+
+    static std::string name(const yapet::PasswordRecord& record) {
+        return reinterpret_cast<const char*>(record.name());
+    }
+
+    static void createFile() {
+        std::shared_ptr<yapet::AbstractCryptoFactory> cryptoFactory{
+            new yapet::Aes256Factory{
+                yapet::toSecureArray(TEST_PASSWORD),
+                yapet::Key256::newDefaultKeyingParameters()}};
+        YAPET::File file{cryptoFactory, TEST_FILE, true, false};
+
+        std::list<yapet::PasswordListItem> items;
+        auto crypto{cryptoFactory->crypto()};
+        for (int i = 0; i < ROUNDS; i++) {
+            yapet::PasswordRecord record;
+            record.name(("name " + std::to_string(i)).c_str());
+            record.password(("password " + std::to_string(i)).c_str());
+            items.emplace_back(
+                reinterpret_cast<const char*>(record.name()),
+                               crypto->encrypt(record.serialize()));
+        }
+        file.save(items);
+    }
+
+   public:
+    static CppUnit::TestSuite* suite() {
+        CppUnit::TestSuite* suiteOfTests = new CppUnit::TestSuite("Agent");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<AgentTest>(
+            "should transfer messages", &AgentTest::messages));
+        suiteOfTests->addTest(new CppUnit::TestCaller<AgentTest>(
+            "should reject truncated messages", &AgentTest::truncated));
+        suiteOfTests->addTest(new CppUnit::TestCaller<AgentTest>(
+            "should keep keys", &AgentTest::keyStore));
+        suiteOfTests->addTest(new CppUnit::TestCaller<AgentTest>(
+            "should drop idle keys", &AgentTest::idleKeys));
+        suiteOfTests->addTest(new CppUnit::TestCaller<AgentTest>(
+            "should drop least recently used key if full",
+            &AgentTest::fullKeyStore));
+        suiteOfTests->addTest(new CppUnit::TestCaller<AgentTest>(
+            "should serve clients", &AgentTest::server));
+
+        return suiteOfTests;
+    }
+
+    void messages() {
+        int fds[2];
+        CPPUNIT_ASSERT(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+
+        Fields fields{yapet::toSecureArray("first"), yapet::SecureArray{},
+                      yapet::agent::toField("third")};
+        yapet::agent::sendMessage(fds[0], Message::ENCRYPT, fields);
+        yapet::agent::sendMessage(fds[0], Message::STOP);
+        ::close(fds[0]);
+
+        Message type;
+        Fields received;
+        CPPUNIT_ASSERT(yapet::agent::receiveMessage(fds[1], type, received));
+        CPPUNIT_ASSERT(type == Message::ENCRYPT);
+        CPPUNIT_ASSERT(received == fields);
+        CPPUNIT_ASSERT(yapet::agent::toString(received[2]) == "third");
+
+        CPPUNIT_ASSERT(yapet::agent::receiveMessage(fds[1], type, received));
+        CPPUNIT_ASSERT(type == Message::STOP);
+        CPPUNIT_ASSERT(received.empty());
+
+        CPPUNIT_ASSERT(!yapet::agent::receiveMessage(fds[1], type, received));
+        ::close(fds[1]);
+    }
+
+    void truncated() {
+        int fds[2];
+        CPPUNIT_ASSERT(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+
+        // Announces a field of 255 bytes, but carries three
+        const std::uint8_t message[]{0,    0,   0,   12,  14,  0,  0, 0,
+                                     1,    0,   0,   0,   255, 'a', 'b', 'c'};
+        CPPUNIT_ASSERT(::write(fds[0], message, sizeof(message)) ==
+                       sizeof(message));
+        ::close(fds[0]);
+
+        Message type;
+        Fields received;
+        CPPUNIT_ASSERT_THROW(
+            yapet::agent::receiveMessage(fds[1], type, received), AgentError);
+        ::close(fds[1]);
+    }
+
+    void keyStore() {
+        KeyStore store{4, std::chrono::seconds{0}};
+        yapet::MetaData keyingParameters;
+
+        store.add("one", key(1), keyingParameters);
+        CPPUNIT_ASSERT(store.has("one"));
+        CPPUNIT_ASSERT(!store.has("two"));
+        CPPUNIT_ASSERT(store.key("one") == key(1));
+        CPPUNIT_ASSERT_THROW(store.key("two"), AgentError);
+
+        store.add("one", key(2), keyingParameters);
+        CPPUNIT_ASSERT(store.size() == 1);
+        CPPUNIT_ASSERT(store.key("one") == key(2));
+
+        CPPUNIT_ASSERT_THROW(
+            store.add("short", yapet::SecureArray{16}, keyingParameters),
+            AgentError);
+
+        yapet::agent::LockedKey lockedKey{store, "one"};
+        CPPUNIT_ASSERT(lockedKey.key() == key(2));
+
+        const std::uint8_t* used{nullptr};
+        lockedKey.useKey([&used](const std::uint8_t* k) { used = k; });
+        CPPUNIT_ASSERT(used != nullptr);
+        CPPUNIT_ASSERT(std::memcmp(used, *key(2), KeyStore::SLOT_SIZE) == 0);
+
+        store.clear();
+        CPPUNIT_ASSERT(store.size() == 0);
+        CPPUNIT_ASSERT_THROW(lockedKey.key(), AgentError);
+        CPPUNIT_ASSERT_THROW(lockedKey.useKey([](const std::uint8_t*) {}),
+                             AgentError);
+    }
+
+    void idleKeys() {
+        KeyStore store{4, std::chrono::seconds{60}};
+        yapet::MetaData keyingParameters;
+        auto now{KeyStore::Clock::now()};
+
+        store.add("one", key(1), keyingParameters, now);
+        store.add("two", key(2), keyingParameters, now);
+
+        now += std::chrono::seconds{50};
+        store.key("one", now);
+
+        now += std::chrono::seconds{20};
+        auto dropped{store.expire(now)};
+        CPPUNIT_ASSERT(dropped.size() == 1);
+        CPPUNIT_ASSERT(dropped[0] == "two");
+        CPPUNIT_ASSERT(store.has("one", now));
+
+        now += std::chrono::seconds{61};
+        CPPUNIT_ASSERT_THROW(store.key("one", now), AgentError);
+        CPPUNIT_ASSERT(store.size() == 0);
+    }
+
+    void fullKeyStore() {
+        KeyStore store{2, std::chrono::seconds{0}};
+        yapet::MetaData keyingParameters;
+
+        store.add("one", key(1), keyingParameters);
+        store.add("two", key(2), keyingParameters);
+        store.key("one");
+        store.add("three", key(3), keyingParameters);
+
+        CPPUNIT_ASSERT(store.size() == 2);
+        CPPUNIT_ASSERT(store.has("one"));
+        CPPUNIT_ASSERT(!store.has("two"));
+        CPPUNIT_ASSERT(store.key("three") == key(3));
+    }
+
+    void server() {
+        createFile();
+
+        AgentServer agentServer{TEST_SOCKET, std::chrono::seconds{0}};
+        std::thread serverThread{&AgentServer::run, &agentServer};
+
+        {
+            AgentClient client{TEST_SOCKET};
+            auto id{yapet::agent::keyId(TEST_FILE)};
+            CPPUNIT_ASSERT(!client.hasKey(id));
+            CPPUNIT_ASSERT_THROW(client.lookup(TEST_FILE, "*"), AgentError);
+
+            CPPUNIT_ASSERT_THROW(
+                client.addKey(TEST_FILE, yapet::toSecureArray("wrong")),
+                AgentError);
+            CPPUNIT_ASSERT(!client.hasKey(id));
+
+            client.addKey(TEST_FILE, yapet::toSecureArray(TEST_PASSWORD));
+            CPPUNIT_ASSERT(client.hasKey(id));
+
+            auto plainText{yapet::toSecureArray("plain text")};
+            auto cipherText{client.encrypt(id, plainText)};
+            CPPUNIT_ASSERT(cipherText != plainText);
+            CPPUNIT_ASSERT(client.decrypt(id, cipherText) == plainText);
+
+            auto records{client.lookup(TEST_FILE, "name 1?")};
+            CPPUNIT_ASSERT(records.size() == 10);
+            CPPUNIT_ASSERT(name(records[0]) == "name 10");
+            CPPUNIT_ASSERT(name(records[9]) == "name 19");
+            CPPUNIT_ASSERT(std::string{reinterpret_cast<const char*>(
+                               records[0].password())} == "password 10");
+
+            // Served from the names cached
+            CPPUNIT_ASSERT(client.lookup(TEST_FILE, "name 199").size() == 1);
+            CPPUNIT_ASSERT(client.lookup(TEST_FILE, "*").size() == ROUNDS);
+            CPPUNIT_ASSERT(client.lookup(TEST_FILE, "nothing").empty());
+
+            ::setenv(yapet::agent::SOCKET_ENVIRONMENT_VARIABLE, TEST_SOCKET,
+                     1);
+            auto cryptoFactory{
+                yapet::agent::agentCryptoFactoryForFile(TEST_FILE)};
+            CPPUNIT_ASSERT(cryptoFactory);
+            YAPET::File file{cryptoFactory, TEST_FILE, false, false};
+            CPPUNIT_ASSERT(file.readEncryptedRecords().size() == ROUNDS);
+
+            client.removeAll();
+            CPPUNIT_ASSERT(!client.hasKey(id));
+            CPPUNIT_ASSERT(!yapet::agent::agentCryptoFactoryForFile(TEST_FILE));
+            ::unsetenv(yapet::agent::SOCKET_ENVIRONMENT_VARIABLE);
+            CPPUNIT_ASSERT(!yapet::agent::agentCryptoFactoryForFile(TEST_FILE));
+
+            client.stop();
+        }
+
+        serverThread.join();
+        CPPUNIT_ASSERT(::access(TEST_SOCKET, F_OK) != 0);
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(AgentTest::suite());
+    return runner.run() ? 0 : 1;
+}
@@ -0,0 +1,192 @@
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "aes256factory.hh"
+#include "passwordaudit.hh"
+#include "passwordrecord.hh"
+
+constexpr auto TEST_PASSWORD{"Secret"};
+// Enough records to spread the audit over several worker threads
+constexpr auto ROUNDS{2000};
+
+class AuditTest : public CppUnit::TestFixture {
+   private:
+    std::shared_ptr<yapet::AbstractCryptoFactory> _cryptoFactory;
+
+    yapet::SecureArray encryptedRecord(const std::string& name,
+                                       const char* host, const char* username,
+                                       const char* password) {
+        yapet::PasswordRecord record;
+        record.name(name.c_str());
+        record.host(host);
+        record.username(username);
+        record.password(password);
+        record.comment("comment");
+
+        return _cryptoFactory->crypto()->encrypt(record.serialize());
+    }
+
+   public:
+    static CppUnit::TestSuite* suite() {
+        CppUnit::TestSuite* suiteOfTests = new CppUnit::TestSuite("Audit");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<AuditTest>(
+            "should report nothing on clean records",
+            &AuditTest::cleanRecords));
+        suiteOfTests->addTest(new CppUnit::TestCaller<AuditTest>(
+            "should find reused passwords", &AuditTest::reusedPasswords));
+        suiteOfTests->addTest(new CppUnit::TestCaller<AuditTest>(
+            "should find duplicate names and accounts",
+            &AuditTest::duplicateNamesAndAccounts));
+        suiteOfTests->addTest(new CppUnit::TestCaller<AuditTest>(
+            "should find empty passwords", &AuditTest::emptyPasswords));
+        suiteOfTests->addTest(new CppUnit::TestCaller<AuditTest>(
+            "should find weak passwords", &AuditTest::weakPasswords));
+        suiteOfTests->addTest(new CppUnit::TestCaller<AuditTest>(
+            "should handle empty record list", &AuditTest::noRecords));
+
+        return suiteOfTests;
+    }
+
+    void setUp() {
+        _cryptoFactory.reset(new yapet::Aes256Factory{
+            yapet::toSecureArray(TEST_PASSWORD),
+            yapet::Key256::newDefaultKeyingParameters()});
+    }
+
+    void tearDown() { _cryptoFactory.reset(); }
+
+    void cleanRecords() {
+        std::vector<yapet::SecureArray> records;
+        for (int i = 0; i < ROUNDS; i++) {
+            auto suffix{std::to_string(i)};
+            records.push_back(encryptedRecord("name " + suffix,
+                                              ("host " + suffix).c_str(),
+                                              "user",
+                                              ("password " + suffix).c_str()));
+        }
+
+        yapet::audit::PasswordAudit audit{_cryptoFactory};
+        auto report{audit.audit(records)};
+
+        CPPUNIT_ASSERT(report.names.size() == ROUNDS);
+        CPPUNIT_ASSERT(report.names[ROUNDS - 1] ==
+                       "name " + std::to_string(ROUNDS - 1));
+        CPPUNIT_ASSERT(!report.hasFindings());
+    }
+
+    void reusedPasswords() {
+        std::vector<yapet::SecureArray> records;
+        for (int i = 0; i < ROUNDS; i++) {
+            auto suffix{std::to_string(i)};
+            // every 500th record reuses the same password
+            std::string password{i % 500 == 0 ? "reused"
+                                              : "password " + suffix};
+            records.push_back(encryptedRecord("name " + suffix,
+                                              ("host " + suffix).c_str(),
+                                              "user", password.c_str()));
+        }
+
+        yapet::audit::PasswordAudit audit{_cryptoFactory};
+        auto report{audit.audit(records)};
+
+        CPPUNIT_ASSERT(report.reusedPasswords.size() == 1);
+        yapet::audit::RecordGroup expected{0, 500, 1000, 1500};
+        CPPUNIT_ASSERT(report.reusedPasswords[0] == expected);
+        CPPUNIT_ASSERT(report.duplicateNames.empty());
+        CPPUNIT_ASSERT(report.duplicateAccounts.empty());
+        CPPUNIT_ASSERT(report.emptyPasswords.empty());
+    }
+
+    void duplicateNamesAndAccounts() {
+        std::vector<yapet::SecureArray> records;
+        records.push_back(encryptedRecord("mail", "host", "user", "pw1"));
+        records.push_back(encryptedRecord("web", "host", "user", "pw2"));
+        records.push_back(encryptedRecord("mail", "other", "user", "pw3"));
+        // Host and user name must not be confused with "host" + "user"
+        records.push_back(encryptedRecord("shell", "hostu", "ser", "pw4"));
+        // Empty accounts are not reported
+        records.push_back(encryptedRecord("a", "", "", "pw5"));
+        records.push_back(encryptedRecord("b", "", "", "pw6"));
+
+        yapet::audit::PasswordAudit audit{_cryptoFactory};
+        auto report{audit.audit(records)};
+
+        CPPUNIT_ASSERT(report.duplicateNames.size() == 1);
+        yapet::audit::RecordGroup expectedNames{0, 2};
+        CPPUNIT_ASSERT(report.duplicateNames[0] == expectedNames);
+
+        CPPUNIT_ASSERT(report.duplicateAccounts.size() == 1);
+        yapet::audit::RecordGroup expectedAccounts{0, 1};
+        CPPUNIT_ASSERT(report.duplicateAccounts[0] == expectedAccounts);
+
+        CPPUNIT_ASSERT(report.reusedPasswords.empty());
+    }
+
+    void emptyPasswords() {
+        std::vector<yapet::SecureArray> records;
+        records.push_back(encryptedRecord("a", "host a", "user", ""));
+        records.push_back(encryptedRecord("b", "host b", "user", "pw"));
+        records.push_back(encryptedRecord("c", "host c", "user", ""));
+
+        yapet::audit::PasswordAudit audit{_cryptoFactory};
+        auto report{audit.audit(records)};
+
+        yapet::audit::RecordGroup expected{0, 2};
+        CPPUNIT_ASSERT(report.emptyPasswords == expected);
+        // Empty passwords are not reported as reused
+        CPPUNIT_ASSERT(report.reusedPasswords.empty());
+    }
+
+    void weakPasswords() {
+        std::vector<yapet::SecureArray> records;
+        records.push_back(encryptedRecord("a", "host a", "user", "aaaaaaaa"));
+        records.push_back(
+            encryptedRecord("b", "host b", "user", "k8#Vq!2zLp9@xW"));
+        records.push_back(encryptedRecord("c", "host c", "user", "qwertyui"));
+        records.push_back(encryptedRecord("d", "host d", "user", ""));
+
+        yapet::audit::PasswordAudit audit{_cryptoFactory};
+        auto report{audit.audit(records)};
+        CPPUNIT_ASSERT(report.weakPasswords.empty());
+        CPPUNIT_ASSERT(report.strengths.empty());
+
+        audit.strengthEstimator(
+            std::make_shared<yapet::strength::StrengthEstimator>(), 3);
+        report = audit.audit(records);
+
+        // Empty passwords are not reported as weak
+        yapet::audit::RecordGroup expected{0, 2};
+        CPPUNIT_ASSERT(report.weakPasswords == expected);
+        CPPUNIT_ASSERT(report.strengths.size() == records.size());
+        CPPUNIT_ASSERT(report.strengths[1].score ==
+                       yapet::strength::StrengthEstimator::MAX_SCORE);
+        CPPUNIT_ASSERT(report.strengths[2].pattern ==
+                       yapet::strength::Pattern::SPATIAL);
+    }
+
+    void noRecords() {
+        yapet::audit::PasswordAudit audit{_cryptoFactory};
+        auto report{audit.audit(std::vector<yapet::SecureArray>{})};
+
+        CPPUNIT_ASSERT(report.names.empty());
+        CPPUNIT_ASSERT(!report.hasFindings());
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(AuditTest::suite());
+    return runner.run() ? 0 : 1;
+}
@@ -0,0 +1,221 @@
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "aes256factory.hh"
+#include "breachcorpus.hh"
+#include "fileerror.hh"
+#include "passwordaudit.hh"
+#include "passwordrecord.hh"
+
+constexpr auto CORPUS{"breachcorpus.bin"};
+constexpr auto ROUNDS{5000};
+
+namespace {
+std::string hexDigest(const std::string& password) {
+    auto digest{yapet::audit::BreachCorpus::sha1(
+        reinterpret_cast<const std::uint8_t*>(password.c_str()),
+        password.size())};
+
+    char hex[3];
+    std::string result;
+    for (auto byte : digest) {
+        std::snprintf(hex, sizeof(hex), "%02X", byte);
+        result += hex;
+    }
+    return result;
+}
+
+std::string breachedPassword(int i) { return "breached " + std::to_string(i); }
+
+/**
+ * Create a HIBP style list of the breached passwords, sorted by digest.
+ */
+std::string hibpText() {
+    std::vector<std::string> digests;
+    for (int i = 0; i < ROUNDS; i++) {
+        digests.push_back(hexDigest(breachedPassword(i)));
+    }
+    // Digests at the very beginning and end of the prefix range
+    digests.push_back("0000000000000000000000000000000000000000");
+    digests.push_back("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF");
+    std::sort(digests.begin(), digests.end());
+
+    std::string text;
+    for (const auto& digest : digests) {
+        text += digest + ":42\r\n";
+    }
+    return text;
+}
+
+bool contains(const yapet::audit::BreachCorpus& corpus,
+              const std::string& password) {
+    return corpus.containsPassword(
+        reinterpret_cast<const std::uint8_t*>(password.c_str()),
+        password.size());
+}
+}  // namespace
+
+class BreachCorpusTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite* suite() {
+        CppUnit::TestSuite* suiteOfTests =
+            new CppUnit::TestSuite("Breach Corpus");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<BreachCorpusTest>(
+            "should find breached passwords", &BreachCorpusTest::lookup));
+        suiteOfTests->addTest(new CppUnit::TestCaller<BreachCorpusTest>(
+            "should find digests at range boundaries",
+            &BreachCorpusTest::boundaries));
+        suiteOfTests->addTest(new CppUnit::TestCaller<BreachCorpusTest>(
+            "should reuse stored index", &BreachCorpusTest::storedIndex));
+        suiteOfTests->addTest(new CppUnit::TestCaller<BreachCorpusTest>(
+            "should reject unsorted input", &BreachCorpusTest::unsorted));
+        suiteOfTests->addTest(new CppUnit::TestCaller<BreachCorpusTest>(
+            "should reject invalid corpus", &BreachCorpusTest::invalidCorpus));
+        suiteOfTests->addTest(new CppUnit::TestCaller<BreachCorpusTest>(
+            "should handle empty corpus", &BreachCorpusTest::emptyCorpus));
+        suiteOfTests->addTest(new CppUnit::TestCaller<BreachCorpusTest>(
+            "should report breached passwords in audit",
+            &BreachCorpusTest::audit));
+
+        return suiteOfTests;
+    }
+
+    void setUp() {
+        unlink(CORPUS);
+        unlink(yapet::audit::BreachCorpus::indexFilename(CORPUS).c_str());
+    }
+
+    void tearDown() { setUp(); }
+
+    void convert() {
+        std::istringstream text{hibpText()};
+        auto numberOfDigests{
+            yapet::audit::BreachCorpus::convert(text, CORPUS)};
+        CPPUNIT_ASSERT(numberOfDigests == ROUNDS + 2);
+    }
+
+    void lookup() {
+        convert();
+        yapet::audit::BreachCorpus corpus{CORPUS};
+
+        CPPUNIT_ASSERT(corpus.size() == ROUNDS + 2);
+        for (int i = 0; i < ROUNDS; i++) {
+            CPPUNIT_ASSERT(contains(corpus, breachedPassword(i)));
+            CPPUNIT_ASSERT(!contains(corpus, "safe " + std::to_string(i)));
+        }
+    }
+
+    void boundaries() {
+        convert();
+        yapet::audit::BreachCorpus corpus{CORPUS};
+
+        yapet::audit::BreachCorpus::Sha1Digest digest;
+        digest.fill(0);
+        CPPUNIT_ASSERT(corpus.contains(digest));
+        digest.fill(0xff);
+        CPPUNIT_ASSERT(corpus.contains(digest));
+        digest[19] = 0xfe;
+        CPPUNIT_ASSERT(!corpus.contains(digest));
+    }
+
+    void storedIndex() {
+        convert();
+        { yapet::audit::BreachCorpus corpus{CORPUS}; }
+
+        auto indexFile{yapet::audit::BreachCorpus::indexFilename(CORPUS)};
+        CPPUNIT_ASSERT(access(indexFile.c_str(), F_OK) == 0);
+
+        yapet::audit::BreachCorpus corpus{CORPUS};
+        for (int i = 0; i < ROUNDS; i++) {
+            CPPUNIT_ASSERT(contains(corpus, breachedPassword(i)));
+        }
+
+        // Converting a new corpus invalidates the index
+        convert();
+        CPPUNIT_ASSERT(access(indexFile.c_str(), F_OK) != 0);
+    }
+
+    void unsorted() {
+        std::istringstream text{
+            "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF:1\n"
+            "0000000000000000000000000000000000000000:1\n"};
+        CPPUNIT_ASSERT_THROW(yapet::audit::BreachCorpus::convert(text, CORPUS),
+                             yapet::FileFormatError);
+
+        std::istringstream invalid{"not a digest\n"};
+        CPPUNIT_ASSERT_THROW(
+            yapet::audit::BreachCorpus::convert(invalid, CORPUS),
+            yapet::FileFormatError);
+    }
+
+    void invalidCorpus() {
+        std::ofstream corpus{CORPUS};
+        corpus << "too short";
+        corpus.close();
+
+        CPPUNIT_ASSERT_THROW(yapet::audit::BreachCorpus{CORPUS},
+                             yapet::FileFormatError);
+        CPPUNIT_ASSERT_THROW(yapet::audit::BreachCorpus{"does-not-exist"},
+                             yapet::FileError);
+    }
+
+    void emptyCorpus() {
+        std::istringstream text{""};
+        CPPUNIT_ASSERT(yapet::audit::BreachCorpus::convert(text, CORPUS) == 0);
+
+        yapet::audit::BreachCorpus corpus{CORPUS};
+        CPPUNIT_ASSERT(!contains(corpus, breachedPassword(0)));
+    }
+
+    void audit() {
+        convert();
+
+        std::shared_ptr<yapet::AbstractCryptoFactory> cryptoFactory{
+            new yapet::Aes256Factory{
+                yapet::toSecureArray("Secret"),
+                yapet::Key256::newDefaultKeyingParameters()}};
+        auto crypto{cryptoFactory->crypto()};
+
+        std::vector<yapet::SecureArray> records;
+        for (int i = 0; i < 10; i++) {
+            yapet::PasswordRecord record;
+            record.name(std::to_string(i).c_str());
+            record.password(i % 2 == 0 ? breachedPassword(i).c_str()
+                                       : ("safe " + std::to_string(i)).c_str());
+            records.push_back(crypto->encrypt(record.serialize()));
+        }
+
+        yapet::audit::PasswordAudit audit{cryptoFactory};
+        audit.breachCorpus(
+            std::make_shared<yapet::audit::BreachCorpus>(CORPUS));
+        auto report{audit.audit(records)};
+
+        yapet::audit::RecordGroup expected{0, 2, 4, 6, 8};
+        CPPUNIT_ASSERT(report.breachedPasswords == expected);
+        CPPUNIT_ASSERT(report.hasFindings());
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(BreachCorpusTest::suite());
+    return runner.run() ? 0 : 1;
+}
@@ -226,6 +226,27 @@ void test_initvalues() {
     if (cfg.character_pools() != YAPET::Consts::DEFAULT_CHARACTER_POOLS)
         MYEXIT("character_pools() mismatch");
 
+    if (cfg.pwgen_passphrase) MYEXIT("pwgen_passphrase mismatch");
+
+    if (cfg.pwgen_pronounceable) MYEXIT("pwgen_pronounceable mismatch");
+
+    if (cfg.pwgen_words != YAPET::Consts::DEFAULT_PASSPHRASE_WORDS)
+        MYEXIT("pwgen_words mismatch");
+
+    if (cfg.pwgen_separator.get() !=
+        YAPET::Consts::DEFAULT_PASSPHRASE_SEPARATOR)
+        MYEXIT("pwgen_separator mismatch");
+
+    if (cfg.pwgen_capitalization.get() !=
+        YAPET::Consts::DEFAULT_PASSPHRASE_CAPITALIZATION)
+        MYEXIT("pwgen_capitalization mismatch");
+
+    if (!cfg.pwgen_wordlist.get().empty()) MYEXIT("pwgen_wordlist not empty");
+
+    if (!cfg.pwgen_rules.get().empty()) MYEXIT("pwgen_rules not empty");
+
+    if (!cfg.pwgen_profile.get().empty()) MYEXIT("pwgen_profile not empty");
+
     if (cfg.allow_lock_quit != YAPET::Consts::DEFAULT_ALLOW_LOCK_QUIT)
         MYEXIT("allow_lock_quit mismatch");
 
@@ -281,6 +302,14 @@ void test_index_operator() {
         if (dynamic_cast<CfgValInt&>(cfg["pwinputtimeout"]) !=
             YAPET::Consts::DEFAULT_PASSWORD_INPUT_TIMEOUT)
             MYEXIT("pw_input_timeout mismatch");
+
+        if (dynamic_cast<CfgValInt&>(cfg["recordcachesize"]) !=
+            YAPET::Consts::DEFAULT_RECORD_CACHE_SIZE)
+            MYEXIT("record_cache_size mismatch");
+
+        if (dynamic_cast<CfgValInt&>(cfg["recordcachettl"]) !=
+            YAPET::Consts::DEFAULT_RECORD_CACHE_TTL)
+            MYEXIT("record_cache_ttl mismatch");
     } catch (std::exception& e) {
         MYEXIT(e.what());
     }
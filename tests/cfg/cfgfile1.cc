@@ -87,6 +87,50 @@ int main(int, char**) {
             abort();
         }
 
+        if (!cfg.pwgen_passphrase) {
+            std::cerr << "pwgen_passphrase does not match (#1)" << std::endl;
+            abort();
+        }
+
+        if (!cfg.pwgen_pronounceable) {
+            std::cerr << "pwgen_pronounceable does not match (#1)"
+                      << std::endl;
+            abort();
+        }
+
+        if (cfg.pwgen_words != 9) {
+            std::cerr << "pwgen_words does not match (#1)" << std::endl;
+            abort();
+        }
+
+        if (cfg.pwgen_separator.get() != " + ") {
+            std::cerr << "pwgen_separator does not match (#1)" << std::endl;
+            abort();
+        }
+
+        if (cfg.pwgen_capitalization.get() != "random") {
+            std::cerr << "pwgen_capitalization does not match (#1)"
+                      << std::endl;
+            abort();
+        }
+
+        if (cfg.pwgen_wordlist.get() != "/tmp/words.txt") {
+            std::cerr << "pwgen_wordlist does not match (#1)" << std::endl;
+            abort();
+        }
+
+        std::map<std::string, std::string> rules{cfg.pwgen_rules.get()};
+        if (rules.size() != 2 || rules["bank"] != "length=6" ||
+            rules["pin"] != "digits=4 length=4") {
+            std::cerr << "pwgen_rules does not match (#1)" << std::endl;
+            abort();
+        }
+
+        if (cfg.pwgen_profile.get() != "bank") {
+            std::cerr << "pwgen_profile does not match (#1)" << std::endl;
+            abort();
+        }
+
         if (cfg.argon2_iterations != 84) {
             std::cerr << "argon2_iterations does not match (#1)" << std::endl;
             abort();
@@ -0,0 +1,219 @@
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "aes256factory.hh"
+#include "file.hh"
+#include "passwordrecord.hh"
+#include "recordbatch.hh"
+
+constexpr auto TEST_PASSWORD{"Secret"};
+constexpr auto COMMAND_FILE{"recordbatch-test.json"};
+constexpr auto TEST_FILE{"recordbatch-test.pet"};
+// Enough records to spread the encryption over several worker threads
+constexpr auto ROUNDS{2000};
+
+class RecordBatchTest : public CppUnit::TestFixture {
+   private:
+    std::shared_ptr<yapet::AbstractCryptoFactory> _cryptoFactory;
+    std::vector<yapet::SecureArray> _records;
+
+    yapet::SecureArray encryptedRecord(const std::string& name) {
+        yapet::PasswordRecord record;
+        record.name(name.c_str());
+        record.host("host");
+        record.username("user");
+        record.password("password");
+        record.comment("comment");
+
+        return _cryptoFactory->crypto()->encrypt(record.serialize());
+    }
+
+    yapet::PasswordRecord decrypt(const yapet::SecureArray& encrypted) {
+        return yapet::PasswordRecord{
+            _cryptoFactory->crypto()->decrypt(encrypted)};
+    }
+
+    static std::string name(const yapet::PasswordRecord& record) {
+        return reinterpret_cast<const char*>(record.name());
+    }
+
+    static void writeCommands(const std::string& commands) {
+        std::ofstream file{COMMAND_FILE, std::ios::binary | std::ios::trunc};
+        file << commands;
+    }
+
+    static bool failsOnLine(yapet::RecordBatch& batch, const char* line) {
+        try {
+            batch.apply(COMMAND_FILE);
+        } catch (std::runtime_error& ex) {
+            return std::strstr(ex.what(), line) != nullptr;
+        }
+        return false;
+    }
+
+   public:
+    static CppUnit::TestSuite* suite() {
+        CppUnit::TestSuite* suiteOfTests =
+            new CppUnit::TestSuite("Record Batch");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<RecordBatchTest>(
+            "should apply commands", &RecordBatchTest::commands));
+        suiteOfTests->addTest(new CppUnit::TestCaller<RecordBatchTest>(
+            "should only encrypt changed records",
+            &RecordBatchTest::unchanged));
+        suiteOfTests->addTest(new CppUnit::TestCaller<RecordBatchTest>(
+            "should reject invalid commands", &RecordBatchTest::invalid));
+        suiteOfTests->addTest(new CppUnit::TestCaller<RecordBatchTest>(
+            "should save records atomically",
+            &RecordBatchTest::saveAtomically));
+
+        return suiteOfTests;
+    }
+
+    void setUp() {
+        _cryptoFactory.reset(new yapet::Aes256Factory{
+            yapet::toSecureArray(TEST_PASSWORD),
+            yapet::Key256::newDefaultKeyingParameters()});
+
+        _records.clear();
+        for (int i = 0; i < ROUNDS; i++) {
+            _records.push_back(encryptedRecord("name " + std::to_string(i)));
+        }
+    }
+
+    void tearDown() {
+        _cryptoFactory.reset();
+        std::remove(COMMAND_FILE);
+        std::remove(TEST_FILE);
+    }
+
+    void commands() {
+        writeCommands(
+            "{\"command\": \"add\", \"name\": \"new\", \"password\": \"p\"}\n"
+            "{\"command\": \"update-field\", \"name\": \"name 7\",\n"
+            " \"field\": \"password\", \"value\": \"changed\"}\n"
+            "{\"command\": \"update-field\", \"name\": \"name 7\",\n"
+            " \"field\": \"tags\", \"value\": \"a,b\"}\n"
+            "{\"command\": \"delete\", \"name\": \"name 3\"}\n"
+            "{\"command\": \"rename\", \"name\": \"name 5\",\n"
+            " \"new-name\": \"renamed\"}\n"
+            "{\"command\": \"update-field\", \"name\": \"renamed\",\n"
+            " \"field\": \"host\", \"value\": \"example.com\"}\n");
+        yapet::RecordBatch batch{_cryptoFactory, _records};
+
+        CPPUNIT_ASSERT(!batch.modified());
+        CPPUNIT_ASSERT(batch.apply(COMMAND_FILE) == 6);
+        CPPUNIT_ASSERT(batch.modified());
+        CPPUNIT_ASSERT(batch.size() == ROUNDS);
+
+        auto records{batch.encryptedRecords()};
+        CPPUNIT_ASSERT(records.size() == ROUNDS);
+        CPPUNIT_ASSERT(name(decrypt(records[3])) == "name 4");
+        CPPUNIT_ASSERT(name(decrypt(records[4])) == "renamed");
+        CPPUNIT_ASSERT(std::strcmp(reinterpret_cast<const char*>(
+                                       decrypt(records[4]).host()),
+                                   "example.com") == 0);
+
+        auto changed{decrypt(records[6])};
+        CPPUNIT_ASSERT(name(changed) == "name 7");
+        CPPUNIT_ASSERT(std::strcmp(reinterpret_cast<const char*>(
+                                       changed.password()),
+                                   "changed") == 0);
+        CPPUNIT_ASSERT(
+            std::strcmp(reinterpret_cast<const char*>(changed.tags()),
+                        "a,b") == 0);
+
+        auto added{decrypt(records[ROUNDS - 1])};
+        CPPUNIT_ASSERT(name(added) == "new");
+        CPPUNIT_ASSERT(std::strcmp(reinterpret_cast<const char*>(
+                                       added.password()),
+                                   "p") == 0);
+        CPPUNIT_ASSERT(added.host()[0] == '\0');
+    }
+
+    void unchanged() {
+        yapet::RecordBatch batch{_cryptoFactory, _records};
+        batch.updateField("name 1", yapet::RecordField::COMMENT, "c");
+
+        auto records{batch.encryptedRecords()};
+        CPPUNIT_ASSERT(records.size() == ROUNDS);
+        CPPUNIT_ASSERT(records[0] == _records[0]);
+        CPPUNIT_ASSERT(records[1] != _records[1]);
+        CPPUNIT_ASSERT(records[ROUNDS - 1] == _records[ROUNDS - 1]);
+    }
+
+    void invalid() {
+        _records.push_back(encryptedRecord("name 1"));
+        yapet::RecordBatch batch{_cryptoFactory, _records};
+
+        writeCommands("{\"command\": \"delete\", \"name\": \"name 1\"}\n");
+        CPPUNIT_ASSERT(failsOnLine(batch, "Line 1:"));
+        writeCommands(
+            "{\"command\": \"delete\", \"name\": \"name 2\"}\n"
+            "{\"command\": \"delete\", \"name\": \"name 2\"}\n");
+        CPPUNIT_ASSERT(failsOnLine(batch, "Line 2:"));
+        writeCommands("{\"command\": \"purge\"}\n");
+        CPPUNIT_ASSERT(failsOnLine(batch, "Line 1:"));
+        writeCommands("\n{\"command\": \"delete\"}\n");
+        CPPUNIT_ASSERT(failsOnLine(batch, "Line 2:"));
+        writeCommands("{\"command\": \"add\", \"url\": \"x\"}\n");
+        CPPUNIT_ASSERT(failsOnLine(batch, "Line 1:"));
+        writeCommands("{\"command\": \"add\", \"name\": \"" +
+                      std::string(yapet::PasswordRecord::NAME_SIZE, 'x') +
+                      "\"}\n");
+        CPPUNIT_ASSERT(failsOnLine(batch, "Line 1:"));
+        writeCommands("[\"delete\", \"name 4\"]\n");
+        CPPUNIT_ASSERT(failsOnLine(batch, "Line 1:"));
+        writeCommands("{\"command\": \"delete\", \"name\": [\"name 4\"]}\n");
+        CPPUNIT_ASSERT(failsOnLine(batch, "Line 1:"));
+        CPPUNIT_ASSERT_THROW(
+            batch.updateField("name 4", yapet::RecordField::PASSWORD,
+                              std::string(1000, 'x')),
+            std::invalid_argument);
+
+        CPPUNIT_ASSERT(batch.size() == ROUNDS);
+    }
+
+    void saveAtomically() {
+        YAPET::File file{_cryptoFactory, TEST_FILE, true};
+        file.save(std::list<yapet::PasswordListItem>{});
+        auto masterPasswordSet{file.getMasterPWSet()};
+
+        yapet::RecordBatch batch{_cryptoFactory, file.readEncryptedRecords()};
+        batch.add({{yapet::RecordField::NAME, "only"}});
+        file.saveAtomically(batch.encryptedRecords());
+
+        CPPUNIT_ASSERT(::access("recordbatch-test.pet.tmp", F_OK) != 0);
+        CPPUNIT_ASSERT(file.getMasterPWSet() == masterPasswordSet);
+
+        YAPET::File reopened{_cryptoFactory, TEST_FILE};
+        auto records{reopened.readEncryptedRecords()};
+        CPPUNIT_ASSERT(records.size() == 1);
+        CPPUNIT_ASSERT(name(decrypt(records[0])) == "only");
+        CPPUNIT_ASSERT(reopened.getMasterPWSet() == masterPasswordSet);
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(RecordBatchTest::suite());
+    return runner.run() ? 0 : 1;
+}
@@ -0,0 +1,196 @@
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "csvline.hh"
+#include "csvreader.hh"
+
+namespace {
+constexpr auto TEST_FILE{"csvreader-test.csv"};
+
+void writeFile(const std::string& content) {
+    std::ofstream file{TEST_FILE, std::ios::binary | std::ios::trunc};
+    file << content;
+}
+
+std::vector<std::string> fields(const yapet::CSVReader& reader) {
+    std::vector<std::string> result;
+    for (yapet::CSVReader::size_type i = 0; i < reader.numberOfFields();
+         i++) {
+        result.emplace_back(reader.field(i), reader.fieldSize(i));
+    }
+    return result;
+}
+
+// The lines of tests/converters/csv/csvline.cc, which have to be split the
+// same way by CSVLine and CSVReader.
+const std::vector<std::string> LINES{
+    "a,b,c",         "\"a,\",b\"",        "a,b\",",
+    "a,\"b,\"\"\",", "\"\"\"\",a,",       "\",\"\"\",a,",
+    "\"\"\",\",a,",  "a,\"\"\"\",",       "a,\",\"\"\",",
+    "a,\"\"\",\",",  "a,b,\"\"\"\"",      "a,b,\",\"\"\"",
+    "a,,\"\"\",\"",  "a,\"b\",\"c\"",     "a\",b",
+    "a,\"b\"\",c\"", "a,\"\"",            "a,\"\",\",\"",
+    "a,\"\"\"\",\",\"", ",,",             "b\"\",\"\"\"\""};
+}  // namespace
+
+class CSVReaderTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite *suite() {
+        CppUnit::TestSuite *suiteOfTests = new CppUnit::TestSuite("CSV Reader");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<CSVReaderTest>(
+            "should split lines like CSVLine", &CSVReaderTest::likeCsvLine));
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<CSVReaderTest>(
+            "should read quoted new lines", &CSVReaderTest::quotedNewLines));
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<CSVReaderTest>(
+            "should read records across buffer boundaries",
+            &CSVReaderTest::smallBuffers));
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<CSVReaderTest>(
+            "should read last line without new line",
+            &CSVReaderTest::lastLineWithoutNewLine));
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<CSVReaderTest>(
+            "should report malformed records",
+            &CSVReaderTest::malformedRecords));
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<CSVReaderTest>(
+            "should use different separator", &CSVReaderTest::separator));
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<CSVReaderTest>(
+            "should throw on missing file", &CSVReaderTest::missingFile));
+
+        return suiteOfTests;
+    }
+
+    void likeCsvLine() {
+        std::string content;
+        for (const auto &line : LINES) content += line + "\n";
+        writeFile(content);
+
+        yapet::CSVReader reader{TEST_FILE};
+        for (const auto &line : LINES) {
+            CPPUNIT_ASSERT(reader.next());
+            CPPUNIT_ASSERT(reader.error().empty());
+            CPPUNIT_ASSERT_EQUAL(line.size(), reader.recordSize());
+
+            yapet::CSVLine csvLine{
+                static_cast<yapet::CSVLine::field_index_type>(
+                    reader.numberOfFields())};
+            csvLine.parseLine(line);
+            auto actual{fields(reader)};
+            for (yapet::CSVLine::field_index_type i = 0; i < actual.size();
+                 i++) {
+                CPPUNIT_ASSERT_EQUAL(csvLine[i], actual[i]);
+            }
+        }
+        CPPUNIT_ASSERT(!reader.next());
+    }
+
+    void quotedNewLines() {
+        writeFile("a,\"b\nc\",d\n\"e\n\n\",f,g\nh,i,j\n");
+
+        yapet::CSVReader reader{TEST_FILE};
+        CPPUNIT_ASSERT(reader.next());
+        CPPUNIT_ASSERT(fields(reader) ==
+                       (std::vector<std::string>{"a", "b\nc", "d"}));
+        CPPUNIT_ASSERT(reader.lineNumber() == 2);
+
+        CPPUNIT_ASSERT(reader.next());
+        CPPUNIT_ASSERT(fields(reader) ==
+                       (std::vector<std::string>{"e\n\n", "f", "g"}));
+        CPPUNIT_ASSERT(reader.lineNumber() == 5);
+
+        CPPUNIT_ASSERT(reader.next());
+        CPPUNIT_ASSERT(fields(reader) ==
+                       (std::vector<std::string>{"h", "i", "j"}));
+        CPPUNIT_ASSERT(reader.lineNumber() == 6);
+
+        CPPUNIT_ASSERT(!reader.next());
+    }
+
+    void smallBuffers() {
+        std::string content;
+        for (const auto &line : LINES) content += line + "\n";
+        content += "\"x\n\"\"y\"\"\",z\n";
+
+        std::vector<std::vector<std::string>> expected;
+        {
+            writeFile(content);
+            yapet::CSVReader reader{TEST_FILE};
+            while (reader.next()) expected.push_back(fields(reader));
+        }
+
+        for (yapet::CSVReader::size_type bufferSize = 1; bufferSize < 16;
+             bufferSize++) {
+            yapet::CSVReader reader{TEST_FILE, ',', bufferSize};
+            for (const auto &record : expected) {
+                CPPUNIT_ASSERT(reader.next());
+                CPPUNIT_ASSERT(fields(reader) == record);
+            }
+            CPPUNIT_ASSERT(!reader.next());
+        }
+        CPPUNIT_ASSERT(expected.back() ==
+                       (std::vector<std::string>{"x\n\"y\"", "z"}));
+    }
+
+    void lastLineWithoutNewLine() {
+        writeFile("a,b\nc,\"d\"");
+
+        yapet::CSVReader reader{TEST_FILE};
+        CPPUNIT_ASSERT(reader.next());
+        CPPUNIT_ASSERT(reader.next());
+        CPPUNIT_ASSERT(fields(reader) ==
+                       (std::vector<std::string>{"c", "d"}));
+        CPPUNIT_ASSERT(reader.lineNumber() == 2);
+        CPPUNIT_ASSERT(!reader.next());
+    }
+
+    void malformedRecords() {
+        writeFile("\"a\"b\",c\nd,e\n\"f,g\nh,i\n");
+
+        yapet::CSVReader reader{TEST_FILE};
+        CPPUNIT_ASSERT(reader.next());
+        CPPUNIT_ASSERT(!reader.error().empty());
+        CPPUNIT_ASSERT(reader.lineNumber() == 1);
+
+        CPPUNIT_ASSERT(reader.next());
+        CPPUNIT_ASSERT(reader.error().empty());
+        CPPUNIT_ASSERT(fields(reader) ==
+                       (std::vector<std::string>{"d", "e"}));
+
+        // The unterminated field swallows the remainder of the file
+        CPPUNIT_ASSERT(reader.next());
+        CPPUNIT_ASSERT(!reader.error().empty());
+        CPPUNIT_ASSERT(!reader.next());
+    }
+
+    void separator() {
+        writeFile("\"a;\";b\"\";\"c;\"\"\";\"d\"\n");
+
+        yapet::CSVReader reader{TEST_FILE, ';'};
+        CPPUNIT_ASSERT(reader.next());
+        CPPUNIT_ASSERT(fields(reader) ==
+                       (std::vector<std::string>{"a;", "b\"\"", "c;\"", "d"}));
+    }
+
+    void missingFile() {
+        CPPUNIT_ASSERT_THROW(yapet::CSVReader{"does-not-exist.csv"},
+                             std::runtime_error);
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(CSVReaderTest::suite());
+    return runner.run() ? 0 : 1;
+}
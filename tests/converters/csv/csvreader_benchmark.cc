@@ -0,0 +1,85 @@
+// Measures the throughput of CSVReader, compared to reading lines with
+// std::getline() and splitting them with CSVLine.
+//
+// Usage: csvreader_benchmark [records]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "csvline.hh"
+#include "csvreader.hh"
+
+namespace {
+constexpr auto BENCHMARK_FILE{"csvreader-benchmark.csv"};
+constexpr auto DEFAULT_RECORDS{500000};
+constexpr auto NUMBER_OF_FIELDS{5};
+
+std::size_t writeBenchmarkFile(int records) {
+    std::ofstream file{BENCHMARK_FILE, std::ios::binary | std::ios::trunc};
+    for (int i = 0; i < records; i++) {
+        file << "Name " << i << ",host" << i << ".example.com,user" << i
+             << ",\"p@ss,\"\"word\"\"" << i
+             << "\",Some comment about record " << i << '\n';
+    }
+    return static_cast<std::size_t>(file.tellp());
+}
+
+template <class F>
+double seconds(F f) {
+    auto start{std::chrono::steady_clock::now()};
+    f();
+    std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() -
+                                          start};
+    return elapsed.count();
+}
+
+void report(const char* name, std::size_t bytes, int records, double s,
+            std::size_t checksum) {
+    std::cout << name << ": " << s << " s, " << bytes / s / (1024 * 1024)
+              << " MiB/s, " << records / s << " records/s (checksum "
+              << checksum << ")" << std::endl;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    int records{argc > 1 ? std::atoi(argv[1]) : DEFAULT_RECORDS};
+    if (records <= 0) {
+        std::cerr << "Usage: " << argv[0] << " [records]" << std::endl;
+        return 1;
+    }
+
+    auto bytes{writeBenchmarkFile(records)};
+    std::cout << records << " records, " << bytes << " bytes" << std::endl;
+
+    std::size_t checksum{0};
+    auto csvLineSeconds{seconds([&checksum]() {
+        std::ifstream file{BENCHMARK_FILE};
+        yapet::CSVLine csvLine{NUMBER_OF_FIELDS};
+        for (std::string line; std::getline(file, line);) {
+            csvLine.parseLine(line);
+            for (int i = 0; i < NUMBER_OF_FIELDS; i++) {
+                checksum += csvLine[i].size();
+            }
+        }
+    })};
+    report("getline and CSVLine", bytes, records, csvLineSeconds, checksum);
+
+    checksum = 0;
+    auto csvReaderSeconds{seconds([&checksum]() {
+        yapet::CSVReader reader{BENCHMARK_FILE};
+        while (reader.next()) {
+            for (yapet::CSVReader::size_type i = 0;
+                 i < reader.numberOfFields(); i++) {
+                checksum += reader.fieldSize(i);
+            }
+        }
+    })};
+    report("CSVReader", bytes, records, csvReaderSeconds, checksum);
+
+    std::remove(BENCHMARK_FILE);
+    return 0;
+}
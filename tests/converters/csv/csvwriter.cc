@@ -0,0 +1,136 @@
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "csvline.hh"
+#include "csvreader.hh"
+#include "csvwriter.hh"
+
+namespace {
+constexpr auto TEST_FILE{"csvwriter-test.csv"};
+
+std::string readFile() {
+    std::ifstream file{TEST_FILE, std::ios::binary};
+    return std::string{std::istreambuf_iterator<char>{file},
+                       std::istreambuf_iterator<char>{}};
+}
+
+const std::vector<std::string> FIELDS{
+    "a",  "a,b", "a\"b", "\"a,b\"", "a\nb", "a,\"b\"", "\"", "", "\"a",
+    "a\"", " ",  ",",    "\"\"",    "a;b"};
+}  // namespace
+
+class CSVWriterTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite *suite() {
+        CppUnit::TestSuite *suiteOfTests = new CppUnit::TestSuite("CSV Writer");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<CSVWriterTest>(
+            "should escape fields like CSVLine",
+            &CSVWriterTest::likeCsvLine));
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<CSVWriterTest>(
+            "should be read back by CSVReader", &CSVWriterTest::roundTrip));
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<CSVWriterTest>(
+            "should grow and clear buffer", &CSVWriterTest::growAndClear));
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<CSVWriterTest>(
+            "should throw on unwritable file",
+            &CSVWriterTest::unwritableFile));
+
+        return suiteOfTests;
+    }
+
+    void likeCsvLine() {
+        for (char separator : {',', ';'}) {
+            for (const auto &first : FIELDS) {
+                for (const auto &second : FIELDS) {
+                    yapet::CSVLine csvLine{2, separator};
+                    csvLine.addField(0, first);
+                    csvLine.addField(1, second);
+
+                    yapet::CSVBuffer csvBuffer{separator};
+                    csvBuffer.addField(first.c_str(), first.size());
+                    csvBuffer.addField(second.c_str(), second.size());
+                    csvBuffer.endRecord();
+
+                    CPPUNIT_ASSERT(
+                        std::string(csvBuffer.data(), csvBuffer.size()) ==
+                        csvLine.getLine() + "\n");
+                }
+            }
+        }
+    }
+
+    void roundTrip() {
+        const std::vector<std::string> fields{"a",    "a,b",   "a\"b",
+                                              "a\nb", "a,\"b", ""};
+        {
+            yapet::CSVWriter csvWriter{TEST_FILE};
+            yapet::CSVBuffer csvBuffer;
+            for (const auto &field : fields) {
+                csvBuffer.addField(field.c_str());
+            }
+            csvBuffer.endRecord();
+            csvWriter.write(csvBuffer);
+            csvWriter.close();
+        }
+
+        yapet::CSVReader reader{TEST_FILE};
+        CPPUNIT_ASSERT(reader.next());
+        CPPUNIT_ASSERT(reader.error().empty());
+        CPPUNIT_ASSERT(reader.numberOfFields() == fields.size());
+        for (yapet::CSVReader::size_type i = 0; i < fields.size(); i++) {
+            CPPUNIT_ASSERT(std::string(reader.field(i), reader.fieldSize(i)) ==
+                           fields[i]);
+        }
+        CPPUNIT_ASSERT(!reader.next());
+    }
+
+    void growAndClear() {
+        constexpr auto RECORDS{100000};
+        std::string expected;
+        {
+            yapet::CSVWriter csvWriter{TEST_FILE};
+            yapet::CSVBuffer csvBuffer;
+            for (int i = 0; i < RECORDS; i++) {
+                auto field{std::to_string(i)};
+                csvBuffer.addField(field.c_str());
+                csvBuffer.addField("x");
+                csvBuffer.endRecord();
+                expected += field + ",x\n";
+
+                // Write some blocks in between, to test reusing the buffer
+                if (i % 30000 == 0) {
+                    csvWriter.write(csvBuffer);
+                    csvBuffer.clear();
+                    CPPUNIT_ASSERT(csvBuffer.empty());
+                }
+            }
+            csvWriter.write(csvBuffer);
+            csvWriter.close();
+        }
+
+        CPPUNIT_ASSERT(readFile() == expected);
+    }
+
+    void unwritableFile() {
+        CPPUNIT_ASSERT_THROW(yapet::CSVWriter{"/nonexisting/file.csv"},
+                             std::runtime_error);
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(CSVWriterTest::suite());
+    return runner.run() ? 0 : 1;
+}
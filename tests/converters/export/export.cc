@@ -0,0 +1,136 @@
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "csvexport.h"
+#include "csvimport.h"
+
+namespace {
+constexpr auto CSV_FILE{"export-source.csv"};
+constexpr auto PET_FILE{"export.pet"};
+constexpr auto OUTPUT_FILE{"export-output.txt"};
+constexpr auto PASSWORD{"export"};
+// More than one block of records per worker
+constexpr int NUMBER_OF_RECORDS{3000};
+
+std::string readFile(const char* fileName) {
+    std::ifstream file{fileName, std::ios::binary};
+    std::ostringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+// A record whose fields need escaping, in CSV and as exported
+constexpr auto SPECIAL_RECORD{
+    "\"with \"\"quotes\"\"\",host,user,\"a\\b\x01\",\"line 1\nline 2\"\n"};
+constexpr auto EXPORTED_SPECIAL_RECORD{
+    "with \"quotes\",host,user,a\\b\x01,\"line 1\nline 2\"\n"};
+
+std::string regularRecords() {
+    std::string records;
+    for (int i = 0; i < NUMBER_OF_RECORDS; i++) {
+        records += "name " + std::to_string(i) + ",host" +
+                   std::to_string(i % 10) + ".example.com,user,pass" +
+                   std::to_string(i) + ",\n";
+    }
+    return records;
+}
+
+void createFile() {
+    std::remove(PET_FILE);
+    std::ofstream file{CSV_FILE, std::ios::binary | std::ios::trunc};
+    file << regularRecords() << SPECIAL_RECORD;
+    file.close();
+
+    CSVImport imp(CSV_FILE, PET_FILE, ',', false);
+    imp.import(PASSWORD);
+}
+}  // namespace
+
+class ExportTest : public CppUnit::TestFixture {
+   public:
+    void setUp() { std::remove(OUTPUT_FILE); }
+
+    static CppUnit::TestSuite* suite() {
+        CppUnit::TestSuite* suiteOfTests =
+            new CppUnit::TestSuite("Export Tests");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<ExportTest>(
+            "should export all records", &ExportTest::all));
+        suiteOfTests->addTest(new CppUnit::TestCaller<ExportTest>(
+            "should export matching records and fields",
+            &ExportTest::filtered));
+        suiteOfTests->addTest(new CppUnit::TestCaller<ExportTest>(
+            "should write JSON Lines", &ExportTest::jsonLines));
+
+        return suiteOfTests;
+    }
+
+    void all() {
+        createFile();
+
+        CSVExport exp(PET_FILE, OUTPUT_FILE, ',', false);
+        exp.doexport(PASSWORD);
+
+        CPPUNIT_ASSERT(exp.numExported() == NUMBER_OF_RECORDS + 1);
+        CPPUNIT_ASSERT(readFile(OUTPUT_FILE) ==
+                       regularRecords() + EXPORTED_SPECIAL_RECORD);
+    }
+
+    void filtered() {
+        createFile();
+
+        yapet::RecordFilter filter;
+        filter.add("host=~^host7\\.");
+        filter.add("password~1");
+
+        CSVExport exp(PET_FILE, OUTPUT_FILE, ',', false, true);
+        exp.filter(filter);
+        exp.fields({yapet::RecordField::PASSWORD, yapet::RecordField::NAME});
+        exp.doexport(PASSWORD);
+
+        std::string expected{"password,name\n"};
+        unsigned int numberOfMatches{0};
+        for (int i = 7; i < NUMBER_OF_RECORDS; i += 10) {
+            auto number{std::to_string(i)};
+            if (number.find('1') == std::string::npos) continue;
+
+            expected += "pass" + number + ",name " + number + "\n";
+            numberOfMatches++;
+        }
+
+        CPPUNIT_ASSERT(exp.numExported() == numberOfMatches);
+        CPPUNIT_ASSERT(readFile(OUTPUT_FILE) == expected);
+    }
+
+    void jsonLines() {
+        createFile();
+
+        yapet::RecordFilter filter;
+        filter.add("host=host");
+
+        CSVExport exp(PET_FILE, OUTPUT_FILE, ',', false);
+        exp.filter(filter);
+        exp.jsonLines(true);
+        exp.doexport(PASSWORD);
+
+        CPPUNIT_ASSERT(exp.numExported() == 1);
+        CPPUNIT_ASSERT(readFile(OUTPUT_FILE) ==
+                       "{\"name\":\"with \\\"quotes\\\"\",\"host\":\"host\","
+                       "\"username\":\"user\",\"password\":\"a\\\\b\\u0001\","
+                       "\"comment\":\"line 1\\nline 2\"}\n");
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(ExportTest::suite());
+    return runner.run() ? 0 : 1;
+}
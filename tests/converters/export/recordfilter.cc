@@ -0,0 +1,127 @@
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <stdexcept>
+#include <string>
+
+#include "recordfilter.hh"
+
+namespace {
+yapet::PasswordRecord record() {
+    yapet::PasswordRecord passwordRecord;
+    passwordRecord.name("Mail account");
+    passwordRecord.host("imap.example.com");
+    passwordRecord.username("alice");
+    passwordRecord.password("secret");
+    passwordRecord.comment("");
+    passwordRecord.tags("work, mail");
+    return passwordRecord;
+}
+
+bool matches(const std::string& expression) {
+    yapet::RecordFilter filter;
+    filter.add(expression);
+    return filter.matches(record());
+}
+}  // namespace
+
+class RecordFilterTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite* suite() {
+        CppUnit::TestSuite* suiteOfTests =
+            new CppUnit::TestSuite("Record Filter");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<RecordFilterTest>(
+            "should compare fields", &RecordFilterTest::equals));
+        suiteOfTests->addTest(new CppUnit::TestCaller<RecordFilterTest>(
+            "should find substrings", &RecordFilterTest::contains));
+        suiteOfTests->addTest(new CppUnit::TestCaller<RecordFilterTest>(
+            "should match regular expressions", &RecordFilterTest::regex));
+        suiteOfTests->addTest(new CppUnit::TestCaller<RecordFilterTest>(
+            "should find tags", &RecordFilterTest::tags));
+        suiteOfTests->addTest(new CppUnit::TestCaller<RecordFilterTest>(
+            "should require all conditions", &RecordFilterTest::all));
+        suiteOfTests->addTest(new CppUnit::TestCaller<RecordFilterTest>(
+            "should reject invalid expressions", &RecordFilterTest::invalid));
+        suiteOfTests->addTest(new CppUnit::TestCaller<RecordFilterTest>(
+            "should parse field lists", &RecordFilterTest::fieldLists));
+
+        return suiteOfTests;
+    }
+
+    void equals() {
+        CPPUNIT_ASSERT(matches("name=Mail account"));
+        CPPUNIT_ASSERT(!matches("name=Mail"));
+        CPPUNIT_ASSERT(!matches("name=mail account"));
+        CPPUNIT_ASSERT(matches("comment="));
+        CPPUNIT_ASSERT(!matches("password="));
+    }
+
+    void contains() {
+        CPPUNIT_ASSERT(matches("host~example"));
+        CPPUNIT_ASSERT(matches("host~imap.example.com"));
+        CPPUNIT_ASSERT(!matches("host~example.org"));
+        CPPUNIT_ASSERT(matches("comment~"));
+    }
+
+    void regex() {
+        CPPUNIT_ASSERT(matches("host=~^imap\\."));
+        CPPUNIT_ASSERT(matches("username=~^(alice|bob)$"));
+        CPPUNIT_ASSERT(!matches("username=~^bob$"));
+        CPPUNIT_ASSERT(matches("tags=~work"));
+    }
+
+    void tags() {
+        CPPUNIT_ASSERT(matches("tag=work"));
+        CPPUNIT_ASSERT(matches("tag=mail"));
+        CPPUNIT_ASSERT(!matches("tag=wor"));
+        CPPUNIT_ASSERT(!matches("tag=private"));
+    }
+
+    void all() {
+        yapet::RecordFilter filter;
+        CPPUNIT_ASSERT(filter.empty());
+        CPPUNIT_ASSERT(filter.matches(record()));
+
+        filter.add("tag=work");
+        filter.add("host~example");
+        CPPUNIT_ASSERT(filter.matches(record()));
+
+        filter.add("username=bob");
+        CPPUNIT_ASSERT(!filter.matches(record()));
+    }
+
+    void invalid() {
+        yapet::RecordFilter filter;
+        CPPUNIT_ASSERT_THROW(filter.add("name"), std::invalid_argument);
+        CPPUNIT_ASSERT_THROW(filter.add("=value"), std::invalid_argument);
+        CPPUNIT_ASSERT_THROW(filter.add("url=x"), std::invalid_argument);
+        CPPUNIT_ASSERT_THROW(filter.add("tag~x"), std::invalid_argument);
+        CPPUNIT_ASSERT_THROW(filter.add("name=~("), std::invalid_argument);
+        CPPUNIT_ASSERT(filter.empty());
+    }
+
+    void fieldLists() {
+        auto fields{yapet::parseRecordFields("password,name,tags")};
+        CPPUNIT_ASSERT(fields.size() == 3);
+        CPPUNIT_ASSERT(fields[0] == yapet::RecordField::PASSWORD);
+        CPPUNIT_ASSERT(fields[1] == yapet::RecordField::NAME);
+        CPPUNIT_ASSERT(fields[2] == yapet::RecordField::TAGS);
+
+        CPPUNIT_ASSERT_THROW(yapet::parseRecordFields(""),
+                             std::invalid_argument);
+        CPPUNIT_ASSERT_THROW(yapet::parseRecordFields("name,"),
+                             std::invalid_argument);
+        CPPUNIT_ASSERT_THROW(yapet::parseRecordFields("name,url"),
+                             std::invalid_argument);
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(RecordFilterTest::suite());
+    return runner.run() ? 0 : 1;
+}
@@ -0,0 +1,192 @@
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "aes256factory.hh"
+#include "csvimport.h"
+#include "file.hh"
+#include "filehelper.hh"
+
+namespace {
+constexpr auto BASE_CSV{"append-base.csv"};
+constexpr auto UPDATE_CSV{"append-update.csv"};
+constexpr auto PET_FILE{"append.pet"};
+constexpr auto PASSWORD{"append"};
+
+void writeFile(const char* fileName, const std::string& content) {
+    std::ofstream file{fileName, std::ios::binary | std::ios::trunc};
+    file << content;
+}
+
+struct Record {
+    std::string name;
+    std::string host;
+    std::string username;
+    std::string password;
+};
+
+std::vector<Record> readRecords() {
+    auto password{yapet::toSecureArray(PASSWORD)};
+    std::shared_ptr<yapet::AbstractCryptoFactory> cryptoFactory{
+        new yapet::Aes256Factory{password,
+                                 yapet::readMetaData(PET_FILE, false)}};
+    auto crypto{cryptoFactory->crypto()};
+
+    YAPET::File file{cryptoFactory, PET_FILE, false};
+    std::vector<Record> result;
+    for (const auto& item : file.read()) {
+        yapet::PasswordRecord passwordRecord{
+            crypto->decrypt(item.encryptedRecord())};
+        result.push_back(Record{
+            reinterpret_cast<const char*>(passwordRecord.name()),
+            reinterpret_cast<const char*>(passwordRecord.host()),
+            reinterpret_cast<const char*>(passwordRecord.username()),
+            reinterpret_cast<const char*>(passwordRecord.password())});
+    }
+    return result;
+}
+
+// Creates a file holding two records
+void createBase() {
+    std::remove(PET_FILE);
+    writeFile(BASE_CSV,
+              "mail,mail.example.com,alice,old1,\n"
+              "bank,bank.example.com,bob,old2,\n");
+    CSVImport imp(BASE_CSV, PET_FILE, ',', false);
+    imp.import(PASSWORD);
+}
+
+// One updated record, one new record, a duplicate within the csv file and
+// an erroneous line
+const std::string UPDATE{
+    "mail,mail.example.com,alice,new1,\n"
+    "shop,shop.example.com,carol,new3,\n"
+    "shop,shop.example.com,carol,new4,\n"
+    "erroneous line\n"};
+}  // namespace
+
+class AppendTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite* suite() {
+        CppUnit::TestSuite* suiteOfTests =
+            new CppUnit::TestSuite("Append Tests");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<AppendTest>(
+            "should insert duplicates", &AppendTest::insert));
+        suiteOfTests->addTest(new CppUnit::TestCaller<AppendTest>(
+            "should replace duplicates", &AppendTest::replace));
+        suiteOfTests->addTest(new CppUnit::TestCaller<AppendTest>(
+            "should skip duplicates", &AppendTest::skip));
+        suiteOfTests->addTest(new CppUnit::TestCaller<AppendTest>(
+            "should match host and username",
+            &AppendTest::matchHostUsername));
+        suiteOfTests->addTest(new CppUnit::TestCaller<AppendTest>(
+            "should reject wrong password", &AppendTest::wrongPassword));
+
+        return suiteOfTests;
+    }
+
+    void insert() {
+        createBase();
+        writeFile(UPDATE_CSV, UPDATE);
+
+        CSVImport imp(UPDATE_CSV, PET_FILE, ',', false);
+        imp.append(PASSWORD);
+
+        CPPUNIT_ASSERT(imp.numInserted() == 3);
+        CPPUNIT_ASSERT(imp.numReplaced() == 0);
+        CPPUNIT_ASSERT(imp.numSkipped() == 0);
+        CPPUNIT_ASSERT(imp.numErrors() == 1);
+        CPPUNIT_ASSERT(imp.getLog().front().lineNumber == 4);
+
+        auto records{readRecords()};
+        CPPUNIT_ASSERT(records.size() == 5);
+        CPPUNIT_ASSERT(records[0].password == "old1");
+        CPPUNIT_ASSERT(records[1].password == "old2");
+        CPPUNIT_ASSERT(records[2].password == "new1");
+        CPPUNIT_ASSERT(records[3].password == "new3");
+        CPPUNIT_ASSERT(records[4].password == "new4");
+    }
+
+    void replace() {
+        createBase();
+        writeFile(UPDATE_CSV, UPDATE);
+
+        CSVImport imp(UPDATE_CSV, PET_FILE, ',', false);
+        imp.append(PASSWORD, CSVImport::DuplicatePolicy::REPLACE);
+
+        CPPUNIT_ASSERT(imp.numInserted() == 1);
+        CPPUNIT_ASSERT(imp.numReplaced() == 2);
+        CPPUNIT_ASSERT(imp.numSkipped() == 0);
+
+        auto records{readRecords()};
+        CPPUNIT_ASSERT(records.size() == 3);
+        CPPUNIT_ASSERT(records[0].name == "mail");
+        CPPUNIT_ASSERT(records[0].password == "new1");
+        CPPUNIT_ASSERT(records[1].password == "old2");
+        CPPUNIT_ASSERT(records[2].name == "shop");
+        CPPUNIT_ASSERT(records[2].password == "new4");
+    }
+
+    void skip() {
+        createBase();
+        writeFile(UPDATE_CSV, UPDATE);
+
+        CSVImport imp(UPDATE_CSV, PET_FILE, ',', false);
+        imp.append(PASSWORD, CSVImport::DuplicatePolicy::SKIP);
+
+        CPPUNIT_ASSERT(imp.numInserted() == 1);
+        CPPUNIT_ASSERT(imp.numReplaced() == 0);
+        CPPUNIT_ASSERT(imp.numSkipped() == 2);
+
+        auto records{readRecords()};
+        CPPUNIT_ASSERT(records.size() == 3);
+        CPPUNIT_ASSERT(records[0].password == "old1");
+        CPPUNIT_ASSERT(records[1].password == "old2");
+        CPPUNIT_ASSERT(records[2].password == "new3");
+    }
+
+    void matchHostUsername() {
+        createBase();
+        writeFile(UPDATE_CSV,
+                  "renamed,bank.example.com,bob,new2,\n"
+                  "bank,bank.example.com,mallory,new5,\n");
+
+        CSVImport imp(UPDATE_CSV, PET_FILE, ',', false);
+        imp.append(PASSWORD, CSVImport::DuplicatePolicy::REPLACE,
+                   CSVImport::MatchKey::HOST_USERNAME);
+
+        CPPUNIT_ASSERT(imp.numInserted() == 1);
+        CPPUNIT_ASSERT(imp.numReplaced() == 1);
+
+        auto records{readRecords()};
+        CPPUNIT_ASSERT(records.size() == 3);
+        CPPUNIT_ASSERT(records[1].name == "renamed");
+        CPPUNIT_ASSERT(records[1].password == "new2");
+        CPPUNIT_ASSERT(records[2].username == "mallory");
+    }
+
+    void wrongPassword() {
+        createBase();
+        writeFile(UPDATE_CSV, UPDATE);
+
+        CSVImport imp(UPDATE_CSV, PET_FILE, ',', false);
+        CPPUNIT_ASSERT_THROW(imp.append("wrong"), std::exception);
+
+        CPPUNIT_ASSERT(readRecords().size() == 2);
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(AppendTest::suite());
+    return runner.run() ? 0 : 1;
+}
@@ -4,6 +4,8 @@
 #include <cppunit/extensions/TestFactoryRegistry.h>
 #include <cppunit/ui/text/TestRunner.h>
 
+#include <fstream>
+
 #include "aes256factory.hh"
 #include "csvimport.h"
 #include "file.hh"
@@ -11,6 +13,10 @@
 #include "testpaths.h"
 
 constexpr auto ROUNDS{10};
+// Enough records to keep several encryption workers busy
+constexpr auto MANY_ROUNDS{20000};
+// Every ERROR_INTERVAL-th line of the generated csv file is invalid
+constexpr auto ERROR_INTERVAL{997};
 
 constexpr char NAME_FORMAT[]{"Test name %d"};
 constexpr char HOST_FORMAT[]{"Test host %d"};
@@ -56,6 +62,10 @@ class ImportTest : public CppUnit::TestFixture {
             "should handle double quotes properly",
             &ImportTest::handleDoubleQuotesProperly));
 
+        suiteOfTests->addTest(new CppUnit::TestCaller<ImportTest>(
+            "should preserve order of many records",
+            &ImportTest::preserveOrderOfManyRecords));
+
         return suiteOfTests;
     }
 
@@ -242,6 +252,53 @@ class ImportTest : public CppUnit::TestFixture {
         CPPUNIT_ASSERT(imp.numErrors() == 0);
     }
 
+    void preserveOrderOfManyRecords() {
+        {
+            std::ofstream csv{"importmany.csv"};
+            for (int i = 0; i < MANY_ROUNDS; i++) {
+                if (i % ERROR_INTERVAL == ERROR_INTERVAL - 1) {
+                    csv << "invalid line " << i << "\n";
+                    continue;
+                }
+                csv << "Test name " << i << ",Test host " << i
+                    << ",Test username " << i << ",Test password " << i
+                    << ",Test comment " << i << "\n";
+            }
+        }
+
+        CSVImport imp("importmany.csv", "importmany.pet", ',', false);
+        imp.import("importmany");
+
+        constexpr auto EXPECTED_ERRORS{MANY_ROUNDS / ERROR_INTERVAL};
+        CPPUNIT_ASSERT(imp.numErrors() == EXPECTED_ERRORS);
+
+        auto logs{imp.getLog()};
+        CPPUNIT_ASSERT(logs.size() == EXPECTED_ERRORS);
+        CSVImport::line_number_type expectedLine{ERROR_INTERVAL};
+        for (const auto& entry : logs) {
+            CPPUNIT_ASSERT(entry.lineNumber == expectedLine);
+            expectedLine += ERROR_INTERVAL;
+        }
+
+        auto password{yapet::toSecureArray("importmany")};
+        std::shared_ptr<yapet::AbstractCryptoFactory> cryptoFactory{
+            new yapet::Aes256Factory{
+                password, yapet::readMetaData("importmany.pet", false)}};
+
+        std::shared_ptr<YAPET::File> file{
+            new YAPET::File{cryptoFactory, "importmany.pet", false}};
+        std::list<yapet::PasswordListItem> list = file->read();
+        CPPUNIT_ASSERT(list.size() == MANY_ROUNDS - EXPECTED_ERRORS);
+
+        auto it = list.begin();
+        for (int i = 0; i < MANY_ROUNDS; i++) {
+            if (i % ERROR_INTERVAL == ERROR_INTERVAL - 1) continue;
+
+            checkRecord(*it, cryptoFactory, i);
+            it++;
+        }
+    }
+
     void checkRecord(
         const yapet::PasswordListItem& passwordListItem,
         std::shared_ptr<yapet::AbstractCryptoFactory> cryptoFactory,
@@ -0,0 +1,126 @@
+// Measures the time and the memory needed to import KeePass XML and
+// Bitwarden JSON exports. The peak memory usage does not depend on the
+// number of records, since the exports are parsed as streams.
+//
+// Usage: import_benchmark [records]
+
+#include <sys/resource.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "jsonimport.h"
+#include "keepassimport.h"
+
+namespace {
+constexpr auto XML_FILE{"import-benchmark.xml"};
+constexpr auto JSON_FILE{"import-benchmark.json"};
+constexpr auto PET_FILE{"import-benchmark.pet"};
+constexpr auto PASSWORD{"benchmark"};
+constexpr auto DEFAULT_RECORDS{100000};
+
+std::size_t writeXmlFile(int records) {
+    std::ofstream file{XML_FILE, std::ios::binary | std::ios::trunc};
+    file << "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+            "<KeePassFile><Root><Group><Name>Root</Name>\n";
+    for (int i = 0; i < records; i++) {
+        file << "<Entry><UUID>AAAAAAAAAAAAAAAAAAAAAA==</UUID>"
+                "<Tags>tag"
+             << i % 10
+             << "</Tags>\n"
+                "<String><Key>Title</Key><Value>Name "
+             << i
+             << "</Value></String>\n"
+                "<String><Key>URL</Key><Value>https://host"
+             << i
+             << ".example.com/?a=1&amp;b=2</Value></String>\n"
+                "<String><Key>UserName</Key><Value>user"
+             << i
+             << "</Value></String>\n"
+                "<String><Key>Password</Key><Value ProtectInMemory=\"True\">"
+                "p@ss&lt;word&gt;"
+             << i
+             << "</Value></String>\n"
+                "<String><Key>Notes</Key><Value>Some comment about record "
+             << i << "</Value></String>\n</Entry>\n";
+    }
+    file << "</Group></Root></KeePassFile>\n";
+    return static_cast<std::size_t>(file.tellp());
+}
+
+std::size_t writeJsonFile(int records) {
+    std::ofstream file{JSON_FILE, std::ios::binary | std::ios::trunc};
+    file << "{\"encrypted\": false, \"folders\": [{\"id\": \"f\", \"name\": "
+            "\"folder\"}],\n\"items\": [\n";
+    for (int i = 0; i < records; i++) {
+        file << (i > 0 ? ",\n" : "")
+             << "{\"id\": \"id\", \"folderId\": \"f\", \"type\": 1, "
+                "\"name\": \"Name "
+             << i << "\", \"notes\": \"Some comment about record " << i
+             << "\", \"login\": {\"uris\": [{\"match\": null, \"uri\": "
+                "\"https://host"
+             << i << ".example.com\"}], \"username\": \"user" << i
+             << "\", \"password\": \"p@ss\\\"word" << i << "\"}}";
+    }
+    file << "\n]}\n";
+    return static_cast<std::size_t>(file.tellp());
+}
+
+template <class F>
+double seconds(F f) {
+    auto start{std::chrono::steady_clock::now()};
+    f();
+    std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() -
+                                          start};
+    return elapsed.count();
+}
+
+long maxResidentKiB() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+void report(const char* name, std::size_t bytes, int records, double s) {
+    std::cout << name << ": " << s << " s, " << bytes / s / (1024 * 1024)
+              << " MiB/s, " << records / s << " records/s, peak RSS "
+              << maxResidentKiB() << " KiB" << std::endl;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    int records{argc > 1 ? std::atoi(argv[1]) : DEFAULT_RECORDS};
+    if (records <= 0) {
+        std::cerr << "Usage: " << argv[0] << " [records]" << std::endl;
+        return 1;
+    }
+
+    auto xmlBytes{writeXmlFile(records)};
+    auto jsonBytes{writeJsonFile(records)};
+    std::cout << records << " records, " << xmlBytes << " bytes XML, "
+              << jsonBytes << " bytes JSON, peak RSS " << maxResidentKiB()
+              << " KiB" << std::endl;
+
+    std::remove(PET_FILE);
+    auto xmlSeconds{seconds([]() {
+        KeePassImport imp(XML_FILE, PET_FILE, false);
+        imp.import(PASSWORD);
+    })};
+    report("KeePass XML", xmlBytes, records, xmlSeconds);
+
+    std::remove(PET_FILE);
+    auto jsonSeconds{seconds([]() {
+        JSONImport imp(JSON_FILE, PET_FILE, false);
+        imp.import(PASSWORD);
+    })};
+    report("Bitwarden JSON", jsonBytes, records, jsonSeconds);
+
+    std::remove(XML_FILE);
+    std::remove(JSON_FILE);
+    std::remove(PET_FILE);
+    return 0;
+}
@@ -0,0 +1,179 @@
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "aes256factory.hh"
+#include "file.hh"
+#include "filehelper.hh"
+#include "jsonimport.h"
+
+namespace {
+constexpr auto JSON_FILE{"jsonimport.json"};
+constexpr auto PET_FILE{"jsonimport.pet"};
+constexpr auto PASSWORD{"bitwarden"};
+
+void writeFile(const char* fileName, const std::string& content) {
+    std::ofstream file{fileName, std::ios::binary | std::ios::trunc};
+    file << content;
+}
+
+struct Record {
+    std::string name;
+    std::string host;
+    std::string username;
+    std::string password;
+    std::string comment;
+    std::string tags;
+};
+
+std::vector<Record> readRecords() {
+    auto password{yapet::toSecureArray(PASSWORD)};
+    std::shared_ptr<yapet::AbstractCryptoFactory> cryptoFactory{
+        new yapet::Aes256Factory{password,
+                                 yapet::readMetaData(PET_FILE, false)}};
+    auto crypto{cryptoFactory->crypto()};
+
+    YAPET::File file{cryptoFactory, PET_FILE, false};
+    std::vector<Record> result;
+    for (const auto& item : file.read()) {
+        yapet::PasswordRecord passwordRecord{
+            crypto->decrypt(item.encryptedRecord())};
+        result.push_back(Record{
+            reinterpret_cast<const char*>(passwordRecord.name()),
+            reinterpret_cast<const char*>(passwordRecord.host()),
+            reinterpret_cast<const char*>(passwordRecord.username()),
+            reinterpret_cast<const char*>(passwordRecord.password()),
+            reinterpret_cast<const char*>(passwordRecord.comment()),
+            reinterpret_cast<const char*>(passwordRecord.tags())});
+    }
+    return result;
+}
+
+std::string item(const std::string& name, const std::string& password,
+                 const std::string& more = "") {
+    return "{\"id\": \"00000000-0000-0000-0000-000000000000\",\n"
+           " \"organizationId\": null, \"type\": 1, \"name\": \"" +
+           name + "\", \"favorite\": false,\n \"login\": {\"password\": \"" +
+           password + "\", \"totp\": null}" + more + "}";
+}
+
+void import(const std::string& items) {
+    std::remove(PET_FILE);
+    writeFile(JSON_FILE,
+              "{\n\"encrypted\": false,\n"
+              "\"folders\": [{\"id\": \"f1\", \"name\": \"Work\"},\n"
+              "{\"id\": \"f2\", \"name\": \"Private\"}],\n"
+              "\"items\": [\n" +
+                  items + "\n]\n}\n");
+}
+}  // namespace
+
+class JSONImportTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite* suite() {
+        CppUnit::TestSuite* suiteOfTests =
+            new CppUnit::TestSuite("JSON Import Tests");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<JSONImportTest>(
+            "should import all fields", &JSONImportTest::fields));
+        suiteOfTests->addTest(new CppUnit::TestCaller<JSONImportTest>(
+            "should import items in order", &JSONImportTest::order));
+        suiteOfTests->addTest(new CppUnit::TestCaller<JSONImportTest>(
+            "should log invalid items", &JSONImportTest::errors));
+        suiteOfTests->addTest(new CppUnit::TestCaller<JSONImportTest>(
+            "should reject encrypted exports", &JSONImportTest::encrypted));
+
+        return suiteOfTests;
+    }
+
+    void fields() {
+        import(item("M\\u00e4il \\ud83d\\ude00", "p\\\"w\\\\",
+                    ",\n \"folderId\": \"f2\", \"notes\": \"line 1\\nline 2\","
+                    "\n \"fields\": [{\"name\": \"x\", \"value\": \"y\"}],"
+                    "\n \"login\": {\"uris\": [{\"match\": null, \"uri\": "
+                    "\"https://example.com/?a=1&b=2\"}, {\"uri\": \"other\"}],"
+                    " \"username\": \"alice\", \"password\": \"p\\\"w\\\\\"}") +
+               ",\n{\"type\": 2, \"name\": \"note\", \"notes\": \"secret\", "
+               "\"folderId\": null, \"login\": null, "
+               "\"secureNote\": {\"type\": 0}}");
+
+        JSONImport imp(JSON_FILE, PET_FILE, false);
+        imp.import(PASSWORD);
+        CPPUNIT_ASSERT(!imp.hadErrors());
+
+        auto records{readRecords()};
+        CPPUNIT_ASSERT(records.size() == 2);
+        CPPUNIT_ASSERT(records[0].name == "M\xC3\xA4il \xF0\x9F\x98\x80");
+        CPPUNIT_ASSERT(records[0].host == "https://example.com/?a=1&b=2");
+        CPPUNIT_ASSERT(records[0].username == "alice");
+        CPPUNIT_ASSERT(records[0].password == "p\"w\\");
+        CPPUNIT_ASSERT(records[0].comment == "line 1\nline 2");
+        CPPUNIT_ASSERT(records[0].tags == "Private");
+        CPPUNIT_ASSERT(records[1].name == "note");
+        CPPUNIT_ASSERT(records[1].host.empty());
+        CPPUNIT_ASSERT(records[1].password.empty());
+        CPPUNIT_ASSERT(records[1].comment == "secret");
+        CPPUNIT_ASSERT(records[1].tags.empty());
+    }
+
+    void order() {
+        std::string items;
+        for (int i = 0; i < 1000; i++) {
+            if (i > 0) items += ",\n";
+            items += item("item " + std::to_string(i), "pw",
+                          i % 2 ? ", \"folderId\": \"f1\"" : "");
+        }
+        import(items);
+
+        JSONImport imp(JSON_FILE, PET_FILE, false);
+        imp.import(PASSWORD);
+        CPPUNIT_ASSERT(!imp.hadErrors());
+
+        auto records{readRecords()};
+        CPPUNIT_ASSERT(records.size() == 1000);
+        for (int i = 0; i < 1000; i++) {
+            CPPUNIT_ASSERT(records[i].name == "item " + std::to_string(i));
+            CPPUNIT_ASSERT(records[i].tags == (i % 2 ? "Work" : ""));
+        }
+    }
+
+    void errors() {
+        import(item("ok", "pw") + ",\n" +
+               item("long", std::string(
+                                yapet::PasswordRecord::PASSWORD_SIZE, 'x')) +
+               ",\n" + item("ok too", "pw"));
+
+        JSONImport imp(JSON_FILE, PET_FILE, false);
+        imp.import(PASSWORD);
+        CPPUNIT_ASSERT(imp.numErrors() == 1);
+        CPPUNIT_ASSERT(imp.getLog().front().lineNumber == 9);
+
+        auto records{readRecords()};
+        CPPUNIT_ASSERT(records.size() == 2);
+        CPPUNIT_ASSERT(records[0].name == "ok");
+        CPPUNIT_ASSERT(records[1].name == "ok too");
+    }
+
+    void encrypted() {
+        std::remove(PET_FILE);
+        writeFile(JSON_FILE,
+                  "{\"encrypted\": true, \"encKeyValidation_DO_NOT_EDIT\": "
+                  "\"x\", \"data\": \"x\"}");
+
+        JSONImport imp(JSON_FILE, PET_FILE, false);
+        CPPUNIT_ASSERT_THROW(imp.import(PASSWORD), std::runtime_error);
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(JSONImportTest::suite());
+    return runner.run() ? 0 : 1;
+}
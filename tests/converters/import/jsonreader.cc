@@ -0,0 +1,178 @@
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "jsonreader.hh"
+
+namespace {
+constexpr auto TEST_FILE{"jsonreader-test.json"};
+
+using Token = yapet::JSONReader::Token;
+
+void writeFile(const std::string& content) {
+    std::ofstream file{TEST_FILE, std::ios::binary | std::ios::trunc};
+    file << content;
+}
+
+// Parses the whole document
+void parse(const std::string& content) {
+    writeFile(content);
+    yapet::JSONReader reader{TEST_FILE};
+    while (reader.next() != Token::END_DOCUMENT)
+        ;
+}
+}  // namespace
+
+class JSONReaderTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite* suite() {
+        CppUnit::TestSuite* suiteOfTests =
+            new CppUnit::TestSuite("JSON Reader");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<JSONReaderTest>(
+            "should report tokens", &JSONReaderTest::tokens));
+        suiteOfTests->addTest(new CppUnit::TestCaller<JSONReaderTest>(
+            "should replace escape sequences", &JSONReaderTest::escapes));
+        suiteOfTests->addTest(new CppUnit::TestCaller<JSONReaderTest>(
+            "should skip values", &JSONReaderTest::skip));
+        suiteOfTests->addTest(new CppUnit::TestCaller<JSONReaderTest>(
+            "should truncate long strings", &JSONReaderTest::truncate));
+        suiteOfTests->addTest(new CppUnit::TestCaller<JSONReaderTest>(
+            "should reject invalid documents", &JSONReaderTest::invalid));
+        suiteOfTests->addTest(new CppUnit::TestCaller<JSONReaderTest>(
+            "should read sequences of documents", &JSONReaderTest::sequence));
+
+        return suiteOfTests;
+    }
+
+    void tokens() {
+        writeFile(
+            "{\"a\": [1, -2.5e3, true, false, null],\n"
+            " \"b\": {}, \"c\": [], \"d\": \"x\"}");
+        yapet::JSONReader reader{TEST_FILE};
+
+        CPPUNIT_ASSERT(reader.next() == Token::START_OBJECT);
+        CPPUNIT_ASSERT(reader.next() == Token::KEY);
+        CPPUNIT_ASSERT(reader.string() == "a");
+        CPPUNIT_ASSERT(reader.next() == Token::START_ARRAY);
+        CPPUNIT_ASSERT(reader.depth() == 2);
+        CPPUNIT_ASSERT(reader.next() == Token::NUMBER);
+        CPPUNIT_ASSERT(reader.string() == "1");
+        CPPUNIT_ASSERT(reader.next() == Token::NUMBER);
+        CPPUNIT_ASSERT(reader.string() == "-2.5e3");
+        CPPUNIT_ASSERT(reader.next() == Token::BOOLEAN);
+        CPPUNIT_ASSERT(reader.string() == "true");
+        CPPUNIT_ASSERT(reader.next() == Token::BOOLEAN);
+        CPPUNIT_ASSERT(reader.string() == "false");
+        CPPUNIT_ASSERT(reader.next() == Token::NULL_VALUE);
+        CPPUNIT_ASSERT(reader.next() == Token::END_ARRAY);
+        CPPUNIT_ASSERT(reader.next() == Token::KEY);
+        CPPUNIT_ASSERT(reader.string() == "b");
+        CPPUNIT_ASSERT(reader.lineNumber() == 2);
+        CPPUNIT_ASSERT(reader.next() == Token::START_OBJECT);
+        CPPUNIT_ASSERT(reader.next() == Token::END_OBJECT);
+        CPPUNIT_ASSERT(reader.next() == Token::KEY);
+        CPPUNIT_ASSERT(reader.next() == Token::START_ARRAY);
+        CPPUNIT_ASSERT(reader.next() == Token::END_ARRAY);
+        CPPUNIT_ASSERT(reader.next() == Token::KEY);
+        CPPUNIT_ASSERT(reader.next() == Token::STRING);
+        CPPUNIT_ASSERT(reader.string() == "x");
+        CPPUNIT_ASSERT(reader.next() == Token::END_OBJECT);
+        CPPUNIT_ASSERT(reader.depth() == 0);
+        CPPUNIT_ASSERT(reader.next() == Token::END_DOCUMENT);
+    }
+
+    void escapes() {
+        writeFile(
+            "[\"\\\"\\\\\\/\\b\\f\\n\\r\\t\\u0041\\u00e9\\u263A"
+            "\\ud83d\\ude00\"]");
+        yapet::JSONReader reader{TEST_FILE};
+
+        reader.next();
+        CPPUNIT_ASSERT(reader.next() == Token::STRING);
+        CPPUNIT_ASSERT(reader.string() ==
+                       "\"\\/\b\f\n\r\tA\xC3\xA9\xE2\x98\xBA\xF0\x9F\x98\x80");
+    }
+
+    void skip() {
+        writeFile(
+            "{\"a\": {\"b\": [1, {\"c\": 2}]}, \"d\": [3, [4]], \"e\": 5}");
+        yapet::JSONReader reader{TEST_FILE};
+
+        reader.next();
+        CPPUNIT_ASSERT(reader.next() == Token::KEY);
+        reader.skip();
+        CPPUNIT_ASSERT(reader.next() == Token::KEY);
+        CPPUNIT_ASSERT(reader.string() == "d");
+        CPPUNIT_ASSERT(reader.next() == Token::START_ARRAY);
+        reader.skip();
+        CPPUNIT_ASSERT(reader.next() == Token::KEY);
+        CPPUNIT_ASSERT(reader.string() == "e");
+        reader.skip();
+        CPPUNIT_ASSERT(reader.next() == Token::END_OBJECT);
+    }
+
+    void truncate() {
+        writeFile("[\"" + std::string(100, 'x') + "\\n\", \"y\"]");
+        yapet::JSONReader reader{TEST_FILE, 10};
+
+        reader.next();
+        CPPUNIT_ASSERT(reader.next() == Token::STRING);
+        CPPUNIT_ASSERT(reader.string() == std::string(10, 'x'));
+        CPPUNIT_ASSERT(reader.truncated());
+        CPPUNIT_ASSERT(reader.next() == Token::STRING);
+        CPPUNIT_ASSERT(reader.string() == "y");
+        CPPUNIT_ASSERT(!reader.truncated());
+    }
+
+    void invalid() {
+        CPPUNIT_ASSERT_THROW(parse(""), std::runtime_error);
+        CPPUNIT_ASSERT_THROW(parse("{"), std::runtime_error);
+        CPPUNIT_ASSERT_THROW(parse("[1,]"), std::runtime_error);
+        CPPUNIT_ASSERT_THROW(parse("[1 2]"), std::runtime_error);
+        CPPUNIT_ASSERT_THROW(parse("{\"a\" 1}"), std::runtime_error);
+        CPPUNIT_ASSERT_THROW(parse("{1: 1}"), std::runtime_error);
+        CPPUNIT_ASSERT_THROW(parse("[}"), std::runtime_error);
+        CPPUNIT_ASSERT_THROW(parse("[\"a]"), std::runtime_error);
+        CPPUNIT_ASSERT_THROW(parse("[\"\\x\"]"), std::runtime_error);
+        CPPUNIT_ASSERT_THROW(parse("[\"\\ud83d\"]"), std::runtime_error);
+        CPPUNIT_ASSERT_THROW(parse("[tru]"), std::runtime_error);
+        CPPUNIT_ASSERT_THROW(parse("[] []"), std::runtime_error);
+    }
+
+    void sequence() {
+        writeFile("{\"a\": 1}\n\n[2]\n\"b\"\n");
+        yapet::JSONReader reader{TEST_FILE};
+
+        CPPUNIT_ASSERT(reader.nextDocument());
+        CPPUNIT_ASSERT(reader.next() == Token::START_OBJECT);
+        reader.skip();
+        CPPUNIT_ASSERT(reader.nextDocument());
+        CPPUNIT_ASSERT(reader.lineNumber() == 3);
+        CPPUNIT_ASSERT(reader.next() == Token::START_ARRAY);
+        CPPUNIT_ASSERT(reader.next() == Token::NUMBER);
+        CPPUNIT_ASSERT_THROW(reader.nextDocument(), std::runtime_error);
+        CPPUNIT_ASSERT(reader.next() == Token::END_ARRAY);
+        CPPUNIT_ASSERT(reader.nextDocument());
+        CPPUNIT_ASSERT(reader.next() == Token::STRING);
+        CPPUNIT_ASSERT(reader.string() == "b");
+        CPPUNIT_ASSERT(!reader.nextDocument());
+        CPPUNIT_ASSERT(!reader.nextDocument());
+
+        writeFile("  ");
+        yapet::JSONReader empty{TEST_FILE};
+        CPPUNIT_ASSERT(!empty.nextDocument());
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(JSONReaderTest::suite());
+    return runner.run() ? 0 : 1;
+}
@@ -0,0 +1,187 @@
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "aes256factory.hh"
+#include "file.hh"
+#include "filehelper.hh"
+#include "keepassimport.h"
+
+namespace {
+constexpr auto XML_FILE{"keepassimport.xml"};
+constexpr auto PET_FILE{"keepassimport.pet"};
+constexpr auto PASSWORD{"keepass"};
+
+void writeFile(const char* fileName, const std::string& content) {
+    std::ofstream file{fileName, std::ios::binary | std::ios::trunc};
+    file << content;
+}
+
+struct Record {
+    std::string name;
+    std::string host;
+    std::string username;
+    std::string password;
+    std::string comment;
+    std::string tags;
+};
+
+std::vector<Record> readRecords() {
+    auto password{yapet::toSecureArray(PASSWORD)};
+    std::shared_ptr<yapet::AbstractCryptoFactory> cryptoFactory{
+        new yapet::Aes256Factory{password,
+                                 yapet::readMetaData(PET_FILE, false)}};
+    auto crypto{cryptoFactory->crypto()};
+
+    YAPET::File file{cryptoFactory, PET_FILE, false};
+    std::vector<Record> result;
+    for (const auto& item : file.read()) {
+        yapet::PasswordRecord passwordRecord{
+            crypto->decrypt(item.encryptedRecord())};
+        result.push_back(Record{
+            reinterpret_cast<const char*>(passwordRecord.name()),
+            reinterpret_cast<const char*>(passwordRecord.host()),
+            reinterpret_cast<const char*>(passwordRecord.username()),
+            reinterpret_cast<const char*>(passwordRecord.password()),
+            reinterpret_cast<const char*>(passwordRecord.comment()),
+            reinterpret_cast<const char*>(passwordRecord.tags())});
+    }
+    return result;
+}
+
+std::string entry(const std::string& title, const std::string& password,
+                  const std::string& more = "") {
+    return "<Entry>\n"
+           "<UUID>AAAAAAAAAAAAAAAAAAAAAA==</UUID>\n"
+           "<String><Key>Title</Key><Value>" +
+           title +
+           "</Value></String>\n"
+           "<String><Key>Password</Key><Value ProtectInMemory=\"True\">" +
+           password + "</Value></String>\n" + more + "</Entry>\n";
+}
+
+void import(const std::string& entries) {
+    std::remove(PET_FILE);
+    writeFile(XML_FILE,
+              "<?xml version=\"1.0\" encoding=\"utf-8\" "
+              "standalone=\"yes\"?>\n"
+              "<KeePassFile>\n"
+              "<Meta><Generator>KeePass</Generator></Meta>\n"
+              "<Root><Group><Name>Root</Name>\n" +
+                  entries +
+                  "</Group><DeletedObjects /></Root>\n"
+                  "</KeePassFile>\n");
+}
+}  // namespace
+
+class KeePassImportTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite* suite() {
+        CppUnit::TestSuite* suiteOfTests =
+            new CppUnit::TestSuite("KeePass Import Tests");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<KeePassImportTest>(
+            "should import all fields", &KeePassImportTest::fields));
+        suiteOfTests->addTest(new CppUnit::TestCaller<KeePassImportTest>(
+            "should import nested groups in order",
+            &KeePassImportTest::nestedGroups));
+        suiteOfTests->addTest(new CppUnit::TestCaller<KeePassImportTest>(
+            "should log invalid entries", &KeePassImportTest::errors));
+        suiteOfTests->addTest(new CppUnit::TestCaller<KeePassImportTest>(
+            "should reject other XML files", &KeePassImportTest::notKeePass));
+
+        return suiteOfTests;
+    }
+
+    void fields() {
+        import(entry("M&#xE4;il &amp; &lt;more&gt;", "p&quot;w&apos;",
+                     "<String><Key>URL</Key><Value><![CDATA[https://"
+                     "example.com/?a=1&b=2]]></Value></String>\n"
+                     "<String><Key>UserName</Key><Value>alice</Value>"
+                     "</String>\n"
+                     "<String><Key>Notes</Key><Value>line 1\r\nline 2"
+                     "</Value></String>\n"
+                     "<String><Key>Custom</Key><Value>x</Value></String>\n"
+                     "<Tags>work;mail</Tags>\n"
+                     "<History>\n" +
+                         entry("Old", "old") + "</History>\n"));
+
+        KeePassImport imp(XML_FILE, PET_FILE, false);
+        imp.import(PASSWORD);
+        CPPUNIT_ASSERT(!imp.hadErrors());
+
+        auto records{readRecords()};
+        CPPUNIT_ASSERT(records.size() == 1);
+        CPPUNIT_ASSERT(records[0].name == "M\xC3\xA4il & <more>");
+        CPPUNIT_ASSERT(records[0].host == "https://example.com/?a=1&b=2");
+        CPPUNIT_ASSERT(records[0].username == "alice");
+        CPPUNIT_ASSERT(records[0].password == "p\"w'");
+        CPPUNIT_ASSERT(records[0].comment == "line 1\nline 2");
+        CPPUNIT_ASSERT(records[0].tags == "work,mail");
+    }
+
+    void nestedGroups() {
+        std::string entries;
+        for (int i = 0; i < 1000; i++) {
+            if (i % 100 == 0) entries += "<Group><Name>Sub</Name>\n";
+            entries += entry("entry " + std::to_string(i), "pw");
+            if (i % 100 == 99) entries += "</Group>\n";
+        }
+        import(entries);
+
+        KeePassImport imp(XML_FILE, PET_FILE, false);
+        imp.import(PASSWORD);
+        CPPUNIT_ASSERT(!imp.hadErrors());
+
+        auto records{readRecords()};
+        CPPUNIT_ASSERT(records.size() == 1000);
+        for (int i = 0; i < 1000; i++) {
+            CPPUNIT_ASSERT(records[i].name == "entry " + std::to_string(i));
+            CPPUNIT_ASSERT(records[i].host.empty());
+            CPPUNIT_ASSERT(records[i].tags.empty());
+        }
+    }
+
+    void errors() {
+        import(entry("ok", "pw") +
+               entry(std::string(yapet::PasswordRecord::NAME_SIZE, 'x'),
+                     "pw") +
+               "<Entry>\n<String><Key>Title</Key><Value>protected</Value>"
+               "</String>\n<String><Key>Password</Key>"
+               "<Value Protected=\"True\">c2VjcmV0</Value></String>\n"
+               "</Entry>\n" +
+               entry("ok too", "pw"));
+
+        KeePassImport imp(XML_FILE, PET_FILE, false);
+        imp.import(PASSWORD);
+        CPPUNIT_ASSERT(imp.numErrors() == 2);
+        CPPUNIT_ASSERT(imp.getLog().front().lineNumber == 10);
+        CPPUNIT_ASSERT(imp.getLog().back().lineNumber == 15);
+
+        auto records{readRecords()};
+        CPPUNIT_ASSERT(records.size() == 2);
+        CPPUNIT_ASSERT(records[0].name == "ok");
+        CPPUNIT_ASSERT(records[1].name == "ok too");
+    }
+
+    void notKeePass() {
+        std::remove(PET_FILE);
+        writeFile(XML_FILE, "<html><body/></html>");
+
+        KeePassImport imp(XML_FILE, PET_FILE, false);
+        CPPUNIT_ASSERT_THROW(imp.import(PASSWORD), std::runtime_error);
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(KeePassImportTest::suite());
+    return runner.run() ? 0 : 1;
+}
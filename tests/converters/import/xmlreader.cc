@@ -0,0 +1,149 @@
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "xmlreader.hh"
+
+namespace {
+constexpr auto TEST_FILE{"xmlreader-test.xml"};
+
+using Event = yapet::XMLReader::Event;
+
+void writeFile(const std::string& content) {
+    std::ofstream file{TEST_FILE, std::ios::binary | std::ios::trunc};
+    file << content;
+}
+
+// Parses the whole document
+void parse(const std::string& content) {
+    writeFile(content);
+    yapet::XMLReader reader{TEST_FILE};
+    while (reader.next() != Event::END_DOCUMENT)
+        ;
+}
+}  // namespace
+
+class XMLReaderTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite* suite() {
+        CppUnit::TestSuite* suiteOfTests = new CppUnit::TestSuite("XML Reader");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<XMLReaderTest>(
+            "should report elements and text", &XMLReaderTest::events));
+        suiteOfTests->addTest(new CppUnit::TestCaller<XMLReaderTest>(
+            "should read attributes", &XMLReaderTest::attributes));
+        suiteOfTests->addTest(new CppUnit::TestCaller<XMLReaderTest>(
+            "should replace references", &XMLReaderTest::references));
+        suiteOfTests->addTest(new CppUnit::TestCaller<XMLReaderTest>(
+            "should skip markup", &XMLReaderTest::skipMarkup));
+        suiteOfTests->addTest(new CppUnit::TestCaller<XMLReaderTest>(
+            "should truncate long text", &XMLReaderTest::truncate));
+        suiteOfTests->addTest(new CppUnit::TestCaller<XMLReaderTest>(
+            "should reject malformed documents", &XMLReaderTest::malformed));
+
+        return suiteOfTests;
+    }
+
+    void events() {
+        writeFile("<a>\n<b>text</b><c/></a>");
+        yapet::XMLReader reader{TEST_FILE};
+
+        CPPUNIT_ASSERT(reader.next() == Event::START_ELEMENT);
+        CPPUNIT_ASSERT(reader.name() == "a");
+        CPPUNIT_ASSERT(reader.depth() == 1);
+        CPPUNIT_ASSERT(reader.next() == Event::TEXT);
+        CPPUNIT_ASSERT(reader.text() == "\n");
+        CPPUNIT_ASSERT(reader.next() == Event::START_ELEMENT);
+        CPPUNIT_ASSERT(reader.name() == "b");
+        CPPUNIT_ASSERT(reader.depth() == 2);
+        CPPUNIT_ASSERT(reader.lineNumber() == 2);
+        CPPUNIT_ASSERT(reader.next() == Event::TEXT);
+        CPPUNIT_ASSERT(reader.text() == "text");
+        CPPUNIT_ASSERT(reader.next() == Event::END_ELEMENT);
+        CPPUNIT_ASSERT(reader.name() == "b");
+        CPPUNIT_ASSERT(reader.depth() == 1);
+        CPPUNIT_ASSERT(reader.next() == Event::START_ELEMENT);
+        CPPUNIT_ASSERT(reader.name() == "c");
+        CPPUNIT_ASSERT(reader.next() == Event::END_ELEMENT);
+        CPPUNIT_ASSERT(reader.name() == "c");
+        CPPUNIT_ASSERT(reader.next() == Event::END_ELEMENT);
+        CPPUNIT_ASSERT(reader.name() == "a");
+        CPPUNIT_ASSERT(reader.depth() == 0);
+        CPPUNIT_ASSERT(reader.next() == Event::END_DOCUMENT);
+    }
+
+    void attributes() {
+        writeFile("<a x=\"1\" y = 'a &amp; \"b\"'/>");
+        yapet::XMLReader reader{TEST_FILE};
+
+        CPPUNIT_ASSERT(reader.next() == Event::START_ELEMENT);
+        CPPUNIT_ASSERT(*reader.attribute("x") == "1");
+        CPPUNIT_ASSERT(*reader.attribute("y") == "a & \"b\"");
+        CPPUNIT_ASSERT(reader.attribute("z") == nullptr);
+    }
+
+    void references() {
+        writeFile(
+            "<a>&lt;&gt;&amp;&quot;&apos;&#65;&#x42;&#xe9;&#x263A;&#x1F600;"
+            "\r\n<![CDATA[&lt;]]]]></a>");
+        yapet::XMLReader reader{TEST_FILE};
+
+        reader.next();
+        CPPUNIT_ASSERT(reader.next() == Event::TEXT);
+        CPPUNIT_ASSERT(reader.text() ==
+                       "<>&\"'AB\xC3\xA9\xE2\x98\xBA\xF0\x9F\x98\x80\n&lt;]]");
+    }
+
+    void skipMarkup() {
+        writeFile(
+            "<?xml version=\"1.0\"?>\n"
+            "<!DOCTYPE a [<!ELEMENT a (#PCDATA)>]>\n"
+            "<!-- <b> -->\n"
+            "<a>x<!-- comment -->y<?pi?>z</a>\n");
+        yapet::XMLReader reader{TEST_FILE};
+
+        CPPUNIT_ASSERT(reader.next() == Event::START_ELEMENT);
+        CPPUNIT_ASSERT(reader.name() == "a");
+        CPPUNIT_ASSERT(reader.lineNumber() == 4);
+        CPPUNIT_ASSERT(reader.next() == Event::TEXT);
+        CPPUNIT_ASSERT(reader.text() == "xyz");
+        CPPUNIT_ASSERT(reader.next() == Event::END_ELEMENT);
+        CPPUNIT_ASSERT(reader.next() == Event::END_DOCUMENT);
+    }
+
+    void truncate() {
+        writeFile("<a>" + std::string(100, 'x') + "&amp;</a>");
+        yapet::XMLReader reader{TEST_FILE, 10};
+
+        reader.next();
+        CPPUNIT_ASSERT(reader.next() == Event::TEXT);
+        CPPUNIT_ASSERT(reader.text() == std::string(10, 'x'));
+        CPPUNIT_ASSERT(reader.truncated());
+        CPPUNIT_ASSERT(reader.next() == Event::END_ELEMENT);
+        CPPUNIT_ASSERT(!reader.truncated());
+    }
+
+    void malformed() {
+        CPPUNIT_ASSERT_THROW(parse(""), std::runtime_error);
+        CPPUNIT_ASSERT_THROW(parse("<a>"), std::runtime_error);
+        CPPUNIT_ASSERT_THROW(parse("<a></b>"), std::runtime_error);
+        CPPUNIT_ASSERT_THROW(parse("<a/><b/>"), std::runtime_error);
+        CPPUNIT_ASSERT_THROW(parse("text<a/>"), std::runtime_error);
+        CPPUNIT_ASSERT_THROW(parse("<a>&unknown;</a>"), std::runtime_error);
+        CPPUNIT_ASSERT_THROW(parse("<a x=1/>"), std::runtime_error);
+        CPPUNIT_ASSERT_THROW(parse("<a><!-- </a>"), std::runtime_error);
+        CPPUNIT_ASSERT_THROW(parse("<a><![CDATA[</a>"), std::runtime_error);
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(XMLReaderTest::suite());
+    return runner.run() ? 0 : 1;
+}
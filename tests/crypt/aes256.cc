@@ -4,6 +4,8 @@
 #include <cppunit/extensions/TestFactoryRegistry.h>
 #include <cppunit/ui/text/TestRunner.h>
 
+#include <cstring>
+
 #include "aes256.hh"
 #include "consts.h"
 #include "cryptoerror.hh"
@@ -32,6 +34,10 @@ class Aes256Test : public CppUnit::TestFixture {
             "should throw on empty plain/cipher text",
             &Aes256Test::throwOnEmptyPlainAndCipherText));
 
+        suiteOfTests->addTest(new CppUnit::TestCaller<Aes256Test>(
+            "should decrypt prefix of plain text",
+            &Aes256Test::decryptPrefix));
+
         return suiteOfTests;
     }
 
@@ -95,6 +101,26 @@ class Aes256Test : public CppUnit::TestFixture {
         CPPUNIT_ASSERT_THROW(aes256->encrypt(empty), yapet::EncryptionError);
         CPPUNIT_ASSERT_THROW(aes256->decrypt(empty), yapet::EncryptionError);
     }
+
+    void decryptPrefix() {
+        yapet::SecureArray plainText{1000};
+        for (int i = 0; i < plainText.size(); i++) {
+            (*plainText)[i] = static_cast<std::uint8_t>(i);
+        }
+        auto cipherText = aes256->encrypt(plainText);
+
+        auto prefix = aes256->decryptPrefix(cipherText, 100);
+        CPPUNIT_ASSERT(prefix.size() == 112);
+        CPPUNIT_ASSERT(std::memcmp(*prefix, *plainText, prefix.size()) == 0);
+
+        prefix = aes256->decryptPrefix(cipherText, 128);
+        CPPUNIT_ASSERT(prefix.size() == 128);
+        CPPUNIT_ASSERT(std::memcmp(*prefix, *plainText, prefix.size()) == 0);
+
+        // Prefixes reaching the padding decrypt the entire plain text
+        CPPUNIT_ASSERT(aes256->decryptPrefix(cipherText, 995) == plainText);
+        CPPUNIT_ASSERT(aes256->decryptPrefix(cipherText, 2000) == plainText);
+    }
 };
 
 int main() {
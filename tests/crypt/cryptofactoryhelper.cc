@@ -10,8 +10,13 @@
 #include "aes256factory.hh"
 #include "blowfishfactory.hh"
 #include "cryptofactoryhelper.hh"
+#include "file.hh"
+#include "fileerror.hh"
+#include "passwordlistitem.hh"
+#include "passwordrecord.hh"
 #include "testpaths.h"
 #include "openssl.hh"
+#include "yapeterror.hh"
 
 class CryptoFactoryHelperTest : public CppUnit::TestFixture {
    private:
@@ -34,6 +39,15 @@ class CryptoFactoryHelperTest : public CppUnit::TestFixture {
         suiteOfTests->addTest(new CppUnit::TestCaller<CryptoFactoryHelperTest>(
             "should gracefully handle error file",
             &CryptoFactoryHelperTest::errorFile));
+        suiteOfTests->addTest(new CppUnit::TestCaller<CryptoFactoryHelperTest>(
+            "should verify password",
+            &CryptoFactoryHelperTest::verifiedFile));
+        suiteOfTests->addTest(new CppUnit::TestCaller<CryptoFactoryHelperTest>(
+            "should convert blowfish file on new password",
+            &CryptoFactoryHelperTest::convertOnNewPassword));
+        suiteOfTests->addTest(new CppUnit::TestCaller<CryptoFactoryHelperTest>(
+            "should keep data key on new password",
+            &CryptoFactoryHelperTest::keepDataKeyOnNewPassword));
 
         return suiteOfTests;
     }
@@ -79,6 +93,79 @@ class CryptoFactoryHelperTest : public CppUnit::TestFixture {
 
         CPPUNIT_ASSERT(!factory);
     }
+
+    void verifiedFile() {
+        constexpr auto FN{BUILDDIR "/cryptofactoryhelper-verify.pet"};
+        {
+            std::shared_ptr<yapet::AbstractCryptoFactory> factory{
+                new yapet::Aes256Factory{
+                    yapet::toSecureArray("wdc"),
+                    yapet::Key256::newDefaultKeyingParameters()}};
+            YAPET::File file{factory, FN, true, false};
+        }
+
+        auto factory{yapet::getVerifiedCryptoFactoryForFile(
+            FN, yapet::toSecureArray("wdc"), false)};
+        CPPUNIT_ASSERT(factory);
+
+        CPPUNIT_ASSERT_THROW(yapet::getVerifiedCryptoFactoryForFile(
+                                 FN, yapet::toSecureArray("wrong"), false),
+                             yapet::InvalidPasswordError);
+        CPPUNIT_ASSERT_THROW(yapet::getVerifiedCryptoFactoryForFile(
+                                 BUILDDIR "/cryptofactoryhelper-unknown.pet",
+                                 yapet::toSecureArray("wdc"), false),
+                             yapet::FileFormatError);
+    }
+
+    void convertOnNewPassword() {
+        constexpr auto FN{BUILDDIR "/cryptofactoryhelper-convert.pet"};
+        std::shared_ptr<yapet::AbstractCryptoFactory> factory{
+            new yapet::BlowfishFactory{yapet::toSecureArray("wdc"),
+                                       yapet::MetaData{}}};
+        YAPET::File file{factory, FN, true, false};
+
+        yapet::PasswordRecord passwordRecord;
+        passwordRecord.name("name");
+        passwordRecord.password("password");
+        auto crypto{factory->crypto()};
+        file.save({yapet::PasswordListItem{
+            "name", crypto->encrypt(passwordRecord.serialize())}});
+
+        auto newFactory{yapet::getCryptoFactoryForNewPassword(
+            factory, yapet::toSecureArray("new"),
+            yapet::Key256::newDefaultKeyingParameters())};
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpotentially-evaluated-expression"
+        CPPUNIT_ASSERT(typeid(*newFactory) == typeid(yapet::Aes256Factory));
+#pragma clang diagnostic pop
+        file.setNewKey(newFactory);
+
+        auto expectedFileVersion{
+            yapet::toSecureArray(yapet::Yapet20File::RECOGNITION_STRING,
+                                 yapet::Yapet20File::RECOGNITION_STRING_SIZE)};
+        CPPUNIT_ASSERT(file.getFileVersion() == expectedFileVersion);
+
+        auto convertedFactory{yapet::getVerifiedCryptoFactoryForFile(
+            FN, yapet::toSecureArray("new"), false)};
+        YAPET::File convertedFile{convertedFactory, FN, false, false};
+        auto records{convertedFile.read()};
+        CPPUNIT_ASSERT(records.size() == 1);
+        CPPUNIT_ASSERT(std::strcmp(reinterpret_cast<const char*>(
+                                       records.front().name()),
+                                   "name") == 0);
+    }
+
+    void keepDataKeyOnNewPassword() {
+        std::shared_ptr<yapet::AbstractCryptoFactory> factory{
+            new yapet::Aes256Factory{
+                yapet::toSecureArray("wdc"),
+                yapet::Key256::newDefaultKeyingParameters()}};
+
+        auto newFactory{yapet::getCryptoFactoryForNewPassword(
+            factory, yapet::toSecureArray("new"),
+            yapet::Key256::newDefaultKeyingParameters())};
+        CPPUNIT_ASSERT(*newFactory->key() == *factory->key());
+    }
 };
 
 int main() {
@@ -8,6 +8,7 @@
 #include <cppunit/extensions/TestFactoryRegistry.h>
 #include <cppunit/ui/text/TestRunner.h>
 
+#include <sys/stat.h>
 #include <unistd.h>
 #include <cstring>
 #include <list>
@@ -16,6 +17,7 @@
 #include "cryptoerror.hh"
 #include "file.hh"
 #include "filehelper.hh"
+#include "fileutils.hh"
 #include "securearray.hh"
 #include "testpaths.h"
 #include "yapeterror.hh"
@@ -80,6 +82,12 @@ inline std::list<yapet::PasswordListItem> createPasswordList(
     return passwordList;
 }
 
+inline ino_t inode(const char *filename) {
+    struct stat fileStat;
+    CPPUNIT_ASSERT(::stat(filename, &fileStat) == 0);
+    return fileStat.st_ino;
+}
+
 inline void comparePasswordRecords(const yapet::PasswordRecord &actual,
                                    const yapet::PasswordRecord &expected) {
     CPPUNIT_ASSERT(
@@ -137,6 +145,15 @@ class Aes256FileTest : public CppUnit::TestFixture {
         suiteOfTests->addTest(new CppUnit::TestCaller<Aes256FileTest>(
             "should allow saving passwords after password change",
             &Aes256FileTest::allowSaveAfterPasswordSave));
+        suiteOfTests->addTest(new CppUnit::TestCaller<Aes256FileTest>(
+            "should keep records when keeping data key on password change",
+            &Aes256FileTest::keepDataKey));
+        suiteOfTests->addTest(new CppUnit::TestCaller<Aes256FileTest>(
+            "should re-encrypt records when rotating data key",
+            &Aes256FileTest::rotateDataKey));
+        suiteOfTests->addTest(new CppUnit::TestCaller<Aes256FileTest>(
+            "should keep records when adding and removing key slots",
+            &Aes256FileTest::keySlots));
 
         suiteOfTests->addTest(new CppUnit::TestCaller<Aes256FileTest>(
             "should throw exception on reading corrupt file",
@@ -447,6 +464,124 @@ void allowSaveAfterPasswordSave() {
     file.save(passwordList);
 }
 
+void keepDataKey() {
+    auto password{yapet::toSecureArray(TEST_PASSWORD)};
+    std::shared_ptr<yapet::Aes256Factory> factory{new yapet::Aes256Factory{
+        password, yapet::Key256::newDefaultKeyingParameters()}};
+    auto aes256{factory->crypto()};
+
+    YAPET::File file{factory, FN, true};
+    file.save(createPasswordList(aes256));
+    auto encryptedRecords{file.readEncryptedRecords()};
+    auto fileSize{yapet::getFileSize(FN)};
+    auto fileInode{inode(FN)};
+
+    auto newPassword{yapet::toSecureArray("NewSecret")};
+    file.setNewKey(factory->newFactory(
+        newPassword, yapet::Key256::newDefaultKeyingParameters()));
+
+    // The header is rewritten in place
+    CPPUNIT_ASSERT(yapet::getFileSize(FN) == fileSize);
+    CPPUNIT_ASSERT(inode(FN) == fileInode);
+    CPPUNIT_ASSERT(file.readEncryptedRecords() == encryptedRecords);
+
+    std::shared_ptr<yapet::Aes256Factory> newFactory{
+        new yapet::Aes256Factory{newPassword, yapet::readMetaData(FN, false)}};
+    YAPET::File newFile{newFactory, FN, false};
+    CPPUNIT_ASSERT(newFile.readEncryptedRecords() == encryptedRecords);
+    CPPUNIT_ASSERT(*newFactory->key() == *factory->key());
+
+    std::shared_ptr<yapet::Aes256Factory> oldFactory{
+        new yapet::Aes256Factory{password, yapet::readMetaData(FN, false)}};
+    CPPUNIT_ASSERT_THROW((YAPET::File{oldFactory, FN, false}),
+                         yapet::InvalidPasswordError);
+}
+
+void rotateDataKey() {
+    // Enough records to be re-encrypted by several workers
+    constexpr auto RECORDS{1000};
+
+    auto password{yapet::toSecureArray(TEST_PASSWORD)};
+    std::shared_ptr<yapet::Aes256Factory> factory{new yapet::Aes256Factory{
+        password, yapet::Key256::newDefaultKeyingParameters()}};
+    auto aes256{factory->crypto()};
+
+    YAPET::File file{factory, FN, true};
+    file.beginSave();
+    for (int i = 0; i < RECORDS; i++) {
+        file.saveRecord(aes256->encrypt(makePasswordRecord(i).serialize()));
+    }
+    file.endSave();
+    auto encryptedRecords{file.readEncryptedRecords()};
+
+    std::shared_ptr<yapet::AbstractCryptoFactory> rotatedFactory{
+        new yapet::Aes256Factory{password,
+                                 yapet::Key256::newDefaultKeyingParameters()}};
+    CPPUNIT_ASSERT(*rotatedFactory->key() != *factory->key());
+    file.setNewKey(rotatedFactory);
+
+    std::shared_ptr<yapet::Aes256Factory> newFactory{
+        new yapet::Aes256Factory{password, yapet::readMetaData(FN, false)}};
+    CPPUNIT_ASSERT(*newFactory->key() == *rotatedFactory->key());
+
+    YAPET::File newFile{newFactory, FN, false};
+    auto rotatedRecords{newFile.readEncryptedRecords()};
+    CPPUNIT_ASSERT(rotatedRecords.size() == RECORDS);
+
+    auto newAes256{newFactory->crypto()};
+    for (int i = 0; i < RECORDS; i++) {
+        CPPUNIT_ASSERT(rotatedRecords[i] != encryptedRecords[i]);
+        yapet::PasswordRecord actual{newAes256->decrypt(rotatedRecords[i])};
+        comparePasswordRecords(actual, makePasswordRecord(i));
+    }
+}
+
+void keySlots() {
+    auto password{yapet::toSecureArray(TEST_PASSWORD)};
+    std::shared_ptr<yapet::Aes256Factory> factory{new yapet::Aes256Factory{
+        password, yapet::Key256::newDefaultKeyingParameters()}};
+    auto aes256{factory->crypto()};
+
+    YAPET::File file{factory, FN, true};
+    file.save(createPasswordList(aes256));
+    auto encryptedRecords{file.readEncryptedRecords()};
+    auto fileSize{yapet::getFileSize(FN)};
+    auto fileInode{inode(FN)};
+
+    std::shared_ptr<yapet::Key256> key256{new yapet::Key256{
+        *std::dynamic_pointer_cast<yapet::Key256>(factory->key())}};
+    auto otherPassword{yapet::toSecureArray("OtherSecret")};
+    auto slot{key256->addKeySlot(otherPassword,
+                                 yapet::Key256::newDefaultKeyingParameters())};
+    file.setNewKey(std::shared_ptr<yapet::AbstractCryptoFactory>{
+        new yapet::Aes256Factory{key256}});
+
+    CPPUNIT_ASSERT(yapet::getFileSize(FN) == fileSize);
+    CPPUNIT_ASSERT(inode(FN) == fileInode);
+    CPPUNIT_ASSERT(file.readEncryptedRecords() == encryptedRecords);
+
+    std::shared_ptr<yapet::Aes256Factory> otherFactory{new yapet::Aes256Factory{
+        otherPassword, yapet::readMetaData(FN, false)}};
+    YAPET::File otherFile{otherFactory, FN, false};
+    CPPUNIT_ASSERT(otherFile.readEncryptedRecords() == encryptedRecords);
+
+    key256->removeKeySlot(0);
+    file.setNewKey(std::shared_ptr<yapet::AbstractCryptoFactory>{
+        new yapet::Aes256Factory{key256}});
+    CPPUNIT_ASSERT(yapet::getFileSize(FN) == fileSize);
+    CPPUNIT_ASSERT(inode(FN) == fileInode);
+
+    std::shared_ptr<yapet::Aes256Factory> oldFactory{
+        new yapet::Aes256Factory{password, yapet::readMetaData(FN, false)}};
+    CPPUNIT_ASSERT_THROW((YAPET::File{oldFactory, FN, false}),
+                         yapet::InvalidPasswordError);
+
+    auto key{std::dynamic_pointer_cast<yapet::Key256>(
+        yapet::Aes256Factory{otherPassword, yapet::readMetaData(FN, false)}
+            .key())};
+    CPPUNIT_ASSERT(key->keySlot() == slot);
+}
+
 void corruptFile() {
     // The file has the byte at offset 0x89 changed from 0xA0 to 0xA1,
     // messing up the length indicator for the first record
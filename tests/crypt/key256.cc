@@ -5,6 +5,9 @@
 #include <cppunit/ui/text/TestRunner.h>
 
 #include <cstring>
+#include <map>
+#include <stdexcept>
+#include <vector>
 
 #include "consts.h"
 #include "key256.hh"
@@ -32,6 +35,33 @@ class Key256Test : public CppUnit::TestFixture {
             "should create proper key", &Key256Test::testKey));
         suiteOfTests->addTest(new CppUnit::TestCaller<Key256Test>(
             "should create no IV", &Key256Test::testIV));
+        suiteOfTests->addTest(new CppUnit::TestCaller<Key256Test>(
+            "should wrap random data key", &Key256Test::wrapDataKey));
+        suiteOfTests->addTest(new CppUnit::TestCaller<Key256Test>(
+            "should unwrap data key", &Key256Test::unwrapDataKey));
+        suiteOfTests->addTest(new CppUnit::TestCaller<Key256Test>(
+            "should not unwrap data key using invalid password",
+            &Key256Test::invalidPassword));
+        suiteOfTests->addTest(new CppUnit::TestCaller<Key256Test>(
+            "should wrap data key using new password",
+            &Key256Test::newPassword));
+        suiteOfTests->addTest(new CppUnit::TestCaller<Key256Test>(
+            "should unwrap data key from added key slot",
+            &Key256Test::addKeySlot));
+        suiteOfTests->addTest(new CppUnit::TestCaller<Key256Test>(
+            "should not unwrap data key from removed key slot",
+            &Key256Test::removeKeySlot));
+        suiteOfTests->addTest(new CppUnit::TestCaller<Key256Test>(
+            "should not change size of keying parameters",
+            &Key256Test::keySlotSize));
+        suiteOfTests->addTest(new CppUnit::TestCaller<Key256Test>(
+            "should replace key slot", &Key256Test::replaceKeySlot));
+        suiteOfTests->addTest(new CppUnit::TestCaller<Key256Test>(
+            "should rotate data key of all key slots",
+            &Key256Test::rotateDataKey));
+        suiteOfTests->addTest(new CppUnit::TestCaller<Key256Test>(
+            "should not rotate data key using invalid password",
+            &Key256Test::rotateDataKeyInvalidPassword));
 
         return suiteOfTests;
     }
@@ -68,6 +98,222 @@ class Key256Test : public CppUnit::TestFixture {
         CPPUNIT_ASSERT(key.ivecSize() == 0);
         CPPUNIT_ASSERT(key.ivec() == yapet::SecureArray{});
     }
+
+    yapet::MetaData dataKeyParameters() {
+        auto p{parameters};
+        p.setValue(YAPET::Consts::ARGON2_MEMORY_COST_KEY,
+                   YAPET::Consts::MIN_ARGON2_MEMORY);
+        p.setValue(YAPET::Consts::DATA_KEY_VERSION_KEY, 1);
+        return p;
+    }
+
+    void wrapDataKey() {
+        yapet::Key256 key{};
+        key.keyingParameters(dataKeyParameters());
+        key.password(passwordArray);
+
+        CPPUNIT_ASSERT(key.isDataKey());
+        CPPUNIT_ASSERT(key.keySize() == 32);
+        CPPUNIT_ASSERT(
+            yapet::Key256::hasWrappedDataKey(key.keyingParameters()));
+        CPPUNIT_ASSERT(!yapet::Key256::hasWrappedDataKey(parameters));
+
+        yapet::Key256 otherKey{};
+        otherKey.keyingParameters(dataKeyParameters());
+        otherKey.password(passwordArray);
+        CPPUNIT_ASSERT(key != otherKey);
+    }
+
+    void unwrapDataKey() {
+        yapet::Key256 key{};
+        key.keyingParameters(dataKeyParameters());
+        key.password(passwordArray);
+
+        yapet::Key256 unwrappedKey{};
+        unwrappedKey.keyingParameters(key.keyingParameters());
+        unwrappedKey.password(passwordArray);
+
+        CPPUNIT_ASSERT(unwrappedKey.isDataKey());
+        CPPUNIT_ASSERT(unwrappedKey == key);
+    }
+
+    void invalidPassword() {
+        yapet::Key256 key{};
+        key.keyingParameters(dataKeyParameters());
+        key.password(passwordArray);
+
+        yapet::Key256 otherKey{};
+        otherKey.keyingParameters(key.keyingParameters());
+        otherKey.password(yapet::toSecureArray("invalid"));
+
+        CPPUNIT_ASSERT(!otherKey.isDataKey());
+        CPPUNIT_ASSERT(otherKey != key);
+    }
+
+    void newPassword() {
+        yapet::Key256 key{};
+        key.keyingParameters(dataKeyParameters());
+        key.password(passwordArray);
+
+        auto newPasswordArray{yapet::toSecureArray("NewPassword")};
+        yapet::Key256 rewrappedKey{key};
+        rewrappedKey.keySlot(key.keySlot(), newPasswordArray, parameters);
+        CPPUNIT_ASSERT(rewrappedKey == key);
+        CPPUNIT_ASSERT(rewrappedKey.keyingParameters().serialize().size() ==
+                       key.keyingParameters().serialize().size());
+
+        yapet::Key256 unwrappedKey{};
+        unwrappedKey.keyingParameters(rewrappedKey.keyingParameters());
+        unwrappedKey.password(newPasswordArray);
+        CPPUNIT_ASSERT(unwrappedKey == key);
+
+        unwrappedKey.password(passwordArray);
+        CPPUNIT_ASSERT(unwrappedKey != key);
+    }
+
+    yapet::MetaData otherSlotParameters() {
+        auto p{dataKeyParameters()};
+        p.setValue(YAPET::Consts::ARGON2_SALT1_KEY, 0x71727374);
+        return p;
+    }
+
+    void addKeySlot() {
+        yapet::Key256 key{};
+        key.keyingParameters(dataKeyParameters());
+        key.password(passwordArray);
+        CPPUNIT_ASSERT(key.keySlot() == 0);
+
+        auto otherPasswordArray{yapet::toSecureArray("OtherPassword")};
+        CPPUNIT_ASSERT(key.addKeySlot(otherPasswordArray,
+                                      otherSlotParameters()) == 1);
+        CPPUNIT_ASSERT(key.keySlot() == 0);
+        CPPUNIT_ASSERT((key.keySlots() == std::vector<int>{0, 1}));
+        CPPUNIT_ASSERT(key.keySlotParameters(1).getValue(
+                           YAPET::Consts::ARGON2_SALT1_KEY) == 0x71727374);
+
+        yapet::Key256 unwrappedKey{};
+        unwrappedKey.keyingParameters(key.keyingParameters());
+        unwrappedKey.password(otherPasswordArray);
+        CPPUNIT_ASSERT(unwrappedKey.isDataKey());
+        CPPUNIT_ASSERT(unwrappedKey.keySlot() == 1);
+        CPPUNIT_ASSERT(unwrappedKey == key);
+
+        unwrappedKey.password(passwordArray);
+        CPPUNIT_ASSERT(unwrappedKey.keySlot() == 0);
+        CPPUNIT_ASSERT(unwrappedKey == key);
+
+        for (int i = 2; i < yapet::Key256::MAX_KEY_SLOTS; i++) {
+            key.addKeySlot(otherPasswordArray, otherSlotParameters());
+        }
+        CPPUNIT_ASSERT_THROW(
+            key.addKeySlot(otherPasswordArray, otherSlotParameters()),
+            std::runtime_error);
+    }
+
+    void removeKeySlot() {
+        yapet::Key256 key{};
+        key.keyingParameters(dataKeyParameters());
+        key.password(passwordArray);
+        CPPUNIT_ASSERT_THROW(key.removeKeySlot(0), std::logic_error);
+        CPPUNIT_ASSERT_THROW(key.removeKeySlot(1), std::invalid_argument);
+
+        auto otherPasswordArray{yapet::toSecureArray("OtherPassword")};
+        key.addKeySlot(otherPasswordArray, otherSlotParameters());
+        key.removeKeySlot(0);
+        CPPUNIT_ASSERT(key.keySlot() == -1);
+        CPPUNIT_ASSERT((key.keySlots() == std::vector<int>{1}));
+
+        yapet::Key256 unwrappedKey{};
+        unwrappedKey.keyingParameters(key.keyingParameters());
+        unwrappedKey.password(passwordArray);
+        CPPUNIT_ASSERT(!unwrappedKey.isDataKey());
+        CPPUNIT_ASSERT(unwrappedKey != key);
+
+        unwrappedKey.password(otherPasswordArray);
+        CPPUNIT_ASSERT(unwrappedKey == key);
+    }
+
+    void keySlotSize() {
+        yapet::Key256 key{};
+        key.keyingParameters(dataKeyParameters());
+        key.password(passwordArray);
+        auto size{key.keyingParameters().serialize().size()};
+
+        auto slot{key.addKeySlot(yapet::toSecureArray("OtherPassword"),
+                                 otherSlotParameters())};
+        CPPUNIT_ASSERT(key.keyingParameters().serialize().size() == size);
+
+        key.removeKeySlot(slot);
+        CPPUNIT_ASSERT(key.keyingParameters().serialize().size() == size);
+    }
+
+    void replaceKeySlot() {
+        yapet::Key256 key{};
+        key.keyingParameters(dataKeyParameters());
+        key.password(passwordArray);
+        auto otherPasswordArray{yapet::toSecureArray("OtherPassword")};
+        key.addKeySlot(otherPasswordArray, otherSlotParameters());
+
+        auto newPasswordArray{yapet::toSecureArray("NewPassword")};
+        key.keySlot(0, newPasswordArray, dataKeyParameters());
+
+        yapet::Key256 unwrappedKey{};
+        unwrappedKey.keyingParameters(key.keyingParameters());
+        unwrappedKey.password(passwordArray);
+        CPPUNIT_ASSERT(!unwrappedKey.isDataKey());
+
+        unwrappedKey.password(newPasswordArray);
+        CPPUNIT_ASSERT(unwrappedKey.keySlot() == 0);
+        CPPUNIT_ASSERT(unwrappedKey == key);
+
+        unwrappedKey.password(otherPasswordArray);
+        CPPUNIT_ASSERT(unwrappedKey.keySlot() == 1);
+        CPPUNIT_ASSERT(unwrappedKey == key);
+    }
+
+    void rotateDataKey() {
+        yapet::Key256 key{};
+        key.keyingParameters(dataKeyParameters());
+        key.password(passwordArray);
+        auto otherPasswordArray{yapet::toSecureArray("OtherPassword")};
+        key.addKeySlot(otherPasswordArray, otherSlotParameters());
+
+        yapet::Key256 rotatedKey{key};
+        rotatedKey.rotateDataKey(
+            {{0, passwordArray}, {1, otherPasswordArray}});
+        CPPUNIT_ASSERT(rotatedKey != key);
+        CPPUNIT_ASSERT(rotatedKey.keySlot() == 0);
+        CPPUNIT_ASSERT((rotatedKey.keySlots() == std::vector<int>{0, 1}));
+
+        yapet::Key256 unwrappedKey{};
+        unwrappedKey.keyingParameters(rotatedKey.keyingParameters());
+        unwrappedKey.password(passwordArray);
+        CPPUNIT_ASSERT(unwrappedKey.keySlot() == 0);
+        CPPUNIT_ASSERT(unwrappedKey == rotatedKey);
+
+        unwrappedKey.password(otherPasswordArray);
+        CPPUNIT_ASSERT(unwrappedKey.keySlot() == 1);
+        CPPUNIT_ASSERT(unwrappedKey == rotatedKey);
+    }
+
+    void rotateDataKeyInvalidPassword() {
+        yapet::Key256 key{};
+        key.keyingParameters(dataKeyParameters());
+        key.password(passwordArray);
+        auto otherPasswordArray{yapet::toSecureArray("OtherPassword")};
+        key.addKeySlot(otherPasswordArray, otherSlotParameters());
+
+        yapet::Key256 rotatedKey{key};
+        CPPUNIT_ASSERT_THROW(rotatedKey.rotateDataKey({{0, passwordArray}}),
+                             std::invalid_argument);
+        CPPUNIT_ASSERT_THROW(
+            rotatedKey.rotateDataKey(
+                {{0, passwordArray}, {1, yapet::toSecureArray("invalid")}}),
+            std::invalid_argument);
+        CPPUNIT_ASSERT(rotatedKey == key);
+        CPPUNIT_ASSERT(rotatedKey.keyingParameters().serialize() ==
+                       key.keyingParameters().serialize());
+    }
 };
 
 int main() {
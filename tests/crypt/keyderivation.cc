@@ -0,0 +1,203 @@
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include "aes256factory.hh"
+#include "keyderivation.hh"
+
+namespace {
+std::shared_ptr<yapet::AbstractCryptoFactory> deriveKey(
+    const char* password, const yapet::MetaData& keyingParameters =
+                              yapet::Key256::newDefaultKeyingParameters()) {
+    return std::shared_ptr<yapet::AbstractCryptoFactory>{
+        new yapet::Aes256Factory{yapet::toSecureArray(password),
+                                 keyingParameters}};
+}
+
+/**
+ * Wait until \c condition holds, for at most ten seconds.
+ */
+template <typename Condition>
+bool eventually(Condition condition) {
+    auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds{10};
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > deadline) return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    return true;
+}
+}  // namespace
+
+class KeyDerivationTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite* suite() {
+        CppUnit::TestSuite* suiteOfTests =
+            new CppUnit::TestSuite("Key Derivation Test");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<KeyDerivationTest>(
+            "should deliver results", &KeyDerivationTest::results));
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<KeyDerivationTest>(
+            "should deliver exceptions", &KeyDerivationTest::exceptions));
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<KeyDerivationTest>(
+            "should run jobs concurrently", &KeyDerivationTest::concurrent));
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<KeyDerivationTest>(
+            "should call notifier", &KeyDerivationTest::notifier));
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<KeyDerivationTest>(
+            "should not block when cancelled", &KeyDerivationTest::cancel));
+
+        return suiteOfTests;
+    }
+
+    void results() {
+        // Holds the data key wrapped using the first password
+        auto keyingParameters{deriveKey("first")->key()->keyingParameters()};
+        yapet::KeyDerivation derivation;
+        auto first = derivation.add([&keyingParameters]() {
+            return deriveKey("first", keyingParameters);
+        });
+        auto second = derivation.add([&keyingParameters]() {
+            return deriveKey("second", keyingParameters);
+        });
+
+        CPPUNIT_ASSERT_THROW(derivation.result(first), std::logic_error);
+
+        derivation.start();
+        derivation.wait();
+        CPPUNIT_ASSERT(derivation.finished());
+        CPPUNIT_ASSERT(!derivation.cancelled());
+
+        auto firstFactory{derivation.result(first)};
+        auto secondFactory{derivation.result(second)};
+        CPPUNIT_ASSERT(firstFactory);
+        CPPUNIT_ASSERT(secondFactory);
+        CPPUNIT_ASSERT(*firstFactory->key() ==
+                       *deriveKey("first", keyingParameters)->key());
+        CPPUNIT_ASSERT(*firstFactory->key() != *secondFactory->key());
+    }
+
+    void exceptions() {
+        yapet::KeyDerivation derivation;
+        auto failing = derivation.add(
+            []() -> std::shared_ptr<yapet::AbstractCryptoFactory> {
+                throw std::runtime_error{"failed"};
+            });
+        auto succeeding = derivation.add([]() { return deriveKey("test"); });
+
+        derivation.start();
+        derivation.wait();
+
+        CPPUNIT_ASSERT_THROW(derivation.result(failing), std::runtime_error);
+        CPPUNIT_ASSERT(derivation.result(succeeding));
+    }
+
+    void concurrent() {
+        std::atomic<int> running{0};
+        auto job = [&running]() {
+            running++;
+            // Can only succeed if the other job runs at the same time
+            if (!eventually([&running]() { return running == 2; })) {
+                throw std::runtime_error{"not concurrent"};
+            }
+            return deriveKey("test");
+        };
+
+        yapet::KeyDerivation derivation;
+        auto first = derivation.add(job);
+        auto second = derivation.add(job);
+        derivation.start();
+        derivation.wait();
+
+        CPPUNIT_ASSERT(derivation.result(first));
+        CPPUNIT_ASSERT(derivation.result(second));
+    }
+
+    void notifier() {
+        // Shared with the notifier thread, which may outlive this test
+        struct Calls {
+            std::atomic<int> running{0};
+            std::atomic<int> finished{0};
+            std::atomic<yapet::KeyDerivation*> derivation{nullptr};
+        };
+        auto calls = std::make_shared<Calls>();
+        std::atomic<bool> release{false};
+
+        auto notify = [calls]() {
+            auto derivation = calls->derivation.load();
+            if (derivation && derivation->finished()) {
+                calls->finished++;
+            } else {
+                calls->running++;
+            }
+        };
+
+        yapet::KeyDerivation derivation{notify, std::chrono::milliseconds{1}};
+        calls->derivation = &derivation;
+        derivation.add([&release]() {
+            eventually([&release]() { return release.load(); });
+            return deriveKey("test");
+        });
+        derivation.start();
+
+        // Called every tick while running
+        CPPUNIT_ASSERT(eventually([calls]() { return calls->running >= 3; }));
+        CPPUNIT_ASSERT(!derivation.finished());
+
+        release = true;
+        derivation.wait();
+        // Called once more when done
+        CPPUNIT_ASSERT(
+            eventually([calls]() { return calls->finished == 1; }));
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        CPPUNIT_ASSERT(calls->finished == 1);
+    }
+
+    void cancel() {
+        auto release = std::make_shared<std::atomic<bool>>(false);
+        auto done = std::make_shared<std::atomic<int>>(0);
+        auto job = [release, done]() {
+            eventually([release]() { return release->load(); });
+            auto cryptoFactory{deriveKey("test")};
+            (*done)++;
+            return cryptoFactory;
+        };
+
+        {
+            yapet::KeyDerivation derivation;
+            auto index = derivation.add(job);
+            derivation.start();
+
+            derivation.cancel();
+            derivation.wait();
+            CPPUNIT_ASSERT(derivation.cancelled());
+            CPPUNIT_ASSERT(!derivation.finished());
+            CPPUNIT_ASSERT_THROW(derivation.result(index), std::logic_error);
+
+            // Destroying a derivation still running does not block either
+            yapet::KeyDerivation running;
+            running.add(job);
+            running.start();
+        }
+
+        // Abandoned jobs still run to completion
+        release->store(true);
+        CPPUNIT_ASSERT(eventually([done]() { return *done == 2; }));
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(KeyDerivationTest::suite());
+    return runner.run() ? 0 : 1;
+}
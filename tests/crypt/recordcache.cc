@@ -0,0 +1,178 @@
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include "aes256factory.hh"
+#include "passwordlistitem.hh"
+#include "passwordrecord.hh"
+#include "recordcache.hh"
+
+class RecordCacheTest : public CppUnit::TestFixture {
+   private:
+    std::shared_ptr<yapet::AbstractCryptoFactory> cryptoFactory;
+    yapet::RecordCache::Clock::time_point start;
+
+    yapet::PasswordListItem makeItem(const std::string& name) {
+        yapet::PasswordRecord passwordRecord;
+        passwordRecord.name(name.c_str());
+        passwordRecord.password((name + " password").c_str());
+        auto crypto{cryptoFactory->crypto()};
+        return yapet::PasswordListItem{
+            name.c_str(), crypto->encrypt(passwordRecord.serialize())};
+    }
+
+    static bool hasName(const yapet::PasswordRecord& passwordRecord,
+                        const std::string& name) {
+        return std::strcmp(reinterpret_cast<const char*>(passwordRecord.name()),
+                           name.c_str()) == 0;
+    }
+
+   public:
+    static CppUnit::TestSuite* suite() {
+        CppUnit::TestSuite* suiteOfTests =
+            new CppUnit::TestSuite("Record Cache Test");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<RecordCacheTest>(
+            "should decrypt on miss and count hits",
+            &RecordCacheTest::hitAndMiss));
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<RecordCacheTest>(
+            "should evict least recently used record",
+            &RecordCacheTest::evictLeastRecentlyUsed));
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<RecordCacheTest>(
+            "should expire idle records", &RecordCacheTest::expire));
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<RecordCacheTest>(
+            "should expire idle records without lookup",
+            &RecordCacheTest::expireWithoutLookup));
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<RecordCacheTest>(
+            "should flush all records", &RecordCacheTest::flush));
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<RecordCacheTest>(
+            "should not cache with zero capacity",
+            &RecordCacheTest::zeroCapacity));
+
+        return suiteOfTests;
+    }
+
+    void setUp() {
+        auto password{yapet::toSecureArray("test")};
+        cryptoFactory = std::shared_ptr<yapet::AbstractCryptoFactory>{
+            new yapet::Aes256Factory{
+                password, yapet::Key256::newDefaultKeyingParameters()}};
+        start = yapet::RecordCache::Clock::now();
+    }
+
+    void hitAndMiss() {
+        yapet::RecordCache cache{2, std::chrono::seconds{60}};
+        auto item{makeItem("a")};
+
+        CPPUNIT_ASSERT(hasName(cache.get(item, cryptoFactory, start), "a"));
+        CPPUNIT_ASSERT(cache.misses() == 1);
+        CPPUNIT_ASSERT(cache.hits() == 0);
+
+        auto passwordRecord{cache.get(item, cryptoFactory, start)};
+        CPPUNIT_ASSERT(hasName(passwordRecord, "a"));
+        CPPUNIT_ASSERT(std::strcmp(reinterpret_cast<const char*>(
+                                       passwordRecord.password()),
+                                   "a password") == 0);
+        CPPUNIT_ASSERT(cache.misses() == 1);
+        CPPUNIT_ASSERT(cache.hits() == 1);
+        CPPUNIT_ASSERT(cache.size() == 1);
+    }
+
+    void evictLeastRecentlyUsed() {
+        yapet::RecordCache cache{2, std::chrono::seconds{60}};
+        auto a{makeItem("a")};
+        auto b{makeItem("b")};
+        auto c{makeItem("c")};
+
+        cache.get(a, cryptoFactory, start);
+        cache.get(b, cryptoFactory, start);
+        // makes b the least recently used
+        cache.get(a, cryptoFactory, start);
+        cache.get(c, cryptoFactory, start);
+        CPPUNIT_ASSERT(cache.size() == 2);
+        CPPUNIT_ASSERT(cache.misses() == 3);
+
+        cache.get(a, cryptoFactory, start);
+        cache.get(c, cryptoFactory, start);
+        CPPUNIT_ASSERT(cache.hits() == 3);
+
+        CPPUNIT_ASSERT(hasName(cache.get(b, cryptoFactory, start), "b"));
+        CPPUNIT_ASSERT(cache.misses() == 4);
+    }
+
+    void expire() {
+        yapet::RecordCache cache{2, std::chrono::seconds{60}};
+        auto a{makeItem("a")};
+        auto b{makeItem("b")};
+
+        cache.get(a, cryptoFactory, start);
+        cache.get(b, cryptoFactory, start + std::chrono::seconds{30});
+        cache.get(b, cryptoFactory, start + std::chrono::seconds{61});
+        CPPUNIT_ASSERT(cache.hits() == 1);
+        CPPUNIT_ASSERT(cache.size() == 1);
+
+        cache.get(a, cryptoFactory, start + std::chrono::seconds{62});
+        CPPUNIT_ASSERT(cache.misses() == 3);
+    }
+
+    void expireWithoutLookup() {
+        yapet::RecordCache cache{2, std::chrono::seconds{1}};
+        auto a{makeItem("a")};
+
+        cache.get(a, cryptoFactory);
+        CPPUNIT_ASSERT(cache.size() == 1);
+
+        auto deadline{yapet::RecordCache::Clock::now() +
+                      std::chrono::seconds{10}};
+        while (cache.size() > 0 &&
+               yapet::RecordCache::Clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{50});
+        }
+        CPPUNIT_ASSERT(cache.size() == 0);
+        CPPUNIT_ASSERT(yapet::RecordCache::Clock::now() - start >=
+                       std::chrono::seconds{1});
+        CPPUNIT_ASSERT(cache.misses() == 1);
+        CPPUNIT_ASSERT(cache.hits() == 0);
+    }
+
+    void flush() {
+        yapet::RecordCache cache{2, std::chrono::seconds{60}};
+        auto a{makeItem("a")};
+
+        cache.get(a, cryptoFactory, start);
+        cache.flush();
+        CPPUNIT_ASSERT(cache.size() == 0);
+
+        cache.get(a, cryptoFactory, start);
+        CPPUNIT_ASSERT(cache.misses() == 2);
+        CPPUNIT_ASSERT(cache.hits() == 0);
+    }
+
+    void zeroCapacity() {
+        yapet::RecordCache cache{0, std::chrono::seconds{60}};
+        auto a{makeItem("a")};
+
+        CPPUNIT_ASSERT(hasName(cache.get(a, cryptoFactory, start), "a"));
+        CPPUNIT_ASSERT(hasName(cache.get(a, cryptoFactory, start), "a"));
+        CPPUNIT_ASSERT(cache.size() == 0);
+        CPPUNIT_ASSERT(cache.misses() == 2);
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(RecordCacheTest::suite());
+    return runner.run() ? 0 : 1;
+}
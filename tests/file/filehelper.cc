@@ -17,6 +17,7 @@
 #include "yapet20file.hh"
 
 constexpr auto TEST_FILE{BUILDDIR "/yapet-filehelper-test"};
+constexpr auto TEST_HEADER_FILE{BUILDDIR "/yapet-filehelper-test.hdr"};
 
 class FileHelperTest : public CppUnit::TestFixture {
    public:
@@ -52,6 +53,16 @@ class FileHelperTest : public CppUnit::TestFixture {
             "should read YAPET 2.0 meta data",
             &FileHelperTest::readYapet20MetaData});
 
+        suiteOfTests->addTest(new CppUnit::TestCaller<FileHelperTest>{
+            "should rewrite header in place",
+            &FileHelperTest::rewriteHeaderInPlace});
+        suiteOfTests->addTest(new CppUnit::TestCaller<FileHelperTest>{
+            "should not rewrite header of different size in place",
+            &FileHelperTest::rewriteHeaderOfDifferentSize});
+        suiteOfTests->addTest(new CppUnit::TestCaller<FileHelperTest>{
+            "should recover header from side file",
+            &FileHelperTest::recoverHeader});
+
         return suiteOfTests;
     }
 
@@ -71,9 +82,37 @@ class FileHelperTest : public CppUnit::TestFixture {
         ::close(fd);
     }
 
-    void setUp() { ::unlink(TEST_FILE); }
+    void setUp() {
+        ::unlink(TEST_FILE);
+        ::unlink(TEST_HEADER_FILE);
+    }
+
+    void tearDown() {
+        ::unlink(TEST_FILE);
+        ::unlink(TEST_HEADER_FILE);
+    }
+
+    void makeYapet20File(const char *filename, const char *metaData,
+                         const char *header) {
+        yapet::Yapet20File file{filename, true, false};
+        file.open();
+        file.writeIdentifier();
+        file.writeUnencryptedMetaData(yapet::toSecureArray(metaData));
+        file.writeHeader(yapet::toSecureArray(header));
+        file.writePasswordRecord(yapet::toSecureArray("Record"));
+    }
 
-    void tearDown() { ::unlink(TEST_FILE); }
+    void assertYapet20File(const char *metaData, const char *header) {
+        yapet::Yapet20File file{TEST_FILE, false, false};
+        file.open();
+        CPPUNIT_ASSERT(file.readUnencryptedMetaData() ==
+                       yapet::toSecureArray(metaData));
+        CPPUNIT_ASSERT(file.readHeader() == yapet::toSecureArray(header));
+
+        auto records{file.readPasswordRecords()};
+        CPPUNIT_ASSERT(records.size() == 1);
+        CPPUNIT_ASSERT(records.front() == yapet::toSecureArray("Record"));
+    }
 
     void readEmptyFile() {
         createEmptyFile();
@@ -223,6 +262,46 @@ class FileHelperTest : public CppUnit::TestFixture {
         CPPUNIT_ASSERT(actual.getValue("a") == metaData.getValue("a"));
         CPPUNIT_ASSERT(actual.getValue("b") == metaData.getValue("b"));
     }
+
+    void rewriteHeaderInPlace() {
+        makeYapet20File(TEST_FILE, "MetaData", "Header");
+        struct stat before;
+        ::stat(TEST_FILE, &before);
+
+        CPPUNIT_ASSERT(yapet::rewriteHeaderInPlace(
+            TEST_FILE, yapet::toSecureArray("AtadAtem"),
+            yapet::toSecureArray("Redaeh")));
+
+        struct stat after;
+        ::stat(TEST_FILE, &after);
+        CPPUNIT_ASSERT(before.st_ino == after.st_ino);
+        CPPUNIT_ASSERT(::access(TEST_HEADER_FILE, F_OK) != 0);
+        assertYapet20File("AtadAtem", "Redaeh");
+    }
+
+    void rewriteHeaderOfDifferentSize() {
+        makeYapet20File(TEST_FILE, "MetaData", "Header");
+
+        CPPUNIT_ASSERT(!yapet::rewriteHeaderInPlace(
+            TEST_FILE, yapet::toSecureArray("Meta"),
+            yapet::toSecureArray("Redaeh")));
+        CPPUNIT_ASSERT(!yapet::rewriteHeaderInPlace(
+            TEST_FILE, yapet::toSecureArray("AtadAtem"),
+            yapet::toSecureArray("Head")));
+
+        CPPUNIT_ASSERT(::access(TEST_HEADER_FILE, F_OK) != 0);
+        assertYapet20File("MetaData", "Header");
+    }
+
+    void recoverHeader() {
+        makeYapet20File(TEST_FILE, "MetaData", "Header");
+        makeYapet20File(TEST_HEADER_FILE, "AtadAtem", "Redaeh");
+
+        yapet::recoverHeader(TEST_FILE);
+
+        CPPUNIT_ASSERT(::access(TEST_HEADER_FILE, F_OK) != 0);
+        assertYapet20File("AtadAtem", "Redaeh");
+    }
 };
 
 int main() {
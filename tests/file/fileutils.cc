@@ -48,6 +48,11 @@ class FileUtilsTest : public CppUnit::TestFixture {
         suiteOfTests->addTest(new CppUnit::TestCaller<FileUtilsTest>{
             "getFileSize should throw on non-existing file",
             &FileUtilsTest::getFileSizeNonExisting});
+        suiteOfTests->addTest(new CppUnit::TestCaller<FileUtilsTest>{
+            "should sync directory of file", &FileUtilsTest::syncDirectory});
+        suiteOfTests->addTest(new CppUnit::TestCaller<FileUtilsTest>{
+            "syncDirectory should throw on non-existing directory",
+            &FileUtilsTest::syncDirectoryNonExisting});
 
         return suiteOfTests;
     }
@@ -162,6 +167,19 @@ class FileUtilsTest : public CppUnit::TestFixture {
         CPPUNIT_ASSERT_THROW(yapet::getFileSize("must-not-exist"),
                              yapet::FileError);
     }
+
+    void syncDirectory() {
+        createFile();
+
+        yapet::syncDirectory(TEST_FILE);
+        yapet::syncDirectory("relative-file");
+        yapet::syncDirectory("/file-in-root");
+    }
+
+    void syncDirectoryNonExisting() {
+        CPPUNIT_ASSERT_THROW(yapet::syncDirectory("must-not-exist/file"),
+                             yapet::FileError);
+    }
 };
 
 int main() {
@@ -59,6 +59,18 @@ class YapetFileMock : public yapet::YapetFile {
         throw std::runtime_error("Not implemented");
     }
 
+    void beginPasswordRecords() {
+        throw std::runtime_error("Not implemented");
+    }
+
+    void writePasswordRecord(const yapet::SecureArray&) {
+        throw std::runtime_error("Not implemented");
+    }
+
+    void endPasswordRecords() {
+        throw std::runtime_error("Not implemented");
+    }
+
     const std::uint8_t* recognitionString() const {
         throw std::runtime_error("Not implemented");
     }
@@ -0,0 +1,141 @@
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "aes256factory.hh"
+#include "passwordrecord.hh"
+#include "recordlookup.hh"
+
+constexpr auto TEST_PASSWORD{"Secret"};
+// Enough records to spread the lookup over several worker threads
+constexpr auto ROUNDS{2000};
+
+class LookupTest : public CppUnit::TestFixture {
+   private:
+    std::shared_ptr<yapet::AbstractCryptoFactory> _cryptoFactory;
+    std::vector<yapet::SecureArray> _records;
+
+    yapet::SecureArray encryptedRecord(const std::string& name,
+                                       const std::string& password) {
+        yapet::PasswordRecord record;
+        record.name(name.c_str());
+        record.host("host");
+        record.username("user");
+        record.password(password.c_str());
+        record.comment("comment");
+
+        return _cryptoFactory->crypto()->encrypt(record.serialize());
+    }
+
+   public:
+    static CppUnit::TestSuite* suite() {
+        CppUnit::TestSuite* suiteOfTests = new CppUnit::TestSuite("Lookup");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<LookupTest>(
+            "should find record by name", &LookupTest::exactName));
+        suiteOfTests->addTest(new CppUnit::TestCaller<LookupTest>(
+            "should find records by wildcard pattern",
+            &LookupTest::wildcards));
+        suiteOfTests->addTest(new CppUnit::TestCaller<LookupTest>(
+            "should find nothing if no name matches", &LookupTest::noMatch));
+        suiteOfTests->addTest(new CppUnit::TestCaller<LookupTest>(
+            "should find names filling the entire field",
+            &LookupTest::longName));
+        suiteOfTests->addTest(new CppUnit::TestCaller<LookupTest>(
+            "should decrypt names", &LookupTest::names));
+
+        return suiteOfTests;
+    }
+
+    void setUp() {
+        _cryptoFactory.reset(new yapet::Aes256Factory{
+            yapet::toSecureArray(TEST_PASSWORD),
+            yapet::Key256::newDefaultKeyingParameters()});
+
+        _records.clear();
+        for (int i = 0; i < ROUNDS; i++) {
+            auto suffix{std::to_string(i)};
+            _records.push_back(
+                encryptedRecord("name " + suffix, "password " + suffix));
+        }
+    }
+
+    void tearDown() { _cryptoFactory.reset(); }
+
+    void exactName() {
+        yapet::RecordLookup lookup{_cryptoFactory};
+        auto found{lookup.find(_records, "name 1234")};
+
+        CPPUNIT_ASSERT(found.size() == 1);
+        CPPUNIT_ASSERT(found[0] == 1234);
+
+        auto record{lookup.decrypt(_records[found[0]])};
+        CPPUNIT_ASSERT(std::string{reinterpret_cast<const char*>(
+                           record.password())} == "password 1234");
+    }
+
+    void wildcards() {
+        yapet::RecordLookup lookup{_cryptoFactory};
+
+        auto found{lookup.find(_records, "name 199?")};
+        std::vector<std::size_t> expected{1990, 1991, 1992, 1993, 1994,
+                                          1995, 1996, 1997, 1998, 1999};
+        CPPUNIT_ASSERT(found == expected);
+
+        found = lookup.find(_records, "*");
+        CPPUNIT_ASSERT(found.size() == ROUNDS);
+        CPPUNIT_ASSERT(found.back() == ROUNDS - 1);
+
+        found = lookup.find(_records, "name [12]");
+        expected = {1, 2};
+        CPPUNIT_ASSERT(found == expected);
+    }
+
+    void noMatch() {
+        yapet::RecordLookup lookup{_cryptoFactory};
+
+        CPPUNIT_ASSERT(lookup.find(_records, "name").empty());
+        CPPUNIT_ASSERT(lookup.find(_records, "NAME 1").empty());
+        CPPUNIT_ASSERT(
+            lookup.find(std::vector<yapet::SecureArray>{}, "*").empty());
+    }
+
+    void longName() {
+        std::string name(yapet::PasswordRecord::NAME_SIZE - 1, 'x');
+        _records.push_back(encryptedRecord(name, "long"));
+
+        yapet::RecordLookup lookup{_cryptoFactory};
+        auto found{lookup.find(_records, name)};
+        CPPUNIT_ASSERT(found.size() == 1);
+        CPPUNIT_ASSERT(found[0] == ROUNDS);
+    }
+
+    void names() {
+        std::string name(yapet::PasswordRecord::NAME_SIZE - 1, 'x');
+        _records.push_back(encryptedRecord(name, "long"));
+
+        yapet::RecordLookup lookup{_cryptoFactory};
+        auto names{lookup.names(_records)};
+        CPPUNIT_ASSERT(names.size() == ROUNDS + 1);
+        CPPUNIT_ASSERT(std::string{reinterpret_cast<const char*>(
+                           *names[1234])} == "name 1234");
+        CPPUNIT_ASSERT(std::string{reinterpret_cast<const char*>(
+                           *names[ROUNDS])} == name);
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(LookupTest::suite());
+    return runner.run() ? 0 : 1;
+}
@@ -0,0 +1,167 @@
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "recorddelta.hh"
+
+// Enough records to spread the fingerprint over several worker threads
+constexpr auto ROUNDS{2000};
+
+using yapet::merge::DeltaError;
+using yapet::merge::FileImage;
+using yapet::merge::RecordDelta;
+
+class DeltaTest : public CppUnit::TestFixture {
+   private:
+    FileImage _base;
+
+    static yapet::SecureArray record(const std::string& content) {
+        return yapet::toSecureArray(content.c_str());
+    }
+
+    static RecordDelta roundTrip(const RecordDelta& delta) {
+        std::stringstream stream;
+        delta.write(stream);
+        return RecordDelta::read(stream);
+    }
+
+   public:
+    static CppUnit::TestSuite* suite() {
+        CppUnit::TestSuite* suiteOfTests = new CppUnit::TestSuite("Delta");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<DeltaTest>(
+            "should copy unchanged files in one operation",
+            &DeltaTest::unchanged));
+        suiteOfTests->addTest(new CppUnit::TestCaller<DeltaTest>(
+            "should carry changed records only", &DeltaTest::changes));
+        suiteOfTests->addTest(new CppUnit::TestCaller<DeltaTest>(
+            "should reproduce moved records", &DeltaTest::moved));
+        suiteOfTests->addTest(new CppUnit::TestCaller<DeltaTest>(
+            "should refuse files using different keys",
+            &DeltaTest::differentKeys));
+        suiteOfTests->addTest(new CppUnit::TestCaller<DeltaTest>(
+            "should refuse to apply to another file",
+            &DeltaTest::wrongBase));
+        suiteOfTests->addTest(new CppUnit::TestCaller<DeltaTest>(
+            "should reject malformed deltas", &DeltaTest::malformed));
+
+        return suiteOfTests;
+    }
+
+    void setUp() {
+        _base.identifier = record("identifier");
+        _base.metaData = record("meta data");
+        _base.header = record("header");
+        _base.records.clear();
+        for (int i = 0; i < ROUNDS; i++) {
+            _base.records.push_back(record("record " + std::to_string(i)));
+        }
+    }
+
+    void unchanged() {
+        RecordDelta delta{_base, _base};
+        CPPUNIT_ASSERT(delta.operations().size() == 1);
+        CPPUNIT_ASSERT(delta.inserted() == 0);
+        CPPUNIT_ASSERT(delta.deleted() == 0);
+
+        auto applied{roundTrip(delta).apply(_base)};
+        CPPUNIT_ASSERT(applied == _base.records);
+    }
+
+    void changes() {
+        auto changed{_base};
+        changed.records[10] = record("changed");
+        changed.records.erase(changed.records.begin() + 20);
+        changed.records.push_back(record("added"));
+
+        RecordDelta delta{_base, changed};
+        CPPUNIT_ASSERT(delta.inserted() == 2);
+        CPPUNIT_ASSERT(delta.deleted() == 2);
+        // Copy, insert, copy, copy, insert
+        CPPUNIT_ASSERT(delta.operations().size() == 5);
+
+        std::stringstream stream;
+        delta.write(stream);
+        // Unchanged records do not contribute to the size of the delta
+        CPPUNIT_ASSERT(stream.str().size() < 256);
+
+        auto applied{RecordDelta::read(stream).apply(_base)};
+        CPPUNIT_ASSERT(applied == changed.records);
+    }
+
+    void moved() {
+        auto changed{_base};
+        std::swap(changed.records.front(), changed.records.back());
+
+        RecordDelta delta{_base, changed};
+        CPPUNIT_ASSERT(delta.inserted() == 0);
+        CPPUNIT_ASSERT(delta.deleted() == 0);
+        CPPUNIT_ASSERT(delta.operations().size() == 3);
+
+        auto applied{roundTrip(delta).apply(_base)};
+        CPPUNIT_ASSERT(applied == changed.records);
+    }
+
+    void differentKeys() {
+        auto other{_base};
+        other.metaData = record("other meta data");
+        CPPUNIT_ASSERT_THROW((RecordDelta{_base, other}), DeltaError);
+
+        other = _base;
+        other.header = record("other header");
+        CPPUNIT_ASSERT_THROW((RecordDelta{_base, other}), DeltaError);
+    }
+
+    void wrongBase() {
+        auto changed{_base};
+        changed.records[0] = record("changed");
+        RecordDelta delta{_base, changed};
+
+        CPPUNIT_ASSERT_THROW(delta.apply(changed), DeltaError);
+
+        auto other{_base};
+        other.records[1] = record("other");
+        CPPUNIT_ASSERT_THROW(delta.apply(other), DeltaError);
+    }
+
+    void malformed() {
+        std::stringstream empty;
+        CPPUNIT_ASSERT_THROW(RecordDelta::read(empty), DeltaError);
+
+        std::stringstream notADelta{"YAPET1.0 and then some"};
+        CPPUNIT_ASSERT_THROW(RecordDelta::read(notADelta), DeltaError);
+
+        auto changed{_base};
+        changed.records[5] = record("changed");
+        std::stringstream stream;
+        RecordDelta{_base, changed}.write(stream);
+        auto serialized{stream.str()};
+
+        std::stringstream truncated{
+            serialized.substr(0, serialized.size() - 1)};
+        CPPUNIT_ASSERT_THROW(RecordDelta::read(truncated), DeltaError);
+
+        // The first operation copies the first five records. Let it copy
+        // past the end by setting the most significant byte of its count.
+        auto outOfRange{serialized};
+        outOfRange[8 + 4 + 32 + 32 + 4 + 4 + 1 + 4] = '\x7f';
+        std::stringstream outOfRangeStream{outOfRange};
+        CPPUNIT_ASSERT_THROW(RecordDelta::read(outOfRangeStream), DeltaError);
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(DeltaTest::suite());
+    return runner.run() ? 0 : 1;
+}
@@ -0,0 +1,284 @@
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "aes256factory.hh"
+#include "passwordrecord.hh"
+#include "recordmerge.hh"
+
+constexpr auto TEST_PASSWORD{"Secret"};
+// Enough records to spread the merge over several worker threads
+constexpr auto ROUNDS{2000};
+
+using yapet::merge::RecordMerge;
+
+class MergeTest : public CppUnit::TestFixture {
+   private:
+    std::shared_ptr<yapet::AbstractCryptoFactory> _cryptoFactory;
+    std::vector<yapet::SecureArray> _base;
+
+    yapet::SecureArray encryptedRecord(const std::string& name,
+                                       const std::string& password,
+                                       const char* tags = "") {
+        yapet::PasswordRecord record;
+        record.name(name.c_str());
+        record.host("host");
+        record.username("user");
+        record.password(password.c_str());
+        record.comment("comment");
+        record.tags(tags);
+
+        return _cryptoFactory->crypto()->encrypt(record.serialize());
+    }
+
+    std::vector<yapet::PasswordRecord> decrypt(
+        const std::vector<yapet::SecureArray>& records,
+        const std::shared_ptr<yapet::AbstractCryptoFactory>& cryptoFactory) {
+        auto crypto{cryptoFactory->crypto()};
+        std::vector<yapet::PasswordRecord> result;
+        for (const auto& record : records) {
+            result.emplace_back(crypto->decrypt(record));
+        }
+        return result;
+    }
+
+    static std::string str(const std::uint8_t* field) {
+        return reinterpret_cast<const char*>(field);
+    }
+
+    static std::string name(std::size_t i) {
+        return "name " + std::to_string(i);
+    }
+
+    static std::string password(std::size_t i) {
+        return "password " + std::to_string(i);
+    }
+
+   public:
+    static CppUnit::TestSuite* suite() {
+        CppUnit::TestSuite* suiteOfTests = new CppUnit::TestSuite("Merge");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<MergeTest>(
+            "should not decrypt unchanged records", &MergeTest::unchanged));
+        suiteOfTests->addTest(new CppUnit::TestCaller<MergeTest>(
+            "should merge changes made on one side",
+            &MergeTest::oneSidedChanges));
+        suiteOfTests->addTest(new CppUnit::TestCaller<MergeTest>(
+            "should add conflict records for conflicting changes",
+            &MergeTest::conflictingChanges));
+        suiteOfTests->addTest(new CppUnit::TestCaller<MergeTest>(
+            "should accept identical changes on both sides",
+            &MergeTest::identicalChanges));
+        suiteOfTests->addTest(new CppUnit::TestCaller<MergeTest>(
+            "should keep records deleted on one side and changed on the other",
+            &MergeTest::deletedAndChanged));
+        suiteOfTests->addTest(new CppUnit::TestCaller<MergeTest>(
+            "should merge records added on both sides",
+            &MergeTest::addedOnBothSides));
+        suiteOfTests->addTest(new CppUnit::TestCaller<MergeTest>(
+            "should match re-encrypted records by name and host",
+            &MergeTest::reencrypted));
+        suiteOfTests->addTest(new CppUnit::TestCaller<MergeTest>(
+            "should re-encrypt records from files using another key",
+            &MergeTest::differentKeys));
+
+        return suiteOfTests;
+    }
+
+    void setUp() {
+        _cryptoFactory.reset(new yapet::Aes256Factory{
+            yapet::toSecureArray(TEST_PASSWORD),
+            yapet::Key256::newDefaultKeyingParameters()});
+
+        _base.clear();
+        for (std::size_t i = 0; i < ROUNDS; i++) {
+            _base.push_back(encryptedRecord(name(i), password(i)));
+        }
+    }
+
+    void tearDown() { _cryptoFactory.reset(); }
+
+    void unchanged() {
+        RecordMerge merge{_cryptoFactory, _cryptoFactory, _cryptoFactory};
+        auto report{merge.merge(_base, _base, _base)};
+
+        CPPUNIT_ASSERT(report.records == _base);
+        CPPUNIT_ASSERT(report.decrypted == 0);
+        CPPUNIT_ASSERT(report.added == 0);
+        CPPUNIT_ASSERT(report.changed == 0);
+        CPPUNIT_ASSERT(report.deleted == 0);
+        CPPUNIT_ASSERT(!report.hasConflicts());
+    }
+
+    void oneSidedChanges() {
+        auto ours{_base};
+        ours[3] = encryptedRecord(name(3), "our password");
+
+        auto theirs{_base};
+        theirs[1] = encryptedRecord(name(1), "their password");
+        theirs.erase(theirs.begin() + 2);
+        theirs.push_back(encryptedRecord("added", "added password"));
+
+        RecordMerge merge{_cryptoFactory, _cryptoFactory, _cryptoFactory};
+        auto report{merge.merge(_base, ours, theirs)};
+
+        CPPUNIT_ASSERT(!report.hasConflicts());
+        CPPUNIT_ASSERT(report.added == 1);
+        CPPUNIT_ASSERT(report.changed == 1);
+        CPPUNIT_ASSERT(report.deleted == 1);
+        // The base records 1, 2 and 3, and the changed and added records
+        CPPUNIT_ASSERT(report.decrypted == 6);
+
+        CPPUNIT_ASSERT(report.records.size() == ROUNDS);
+        CPPUNIT_ASSERT(report.records[0] == _base[0]);
+        CPPUNIT_ASSERT(report.records[1] == theirs[1]);
+        CPPUNIT_ASSERT(report.records[2] == ours[3]);
+        CPPUNIT_ASSERT(report.records[3] == _base[4]);
+        CPPUNIT_ASSERT(report.records[ROUNDS - 1] == theirs.back());
+    }
+
+    void conflictingChanges() {
+        auto ours{_base};
+        ours[5] = encryptedRecord(name(5), "our password");
+        auto theirs{_base};
+        theirs[5] = encryptedRecord(name(5), "their password", "work");
+
+        RecordMerge merge{_cryptoFactory, _cryptoFactory, _cryptoFactory};
+        auto report{merge.merge(_base, ours, theirs)};
+
+        CPPUNIT_ASSERT(report.conflicts.size() == 1);
+        CPPUNIT_ASSERT(report.conflicts[0] == name(5) + " (conflict)");
+        CPPUNIT_ASSERT(report.records.size() == ROUNDS + 1);
+        CPPUNIT_ASSERT(report.records[5] == ours[5]);
+
+        auto records{decrypt(report.records, _cryptoFactory)};
+        CPPUNIT_ASSERT(str(records[6].name()) == name(5) + " (conflict)");
+        CPPUNIT_ASSERT(str(records[6].password()) == "their password");
+        CPPUNIT_ASSERT(str(records[6].tags()) == "work,conflict");
+        CPPUNIT_ASSERT(str(records[7].name()) == name(6));
+    }
+
+    void identicalChanges() {
+        auto ours{_base};
+        ours[5] = encryptedRecord(name(5), "new password");
+        auto theirs{_base};
+        theirs[5] = encryptedRecord(name(5), "new password");
+
+        RecordMerge merge{_cryptoFactory, _cryptoFactory, _cryptoFactory};
+        auto report{merge.merge(_base, ours, theirs)};
+
+        CPPUNIT_ASSERT(!report.hasConflicts());
+        CPPUNIT_ASSERT(report.records.size() == ROUNDS);
+        CPPUNIT_ASSERT(report.records[5] == ours[5]);
+    }
+
+    void deletedAndChanged() {
+        auto ours{_base};
+        ours[5] = encryptedRecord(name(5), "our password");
+        ours.erase(ours.begin() + 7);
+        auto theirs{_base};
+        theirs[7] = encryptedRecord(name(7), "their password");
+        theirs.erase(theirs.begin() + 5);
+
+        RecordMerge merge{_cryptoFactory, _cryptoFactory, _cryptoFactory};
+        auto report{merge.merge(_base, ours, theirs)};
+
+        CPPUNIT_ASSERT(report.conflicts.size() == 2);
+        CPPUNIT_ASSERT(report.records.size() == ROUNDS);
+
+        auto records{decrypt(report.records, _cryptoFactory)};
+        CPPUNIT_ASSERT(str(records[5].name()) == name(5));
+        CPPUNIT_ASSERT(str(records[5].password()) == "our password");
+        CPPUNIT_ASSERT(str(records[5].tags()) == "conflict");
+        CPPUNIT_ASSERT(str(records[6].name()) == name(6));
+        CPPUNIT_ASSERT(str(records[7].name()) == name(8));
+        CPPUNIT_ASSERT(str(records[ROUNDS - 1].name()) == name(7));
+        CPPUNIT_ASSERT(str(records[ROUNDS - 1].password()) ==
+                       "their password");
+        CPPUNIT_ASSERT(str(records[ROUNDS - 1].tags()) == "conflict");
+    }
+
+    void addedOnBothSides() {
+        auto ours{_base};
+        ours.push_back(encryptedRecord("same", "same password"));
+        ours.push_back(encryptedRecord("different", "our password"));
+        auto theirs{_base};
+        theirs.push_back(encryptedRecord("different", "their password"));
+        theirs.push_back(encryptedRecord("same", "same password"));
+
+        RecordMerge merge{_cryptoFactory, _cryptoFactory, _cryptoFactory};
+        auto report{merge.merge(_base, ours, theirs)};
+
+        CPPUNIT_ASSERT(report.added == 0);
+        CPPUNIT_ASSERT(report.conflicts.size() == 1);
+        CPPUNIT_ASSERT(report.records.size() == ROUNDS + 3);
+
+        auto records{decrypt(report.records, _cryptoFactory)};
+        CPPUNIT_ASSERT(str(records[ROUNDS].name()) == "same");
+        CPPUNIT_ASSERT(str(records[ROUNDS + 1].name()) == "different");
+        CPPUNIT_ASSERT(str(records[ROUNDS + 2].name()) ==
+                       "different (conflict)");
+        CPPUNIT_ASSERT(str(records[ROUNDS + 2].password()) ==
+                       "their password");
+    }
+
+    void reencrypted() {
+        std::vector<yapet::SecureArray> ours;
+        for (std::size_t i = 0; i < ROUNDS; i++) {
+            ours.push_back(encryptedRecord(name(i), password(i)));
+        }
+        auto theirs{_base};
+        theirs[9] = encryptedRecord(name(9), "their password");
+
+        RecordMerge merge{_cryptoFactory, _cryptoFactory, _cryptoFactory};
+        auto report{merge.merge(_base, ours, theirs)};
+
+        CPPUNIT_ASSERT(!report.hasConflicts());
+        CPPUNIT_ASSERT(report.changed == 1);
+        CPPUNIT_ASSERT(report.records.size() == ROUNDS);
+        CPPUNIT_ASSERT(report.records[0] == ours[0]);
+        CPPUNIT_ASSERT(report.records[9] == theirs[9]);
+    }
+
+    void differentKeys() {
+        std::shared_ptr<yapet::AbstractCryptoFactory> theirCryptoFactory{
+            new yapet::Aes256Factory{
+                yapet::toSecureArray("Other Secret"),
+                yapet::Key256::newDefaultKeyingParameters()}};
+        auto theirCrypto{theirCryptoFactory->crypto()};
+
+        auto ours{_base};
+        auto theirs{_base};
+        yapet::PasswordRecord record;
+        record.name("added");
+        record.password("added password");
+        theirs.push_back(theirCrypto->encrypt(record.serialize()));
+
+        RecordMerge merge{_cryptoFactory, _cryptoFactory, theirCryptoFactory};
+        auto report{merge.merge(_base, ours, theirs)};
+
+        CPPUNIT_ASSERT(report.added == 1);
+        CPPUNIT_ASSERT(report.records.size() == ROUNDS + 1);
+
+        auto records{decrypt(report.records, _cryptoFactory)};
+        CPPUNIT_ASSERT(str(records[ROUNDS].name()) == "added");
+        CPPUNIT_ASSERT(str(records[ROUNDS].password()) == "added password");
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(MergeTest::suite());
+    return runner.run() ? 0 : 1;
+}
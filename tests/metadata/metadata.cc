@@ -22,6 +22,9 @@ class MetaDataTest : public CppUnit::TestFixture {
             "should throw on non-existing key",
             &MetaDataTest::throwOnNonExistingKey));
 
+        suiteOfTests->addTest(new CppUnit::TestCaller<MetaDataTest>(
+            "should tell whether key exists", &MetaDataTest::hasValue));
+
         suiteOfTests->addTest(new CppUnit::TestCaller<MetaDataTest>(
             "should deserialize empty SecureArray",
             &MetaDataTest::serializeEmptySecureArray));
@@ -58,6 +61,15 @@ class MetaDataTest : public CppUnit::TestFixture {
                              std::out_of_range);
     }
 
+    void hasValue() {
+        yapet::MetaData metaData;
+        CPPUNIT_ASSERT(!metaData.hasValue("test"));
+
+        metaData.setValue("test", 0);
+        CPPUNIT_ASSERT(metaData.hasValue("test"));
+        CPPUNIT_ASSERT(!metaData.hasValue("non-existing"));
+    }
+
     void serializeEmptySecureArray() {
         yapet::MetaData metaData{yapet::SecureArray{}};
     }
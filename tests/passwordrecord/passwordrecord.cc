@@ -61,6 +61,10 @@ class PasswordRecordTest : public CppUnit::TestFixture {
             "serialize and deserialize",
             &PasswordRecordTest::serializeAndDeserialize));
 
+        suiteOfTests->addTest(new CppUnit::TestCaller<PasswordRecordTest>(
+            "serialize and deserialize tags",
+            &PasswordRecordTest::serializeAndDeserializeTags));
+
         suiteOfTests->addTest(new CppUnit::TestCaller<PasswordRecordTest>(
             "deserialize non-matching size",
             &PasswordRecordTest::deserializeNonMatchingSize));
@@ -145,6 +149,32 @@ class PasswordRecordTest : public CppUnit::TestFixture {
                                    COMMENT_LEN) == 0);
     }
 
+    void serializeAndDeserializeTags() {
+        yapet::PasswordRecord passwordRecord{makeTestPasswordRecordFromChar()};
+        CPPUNIT_ASSERT(passwordRecord.tags()[0] == '\0');
+
+        passwordRecord.tags("team,prod");
+        auto serialized = passwordRecord.serialize();
+        CPPUNIT_ASSERT(serialized.size() ==
+                       yapet::PasswordRecord::TAGGED_TOTAL_SIZE);
+
+        yapet::PasswordRecord fromSerialized{serialized};
+        CPPUNIT_ASSERT(std::strcmp(reinterpret_cast<const char *>(
+                                       fromSerialized.tags()),
+                                   "team,prod") == 0);
+        CPPUNIT_ASSERT(std::memcmp(fromSerialized.comment(), COMMENT_CHAR,
+                                   COMMENT_LEN) == 0);
+
+        yapet::PasswordRecord copy{fromSerialized};
+        CPPUNIT_ASSERT(std::strcmp(reinterpret_cast<const char *>(copy.tags()),
+                                   "team,prod") == 0);
+
+        // Removing the tags yields a record readable by older versions
+        copy.tags("");
+        CPPUNIT_ASSERT(copy.serialize().size() ==
+                       yapet::PasswordRecord::TOTAL_SIZE);
+    }
+
     void deserializeNonMatchingSize() {
         yapet::SecureArray tooSmall{yapet::PasswordRecord::TOTAL_SIZE - 1};
         CPPUNIT_ASSERT_THROW(yapet::PasswordRecord{tooSmall},
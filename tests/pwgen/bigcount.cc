@@ -0,0 +1,109 @@
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <cmath>
+
+#include "bigcount.hh"
+
+using namespace yapet::pwgen;
+
+namespace {
+BigCount power(std::uint32_t base, int exponent) {
+    BigCount result{1};
+    for (int i = 0; i < exponent; i++) result *= base;
+    return result;
+}
+}  // namespace
+
+class BigCountTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite *suite() {
+        CppUnit::TestSuite *suiteOfTests =
+            new CppUnit::TestSuite("BigCount Test");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<BigCountTest>{
+            "should add and subtract", &BigCountTest::addSubtract});
+        suiteOfTests->addTest(new CppUnit::TestCaller<BigCountTest>{
+            "should multiply", &BigCountTest::multiply});
+        suiteOfTests->addTest(new CppUnit::TestCaller<BigCountTest>{
+            "should compare", &BigCountTest::compare});
+        suiteOfTests->addTest(new CppUnit::TestCaller<BigCountTest>{
+            "should compute logarithm", &BigCountTest::log2});
+        suiteOfTests->addTest(new CppUnit::TestCaller<BigCountTest>{
+            "should draw uniform numbers", &BigCountTest::uniform});
+
+        return suiteOfTests;
+    }
+
+    void addSubtract() {
+        BigCount a{0xffffffff};
+        a += BigCount{1};
+        CPPUNIT_ASSERT(a.toString() == "4294967296");
+        CPPUNIT_ASSERT(a.bitLength() == 33);
+
+        a -= BigCount{1};
+        CPPUNIT_ASSERT(a == BigCount{0xffffffff});
+
+        a -= BigCount{0xffffffff};
+        CPPUNIT_ASSERT(a.isZero());
+        CPPUNIT_ASSERT(a.toString() == "0");
+        CPPUNIT_ASSERT(a.bitLength() == 0);
+    }
+
+    void multiply() {
+        CPPUNIT_ASSERT(power(10, 30).toString() ==
+                       "1000000000000000000000000000000");
+        CPPUNIT_ASSERT(power(2, 100).toString() ==
+                       "1267650600228229401496703205376");
+        CPPUNIT_ASSERT(power(7, 40) * power(7, 60) == power(7, 100));
+        CPPUNIT_ASSERT((power(3, 50) * BigCount{}).isZero());
+
+        auto a = power(5, 20);
+        a *= 0;
+        CPPUNIT_ASSERT(a.isZero());
+    }
+
+    void compare() {
+        CPPUNIT_ASSERT(power(2, 64) < power(3, 41));
+        CPPUNIT_ASSERT(!(power(3, 41) < power(2, 64)));
+        CPPUNIT_ASSERT(BigCount{} < BigCount{1});
+        CPPUNIT_ASSERT(!(power(2, 70) < power(2, 70)));
+    }
+
+    void log2() {
+        CPPUNIT_ASSERT(std::fabs(BigCount{1024}.log2() - 10) < 1e-9);
+        CPPUNIT_ASSERT(std::fabs(power(94, 256).log2() -
+                                 256 * std::log2(94.0)) < 1e-6);
+    }
+
+    void uniform() {
+        RandomSource randomSource;
+
+        // Spans two limbs, and values are rejected almost half of the time
+        auto bound = power(2, 40);
+        bound += BigCount{1};
+        auto half = power(2, 39);
+        int low = 0;
+        constexpr int ROUNDS{100000};
+        for (int i = 0; i < ROUNDS; i++) {
+            auto value = BigCount::uniform(bound, randomSource);
+            CPPUNIT_ASSERT(value < bound);
+            if (value < half) low++;
+        }
+        CPPUNIT_ASSERT(low > ROUNDS * 0.48 && low < ROUNDS * 0.52);
+
+        for (int i = 0; i < 1000; i++) {
+            CPPUNIT_ASSERT(BigCount::uniform(BigCount{1}, randomSource)
+                               .isZero());
+        }
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(BigCountTest::suite());
+    return runner.run() ? 0 : 1;
+}
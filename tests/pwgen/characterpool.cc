@@ -5,6 +5,7 @@
 #include <cppunit/ui/text/TestRunner.h>
 
 #include <algorithm>
+#include <stdexcept>
 
 #include "characterpool.hh"
 
@@ -23,6 +24,17 @@ class CharacterPoolTest : public CppUnit::TestFixture {
             "should properly return requested pools",
             &CharacterPoolTest::getCharacterPools});
 
+        suiteOfTests->addTest(new CppUnit::TestCaller<CharacterPoolTest>{
+            "should return selected pools",
+            &CharacterPoolTest::getSelected});
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<CharacterPoolTest>{
+            "should look up characters in table",
+            &CharacterPoolTest::characterTable});
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<CharacterPoolTest>{
+            "should parse pool names", &CharacterPoolTest::parse});
+
         return suiteOfTests;
     }
 
@@ -58,6 +70,45 @@ class CharacterPoolTest : public CppUnit::TestFixture {
 
         CPPUNIT_ASSERT_THROW(getPools(1 << 8), std::out_of_range);
     }
+
+    void getSelected() {
+        auto selectedPools{getSelectedPools(DIGITS | OTHER)};
+        CPPUNIT_ASSERT(selectedPools.size() == 2);
+        CPPUNIT_ASSERT(selectedPools[0] == digits);
+        CPPUNIT_ASSERT(selectedPools[1] == other);
+
+        CPPUNIT_ASSERT(getSelectedPools(ALL).size() == 5);
+        CPPUNIT_ASSERT(getSelectedPools(1 << 8).empty());
+    }
+
+    void characterTable() {
+        auto pools{getPools(ALL)};
+        CharacterTable table{pools};
+        CharacterTable empty{""};
+
+        for (int c = 0; c < 256; c++) {
+            bool inPools = std::find(pools.begin(), pools.end(),
+                                     static_cast<char>(c)) != pools.end();
+            CPPUNIT_ASSERT(table.contains(c) == inPools);
+            CPPUNIT_ASSERT(!empty.contains(c));
+        }
+
+        CharacterTable high{"\x80\xff"};
+        CPPUNIT_ASSERT(high.contains(0x80));
+        CPPUNIT_ASSERT(high.contains(0xff));
+        CPPUNIT_ASSERT(!high.contains(0x7f));
+    }
+
+    void parse() {
+        CPPUNIT_ASSERT(parsePools("letters") == LETTERS);
+        CPPUNIT_ASSERT(parsePools("digits,other,punct") ==
+                       (DIGITS | OTHER | PUNCT));
+        CPPUNIT_ASSERT(parsePools("letters,digits,punct,special,other") ==
+                       ALL);
+        CPPUNIT_ASSERT_THROW(parsePools(""), std::invalid_argument);
+        CPPUNIT_ASSERT_THROW(parsePools("letters,"), std::invalid_argument);
+        CPPUNIT_ASSERT_THROW(parsePools("umlauts"), std::invalid_argument);
+    }
 };
 
 int main() {
@@ -0,0 +1,193 @@
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <cctype>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "passphrase.hh"
+
+using namespace yapet::pwgen;
+
+namespace {
+std::shared_ptr<const Wordlist> makeWordlist(
+    const std::vector<std::string>& words) {
+    return std::make_shared<const Wordlist>(Wordlist::serialize(words));
+}
+
+std::vector<std::string> split(const std::string& passphrase,
+                               const std::string& separator) {
+    std::vector<std::string> words;
+    std::string::size_type start = 0;
+    std::string::size_type end;
+    while ((end = passphrase.find(separator, start)) != std::string::npos) {
+        words.push_back(passphrase.substr(start, end - start));
+        start = end + separator.size();
+    }
+    words.push_back(passphrase.substr(start));
+    return words;
+}
+
+std::string generate(PassphraseGenerator &generator) {
+    auto passphrase = generator.generatePassphrase();
+    return reinterpret_cast<const char *>(*passphrase);
+}
+}  // namespace
+
+class PassphraseTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite *suite() {
+        CppUnit::TestSuite *suiteOfTests =
+            new CppUnit::TestSuite("Passphrase Test");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<PassphraseTest>{
+            "should join words with separator", &PassphraseTest::words});
+        suiteOfTests->addTest(new CppUnit::TestCaller<PassphraseTest>{
+            "should pick words uniformly", &PassphraseTest::uniform});
+        suiteOfTests->addTest(new CppUnit::TestCaller<PassphraseTest>{
+            "should capitalize words", &PassphraseTest::capitalize});
+        suiteOfTests->addTest(new CppUnit::TestCaller<PassphraseTest>{
+            "should compute entropy", &PassphraseTest::entropy});
+        suiteOfTests->addTest(new CppUnit::TestCaller<PassphraseTest>{
+            "should generate passphrases in bulk", &PassphraseTest::bulk});
+        suiteOfTests->addTest(new CppUnit::TestCaller<PassphraseTest>{
+            "should parse capitalization", &PassphraseTest::parse});
+
+        return suiteOfTests;
+    }
+
+    void words() {
+        auto wordlist = makeWordlist({"apple", "banana", "cherry"});
+        PassphraseGenerator generator{wordlist, 5, "--"};
+
+        for (int i = 0; i < 100; i++) {
+            auto passphrase = generate(generator);
+            CPPUNIT_ASSERT(passphrase.size() <= generator.maxLength());
+
+            auto words = split(passphrase, "--");
+            CPPUNIT_ASSERT(words.size() == 5);
+            for (const auto &word : words) {
+                CPPUNIT_ASSERT(word == "apple" || word == "banana" ||
+                               word == "cherry");
+            }
+        }
+
+        generator.words(1);
+        CPPUNIT_ASSERT(split(generate(generator), "--").size() == 1);
+        CPPUNIT_ASSERT_THROW(generator.words(0), std::out_of_range);
+        CPPUNIT_ASSERT_THROW((PassphraseGenerator{nullptr, 3}),
+                             std::invalid_argument);
+    }
+
+    void uniform() {
+        constexpr int WORDS{10};
+        constexpr int PER_WORD{10000};
+        std::vector<std::string> list;
+        for (int i = 0; i < WORDS; i++) list.push_back(std::string(1, 'a' + i));
+        PassphraseGenerator generator{makeWordlist(list), WORDS, " "};
+
+        std::map<std::string, int> counts;
+        for (int i = 0; i < PER_WORD; i++) {
+            for (const auto &word : split(generate(generator), " ")) {
+                counts[word]++;
+            }
+        }
+
+        CPPUNIT_ASSERT(counts.size() == WORDS);
+        for (const auto &count : counts) {
+            CPPUNIT_ASSERT(count.second > PER_WORD * 0.94);
+            CPPUNIT_ASSERT(count.second < PER_WORD * 1.06);
+        }
+    }
+
+    void capitalize() {
+        auto wordlist = makeWordlist({"apple", "banana", "7up"});
+        PassphraseGenerator generator{wordlist, 8, " ",
+                                      Capitalization::FIRST};
+        for (const auto &word : split(generate(generator), " ")) {
+            CPPUNIT_ASSERT(!std::islower(word[0]));
+            CPPUNIT_ASSERT(word == "Apple" || word == "Banana" ||
+                           word == "7up");
+        }
+
+        generator.capitalization(Capitalization::RANDOM);
+        int upper = 0;
+        int lower = 0;
+        for (int i = 0; i < 1000; i++) {
+            for (const auto &word : split(generate(generator), " ")) {
+                if (std::isupper(word[0])) upper++;
+                if (std::islower(word[0])) lower++;
+            }
+        }
+        CPPUNIT_ASSERT(upper > 0 && lower > 0);
+
+        generator.capitalization(Capitalization::NONE);
+        for (const auto &word : split(generate(generator), " ")) {
+            CPPUNIT_ASSERT(!std::isupper(word[0]));
+        }
+    }
+
+    void entropy() {
+        std::vector<std::string> list;
+        for (int i = 0; i < 1024; i++) {
+            std::ostringstream word;
+            word << (i % 2 == 0 ? "w" : "W") << i;
+            list.push_back(word.str());
+        }
+        PassphraseGenerator generator{makeWordlist(list), 6};
+
+        CPPUNIT_ASSERT(std::fabs(generator.entropy() - 60) < 1e-9);
+
+        // Only the half of the words starting lower case add a bit
+        generator.capitalization(Capitalization::RANDOM);
+        CPPUNIT_ASSERT(std::fabs(generator.entropy() - 63) < 1e-9);
+
+        generator.capitalization(Capitalization::FIRST);
+        CPPUNIT_ASSERT(std::fabs(generator.entropy() - 60) < 1e-9);
+    }
+
+    void bulk() {
+        auto wordlist = makeWordlist({"apple", "banana", "cherry"});
+        PassphraseGenerator generator{wordlist, 3, "."};
+
+        constexpr std::size_t COUNT{100};
+        std::vector<std::uint8_t> buffer(COUNT * (generator.maxLength() + 1));
+        auto size = generator.generatePassphrases(COUNT, buffer.data());
+        CPPUNIT_ASSERT(size <= buffer.size());
+
+        std::string output{buffer.begin(), buffer.begin() + size};
+        std::istringstream lines{output};
+        std::string line;
+        std::size_t count = 0;
+        while (std::getline(lines, line)) {
+            CPPUNIT_ASSERT(split(line, ".").size() == 3);
+            count++;
+        }
+        CPPUNIT_ASSERT(count == COUNT);
+        CPPUNIT_ASSERT(output.back() == '\n');
+    }
+
+    void parse() {
+        for (auto capitalization :
+             {Capitalization::NONE, Capitalization::FIRST,
+              Capitalization::RANDOM}) {
+            CPPUNIT_ASSERT(parseCapitalization(capitalizationName(
+                               capitalization)) == capitalization);
+        }
+        CPPUNIT_ASSERT_THROW(parseCapitalization("upper"),
+                             std::invalid_argument);
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(PassphraseTest::suite());
+    return runner.run() ? 0 : 1;
+}
@@ -0,0 +1,259 @@
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "policy.hh"
+#include "policygenerator.hh"
+
+using namespace yapet::pwgen;
+
+namespace {
+/**
+ * All passwords of \c size characters of \c alphabet satisfying \c policy.
+ */
+std::vector<std::string> enumerate(const Policy &policy,
+                                   const std::string &alphabet, int size) {
+    std::vector<std::string> passwords;
+    std::vector<std::size_t> digits(size, 0);
+    std::string password(size, alphabet[0]);
+    for (;;) {
+        if (policy.satisfiedBy(
+                reinterpret_cast<const std::uint8_t *>(password.data()),
+                size)) {
+            passwords.push_back(password);
+        }
+
+        int i = 0;
+        for (; i < size; i++) {
+            if (++digits[i] < alphabet.size()) break;
+            digits[i] = 0;
+        }
+        if (i == size) return passwords;
+        for (int j = 0; j <= i; j++) password[j] = alphabet[digits[j]];
+    }
+}
+
+BigCount factorial(int n) {
+    BigCount result{1};
+    for (int i = 2; i <= n; i++) result *= i;
+    return result;
+}
+
+std::string generate(PolicyGenerator &generator, int size) {
+    auto password = generator.generatePassword(size);
+    return reinterpret_cast<const char *>(*password);
+}
+}  // namespace
+
+class PolicyTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite *suite() {
+        CppUnit::TestSuite *suiteOfTests =
+            new CppUnit::TestSuite("Policy Test");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<PolicyTest>{
+            "should parse rules", &PolicyTest::parse});
+        suiteOfTests->addTest(new CppUnit::TestCaller<PolicyTest>{
+            "should reject invalid rules", &PolicyTest::invalid});
+        suiteOfTests->addTest(new CppUnit::TestCaller<PolicyTest>{
+            "should check passwords", &PolicyTest::satisfiedBy});
+        suiteOfTests->addTest(new CppUnit::TestCaller<PolicyTest>{
+            "should count passwords satisfying rules", &PolicyTest::count});
+        suiteOfTests->addTest(new CppUnit::TestCaller<PolicyTest>{
+            "should count long passwords", &PolicyTest::countLong});
+        suiteOfTests->addTest(new CppUnit::TestCaller<PolicyTest>{
+            "should generate passwords satisfying rules",
+            &PolicyTest::generateSatisfying});
+        suiteOfTests->addTest(new CppUnit::TestCaller<PolicyTest>{
+            "should generate each password equally often",
+            &PolicyTest::uniform});
+        suiteOfTests->addTest(new CppUnit::TestCaller<PolicyTest>{
+            "should fail if no password satisfies rules",
+            &PolicyTest::unsatisfiable});
+
+        return suiteOfTests;
+    }
+
+    void parse() {
+        auto policy = Policy::parse(
+            "length=8-12  digits=2- upper=1 special=0\tforbid=0O1l repeat=2");
+
+        CPPUNIT_ASSERT(policy.minLength() == 8);
+        CPPUNIT_ASSERT(policy.maxLength() == 12);
+        CPPUNIT_ASSERT(policy.clampLength(20) == 12);
+        CPPUNIT_ASSERT(policy.clampLength(3) == 8);
+        CPPUNIT_ASSERT(policy.minCount(CLASS_DIGITS) == 2);
+        CPPUNIT_ASSERT(policy.maxCount(CLASS_DIGITS) == 256);
+        CPPUNIT_ASSERT(policy.minCount(CLASS_UPPER) == 1);
+        CPPUNIT_ASSERT(policy.maxCount(CLASS_UPPER) == 1);
+        CPPUNIT_ASSERT(policy.maxCount(CLASS_SPECIAL) == 0);
+        CPPUNIT_ASSERT(policy.minCount(CLASS_LOWER) == 0);
+        CPPUNIT_ASSERT(policy.maxRepeat() == 2);
+        CPPUNIT_ASSERT(policy.characters(CLASS_DIGITS) == "23456789");
+        CPPUNIT_ASSERT(policy.characters(CLASS_LOWER).find('l') ==
+                       std::string::npos);
+        CPPUNIT_ASSERT(policy.characters(CLASS_UPPER).size() == 25);
+
+        policy = Policy::parse("allow=abc123 lower=-2");
+        CPPUNIT_ASSERT(policy.characters(CLASS_LOWER) == "abc");
+        CPPUNIT_ASSERT(policy.maxCount(CLASS_LOWER) == 2);
+        CPPUNIT_ASSERT(policy.characters(CLASS_UPPER).empty());
+        CPPUNIT_ASSERT(policy.maxCount(CLASS_UPPER) == 0);
+
+        policy = Policy::parse("");
+        CPPUNIT_ASSERT(policy.maxRepeat() == 0);
+        CPPUNIT_ASSERT(policy.characters(CLASS_OTHER).size() == 8);
+    }
+
+    void invalid() {
+        for (const char *rules :
+             {"size=8", "length", "length=", "length=0", "length=12-8",
+              "digits=-", "digits=x", "digits=1-2-3", "digits=300",
+              "repeat=0", "allow=abc\x7f", "allow=abc digits=1",
+              "forbid=0123456789 digits=1", "length=1-4 digits=2 upper=3",
+              "lower=0 upper=0 digits=0 punct=0 special=0 other=0"}) {
+            CPPUNIT_ASSERT_THROW(Policy::parse(rules), std::invalid_argument);
+        }
+    }
+
+    void satisfiedBy() {
+        auto policy = Policy::parse("length=4-6 digits=1- upper=-1 repeat=2");
+        auto check = [&policy](const char *password) {
+            return policy.satisfiedBy(
+                reinterpret_cast<const std::uint8_t *>(password),
+                std::strlen(password));
+        };
+
+        CPPUNIT_ASSERT(check("ab1c"));
+        CPPUNIT_ASSERT(check("aB1a2"));
+        CPPUNIT_ASSERT(!check("ab1"));
+        CPPUNIT_ASSERT(!check("abcd"));
+        CPPUNIT_ASSERT(!check("AB1c"));
+        CPPUNIT_ASSERT(!check("a1a1a"));
+        CPPUNIT_ASSERT(!check("ab 1"));
+    }
+
+    void count() {
+        const std::string alphabet{"abAB12,"};
+        for (const char *rules :
+             {"allow=abAB12, length=4 digits=1- upper=-1",
+              "allow=abAB12, length=4 repeat=1", "allow=abAB12, repeat=2",
+              "allow=abAB12, length=5 lower=2 punct=1- repeat=2"}) {
+            auto policy = Policy::parse(rules);
+            PolicyGenerator generator{policy};
+            for (int size = std::max(2, policy.minLength());
+                 size <= std::min(5, policy.maxLength()); size++) {
+                auto passwords = enumerate(policy, alphabet, size);
+                CPPUNIT_ASSERT(generator.count(size) ==
+                               BigCount(passwords.size()));
+            }
+        }
+    }
+
+    void countLong() {
+        PolicyGenerator unrestricted{Policy{}};
+        BigCount expected{1};
+        for (int i = 0; i < 256; i++) expected *= 94;
+        CPPUNIT_ASSERT(unrestricted.count(256) == expected);
+        CPPUNIT_ASSERT(std::fabs(unrestricted.entropy(10) -
+                                 10 * std::log2(94.0)) < 1e-9);
+
+        // Using each character once, passwords are permutations
+        PolicyGenerator distinct{Policy::parse("repeat=1")};
+        CPPUNIT_ASSERT(distinct.count(94) == factorial(94));
+        CPPUNIT_ASSERT(distinct.count(95).isZero());
+
+        auto password = generate(distinct, 94);
+        std::string sorted{password};
+        std::sort(sorted.begin(), sorted.end());
+        CPPUNIT_ASSERT(std::unique(sorted.begin(), sorted.end()) ==
+                       sorted.end());
+    }
+
+    void generateSatisfying() {
+        for (const char *rules :
+             {"", "length=8-12 digits=2- upper=1 special=0 forbid=0O1l",
+              "digits=3 upper=3 lower=3 punct=1 special=1 other=1",
+              "repeat=1 allow=abcdefgh12345678", "lower=0 upper=0 digits=10-",
+              "length=64 repeat=2 special=10-20 other=0"}) {
+            auto policy = Policy::parse(rules);
+            PolicyGenerator generator{policy};
+            for (int size : {12, 16, 64}) {
+                if (size != policy.clampLength(size) ||
+                    generator.count(size).isZero()) {
+                    continue;
+                }
+                for (int i = 0; i < 200; i++) {
+                    auto password = generate(generator, size);
+                    CPPUNIT_ASSERT(password.size() ==
+                                   static_cast<std::size_t>(size));
+                    CPPUNIT_ASSERT(policy.satisfiedBy(
+                        reinterpret_cast<const std::uint8_t *>(
+                            password.data()),
+                        size));
+                }
+            }
+        }
+
+        PolicyGenerator generator{Policy::parse("digits=2 lower=0")};
+        constexpr std::size_t COUNT{100};
+        std::vector<std::uint8_t> buffer(COUNT * 9);
+        generator.generatePasswords(8, COUNT, buffer.data());
+        for (std::size_t i = 0; i < COUNT; i++) {
+            CPPUNIT_ASSERT(generator.policy().satisfiedBy(&buffer[i * 9], 8));
+            CPPUNIT_ASSERT(buffer[i * 9 + 8] == '\n');
+        }
+    }
+
+    void uniform() {
+        // Tight rules, under which placing the required characters first
+        // would favour some passwords
+        const std::string alphabet{"abA1"};
+        auto policy =
+            Policy::parse("allow=abA1 length=4 digits=1- upper=-1 repeat=2");
+        auto valid = enumerate(policy, alphabet, 4);
+        PolicyGenerator generator{policy};
+        CPPUNIT_ASSERT(generator.count(4) == BigCount(valid.size()));
+
+        constexpr int PER_PASSWORD{2000};
+        std::map<std::string, int> counts;
+        for (std::size_t i = 0; i < valid.size() * PER_PASSWORD; i++) {
+            counts[generate(generator, 4)]++;
+        }
+
+        CPPUNIT_ASSERT(counts.size() == valid.size());
+        for (const auto &count : counts) {
+            CPPUNIT_ASSERT(count.second > PER_PASSWORD * 0.85);
+            CPPUNIT_ASSERT(count.second < PER_PASSWORD * 1.15);
+        }
+    }
+
+    void unsatisfiable() {
+        PolicyGenerator generator{Policy::parse(
+            "length=2-8 lower=0 upper=0 digits=0 punct=0 special=0 other=-3")};
+        CPPUNIT_ASSERT(!generator.count(3).isZero());
+        CPPUNIT_ASSERT(generator.count(4).isZero());
+        CPPUNIT_ASSERT(generator.entropy(4) == 0);
+        CPPUNIT_ASSERT_THROW(generator.generatePassword(4),
+                             std::invalid_argument);
+        CPPUNIT_ASSERT_THROW(generator.generatePassword(9),
+                             std::invalid_argument);
+        CPPUNIT_ASSERT_THROW(generator.count(1), std::invalid_argument);
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(PolicyTest::suite());
+    return runner.run() ? 0 : 1;
+}
@@ -0,0 +1,123 @@
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "pronounceable.hh"
+
+using namespace yapet::pwgen;
+
+namespace {
+bool lowerCase(const std::uint8_t *password, int size) {
+    for (int i = 0; i < size; i++) {
+        if (password[i] < 'a' || password[i] > 'z') return false;
+    }
+    return true;
+}
+}  // namespace
+
+class PronounceableTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite *suite() {
+        CppUnit::TestSuite *suiteOfTests =
+            new CppUnit::TestSuite("Pronounceable Test");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<PronounceableTest>{
+            "should generate lower case passwords",
+            &PronounceableTest::password});
+        suiteOfTests->addTest(new CppUnit::TestCaller<PronounceableTest>{
+            "should generate passwords in bulk", &PronounceableTest::bulk});
+        suiteOfTests->addTest(new CppUnit::TestCaller<PronounceableTest>{
+            "should reject invalid sizes", &PronounceableTest::invalidSize});
+        suiteOfTests->addTest(new CppUnit::TestCaller<PronounceableTest>{
+            "should bound entropy", &PronounceableTest::entropyBounds});
+        suiteOfTests->addTest(new CppUnit::TestCaller<PronounceableTest>{
+            "entropy should match generated passwords",
+            &PronounceableTest::entropyMatches});
+
+        return suiteOfTests;
+    }
+
+    void password() {
+        PronounceableGenerator generator;
+        for (int size = 1; size <= 256; size++) {
+            auto password = generator.generatePassword(size);
+            CPPUNIT_ASSERT(std::strlen(reinterpret_cast<const char *>(
+                               *password)) == static_cast<std::size_t>(size));
+            CPPUNIT_ASSERT(lowerCase(*password, size));
+        }
+    }
+
+    void bulk() {
+        constexpr int SIZE{12};
+        constexpr std::size_t COUNT{1000};
+        PronounceableGenerator generator;
+        std::vector<std::uint8_t> buffer(COUNT * (SIZE + 1));
+
+        generator.generatePasswords(SIZE, COUNT, buffer.data(), '\0');
+        for (std::size_t i = 0; i < COUNT; i++) {
+            auto password = &buffer[i * (SIZE + 1)];
+            CPPUNIT_ASSERT(lowerCase(password, SIZE));
+            CPPUNIT_ASSERT(password[SIZE] == '\0');
+        }
+    }
+
+    void invalidSize() {
+        PronounceableGenerator generator;
+        CPPUNIT_ASSERT_THROW(generator.generatePassword(0),
+                             std::invalid_argument);
+        CPPUNIT_ASSERT_THROW(PronounceableGenerator::entropy(-1),
+                             std::invalid_argument);
+    }
+
+    void entropyBounds() {
+        double previous = 0;
+        for (int size = 1; size <= 256; size++) {
+            double entropy = PronounceableGenerator::entropy(size);
+            CPPUNIT_ASSERT(entropy > previous);
+            CPPUNIT_ASSERT(entropy <= size * std::log2(26.0));
+            previous = entropy;
+        }
+    }
+
+    void entropyMatches() {
+        // The entropy estimated from the frequencies of the passwords
+        // generated has to be close to the one computed from the model
+        constexpr int SIZE{2};
+        constexpr long ROUNDS{1000000};
+        PronounceableGenerator generator;
+        std::vector<std::uint8_t> buffer(ROUNDS * (SIZE + 1));
+        generator.generatePasswords(SIZE, ROUNDS, buffer.data());
+
+        std::map<std::string, long> frequencies;
+        for (long i = 0; i < ROUNDS; i++) {
+            frequencies[std::string(
+                reinterpret_cast<const char *>(&buffer[i * (SIZE + 1)]),
+                SIZE)]++;
+        }
+
+        double estimate = 0;
+        for (const auto &frequency : frequencies) {
+            double p = static_cast<double>(frequency.second) / ROUNDS;
+            estimate -= p * std::log2(p);
+        }
+
+        CPPUNIT_ASSERT(
+            std::fabs(PronounceableGenerator::entropy(SIZE) - estimate) <
+            0.02);
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(PronounceableTest::suite());
+    return runner.run() ? 0 : 1;
+}
@@ -49,6 +49,18 @@ class PasswordGeneratorTest : public CppUnit::TestFixture {
             "should use pools properly",
             &PasswordGeneratorTest::usePoolsProperly});
 
+        suiteOfTests->addTest(new CppUnit::TestCaller<PasswordGeneratorTest>{
+            "should throw without pools",
+            &PasswordGeneratorTest::noPools});
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<PasswordGeneratorTest>{
+            "should cover pools in bulk",
+            &PasswordGeneratorTest::generatePasswords});
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<PasswordGeneratorTest>{
+            "should check selected pools",
+            &PasswordGeneratorTest::checkSelectedPools});
+
         return suiteOfTests;
     }
 
@@ -106,6 +118,40 @@ class PasswordGeneratorTest : public CppUnit::TestFixture {
             CPPUNIT_ASSERT(std::isdigit(password[i]));
         }
     }
+
+    void noPools() {
+        PasswordGenerator passwordGenerator{0};
+        CPPUNIT_ASSERT_THROW(passwordGenerator.generatePassword(5),
+                             std::out_of_range);
+    }
+
+    void generatePasswords() {
+        constexpr int SIZE{5};
+        constexpr int COUNT{10000};
+        PasswordGenerator passwordGenerator{ALL};
+        SecureArray buffer{COUNT * (SIZE + 1)};
+
+        passwordGenerator.generatePasswords(SIZE, COUNT, *buffer);
+
+        // Five pools in five characters leave no room for chance
+        for (int i = 0; i < COUNT; i++) {
+            const std::uint8_t* password = *buffer + i * (SIZE + 1);
+            CPPUNIT_ASSERT(containsSelectedPools(ALL, password, SIZE));
+            CPPUNIT_ASSERT(password[SIZE] == '\n');
+        }
+
+        CPPUNIT_ASSERT_THROW(passwordGenerator.generatePasswords(0, 1, *buffer),
+                             std::invalid_argument);
+    }
+
+    void checkSelectedPools() {
+        auto password{reinterpret_cast<const std::uint8_t*>("a1.")};
+
+        CPPUNIT_ASSERT(containsSelectedPools(LETTERS | DIGITS, password, 3));
+        CPPUNIT_ASSERT(!containsSelectedPools(LETTERS | SPECIAL, password, 3));
+        // Too short to contain all pools
+        CPPUNIT_ASSERT(containsSelectedPools(ALL, password, 3));
+    }
 };
 
 int main() {
@@ -0,0 +1,92 @@
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "randomsource.hh"
+
+using namespace yapet::pwgen;
+
+class RandomSourceTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite *suite() {
+        CppUnit::TestSuite *suiteOfTests =
+            new CppUnit::TestSuite("Random Source Test");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<RandomSourceTest>{
+            "should stay in range", &RandomSourceTest::range});
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<RandomSourceTest>{
+            "should be uniform", &RandomSourceTest::uniform});
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<RandomSourceTest>{
+            "should refill buffer", &RandomSourceTest::refill});
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<RandomSourceTest>{
+            "should be movable", &RandomSourceTest::move});
+
+        return suiteOfTests;
+    }
+
+    void range() {
+        RandomSource randomSource;
+        for (std::uint32_t n : {1u, 2u, 3u, 94u, 255u, 256u, 257u, 1000u,
+                                0x80000001u}) {
+            for (int i = 0; i < 10000; i++) {
+                CPPUNIT_ASSERT(randomSource.uniform(n) < n);
+            }
+        }
+    }
+
+    void uniform() {
+        // The bias of reducing bytes modulo 94 would put the first 68
+        // values about 25% above the others
+        constexpr std::uint32_t N{94};
+        constexpr int PER_VALUE{10000};
+        RandomSource randomSource;
+        std::vector<int> counts(N);
+
+        for (std::uint32_t i = 0; i < N * PER_VALUE; i++) {
+            counts[randomSource.uniform(N)]++;
+        }
+        for (auto count : counts) {
+            CPPUNIT_ASSERT(count > PER_VALUE * 0.94);
+            CPPUNIT_ASSERT(count < PER_VALUE * 1.06);
+        }
+    }
+
+    void refill() {
+        RandomSource randomSource;
+        std::vector<int> counts(256);
+        for (int i = 0; i < RandomSource::BUFFER_SIZE * 64; i++) {
+            counts[randomSource.byte()]++;
+        }
+        for (auto count : counts) {
+            CPPUNIT_ASSERT(count > 0);
+        }
+    }
+
+    void move() {
+        RandomSource randomSource;
+        randomSource.byte();
+
+        RandomSource moved{std::move(randomSource)};
+        moved.byte();
+
+        randomSource = std::move(moved);
+        for (int i = 0; i < RandomSource::BUFFER_SIZE * 2; i++) {
+            randomSource.byte();
+            moved.byte();
+        }
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(RandomSourceTest::suite());
+    return runner.run() ? 0 : 1;
+}
@@ -56,11 +56,13 @@ class RngTest : public CppUnit::TestFixture {
         yapet::pwgen::Rng moved{std::move(rng1)};
 
         for (int i = 0; i < 10; i++) moved.getNextInt();
-        CPPUNIT_ASSERT_THROW(rng1.getNextInt(), std::runtime_error);
+        // Rngs share the generator of the thread, so moved from Rngs
+        // remain usable
+        CPPUNIT_ASSERT(rng1.getNextInt() <= HI);
 
         yapet::pwgen::Rng moved2 = std::move(moved);
         for (int i = 0; i < 10; i++) moved2.getNextInt();
-        CPPUNIT_ASSERT_THROW(moved.getNextInt(), std::runtime_error);
+        CPPUNIT_ASSERT(moved.getNextInt() <= HI);
     }
 };
 
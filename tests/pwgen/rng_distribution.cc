@@ -1,20 +1,191 @@
-#include <iostream>
-#include <map>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
 
-#include <random>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "chacha20drbg.hh"
+#include "randomsource.hh"
 #include "rng.hh"
 
 constexpr auto ROUNDS{1000000};
 
-int main() {
-    std::map<int, int> distribution;
-    yapet::pwgen::Rng rng{255};
+// Tests fail if the statistic deviates by more than this many standard
+// deviations, which happens by chance in less than one in a million runs
+constexpr double MAX_DEVIATION{5.0};
+
+namespace {
+double chiSquare(const std::vector<long>& observed, double expected) {
+    double sum = 0;
+    for (auto count : observed) {
+        double difference = count - expected;
+        sum += difference * difference / expected;
+    }
+    return sum;
+}
+
+/**
+ * Whether the chi-square statistic of \c degrees degrees of freedom is
+ * plausible, i.e. neither too high nor too low. Uses the Wilson-Hilferty
+ * approximation of the chi-square distribution.
+ */
+bool plausibleChiSquare(double statistic, int degrees) {
+    double variance = 2.0 / (9.0 * degrees);
+    double z =
+        (std::cbrt(statistic / degrees) - (1 - variance)) / std::sqrt(variance);
+    return std::fabs(z) < MAX_DEVIATION;
+}
+
+bool plausibleUniform(const std::vector<long>& observed, long samples) {
+    double expected = static_cast<double>(samples) / observed.size();
+    return plausibleChiSquare(chiSquare(observed, expected),
+                              observed.size() - 1);
+}
+}  // namespace
+
+class RngDistributionTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite *suite() {
+        CppUnit::TestSuite *suiteOfTests =
+            new CppUnit::TestSuite("Random Number Distribution Test");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<RngDistributionTest>(
+            "Rng should be uniform over bytes",
+            &RngDistributionTest::rngBytes));
+        suiteOfTests->addTest(new CppUnit::TestCaller<RngDistributionTest>(
+            "Rng should be uniform over small ranges",
+            &RngDistributionTest::rngSmallRange));
+        suiteOfTests->addTest(new CppUnit::TestCaller<RngDistributionTest>(
+            "RandomSource should be uniform",
+            &RngDistributionTest::randomSource));
+        suiteOfTests->addTest(new CppUnit::TestCaller<RngDistributionTest>(
+            "RandomEngine should pass monobit test",
+            &RngDistributionTest::monobit));
+        suiteOfTests->addTest(new CppUnit::TestCaller<RngDistributionTest>(
+            "RandomEngine should set each bit equally often",
+            &RngDistributionTest::bitPositions));
+        suiteOfTests->addTest(new CppUnit::TestCaller<RngDistributionTest>(
+            "RandomEngine should pass runs test",
+            &RngDistributionTest::runs));
+        suiteOfTests->addTest(new CppUnit::TestCaller<RngDistributionTest>(
+            "RandomEngine should be uniform over byte pairs",
+            &RngDistributionTest::bytePairs));
+
+        return suiteOfTests;
+    }
+
+    void rngBytes() {
+        std::vector<long> distribution(256, 0);
+        yapet::pwgen::Rng rng{255};
+
+        for (int i = 0; i < ROUNDS; i++) {
+            distribution[rng.getNextInt()]++;
+        }
+
+        CPPUNIT_ASSERT(plausibleUniform(distribution, ROUNDS));
+    }
+
+    void rngSmallRange() {
+        std::vector<long> distribution(10, 0);
+        yapet::pwgen::Rng rng{9};
+
+        for (int i = 0; i < ROUNDS; i++) {
+            distribution[rng.getNextInt()]++;
+        }
+
+        CPPUNIT_ASSERT(plausibleUniform(distribution, ROUNDS));
+    }
+
+    void randomSource() {
+        // Neither a power of two nor a divisor of 256
+        constexpr std::uint32_t RANGE{94};
+        std::vector<long> distribution(RANGE, 0);
+        yapet::pwgen::RandomSource randomSource;
+
+        for (int i = 0; i < ROUNDS; i++) {
+            distribution[randomSource.uniform(RANGE)]++;
+        }
 
-    for (int i = 0; i < ROUNDS; i++) {
-        distribution[rng.getNextInt()]++;
+        CPPUNIT_ASSERT(plausibleUniform(distribution, ROUNDS));
     }
 
-    for (std::pair<int, int> p : distribution) {
-        std::cout << std::to_string(p.first) << "," << p.second << "\n";
+    void monobit() {
+        yapet::RandomEngine engine;
+        long ones = 0;
+        for (int i = 0; i < ROUNDS; i++) {
+            std::uint32_t value = engine();
+            for (int bit = 0; bit < 32; bit++) ones += (value >> bit) & 1;
+        }
+
+        double bits = 32.0 * ROUNDS;
+        double z = (ones - bits / 2) / std::sqrt(bits / 4);
+        CPPUNIT_ASSERT(std::fabs(z) < MAX_DEVIATION);
     }
-}
\ No newline at end of file
+
+    void bitPositions() {
+        yapet::RandomEngine engine;
+        std::vector<long> ones(32, 0);
+        for (int i = 0; i < ROUNDS; i++) {
+            std::uint32_t value = engine();
+            for (int bit = 0; bit < 32; bit++) ones[bit] += (value >> bit) & 1;
+        }
+
+        for (auto count : ones) {
+            double z = (count - ROUNDS / 2.0) / std::sqrt(ROUNDS / 4.0);
+            CPPUNIT_ASSERT(std::fabs(z) < MAX_DEVIATION);
+        }
+    }
+
+    void runs() {
+        // Wald-Wolfowitz runs test over the bit stream
+        yapet::RandomEngine engine;
+        long ones = 0;
+        long runs = 1;
+        int previous = engine() & 1;
+        ones += previous;
+        long bits = 1;
+
+        for (int i = 0; i < ROUNDS; i++) {
+            std::uint32_t value = engine();
+            for (int bit = 0; bit < 32; bit++, bits++) {
+                int current = (value >> bit) & 1;
+                ones += current;
+                if (current != previous) runs++;
+                previous = current;
+            }
+        }
+
+        double n1 = ones;
+        double n2 = bits - ones;
+        double n = bits;
+        double expected = 2 * n1 * n2 / n + 1;
+        double variance =
+            2 * n1 * n2 * (2 * n1 * n2 - n) / (n * n * (n - 1));
+        double z = (runs - expected) / std::sqrt(variance);
+        CPPUNIT_ASSERT(std::fabs(z) < MAX_DEVIATION);
+    }
+
+    void bytePairs() {
+        yapet::RandomEngine engine;
+        std::vector<long> distribution(65536, 0);
+        constexpr long PAIRS{4 * ROUNDS};
+
+        for (long i = 0; i < PAIRS / 2; i++) {
+            std::uint32_t value = engine();
+            distribution[value & 0xffff]++;
+            distribution[value >> 16]++;
+        }
+
+        CPPUNIT_ASSERT(plausibleUniform(distribution, PAIRS));
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(RngDistributionTest::suite());
+    return runner.run() ? 0 : 1;
+}
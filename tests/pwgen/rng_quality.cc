@@ -0,0 +1,428 @@
+// Quality and throughput harness for the random number generators and the
+// password generators.
+//
+// Usage: rng_quality [-f] [-n <samples>] [-t <threads>]
+//
+// Without options, a quick run suitable for make check is done. -f draws
+// 10^8 samples per test, as make check-rng does. Samples are drawn by all
+// threads in parallel, each from the generator of its own thread.
+//
+// Exits with 1 if any statistic deviates by more than MAX_DEVIATION
+// standard deviations.
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chacha20drbg.hh"
+#include "characterpool.hh"
+#include "policygenerator.hh"
+#include "pronounceable.hh"
+#include "pwgen.hh"
+#include "randomsource.hh"
+
+constexpr unsigned long long QUICK_SAMPLES{1000000};
+constexpr unsigned long long FULL_SAMPLES{100000000};
+
+// A statistic deviating by more than this many standard deviations happens
+// by chance in less than one in a million runs
+constexpr double MAX_DEVIATION{5.0};
+
+constexpr int PASSWORD_LENGTH{16};
+constexpr std::size_t BYTES_PER_BATCH{64 * 1024};
+constexpr int NAME_WIDTH{44};
+
+namespace {
+int failures = 0;
+
+/**
+ * Counts and sums collected by a thread, merged when all are done.
+ */
+struct Tally {
+    std::vector<unsigned long long> counts;
+    // Sums over pairs of consecutive values for the serial correlation
+    double pairs{0};
+    double sumX{0};
+    double sumY{0};
+    double sumXX{0};
+    double sumYY{0};
+    double sumXY{0};
+
+    explicit Tally(std::size_t bins = 0) : counts(bins, 0) {}
+
+    void pair(double x, double y) {
+        pairs++;
+        sumX += x;
+        sumY += y;
+        sumXX += x * x;
+        sumYY += y * y;
+        sumXY += x * y;
+    }
+
+    Tally& operator+=(const Tally& other) {
+        for (std::size_t i = 0; i < counts.size(); i++) {
+            counts[i] += other.counts[i];
+        }
+        pairs += other.pairs;
+        sumX += other.sumX;
+        sumY += other.sumY;
+        sumXX += other.sumXX;
+        sumYY += other.sumYY;
+        sumXY += other.sumXY;
+        return *this;
+    }
+};
+
+/**
+ * Run \c work(samples) on \c threads threads, splitting \c samples among
+ * them, and merge the tallies returned.
+ */
+template <typename Work>
+Tally parallel(unsigned threads, unsigned long long samples, Work work) {
+    std::vector<Tally> tallies(threads);
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < threads; i++) {
+        auto share = samples / threads + (i < samples % threads ? 1 : 0);
+        workers.emplace_back(
+            [&tallies, &work, i, share]() { tallies[i] = work(share); });
+    }
+    for (auto& worker : workers) worker.join();
+
+    Tally total = tallies[0];
+    for (unsigned i = 1; i < threads; i++) total += tallies[i];
+    return total;
+}
+
+/**
+ * Seconds taken by running \c work(samples) on \c threads threads,
+ * splitting \c samples among them.
+ */
+template <typename Work>
+double timed(unsigned threads, unsigned long long samples, Work work) {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < threads; i++) {
+        auto share = samples / threads + (i < samples % threads ? 1 : 0);
+        workers.emplace_back([&work, share]() { work(share); });
+    }
+    for (auto& worker : workers) worker.join();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                         start)
+        .count();
+}
+
+void report(const std::string& name, const std::string& statistic,
+            double value, double z) {
+    bool ok = std::fabs(z) < MAX_DEVIATION;
+    if (!ok) failures++;
+    std::cout << std::left << std::setw(NAME_WIDTH) << name << std::setw(14)
+              << statistic << std::right << std::setw(14)
+              << std::setprecision(6) << value << "  z=" << std::fixed
+              << std::setprecision(2) << std::setw(6) << z << std::defaultfloat
+              << (ok ? "  ok" : "  FAILED") << std::endl;
+}
+
+/**
+ * Check the counts for uniformity. Uses the Wilson-Hilferty approximation of
+ * the chi-square distribution.
+ */
+void chiSquare(const std::string& name,
+               const std::vector<unsigned long long>& counts) {
+    unsigned long long samples = 0;
+    for (auto count : counts) samples += count;
+    double expected = static_cast<double>(samples) / counts.size();
+
+    double statistic = 0;
+    for (auto count : counts) {
+        double difference = count - expected;
+        statistic += difference * difference / expected;
+    }
+
+    double degrees = counts.size() - 1;
+    double variance = 2.0 / (9.0 * degrees);
+    double z = (std::cbrt(statistic / degrees) - (1 - variance)) /
+               std::sqrt(variance);
+    report(name, "chi-square", statistic, z);
+}
+
+/**
+ * Check the correlation of consecutive values, which is about normally
+ * distributed with a standard deviation of 1/sqrt(n).
+ */
+void serialCorrelation(const std::string& name, const Tally& tally) {
+    double n = tally.pairs;
+    double covariance = tally.sumXY / n - tally.sumX / n * tally.sumY / n;
+    double varianceX = tally.sumXX / n - tally.sumX / n * tally.sumX / n;
+    double varianceY = tally.sumYY / n - tally.sumY / n * tally.sumY / n;
+    double r = covariance / std::sqrt(varianceX * varianceY);
+    report(name, "serial corr.", r, r * std::sqrt(n));
+}
+
+void bytes(unsigned threads, unsigned long long samples) {
+    auto tally = parallel(threads, samples, [](unsigned long long share) {
+        Tally tally{256};
+        std::vector<std::uint8_t> buffer(BYTES_PER_BATCH);
+        int previous = -1;
+        while (share > 0) {
+            auto size = std::min<unsigned long long>(share, buffer.size());
+            yapet::randomBytes(buffer.data(), size);
+            for (std::size_t i = 0; i < size; i++) {
+                tally.counts[buffer[i]]++;
+                if (previous >= 0) tally.pair(previous, buffer[i]);
+                previous = buffer[i];
+            }
+            share -= size;
+        }
+        return tally;
+    });
+    chiSquare("randomBytes()", tally.counts);
+    serialCorrelation("randomBytes()", tally);
+}
+
+void bits(unsigned threads, unsigned long long samples) {
+    auto tally = parallel(threads, samples, [](unsigned long long share) {
+        Tally tally{32};
+        yapet::RandomEngine engine;
+        for (unsigned long long i = 0; i < share; i++) {
+            auto value = engine();
+            for (int bit = 0; bit < 32; bit++) {
+                tally.counts[bit] += (value >> bit) & 1;
+            }
+        }
+        return tally;
+    });
+
+    // The bit whose share of ones deviates most
+    double worst = 0;
+    double share = 0.5;
+    for (auto ones : tally.counts) {
+        double z = (ones - samples / 2.0) / std::sqrt(samples / 4.0);
+        if (std::fabs(z) > std::fabs(worst)) {
+            worst = z;
+            share = static_cast<double>(ones) / samples;
+        }
+    }
+    report("RandomEngine bits", "ones", share, worst);
+}
+
+/**
+ * Ranges drawn from, and the number of equally sized bins the values are
+ * counted in. The last ranges would show a modulo bias clearly.
+ */
+struct Range {
+    std::uint32_t n;
+    std::uint32_t bins;
+};
+const std::vector<Range> RANGES{
+    {2, 2}, {3, 3}, {10, 10}, {94, 94}, {1000, 1000}, {3u << 30, 3}};
+
+template <typename Draw>
+void ranges(const std::string& name, unsigned threads,
+            unsigned long long samples, Draw draw) {
+    for (const auto& range : RANGES) {
+        auto tally = parallel(threads, samples, [&](unsigned long long share) {
+            Tally tally{range.bins};
+            auto width = range.n / range.bins;
+            auto next = draw(range.n);
+            std::uint32_t previous = next();
+            for (unsigned long long i = 0; i < share; i++) {
+                auto value = next();
+                tally.counts[value / width]++;
+                tally.pair(previous, value);
+                previous = value;
+            }
+            return tally;
+        });
+        std::string label{name + " [0, " + std::to_string(range.n) + ")"};
+        chiSquare(label, tally.counts);
+        serialCorrelation(label, tally);
+    }
+}
+
+void pools(unsigned threads, unsigned long long samples) {
+    const std::vector<std::pair<std::string, yapet::pwgen::POOLS>> pools{
+        {"letters", yapet::pwgen::LETTERS},
+        {"digits", yapet::pwgen::DIGITS},
+        {"punct", yapet::pwgen::PUNCT},
+        {"special", yapet::pwgen::SPECIAL},
+        {"other", yapet::pwgen::OTHER}};
+
+    for (const auto& pool : pools) {
+        auto characters = yapet::pwgen::getPools(pool.second);
+        std::vector<int> index(256, -1);
+        for (std::size_t i = 0; i < characters.size(); i++) {
+            index[static_cast<std::uint8_t>(characters[i])] = i;
+        }
+
+        // Characters not in the pool are counted in the last bin, which
+        // is expected to stay empty
+        auto tally = parallel(threads, samples, [&](unsigned long long share) {
+            Tally tally{characters.size() + 1};
+            yapet::pwgen::PasswordGenerator generator{pool.second};
+            constexpr std::size_t PASSWORDS{4096};
+            std::vector<std::uint8_t> buffer(PASSWORDS *
+                                             (PASSWORD_LENGTH + 1));
+            share /= PASSWORD_LENGTH;
+            while (share > 0) {
+                auto count = std::min<unsigned long long>(share, PASSWORDS);
+                generator.generatePasswords(PASSWORD_LENGTH, count,
+                                            buffer.data());
+                for (std::size_t p = 0; p < count; p++) {
+                    auto password = &buffer[p * (PASSWORD_LENGTH + 1)];
+                    int previous = -1;
+                    for (int i = 0; i < PASSWORD_LENGTH; i++) {
+                        int current = index[password[i]];
+                        if (current < 0) {
+                            tally.counts[characters.size()]++;
+                            continue;
+                        }
+                        tally.counts[current]++;
+                        if (previous >= 0) tally.pair(previous, current);
+                        previous = current;
+                    }
+                }
+                share -= count;
+            }
+            return tally;
+        });
+
+        std::string label{"PasswordGenerator " + pool.first};
+        if (tally.counts.back() != 0) {
+            failures++;
+            std::cout << label << ": " << tally.counts.back()
+                      << " characters not in pool  FAILED" << std::endl;
+        }
+        tally.counts.pop_back();
+        chiSquare(label, tally.counts);
+        serialCorrelation(label, tally);
+    }
+}
+
+template <typename Work>
+void throughput(const std::string& name, const std::string& unit,
+                unsigned threads, unsigned long long samples, Work work) {
+    double seconds = timed(threads, samples, work);
+    std::cout << std::left << std::setw(NAME_WIDTH) << name << std::right
+              << std::setw(14) << std::fixed << std::setprecision(0)
+              << samples / seconds << " " << unit << "/s" << std::defaultfloat
+              << std::endl;
+}
+
+/**
+ * Measure the passwords per second generated by the generators \c create()
+ * returns, one per thread.
+ */
+template <typename Create>
+void passwords(const std::string& name, unsigned threads,
+               unsigned long long count, Create create) {
+    throughput(name, "passwords", threads, count,
+               [&create](unsigned long long share) {
+                   auto generator = create();
+                   constexpr std::size_t PASSWORDS{4096};
+                   std::vector<std::uint8_t> buffer(PASSWORDS *
+                                                    (PASSWORD_LENGTH + 1));
+                   while (share > 0) {
+                       auto passwords =
+                           std::min<unsigned long long>(share, PASSWORDS);
+                       generator->generatePasswords(PASSWORD_LENGTH,
+                                                    passwords, buffer.data());
+                       share -= passwords;
+                   }
+               });
+}
+
+void usage(const char* name) {
+    std::cerr << "Usage: " << name << " [-f] [-n <samples>] [-t <threads>]"
+              << std::endl;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    unsigned long long samples = QUICK_SAMPLES;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+
+    int c;
+    while ((c = getopt(argc, argv, "fn:t:")) != -1) {
+        switch (c) {
+            case 'f':
+                samples = FULL_SAMPLES;
+                break;
+            case 'n':
+                samples = std::strtoull(optarg, nullptr, 10);
+                break;
+            case 't':
+                threads = std::strtoul(optarg, nullptr, 10);
+                break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+    if (samples < 1000 || threads < 1) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    std::cout << samples << " samples per test, " << threads << " threads"
+              << std::endl
+              << std::endl;
+
+    bytes(threads, samples);
+    bits(threads, samples);
+    ranges("uniform_int_distribution", threads, samples, [](std::uint32_t n) {
+        std::uniform_int_distribution<std::uint32_t> distribution{0, n - 1};
+        yapet::RandomEngine engine;
+        return [distribution, engine]() mutable {
+            return distribution(engine);
+        };
+    });
+    ranges("RandomSource::uniform()", threads, samples, [](std::uint32_t n) {
+        auto source = std::make_shared<yapet::pwgen::RandomSource>();
+        return [n, source]() { return source->uniform(n); };
+    });
+    pools(threads, samples);
+
+    std::cout << std::endl;
+    throughput("randomBytes()", "bytes", threads, samples,
+               [](unsigned long long share) {
+                   std::vector<std::uint8_t> buffer(BYTES_PER_BATCH);
+                   while (share > 0) {
+                       auto size =
+                           std::min<unsigned long long>(share, buffer.size());
+                       yapet::randomBytes(buffer.data(), size);
+                       share -= size;
+                   }
+               });
+
+    auto count = samples / PASSWORD_LENGTH;
+    passwords("PasswordGenerator", threads, count, []() {
+        return std::unique_ptr<yapet::pwgen::PasswordGenerator>{
+            new yapet::pwgen::PasswordGenerator{yapet::pwgen::ALL}};
+    });
+    passwords("PronounceableGenerator", threads, count, []() {
+        return std::unique_ptr<yapet::pwgen::PronounceableGenerator>{
+            new yapet::pwgen::PronounceableGenerator{}};
+    });
+    passwords("PolicyGenerator", threads, count, []() {
+        return std::unique_ptr<yapet::pwgen::PolicyGenerator>{
+            new yapet::pwgen::PolicyGenerator{yapet::pwgen::Policy::parse(
+                "upper=1- lower=1- digits=1- special=1-")}};
+    });
+
+    std::cout << std::endl
+              << (failures == 0 ? "All tests passed"
+                                : std::to_string(failures) + " tests failed")
+              << std::endl;
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,148 @@
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <unistd.h>
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include "fileerror.hh"
+#include "wordlist.hh"
+
+using namespace yapet::pwgen;
+
+constexpr auto TEXT_FILE{"wordlist-test.txt"};
+constexpr auto COMPILED_FILE{"wordlist-test.words"};
+
+class WordlistTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite *suite() {
+        CppUnit::TestSuite *suiteOfTests =
+            new CppUnit::TestSuite("Wordlist Test");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<WordlistTest>{
+            "should read text word lists", &WordlistTest::readText});
+        suiteOfTests->addTest(new CppUnit::TestCaller<WordlistTest>{
+            "should read dice numbered word lists",
+            &WordlistTest::readDiceware});
+        suiteOfTests->addTest(new CppUnit::TestCaller<WordlistTest>{
+            "should look up serialized words", &WordlistTest::serialized});
+        suiteOfTests->addTest(new CppUnit::TestCaller<WordlistTest>{
+            "should reject invalid word lists", &WordlistTest::invalid});
+        suiteOfTests->addTest(new CppUnit::TestCaller<WordlistTest>{
+            "should load compiled and text files", &WordlistTest::files});
+
+        return suiteOfTests;
+    }
+
+    void tearDown() {
+        ::unlink(TEXT_FILE);
+        ::unlink(COMPILED_FILE);
+    }
+
+    void readText() {
+        std::istringstream in{
+            "# comment\n"
+            "apple\n"
+            "  banana  \n"
+            "\n"
+            "apple\n"
+            "Cherry\t\n"};
+        auto words = Wordlist::readText(in);
+
+        CPPUNIT_ASSERT(words ==
+                       (std::vector<std::string>{"apple", "banana", "Cherry"}));
+    }
+
+    void readDiceware() {
+        std::istringstream in{
+            "11111\tabacus\n"
+            "11112\tabdomen\n"
+            "11113 abdominal\n"
+            "2024\n"};
+        auto words = Wordlist::readText(in);
+
+        CPPUNIT_ASSERT(words == (std::vector<std::string>{
+                                    "abacus", "abdomen", "abdominal", "2024"}));
+    }
+
+    void serialized() {
+        Wordlist wordlist{
+            Wordlist::serialize({"apple", "Banana", "cherry", "kiwi"})};
+
+        CPPUNIT_ASSERT(wordlist.size() == 4);
+        CPPUNIT_ASSERT(wordlist.maxWordLength() == 6);
+        CPPUNIT_ASSERT(wordlist.capitalizable() == 3);
+        CPPUNIT_ASSERT(wordlist.word(0) == "apple");
+        CPPUNIT_ASSERT(wordlist.word(1) == "Banana");
+        CPPUNIT_ASSERT(wordlist.word(3) == "kiwi");
+
+        std::size_t length;
+        auto word = wordlist.word(2, length);
+        CPPUNIT_ASSERT(std::string(word, length) == "cherry");
+
+        CPPUNIT_ASSERT_THROW(wordlist.word(4), std::out_of_range);
+    }
+
+    void invalid() {
+        CPPUNIT_ASSERT_THROW(Wordlist::serialize({"apple"}),
+                             std::invalid_argument);
+        CPPUNIT_ASSERT_THROW(Wordlist::serialize({"apple", ""}),
+                             std::invalid_argument);
+        CPPUNIT_ASSERT_THROW(
+            Wordlist::serialize({"apple", std::string(65, 'a')}),
+            std::invalid_argument);
+
+        auto serialized = Wordlist::serialize({"apple", "banana", "cherry"});
+
+        auto truncated = serialized;
+        truncated.pop_back();
+        CPPUNIT_ASSERT_THROW(Wordlist{truncated}, yapet::FileFormatError);
+
+        auto badMagic = serialized;
+        badMagic[0] = 'X';
+        CPPUNIT_ASSERT_THROW(Wordlist{badMagic}, yapet::FileFormatError);
+
+        // Make the end of the first word point past the text
+        auto badOffset = serialized;
+        badOffset[Wordlist::HEADER_SIZE + 7] = 20;
+        CPPUNIT_ASSERT_THROW(Wordlist{badOffset}, yapet::FileFormatError);
+    }
+
+    void files() {
+        {
+            std::ofstream text{TEXT_FILE};
+            text << "apple\nbanana\ncherry\n";
+        }
+        Wordlist fromText{TEXT_FILE};
+        CPPUNIT_ASSERT(fromText.size() == 3);
+        CPPUNIT_ASSERT(fromText.word(2) == "cherry");
+
+        {
+            auto serialized =
+                Wordlist::serialize({"apple", "banana", "cherry", "kiwi"});
+            std::ofstream compiled{COMPILED_FILE, std::ios::binary};
+            compiled.write(reinterpret_cast<const char *>(serialized.data()),
+                           serialized.size());
+        }
+        Wordlist compiled{COMPILED_FILE};
+        CPPUNIT_ASSERT(compiled.size() == 4);
+        CPPUNIT_ASSERT(compiled.word(3) == "kiwi");
+
+        {
+            std::ofstream text{TEXT_FILE};
+            text << "apple\n";
+        }
+        CPPUNIT_ASSERT_THROW(Wordlist{TEXT_FILE}, yapet::FileFormatError);
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(WordlistTest::suite());
+    return runner.run() ? 0 : 1;
+}
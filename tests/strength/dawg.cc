@@ -0,0 +1,149 @@
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "dawg.hh"
+#include "fileerror.hh"
+
+constexpr auto DICTIONARY{"dawg.bin"};
+constexpr auto ROUNDS{20000};
+
+namespace {
+std::set<std::string> randomWords() {
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<int> length{1, 12};
+    std::uniform_int_distribution<int> letter{'a', 'f'};
+
+    std::set<std::string> words;
+    while (words.size() < ROUNDS) {
+        std::string word(length(generator), ' ');
+        for (auto& c : word) c = static_cast<char>(letter(generator));
+        words.insert(word);
+    }
+    return words;
+}
+
+std::vector<std::uint8_t> build(const std::set<std::string>& words) {
+    yapet::strength::DawgBuilder builder;
+    for (const auto& word : words) builder.add(word);
+    return builder.serialize();
+}
+}  // namespace
+
+class DawgTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite* suite() {
+        CppUnit::TestSuite* suiteOfTests = new CppUnit::TestSuite("Dawg");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<DawgTest>(
+            "should contain exactly the words added", &DawgTest::lookup));
+        suiteOfTests->addTest(new CppUnit::TestCaller<DawgTest>(
+            "should share common suffixes", &DawgTest::minimal));
+        suiteOfTests->addTest(new CppUnit::TestCaller<DawgTest>(
+            "should load dictionary from file", &DawgTest::mappedFile));
+        suiteOfTests->addTest(new CppUnit::TestCaller<DawgTest>(
+            "should handle empty dictionary", &DawgTest::empty));
+        suiteOfTests->addTest(new CppUnit::TestCaller<DawgTest>(
+            "should reject unsorted words", &DawgTest::unsorted));
+        suiteOfTests->addTest(new CppUnit::TestCaller<DawgTest>(
+            "should reject invalid dictionary", &DawgTest::invalid));
+
+        return suiteOfTests;
+    }
+
+    void tearDown() { ::unlink(DICTIONARY); }
+
+    void lookup() {
+        auto words{randomWords()};
+        yapet::strength::Dawg dawg{build(words)};
+
+        std::mt19937 generator{4711};
+        std::uniform_int_distribution<int> length{1, 13};
+        std::uniform_int_distribution<int> letter{'a', 'g'};
+        for (int i = 0; i < ROUNDS; i++) {
+            std::string word(length(generator), ' ');
+            for (auto& c : word) c = static_cast<char>(letter(generator));
+            CPPUNIT_ASSERT(dawg.contains(word) == (words.count(word) > 0));
+        }
+        for (const auto& word : words) {
+            CPPUNIT_ASSERT(dawg.contains(word));
+        }
+        CPPUNIT_ASSERT(!dawg.contains(""));
+    }
+
+    void minimal() {
+        std::set<std::string> words{"bing", "binge", "bring", "sing", "singe",
+                                    "string"};
+        yapet::strength::Dawg dawg{build(words)};
+
+        // "bing(e)" and "sing(e)" share "ing(e)", "bring" and "string"
+        // share "ring": 13 edges, plus the unused edge 0.
+        CPPUNIT_ASSERT(dawg.numberOfEdges() == 14);
+        for (const auto& word : words) {
+            CPPUNIT_ASSERT(dawg.contains(word));
+        }
+        CPPUNIT_ASSERT(!dawg.contains("strin"));
+        CPPUNIT_ASSERT(!dawg.contains("ringe"));
+    }
+
+    void mappedFile() {
+        auto words{randomWords()};
+        auto serialized{build(words)};
+        std::ofstream file{DICTIONARY, std::ios::binary};
+        file.write(reinterpret_cast<const char*>(serialized.data()),
+                   serialized.size());
+        file.close();
+
+        yapet::strength::Dawg dawg{std::string{DICTIONARY}};
+        for (const auto& word : words) {
+            CPPUNIT_ASSERT(dawg.contains(word));
+        }
+        CPPUNIT_ASSERT(!dawg.contains("g"));
+    }
+
+    void empty() {
+        yapet::strength::Dawg dawg{build(std::set<std::string>{})};
+        CPPUNIT_ASSERT(!dawg.contains(""));
+        CPPUNIT_ASSERT(!dawg.contains("a"));
+    }
+
+    void unsorted() {
+        yapet::strength::DawgBuilder builder;
+        builder.add("b");
+        CPPUNIT_ASSERT_THROW(builder.add("a"), std::invalid_argument);
+    }
+
+    void invalid() {
+        std::vector<std::uint8_t> garbage(64, 0xff);
+        CPPUNIT_ASSERT_THROW(yapet::strength::Dawg{garbage},
+                             yapet::FileFormatError);
+
+        auto serialized{build(std::set<std::string>{"abc", "abd"})};
+        serialized.resize(serialized.size() - 1);
+        CPPUNIT_ASSERT_THROW(yapet::strength::Dawg{serialized},
+                             yapet::FileFormatError);
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(DawgTest::suite());
+    return runner.run() ? 0 : 1;
+}
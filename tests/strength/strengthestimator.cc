@@ -0,0 +1,181 @@
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "dawg.hh"
+#include "strengthestimator.hh"
+
+using yapet::strength::Pattern;
+using yapet::strength::StrengthEstimator;
+
+namespace {
+std::shared_ptr<const yapet::strength::Dawg> dictionary() {
+    // Entries as written by mkdawg, sorted: word, zero byte, list, rank
+    // class
+    std::vector<std::string> words{"dragon", "monkey", "password", "sunshine"};
+    std::vector<std::uint64_t> ranks{9, 14, 2, 11};
+
+    yapet::strength::DawgBuilder builder;
+    for (std::size_t i = 0; i < words.size(); i++) {
+        std::string entry{words[i]};
+        entry.push_back('\0');
+        entry.push_back('\1');
+        entry.push_back(
+            static_cast<char>(StrengthEstimator::rankClass(ranks[i])));
+        builder.add(entry);
+    }
+    return std::make_shared<const yapet::strength::Dawg>(builder.serialize());
+}
+}  // namespace
+
+class StrengthEstimatorTest : public CppUnit::TestFixture {
+   private:
+    std::unique_ptr<StrengthEstimator> _estimator;
+
+   public:
+    static CppUnit::TestSuite* suite() {
+        CppUnit::TestSuite* suiteOfTests =
+            new CppUnit::TestSuite("Strength Estimator");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<StrengthEstimatorTest>(
+            "should find dictionary words",
+            &StrengthEstimatorTest::dictionary));
+        suiteOfTests->addTest(new CppUnit::TestCaller<StrengthEstimatorTest>(
+            "should find patterns", &StrengthEstimatorTest::patterns));
+        suiteOfTests->addTest(new CppUnit::TestCaller<StrengthEstimatorTest>(
+            "should rate random passwords strong",
+            &StrengthEstimatorTest::random));
+        suiteOfTests->addTest(new CppUnit::TestCaller<StrengthEstimatorTest>(
+            "should handle empty and long passwords",
+            &StrengthEstimatorTest::length));
+        suiteOfTests->addTest(new CppUnit::TestCaller<StrengthEstimatorTest>(
+            "should estimate incrementally",
+            &StrengthEstimatorTest::incremental));
+        suiteOfTests->addTest(new CppUnit::TestCaller<StrengthEstimatorTest>(
+            "should compute rank classes", &StrengthEstimatorTest::rankClass));
+
+        return suiteOfTests;
+    }
+
+    void setUp() { _estimator.reset(new StrengthEstimator{::dictionary()}); }
+
+    void tearDown() { _estimator.reset(); }
+
+    void dictionary() {
+        auto strength{_estimator->estimate("password")};
+        CPPUNIT_ASSERT(strength.score == 0);
+        CPPUNIT_ASSERT(strength.pattern == Pattern::DICTIONARY);
+
+        // Capitalization and l33t substitutions do not help much
+        strength = _estimator->estimate("P4ssw0rd");
+        CPPUNIT_ASSERT(strength.score == 0);
+        CPPUNIT_ASSERT(strength.pattern == Pattern::DICTIONARY);
+
+        strength = _estimator->estimate("nogard");
+        CPPUNIT_ASSERT(strength.score == 0);
+        CPPUNIT_ASSERT(strength.pattern == Pattern::REVERSED_DICTIONARY);
+
+        CPPUNIT_ASSERT(_estimator->estimate("Sunshine").log10Guesses <
+                       _estimator->estimate("sUnsHine").log10Guesses);
+
+        // Without dictionary, words are guessed by brute force
+        StrengthEstimator noDictionary;
+        CPPUNIT_ASSERT(noDictionary.estimate("monkey").pattern ==
+                       Pattern::BRUTEFORCE);
+        CPPUNIT_ASSERT(noDictionary.estimate("monkey").log10Guesses >
+                       _estimator->estimate("monkey").log10Guesses);
+    }
+
+    void patterns() {
+        CPPUNIT_ASSERT(_estimator->estimate("zxcvbnm").pattern ==
+                       Pattern::SPATIAL);
+        CPPUNIT_ASSERT(_estimator->estimate("1qaz2wsx").pattern ==
+                       Pattern::SPATIAL);
+        CPPUNIT_ASSERT(_estimator->estimate("abcdefgh").pattern ==
+                       Pattern::SEQUENCE);
+        CPPUNIT_ASSERT(_estimator->estimate("97531").pattern ==
+                       Pattern::SEQUENCE);
+        CPPUNIT_ASSERT(_estimator->estimate("zzzzzzzz").pattern ==
+                       Pattern::REPEAT);
+        CPPUNIT_ASSERT(_estimator->estimate("x7yx7yx7y").pattern ==
+                       Pattern::REPEAT);
+        CPPUNIT_ASSERT(_estimator->estimate("1987").pattern == Pattern::YEAR);
+
+        for (auto password : {"zxcvbnm", "abcdefgh", "zzzzzzzz", "1987",
+                              "dragon1987", "monkeymonkey"}) {
+            CPPUNIT_ASSERT(_estimator->estimate(password).score <= 1);
+        }
+    }
+
+    void random() {
+        for (auto password :
+             {"k8#Vq!2zLp9@xW", "Tr0ub4dor&3", "uW,7r;Qn]e2$"}) {
+            auto strength{_estimator->estimate(password)};
+            CPPUNIT_ASSERT(strength.score == StrengthEstimator::MAX_SCORE);
+            CPPUNIT_ASSERT(strength.bits() > 30);
+        }
+    }
+
+    void length() {
+        auto strength{_estimator->estimate("")};
+        CPPUNIT_ASSERT(strength.score == 0);
+        CPPUNIT_ASSERT(strength.log10Guesses == 0.0);
+
+        // Characters beyond MAX_LENGTH count as brute force guesses
+        std::string password(StrengthEstimator::MAX_LENGTH, 'a');
+        auto truncated{_estimator->estimate(password)};
+        password += "bbbbbbbbbb";
+        auto full{_estimator->estimate(password)};
+        CPPUNIT_ASSERT(full.log10Guesses - truncated.log10Guesses > 9.99);
+    }
+
+    void incremental() {
+        const std::string typed{"Sunshine1987!qwertydragonnogard"};
+        StrengthEstimator::State state;
+
+        std::string password;
+        for (auto c : typed) {
+            password.push_back(c);
+            auto expected{_estimator->estimate(password)};
+            auto actual{_estimator->estimate(password, state)};
+            CPPUNIT_ASSERT(expected.log10Guesses == actual.log10Guesses);
+            CPPUNIT_ASSERT(expected.score == actual.score);
+            CPPUNIT_ASSERT(expected.pattern == actual.pattern);
+        }
+
+        // Deleting characters and editing in the middle
+        while (password.size() > 5) {
+            password.pop_back();
+            CPPUNIT_ASSERT(_estimator->estimate(password).log10Guesses ==
+                           _estimator->estimate(password, state).log10Guesses);
+        }
+        password[2] = 'N';
+        CPPUNIT_ASSERT(_estimator->estimate(password).log10Guesses ==
+                       _estimator->estimate(password, state).log10Guesses);
+    }
+
+    void rankClass() {
+        CPPUNIT_ASSERT(StrengthEstimator::rankClass(1) == 0);
+        CPPUNIT_ASSERT(StrengthEstimator::rankClass(2) == 4);
+        CPPUNIT_ASSERT(StrengthEstimator::rankClass(1024) == 40);
+        CPPUNIT_ASSERT(StrengthEstimator::rankClass(UINT64_MAX) == 255);
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(StrengthEstimatorTest::suite());
+    return runner.run() ? 0 : 1;
+}
@@ -0,0 +1,183 @@
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "roaringbitmap.hh"
+
+constexpr auto ROUNDS{20000};
+
+namespace {
+/**
+ * Random values spread over few containers, so that containers become
+ * bitmap containers, and a sparse tail in other containers.
+ */
+std::set<std::uint32_t> randomValues(std::uint32_t seed, std::uint32_t dense) {
+    std::mt19937 generator{seed};
+    std::uniform_int_distribution<std::uint32_t> denseValue{0, dense};
+    std::uniform_int_distribution<std::uint32_t> sparseValue;
+
+    std::set<std::uint32_t> values;
+    for (int i = 0; i < ROUNDS; i++) {
+        values.insert(denseValue(generator));
+    }
+    for (int i = 0; i < 100; i++) {
+        values.insert(sparseValue(generator));
+    }
+    return values;
+}
+
+yapet::RoaringBitmap toBitmap(const std::set<std::uint32_t>& values) {
+    yapet::RoaringBitmap bitmap;
+    for (auto value : values) bitmap.add(value);
+    return bitmap;
+}
+
+std::vector<std::uint32_t> toVector(const std::set<std::uint32_t>& values) {
+    return std::vector<std::uint32_t>{values.begin(), values.end()};
+}
+}  // namespace
+
+class RoaringBitmapTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite* suite() {
+        CppUnit::TestSuite* suiteOfTests =
+            new CppUnit::TestSuite("Roaring Bitmap");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<RoaringBitmapTest>(
+            "should add, remove and find values",
+            &RoaringBitmapTest::addRemove));
+        suiteOfTests->addTest(new CppUnit::TestCaller<RoaringBitmapTest>(
+            "should convert between array and bitmap containers",
+            &RoaringBitmapTest::conversion));
+        suiteOfTests->addTest(new CppUnit::TestCaller<RoaringBitmapTest>(
+            "should compute set operations",
+            &RoaringBitmapTest::setOperations));
+        suiteOfTests->addTest(new CppUnit::TestCaller<RoaringBitmapTest>(
+            "should handle empty bitmaps", &RoaringBitmapTest::empty));
+
+        return suiteOfTests;
+    }
+
+    void addRemove() {
+        auto values{randomValues(1, 200000)};
+        auto bitmap{toBitmap(values)};
+
+        CPPUNIT_ASSERT(bitmap.cardinality() == values.size());
+        CPPUNIT_ASSERT(bitmap.values() == toVector(values));
+        CPPUNIT_ASSERT(!bitmap.add(*values.begin()));
+
+        std::mt19937 generator{2};
+        std::uniform_int_distribution<std::uint32_t> value{0, 200000};
+        for (int i = 0; i < ROUNDS; i++) {
+            auto v = value(generator);
+            CPPUNIT_ASSERT(bitmap.contains(v) == (values.count(v) > 0));
+            CPPUNIT_ASSERT(bitmap.remove(v) == (values.erase(v) > 0));
+        }
+        CPPUNIT_ASSERT(bitmap.values() == toVector(values));
+    }
+
+    void conversion() {
+        yapet::RoaringBitmap bitmap;
+        for (std::uint32_t i = 0; i < 2 * yapet::RoaringBitmap::ARRAY_MAX;
+             i++) {
+            bitmap.add(i * 2);
+        }
+        CPPUNIT_ASSERT(bitmap.cardinality() ==
+                       2 * yapet::RoaringBitmap::ARRAY_MAX);
+
+        for (std::uint32_t i = 0; i < 2 * yapet::RoaringBitmap::ARRAY_MAX;
+             i++) {
+            CPPUNIT_ASSERT(bitmap.contains(i * 2));
+            CPPUNIT_ASSERT(!bitmap.contains(i * 2 + 1));
+            bitmap.remove(i * 2);
+        }
+        CPPUNIT_ASSERT(bitmap.empty());
+
+        // Equal sets compare equal, regardless of how they came to be
+        yapet::RoaringBitmap a, b;
+        for (std::uint32_t i = 0; i <= yapet::RoaringBitmap::ARRAY_MAX; i++) {
+            a.add(i);
+            b.add(i);
+        }
+        a.remove(0);
+        yapet::RoaringBitmap c;
+        for (std::uint32_t i = 1; i <= yapet::RoaringBitmap::ARRAY_MAX; i++) {
+            c.add(i);
+        }
+        CPPUNIT_ASSERT(a == c);
+        CPPUNIT_ASSERT(a != b);
+    }
+
+    void setOperations() {
+        // Combine dense with dense and sparse sets, to exercise all kinds of
+        // container combinations
+        for (std::uint32_t dense : {30000u, 300000u}) {
+            auto aValues{randomValues(3, 300000)};
+            auto bValues{randomValues(4, dense)};
+            auto a{toBitmap(aValues)};
+            auto b{toBitmap(bValues)};
+
+            std::vector<std::uint32_t> expected;
+            std::set_intersection(aValues.begin(), aValues.end(),
+                                  bValues.begin(), bValues.end(),
+                                  std::back_inserter(expected));
+            CPPUNIT_ASSERT((a & b).values() == expected);
+            CPPUNIT_ASSERT((b & a).values() == expected);
+
+            expected.clear();
+            std::set_union(aValues.begin(), aValues.end(), bValues.begin(),
+                           bValues.end(), std::back_inserter(expected));
+            CPPUNIT_ASSERT((a | b).values() == expected);
+            CPPUNIT_ASSERT((a | b).cardinality() == expected.size());
+
+            expected.clear();
+            std::set_difference(aValues.begin(), aValues.end(),
+                                bValues.begin(), bValues.end(),
+                                std::back_inserter(expected));
+            CPPUNIT_ASSERT((a - b).values() == expected);
+
+            expected.clear();
+            std::set_difference(bValues.begin(), bValues.end(),
+                                aValues.begin(), aValues.end(),
+                                std::back_inserter(expected));
+            CPPUNIT_ASSERT((b - a).values() == expected);
+
+            CPPUNIT_ASSERT((a - a).empty());
+            CPPUNIT_ASSERT((a & a) == a);
+            CPPUNIT_ASSERT((a | a) == a);
+        }
+    }
+
+    void empty() {
+        yapet::RoaringBitmap empty;
+        auto a{toBitmap(randomValues(5, 1000))};
+
+        CPPUNIT_ASSERT(empty.cardinality() == 0);
+        CPPUNIT_ASSERT(empty.values().empty());
+        CPPUNIT_ASSERT(!empty.contains(0));
+        CPPUNIT_ASSERT(!empty.remove(0));
+        CPPUNIT_ASSERT((a & empty).empty());
+        CPPUNIT_ASSERT((a | empty) == a);
+        CPPUNIT_ASSERT((a - empty) == a);
+        CPPUNIT_ASSERT((empty - a).empty());
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(RoaringBitmapTest::suite());
+    return runner.run() ? 0 : 1;
+}
@@ -0,0 +1,168 @@
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include "aes256factory.hh"
+#include "passwordlistitem.hh"
+#include "passwordrecord.hh"
+#include "tagindex.hh"
+
+constexpr auto TEST_PASSWORD{"test"};
+constexpr auto ROUNDS{2000};
+
+namespace {
+std::vector<std::uint32_t> ids(std::initializer_list<std::uint32_t> values) {
+    return std::vector<std::uint32_t>{values};
+}
+}  // namespace
+
+class TagIndexTest : public CppUnit::TestFixture {
+   private:
+    yapet::TagIndex _index;
+
+   public:
+    static CppUnit::TestSuite* suite() {
+        CppUnit::TestSuite* suiteOfTests = new CppUnit::TestSuite("Tag Index");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<TagIndexTest>(
+            "should parse tags", &TagIndexTest::parseTags));
+        suiteOfTests->addTest(new CppUnit::TestCaller<TagIndexTest>(
+            "should select records by expression", &TagIndexTest::select));
+        suiteOfTests->addTest(new CppUnit::TestCaller<TagIndexTest>(
+            "should reject malformed expressions",
+            &TagIndexTest::malformed));
+        suiteOfTests->addTest(new CppUnit::TestCaller<TagIndexTest>(
+            "should update records", &TagIndexTest::update));
+        suiteOfTests->addTest(new CppUnit::TestCaller<TagIndexTest>(
+            "should count tags", &TagIndexTest::counts));
+        suiteOfTests->addTest(new CppUnit::TestCaller<TagIndexTest>(
+            "should build index from records", &TagIndexTest::build));
+
+        return suiteOfTests;
+    }
+
+    void setUp() {
+        _index.clear();
+        _index.add(0, {"work", "mail"});
+        _index.add(1, {"work", "old"});
+        _index.add(2, {"personal", "mail"});
+        _index.add(3, {});
+    }
+
+    void parseTags() {
+        std::vector<std::string> expected{"work", "mail", "team-a"};
+        CPPUNIT_ASSERT(yapet::TagIndex::parseTags("work,mail,team-a") ==
+                       expected);
+        CPPUNIT_ASSERT(yapet::TagIndex::parseTags(
+                           " work , mail  team-a,,work, ") == expected);
+        CPPUNIT_ASSERT(yapet::TagIndex::parseTags("work&mail|(team-a)") ==
+                       expected);
+        CPPUNIT_ASSERT(yapet::TagIndex::parseTags("").empty());
+        CPPUNIT_ASSERT(yapet::TagIndex::parseTags(" ,, ").empty());
+    }
+
+    void select() {
+        CPPUNIT_ASSERT(_index.select("work").values() == ids({0, 1}));
+        CPPUNIT_ASSERT(_index.select("work & mail").values() == ids({0}));
+        CPPUNIT_ASSERT(_index.select("work | personal").values() ==
+                       ids({0, 1, 2}));
+        CPPUNIT_ASSERT(_index.select("!work").values() == ids({2, 3}));
+        CPPUNIT_ASSERT(_index.select("work&!old|personal").values() ==
+                       ids({0, 2}));
+        CPPUNIT_ASSERT(_index.select("mail & (old | personal)").values() ==
+                       ids({2}));
+        CPPUNIT_ASSERT(_index.select("!!mail").values() == ids({0, 2}));
+        CPPUNIT_ASSERT(_index.select("unknown").empty());
+        CPPUNIT_ASSERT(_index.select("!unknown") == _index.all());
+    }
+
+    void malformed() {
+        for (auto expression :
+             {"", "work &", "& work", "(work", "work)", "work mail", "!",
+              "work | | mail", "()"}) {
+            CPPUNIT_ASSERT_THROW(_index.select(expression),
+                                 yapet::TagExpressionError);
+        }
+    }
+
+    void update() {
+        _index.add(1, {"personal"});
+        CPPUNIT_ASSERT(_index.select("work").values() == ids({0}));
+        CPPUNIT_ASSERT(_index.select("personal").values() == ids({1, 2}));
+        CPPUNIT_ASSERT(_index.select("old").empty());
+
+        _index.remove(0);
+        CPPUNIT_ASSERT(_index.select("work").empty());
+        CPPUNIT_ASSERT(_index.select("!personal").values() == ids({3}));
+        CPPUNIT_ASSERT(_index.all().values() == ids({1, 2, 3}));
+
+        // Removing unknown ids is harmless
+        _index.remove(4711);
+        CPPUNIT_ASSERT(_index.all().cardinality() == 3);
+    }
+
+    void counts() {
+        std::vector<std::pair<std::string, std::uint64_t>> expected{
+            {"mail", 2}, {"old", 1}, {"personal", 1}, {"work", 2}};
+        CPPUNIT_ASSERT(_index.counts() == expected);
+
+        _index.remove(1);
+        expected = {{"mail", 2}, {"personal", 1}, {"work", 1}};
+        CPPUNIT_ASSERT(_index.counts() == expected);
+    }
+
+    void build() {
+        std::shared_ptr<yapet::AbstractCryptoFactory> cryptoFactory{
+            new yapet::Aes256Factory{
+                yapet::toSecureArray(TEST_PASSWORD),
+                yapet::Key256::newDefaultKeyingParameters()}};
+        auto crypto{cryptoFactory->crypto()};
+
+        std::list<yapet::PasswordListItem> items;
+        for (int i = 0; i < ROUNDS; i++) {
+            auto name{"name " + std::to_string(i)};
+            yapet::PasswordRecord record;
+            record.name(name.c_str());
+            record.host("host");
+            record.username("user");
+            record.password("password");
+            record.comment("comment");
+            record.tags(i % 2 == 0 ? "even" : "odd");
+            if (i % 3 == 0) record.tags("three,even");
+            items.emplace_back(name.c_str(), crypto->encrypt(record.serialize()));
+        }
+
+        yapet::TagIndex index;
+        CPPUNIT_ASSERT(index.build(items, cryptoFactory) == ROUNDS);
+
+        std::uint32_t expectedId = 0;
+        for (const auto& item : items) {
+            CPPUNIT_ASSERT(item.id() == expectedId++);
+        }
+
+        auto three{index.select("three").values()};
+        CPPUNIT_ASSERT(three.size() == (ROUNDS + 2) / 3);
+        for (auto id : three) {
+            CPPUNIT_ASSERT(id % 3 == 0);
+        }
+        CPPUNIT_ASSERT(index.select("even | odd") == index.all());
+        CPPUNIT_ASSERT(index.select("odd & three").values().size() == 0);
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(TagIndexTest::suite());
+    return runner.run() ? 0 : 1;
+}
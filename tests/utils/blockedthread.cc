@@ -0,0 +1,65 @@
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <pthread.h>
+#include <signal.h>
+
+#include "blockedthread.hh"
+
+class BlockedThreadTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite *suite() {
+        CppUnit::TestSuite *suiteOfTests =
+            new CppUnit::TestSuite("Blocked Thread Test");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<BlockedThreadTest>(
+            "should block all signals in thread",
+            &BlockedThreadTest::blockSignals));
+        suiteOfTests->addTest(new CppUnit::TestCaller<BlockedThreadTest>(
+            "should restore signal mask of caller",
+            &BlockedThreadTest::restoreSignalMask));
+
+        return suiteOfTests;
+    }
+
+    void blockSignals() {
+        bool blocked[3]{false, false, false};
+        auto thread{yapet::blockedThread([&blocked](int signal) {
+            sigset_t mask;
+            pthread_sigmask(SIG_SETMASK, nullptr, &mask);
+            blocked[0] = sigismember(&mask, signal) == 1;
+            blocked[1] = sigismember(&mask, SIGWINCH) == 1;
+            blocked[2] = sigismember(&mask, SIGUSR1) == 1;
+        }, SIGALRM)};
+        thread.join();
+
+        CPPUNIT_ASSERT(blocked[0]);
+        CPPUNIT_ASSERT(blocked[1]);
+        CPPUNIT_ASSERT(blocked[2]);
+    }
+
+    void restoreSignalMask() {
+        sigset_t before;
+        pthread_sigmask(SIG_SETMASK, nullptr, &before);
+
+        yapet::blockedThread([]() {}).join();
+
+        sigset_t after;
+        pthread_sigmask(SIG_SETMASK, nullptr, &after);
+        CPPUNIT_ASSERT(sigismember(&after, SIGALRM) ==
+                       sigismember(&before, SIGALRM));
+        CPPUNIT_ASSERT(sigismember(&after, SIGWINCH) ==
+                       sigismember(&before, SIGWINCH));
+        CPPUNIT_ASSERT(sigismember(&after, SIGUSR1) ==
+                       sigismember(&before, SIGUSR1));
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(BlockedThreadTest::suite());
+    return runner.run() ? 0 : 1;
+}
@@ -0,0 +1,89 @@
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <thread>
+#include <vector>
+
+#include "boundedqueue.hh"
+
+class BoundedQueueTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite *suite() {
+        CppUnit::TestSuite *suiteOfTests =
+            new CppUnit::TestSuite("Bounded Queue Test");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<BoundedQueueTest>(
+            "should preserve order", &BoundedQueueTest::fifo));
+        suiteOfTests->addTest(new CppUnit::TestCaller<BoundedQueueTest>(
+            "should drain queued items after close",
+            &BoundedQueueTest::drainAfterClose));
+        suiteOfTests->addTest(new CppUnit::TestCaller<BoundedQueueTest>(
+            "should pass items between threads",
+            &BoundedQueueTest::producerConsumer));
+
+        return suiteOfTests;
+    }
+
+    void fifo() {
+        yapet::BoundedQueue<int> queue{3};
+        CPPUNIT_ASSERT(queue.capacity() == 3);
+
+        CPPUNIT_ASSERT(queue.push(1));
+        CPPUNIT_ASSERT(queue.push(2));
+        CPPUNIT_ASSERT(queue.push(3));
+
+        int item;
+        CPPUNIT_ASSERT(queue.pop(item));
+        CPPUNIT_ASSERT(item == 1);
+        CPPUNIT_ASSERT(queue.pop(item));
+        CPPUNIT_ASSERT(item == 2);
+        CPPUNIT_ASSERT(queue.pop(item));
+        CPPUNIT_ASSERT(item == 3);
+    }
+
+    void drainAfterClose() {
+        yapet::BoundedQueue<int> queue{2};
+        queue.push(1);
+        queue.close();
+
+        CPPUNIT_ASSERT(!queue.push(2));
+
+        int item;
+        CPPUNIT_ASSERT(queue.pop(item));
+        CPPUNIT_ASSERT(item == 1);
+        CPPUNIT_ASSERT(!queue.pop(item));
+    }
+
+    void producerConsumer() {
+        constexpr int ITEMS = 100000;
+        yapet::BoundedQueue<int> queue{4};
+
+        std::thread producer{[&queue] {
+            for (int i = 0; i < ITEMS; i++) {
+                queue.push(i);
+            }
+            queue.close();
+        }};
+
+        std::vector<int> received;
+        int item;
+        while (queue.pop(item)) {
+            received.push_back(item);
+        }
+        producer.join();
+
+        CPPUNIT_ASSERT(received.size() == ITEMS);
+        for (int i = 0; i < ITEMS; i++) {
+            CPPUNIT_ASSERT(received[i] == i);
+        }
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(BoundedQueueTest::suite());
+    return runner.run() ? 0 : 1;
+}
@@ -0,0 +1,197 @@
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "chacha20drbg.hh"
+
+using yapet::ChaCha20Drbg;
+
+namespace {
+// RFC 8439, section 2.3.2
+constexpr std::uint8_t RFC8439_BLOCK[ChaCha20Drbg::BLOCK_SIZE]{
+    0x10, 0xf1, 0xe7, 0xe4, 0xd1, 0x3b, 0x59, 0x15, 0x50, 0x0f, 0xdd,
+    0x1f, 0xa3, 0x20, 0x71, 0xc4, 0xc7, 0xd1, 0xf4, 0xc7, 0x33, 0xc0,
+    0x68, 0x03, 0x04, 0x22, 0xaa, 0x9a, 0xc3, 0xd4, 0x6c, 0x4e, 0xd2,
+    0x82, 0x64, 0x46, 0x07, 0x9f, 0xaa, 0x09, 0x14, 0xc2, 0xd7, 0x05,
+    0xd9, 0x8b, 0x02, 0xa2, 0xb5, 0x12, 0x9c, 0xd1, 0xde, 0x16, 0x4e,
+    0xb9, 0xcb, 0xd0, 0x83, 0xe8, 0xa2, 0x50, 0x3c, 0x4e};
+
+std::vector<std::uint8_t> seed(std::uint8_t first) {
+    std::vector<std::uint8_t> seed(ChaCha20Drbg::KEY_SIZE);
+    for (std::size_t i = 0; i < seed.size(); i++) seed[i] = first + i;
+    return seed;
+}
+
+std::vector<std::uint8_t> generate(ChaCha20Drbg& drbg, std::size_t size) {
+    std::vector<std::uint8_t> bytes(size);
+    drbg.generate(bytes.data(), size);
+    return bytes;
+}
+}  // namespace
+
+class ChaCha20DrbgTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite *suite() {
+        CppUnit::TestSuite *suiteOfTests =
+            new CppUnit::TestSuite("ChaCha20 DRBG Test");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<ChaCha20DrbgTest>(
+            "block function should match RFC 8439",
+            &ChaCha20DrbgTest::rfc8439));
+        suiteOfTests->addTest(new CppUnit::TestCaller<ChaCha20DrbgTest>(
+            "should be determined by seed", &ChaCha20DrbgTest::seeded));
+        suiteOfTests->addTest(new CppUnit::TestCaller<ChaCha20DrbgTest>(
+            "should not repeat batches", &ChaCha20DrbgTest::noRepetition));
+        suiteOfTests->addTest(new CppUnit::TestCaller<ChaCha20DrbgTest>(
+            "should diverge when reseeded", &ChaCha20DrbgTest::reseed));
+        suiteOfTests->addTest(new CppUnit::TestCaller<ChaCha20DrbgTest>(
+            "should use a generator per thread",
+            &ChaCha20DrbgTest::perThread));
+        suiteOfTests->addTest(new CppUnit::TestCaller<ChaCha20DrbgTest>(
+            "should reseed after fork", &ChaCha20DrbgTest::fork));
+        suiteOfTests->addTest(new CppUnit::TestCaller<ChaCha20DrbgTest>(
+            "RandomEngine should work with <random>",
+            &ChaCha20DrbgTest::randomEngine));
+
+        return suiteOfTests;
+    }
+
+    void rfc8439() {
+        std::uint32_t key[8];
+        for (int i = 0; i < 8; i++) {
+            std::uint32_t b = 4 * i;
+            key[i] = b | (b + 1) << 8 | (b + 2) << 16 | (b + 3) << 24;
+        }
+        std::uint32_t nonce[3]{0x09000000, 0x4a000000, 0};
+
+        std::uint8_t block[ChaCha20Drbg::BLOCK_SIZE];
+        ChaCha20Drbg::block(key, 1, nonce, block);
+
+        CPPUNIT_ASSERT(std::memcmp(block, RFC8439_BLOCK, sizeof(block)) == 0);
+    }
+
+    void seeded() {
+        auto seed1 = seed(0);
+        auto seed2 = seed(1);
+        ChaCha20Drbg drbg1{seed1.data()};
+        ChaCha20Drbg drbg2{seed1.data()};
+        ChaCha20Drbg drbg3{seed2.data()};
+
+        auto bytes1 = generate(drbg1, 3000);
+        CPPUNIT_ASSERT(bytes1 == generate(drbg2, 3000));
+        CPPUNIT_ASSERT(bytes1 != generate(drbg3, 3000));
+
+        // Whole words and bytes are taken from the same stream
+        ChaCha20Drbg drbg4{seed1.data()};
+        std::uint32_t word = drbg4.next32();
+        CPPUNIT_ASSERT(std::memcmp(&word, bytes1.data(), sizeof(word)) == 0);
+    }
+
+    void noRepetition() {
+        auto seed1 = seed(0);
+        ChaCha20Drbg drbg{seed1.data()};
+
+        constexpr auto BATCH =
+            ChaCha20Drbg::BUFFER_SIZE - ChaCha20Drbg::KEY_SIZE;
+        auto bytes = generate(drbg, 4 * BATCH);
+        for (int i = 1; i < 4; i++) {
+            CPPUNIT_ASSERT(!std::equal(bytes.begin(), bytes.begin() + BATCH,
+                                       bytes.begin() + i * BATCH));
+        }
+    }
+
+    void reseed() {
+        auto seed1 = seed(0);
+        ChaCha20Drbg drbg1{seed1.data()};
+        ChaCha20Drbg drbg2{seed1.data()};
+
+        drbg2.reseed();
+        CPPUNIT_ASSERT(generate(drbg1, 64) != generate(drbg2, 64));
+    }
+
+    void perThread() {
+        ChaCha20Drbg *other = nullptr;
+        std::vector<std::uint8_t> otherBytes(64);
+        std::thread thread{[&other, &otherBytes]() {
+            other = &ChaCha20Drbg::threadLocal();
+            yapet::randomBytes(otherBytes.data(), otherBytes.size());
+        }};
+        thread.join();
+
+        CPPUNIT_ASSERT(&ChaCha20Drbg::threadLocal() ==
+                       &ChaCha20Drbg::threadLocal());
+        CPPUNIT_ASSERT(&ChaCha20Drbg::threadLocal() != other);
+
+        std::vector<std::uint8_t> bytes(64);
+        yapet::randomBytes(bytes.data(), bytes.size());
+        CPPUNIT_ASSERT(bytes != otherBytes);
+    }
+
+    void fork() {
+        // Make sure the generator exists and has buffered output
+        std::uint8_t bytes[64];
+        yapet::randomBytes(bytes, 1);
+
+        int fds[2];
+        CPPUNIT_ASSERT(::pipe(fds) == 0);
+
+        auto pid = ::fork();
+        CPPUNIT_ASSERT(pid >= 0);
+        if (pid == 0) {
+            yapet::randomBytes(bytes, sizeof(bytes));
+            auto written = ::write(fds[1], bytes, sizeof(bytes));
+            ::_exit(written == sizeof(bytes) ? 0 : 1);
+        }
+        ::close(fds[1]);
+
+        std::uint8_t childBytes[64];
+        std::size_t received = 0;
+        while (received < sizeof(childBytes)) {
+            auto retval = ::read(fds[0], childBytes + received,
+                                 sizeof(childBytes) - received);
+            if (retval <= 0) break;
+            received += retval;
+        }
+        ::close(fds[0]);
+
+        int status;
+        ::waitpid(pid, &status, 0);
+        CPPUNIT_ASSERT(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+        CPPUNIT_ASSERT(received == sizeof(childBytes));
+
+        yapet::randomBytes(bytes, sizeof(bytes));
+        CPPUNIT_ASSERT(std::memcmp(bytes, childBytes, sizeof(bytes)) != 0);
+    }
+
+    void randomEngine() {
+        yapet::RandomEngine engine;
+        std::uniform_int_distribution<int> distribution{1, 6};
+        for (int i = 0; i < 1000; i++) {
+            auto value = distribution(engine);
+            CPPUNIT_ASSERT(value >= 1 && value <= 6);
+        }
+
+        std::vector<int> values{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+        std::shuffle(values.begin(), values.end(), engine);
+        std::sort(values.begin(), values.end());
+        CPPUNIT_ASSERT(values == (std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9,
+                                                   10}));
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(ChaCha20DrbgTest::suite());
+    return runner.run() ? 0 : 1;
+}
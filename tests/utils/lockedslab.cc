@@ -0,0 +1,128 @@
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <cstring>
+#include <stdexcept>
+
+#include "lockedlru.hh"
+#include "lockedslab.hh"
+
+namespace {
+const std::uint8_t *bytes(const char *s) {
+    return reinterpret_cast<const std::uint8_t*>(s);
+}
+
+bool isZero(const std::uint8_t *data, std::size_t size) {
+    for (std::size_t i = 0; i < size; i++) {
+        if (data[i] != 0) return false;
+    }
+    return true;
+}
+}  // namespace
+
+class LockedSlabTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite *suite() {
+        CppUnit::TestSuite *suiteOfTests =
+            new CppUnit::TestSuite("Locked Slab Test");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<LockedSlabTest>(
+            "should allocate all slots", &LockedSlabTest::allocate));
+        suiteOfTests->addTest(new CppUnit::TestCaller<LockedSlabTest>(
+            "should zero released slot", &LockedSlabTest::release));
+        suiteOfTests->addTest(new CppUnit::TestCaller<LockedSlabTest>(
+            "should drop least recently used entry",
+            &LockedSlabTest::dropLeastRecentlyUsed));
+        suiteOfTests->addTest(new CppUnit::TestCaller<LockedSlabTest>(
+            "should replace entry with same key",
+            &LockedSlabTest::replaceEntry));
+        suiteOfTests->addTest(new CppUnit::TestCaller<LockedSlabTest>(
+            "should expire idle entries", &LockedSlabTest::expire));
+
+        return suiteOfTests;
+    }
+
+    void allocate() {
+        yapet::LockedSlab slab{3, 16};
+        CPPUNIT_ASSERT(slab.slots() == 3);
+        CPPUNIT_ASSERT(slab.slotSize() == 16);
+
+        auto a{slab.allocate()};
+        auto b{slab.allocate()};
+        auto c{slab.allocate()};
+        CPPUNIT_ASSERT(a != b && b != c && a != c);
+        CPPUNIT_ASSERT(slab.full());
+        CPPUNIT_ASSERT_THROW(slab.allocate(), std::logic_error);
+
+        slab.release(b);
+        CPPUNIT_ASSERT(!slab.full());
+        CPPUNIT_ASSERT(slab.allocate() == b);
+    }
+
+    void release() {
+        yapet::LockedSlab slab{2, 16};
+        auto s{slab.allocate()};
+        std::memset(slab.slot(s), 0xff, slab.slotSize());
+
+        slab.release(s);
+        CPPUNIT_ASSERT(isZero(slab.slot(s), slab.slotSize()));
+    }
+
+    void dropLeastRecentlyUsed() {
+        using Clock = yapet::LockedLru<>::Clock;
+        auto now{Clock::now()};
+        yapet::LockedLru<int> lru{2, 8};
+
+        lru.store("a", bytes("aaaa"), 4, now, 1);
+        auto b{lru.store("b", bytes("bbbb"), 4, now, 2)};
+        auto dataOfB{lru.data(b)};
+        lru.touch(lru.find("a"), now);
+
+        lru.store("c", bytes("cccc"), 4, now, 3);
+        CPPUNIT_ASSERT(lru.size() == 2);
+        CPPUNIT_ASSERT(lru.find("b") == lru.end());
+        CPPUNIT_ASSERT(lru.find("a")->value == 1);
+        CPPUNIT_ASSERT(std::memcmp(lru.data(lru.find("c")), "cccc", 4) == 0);
+        // The slot of b has been reused by c
+        CPPUNIT_ASSERT(lru.data(lru.find("c")) == dataOfB);
+    }
+
+    void replaceEntry() {
+        auto now{yapet::LockedLru<>::Clock::now()};
+        yapet::LockedLru<> lru{2, 8};
+
+        lru.store("a", bytes("aaaa"), 4, now);
+        lru.store("a", bytes("AAAAAA"), 6, now);
+        CPPUNIT_ASSERT(lru.size() == 1);
+
+        auto entry{lru.find("a")};
+        CPPUNIT_ASSERT(entry->size == 6);
+        CPPUNIT_ASSERT(std::memcmp(lru.data(entry), "AAAAAA", 6) == 0);
+    }
+
+    void expire() {
+        auto now{yapet::LockedLru<>::Clock::now()};
+        yapet::LockedLru<> lru{2, 8};
+
+        auto a{lru.store("a", bytes("aaaa"), 4, now)};
+        auto dataOfA{lru.data(a)};
+        lru.store("b", bytes("bbbb"), 4, now + std::chrono::seconds{10});
+
+        lru.expire(now + std::chrono::seconds{15}, std::chrono::seconds{10});
+        CPPUNIT_ASSERT(lru.size() == 1);
+        CPPUNIT_ASSERT(lru.find("a") == lru.end());
+        CPPUNIT_ASSERT(isZero(dataOfA, lru.slotSize()));
+
+        lru.clear();
+        CPPUNIT_ASSERT(lru.empty());
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(LockedSlabTest::suite());
+    return runner.run() ? 0 : 1;
+}
@@ -0,0 +1,98 @@
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <stdexcept>
+#include <vector>
+
+#include "parallel.hh"
+
+class ParallelTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite *suite() {
+        CppUnit::TestSuite *suiteOfTests =
+            new CppUnit::TestSuite("Parallel Test");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<ParallelTest>(
+            "should visit every item exactly once",
+            &ParallelTest::visitEveryItem));
+        suiteOfTests->addTest(new CppUnit::TestCaller<ParallelTest>(
+            "should handle more workers than items",
+            &ParallelTest::moreWorkersThanItems));
+        suiteOfTests->addTest(new CppUnit::TestCaller<ParallelTest>(
+            "should rethrow worker exceptions",
+            &ParallelTest::rethrowException));
+        suiteOfTests->addTest(new CppUnit::TestCaller<ParallelTest>(
+            "numberOfWorkers should be positive",
+            &ParallelTest::numberOfWorkers));
+
+        return suiteOfTests;
+    }
+
+    void visitEveryItem() {
+        constexpr std::size_t ITEMS = 10007;
+        std::vector<int> visited(ITEMS, 0);
+
+        yapet::parallelFor(ITEMS, 4,
+                           [&visited](unsigned int, std::size_t begin,
+                                      std::size_t end) {
+                               for (auto i = begin; i < end; i++) {
+                                   visited[i]++;
+                               }
+                           });
+
+        for (auto v : visited) {
+            CPPUNIT_ASSERT(v == 1);
+        }
+    }
+
+    void moreWorkersThanItems() {
+        std::vector<int> visited(3, 0);
+        std::vector<int> workerSeen(3, 0);
+
+        yapet::parallelFor(3, 16,
+                           [&](unsigned int worker, std::size_t begin,
+                               std::size_t end) {
+                               CPPUNIT_ASSERT(worker < 3);
+                               workerSeen[worker]++;
+                               for (auto i = begin; i < end; i++) {
+                                   visited[i]++;
+                               }
+                           });
+
+        for (std::size_t i = 0; i < 3; i++) {
+            CPPUNIT_ASSERT(visited[i] == 1);
+            CPPUNIT_ASSERT(workerSeen[i] == 1);
+        }
+
+        // Must not call the function at all
+        yapet::parallelFor(0, 4, [](unsigned int, std::size_t, std::size_t) {
+            CPPUNIT_FAIL("called on empty range");
+        });
+    }
+
+    void rethrowException() {
+        CPPUNIT_ASSERT_THROW(
+            yapet::parallelFor(1000, 4,
+                               [](unsigned int worker, std::size_t,
+                                  std::size_t) {
+                                   if (worker == 2)
+                                       throw std::runtime_error("worker 2");
+                               }),
+            std::runtime_error);
+    }
+
+    void numberOfWorkers() {
+        CPPUNIT_ASSERT(yapet::numberOfWorkers(0) == 1);
+        CPPUNIT_ASSERT(yapet::numberOfWorkers(1) == 1);
+        CPPUNIT_ASSERT(yapet::numberOfWorkers(1000000) >= 1);
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(ParallelTest::suite());
+    return runner.run() ? 0 : 1;
+}
@@ -0,0 +1,105 @@
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include "readpassword.hh"
+
+class ReadPasswordTest : public CppUnit::TestFixture {
+   public:
+    static CppUnit::TestSuite *suite() {
+        CppUnit::TestSuite *suiteOfTests =
+            new CppUnit::TestSuite("Read Password Test");
+
+        suiteOfTests->addTest(new CppUnit::TestCaller<ReadPasswordTest>(
+            "should read line after prompt", &ReadPasswordTest::readLine));
+        suiteOfTests->addTest(new CppUnit::TestCaller<ReadPasswordTest>(
+            "should read empty password", &ReadPasswordTest::emptyLine));
+        suiteOfTests->addTest(new CppUnit::TestCaller<ReadPasswordTest>(
+            "should read line from terminal", &ReadPasswordTest::readTerminal));
+        suiteOfTests->addTest(new CppUnit::TestCaller<ReadPasswordTest>(
+            "should fail reading from closed terminal",
+            &ReadPasswordTest::readClosedTerminal));
+
+        return suiteOfTests;
+    }
+
+    yapet::SecureArray read(const std::string &input, std::ostream &out) {
+        std::istringstream in{input};
+        auto cinBuffer{std::cin.rdbuf(in.rdbuf())};
+        auto password{yapet::readPassword("Password: ", out)};
+        std::cin.rdbuf(cinBuffer);
+        return password;
+    }
+
+    void readLine() {
+        std::ostringstream out;
+        auto password{read("secret\nnext line\n", out)};
+
+        CPPUNIT_ASSERT(password == yapet::toSecureArray("secret"));
+        CPPUNIT_ASSERT(out.str() == "Password: \n");
+    }
+
+    void emptyLine() {
+        std::ostringstream out;
+        CPPUNIT_ASSERT(read("\n", out) == yapet::toSecureArray(""));
+        CPPUNIT_ASSERT(read("", out) == yapet::toSecureArray(""));
+    }
+
+    /**
+     * Read a password from one end of a socket pair standing in for the
+     * terminal, after writing \c input to the other end.
+     */
+    yapet::SecureArray readTerminal(const std::string &input,
+                                    std::string &prompt) {
+        int sockets[2];
+        CPPUNIT_ASSERT(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == 0);
+        ::write(sockets[1], input.c_str(), input.size());
+        ::shutdown(sockets[1], SHUT_WR);
+
+        std::FILE *terminal = ::fdopen(sockets[0], "r+");
+        yapet::SecureArray password;
+        try {
+            password = yapet::readPassword("Password: ", terminal);
+        } catch (...) {
+            std::fclose(terminal);
+            ::close(sockets[1]);
+            throw;
+        }
+        std::fclose(terminal);
+
+        char buffer[64];
+        auto size = ::read(sockets[1], buffer, sizeof(buffer));
+        prompt.assign(buffer, size > 0 ? size : 0);
+        ::close(sockets[1]);
+        return password;
+    }
+
+    void readTerminal() {
+        std::string prompt;
+        auto password{readTerminal("secret\r\nnext line\n", prompt)};
+
+        CPPUNIT_ASSERT(password == yapet::toSecureArray("secret"));
+        CPPUNIT_ASSERT(prompt == "Password: \n");
+    }
+
+    void readClosedTerminal() {
+        std::string prompt;
+        CPPUNIT_ASSERT_THROW(readTerminal("", prompt), std::runtime_error);
+    }
+};
+
+int main() {
+    CppUnit::TextUi::TestRunner runner;
+    runner.addTest(ReadPasswordTest::suite());
+    return runner.run() ? 0 : 1;
+}